@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Compare two run_reduction_benchmark.py result files and flag regressions.
+
+Prints a per-case table of wall time and final-size deltas against the
+baseline and exits non-zero if any wall time regressed by more than the
+threshold, so it can gate a CI job or a perf-sensitive PR.  A final size
+that grew is also flagged: with a deterministic oracle the reduction
+should land in the same place, so a larger result means the schedule
+stopped exploring candidates it used to find.
+"""
+
+import argparse
+import json
+import sys
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('baseline', help='baseline JSON results')
+    parser.add_argument('current', help='current JSON results')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='wall-time regression threshold in percent '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.current) as f:
+        current = json.load(f)
+
+    regressed = False
+    header = f"{'case':<20} {'wall':>16} {'final size':>20}"
+    print(header)
+    print('-' * len(header))
+    for case in sorted(current):
+        cur = current[case]
+        base = baseline.get(case)
+        if base is None:
+            print(f'{case:<20} {"(no baseline)":>16}')
+            continue
+        wall_pct = 100.0 * (cur['wall'] - base['wall']) / base['wall'] \
+            if base['wall'] else 0.0
+        mark = ''
+        if wall_pct > args.threshold:
+            regressed = True
+            mark = '  <-- REGRESSION'
+        if cur['final_bytes'] > base['final_bytes']:
+            regressed = True
+            mark = '  <-- LARGER RESULT'
+        print(f'{case:<20} {cur["wall"]:>8.1f}s {wall_pct:>+6.1f}% '
+              f'{base["final_bytes"]:>8d} -> {cur["final_bytes"]:>8d}{mark}')
+
+    sys.exit(1 if regressed else 0)
+
+
+if __name__ == '__main__':
+    main()
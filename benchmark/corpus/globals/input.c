@@ -0,0 +1,631 @@
+/* synthetic reproducer: many globals and small functions, so the
+   line-based passes and the clang_delta global passes all get
+   meaningful schedules */
+
+int g0 = 0;
+int g1 = 1;
+int g2 = 2;
+int g3 = 3;
+int g4 = 4;
+int g5 = 5;
+int g6 = 6;
+int g7 = 7;
+int g8 = 8;
+int g9 = 9;
+int g10 = 10;
+int g11 = 11;
+int g12 = 12;
+int g13 = 13;
+int g14 = 14;
+int g15 = 15;
+int g16 = 16;
+int g17 = 17;
+int g18 = 18;
+int g19 = 19;
+int g20 = 20;
+int g21 = 21;
+int g22 = 22;
+int g23 = 23;
+int g24 = 24;
+int g25 = 25;
+int g26 = 26;
+int g27 = 27;
+int g28 = 28;
+int g29 = 29;
+int g30 = 30;
+int g31 = 31;
+int g32 = 32;
+int g33 = 33;
+int g34 = 34;
+int g35 = 35;
+int g36 = 36;
+int g37 = 37;
+int g38 = 38;
+int g39 = 39;
+int g40 = 40;
+int g41 = 41;
+int g42 = 42;
+int g43 = 43;
+int g44 = 44;
+int g45 = 45;
+int g46 = 46;
+int g47 = 47;
+int g48 = 48;
+int g49 = 49;
+int g50 = 50;
+int g51 = 51;
+int g52 = 52;
+int g53 = 53;
+int g54 = 54;
+int g55 = 55;
+int g56 = 56;
+int g57 = 57;
+int g58 = 58;
+int g59 = 59;
+int g60 = 60;
+int g61 = 61;
+int g62 = 62;
+int g63 = 63;
+int g64 = 64;
+int g65 = 65;
+int g66 = 66;
+int g67 = 67;
+int g68 = 68;
+int g69 = 69;
+int g70 = 70;
+int g71 = 71;
+int g72 = 72;
+int g73 = 73;
+int g74 = 74;
+int g75 = 75;
+int g76 = 76;
+int g77 = 77;
+int g78 = 78;
+int g79 = 79;
+int g80 = 80;
+int g81 = 81;
+int g82 = 82;
+int g83 = 83;
+int g84 = 84;
+int g85 = 85;
+int g86 = 86;
+int g87 = 87;
+int g88 = 88;
+int g89 = 89;
+int g90 = 90;
+int g91 = 91;
+int g92 = 92;
+int g93 = 93;
+int g94 = 94;
+int g95 = 95;
+int g96 = 96;
+int g97 = 97;
+int g98 = 98;
+int g99 = 99;
+int g100 = 100;
+int g101 = 101;
+int g102 = 102;
+int g103 = 103;
+int g104 = 104;
+int g105 = 105;
+int g106 = 106;
+int g107 = 107;
+int g108 = 108;
+int g109 = 109;
+int g110 = 110;
+int g111 = 111;
+int g112 = 112;
+int g113 = 113;
+int g114 = 114;
+int g115 = 115;
+int g116 = 116;
+int g117 = 117;
+int g118 = 118;
+int g119 = 119;
+volatile int keep_me = 1;
+
+static int f0(int x)
+{
+  if (x > 0)
+    return g41 + x;
+  g19 = x;
+  return g19 - g41;
+}
+
+static int f1(int x)
+{
+  if (x > 1)
+    return g50 + x;
+  g83 = x;
+  return g83 - g50;
+}
+
+static int f2(int x)
+{
+  if (x > 2)
+    return g6 + x;
+  g9 = x;
+  return g9 - g6;
+}
+
+static int f3(int x)
+{
+  if (x > 3)
+    return g105 + x;
+  g68 = x;
+  return g68 - g105;
+}
+
+static int f4(int x)
+{
+  if (x > 4)
+    return g12 + x;
+  g46 = x;
+  return g46 - g12;
+}
+
+static int f5(int x)
+{
+  if (x > 5)
+    return g74 + x;
+  g7 = x;
+  return g7 - g74;
+}
+
+static int f6(int x)
+{
+  if (x > 6)
+    return g116 + x;
+  g64 = x;
+  return g64 - g116;
+}
+
+static int f7(int x)
+{
+  if (x > 7)
+    return g27 + x;
+  g4 = x;
+  return g4 - g27;
+}
+
+static int f8(int x)
+{
+  if (x > 8)
+    return g11 + x;
+  g55 = x;
+  return g55 - g11;
+}
+
+static int f9(int x)
+{
+  if (x > 9)
+    return g53 + x;
+  g8 = x;
+  return g8 - g53;
+}
+
+static int f10(int x)
+{
+  if (x > 10)
+    return g30 + x;
+  g11 = x;
+  return g11 - g30;
+}
+
+static int f11(int x)
+{
+  if (x > 11)
+    return g70 + x;
+  g54 = x;
+  return g54 - g70;
+}
+
+static int f12(int x)
+{
+  if (x > 12)
+    return g7 + x;
+  g105 = x;
+  return g105 - g7;
+}
+
+static int f13(int x)
+{
+  if (x > 13)
+    return g72 + x;
+  g15 = x;
+  return g15 - g72;
+}
+
+static int f14(int x)
+{
+  if (x > 14)
+    return g28 + x;
+  g80 = x;
+  return g80 - g28;
+}
+
+static int f15(int x)
+{
+  if (x > 15)
+    return g80 + x;
+  g74 = x;
+  return g74 - g80;
+}
+
+static int f16(int x)
+{
+  if (x > 16)
+    return g7 + x;
+  g73 = x;
+  return g73 - g7;
+}
+
+static int f17(int x)
+{
+  if (x > 17)
+    return g74 + x;
+  g50 = x;
+  return g50 - g74;
+}
+
+static int f18(int x)
+{
+  if (x > 18)
+    return g6 + x;
+  g28 = x;
+  return g28 - g6;
+}
+
+static int f19(int x)
+{
+  if (x > 19)
+    return g5 + x;
+  g71 = x;
+  return g71 - g5;
+}
+
+static int f20(int x)
+{
+  if (x > 20)
+    return g109 + x;
+  g17 = x;
+  return g17 - g109;
+}
+
+static int f21(int x)
+{
+  if (x > 21)
+    return g37 + x;
+  g53 = x;
+  return g53 - g37;
+}
+
+static int f22(int x)
+{
+  if (x > 22)
+    return g18 + x;
+  g69 = x;
+  return g69 - g18;
+}
+
+static int f23(int x)
+{
+  if (x > 23)
+    return g15 + x;
+  g73 = x;
+  return g73 - g15;
+}
+
+static int f24(int x)
+{
+  if (x > 24)
+    return g39 + x;
+  g71 = x;
+  return g71 - g39;
+}
+
+static int f25(int x)
+{
+  if (x > 25)
+    return g104 + x;
+  g87 = x;
+  return g87 - g104;
+}
+
+static int f26(int x)
+{
+  if (x > 26)
+    return g23 + x;
+  g13 = x;
+  return g13 - g23;
+}
+
+static int f27(int x)
+{
+  if (x > 27)
+    return g74 + x;
+  g73 = x;
+  return g73 - g74;
+}
+
+static int f28(int x)
+{
+  if (x > 28)
+    return g81 + x;
+  g24 = x;
+  return g24 - g81;
+}
+
+static int f29(int x)
+{
+  if (x > 29)
+    return g47 + x;
+  g12 = x;
+  return g12 - g47;
+}
+
+static int f30(int x)
+{
+  if (x > 30)
+    return g70 + x;
+  g91 = x;
+  return g91 - g70;
+}
+
+static int f31(int x)
+{
+  if (x > 31)
+    return g8 + x;
+  g72 = x;
+  return g72 - g8;
+}
+
+static int f32(int x)
+{
+  if (x > 32)
+    return g7 + x;
+  g79 = x;
+  return g79 - g7;
+}
+
+static int f33(int x)
+{
+  if (x > 33)
+    return g26 + x;
+  g63 = x;
+  return g63 - g26;
+}
+
+static int f34(int x)
+{
+  if (x > 34)
+    return g87 + x;
+  g68 = x;
+  return g68 - g87;
+}
+
+static int f35(int x)
+{
+  if (x > 35)
+    return g54 + x;
+  g99 = x;
+  return g99 - g54;
+}
+
+static int f36(int x)
+{
+  if (x > 36)
+    return g40 + x;
+  g59 = x;
+  return g59 - g40;
+}
+
+static int f37(int x)
+{
+  if (x > 37)
+    return g74 + x;
+  g118 = x;
+  return g118 - g74;
+}
+
+static int f38(int x)
+{
+  if (x > 38)
+    return g58 + x;
+  g46 = x;
+  return g46 - g58;
+}
+
+static int f39(int x)
+{
+  if (x > 39)
+    return g38 + x;
+  g31 = x;
+  return g31 - g38;
+}
+
+static int f40(int x)
+{
+  if (x > 40)
+    return g101 + x;
+  g23 = x;
+  return g23 - g101;
+}
+
+static int f41(int x)
+{
+  if (x > 41)
+    return g89 + x;
+  g99 = x;
+  return g99 - g89;
+}
+
+static int f42(int x)
+{
+  if (x > 42)
+    return g31 + x;
+  g10 = x;
+  return g10 - g31;
+}
+
+static int f43(int x)
+{
+  if (x > 43)
+    return g73 + x;
+  g38 = x;
+  return g38 - g73;
+}
+
+static int f44(int x)
+{
+  if (x > 44)
+    return g67 + x;
+  g63 = x;
+  return g63 - g67;
+}
+
+static int f45(int x)
+{
+  if (x > 45)
+    return g112 + x;
+  g43 = x;
+  return g43 - g112;
+}
+
+static int f46(int x)
+{
+  if (x > 46)
+    return g93 + x;
+  g57 = x;
+  return g57 - g93;
+}
+
+static int f47(int x)
+{
+  if (x > 47)
+    return g36 + x;
+  g77 = x;
+  return g77 - g36;
+}
+
+static int f48(int x)
+{
+  if (x > 48)
+    return g9 + x;
+  g15 = x;
+  return g15 - g9;
+}
+
+static int f49(int x)
+{
+  if (x > 49)
+    return g65 + x;
+  g53 = x;
+  return g53 - g65;
+}
+
+static int f50(int x)
+{
+  if (x > 50)
+    return g21 + x;
+  g96 = x;
+  return g96 - g21;
+}
+
+static int f51(int x)
+{
+  if (x > 51)
+    return g43 + x;
+  g19 = x;
+  return g19 - g43;
+}
+
+static int f52(int x)
+{
+  if (x > 52)
+    return g119 + x;
+  g62 = x;
+  return g62 - g119;
+}
+
+static int f53(int x)
+{
+  if (x > 53)
+    return g53 + x;
+  g5 = x;
+  return g5 - g53;
+}
+
+static int f54(int x)
+{
+  if (x > 54)
+    return g85 + x;
+  g9 = x;
+  return g9 - g85;
+}
+
+static int f55(int x)
+{
+  if (x > 55)
+    return g97 + x;
+  g71 = x;
+  return g71 - g97;
+}
+
+static int f56(int x)
+{
+  if (x > 56)
+    return g73 + x;
+  g101 = x;
+  return g101 - g73;
+}
+
+static int f57(int x)
+{
+  if (x > 57)
+    return g112 + x;
+  g104 = x;
+  return g104 - g112;
+}
+
+static int f58(int x)
+{
+  if (x > 58)
+    return g40 + x;
+  g43 = x;
+  return g43 - g40;
+}
+
+static int f59(int x)
+{
+  if (x > 59)
+    return g88 + x;
+  g44 = x;
+  return g44 - g88;
+}
+
+int main(void)
+{
+  int acc = keep_me;
+  acc += f0(acc);
+  acc += f3(acc);
+  acc += f6(acc);
+  acc += f9(acc);
+  acc += f12(acc);
+  acc += f15(acc);
+  acc += f18(acc);
+  acc += f21(acc);
+  acc += f24(acc);
+  acc += f27(acc);
+  acc += f30(acc);
+  acc += f33(acc);
+  acc += f36(acc);
+  acc += f39(acc);
+  acc += f42(acc);
+  acc += f45(acc);
+  acc += f48(acc);
+  acc += f51(acc);
+  acc += f54(acc);
+  acc += f57(acc);
+  return acc & 0xff;
+}
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Interestingness test that replays a recorded oracle.
+
+In replay mode the verdict for a candidate comes from a content-hash ->
+verdict map captured earlier (one "sha256 0|1" line per candidate), so a
+full reduction re-runs with zero compiler invocations: what remains is
+C-Vise's own scheduling and candidate generation, which is what the
+benchmark measures.  Hashes missing from the map fall back to the
+--contains predicate when the corpus case defines one, and otherwise
+count as uninteresting; either way the verdict is deterministic.  Every
+lookup is appended to the --log file as "H <sha256>" or "M <sha256>" so
+the driver can report oracle coverage.
+
+In record mode (--record, with the real interestingness command after
+"--") the command is run as usual and its verdict is appended to the
+oracle file, so a map can be captured from a real reduction and checked
+in for later replays.  Appends are O_APPEND-atomic, which keeps
+concurrent test instances from corrupting the map.
+"""
+
+import argparse
+import hashlib
+import os
+import subprocess
+import sys
+
+
+def content_hash(paths):
+    sha = hashlib.sha256()
+    for path in paths:
+        with open(path, 'rb') as f:
+            sha.update(f.read())
+        sha.update(b'\0')
+    return sha.hexdigest()
+
+
+def load_oracle(path):
+    verdicts = {}
+    if not os.path.exists(path):
+        return verdicts
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            digest, verdict = line.split()
+            verdicts[digest] = int(verdict)
+    return verdicts
+
+
+def append_line(path, line):
+    fd = os.open(path, os.O_WRONLY | os.O_CREAT | os.O_APPEND, 0o644)
+    try:
+        os.write(fd, line.encode())
+    finally:
+        os.close(fd)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--oracle', required=True,
+                        help='recorded hash -> verdict map')
+    parser.add_argument('--log', help='append H/M lookup lines here')
+    parser.add_argument('--contains', action='append', default=[],
+                        help='predicate fallback for unrecorded hashes: the '
+                             'candidate must contain this string (repeatable)')
+    parser.add_argument('--record', action='store_true',
+                        help='run the command after "--" and append its '
+                             'verdict to the oracle')
+    parser.add_argument('files', nargs='+',
+                        help='candidate test case files, in a fixed order')
+    argv = sys.argv[1:]
+    command = []
+    if '--' in argv:
+        split = argv.index('--')
+        argv, command = argv[:split], argv[split + 1:]
+    args = parser.parse_args(argv)
+
+    digest = content_hash(args.files)
+
+    if args.record:
+        if not command:
+            sys.exit('--record needs the real command after "--"')
+        verdict = 1 if subprocess.run(command).returncode == 0 else 0
+        append_line(args.oracle, f'{digest} {verdict}\n')
+        sys.exit(0 if verdict else 1)
+
+    verdict = load_oracle(args.oracle).get(digest)
+    if args.log:
+        append_line(args.log, f'{"M" if verdict is None else "H"} {digest}\n')
+    if verdict is None:
+        if not args.contains:
+            sys.exit(1)
+        blob = b''
+        for path in args.files:
+            with open(path, 'rb') as f:
+                blob += f.read()
+        verdict = all(s.encode() in blob for s in args.contains)
+    sys.exit(0 if verdict else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Run full C-Vise reductions against the corpus and write timings as JSON.
+
+Each corpus case is a directory with the reproducer (input.c), a
+case.json describing it and a recorded interestingness oracle
+(oracle.txt); the reduction runs end to end with replay_oracle.py in the
+test role, so no compiler is invoked and the wall time isolates C-Vise's
+own scheduling and candidate generation.  Per case the report carries
+the wall time, the size reduction achieved and the oracle coverage
+(recorded-hash hits vs predicate/miss fallbacks).  Compare two result
+files with compare_reduction_benchmark.py.
+
+case.json keys:
+  contains        predicate strings replayed for unrecorded hashes
+  cvise_args      extra cvise.py arguments for this case
+  record_command  real interestingness shell command, used by --record
+
+With --record each case runs against its real interestingness command
+instead and the observed hash -> verdict pairs are appended to the
+case's oracle.txt in the source tree, capturing a map from an actual
+reduction for later replays.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+BENCHMARK_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+def run_case(args, case_dir, workdir):
+    with open(os.path.join(case_dir, 'case.json')) as f:
+        case = json.load(f)
+
+    input_file = 'input.c'
+    shutil.copy(os.path.join(case_dir, input_file), workdir)
+    oracle = os.path.join(case_dir, 'oracle.txt')
+    log = os.path.join(workdir, 'oracle.log')
+
+    check = [sys.executable, os.path.join(BENCHMARK_DIR, 'replay_oracle.py'),
+             '--oracle', oracle]
+    if args.record:
+        if 'record_command' not in case:
+            sys.exit(f'{case_dir}: --record needs record_command in case.json')
+        check += ['--record', input_file, '--',
+                  'sh', '-c', case['record_command']]
+    else:
+        check += ['--log', log]
+        for s in case.get('contains', []):
+            check += ['--contains', s]
+        check.append(input_file)
+
+    check_script = os.path.join(workdir, 'check.sh')
+    with open(check_script, 'w') as f:
+        f.write('#!/bin/sh\nexec ' +
+                ' '.join(f"'{c}'" for c in check) + '\n')
+    os.chmod(check_script, 0o755)
+
+    cmd = [sys.executable, args.cvise,
+           '--n', str(args.jobs),
+           '--timeout', '60',
+           '--tidy',
+           check_script, input_file]
+    cmd += case.get('cvise_args', [])
+
+    orig_bytes = os.path.getsize(os.path.join(workdir, input_file))
+    start = time.monotonic()
+    status = subprocess.run(cmd, cwd=workdir,
+                            stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL).returncode
+    wall = time.monotonic() - start
+
+    result = {
+        'wall': round(wall, 3),
+        'exit_status': status,
+        'orig_bytes': orig_bytes,
+        'final_bytes': os.path.getsize(os.path.join(workdir, input_file)),
+    }
+    if os.path.exists(log):
+        with open(log) as f:
+            lookups = f.read().splitlines()
+        result['oracle_hits'] = sum(1 for l in lookups if l.startswith('H'))
+        result['oracle_misses'] = sum(1 for l in lookups if l.startswith('M'))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--cvise', required=True,
+                        help='path to the cvise.py driver')
+    parser.add_argument('--corpus-dir',
+                        default=os.path.join(BENCHMARK_DIR, 'corpus'),
+                        help='directory with the corpus cases '
+                             '(default: %(default)s)')
+    parser.add_argument('--output', required=True,
+                        help='where to write the JSON results')
+    parser.add_argument('--jobs', type=int, default=4,
+                        help='worker processes per reduction; fixed rather '
+                             'than auto-detected so results compare across '
+                             'machines (default: %(default)s)')
+    parser.add_argument('--record', action='store_true',
+                        help="capture each case's oracle from its real "
+                             'interestingness command instead of replaying')
+    args = parser.parse_args()
+
+    cases = sorted(
+        d for d in os.listdir(args.corpus_dir)
+        if os.path.isdir(os.path.join(args.corpus_dir, d)))
+    if not cases:
+        sys.exit(f'no corpus cases found in {args.corpus_dir}')
+
+    results = {}
+    for name in cases:
+        print(f'{name} ... ', end='', flush=True)
+        with tempfile.TemporaryDirectory(prefix='cvise-benchmark-') as workdir:
+            result = run_case(args, os.path.join(args.corpus_dir, name),
+                              workdir)
+        results[name] = result
+        line = (f"{result['wall']:.1f}s, "
+                f"{result['orig_bytes']} -> {result['final_bytes']} bytes")
+        if 'oracle_misses' in result:
+            line += f", {result['oracle_misses']} oracle misses"
+        print(line)
+
+    with open(args.output, 'w') as f:
+        json.dump(results, f, indent=2)
+        f.write('\n')
+    print(f'results written to {args.output}')
+
+
+if __name__ == '__main__':
+    main()
@@ -20,6 +20,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "RecordIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -99,18 +100,15 @@ bool ATSCollectionVisitor::VisitArraySubscriptExpr(ArraySubscriptExpr *ASE)
 
 bool ATSCollectionVisitor::VisitDeclStmt(DeclStmt *DS)
 {
-  for (DeclStmt::decl_iterator I = DS->decl_begin(),
-       E = DS->decl_end(); I != E; ++I) {
-    VarDecl *CurrDecl = dyn_cast<VarDecl>(*I);
-    if (CurrDecl)
-      ConsumerInstance->VarDeclToDeclStmtMap[CurrDecl] = DS;
-  }
+  // shared with UnionToStruct through the per-parse index
+  RecordIndex::GetInstance()->recordDeclStmt(DS);
   return true;
 }
 
-void AggregateToScalar::Initialize(ASTContext &context) 
+void AggregateToScalar::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
+  RecordIndex::GetInstance()->prepare(&context);
   AggregateAccessVisitor = new ATSCollectionVisitor(this);
 }
 
@@ -124,6 +122,8 @@ bool AggregateToScalar::HandleTopLevelDecl(DeclGroupRef D)
  
 void AggregateToScalar::HandleTranslationUnit(ASTContext &Ctx)
 {
+  addCombinedCandidates();
+
   if (QueryInstanceOnly)
     return;
 
@@ -134,8 +134,10 @@ void AggregateToScalar::HandleTranslationUnit(ASTContext &Ctx)
 
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
 
-  TransAssert(TheVarDecl && "NULL TheVarDecl!");
-  TransAssert(TheIdx && "NULL TheIdx!");
+  if (ActivePairs.empty()) {
+    TransAssert(TheVarDecl && "NULL TheVarDecl!");
+    TransAssert(TheIdx && "NULL TheIdx!");
+  }
 
   doRewrite();
 
@@ -164,7 +166,8 @@ bool AggregateToScalar::addTmpVar(const Expr *RefE,
   TransAssert(!dyn_cast<ParmVarDecl>(TheVarDecl) && 
               "We don't handle ParmVarDecl!");
   if (TheVarDecl->isLocalVarDecl()) {
-    DeclStmt *TheDeclStmt = VarDeclToDeclStmtMap[TheVarDecl];
+    DeclStmt *TheDeclStmt =
+      RecordIndex::GetInstance()->getEnclosingDeclStmt(TheVarDecl);
     TransAssert(TheDeclStmt && "NULL TheDeclStmt");
     return RewriteHelper->addStringAfterStmt(TheDeclStmt, VarStr);
   }
@@ -225,7 +228,66 @@ bool AggregateToScalar::createNewVar(const Expr *RefE, std::string &VarName)
   return addTmpVar(RefE, VarName, &InitStr);
 }
 
+// Combined candidates.  Distinct aggregates are independent, and even
+// the paths of one aggregate land on disjoint expressions, so the
+// recorded per-path conversions compose.  Two kinds of combined
+// instances are appended after all the per-path ones (existing counters
+// keep their meaning): one per aggregate with at least two recorded
+// paths, converting all of them, and -- when several aggregates were
+// recorded -- one converting every recorded path in the translation
+// unit.  A reproducer with hundreds of independent aggregates thus gets
+// flattened by a handful of probes instead of one parse per path.
+void AggregateToScalar::addCombinedCandidates(void)
+{
+  if (AllValidPairs.size() < 2)
+    return;
+
+  llvm::SmallPtrSet<const VarDecl *, 16> SeenVars;
+  unsigned NumVars = 0;
+  for (unsigned I = 0; I < AllValidPairs.size(); ++I) {
+    const VarDecl *VD = AllValidPairs[I].first->getCanonicalDecl();
+    if (!SeenVars.insert(VD).second)
+      continue;
+    NumVars++;
+
+    VarIdxPairVector Group;
+    for (unsigned J = I; J < AllValidPairs.size(); ++J) {
+      if (AllValidPairs[J].first->getCanonicalDecl() == VD)
+        Group.push_back(AllValidPairs[J]);
+    }
+    if (Group.size() < 2)
+      continue;
+
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter)
+      ActivePairs = Group;
+  }
+
+  // with a single aggregate the whole-TU instance would repeat its
+  // per-aggregate one
+  if (NumVars < 2)
+    return;
+  ValidInstanceNum++;
+  if (ValidInstanceNum == TransformationCounter)
+    ActivePairs = AllValidPairs;
+}
+
 void AggregateToScalar::doRewrite(void)
+{
+  if (ActivePairs.empty()) {
+    rewriteOnePath();
+    return;
+  }
+
+  RewrittenRanges.clear();
+  for (unsigned I = 0; I < ActivePairs.size(); ++I) {
+    TheVarDecl = ActivePairs[I].first;
+    TheIdx = ActivePairs[I].second;
+    rewriteOnePath();
+  }
+}
+
+void AggregateToScalar::rewriteOnePath(void)
 {
   ExprSet *TheExprSet = ValidExprs[TheIdx];
   TransAssert(!TheExprSet->empty() && "TheExprSet cannot be empty!");
@@ -235,10 +297,29 @@ void AggregateToScalar::doRewrite(void)
   createNewVar(*I, VarName);
 
   for (; I != E; ++I) {
+    // a combined candidate skips an access nested inside one it has
+    // already replaced, e.g. the index expression of a rewritten
+    // subscript; replacing both would stack edits on the same extent
+    if (!ActivePairs.empty() && coveredByRewrittenRange(*I))
+      continue;
     RewriteHelper->replaceExpr((*I), VarName);
   }
 }
 
+bool AggregateToScalar::coveredByRewrittenRange(const Expr *E)
+{
+  SourceRange Range = E->getSourceRange();
+  const char *StartBuf = SrcManager->getCharacterData(Range.getBegin());
+  const char *EndBuf = SrcManager->getCharacterData(Range.getEnd());
+  for (unsigned I = 0; I < RewrittenRanges.size(); ++I) {
+    if (StartBuf <= RewrittenRanges[I].second &&
+        RewrittenRanges[I].first <= EndBuf)
+      return true;
+  }
+  RewrittenRanges.push_back(std::make_pair(StartBuf, EndBuf));
+  return false;
+}
+
 void AggregateToScalar::addOneIdx(const Expr *E,
                                   const VarDecl *VD,
                                   IdxVectorSet *IdxSet,
@@ -248,6 +329,7 @@ void AggregateToScalar::addOneIdx(const Expr *E,
   ExprSet *ESet = new ExprSet();
   ValidExprs[Idx] = ESet;
   ESet->insert(E);
+  AllValidPairs.push_back(std::make_pair(VD, Idx));
   ValidInstanceNum++;
   if (ValidInstanceNum == TransformationCounter) {
     TheVarDecl = VD;
@@ -12,9 +12,11 @@
 #define AGGREGATE_TO_SCALAR_H
 
 #include <string>
-#include <set>
+#include <utility>
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
 #include "Transformation.h"
 
 namespace clang {
@@ -47,7 +49,9 @@ public:
 
 private:
   
-  typedef std::set<const clang::Expr *> ExprSet;
+  // SetVector iterates in insertion order, so doRewrite picks a
+  // deterministic representative expression.
+  typedef llvm::SmallSetVector<const clang::Expr *, 10> ExprSet;
 
   typedef llvm::DenseMap<IndexVector *, ExprSet *> 
     IdxToExpr;
@@ -57,6 +61,10 @@ private:
   typedef llvm::DenseMap<const clang::VarDecl *, IdxVectorSet *>
     VarToIdx;
 
+  typedef std::pair<const clang::VarDecl *, IndexVector *> VarIdxPair;
+
+  typedef llvm::SmallVector<VarIdxPair, 16> VarIdxPairVector;
+
   virtual void Initialize(clang::ASTContext &context);
 
   virtual bool HandleTopLevelDecl(clang::DeclGroupRef D);
@@ -78,9 +86,13 @@ private:
 
   void createNewVarName(std::string &VarName);
 
+  void addCombinedCandidates(void);
+
   void doRewrite(void);
 
-  llvm::DenseMap<const clang::VarDecl *, clang::DeclStmt *> VarDeclToDeclStmtMap;
+  void rewriteOnePath(void);
+
+  bool coveredByRewrittenRange(const clang::Expr *E);
 
   VarToIdx ValidVars;
 
@@ -92,6 +104,18 @@ private:
 
   IndexVector *TheIdx;
 
+  // every recorded (aggregate, access path) pair in collection order
+  VarIdxPairVector AllValidPairs;
+
+  // the pairs the selected combined instance converts; empty for a
+  // per-path instance
+  VarIdxPairVector ActivePairs;
+
+  // source extents already rewritten by the current combined candidate,
+  // as character-data pointers into the main file buffer
+  llvm::SmallVector<std::pair<const char *, const char *>, 16>
+    RewrittenRanges;
+
   // Unimplemented
   AggregateToScalar(void);
 
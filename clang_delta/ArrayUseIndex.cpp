@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "ArrayUseIndex.h"
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+
+using namespace clang;
+
+ArrayUseIndex *ArrayUseIndex::Instance = NULL;
+
+// The builder intentionally visits with the default RecursiveASTVisitor
+// policy (no template instantiations, no implicit code) because that is
+// what the collection visitors it replaces used; a different visitation
+// set would renumber instances.  Two of those visitors ran per top-level
+// declaration from HandleTopLevelDecl, but a single traversal of the
+// translation unit visits the same declarations in the same order, so
+// the stream replays identically for them.
+class ArrayUseBuilder : public RecursiveASTVisitor<ArrayUseBuilder> {
+public:
+  explicit ArrayUseBuilder(ArrayUseIndex *Idx)
+    : Index(Idx)
+  { }
+
+  bool VisitVarDecl(VarDecl *VD) {
+    // Non-array variables are invisible to all three passes.
+    if (!dyn_cast<ArrayType>(VD->getType().getTypePtr()))
+      return true;
+
+    ArrayUseIndex::ArrayEvent E = { VD, NULL, NULL };
+    Index->Events.push_back(E);
+    return true;
+  }
+
+  bool VisitArraySubscriptExpr(ArraySubscriptExpr *ASE) {
+    ArrayUseIndex::ArrayEvent E = { NULL, ASE, NULL };
+    Index->Events.push_back(E);
+    return true;
+  }
+
+  bool VisitDeclRefExpr(DeclRefExpr *DRE) {
+    ArrayUseIndex::ArrayEvent E = { NULL, NULL, DRE };
+    Index->Events.push_back(E);
+    return true;
+  }
+
+private:
+
+  ArrayUseIndex *Index;
+};
+
+ArrayUseIndex *ArrayUseIndex::GetInstance(ASTContext &Ctx)
+{
+  if (!ArrayUseIndex::Instance) {
+    ArrayUseIndex::Instance = new ArrayUseIndex();
+    assert(ArrayUseIndex::Instance);
+  }
+
+  if (ArrayUseIndex::Instance->IndexedContext != &Ctx)
+    ArrayUseIndex::Instance->build(Ctx);
+  return ArrayUseIndex::Instance;
+}
+
+void ArrayUseIndex::Finalize(void)
+{
+  delete ArrayUseIndex::Instance;
+  ArrayUseIndex::Instance = NULL;
+}
+
+void ArrayUseIndex::build(ASTContext &Ctx)
+{
+  Events.clear();
+
+  ArrayUseBuilder Builder(this);
+  Builder.TraverseDecl(Ctx.getTranslationUnitDecl());
+  IndexedContext = &Ctx;
+}
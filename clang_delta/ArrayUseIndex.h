@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef ARRAY_USE_INDEX_H
+#define ARRAY_USE_INDEX_H
+
+#include "llvm/ADT/SmallVector.h"
+
+namespace clang {
+  class ASTContext;
+  class ArraySubscriptExpr;
+  class DeclRefExpr;
+  class VarDecl;
+}
+
+class ArrayUseBuilder;
+
+// A single translation-unit sweep over array usage, shared by the array
+// passes (reduce-array-dim, reduce-array-size, remove-array).  Each of
+// them used to run its own RecursiveASTVisitor over the whole TU to see
+// the same sightings: array variable declarations, array subscripts and
+// the declaration references that use the variables.  The passes run
+// back-to-back in the pass groups, and the daemon keeps a parse server
+// alive per source hash, so without the index those identical sweeps
+// repeat for every pass on every intermediate file.  The index performs
+// the sweep once per parsed AST; in the parse-once server modes the
+// parent builds it right after the parse and every forked counter
+// inherits it through copy-on-write.
+//
+// Unlike the pointer-use index, no derived facts are materialized here:
+// what the three passes compute from the sightings (dimension maps,
+// per-variable subscript vectors, invalidation) is pass-specific, so
+// the index stores only the ordered event stream and each pass replays
+// it with its own filters.
+class ArrayUseIndex {
+friend class ArrayUseBuilder;
+
+public:
+
+  // One traversal sighting, in visitation order: an array-typed variable
+  // declaration (VD set), an array subscript (ASE set) or a declaration
+  // reference (DRE set); exactly one field is non-NULL.  Every
+  // DeclRefExpr is recorded because remove-array invalidates a variable
+  // on any use that is not the immediately preceding subscript base, and
+  // that classification is positional.  The order is load-bearing:
+  // consuming passes replay the stream with their own filters so
+  // instance numbering stays identical to a private traversal.
+  struct ArrayEvent {
+    const clang::VarDecl *VD;
+
+    clang::ArraySubscriptExpr *ASE;
+
+    const clang::DeclRefExpr *DRE;
+  };
+
+  typedef llvm::SmallVector<ArrayEvent, 32> EventVector;
+
+  // Returns the index for Ctx, building it on first request.  A request
+  // for a different ASTContext discards the cached sweep, following the
+  // RewriteUtils::GetInstance convention.
+  static ArrayUseIndex *GetInstance(clang::ASTContext &Ctx);
+
+  static void Finalize(void);
+
+  const EventVector &getArrayEvents(void) const {
+    return Events;
+  }
+
+private:
+
+  void build(clang::ASTContext &Ctx);
+
+  static ArrayUseIndex *Instance;
+
+  const clang::ASTContext *IndexedContext;
+
+  EventVector Events;
+
+  ArrayUseIndex(void)
+    : IndexedContext(NULL)
+  { }
+
+  ~ArrayUseIndex(void) { }
+
+  // Unimplemented
+  ArrayUseIndex(const ArrayUseIndex &);
+
+  void operator=(const ArrayUseIndex &);
+};
+
+#endif
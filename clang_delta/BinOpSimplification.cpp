@@ -64,6 +64,10 @@ private:
 
 bool BSCollectionVisitor::VisitFunctionDecl(FunctionDecl *FD)
 {
+  // Stop the traversal once the requested binary operator is found.
+  if (!ConsumerInstance->needsMoreInstances())
+    return false;
+
   if (ConsumerInstance->isInIncludedFile(FD) ||
       !FD->isThisDeclarationADefinition())
     return true;
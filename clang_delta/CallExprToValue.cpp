@@ -59,13 +59,14 @@ bool CallExprToValueVisitor::VisitCallExpr(CallExpr *CE)
     return true;
 
   ConsumerInstance->ValidInstanceNum++;
-  if (ConsumerInstance->TransformationCounter != 
+  if (ConsumerInstance->TransformationCounter !=
       ConsumerInstance->ValidInstanceNum)
-    return true;
-  
+    return ConsumerInstance->needsMoreInstances();
+
   ConsumerInstance->TheCallExpr = CE;
   ConsumerInstance->CurrentFD = CurrentFD;
-  return true;
+  // Stop the traversal once the requested call expression is found.
+  return ConsumerInstance->needsMoreInstances();
 }
 
 bool CallExprToValueVisitor::VisitFunctionDecl(FunctionDecl *FD)
@@ -18,11 +18,15 @@
 
 #include "llvm/Support/raw_ostream.h"
 #include "clang/Basic/Version.h"
+#include "Transformation.h"
 #include "TransformationManager.h"
 #include "git_version.h"
 
 static TransformationManager *TransMgr;
 static int ErrorCode = -1;
+static bool CounterProvided = false;
+static bool ScheduleWorkersProvided = false;
+static bool SrcFromStdin = false;
 
 static void PrintVersion()
 {
@@ -68,16 +72,91 @@ static void PrintHelpMessage()
 
   llvm::outs() << "  --query-instances=<name>: ";
   llvm::outs() << "query available transformation instances for a given ";
-  llvm::outs() << "transformation\n";
+  llvm::outs() << "transformation. When combined with --counter, the ";
+  llvm::outs() << "transformation is performed as well and the instance ";
+  llvm::outs() << "count is reported on stderr, so one parse serves both ";
+  llvm::outs() << "the query and the rewrite\n";
+
+  llvm::outs() << "  --dump-instance-locations=<name>: ";
+  llvm::outs() << "like --query-instances, but additionally print one ";
+  llvm::outs() << "\"Instance location: <instance> <begin> <end>\" line ";
+  llvm::outs() << "per source range an instance would rewrite (file ";
+  llvm::outs() << "offsets in the main file), so the driver can batch ";
+  llvm::outs() << "non-overlapping instances and bisect only overlapping ";
+  llvm::outs() << "groups\n";
+
+  llvm::outs() << "  --dump-conflict-components=<name>: ";
+  llvm::outs() << "like --query-instances, but additionally print one ";
+  llvm::outs() << "\"Conflict component: <instance> <component>\" line ";
+  llvm::outs() << "per instance, grouping instances whose rewrite ranges ";
+  llvm::outs() << "overlap (transitively) into one component; components ";
+  llvm::outs() << "cannot invalidate each other, so the driver can bisect ";
+  llvm::outs() << "each one on a separate worker\n";
+
+  llvm::outs() << "  --dump-instance-weights=<name>: ";
+  llvm::outs() << "like --query-instances, but additionally print one ";
+  llvm::outs() << "\"Instance weight: <instance> <bytes>\" line per ";
+  llvm::outs() << "instance, heaviest first, weighing an instance by the ";
+  llvm::outs() << "bytes its rewrite would touch; probing in the printed ";
+  llvm::outs() << "order reaches small files in fewer accepted steps ";
+  llvm::outs() << "than discovery order\n";
+
+  llvm::outs() << "  --dump-instance-addresses=<name>: ";
+  llvm::outs() << "like --query-instances, but additionally print one ";
+  llvm::outs() << "\"Instance address: <instance> <decl-index> ";
+  llvm::outs() << "<local-ordinal>\" line per instance, numbering it ";
+  llvm::outs() << "within its top-level declaration; addresses in ";
+  llvm::outs() << "declarations untouched by an edit stay valid, so the ";
+  llvm::outs() << "driver can keep probing them without re-enumerating ";
+  llvm::outs() << "(only transformations that record instance locations ";
+  llvm::outs() << "report addresses)\n";
+
+  llvm::outs() << "  --dump-schedule=<name>: ";
+  llvm::outs() << "like --query-instances, but additionally partition ";
+  llvm::outs() << "the instances into byte-disjoint contiguous counter ";
+  llvm::outs() << "ranges balanced by estimated yield and print one ";
+  llvm::outs() << "\"Schedule candidate: <from-counter> <to-counter> ";
+  llvm::outs() << "<bytes>\" line per range; each candidate applies ";
+  llvm::outs() << "directly via --counter/--to-counter, so a driver can ";
+  llvm::outs() << "hand every worker a distinct candidate\n";
+
+  llvm::outs() << "  --schedule-workers=<number>: ";
+  llvm::outs() << "maximum number of candidates --dump-schedule emits ";
+  llvm::outs() << "(default 32); fewer come out when the instances do ";
+  llvm::outs() << "not split into that many disjoint ranges\n";
+
+  llvm::outs() << "  --instance-budget=<number>: ";
+  llvm::outs() << "stop instance collection early during ";
+  llvm::outs() << "--query-instances once this many instances are found; ";
+  llvm::outs() << "a truncated count is reported with a trailing \"+\" ";
+  llvm::outs() << "(e.g. \"5000+\") as a lower bound, sparing the full-TU ";
+  llvm::outs() << "traversal when the driver only needs rough weights\n";
+
+  llvm::outs() << "  --census-window=<begin>-<end>: ";
+  llvm::outs() << "with --query-instances, only count instances in ";
+  llvm::outs() << "top-level declarations intersecting this byte range ";
+  llvm::outs() << "(normally the hunk of an accepted edit); combined ";
+  llvm::outs() << "with --dump-instance-addresses from the previous ";
+  llvm::outs() << "census, the driver patches its census table from the ";
+  llvm::outs() << "windowed recount instead of recounting the whole ";
+  llvm::outs() << "file\n";
 
   llvm::outs() << "  --counter=<number>: ";
   llvm::outs() << "specify the instance of the transformation to perform\n";
 
+  llvm::outs() << "  --counter-address=<decl-index>:<local-ordinal>: ";
+  llvm::outs() << "specify the instance by two-level address as reported ";
+  llvm::outs() << "by --dump-instance-addresses instead of a global ";
+  llvm::outs() << "counter; an address that no longer resolves fails like ";
+  llvm::outs() << "an out-of-range counter\n";
+
   llvm::outs() << "  --to-counter=<number>: ";
   llvm::outs() << "specify the ending instance of the transformation to ";
   llvm::outs() << "perform (when this option is given, clang_delta will ";
   llvm::outs() << "rewrite multiple instances [counter,to-counter] ";
-  llvm::outs() << "simultaneously. Note that currently only ";
+  llvm::outs() << "simultaneously. The special value \"max\" rewrites all ";
+  llvm::outs() << "instances from counter to the last one in a single ";
+  llvm::outs() << "invocation. Note that currently only ";
   llvm::outs() << "replace-function-def-with-decl supports this feature.)\n";
 
   llvm::outs() << "  --replacement=<string>: ";
@@ -97,18 +176,198 @@ static void PrintHelpMessage()
   llvm::outs() << "this option works only with transformation ";
   llvm::outs() << "expression-detector.\n";
 
+  llvm::outs() << "  --max-size-delta=<bytes>: ";
+  llvm::outs() << "reject a transformed source larger than the input plus ";
+  llvm::outs() << "<bytes> (which may be negative to demand strictly ";
+  llvm::outs() << "smaller output). A rejected candidate writes nothing ";
+  llvm::outs() << "and exits with a distinct error code, so the driver ";
+  llvm::outs() << "skips the test run for it\n";
+
+  llvm::outs() << "  --emit-diff: ";
+  llvm::outs() << "emit a single byte-range edit record ";
+  llvm::outs() << "(\"@CVISE-DIFF <offset> <length> <replacement-length>\" ";
+  llvm::outs() << "followed by the replacement bytes) instead of the full ";
+  llvm::outs() << "transformed source\n";
+
+  llvm::outs() << "  --compute-only: ";
+  llvm::outs() << "run the transformation fully but skip writing the ";
+  llvm::outs() << "output: one \"Edit extent: <offset> <orig-length> ";
+  llvm::outs() << "<new-length>\" line on stderr names the replacement ";
+  llvm::outs() << "hunk, and the hash the output would have had goes to ";
+  llvm::outs() << "the probe log and the --status-fd record, both ";
+  llvm::outs() << "computed from the edit list without constructing the ";
+  llvm::outs() << "output bytes; lets a driver enumerate candidates (e.g. ";
+  llvm::outs() << "for a conflict graph) at zero I/O cost\n";
+
   llvm::outs() << "  --output=<filename>: ";
   llvm::outs() << "specify where to output the transformed source code ";
-  llvm::outs() << "(default: stdout)\n";
+  llvm::outs() << "(default: stdout; \"-\" also selects stdout)\n";
+
+  llvm::outs() << "  --stdin-name=<filename>: ";
+  llvm::outs() << "virtual file name used when the source is read from ";
+  llvm::outs() << "stdin (pass \"-\" as <source_filename>); its extension ";
+  llvm::outs() << "selects the input language (default: stdin.c)\n";
+
+  llvm::outs() << "  --output-fd=<fd>: ";
+  llvm::outs() << "write the transformed source to an already-open file ";
+  llvm::outs() << "descriptor inherited from the driver, e.g. a memfd ";
+  llvm::outs() << "shared with the interestingness test; overrides ";
+  llvm::outs() << "--output\n";
+
+  llvm::outs() << "  --preamble-cache=<dir>: ";
+  llvm::outs() << "cache a precompiled header built from the source file's ";
+  llvm::outs() << "preamble in <dir>, keyed by the preamble content hash, ";
+  llvm::outs() << "so re-parses of intermediate files sharing the same ";
+  llvm::outs() << "header prefix only pay for the changed tail\n";
+
+  llvm::outs() << "  --emit-counter-remap: ";
+  llvm::outs() << "after a successful transformation, print one \"Counter ";
+  llvm::outs() << "remap: <old> <new> <begin> <end>\" line on stderr per ";
+  llvm::outs() << "instance the rewrite left untouched, so a driver can ";
+  llvm::outs() << "continue from its previous position instead of ";
+  llvm::outs() << "re-querying after every successful step\n";
+
+  llvm::outs() << "  --ast-cache=<dir>: ";
+  llvm::outs() << "keep serialized ASTs in <dir>, keyed by source content ";
+  llvm::outs() << "hash, and deserialize instead of parsing when the same ";
+  llvm::outs() << "bytes come around again; reductions revisit intermediate ";
+  llvm::outs() << "content constantly, and deserialization is several times ";
+  llvm::outs() << "faster than a parse\n";
+
+  llvm::outs() << "  --probe-log=<file>: ";
+  llvm::outs() << "record every probe result (transformation, input hash, ";
+  llvm::outs() << "counter, status, output hash) in an append-only log and ";
+  llvm::outs() << "answer repeated failing probes from it without parsing, ";
+  llvm::outs() << "so restarted reductions fast-forward through known-dead ";
+  llvm::outs() << "counters\n";
+
+  llvm::outs() << "  --template-depth=<number>: ";
+  llvm::outs() << "cap Sema's template instantiation depth (like ";
+  llvm::outs() << "-ftemplate-depth), so template-bomb candidates fail ";
+  llvm::outs() << "fast instead of instantiating for minutes ";
+  llvm::outs() << "(default: clang's)\n";
+
+  llvm::outs() << "  --constexpr-steps=<number>: ";
+  llvm::outs() << "cap constexpr evaluation steps (default: clang's)\n";
+
+  llvm::outs() << "  --parse-deadline=<seconds>: ";
+  llvm::outs() << "abort with exit code 4 when the parse has not finished ";
+  llvm::outs() << "in time, so the driver can deprioritize the candidate ";
+  llvm::outs() << "rather than treat a timeout kill as a crash ";
+  llvm::outs() << "(default: none)\n";
+
+  llvm::outs() << "  --trans-deadline=<seconds>: ";
+  llvm::outs() << "cancel a transformation cooperatively when it has not ";
+  llvm::outs() << "finished in time and exit with code 6; unlike a kill ";
+  llvm::outs() << "from the driver this keeps a daemon process and its ";
+  llvm::outs() << "caches alive and leaks no temporary files ";
+  llvm::outs() << "(default: none)\n";
+
+  llvm::outs() << "  --max-memory=<megabytes>: ";
+  llvm::outs() << "abort the transformation with exit code 3 once the ";
+  llvm::outs() << "process resident set exceeds the budget, so one ";
+  llvm::outs() << "pathological candidate cannot OOM sibling workers ";
+  llvm::outs() << "(default: unlimited)\n";
+
+  llvm::outs() << "  --max-parse-errors=<number>: ";
+  llvm::outs() << "abort the parse once this many errors have been seen ";
+  llvm::outs() << "and hand back the original source, so hopelessly broken ";
+  llvm::outs() << "candidates fail fast (default: parse to the end)\n";
 
   llvm::outs() << "  --std=<standard>: ";
   llvm::outs() << "specify C++ standard used (c++98, c++11, c++14, c++17, c++20) ";
   llvm::outs() << "\n";
 
+  llvm::outs() << "  --std-hint-file=<file>: ";
+  llvm::outs() << "remember the accepted standard and detected language ";
+  llvm::outs() << "(\"std <standard> lang <c|c++|opencl>\") in <file> ";
+  llvm::outs() << "after a successful parse, and reuse the recorded ";
+  llvm::outs() << "standard when no --std is given, so a driver probing ";
+  llvm::outs() << "several standards pays for the trial loop only once ";
+  llvm::outs() << "per source\n";
+
+  llvm::outs() << "  --print-output-hash: ";
+  llvm::outs() << "emit an MD5 content hash of the produced output on ";
+  llvm::outs() << "stderr (\"Output hash: <hex>\"), letting a driver ";
+  llvm::outs() << "de-duplicate byte-identical candidates without hashing ";
+  llvm::outs() << "the file itself\n";
+
+  llvm::outs() << "  --status-fd=<fd>: ";
+  llvm::outs() << "write a fixed-size binary status record (error code, ";
+  llvm::outs() << "valid instance count, output hash, per-phase timings) ";
+  llvm::outs() << "to the given already-open descriptor after the run, so ";
+  llvm::outs() << "a driver reads the verdict from one descriptor instead ";
+  llvm::outs() << "of matching stderr text and stat'ing the output file\n";
+
+  llvm::outs() << "  --time-report: ";
+  llvm::outs() << "emit per-phase timings (compiler-instance setup, parse, ";
+  llvm::outs() << "traversal/rewrite, output) as one JSON object on stderr";
+  llvm::outs() << "\n";
+
+  llvm::outs() << "  --report-all-instances: ";
+  llvm::outs() << "parse the source file once and print, for every ";
+  llvm::outs() << "registered transformation, its available instance count ";
+  llvm::outs() << "and the total bytes its instance ranges span (one ";
+  llvm::outs() << "\"name: count bytes\" line per transformation; bytes is ";
+  llvm::outs() << "0 for transformations that do not record ranges), so a ";
+  llvm::outs() << "scheduler can order passes by expected yield";
+  llvm::outs() << "\n";
+
   llvm::outs() << "  --report-instances-count: ";
   llvm::outs() << "report number of transformation instances on stderr ";
   llvm::outs() << "\n";
 
+  llvm::outs() << "  --counter-list=<list>: ";
+  llvm::outs() << "apply the transformation for every counter in a ";
+  llvm::outs() << "comma-separated list of counters and ranges (e.g. ";
+  llvm::outs() << "1,5,9-20) while parsing the source only once; each ";
+  llvm::outs() << "variant is written to <output>.<counter>\n";
+
+  llvm::outs() << "  --counter-order=<order>: ";
+  llvm::outs() << "iteration order for --counter-list: \"reverse\" scans ";
+  llvm::outs() << "from the highest counter down (removals later in the ";
+  llvm::outs() << "file often succeed more), \"stride:K\" visits every ";
+  llvm::outs() << "K-th counter first and then the skipped ones, so an ";
+  llvm::outs() << "early sample already spans the whole counter space\n";
+
+  llvm::outs() << "  --daemon: ";
+  llvm::outs() << "run as a long-lived daemon serving \"<counter> ";
+  llvm::outs() << "<source-file> <output-file>\" requests from stdin; ";
+  llvm::outs() << "parsed ASTs are held by a pool of parse servers keyed ";
+  llvm::outs() << "by source content hash, so requests may interleave ";
+  llvm::outs() << "several files (e.g. the current best plus speculative ";
+  llvm::outs() << "candidates) without re-parsing on every switch; ";
+  llvm::outs() << "a \"compose <source-file> <output-file> <trans> ";
+  llvm::outs() << "<counter> ...\" request chains several transformation ";
+  llvm::outs() << "steps through in-memory intermediates and emits one ";
+  llvm::outs() << "combined candidate; \"compose-steps\" does the same ";
+  llvm::outs() << "but also writes every intermediate to ";
+  llvm::outs() << "<output-file>.<step>, one candidate per step of an ";
+  llvm::outs() << "alternating multi-pass plan";
+  llvm::outs() << "\n";
+
+  llvm::outs() << "  --session=<file1>,<file2>,...: ";
+  llvm::outs() << "multi-TU session replacing the positional source file: ";
+  llvm::outs() << "every listed file is parsed (concurrently, one forked ";
+  llvm::outs() << "child per file) and the transformation instances are ";
+  llvm::outs() << "numbered across the files in list order. With ";
+  llvm::outs() << "--query-instances one \"Session file: <index> <file> ";
+  llvm::outs() << "<count>\" line per file precedes the session-wide ";
+  llvm::outs() << "total; with --counter/--to-counter the global range is ";
+  llvm::outs() << "split at file boundaries, each touched file is ";
+  llvm::outs() << "rewritten into <output>.<file-index> and one \"Session ";
+  llvm::outs() << "output\" manifest line per rewritten file tells the ";
+  llvm::outs() << "driver which outputs to splice over which sources as ";
+  llvm::outs() << "one coordinated candidate (e.g. a definition and its ";
+  llvm::outs() << "extern declaration in different files)\n";
+
+  llvm::outs() << "  --fork-server: ";
+  llvm::outs() << "parse the source file once, then serve counter requests ";
+  llvm::outs() << "read from stdin (one \"<counter> [<to-counter>] ";
+  llvm::outs() << "<output-file>\" request per line), forking a child per ";
+  llvm::outs() << "request so the parse cost is paid only once";
+  llvm::outs() << "\n";
+
   llvm::outs() << "  --warn-on-counter-out-of-bounds: ";
   llvm::outs() << "make only warning when a counter is out of bounds ";
   llvm::outs() << "(replace-function-def-with-decl and remove-unused-function are supported)";
@@ -154,6 +413,71 @@ static void HandleOneArgValue(const std::string &ArgValueStr, size_t SepPos)
     TransMgr->setQueryInstanceFlag(true);
     TransMgr->setTransformationCounter(1);
   }
+  else if (!ArgName.compare("dump-instance-locations")) {
+    if (TransMgr->setTransformation(ArgValue)) {
+      Die("Invalid transformation[" + ArgValue + "]");
+    }
+    TransMgr->setQueryInstanceFlag(true);
+    TransMgr->setTransformationCounter(1);
+    TransMgr->setDumpInstanceLocations(true);
+  }
+  else if (!ArgName.compare("dump-conflict-components")) {
+    if (TransMgr->setTransformation(ArgValue)) {
+      Die("Invalid transformation[" + ArgValue + "]");
+    }
+    TransMgr->setQueryInstanceFlag(true);
+    TransMgr->setTransformationCounter(1);
+    TransMgr->setDumpConflictComponents(true);
+  }
+  else if (!ArgName.compare("dump-instance-weights")) {
+    if (TransMgr->setTransformation(ArgValue)) {
+      Die("Invalid transformation[" + ArgValue + "]");
+    }
+    TransMgr->setQueryInstanceFlag(true);
+    TransMgr->setTransformationCounter(1);
+    TransMgr->setDumpInstanceWeights(true);
+  }
+  else if (!ArgName.compare("dump-instance-addresses")) {
+    if (TransMgr->setTransformation(ArgValue)) {
+      Die("Invalid transformation[" + ArgValue + "]");
+    }
+    TransMgr->setQueryInstanceFlag(true);
+    TransMgr->setTransformationCounter(1);
+    TransMgr->setDumpInstanceAddresses(true);
+  }
+  else if (!ArgName.compare("dump-schedule")) {
+    if (TransMgr->setTransformation(ArgValue)) {
+      Die("Invalid transformation[" + ArgValue + "]");
+    }
+    TransMgr->setQueryInstanceFlag(true);
+    TransMgr->setTransformationCounter(1);
+    // --schedule-workers may appear on either side of this option.
+    if (!ScheduleWorkersProvided)
+      TransMgr->setScheduleCandidates(32);
+  }
+  else if (!ArgName.compare("schedule-workers")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val <= 0)) {
+      Die("Invalid schedule-workers[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setScheduleCandidates(Val);
+    ScheduleWorkersProvided = true;
+  }
+  else if (!ArgName.compare("census-window")) {
+    unsigned Begin, End;
+    char Dash;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Begin) || !(TmpSS >> Dash) || (Dash != '-') ||
+        !(TmpSS >> End) || (End < Begin)) {
+      Die("Invalid census-window[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setCensusWindow(Begin, End);
+  }
   else if (!ArgName.compare("counter")) {
     int Val;
     std::stringstream TmpSS(ArgValue);
@@ -164,8 +488,46 @@ static void HandleOneArgValue(const std::string &ArgValueStr, size_t SepPos)
     }
 
     TransMgr->setTransformationCounter(Val);
+    CounterProvided = true;
+  }
+  else if (!ArgName.compare("counter-address")) {
+    int DeclIndex, LocalOrdinal;
+    char Colon;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> DeclIndex) || !(TmpSS >> Colon) || (Colon != ':') ||
+        !(TmpSS >> LocalOrdinal) || (DeclIndex <= 0) || (LocalOrdinal <= 0)) {
+      ErrorCode = TransformationManager::ErrorInvalidCounter;
+      Die("Invalid counter-address[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setCounterAddress(DeclIndex, LocalOrdinal);
+    CounterProvided = true;
+  }
+  else if (!ArgName.compare("counter-list")) {
+    if (!TransMgr->setCounterList(ArgValue)) {
+      ErrorCode = TransformationManager::ErrorInvalidCounter;
+      Die("Invalid counter-list[" + ArgValueStr + "]");
+    }
+  }
+  else if (!ArgName.compare("session")) {
+    if (!TransMgr->setSessionFiles(ArgValue)) {
+      Die("Invalid session[" + ArgValueStr + "]");
+    }
+  }
+  else if (!ArgName.compare("counter-order")) {
+    if (!TransMgr->setCounterOrder(ArgValue)) {
+      Die("Invalid counter-order[" + ArgValueStr + "]");
+    }
   }
   else if (!ArgName.compare("to-counter")) {
+    if (!ArgValue.compare("max")) {
+      // Rewrite every instance from counter to the last one in a single
+      // invocation; the actual upper bound is only known after analysis.
+      TransMgr->setToCounter(Transformation::ToCounterMax);
+      return;
+    }
+
     int Val;
     std::stringstream TmpSS(ArgValue);
 
@@ -177,7 +539,22 @@ static void HandleOneArgValue(const std::string &ArgValueStr, size_t SepPos)
     TransMgr->setToCounter(Val);
   }
   else if (!ArgName.compare("output")) {
-    TransMgr->setOutputFileName(ArgValue);
+    // stdout is already the default; "-" just spells it explicitly
+    if (ArgValue.compare("-"))
+      TransMgr->setOutputFileName(ArgValue);
+  }
+  else if (!ArgName.compare("stdin-name")) {
+    TransMgr->setStdinName(ArgValue);
+  }
+  else if (!ArgName.compare("output-fd")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid output-fd[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setOutputFd(Val);
   }
   else if (!ArgName.compare("replacement")) {
     TransMgr->setReplacement(ArgValue);
@@ -188,9 +565,109 @@ static void HandleOneArgValue(const std::string &ArgValueStr, size_t SepPos)
   else if (!ArgName.compare("check-reference")) {
     TransMgr->setReferenceValue(ArgValue);
   }
+  else if (!ArgName.compare("max-size-delta")) {
+    long Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val))
+      Die("Invalid max-size-delta[" + ArgValueStr + "]");
+
+    TransMgr->setMaxSizeDelta(Val);
+  }
   else if (!ArgName.compare("std")) {
     TransMgr->setCXXStandard(ArgValue);
   }
+  else if (!ArgName.compare("std-hint-file")) {
+    TransMgr->setStdHintFile(ArgValue);
+  }
+  else if (!ArgName.compare("preamble-cache")) {
+    TransMgr->setPreambleCacheDir(ArgValue);
+  }
+  else if (!ArgName.compare("ast-cache")) {
+    TransMgr->setASTCacheDir(ArgValue);
+  }
+  else if (!ArgName.compare("probe-log")) {
+    TransMgr->setProbeLogFile(ArgValue);
+  }
+  else if (!ArgName.compare("status-fd")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0))
+      Die("Invalid status-fd[" + ArgValueStr + "]");
+
+    TransMgr->setStatusFd(Val);
+  }
+  else if (!ArgName.compare("instance-budget")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid instance-budget[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setInstanceBudget(Val);
+  }
+  else if (!ArgName.compare("template-depth")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid template-depth[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setTemplateDepth(Val);
+  }
+  else if (!ArgName.compare("constexpr-steps")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid constexpr-steps[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setConstexprSteps(Val);
+  }
+  else if (!ArgName.compare("parse-deadline")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid parse-deadline[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setParseDeadline(Val);
+  }
+  else if (!ArgName.compare("trans-deadline")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid trans-deadline[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setTransDeadline(Val);
+  }
+  else if (!ArgName.compare("max-memory")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid max-memory[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setMaxMemoryMB(Val);
+  }
+  else if (!ArgName.compare("max-parse-errors")) {
+    int Val;
+    std::stringstream TmpSS(ArgValue);
+
+    if (!(TmpSS >> Val) || (Val < 0)) {
+      Die("Invalid max-parse-errors[" + ArgValueStr + "]");
+    }
+
+    TransMgr->setMaxParseErrors(Val);
+  }
   else {
     DieOnBadCmdArg("--" + ArgValueStr);
   }
@@ -217,9 +694,33 @@ static void HandleOneNoneValueArg(const std::string &ArgStr)
   else if (!ArgStr.compare("report-instances-count")) {
     TransMgr->setReportInstancesCount(true);
   }
+  else if (!ArgStr.compare("report-all-instances")) {
+    TransMgr->setReportAllInstancesFlag(true);
+  }
   else if (!ArgStr.compare("warn-on-counter-out-of-bounds")) {
     TransMgr->setWarnOnCounterOutOfBounds(true);
   }
+  else if (!ArgStr.compare("fork-server")) {
+    TransMgr->setForkServerFlag(true);
+  }
+  else if (!ArgStr.compare("daemon")) {
+    TransMgr->setDaemonFlag(true);
+  }
+  else if (!ArgStr.compare("emit-diff")) {
+    TransMgr->setEmitDiffFlag(true);
+  }
+  else if (!ArgStr.compare("compute-only")) {
+    TransMgr->setComputeOnlyFlag(true);
+  }
+  else if (!ArgStr.compare("time-report")) {
+    TransMgr->setTimeReportFlag(true);
+  }
+  else if (!ArgStr.compare("print-output-hash")) {
+    TransMgr->setPrintOutputHashFlag(true);
+  }
+  else if (!ArgStr.compare("emit-counter-remap")) {
+    TransMgr->setEmitCounterRemap(true);
+  }
   else {
     DieOnBadCmdArg(ArgStr);
   }
@@ -243,6 +744,11 @@ static void HandleOneArg(const char *Arg)
       HandleOneNoneValueArg(SubArgStr);
     }
   }
+  else if (!ArgStr.compare("-")) {
+    // The source arrives on stdin; it is read after all options (e.g.
+    // --stdin-name) have been seen.
+    SrcFromStdin = true;
+  }
   else {
     TransMgr->setSrcFileName(ArgStr);
   }
@@ -255,22 +761,89 @@ int main(int argc, char **argv)
     HandleOneArg(argv[i]);
   }
 
+  // --query-instances combined with an explicit --counter performs the
+  // transformation and reports the instance count from the same parse.
+  if (TransMgr->getQueryInstanceFlag() && CounterProvided) {
+    TransMgr->setQueryInstanceFlag(false);
+    TransMgr->setReportInstancesCount(true);
+  }
+
   std::string ErrorMsg;
-  if (!TransMgr->verify(ErrorMsg, ErrorCode))
+  if (SrcFromStdin && !TransMgr->readStdinInput(ErrorMsg))
     Die(ErrorMsg);
 
-  if (!TransMgr->initializeCompilerInstance(ErrorMsg))
+  if (!TransMgr->verify(ErrorMsg, ErrorCode))
     Die(ErrorMsg);
 
-  if (!TransMgr->doTransformation(ErrorMsg, ErrorCode)) {
-    // fail to do transformation
-    Die(ErrorMsg);
+  if (TransMgr->hasSession()) {
+    // The session parent never builds a CompilerInstance; the per-file
+    // census and rewrite children each initialize their own.
+    if (!TransMgr->runSession(ErrorMsg, ErrorCode))
+      Die(ErrorMsg);
+    TransformationManager::Finalize();
+    return 0;
   }
 
-  if (TransMgr->getQueryInstanceFlag()) 
+  if (TransMgr->getDaemonFlag()) {
+    // The daemon parent stays pristine; per-content parse servers
+    // initialize their own CompilerInstance after forking.
+    if (!TransMgr->runDaemon(ErrorMsg, ErrorCode))
+      Die(ErrorMsg);
+    TransformationManager::Finalize();
+    return 0;
+  }
+
+  if (TransMgr->getReportAllInstancesFlag()) {
+    if (!TransMgr->initializeCompilerInstance(ErrorMsg))
+      Die(ErrorMsg);
+    if (!TransMgr->runInstanceCensus(ErrorMsg, ErrorCode))
+      Die(ErrorMsg);
+    TransformationManager::Finalize();
+    return 0;
+  }
+
+  if (TransMgr->getForkServerFlag()) {
+    if (!TransMgr->initializeCompilerInstance(ErrorMsg))
+      Die(ErrorMsg);
+    if (!TransMgr->runForkServer(ErrorMsg, ErrorCode))
+      Die(ErrorMsg);
+    TransformationManager::Finalize();
+    return 0;
+  }
+
+  if (TransMgr->hasCounterList()) {
+    if (!TransMgr->initializeCompilerInstance(ErrorMsg))
+      Die(ErrorMsg);
+    if (!TransMgr->runBatchCounters(ErrorMsg, ErrorCode))
+      Die(ErrorMsg);
+    TransformationManager::Finalize();
+    return 0;
+  }
+
+  // No CompilerInstance yet: doTransformation initializes one lazily
+  // once its probe-log and pre-screen short-circuits have had their
+  // chance to answer; a replayed or screened-out probe then never
+  // faults in the Clang libraries' startup footprint.
+  bool TransRV = TransMgr->doTransformation(ErrorMsg, ErrorCode);
+
+  // Report instance counts even when the transformation failed (e.g. on a
+  // counter out of bounds), so a driver can learn the instance budget from
+  // the very parse that exhausted it.
+  if (TransMgr->getQueryInstanceFlag())
     TransMgr->outputNumTransformationInstances();
   if (TransMgr->getReportInstancesCount())
     TransMgr->outputNumTransformationInstancesToStderr();
+  if (TransMgr->getTimeReportFlag())
+    TransMgr->printTimeReport();
+
+  // Success and failure alike get a record; Die below exits, so this
+  // must come first.
+  TransMgr->writeStatusRecord(TransRV ? 0 : ErrorCode);
+
+  if (!TransRV) {
+    // fail to do transformation
+    Die(ErrorMsg);
+  }
 
   TransformationManager::Finalize();
   return 0;
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2015, 2016, 2017 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "ClassHierarchyIndex.h"
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+
+using namespace clang;
+
+ClassHierarchyIndex *ClassHierarchyIndex::Instance = NULL;
+
+// The builder intentionally visits with the default RecursiveASTVisitor
+// policy (no template instantiations, no implicit code) because that is
+// what the collection visitors it replaces used; a different visitation
+// set would renumber instances.
+class ClassHierarchyBuilder : public RecursiveASTVisitor<ClassHierarchyBuilder> {
+public:
+  explicit ClassHierarchyBuilder(ClassHierarchyIndex *Idx)
+    : Index(Idx)
+  { }
+
+  bool VisitCXXRecordDecl(CXXRecordDecl *CXXRD) {
+    Index->VisitedRecords.push_back(CXXRD);
+    return true;
+  }
+
+  bool VisitRecordTypeLoc(RecordTypeLoc TLoc) {
+    const CXXRecordDecl *RD = dyn_cast<CXXRecordDecl>(TLoc.getDecl());
+    if (RD)
+      Index->ReferencedRecords.insert(RD->getCanonicalDecl());
+    return true;
+  }
+
+private:
+  ClassHierarchyIndex *Index;
+};
+
+ClassHierarchyIndex *ClassHierarchyIndex::GetInstance(ASTContext &Ctx)
+{
+  if (!ClassHierarchyIndex::Instance) {
+    ClassHierarchyIndex::Instance = new ClassHierarchyIndex();
+    assert(ClassHierarchyIndex::Instance);
+  }
+
+  if (ClassHierarchyIndex::Instance->IndexedContext != &Ctx)
+    ClassHierarchyIndex::Instance->build(Ctx);
+  return ClassHierarchyIndex::Instance;
+}
+
+void ClassHierarchyIndex::Finalize(void)
+{
+  delete ClassHierarchyIndex::Instance;
+  ClassHierarchyIndex::Instance = NULL;
+}
+
+void ClassHierarchyIndex::build(ASTContext &Ctx)
+{
+  VisitedRecords.clear();
+  ReferencedRecords.clear();
+
+  ClassHierarchyBuilder Builder(this);
+  Builder.TraverseDecl(Ctx.getTranslationUnitDecl());
+  IndexedContext = &Ctx;
+}
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2015, 2016, 2017 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CLASS_HIERARCHY_INDEX_H
+#define CLASS_HIERARCHY_INDEX_H
+
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace clang {
+  class ASTContext;
+  class CXXRecordDecl;
+}
+
+class ClassHierarchyBuilder;
+
+// A single translation-unit sweep over the class shape of the program,
+// shared by the passes that restructure hierarchies (remove-base-class,
+// merge-base-class, replace-class-with-base-template-spec,
+// remove-unused-outer-class, simplify-nested-class).  Each of them used
+// to run its own RecursiveASTVisitor over the whole TU just to see every
+// CXXRecordDecl; on deeply templated inputs those identical traversals
+// dominate per-counter time.  The index performs the sweep once per
+// parsed AST and caches it, so in the parse-once server modes the parent
+// builds it right after the parse and every forked counter inherits it
+// through copy-on-write.
+//
+// Base class and template specialization links are deliberately not
+// duplicated here: they are one pointer away on the CXXRecordDecl
+// itself (bases(), getDescribedClassTemplate()).  The index only
+// materializes what the AST cannot answer cheaply - the visitation
+// sequence and the set of classes named by some type location.
+class ClassHierarchyIndex {
+friend class ClassHierarchyBuilder;
+
+public:
+  typedef llvm::SmallVector<clang::CXXRecordDecl *, 32> RecordVector;
+
+  // Returns the index for Ctx, building it on first request.  A request
+  // for a different ASTContext discards the cached sweep, following the
+  // RewriteUtils::GetInstance convention.
+  static ClassHierarchyIndex *GetInstance(clang::ASTContext &Ctx);
+
+  static void Finalize(void);
+
+  // Every CXXRecordDecl the TU traversal visits, in visitation order.
+  // The order is load-bearing: consuming passes replay it with their own
+  // filters so instance numbering stays identical to a private traversal.
+  const RecordVector &getVisitedRecords(void) const {
+    return VisitedRecords;
+  }
+
+  // True if some type location in the TU names this class.
+  // Expects the canonical decl.
+  bool isReferenced(const clang::CXXRecordDecl *CanonicalRD) const {
+    return ReferencedRecords.count(CanonicalRD);
+  }
+
+private:
+
+  typedef llvm::SmallPtrSet<const clang::CXXRecordDecl *, 32> RecordSet;
+
+  void build(clang::ASTContext &Ctx);
+
+  static ClassHierarchyIndex *Instance;
+
+  const clang::ASTContext *IndexedContext;
+
+  RecordVector VisitedRecords;
+
+  RecordSet ReferencedRecords;
+
+  ClassHierarchyIndex(void)
+    : IndexedContext(NULL)
+  { }
+
+  ~ClassHierarchyIndex(void) { }
+
+  // Unimplemented
+  ClassHierarchyIndex(const ClassHierarchyIndex &);
+
+  void operator=(const ClassHierarchyIndex &);
+};
+
+#endif
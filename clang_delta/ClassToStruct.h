@@ -31,7 +31,11 @@ public:
     : Transformation(TransName, Desc),
       CollectionVisitor(NULL),
       TheCXXRDDef(NULL)
-  { }
+  {
+    // Replacing the class keyword never touches function bodies; parsing
+    // them only slows the transformation down.
+    SafeToSkipFunctionBodies = true;
+  }
 
   ~ClassToStruct(void);
 
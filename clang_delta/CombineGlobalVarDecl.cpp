@@ -20,6 +20,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "GlobalVarIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -39,61 +40,101 @@ although it's valid we can have int *x, y in a DeclGroup. \
 Note that this transformation always tries to combine \
 the rest of declarations with the very first one, \
 so it is an unsound transformation and could result \
-in compilation failures. \n";
+in compilation failures. \
+When more than one combination exists, one extra instance \
+is appended after the per-pair ones which performs all of \
+them in a single invocation. \n";
 
 static RegisterTransformation<CombineGlobalVarDecl>
          Trans("combine-global-var", DescriptionMsg);
 
-void CombineGlobalVarDecl::Initialize(ASTContext &context) 
+void CombineGlobalVarDecl::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
+  GlobalVarIndex::GetInstance()->startSweep(&context);
 }
 
-bool CombineGlobalVarDecl::HandleTopLevelDecl(DeclGroupRef DGR) 
+bool CombineGlobalVarDecl::HandleTopLevelDecl(DeclGroupRef DGR)
 {
-  DeclGroupRef::iterator DI = DGR.begin();
-  VarDecl *VD = dyn_cast<VarDecl>(*DI);
-  if (!VD || isInIncludedFile(VD))
-    return true;
-  SourceRange Range = VD->getSourceRange();
-  if (Range.getBegin().isInvalid() || Range.getEnd().isInvalid())
-    return true;
-
-  const Type *T = VD->getType().getTypePtr();
-  const Type *CanonicalT = Context->getCanonicalType(T);
-  
-  DeclGroupVector *DV;
-  TypeToDeclMap::iterator TI = AllDeclGroups.find(CanonicalT);
-  if (TI == AllDeclGroups.end()) {
-    DV = new DeclGroupVector();
-    AllDeclGroups[CanonicalT] = DV;
-  }
-  else {
-    ValidInstanceNum++;
-    DV = (*TI).second;
-
-    if (ValidInstanceNum == TransformationCounter) {
-      if (DV->size() >= 1) {
-        void* DP1 = *(DV->begin());
-        TheDeclGroupRefs.push_back(DP1);
-        TheDeclGroupRefs.push_back(DGR.getAsOpaquePtr());
+  GlobalVarIndex *Index = GlobalVarIndex::GetInstance();
+  if (Index->isBuilding())
+    Index->recordGroup(*Context, DGR);
+  return true;
+}
+
+// Chain the variable groups by canonical type from the shared index.
+// This previously ran group-at-a-time in HandleTopLevelDecl with a type
+// canonicalization per group; the index hands back the precomputed
+// canonical types, so per invocation this is a plain map walk.
+void CombineGlobalVarDecl::collectInstancesFromIndex(void)
+{
+  GlobalVarIndex *Index = GlobalVarIndex::GetInstance();
+  for (unsigned I = 0; I < Index->getNumGroups(); ++I) {
+    const GlobalVarIndex::GroupEntry &Entry = Index->getGroup(I);
+    const Type *CanonicalT = Entry.CanonicalType;
+    if (!CanonicalT || isInIncludedFile(Entry.FirstDecl))
+      continue;
+    SourceRange Range = Entry.FirstDecl->getSourceRange();
+    if (Range.getBegin().isInvalid() || Range.getEnd().isInvalid())
+      continue;
+
+    DeclGroupVector *DV;
+    TypeToDeclMap::iterator TI = AllDeclGroups.find(CanonicalT);
+    if (TI == AllDeclGroups.end()) {
+      DV = new DeclGroupVector();
+      AllDeclGroups[CanonicalT] = DV;
+    }
+    else {
+      ValidInstanceNum++;
+      DV = (*TI).second;
+
+      if (ValidInstanceNum == TransformationCounter) {
+        if (DV->size() >= 1) {
+          void* DP1 = *(DV->begin());
+          TheDeclGroupRefs.push_back(DP1);
+          TheDeclGroupRefs.push_back(Entry.OpaqueDGR);
+        }
       }
     }
-  }
 
-  // Note that it's unnecessary to keep all encountered
-  // DeclGroupRefs. We could choose a light way similar
-  // to what we implemented in CombineLocalVarDecl.
-  // I kept the code here because I feel we probably 
-  // need more combinations, i.e., not only combine the
-  // first DeclGroup with others, but we could combine
-  // the second one and the third one. 
-  DV->push_back(DGR.getAsOpaquePtr());
-  return true;
+    // Note that it's unnecessary to keep all encountered
+    // DeclGroupRefs. We could choose a light way similar
+    // to what we implemented in CombineLocalVarDecl.
+    // I kept the code here because I feel we probably
+    // need more combinations, i.e., not only combine the
+    // first DeclGroup with others, but we could combine
+    // the second one and the third one.
+    DV->push_back(Entry.OpaqueDGR);
+  }
 }
  
+// One appended instance canonicalizes the whole translation unit:
+// every type's declarations get merged into its first group in a single
+// candidate, instead of paying one parse per merged pair.  Appending it
+// after all per-pair instances keeps their numbering stable.  With at
+// most one mergeable pair the per-pair instance already is the complete
+// canonicalization, so no extra instance is emitted.
+void CombineGlobalVarDecl::addCombinedInstance(void)
+{
+  int NumPairs = 0;
+  for (TypeToDeclMap::iterator I = AllDeclGroups.begin(),
+       E = AllDeclGroups.end(); I != E; ++I) {
+    NumPairs += (*I).second->size() - 1;
+  }
+  if (NumPairs < 2)
+    return;
+
+  ValidInstanceNum++;
+  if (ValidInstanceNum == TransformationCounter)
+    DoCombineAll = true;
+}
+
 void CombineGlobalVarDecl::HandleTranslationUnit(ASTContext &Ctx)
 {
+  GlobalVarIndex::GetInstance()->seal();
+  collectInstancesFromIndex();
+  addCombinedInstance();
+
   if (QueryInstanceOnly) {
     return;
   }
@@ -112,8 +153,33 @@ void CombineGlobalVarDecl::HandleTranslationUnit(ASTContext &Ctx)
     TransError = TransInternalError;
 }
 
+void CombineGlobalVarDecl::doCombineAllGroups(void)
+{
+  for (TypeToDeclMap::iterator I = AllDeclGroups.begin(),
+       E = AllDeclGroups.end(); I != E; ++I) {
+    DeclGroupVector *DV = (*I).second;
+    if (DV->size() < 2)
+      continue;
+    DeclGroupRef FirstDGR = DeclGroupRef::getFromOpaquePtr(*(DV->begin()));
+    SourceLocation EndLoc =
+      RewriteHelper->getDeclGroupRefEndLoc(FirstDGR);
+    for (DeclGroupVector::iterator DI = DV->begin() + 1, DE = DV->end();
+         DI != DE; ++DI) {
+      DeclGroupRef DGR = DeclGroupRef::getFromOpaquePtr(*DI);
+      std::string DStr;
+      RewriteHelper->getDeclGroupStrAndRemove(DGR, DStr);
+      TheRewriter.InsertText(EndLoc, ", " + DStr, /*InsertAfter=*/false);
+    }
+  }
+}
+
 void CombineGlobalVarDecl::doCombination(void)
 {
+  if (DoCombineAll) {
+    doCombineAllGroups();
+    return;
+  }
+
   TransAssert(TheDeclGroupRefs.size() == 2);
   void *P2 = TheDeclGroupRefs.pop_back_val();
   void *P1 = TheDeclGroupRefs.pop_back_val();
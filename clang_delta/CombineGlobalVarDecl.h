@@ -27,7 +27,8 @@ class CombineGlobalVarDecl : public Transformation {
 public:
 
   CombineGlobalVarDecl(const char *TransName, const char *Desc)
-    : Transformation(TransName, Desc)
+    : Transformation(TransName, Desc),
+      DoCombineAll(false)
   { }
 
   ~CombineGlobalVarDecl(void);
@@ -44,12 +45,22 @@ private:
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  // Derive the instances from the shared global-ordering index.
+  void collectInstancesFromIndex();
+
+  void addCombinedInstance();
+
   void doCombination();
 
+  void doCombineAllGroups();
+
   TypeToDeclMap AllDeclGroups;
 
   llvm::SmallVector<void *, 2> TheDeclGroupRefs;
 
+  // selected the appended whole-TU instance: merge every group at once
+  bool DoCombineAll;
+
   // Unimplemented
   CombineGlobalVarDecl(void);
 
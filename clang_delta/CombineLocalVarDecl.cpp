@@ -40,7 +40,10 @@ For example, for the following cod3: \n\
 We will only combine x and y, and won't touch z, \
 because z is not in the same DeclContext as x and y. \
 Note that this transformation is unsound for the same \
-reason as combine-global-var. \n";
+reason as combine-global-var. \
+When more than one combination exists, one extra instance \
+is appended after the per-pair ones which performs all of \
+them in a single invocation. \n";
 
 static RegisterTransformation<CombineLocalVarDecl>
          Trans("combine-local-var", DescriptionMsg);
@@ -109,11 +112,14 @@ bool CombLocalVarCollectionVisitor::VisitCompoundStmt(CompoundStmt *CS)
     }
     else {
       ConsumerInstance->ValidInstanceNum++;
-      if (ConsumerInstance->ValidInstanceNum != 
+      // every pair also feeds the appended whole-TU instance
+      ConsumerInstance->MergePairs.push_back(
+        CombineLocalVarDecl::DeclStmtPair((*TI).second, DS));
+      if (ConsumerInstance->ValidInstanceNum !=
           ConsumerInstance->TransformationCounter)
         continue;
       ConsumerInstance->TheDeclStmts.push_back((*TI).second);
-      ConsumerInstance->TheDeclStmts.push_back(DS);  
+      ConsumerInstance->TheDeclStmts.push_back(DS);
     }
   }
 
@@ -134,8 +140,27 @@ bool CombineLocalVarDecl::HandleTopLevelDecl(DeclGroupRef D)
   return true;
 }
  
+// Append one instance merging every recorded pair in a single
+// candidate, mirroring combine-global-var: declaration merging nearly
+// always passes the test, so one parse for the whole canonicalization
+// beats one parse per pair.  Skipped when only one pair exists, since
+// instance 1 already is the complete canonicalization then.
+void CombineLocalVarDecl::addCombinedInstance(void)
+{
+  if (ValidInstanceNum < 2)
+    return;
+  TransAssert((MergePairs.size() ==
+                 static_cast<size_t>(ValidInstanceNum)) &&
+              "Unexpected number of merge pairs!");
+  ValidInstanceNum++;
+  if (ValidInstanceNum == TransformationCounter)
+    DoCombineAll = true;
+}
+
 void CombineLocalVarDecl::HandleTranslationUnit(ASTContext &Ctx)
 {
+  addCombinedInstance();
+
   if (QueryInstanceOnly) {
     return;
   }
@@ -154,8 +179,27 @@ void CombineLocalVarDecl::HandleTranslationUnit(ASTContext &Ctx)
     TransError = TransInternalError;
 }
 
+void CombineLocalVarDecl::doCombineAllPairs(void)
+{
+  // Each follower is folded into its own first decl-stmt, whose source
+  // text the pair rewrites never touch, so replaying the pairs in visit
+  // order composes cleanly.
+  for (llvm::SmallVector<DeclStmtPair, 16>::iterator
+       I = MergePairs.begin(), E = MergePairs.end(); I != E; ++I) {
+    SourceLocation EndLoc = RewriteHelper->getDeclStmtEndLoc((*I).first);
+    std::string DStr;
+    RewriteHelper->getDeclStmtStrAndRemove((*I).second, DStr);
+    TheRewriter.InsertText(EndLoc, ", " + DStr, /*InsertAfter=*/false);
+  }
+}
+
 void CombineLocalVarDecl::doCombination(void)
 {
+  if (DoCombineAll) {
+    doCombineAllPairs();
+    return;
+  }
+
   TransAssert(TheDeclStmts.size() == 2);
   DeclStmt *DS2 = TheDeclStmts.pop_back_val();
   DeclStmt *DS1 = TheDeclStmts.pop_back_val();
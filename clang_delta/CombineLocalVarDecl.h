@@ -12,6 +12,7 @@
 #define COMBINE_LOCAL_VAR_DECL_H
 
 #include <string>
+#include <utility>
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/DenseMap.h"
 #include "Transformation.h"
@@ -32,7 +33,8 @@ public:
 
   CombineLocalVarDecl(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL)
+      CollectionVisitor(NULL),
+      DoCombineAll(false)
   { }
 
   ~CombineLocalVarDecl(void);
@@ -45,12 +47,25 @@ private:
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  typedef std::pair<clang::DeclStmt *, clang::DeclStmt *> DeclStmtPair;
+
+  void addCombinedInstance();
+
   void doCombination();
 
+  void doCombineAllPairs();
+
   llvm::DenseMap<const clang::Type *, clang::DeclStmt *> DeclStmts;
 
   llvm::SmallVector<clang::DeclStmt *, 2> TheDeclStmts;
 
+  // every mergeable (first decl-stmt, follower) pair, in visit order;
+  // the appended whole-TU instance replays them all at once
+  llvm::SmallVector<DeclStmtPair, 16> MergePairs;
+
+  // selected the appended whole-TU instance
+  bool DoCombineAll;
+
   CombLocalVarCollectionVisitor *CollectionVisitor;
 
   // Unimplemented
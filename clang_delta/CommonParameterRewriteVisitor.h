@@ -11,10 +11,16 @@
 #ifndef COMMON_PARAMETER_REWRITE_VISITOR_H
 #define COMMON_PARAMETER_REWRITE_VISITOR_H
 
+#include <utility>
+
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 
+// (function, parameter-position) pairs for the planning mode below
+typedef llvm::SmallVector<std::pair<clang::FunctionDecl *, int>, 10>
+          ParamTargetVector;
+
 template<typename T, typename Trans>
 class CommonParameterRewriteVisitor : public clang::RecursiveASTVisitor<T> {
 
@@ -31,6 +37,9 @@ public:
 
   void rewriteAllExprs(void);
 
+  void rewritePlannedTargets(clang::Decl *TUD,
+                             const ParamTargetVector &Targets);
+
 protected:
 
   clang::SmallVector<clang::CallExpr *, 10> AllCallExprs;
@@ -98,6 +107,24 @@ void CommonParameterRewriteVisitor<T, Trans>::rewriteAllExprs(void)
   }
 }
 
+// Planning mode: apply several (function, parameter) targets in one
+// run.  Each entry re-binds the consumer's TheFuncDecl/TheParamPos and
+// reuses the single-target traversal and the collected-expression
+// rewrites, so one candidate adjusts the declarations and every call
+// site of all planned functions together.
+template<typename T, typename Trans>
+void CommonParameterRewriteVisitor<T, Trans>::rewritePlannedTargets(
+       clang::Decl *TUD, const ParamTargetVector &Targets)
+{
+  for (ParamTargetVector::const_iterator I = Targets.begin(),
+       E = Targets.end(); I != E; ++I) {
+    ConsumerInstance->TheFuncDecl = (*I).first;
+    ConsumerInstance->TheParamPos = (*I).second;
+    this->TraverseDecl(TUD);
+    rewriteAllExprs();
+  }
+}
+
 template<typename T, typename Trans>
 bool CommonParameterRewriteVisitor<T, Trans>::VisitCallExpr(
        clang::CallExpr *CallE)
@@ -432,13 +432,24 @@ bool CopyPropagation::isRefToTheSameVar(const Expr *CopyE,
   return false;
 }
 
+const std::string &CopyPropagation::getExprStrCached(const Expr *E)
+{
+  ExprToStrMap::iterator I = ExprStrCache.find(E);
+  if (I != ExprStrCache.end())
+    return (*I).second;
+
+  std::string &Str = ExprStrCache[E];
+  RewriteHelper->getExprString(E, Str);
+  return Str;
+}
+
 bool CopyPropagation::hasSameStringRep(const Expr *CopyE,
                                        const Expr *DominatedE)
 {
-  std::string CopyStr, DominatedStr;
-  RewriteHelper->getExprString(CopyE, CopyStr);
-  RewriteHelper->getExprString(DominatedE, DominatedStr);
-  return (CopyStr == DominatedStr);
+  // Note the value copy: the second lookup may grow the cache and move
+  // the first returned reference.
+  const std::string DominatedStr = getExprStrCached(DominatedE);
+  return (getExprStrCached(CopyE) == DominatedStr);
 }
 
 void CopyPropagation::addOneDominatedExpr(const Expr *CopyE,
@@ -466,8 +477,8 @@ void CopyPropagation::addOneDominatedExpr(const Expr *CopyE,
 
 void CopyPropagation::doCopyPropagation(void)
 {
-  std::string CopyStr("");
-  RewriteHelper->getExprString(TheCopyExpr, CopyStr);
+  // Validation already extracted the copy expression's text; reuse it.
+  const std::string &CopyStr = getExprStrCached(TheCopyExpr);
   ExprSet *ESet = DominatedMap[TheCopyExpr];
   TransAssert(ESet && "Empty Expr Set!");
   for (ExprSet::iterator I = ESet->begin(), E = ESet->end(); I != E; ++I) {
@@ -56,6 +56,8 @@ private:
   typedef llvm::DenseMap<const clang::Expr *, ExprSet *>
             ExprToExprsMap;
 
+  typedef llvm::DenseMap<const clang::Expr *, std::string> ExprToStrMap;
+
   virtual void Initialize(clang::ASTContext &context);
 
   virtual bool HandleTopLevelDecl(clang::DeclGroupRef D);
@@ -81,6 +83,8 @@ private:
   bool hasSameStringRep(const clang::Expr *CopyE,
                         const clang::Expr *DominatedE);
 
+  const std::string &getExprStrCached(const clang::Expr *E);
+
   void doCopyPropagation(void);
 
   bool isConstantExpr(const clang::Expr *Exp);
@@ -108,6 +112,14 @@ private:
   // A mapping from an Expr to its dominating Exprs
   ExprToExprsMap DominatedMap;
 
+  // Memoized source text of expressions, the summary every candidate's
+  // validation consults.  A copy expression is compared against each of
+  // its dominated references, so without the cache its text would be
+  // re-extracted once per reference; expressions never change after the
+  // parse, and the parse-once server modes carry the warm cache to every
+  // forked counter.
+  ExprToStrMap ExprStrCache;
+
   CopyPropCollectionVisitor *CollectionVisitor;
 
   const clang::Expr *TheCopyExpr;
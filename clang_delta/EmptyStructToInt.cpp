@@ -242,9 +242,26 @@ void EmptyStructToInt::Initialize(ASTContext &context)
   RewriteVisitor = new EmptyStructToIntRewriteVisitor(this);
 }
 
-void EmptyStructToInt::HandleTranslationUnit(ASTContext &Ctx)
+void EmptyStructToInt::prepareSharedAnalysis(ASTContext &Ctx)
 {
+  // The collection sweep only looks for empty records and base classes;
+  // nothing in it depends on the counter, so in the parse-once server
+  // modes it can run right after the parse and every forked counter
+  // replays VisitedRecordDecls (a SetVector, so the replay numbers the
+  // instances exactly as a fresh sweep would).  A cancelled sweep may
+  // be partial; start clean so a retry cannot count records twice.
+  VisitedRecordDecls.clear();
+  BaseClassDecls.clear();
   CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  if (Transformation::isCancelRequested())
+    return;
+  AnalysisDone = true;
+}
+
+void EmptyStructToInt::HandleTranslationUnit(ASTContext &Ctx)
+{
+  if (!AnalysisDone)
+    prepareSharedAnalysis(Ctx);
   doAnalysis();
 
   if (QueryInstanceOnly)
@@ -256,9 +273,23 @@ void EmptyStructToInt::HandleTranslationUnit(ASTContext &Ctx)
   }
 
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
-  removeRecordDecls();
-  RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
-  
+  if (DoAllRecords) {
+    // replay the single-record path once per census entry; the ranges
+    // each record's rewrites touch are disjoint across records, so the
+    // replays compose into one candidate and share the one parse
+    for (std::vector<const RecordDecl *>::const_iterator
+         I = ValidRecordDecls.begin(), E = ValidRecordDecls.end();
+         I != E; ++I) {
+      TheRecordDecl = (*I);
+      removeRecordDecls();
+      RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    }
+  }
+  else {
+    removeRecordDecls();
+    RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  }
+
   // sanity check that we actually
   // have done some text modifications. 
   // It could be false due to invalid code being transformed.
@@ -321,6 +352,8 @@ void EmptyStructToInt::handleOneVarDecl(const VarDecl *VD)
 
 void EmptyStructToInt::doAnalysis(void)
 {
+  ValidRecordDecls.clear();
+  DoAllRecords = false;
   for (RecordDeclSet::const_iterator I = VisitedRecordDecls.begin(),
        E = VisitedRecordDecls.end(); I != E; ++I) {
     const RecordDecl *RD = (*I);
@@ -331,6 +364,19 @@ void EmptyStructToInt::doAnalysis(void)
     ValidInstanceNum++;
     if (ValidInstanceNum == TransformationCounter)
       TheRecordDecl = RD;
+    ValidRecordDecls.push_back(RD);
+  }
+
+  // Whole-census collapse: one extra instance replacing every counted
+  // record at once.  Appended after the per-record instances so their
+  // numbering is untouched, and only emitted when it differs from the
+  // single-record candidate.  Windows-header reproducers carry
+  // thousands of empty records; trying the collapse first trades one
+  // parse against thousands.
+  if (ValidRecordDecls.size() >= 2) {
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter)
+      DoAllRecords = true;
   }
 }
 
@@ -11,6 +11,7 @@
 #ifndef EMPTY_STRUCT_TO_INT_H
 #define EMPTY_STRUCT_TO_INT_H
 
+#include <vector>
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "Transformation.h"
@@ -35,7 +36,9 @@ public:
     : Transformation(TransName, Desc),
       CollectionVisitor(NULL),
       RewriteVisitor(NULL),
-      TheRecordDecl(NULL)
+      TheRecordDecl(NULL),
+      AnalysisDone(false),
+      DoAllRecords(false)
   { }
 
   ~EmptyStructToInt(void);
@@ -55,6 +58,8 @@ private:
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
   void handleOneRecordDecl(const clang::RecordDecl *RD,
                            const clang::RecordDecl *BaseRD,
                            const clang::FieldDecl *FD,
@@ -96,6 +101,15 @@ private:
 
   const clang::RecordDecl *TheRecordDecl;
 
+  // census order of every record doAnalysis accepted; backs the
+  // whole-census instance appended after the per-record ones
+  std::vector<const clang::RecordDecl *> ValidRecordDecls;
+
+  bool AnalysisDone;
+
+  // true when the selected instance is the whole-census collapse
+  bool DoAllRecords;
+
   // Unimplemented
   EmptyStructToInt(void);
 
@@ -14,6 +14,7 @@
 
 #include "ExpressionDetector.h"
 
+#include "llvm/ADT/Hashing.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/FileEntry.h"
@@ -254,8 +255,9 @@ bool ExprDetectorCollectionVisitor::VisitFunctionDecl(FunctionDecl *FD)
   StmtVisitor.setCurrentFunctionDecl(FD);
   StmtVisitor.TraverseDecl(FD);
   StmtVisitor.setCurrentFunctionDecl(NULL);
-  ConsumerInstance->UniqueExprs.clear();
+  ConsumerInstance->UniqueExprHashes.clear();
   ConsumerInstance->ProcessedExprs.clear();
+  ConsumerInstance->ProcessedExprHashes.clear();
   return true;
 }
 
@@ -391,8 +393,10 @@ void ExpressionDetector::addOneTempVar(const VarDecl *VD)
   if (!VD->getName().starts_with(TmpVarNamePrefix))
 #endif
     return;
-  if (const Expr *E = VD->getInit())
+  if (const Expr *E = VD->getInit()) {
     ProcessedExprs[VD] = E->IgnoreParenImpCasts();
+    ProcessedExprHashes[VD] = getExprHash(E);
+  }
 }
 
 bool ExpressionDetector::refToTmpVar(const NamedDecl *ND)
@@ -510,10 +514,90 @@ bool ExpressionDetector::isIdenticalExpr(const Expr *E1, const Expr *E2)
   return true;
 }
 
+// Structural hash mirroring isIdenticalExpr: expressions that compare
+// identical hash equal, and the hashed dimensions (classes, opcodes,
+// names, literal values) are stable across invocations rather than
+// AST addresses, so the canonical form does not depend on where clang
+// happened to allocate a node.
+uint64_t ExpressionDetector::getExprHash(const Expr *E)
+{
+  E = E->IgnoreParenImpCasts();
+
+  // An expression with side-effects is identical to nothing, itself
+  // included; its address keeps the hash unique.
+  if (E->HasSideEffects(*Context))
+    return llvm::hash_combine(E);
+
+  llvm::hash_code H = llvm::hash_combine(E->getStmtClass());
+  for (const Stmt *Child : E->children()) {
+    const Expr *ChildE = dyn_cast_or_null<Expr>(Child);
+    H = llvm::hash_combine(H, ChildE ? getExprHash(ChildE) : 0);
+  }
+
+  switch (E->getStmtClass()) {
+  default:
+    // classes isIdenticalExpr rejects outright never match anything
+    return llvm::hash_combine(E);
+
+  case Stmt::ArraySubscriptExprClass:
+  case Stmt::CallExprClass: // Fall-through
+    break;
+
+  case Stmt::CStyleCastExprClass:
+    H = llvm::hash_combine(H,
+          cast<CStyleCastExpr>(E)->getTypeAsWritten().getAsString());
+    break;
+
+  case Stmt::MemberExprClass:
+    H = llvm::hash_combine(H,
+          cast<MemberExpr>(E)->getMemberDecl()->getNameAsString());
+    break;
+
+  case Stmt::DeclRefExprClass:
+    H = llvm::hash_combine(H,
+          cast<DeclRefExpr>(E)->getDecl()->getNameAsString());
+    break;
+
+  case Stmt::CompoundAssignOperatorClass:
+  case Stmt::BinaryOperatorClass: // Fall-through
+    H = llvm::hash_combine(H, cast<BinaryOperator>(E)->getOpcode());
+    break;
+
+  case Stmt::UnaryOperatorClass:
+    H = llvm::hash_combine(H, cast<UnaryOperator>(E)->getOpcode());
+    break;
+
+  case Stmt::CharacterLiteralClass:
+    H = llvm::hash_combine(H, cast<CharacterLiteral>(E)->getValue());
+    break;
+
+  case Stmt::StringLiteralClass:
+    H = llvm::hash_combine(H, cast<clang::StringLiteral>(E)->getBytes());
+    break;
+
+  case Stmt::IntegerLiteralClass:
+    H = llvm::hash_combine(H,
+          llvm::hash_value(cast<IntegerLiteral>(E)->getValue()));
+    break;
+
+  case Stmt::FloatingLiteralClass:
+    H = llvm::hash_combine(H, llvm::hash_value(
+          cast<FloatingLiteral>(E)->getValue().bitcastToAPInt()));
+    break;
+  }
+
+  return H;
+}
+
 bool ExpressionDetector::hasIdenticalExpr(
        const SmallVector<const VarDecl *, 4> &TmpVars, const Expr *E)
 {
+  uint64_t Hash = getExprHash(E);
   for (auto V : TmpVars) {
+    auto HI = ProcessedExprHashes.find(V);
+    if (HI == ProcessedExprHashes.end() || HI->second != Hash)
+      continue;
+    // the tree comparison only runs on a hash hit, to confirm it
     auto I = ProcessedExprs.find(V);
     if (I != ProcessedExprs.end() && isIdenticalExpr(I->second, E))
       return true;
@@ -633,14 +717,11 @@ bool ExpressionDetector::isValidExpr(Stmt *S, const Expr *E)
   // the given statement below:
   //   x = y[1] + y[1] + y[1];
   // we only need to print one y[1] before the assignment statement.
-  // This optimization is able to avoid a lots of dups.
-  auto &Vec = UniqueExprs[S];
-  for (auto I : Vec) {
-    if (isIdenticalExpr(I, E))
-      return false;
-  }
-  // update UniqueExprs
-  Vec.push_back(E);
+  // This optimization is able to avoid a lots of dups. The structural
+  // hash makes the rejection O(1) instead of a tree comparison against
+  // every expression seen in the statement so far.
+  if (!UniqueExprHashes[S].insert(getExprHash(E)).second)
+    return false;
 
   // The optimization above only works for single iteration. The code
   // below handles the following patterns:
@@ -720,14 +801,25 @@ void ExpressionDetector::doRewrite()
     TheRewriter.InsertText(Loc, HFInfo.FunctionDeclStr+";\n");
   }
 
-  std::string Str, ExprStr, TmpVarName;
-  RewriteHelper->getExprString(TheExpr, ExprStr);
+  std::string Str, TmpVarName;
+  // The expression text goes straight from the source buffer into Str;
+  // only a top-level comma operator needs protective parentheses here.
+  StringRef ExprStr;
+  RewriteHelper->getExprStringRef(TheExpr, ExprStr);
+  const BinaryOperator *BinOp = dyn_cast<BinaryOperator>(TheExpr);
+  bool NeedCommaParen = BinOp && (BinOp->getOpcode() == BO_Comma);
 
   std::string TyStr;
   TheExpr->getType().getAsStringInternal(TyStr, getPrintingPolicy());
   TmpVarName = TmpVarNamePrefix +
                std::to_string(TmpVarNameQueryWrap->getMaxNamePostfix()+1);
-  Str += TyStr + " " + TmpVarName + " = " + ExprStr + ";\n";
+  Str += TyStr + " " + TmpVarName + " = ";
+  if (NeedCommaParen)
+    Str += "(";
+  Str.append(ExprStr.data(), ExprStr.size());
+  if (NeedCommaParen)
+    Str += ")";
+  Str += ";\n";
 
   std::string ControlVarName = ControlVarNamePrefix +
     std::to_string(ControlVarNameQueryWrap->getMaxNamePostfix()+1);
@@ -11,9 +11,10 @@
 #ifndef EXPRESSION_DETECTOR_H
 #define EXPRESSION_DETECTOR_H
 
+#include <cstdint>
 #include <vector>
-#include <map>
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "clang/Basic/SourceLocation.h"
 #include "Transformation.h"
@@ -60,14 +61,13 @@ private:
     std::string FunctionDeclStr;
   };
 
-  typedef std::vector<const clang::Expr *> ExprVector;
+  typedef llvm::DenseMap<const clang::Stmt *, llvm::DenseSet<uint64_t> >
+            StmtToHashSetMap;
 
-  typedef std::map<const clang::Stmt *, ExprVector> StmtToExprMap;
-
-  typedef std::map<const clang::Stmt *,
+  typedef llvm::DenseMap<const clang::Stmt *,
             llvm::SmallPtrSet<const clang::Expr *, 10> > StmtToExprSetMap;
 
-  typedef std::map<const clang::Stmt *,
+  typedef llvm::DenseMap<const clang::Stmt *,
             llvm::SmallVector<const clang::VarDecl *, 4> > StmtToVarVecMap;
 
   typedef llvm::DenseMap<const clang::VarDecl *, const clang::Expr *>
@@ -91,14 +91,18 @@ private:
 
   bool isIdenticalExpr(const clang::Expr *E1, const clang::Expr *E2);
 
+  uint64_t getExprHash(const clang::Expr *E);
+
   bool hasIdenticalExpr(
          const llvm::SmallVector<const clang::VarDecl *, 4> &TmpVars,
          const clang::Expr *E);
 
-  StmtToExprMap UniqueExprs;
+  StmtToHashSetMap UniqueExprHashes;
 
   VarToExprMap ProcessedExprs;
 
+  llvm::DenseMap<const clang::VarDecl *, uint64_t> ProcessedExprHashes;
+
   StmtToExprSetMap InvalidExprsInUOBO;
 
   StmtToVarVecMap TmpVarsInStmt;
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2026 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "GlobalVarIndex.h"
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclGroup.h"
+
+using namespace clang;
+
+GlobalVarIndex *GlobalVarIndex::Instance;
+
+GlobalVarIndex *GlobalVarIndex::GetInstance()
+{
+  if (GlobalVarIndex::Instance)
+    return GlobalVarIndex::Instance;
+
+  GlobalVarIndex::Instance = new GlobalVarIndex();
+  assert(GlobalVarIndex::Instance);
+  return GlobalVarIndex::Instance;
+}
+
+void GlobalVarIndex::Finalize()
+{
+  delete GlobalVarIndex::Instance;
+  GlobalVarIndex::Instance = NULL;
+}
+
+void GlobalVarIndex::startSweep(const ASTContext *Ctx)
+{
+  // Keep an index for the same ASTContext whether sealed (a replay or
+  // the other pass reuses it) or mid-build (the census broadcasts one
+  // parse to several consumers, each of which calls in from Initialize).
+  if (BuiltFor == Ctx)
+    return;
+  BuiltFor = Ctx;
+  Building = true;
+  Groups.clear();
+}
+
+void GlobalVarIndex::recordGroup(ASTContext &Ctx, DeclGroupRef DGR)
+{
+  DeclGroupRef::iterator I = DGR.begin();
+  if (I == DGR.end())
+    return;
+
+  GroupEntry Entry;
+  Entry.OpaqueDGR = DGR.getAsOpaquePtr();
+  // When several recording consumers share one parse (the census
+  // broadcast), each is handed the same group in turn; the duplicate is
+  // always the immediately preceding record.
+  if (!Groups.empty() && Groups.back().OpaqueDGR == Entry.OpaqueDGR)
+    return;
+
+  Entry.FirstDecl = *I;
+  Entry.CanonicalType = NULL;
+  if (const VarDecl *VD = dyn_cast<VarDecl>(*I))
+    Entry.CanonicalType = Ctx.getCanonicalType(VD->getType().getTypePtr());
+  Groups.push_back(Entry);
+}
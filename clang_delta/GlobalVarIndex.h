@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2026 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef GLOBAL_VAR_INDEX_H
+#define GLOBAL_VAR_INDEX_H
+
+#include <vector>
+
+namespace clang {
+  class ASTContext;
+  class Decl;
+  class DeclGroupRef;
+  class Type;
+}
+
+// A per-parse ordered index of the top-level declaration groups.
+// move-global-var and combine-global-var both walk every top-level
+// group per invocation -- one to find the first function boundary, the
+// other to chain groups by canonical variable type -- and on C inputs
+// with tens of thousands of globals that walk plus the per-group type
+// canonicalization dominates their cost.  The index preserves what both
+// passes derive (source order, each group's lead declaration and the
+// canonical type of variable groups) so it is computed once per parse
+// and shared; the per-type chains themselves stay pass-side because the
+// two consumers filter groups differently before chaining them.
+//
+// Declaration groups only exist during the HandleTopLevelDecl callbacks
+// of a parse (or the manager's cached-AST replay of them), so unlike
+// the other shared indexes this one is fed from those callbacks: a pass
+// opens the sweep from Initialize, records each group it is handed, and
+// seals the index before consuming it in HandleTranslationUnit.  Later
+// sweeps against the same ASTContext -- the other pass, daemon and
+// fork-server children, the instance census -- find it sealed and skip
+// the per-group work entirely.
+class GlobalVarIndex {
+
+public:
+
+  struct GroupEntry {
+    // the group, as the opaque pointer DeclGroupRef round-trips through
+    void *OpaqueDGR;
+    // the group's lead declaration, for the consumers' own filters
+    const clang::Decl *FirstDecl;
+    // canonical type of a lead variable declaration, NULL otherwise
+    const clang::Type *CanonicalType;
+  };
+
+  static GlobalVarIndex *GetInstance();
+
+  static void Finalize();
+
+  // Open (or reuse) the sweep for Ctx: a sealed index for the same
+  // ASTContext is kept, anything else is discarded and rebuilt.
+  void startSweep(const clang::ASTContext *Ctx);
+
+  // True while the current sweep still has to record groups; recording
+  // passes use this to skip their HandleTopLevelDecl body once a sealed
+  // index exists.
+  bool isBuilding() const {
+    return Building;
+  }
+
+  void recordGroup(clang::ASTContext &Ctx, clang::DeclGroupRef DGR);
+
+  // Seal the index; consumers call this once the parse has delivered
+  // every top-level group.
+  void seal() {
+    Building = false;
+  }
+
+  unsigned getNumGroups() const {
+    return Groups.size();
+  }
+
+  const GroupEntry &getGroup(unsigned I) const {
+    return Groups[I];
+  }
+
+private:
+
+  GlobalVarIndex()
+    : BuiltFor(NULL),
+      Building(false)
+  { }
+
+  ~GlobalVarIndex() { }
+
+  static GlobalVarIndex *Instance;
+
+  const clang::ASTContext *BuiltFor;
+
+  bool Building;
+
+  std::vector<GroupEntry> Groups;
+
+  // Unimplemented
+  GlobalVarIndex(const GlobalVarIndex &);
+
+  void operator=(const GlobalVarIndex &);
+};
+
+#endif
@@ -122,14 +122,7 @@ public:
   bool VisitTemplateTypeParmTypeLoc(TemplateTypeParmTypeLoc Loc);
 
   bool VisitDeclRefExpr(DeclRefExpr* DRE) {
-    if (DRE->getDecl() == ConsumerInstance->TheTemplateSpec) {
-      auto Idx = ConsumerInstance->TheParameterIdx;
-      if (DRE->getNumTemplateArgs() > Idx) {
-        return ConsumerInstance->RewriteHelper->removeTemplateArgument(DRE, Idx);
-      }
-    }
-
-    return true;
+    return ConsumerInstance->removeSpecTemplateArgs(DRE);
   }
 
 private:
@@ -142,7 +135,9 @@ InstantiateTemplateParamRewriteVisitor::VisitTemplateTypeParmTypeLoc(
        TemplateTypeParmTypeLoc Loc)
 {
   const TemplateTypeParmDecl *D = Loc.getDecl();
-  if (D != ConsumerInstance->TheParameter)
+  const InstantiateTemplateParam::DeducedEntry *Entry =
+    ConsumerInstance->lookupActiveEntry(D);
+  if (!Entry)
     return true;
 
   // I know it's ugly, but seems sometimes Clang injects some extra
@@ -164,8 +159,7 @@ InstantiateTemplateParamRewriteVisitor::VisitTemplateTypeParmTypeLoc(
   ConsumerInstance->VisitedLocs.insert(Ptr);
 
   SourceRange Range = Loc.getSourceRange();
-  ConsumerInstance->TheRewriter.ReplaceText(Range, 
-                       ConsumerInstance->TheInstantiationString);
+  ConsumerInstance->TheRewriter.ReplaceText(Range, Entry->ArgStr);
   return true;
 }
 
@@ -191,6 +185,26 @@ void InstantiateTemplateParam::Initialize(ASTContext &context)
   ParamRewriteVisitor = new InstantiateTemplateParamRewriteVisitor(this);
 }
 
+void InstantiateTemplateParam::prepareSharedAnalysis(ASTContext &Ctx)
+{
+  if (TransformationManager::isCLangOpt() ||
+      TransformationManager::isOpenCLLangOpt())
+    return;
+  // Deducing an argument walks every instantiation and prints the
+  // argument type, per template parameter -- the dominant cost on
+  // template-heavy inputs, and the same for every counter.  Record the
+  // deducible entries once on the freshly parsed AST; in daemon mode
+  // the forked counters inherit the cache and replay it instead of
+  // re-deducing.  Clear first so a cancelled earlier attempt cannot
+  // leave duplicates behind.
+  DeducedEntries.clear();
+  AvailableRecordDecls.clear();
+  CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  if (Transformation::isCancelRequested())
+    return;
+  AnalysisDone = true;
+}
+
 void InstantiateTemplateParam::HandleTranslationUnit(ASTContext &Ctx)
 {
   if (TransformationManager::isCLangOpt() ||
@@ -198,7 +212,41 @@ void InstantiateTemplateParam::HandleTranslationUnit(ASTContext &Ctx)
     ValidInstanceNum = 0;
   }
   else {
-    CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    if (!AnalysisDone)
+      prepareSharedAnalysis(Ctx);
+    // per-parameter candidates replay the cache in collection order, so
+    // the counters are numbered exactly as the uncached walk did
+    for (DeducedEntryVector::iterator I = DeducedEntries.begin(),
+         E = DeducedEntries.end(); I != E; ++I) {
+      ValidInstanceNum++;
+      if (ValidInstanceNum == TransformationCounter) {
+        ActiveEntries.push_back(&(*I));
+        TheTemplateDecl = (*I).TmplD;
+        TheForwardDeclString = (*I).ForwardStr;
+      }
+    }
+    // combined candidates come after every per-parameter one, keeping
+    // the existing counters stable: each template with more than one
+    // deducible parameter gets one extra instance that instantiates
+    // all of them in a single rewrite
+    size_t GroupStart = 0;
+    for (size_t I = 0; I <= DeducedEntries.size(); ++I) {
+      if (I < DeducedEntries.size() &&
+          DeducedEntries[I].TmplD == DeducedEntries[GroupStart].TmplD)
+        continue;
+      if (I - GroupStart > 1) {
+        ValidInstanceNum++;
+        if (ValidInstanceNum == TransformationCounter) {
+          TheTemplateDecl = DeducedEntries[GroupStart].TmplD;
+          TheForwardDeclString = "";
+          for (size_t J = GroupStart; J < I; ++J) {
+            ActiveEntries.push_back(&DeducedEntries[J]);
+            TheForwardDeclString += DeducedEntries[J].ForwardStr;
+          }
+        }
+      }
+      GroupStart = I;
+    }
   }
 
   if (QueryInstanceOnly)
@@ -210,8 +258,7 @@ void InstantiateTemplateParam::HandleTranslationUnit(ASTContext &Ctx)
   }
 
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
-  TransAssert(TheParameter && "NULL TheParameter!");
-  TransAssert((TheInstantiationString != "") && "Invalid InstantiationString!");
+  TransAssert(!ActiveEntries.empty() && "No ActiveEntries!");
   TransAssert(ParamRewriteVisitor && "NULL ParamRewriteVisitor!");
   ParamRewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
   removeTemplateKeyword();
@@ -222,13 +269,71 @@ void InstantiateTemplateParam::HandleTranslationUnit(ASTContext &Ctx)
     TransError = TransInternalError;
 }
 
+const InstantiateTemplateParam::DeducedEntry *
+InstantiateTemplateParam::lookupActiveEntry(const NamedDecl *ND)
+{
+  for (llvm::SmallVector<const DeducedEntry *, 8>::iterator
+       I = ActiveEntries.begin(), E = ActiveEntries.end(); I != E; ++I) {
+    if ((*I)->ParamND == ND)
+      return (*I);
+  }
+  return NULL;
+}
+
+bool InstantiateTemplateParam::removeSpecTemplateArgs(DeclRefExpr *DRE)
+{
+  bool RV = true;
+  unsigned NumEntries = ActiveEntries.size();
+  unsigned I = 0;
+  while (I < NumEntries) {
+    const DeducedEntry *Entry = ActiveEntries[I];
+    if (DRE->getDecl() != Entry->Spec ||
+        Entry->ParamIdx >= DRE->getNumTemplateArgs()) {
+      ++I;
+      continue;
+    }
+    // neighbouring arguments share their separating comma, so a
+    // combined candidate must drop each run of adjacent ones in a
+    // single edit
+    unsigned FirstIdx = Entry->ParamIdx;
+    unsigned LastIdx = FirstIdx;
+    while (I + 1 < NumEntries &&
+           ActiveEntries[I + 1]->Spec == Entry->Spec &&
+           ActiveEntries[I + 1]->ParamIdx == LastIdx + 1 &&
+           LastIdx + 1 < DRE->getNumTemplateArgs()) {
+      ++I;
+      ++LastIdx;
+    }
+    RV = RewriteHelper->removeTemplateArgumentRange(DRE, FirstIdx, LastIdx)
+         && RV;
+    ++I;
+  }
+  return RV;
+}
+
 void InstantiateTemplateParam::removeTemplateKeyword()
 {
   if (isa<ClassTemplateDecl>(TheTemplateDecl))
     return;
   TemplateParameterList *TPList = TheTemplateDecl->getTemplateParameters();
-  if (TheParameterIdx < TPList->size())
-    RewriteHelper->removeTemplateParameter(TPList, TheParameterIdx);
+  unsigned NumEntries = ActiveEntries.size();
+  unsigned I = 0;
+  while (I < NumEntries) {
+    unsigned FirstIdx = ActiveEntries[I]->ParamIdx;
+    if (FirstIdx >= TPList->size()) {
+      ++I;
+      continue;
+    }
+    unsigned LastIdx = FirstIdx;
+    while (I + 1 < NumEntries &&
+           ActiveEntries[I + 1]->ParamIdx == LastIdx + 1 &&
+           LastIdx + 1 < TPList->size()) {
+      ++I;
+      ++LastIdx;
+    }
+    RewriteHelper->removeTemplateParameterRange(TPList, FirstIdx, LastIdx);
+    ++I;
+  }
 }
 
 void InstantiateTemplateParam::addForwardDecl()
@@ -378,15 +483,10 @@ void InstantiateTemplateParam::handleOneTemplateSpecialization(
     // in case the argument has the same name as the parameter
     if (ArgStr == ND->getNameAsString())
       continue;
-    ValidInstanceNum++;
-    if (ValidInstanceNum == TransformationCounter) {
-      TheInstantiationString = ArgStr;
-      TheParameter = ND;
-      TheParameterIdx = Idx;
-      TheTemplateSpec = Spec;
-      TheTemplateDecl = D;
-      TheForwardDeclString = ForwardStr;
-    }
+    // numbering happens in HandleTranslationUnit: the record outlives
+    // this walk, so repeated counters are answered without re-deducing
+    DeducedEntry Entry = { D, Spec, ND, Idx, ArgStr, ForwardStr };
+    DeducedEntries.push_back(Entry);
   }
 }
        
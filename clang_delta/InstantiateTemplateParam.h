@@ -12,6 +12,7 @@
 #define INSTANTIATE_TEMPLATE_PARAM_H
 
 #include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
 #include "Transformation.h"
 
 namespace clang {
@@ -26,6 +27,7 @@ namespace clang {
   class NamedDecl;
   class Type;
   class RecordDecl;
+  class DeclRefExpr;
 }
 
 class InstantiateTemplateParamASTVisitor;
@@ -42,9 +44,7 @@ public:
     : Transformation(TransName, Desc),
       CollectionVisitor(NULL),
       ParamRewriteVisitor(NULL),
-      TheParameter(NULL),
       TheTemplateDecl(NULL),
-      TheInstantiationString(""),
       TheForwardDeclString("")
   {}
 
@@ -56,8 +56,24 @@ private:
 
   typedef llvm::SmallPtrSet<void *, 10> LocPtrSet;
 
+  // one deducible (template, parameter) pair with the strings computed
+  // for it; the deduction walk records these once and every counter is
+  // answered from the record
+  struct DeducedEntry {
+    const clang::TemplateDecl *TmplD;
+    const clang::Decl *Spec;
+    const clang::NamedDecl *ParamND;
+    unsigned ParamIdx;
+    std::string ArgStr;
+    std::string ForwardStr;
+  };
+
+  typedef llvm::SmallVector<DeducedEntry, 16> DeducedEntryVector;
+
   virtual void Initialize(clang::ASTContext &context);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
   void handleOneFunctionTemplateDecl(const clang::FunctionTemplateDecl *D);
@@ -93,6 +109,10 @@ private:
 
   void addForwardDecl();
 
+  const DeducedEntry *lookupActiveEntry(const clang::NamedDecl *ND);
+
+  bool removeSpecTemplateArgs(clang::DeclRefExpr *DRE);
+
   RecordDeclSet AvailableRecordDecls;
 
   LocPtrSet VisitedLocs;
@@ -101,15 +121,15 @@ private:
 
   InstantiateTemplateParamRewriteVisitor *ParamRewriteVisitor;
 
-  const clang::NamedDecl *TheParameter;
-
-  unsigned TheParameterIdx = 0;
+  DeducedEntryVector DeducedEntries;
 
-  const clang::TemplateDecl *TheTemplateDecl;
+  // the entries the selected counter rewrites: one for a per-parameter
+  // candidate, a whole template's worth for a combined candidate
+  llvm::SmallVector<const DeducedEntry *, 8> ActiveEntries;
 
-  const clang::Decl* TheTemplateSpec = nullptr;
+  bool AnalysisDone = false;
 
-  std::string TheInstantiationString;
+  const clang::TemplateDecl *TheTemplateDecl;
 
   std::string TheForwardDeclString;
 
@@ -25,7 +25,10 @@ using namespace clang;
 static const char *DescriptionMsg =
 "Move the declaraion of a non-static local variable from \
 a function to the global scope. Also rename the moved local variable \
-to avoid possible name conflicts. \n";
+to avoid possible name conflicts. \
+After the per-variable instances, one batch instance is appended \
+for every function with more than one eligible local (hoisting all \
+of them), plus one hoisting the eligible locals of all functions. \n";
 
 static RegisterTransformation<LocalToGlobal>
          Trans("local-to-global", DescriptionMsg);
@@ -78,7 +81,7 @@ public:
   { }
 
   bool VisitDeclStmt(DeclStmt *DS);
- 
+
   bool VisitDeclRefExpr(DeclRefExpr *VarRefExpr);
 
 private:
@@ -88,6 +91,8 @@ private:
   bool makeLocalAsGlobalVar(FunctionDecl *FD, VarDecl *VD,
                             Decl *PrevDecl, bool StmtRemoved);
 
+  bool handleBatchDeclStmt(DeclStmt *DS);
+
 };
 
 bool LocalToGlobalFunctionVisitor::VisitFunctionDecl(FunctionDecl *FD)
@@ -110,12 +115,14 @@ bool LocalToGlobalCollectionVisitor::VisitVarDecl(VarDecl *VD)
     return true;
 
   ConsumerInstance->ValidInstanceNum++;
-  if (ConsumerInstance->ValidInstanceNum == 
+  if (ConsumerInstance->ValidInstanceNum ==
       ConsumerInstance->TransformationCounter) {
     ConsumerInstance->TheVarDecl = VD;
     ConsumerInstance->TheFuncDecl = CurrentFuncDecl;
     ConsumerInstance->setNewName(CurrentFuncDecl, VD);
   }
+  ConsumerInstance->AllCandidates.push_back(
+    LocalToGlobal::FuncVarPair(CurrentFuncDecl, VD));
   return true;
 }
 
@@ -143,6 +150,7 @@ void LocalToGlobal::HandleTranslationUnit(ASTContext &Ctx)
   }
   else {
     FunctionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    addBatchInstances();
   }
 
   if (QueryInstanceOnly)
@@ -177,6 +185,77 @@ void LocalToGlobal::setNewName(FunctionDecl *FD,
   TheNewDeclName = NewName;
 }
 
+// Batch instances are appended after the per-variable ones: one per
+// function with more than one eligible local, hoisting all of them in
+// a single candidate, then one hoisting every candidate in the TU.
+// Hoisting gates the later removal passes, so getting through it in a
+// few parses instead of one per variable pays for the occasional
+// failed batch.
+void LocalToGlobal::addBatchInstances(void)
+{
+  size_t NumGroups = 0;
+  size_t I = 0;
+  while (I < AllCandidates.size()) {
+    // one collection traversal's contributions are consecutive
+    FunctionDecl *FD = AllCandidates[I].first;
+    size_t E = I;
+    while (E < AllCandidates.size() && AllCandidates[E].first == FD)
+      E++;
+    NumGroups++;
+    if (E - I >= 2) {
+      ValidInstanceNum++;
+      if (ValidInstanceNum == TransformationCounter) {
+        for (size_t K = I; K < E; ++K)
+          addOneBatchVar(AllCandidates[K].first, AllCandidates[K].second);
+      }
+    }
+    I = E;
+  }
+
+  if (NumGroups >= 2) {
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter) {
+      for (I = 0; I < AllCandidates.size(); ++I)
+        addOneBatchVar(AllCandidates[I].first, AllCandidates[I].second);
+    }
+  }
+}
+
+void LocalToGlobal::addOneBatchVar(FunctionDecl *FD, VarDecl *VD)
+{
+  // locals of nested definitions can be collected twice
+  if (BatchFuncs.count(VD))
+    return;
+
+  std::string NewName = FD->getNameInfo().getAsString();
+  NewName += "_";
+  NewName += VD->getNameAsString();
+  // same-named locals from sibling scopes synthesize the same global
+  // name; disambiguate with a numeric suffix
+  std::string UniqueName = NewName;
+  unsigned Suffix = 1;
+  while (!UsedNewNames.insert(UniqueName).second) {
+    UniqueName = NewName + "_" + std::to_string(Suffix);
+    Suffix++;
+  }
+
+  BatchFuncs[VD] = FD;
+  BatchNames[VD] = UniqueName;
+  // the singleton members double as the non-NULL markers the rewrite
+  // stage asserts on
+  if (!TheVarDecl) {
+    TheVarDecl = VD;
+    TheFuncDecl = FD;
+    TheNewDeclName = UniqueName;
+  }
+}
+
+void LocalToGlobal::dropBatchVar(const VarDecl *VD)
+{
+  BatchFuncs.erase(VD);
+  BatchNames.erase(VD);
+}
+
 LocalToGlobal::~LocalToGlobal(void)
 {
   delete FunctionVisitor;
@@ -226,8 +305,58 @@ bool LToGASTVisitor::makeLocalAsGlobalVar(FunctionDecl *FD, VarDecl *VD,
            insertStringBeforeFunc(FD, GlobalVarStr);
 }
 
+// Batch rewriting.  A decl-stmt is hoisted one variable at a time and
+// removeVarFromDeclStmt edits overlap, so only the first selected
+// variable of a stmt is hoisted here; the others are dropped from the
+// batch (their references stay untouched) and remain reachable through
+// their per-variable instances.  Decl-stmts precede their references in
+// traversal order, so dropping a variable here is always in time.
+bool LToGASTVisitor::handleBatchDeclStmt(DeclStmt *DS)
+{
+  Decl *PrevDecl = NULL;
+  VarDecl *VD = NULL;
+  int NumDecls = 0;
+  int VarPos = 0;
+
+  for (DeclStmt::const_decl_iterator I = DS->decl_begin(),
+       E = DS->decl_end(); I != E; ++I) {
+    NumDecls++;
+
+    Decl *CurrDecl = (*I);
+    VarDecl *CandVD = dyn_cast<VarDecl>(CurrDecl);
+    if (VD) {
+      if (CandVD && ConsumerInstance->BatchFuncs.count(CandVD))
+        ConsumerInstance->dropBatchVar(CandVD);
+      continue;
+    }
+    if (!CandVD || !ConsumerInstance->BatchFuncs.count(CandVD)) {
+      PrevDecl = CurrDecl;
+      continue;
+    }
+    VD = CandVD;
+    VarPos = NumDecls - 1;
+  }
+
+  if (!VD)
+    return true;
+
+  // makeLocalAsGlobalVar reads the name through getNewName
+  ConsumerInstance->TheNewDeclName = ConsumerInstance->BatchNames[VD];
+
+  bool IsFirstDecl = (!VarPos);
+  bool StmtRemoved = false;
+  ConsumerInstance->RewriteHelper->removeVarFromDeclStmt
+    (DS, VD, PrevDecl, IsFirstDecl, &StmtRemoved);
+
+  return makeLocalAsGlobalVar(ConsumerInstance->BatchFuncs[VD], VD,
+                              PrevDecl, StmtRemoved);
+}
+
 bool LToGASTVisitor::VisitDeclStmt(DeclStmt *DS)
 {
+  if (!ConsumerInstance->BatchFuncs.empty())
+    return handleBatchDeclStmt(DS);
+
   Decl *PrevDecl = NULL;
   VarDecl *VD = NULL;
   int NumDecls = 0;
@@ -272,8 +401,22 @@ bool LToGASTVisitor::VisitDeclRefExpr(DeclRefExpr *VarRefExpr)
 
   const ValueDecl *OrigDecl = VarRefExpr->getDecl();
 
-  if (OrigDecl != ConsumerInstance->TheVarDecl)
-    return true;
+  std::string NewName;
+  if (!ConsumerInstance->BatchNames.empty()) {
+    const VarDecl *VD = dyn_cast<VarDecl>(OrigDecl);
+    if (!VD)
+      return true;
+    llvm::DenseMap<const VarDecl *, std::string>::iterator NI =
+      ConsumerInstance->BatchNames.find(VD);
+    if (NI == ConsumerInstance->BatchNames.end())
+      return true;
+    NewName = (*NI).second;
+  }
+  else {
+    if (OrigDecl != ConsumerInstance->TheVarDecl)
+      return true;
+    NewName = ConsumerInstance->TheNewDeclName;
+  }
 
   SourceRange ExprRange = VarRefExpr->getSourceRange();
   SourceLocation StartLoc = ExprRange.getBegin();
@@ -285,6 +428,6 @@ bool LToGASTVisitor::VisitDeclRefExpr(DeclRefExpr *VarRefExpr)
 
   return
     !(ConsumerInstance->TheRewriter.ReplaceText(
-        SourceRange(StartLoc, EndLoc), ConsumerInstance->TheNewDeclName));
+        SourceRange(StartLoc, EndLoc), NewName));
 }
 
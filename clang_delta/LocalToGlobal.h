@@ -12,7 +12,11 @@
 #define LOCAL_TO_GLOBAL_H
 
 #include <string>
+#include <utility>
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringSet.h"
 #include "Transformation.h"
 
 namespace clang {
@@ -52,14 +56,34 @@ private:
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  typedef std::pair<clang::FunctionDecl *, clang::VarDecl *> FuncVarPair;
+
   void setNewName(clang::FunctionDecl *FD, const clang::VarDecl *VD);
 
   std::string getNewName(void) {
     return TheNewDeclName;
   }
 
+  void addBatchInstances(void);
+
+  void addOneBatchVar(clang::FunctionDecl *FD, clang::VarDecl *VD);
+
+  void dropBatchVar(const clang::VarDecl *VD);
+
   llvm::SmallPtrSet<const clang::VarDecl *, 10> SkippedVars;
 
+  // every eligible (function, local) pair in visit order; the appended
+  // batch instances hoist whole groups of them at once
+  llvm::SmallVector<FuncVarPair, 32> AllCandidates;
+
+  // batch selection: variable -> owning function / synthesized name;
+  // empty when a per-variable instance was selected
+  llvm::DenseMap<const clang::VarDecl *, clang::FunctionDecl *> BatchFuncs;
+
+  llvm::DenseMap<const clang::VarDecl *, std::string> BatchNames;
+
+  llvm::StringSet<> UsedNewNames;
+
   LocalToGlobalFunctionVisitor *FunctionVisitor;
 
   LocalToGlobalCollectionVisitor *LocalVarCollectionVisitor;
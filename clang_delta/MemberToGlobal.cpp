@@ -14,6 +14,8 @@
 
 #include "MemberToGlobal.h"
 
+#include <algorithm>
+
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 #include "clang/Lex/Lexer.h"
@@ -24,7 +26,10 @@ using namespace clang;
 
 static const char* DescriptionMsg =
 "Move declarations within a record (class or struct) in front of the record. \
-The pass supports functions, variables, typedefs and nested records. \n";
+The pass supports functions, variables, typedefs and nested records. \
+After the per-member instances, one batch instance is appended for \
+every record with more than one movable member (hoisting all of them), \
+plus one hoisting the movable members of all records. \n";
 
 static RegisterTransformation<MemberToGlobal>
          Trans("member-to-global", DescriptionMsg);
@@ -128,33 +133,47 @@ static bool replace(std::string& str, const std::string& from, const std::string
   return true;
 }
 
-void MemberToGlobal::HandleTranslationUnit(ASTContext &Ctx)
+// Batch instances are appended after the per-member ones: one per
+// record with more than one movable member, then one covering every
+// record.  Hoisting mostly exists to enable the later removal passes,
+// so one parse for a whole record beats one parse per member.
+void MemberToGlobal::addBatchInstances()
 {
-  CollectionVisitor(this).TraverseDecl(Ctx.getTranslationUnitDecl());
-
-  ValidInstanceNum = ValidDecls.size();
-
-  if (QueryInstanceOnly)
-    return;
-
-  if (TransformationCounter > ValidInstanceNum) {
-    TransError = TransMaxInstanceError;
-    return;
+  std::vector<RecordDecl*> Records;
+  for (auto& P : ValidDecls)
+    if (std::find(Records.begin(), Records.end(), P.first) == Records.end())
+      Records.push_back(P.first);
+
+  for (auto* RD : Records) {
+    std::vector<std::pair<RecordDecl*, Decl*>> Members;
+    for (auto& P : ValidDecls)
+      if (P.first == RD)
+        Members.push_back(P);
+    if (Members.size() < 2)
+      continue;
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter)
+      TheBatch = Members;
   }
 
-  TheDecl = ValidDecls[TransformationCounter - 1].second;
-  TheRecordDecl = ValidDecls[TransformationCounter - 1].first;
-  Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
+  if (Records.size() >= 2) {
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter)
+      TheBatch = ValidDecls;
+  }
+}
 
-  auto RecordBegin = TheRecordDecl->getSourceRange().getBegin();
-  auto BeginLoc = TheDecl->getSourceRange().getBegin();
-  auto EndLoc = TheDecl->getSourceRange().getEnd();
+void MemberToGlobal::hoistOneDecl(RecordDecl* RD, Decl* D)
+{
+  auto RecordBegin = RD->getSourceRange().getBegin();
+  auto BeginLoc = D->getSourceRange().getBegin();
+  auto EndLoc = D->getSourceRange().getEnd();
   auto EndLoc2 = Lexer::getLocForEndOfToken(EndLoc, 0, *this->SrcManager, this->Context->getLangOpts());
   if (GetText(SourceRange(EndLoc2, EndLoc2)).str() == ";")
       EndLoc = EndLoc2;
 
   std::string Text = GetText(SourceRange(BeginLoc, EndLoc)).str();
-  if (auto* VD = dyn_cast<VarDecl>(TheDecl)) {
+  if (auto* VD = dyn_cast<VarDecl>(D)) {
     if (VD->isStaticDataMember()) {
       replace(Text, "static", "extern");
     }
@@ -163,11 +182,42 @@ void MemberToGlobal::HandleTranslationUnit(ASTContext &Ctx)
   TheRewriter.InsertTextBefore(RecordBegin, Text + "\n");
   TheRewriter.RemoveText(SourceRange(BeginLoc, EndLoc));
 
-  for (auto* Redecl : TheDecl->redecls()) {
+  for (auto* Redecl : D->redecls()) {
     if (auto* DD = dyn_cast<DeclaratorDecl>(Redecl)) {
       removeRecordQualifier(DD->getQualifierLoc());
     }
   }
+}
+
+void MemberToGlobal::HandleTranslationUnit(ASTContext &Ctx)
+{
+  CollectionVisitor(this).TraverseDecl(Ctx.getTranslationUnitDecl());
+
+  ValidInstanceNum = ValidDecls.size();
+  addBatchInstances();
+
+  if (QueryInstanceOnly)
+    return;
+
+  if (TransformationCounter > ValidInstanceNum) {
+    TransError = TransMaxInstanceError;
+    return;
+  }
+
+  Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
+
+  if (TheBatch.empty()) {
+    TheDecl = ValidDecls[TransformationCounter - 1].second;
+    TheRecordDecl = ValidDecls[TransformationCounter - 1].first;
+    hoistOneDecl(TheRecordDecl, TheDecl);
+  }
+  else {
+    // Insertions before a record's begin location stack up in reverse,
+    // so walk the batch backwards to keep the members' original order
+    // (a later member may use an earlier nested type).
+    for (auto I = TheBatch.rbegin(), E = TheBatch.rend(); I != E; ++I)
+      hoistOneDecl(I->first, I->second);
+  }
 
   RewriteVisitor(this).TraverseDecl(Ctx.getTranslationUnitDecl());
 
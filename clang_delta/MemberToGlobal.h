@@ -50,17 +50,36 @@ private:
 
   void removeRecordQualifier(const clang::NestedNameSpecifierLoc& NNSLoc);
 
+  void addBatchInstances();
+
+  void hoistOneDecl(clang::RecordDecl* RD, clang::Decl* D);
+
   bool isTheDecl(clang::Decl *D) {
-    return TheDecl->getCanonicalDecl() == D->getCanonicalDecl();
+    if (TheDecl && TheDecl->getCanonicalDecl() == D->getCanonicalDecl())
+      return true;
+    for (auto& P : TheBatch)
+      if (P.second->getCanonicalDecl() == D->getCanonicalDecl())
+        return true;
+    return false;
   }
 
   bool isTheRecordDecl(clang::Decl *D) {
-    return TheRecordDecl->getCanonicalDecl() == D->getCanonicalDecl();
+    if (TheRecordDecl &&
+        TheRecordDecl->getCanonicalDecl() == D->getCanonicalDecl())
+      return true;
+    for (auto& P : TheBatch)
+      if (P.first->getCanonicalDecl() == D->getCanonicalDecl())
+        return true;
+    return false;
   }
 
   std::vector<std::pair<clang::RecordDecl*, clang::Decl*>> ValidDecls;
 
   clang::Decl *TheDecl = nullptr;
   clang::RecordDecl *TheRecordDecl = nullptr;
+
+  // the members a selected batch instance hoists; empty when a
+  // per-member instance was selected
+  std::vector<std::pair<clang::RecordDecl*, clang::Decl*>> TheBatch;
 };
 #endif
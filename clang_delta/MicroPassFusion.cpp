@@ -0,0 +1,264 @@
+//===----------------------------------------------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "MicroPassFusion.h"
+
+#include <cstring>
+
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/Lex/Lexer.h"
+#include "clang/Basic/SourceManager.h"
+
+#include "TransformationManager.h"
+
+using namespace clang;
+
+static const char *DescriptionMsg =
+"Fuse the cheap late-stage rewrites into one parse: remove every \
+removable ctor initializer list, every enum member value, every unused \
+enum member and replace every class keyword with struct.  One instance \
+is emitted per category that has candidates, applying the whole \
+category at once, plus one final instance applying all categories \
+together.  Each of the individual passes costs a full parse for a \
+rewrite that touches a few bytes; fusing them amortizes the parse. \n";
+
+static RegisterTransformation<MicroPassFusion>
+         Trans("micro-pass-fusion", DescriptionMsg);
+
+class MicroPassFusion::CollectionVisitor : public
+  RecursiveASTVisitor<CollectionVisitor> {
+
+public:
+  explicit CollectionVisitor(MicroPassFusion *Instance)
+    : ConsumerInstance(Instance)
+  { }
+
+  bool VisitCXXConstructorDecl(CXXConstructorDecl *Ctor) {
+    if (ConsumerInstance->isInIncludedFile(Ctor))
+      return true;
+    if (ConsumerInstance->isFullyRemovableCtor(Ctor))
+      ConsumerInstance->Ctors.push_back(Ctor);
+    return true;
+  }
+
+  bool VisitEnumDecl(EnumDecl *ED) {
+    if (ConsumerInstance->isInIncludedFile(ED) ||
+        ED != ED->getCanonicalDecl())
+      return true;
+    for (EnumDecl::enumerator_iterator I = ED->enumerator_begin(),
+         E = ED->enumerator_end(); I != E; ++I) {
+      if (!(*I)->isReferenced())
+        ConsumerInstance->UnusedMembers.push_back(*I);
+      else if ((*I)->getInitExpr())
+        ConsumerInstance->ValuedMembers.push_back(*I);
+    }
+    return true;
+  }
+
+  bool VisitCXXRecordDecl(CXXRecordDecl *CXXRD) {
+    CXXRecordDecl *Def = CXXRD->getDefinition();
+    if (!Def || !Def->isClass())
+      return true;
+    if (ConsumerInstance->SeenClassDefs.insert(Def).second)
+      ConsumerInstance->ClassDefs.push_back(Def);
+    return true;
+  }
+
+private:
+  MicroPassFusion *ConsumerInstance;
+};
+
+void MicroPassFusion::HandleTranslationUnit(ASTContext &Ctx)
+{
+  CollectionVisitor(this).TraverseDecl(Ctx.getTranslationUnitDecl());
+
+  // a member can land in both enum categories; whole-member removal
+  // subsumes value removal, so the unused list keeps it
+  const size_t CategorySizes[NumCategories] = {
+    Ctors.size(), ValuedMembers.size(), UnusedMembers.size(),
+    ClassDefs.size()
+  };
+
+  unsigned NonEmptyMask = 0;
+  unsigned NumNonEmpty = 0;
+  for (unsigned Cat = 0; Cat < NumCategories; ++Cat) {
+    if (!CategorySizes[Cat])
+      continue;
+    NonEmptyMask |= (1u << Cat);
+    NumNonEmpty++;
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter)
+      SelectedMask = (1u << Cat);
+  }
+  // the combined candidate only earns an instance when it differs from
+  // every per-category one
+  if (NumNonEmpty >= 2) {
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter)
+      SelectedMask = NonEmptyMask;
+  }
+
+  if (QueryInstanceOnly)
+    return;
+
+  if (TransformationCounter > ValidInstanceNum) {
+    TransError = TransMaxInstanceError;
+    return;
+  }
+
+  Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
+
+  if (SelectedMask & (1u << CatCtorInitializers))
+    for (auto *Ctor : Ctors)
+      removeCtorInitializers(Ctor);
+  if (SelectedMask & (1u << CatEnumMemberValues))
+    for (auto *ECD : ValuedMembers)
+      removeEnumMemberValue(ECD);
+  if (SelectedMask & (1u << CatUnusedEnumMembers))
+    for (auto *ECD : UnusedMembers)
+      removeEnumMember(ECD);
+  if (SelectedMask & (1u << CatClassToStruct))
+    for (auto *Def : ClassDefs)
+      replaceClassWithStruct(Def);
+
+  if (Ctx.getDiagnostics().hasErrorOccurred() ||
+      Ctx.getDiagnostics().hasFatalErrorOccurred())
+    TransError = TransInternalError;
+}
+
+// same validity rule as remove-ctor-initializer
+bool MicroPassFusion::isValidInitType(const Type *Ty)
+{
+  if (Ty->isReferenceType())
+    return false;
+
+  if (const RecordType *RTy = Ty->getAs<RecordType>()) {
+    const CXXRecordDecl *CXXRD = dyn_cast<CXXRecordDecl>(RTy->getDecl());
+    if (!CXXRD)
+      return true;
+    return !CXXRD->needsImplicitDefaultConstructor();
+  }
+  return true;
+}
+
+// The fused candidate drops a ctor's initializer list as one text range
+// (colon through the last written initializer), so there is no per-slot
+// comma bookkeeping; that only works when every written initializer is
+// individually removable.
+bool MicroPassFusion::isFullyRemovableCtor(const CXXConstructorDecl *Ctor)
+{
+  unsigned NumWritten = 0;
+  for (CXXConstructorDecl::init_const_iterator I = Ctor->init_begin(),
+       E = Ctor->init_end(); I != E; ++I) {
+    const CXXCtorInitializer *Init = (*I);
+    if (!Init->isWritten())
+      continue;
+
+    if (Init->isInClassMemberInitializer() ||
+        Init->isPackExpansion() ||
+        Init->isDelegatingInitializer())
+      return false;
+
+    if (const FieldDecl *Field = Init->getAnyMember()) {
+      if (!isValidInitType(Field->getType().getTypePtr()))
+        return false;
+    }
+    else if (const Type *Ty = Init->getBaseClass()) {
+      const CXXRecordDecl *Base = getBaseDeclFromType(Ty);
+      if (Base && Base->hasDefinition() &&
+          Base->needsImplicitDefaultConstructor())
+        return false;
+    }
+
+    SourceRange Range = Init->getSourceRange();
+    if (Range.getBegin().isMacroID() || Range.getEnd().isMacroID())
+      return false;
+    NumWritten++;
+  }
+  return NumWritten > 0;
+}
+
+static int getOffset(const char *Buf, char Symbol)
+{
+  int Offset = 0;
+  while (*Buf != Symbol) {
+    Buf--;
+    if (*Buf == '\0')
+      break;
+    Offset--;
+  }
+  return Offset;
+}
+
+void MicroPassFusion::removeCtorInitializers(const CXXConstructorDecl *Ctor)
+{
+  // the stored order is initialization order, so locate the written
+  // extremes by source position
+  SourceLocation BeginLoc, EndLoc;
+  for (CXXConstructorDecl::init_const_iterator I = Ctor->init_begin(),
+       E = Ctor->init_end(); I != E; ++I) {
+    if (!(*I)->isWritten())
+      continue;
+    SourceRange Range = (*I)->getSourceRange();
+    if (BeginLoc.isInvalid() ||
+        SrcManager->isBeforeInTranslationUnit(Range.getBegin(), BeginLoc))
+      BeginLoc = Range.getBegin();
+    if (EndLoc.isInvalid() ||
+        SrcManager->isBeforeInTranslationUnit(EndLoc, Range.getEnd()))
+      EndLoc = Range.getEnd();
+  }
+  TransAssert(BeginLoc.isValid() && "No written initializer!");
+
+  const char *Buf = SrcManager->getCharacterData(BeginLoc);
+  BeginLoc = BeginLoc.getLocWithOffset(getOffset(Buf, ':'));
+  TheRewriter.RemoveText(SourceRange(BeginLoc, EndLoc));
+}
+
+// lifted from remove-enum-member-value
+void MicroPassFusion::removeEnumMemberValue(const EnumConstantDecl *ECD)
+{
+  SourceRange Range = ECD->getInitExpr()->getSourceRange();
+  SourceLocation StartLoc = Range.getBegin();
+  if (StartLoc.isMacroID()) {
+    Range = SrcManager->getExpansionRange(StartLoc).getAsRange();
+    StartLoc = SrcManager->getExpansionLoc(StartLoc);
+  }
+  const char *Buf = SrcManager->getCharacterData(StartLoc);
+  Range.setBegin(StartLoc.getLocWithOffset(getOffset(Buf, '=')));
+  TheRewriter.RemoveText(Range);
+}
+
+// lifted from remove-unused-enum-member
+void MicroPassFusion::removeEnumMember(const EnumConstantDecl *ECD)
+{
+  SourceLocation StartLoc = ECD->getBeginLoc();
+  if (StartLoc.isMacroID())
+    StartLoc = SrcManager->getExpansionRange(StartLoc).getBegin();
+  SourceLocation EndLoc = ECD->getEndLoc();
+  if (EndLoc.isMacroID())
+    EndLoc = SrcManager->getExpansionRange(EndLoc).getEnd();
+  SourceLocation CommaLoc = Lexer::findLocationAfterToken(
+    EndLoc, tok::comma, *SrcManager, Context->getLangOpts(),
+    /*SkipTrailingWhitespaceAndNewLine=*/false);
+  if (CommaLoc.isValid())
+    EndLoc = CommaLoc;
+  TheRewriter.RemoveText(SourceRange(StartLoc, EndLoc));
+}
+
+// lifted from class-to-struct
+void MicroPassFusion::replaceClassWithStruct(const CXXRecordDecl *Def)
+{
+  SourceLocation LocStart = Def->getBeginLoc();
+  SourceLocation LocEnd = LocStart.getLocWithOffset(strlen("class"));
+  TransAssert(LocEnd.isValid() && "Invalid Location!");
+  TheRewriter.ReplaceText(SourceRange(LocStart, LocEnd), "struct");
+}
@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef MICRO_PASS_FUSION_H
+#define MICRO_PASS_FUSION_H
+
+#include <vector>
+#include "llvm/ADT/SmallPtrSet.h"
+#include "Transformation.h"
+
+namespace clang {
+  class ASTContext;
+  class CXXConstructorDecl;
+  class CXXRecordDecl;
+  class EnumConstantDecl;
+  class Type;
+}
+
+class MicroPassFusion : public Transformation {
+
+  class CollectionVisitor;
+  friend class CollectionVisitor;
+
+public:
+
+  MicroPassFusion(const char *TransName, const char *Desc)
+    : Transformation(TransName, Desc)
+  { }
+
+private:
+
+  virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
+
+  bool isValidInitType(const clang::Type *Ty);
+
+  bool isFullyRemovableCtor(const clang::CXXConstructorDecl *Ctor);
+
+  void removeCtorInitializers(const clang::CXXConstructorDecl *Ctor);
+
+  void removeEnumMemberValue(const clang::EnumConstantDecl *ECD);
+
+  void removeEnumMember(const clang::EnumConstantDecl *ECD);
+
+  void replaceClassWithStruct(const clang::CXXRecordDecl *Def);
+
+  // the fused categories, in instance order
+  enum FusedCategory {
+    CatCtorInitializers = 0,
+    CatEnumMemberValues,
+    CatUnusedEnumMembers,
+    CatClassToStruct,
+    NumCategories
+  };
+
+  // collected candidates, one list per category
+  std::vector<const clang::CXXConstructorDecl *> Ctors;
+  std::vector<const clang::EnumConstantDecl *> ValuedMembers;
+  std::vector<const clang::EnumConstantDecl *> UnusedMembers;
+  std::vector<const clang::CXXRecordDecl *> ClassDefs;
+
+  llvm::SmallPtrSet<const clang::CXXRecordDecl *, 16> SeenClassDefs;
+
+  // bit i set = category i is rewritten by the selected instance
+  unsigned SelectedMask = 0;
+};
+#endif
@@ -78,9 +78,18 @@ public:
 private:
 };
 
-void MoveDefinitionToDeclaration::HandleTranslationUnit(ASTContext &Ctx)
+void MoveDefinitionToDeclaration::prepareSharedAnalysis(ASTContext &Ctx)
 {
   CollectionVisitor(this).TraverseDecl(Ctx.getTranslationUnitDecl());
+  AnalysisDone = true;
+}
+
+void MoveDefinitionToDeclaration::HandleTranslationUnit(ASTContext &Ctx)
+{
+  // The candidate list depends only on the parse, never on the counter,
+  // so a daemon or fork-server serves every probe from one traversal.
+  if (!AnalysisDone)
+    prepareSharedAnalysis(Ctx);
 
   ValidInstanceNum = DefCandidates.size();
 
@@ -27,6 +27,13 @@ public:
 
   ~MoveDefinitionToDeclaration(void);
 
+  // Candidate discovery reads the rewritten text between every
+  // definition and its declaration, which dominates probe setup on the
+  // small-file/huge-probe-count workloads this late pass sees; the
+  // manager runs it once per parse in daemon and fork-server modes and
+  // every counter then replays the cached candidate list.
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
 private:
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
@@ -35,6 +42,8 @@ private:
 
   std::vector<clang::Decl*> DefCandidates;
 
+  bool AnalysisDone = false;
+
   clang::Decl* TheDecl = nullptr;
 
   clang::Decl* TheDef = nullptr;
@@ -18,6 +18,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "GlobalVarIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -30,9 +31,10 @@ the reduce code if it exists and is not at the top of the code.\n";
 static RegisterTransformation<MoveGlobalVar>
          Trans("move-global-var", DescriptionMsg);
 
-void MoveGlobalVar::Initialize(ASTContext &context) 
+void MoveGlobalVar::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
+  GlobalVarIndex::GetInstance()->startSweep(&context);
 }
 
 bool MoveGlobalVar::isSpecialDecl(const std::string &Name)
@@ -41,38 +43,54 @@ bool MoveGlobalVar::isSpecialDecl(const std::string &Name)
           (Name == "__builtin_va_list"));
 }
 
-bool MoveGlobalVar::HandleTopLevelDecl(DeclGroupRef D) 
+bool MoveGlobalVar::HandleTopLevelDecl(DeclGroupRef D)
+{
+  GlobalVarIndex *Index = GlobalVarIndex::GetInstance();
+  if (Index->isBuilding())
+    Index->recordGroup(*Context, D);
+  return true;
+}
+
+// The per-group derivation previously ran in HandleTopLevelDecl; it now
+// consumes the shared index so the sweep over the declaration groups is
+// paid once per parse instead of once per invocation.
+void MoveGlobalVar::collectInstancesFromIndex(void)
 {
   if (TransformationManager::isCXXLangOpt()) {
     ValidInstanceNum = 0;
-    return true;
+    return;
   }
 
-  DeclGroupRef::iterator I = D.begin();
-  TransAssert((I != D.end()) && "Bad DeclGroupRef!");
+  GlobalVarIndex *Index = GlobalVarIndex::GetInstance();
+  for (unsigned I = 0; I < Index->getNumGroups(); ++I) {
+    const GlobalVarIndex::GroupEntry &Entry = Index->getGroup(I);
+    const Decl *D = Entry.FirstDecl;
 
-  if (isInIncludedFile(*I))
-    return true;
+    if (isInIncludedFile(D))
+      continue;
 
-  const NamedDecl *ND = dyn_cast<NamedDecl>(*I);
-  if (!TheFirstDecl && ND && isSpecialDecl(ND->getNameAsString()))
-    return true;
+    const NamedDecl *ND = dyn_cast<NamedDecl>(D);
+    if (!TheFirstDecl && ND && isSpecialDecl(ND->getNameAsString()))
+      continue;
 
-  FunctionDecl *FD = dyn_cast<FunctionDecl>(*I);
-  if (FD) {
-    handleFunctionDecl(FD); 
-  }
-  else {
-    handleOtherDecl(D);
-  }
+    const FunctionDecl *FD = dyn_cast<FunctionDecl>(D);
+    if (FD) {
+      handleFunctionDecl(FD);
+    }
+    else {
+      handleOtherDecl(DeclGroupRef::getFromOpaquePtr(Entry.OpaqueDGR));
+    }
 
-  if (!TheFirstDecl)
-    TheFirstDecl = (*I);
-  return true;
+    if (!TheFirstDecl)
+      TheFirstDecl = D;
+  }
 }
 
 void MoveGlobalVar::HandleTranslationUnit(ASTContext &Ctx)
 {
+  GlobalVarIndex::GetInstance()->seal();
+  collectInstancesFromIndex();
+
   if (QueryInstanceOnly)
     return;
 
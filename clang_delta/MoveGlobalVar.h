@@ -45,6 +45,9 @@ private:
 
   bool isSpecialDecl(const std::string &Name);
 
+  // Derive the instances from the shared global-ordering index.
+  void collectInstancesFromIndex(void);
+
   void handleFunctionDecl(const clang::FunctionDecl *FD);
 
   void handleOtherDecl(clang::DeclGroupRef DGR);
@@ -26,7 +26,10 @@ static const char *DescriptionMsg =
 to the global scope. Also rename the lifted parameter \
 to avoid possible name conflicts. Note that for C++ code, \
 this pass actually lifts a parameter from a member function \
-to the class scope rather than the global scope.  \n";
+to the class scope rather than the global scope. If more than \
+one function has a liftable parameter, one extra counter (the \
+last one) lifts one parameter of every such function in a \
+single run.\n";
 
 static RegisterTransformation<ParamToGlobal>
          Trans("param-to-global", DescriptionMsg);
@@ -108,6 +111,7 @@ void ParamToGlobal::HandleTranslationUnit(ASTContext &Ctx)
   }
   else {
     CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    addBatchCandidate();
   }
 
   if (QueryInstanceOnly)
@@ -119,12 +123,19 @@ void ParamToGlobal::HandleTranslationUnit(ASTContext &Ctx)
   }
 
   TransAssert(RewriteVisitor && "NULL RewriteVisitor!");
-  TransAssert(TheFuncDecl && "NULL TheFuncDecl!");
-  TransAssert((TheParamPos >= 0) && "Invalid parameter position!");
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
 
-  RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
-  RewriteVisitor->rewriteAllExprs();
+  if (TransformationCounter > NumSingleInstances) {
+    RewriteVisitor->rewritePlannedTargets(Ctx.getTranslationUnitDecl(),
+                                          BatchTargets);
+  }
+  else {
+    TransAssert(TheFuncDecl && "NULL TheFuncDecl!");
+    TransAssert((TheParamPos >= 0) && "Invalid parameter position!");
+
+    RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    RewriteVisitor->rewriteAllExprs();
+  }
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
@@ -204,12 +215,24 @@ bool ParamToGlobal::isValidFuncDecl(FunctionDecl *FD)
       TheParamPos = ParamPos;
     }
 
+    // one parameter per function for the batch candidate, as in
+    // param-to-local
+    if (!IsValid)
+      BatchTargets.push_back(std::make_pair(FD, ParamPos));
+
     IsValid = true;
     ParamPos++;
   }
   return IsValid;
 }
 
+void ParamToGlobal::addBatchCandidate(void)
+{
+  NumSingleInstances = ValidInstanceNum;
+  if (BatchTargets.size() > 1)
+    ValidInstanceNum++;
+}
+
 ParamToGlobal::~ParamToGlobal(void)
 {
   delete CollectionVisitor;
@@ -43,7 +43,8 @@ public:
       TheFuncDecl(NULL),
       TheParmVarDecl(NULL),
       TheNewDeclName(""),
-      TheParamPos(-1)
+      TheParamPos(-1),
+      NumSingleInstances(0)
   { }
 
   ~ParamToGlobal(void);
@@ -64,8 +65,14 @@ private:
 
   bool isValidFuncDecl(clang::FunctionDecl *FD);
 
+  void addBatchCandidate(void);
+
   llvm::SmallVector<clang::FunctionDecl *, 10> ValidFuncDecls;
 
+  // one (function, parameter) pair per candidate function, for the
+  // combined batch candidate
+  ParamTargetVector BatchTargets;
+
   ParamToGlobalASTVisitor *CollectionVisitor;
 
   ParamToGlobalRewriteVisitor *RewriteVisitor;
@@ -78,6 +85,8 @@ private:
 
   int TheParamPos;
 
+  int NumSingleInstances;
+
   // Unimplemented
   ParamToGlobal(void);
 
@@ -26,7 +26,9 @@ static const char *DescriptionMsg =
 of a function. Define the removed parameter as a local variable \
 of the same function. Initialze the newly local variable to be \
 0. Also, make corresponding changes on all of the call sites of \
-the modified function.\n";
+the modified function. If more than one function has a \
+removable parameter, one extra counter (the last one) transforms \
+one parameter of every such function in a single run.\n";
  
 static RegisterTransformation<ParamToLocal> 
          Trans("param-to-local", DescriptionMsg);
@@ -73,6 +75,8 @@ void ParamToLocal::Initialize(ASTContext &context)
 void ParamToLocal::HandleTranslationUnit(ASTContext &Ctx)
 {
   CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  addBatchCandidate();
+
   if (QueryInstanceOnly)
     return;
 
@@ -83,11 +87,18 @@ void ParamToLocal::HandleTranslationUnit(ASTContext &Ctx)
 
   TransAssert(RewriteVisitor && "NULL RewriteVisitor!");
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
-  TransAssert(TheFuncDecl && "NULL TheFuncDecl!");
-  TransAssert((TheParamPos >= 0) && "Invalid parameter position!");
 
-  RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
-  RewriteVisitor->rewriteAllExprs();
+  if (TransformationCounter > NumSingleInstances) {
+    RewriteVisitor->rewritePlannedTargets(Ctx.getTranslationUnitDecl(),
+                                          BatchTargets);
+  }
+  else {
+    TransAssert(TheFuncDecl && "NULL TheFuncDecl!");
+    TransAssert((TheParamPos >= 0) && "Invalid parameter position!");
+
+    RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    RewriteVisitor->rewriteAllExprs();
+  }
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
@@ -203,12 +214,24 @@ bool ParamToLocal::isValidFuncDecl(FunctionDecl *FD)
       TheParamPos = ParamPos;
     }
 
+    // the batch candidate takes one parameter per function; a second
+    // parameter of the same function would overlap the comma rewrites
+    if (!IsValid)
+      BatchTargets.push_back(std::make_pair(FD, ParamPos));
+
     IsValid = true;
     ParamPos++;
   }
   return IsValid;
 }
 
+void ParamToLocal::addBatchCandidate(void)
+{
+  NumSingleInstances = ValidInstanceNum;
+  if (BatchTargets.size() > 1)
+    ValidInstanceNum++;
+}
+
 ParamToLocal::~ParamToLocal(void)
 {
   delete CollectionVisitor;
@@ -40,7 +40,8 @@ public:
       CollectionVisitor(NULL),
       RewriteVisitor(NULL),
       TheFuncDecl(NULL),
-      TheParamPos(-1)
+      TheParamPos(-1),
+      NumSingleInstances(0)
   { }
 
   ~ParamToLocal(void);
@@ -57,8 +58,14 @@ private:
 
   bool rewriteFuncDecl(clang::FunctionDecl *FD);
 
+  void addBatchCandidate(void);
+
   llvm::SmallVector<clang::FunctionDecl *, 10> ValidFuncDecls;
 
+  // one (function, parameter) pair per candidate function, for the
+  // combined batch candidate
+  ParamTargetVector BatchTargets;
+
   ParamToLocalASTVisitor *CollectionVisitor;
 
   ParamToLocalRewriteVisitor *RewriteVisitor;
@@ -67,6 +74,8 @@ private:
 
   int TheParamPos;
 
+  int NumSingleInstances;
+
   // Unimplemented
   ParamToLocal(void);
 
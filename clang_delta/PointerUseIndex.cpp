@@ -0,0 +1,168 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2014, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "PointerUseIndex.h"
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+
+using namespace clang;
+
+PointerUseIndex *PointerUseIndex::Instance = NULL;
+
+// The builder intentionally visits with the default RecursiveASTVisitor
+// policy (no template instantiations, no implicit code) because that is
+// what the collection visitors it replaces used; a different visitation
+// set would renumber instances.
+class PointerUseBuilder : public RecursiveASTVisitor<PointerUseBuilder> {
+public:
+  explicit PointerUseBuilder(PointerUseIndex *Idx)
+    : Index(Idx),
+      FlaggedDRE(NULL)
+  { }
+
+  bool VisitVarDecl(VarDecl *VD) {
+    if (dyn_cast<ParmVarDecl>(VD))
+      return true;
+    if (!VD->getType().getTypePtr()->isPointerType())
+      return true;
+
+    PointerUseIndex::PointerEvent E = { VD, NULL };
+    Index->Events.push_back(E);
+    return true;
+  }
+
+  bool VisitDeclRefExpr(DeclRefExpr *DRE) {
+    if (const VarDecl *VD = getPointerVarDecl(DRE)) {
+      Index->UseCounts[VD]++;
+      // The comparison visit below runs before its operands, so the
+      // flag names exactly the next DeclRefExpr the traversal reaches.
+      if (DRE == FlaggedDRE)
+        Index->LiteralCompareUseCounts[VD]++;
+    }
+    FlaggedDRE = NULL;
+    return true;
+  }
+
+  bool VisitUnaryOperator(UnaryOperator *UO) {
+    if (UO->getOpcode() != UO_AddrOf)
+      return true;
+
+    if (const VarDecl *VD =
+        getPointerVarDecl(UO->getSubExpr()->IgnoreParenCasts()))
+      Index->AddrTakenVars.insert(VD);
+    return true;
+  }
+
+  bool VisitBinaryOperator(BinaryOperator *BO) {
+    if (BO->getOpcode() == BO_Assign) {
+      const VarDecl *VD =
+        getPointerVarDecl(BO->getLHS()->IgnoreParenCasts());
+      if (VD) {
+        PointerUseIndex::PointerEvent E = { VD, BO };
+        Index->Events.push_back(E);
+      }
+      return true;
+    }
+
+    if (!BO->isComparisonOp())
+      return true;
+
+    const Expr *E = NULL;
+    if (dyn_cast<IntegerLiteral>(BO->getLHS()->IgnoreParenCasts()))
+      E = BO->getRHS()->IgnoreParenCasts();
+    else if (dyn_cast<IntegerLiteral>(BO->getRHS()->IgnoreParenCasts()))
+      E = BO->getLHS()->IgnoreParenCasts();
+    if (!E)
+      return true;
+
+    const DeclRefExpr *DRE = dyn_cast<DeclRefExpr>(E);
+    if (!DRE)
+      return true;
+
+    // Only a reference to the canonical declaration is tolerated; one
+    // through a later redeclaration counts as an ordinary use, exactly
+    // like the private visitor this replaces.
+    const VarDecl *VD = dyn_cast<VarDecl>(DRE->getDecl());
+    if (VD && !dyn_cast<ParmVarDecl>(VD) &&
+        VD->getType().getTypePtr()->isPointerType() &&
+        (VD == VD->getCanonicalDecl()))
+      FlaggedDRE = DRE;
+    return true;
+  }
+
+private:
+
+  // The canonical decl of a pointer-typed, non-parameter variable the
+  // expression directly names, or NULL.
+  const VarDecl *getPointerVarDecl(const Expr *E) {
+    const DeclRefExpr *DRE = dyn_cast<DeclRefExpr>(E);
+    if (!DRE)
+      return NULL;
+
+    const VarDecl *VD = dyn_cast<VarDecl>(DRE->getDecl());
+    if (!VD || dyn_cast<ParmVarDecl>(VD))
+      return NULL;
+    if (!VD->getType().getTypePtr()->isPointerType())
+      return NULL;
+    return VD->getCanonicalDecl();
+  }
+
+  PointerUseIndex *Index;
+
+  const DeclRefExpr *FlaggedDRE;
+};
+
+PointerUseIndex *PointerUseIndex::GetInstance(ASTContext &Ctx)
+{
+  if (!PointerUseIndex::Instance) {
+    PointerUseIndex::Instance = new PointerUseIndex();
+    assert(PointerUseIndex::Instance);
+  }
+
+  if (PointerUseIndex::Instance->IndexedContext != &Ctx)
+    PointerUseIndex::Instance->build(Ctx);
+  return PointerUseIndex::Instance;
+}
+
+void PointerUseIndex::Finalize(void)
+{
+  delete PointerUseIndex::Instance;
+  PointerUseIndex::Instance = NULL;
+}
+
+unsigned PointerUseIndex::getNumUses(const VarDecl *CanonicalVD) const
+{
+  UseCountMap::const_iterator I = UseCounts.find(CanonicalVD);
+  return (I == UseCounts.end()) ? 0 : (*I).second;
+}
+
+unsigned PointerUseIndex::getNumLiteralCompareUses(
+           const VarDecl *CanonicalVD) const
+{
+  UseCountMap::const_iterator I = LiteralCompareUseCounts.find(CanonicalVD);
+  return (I == LiteralCompareUseCounts.end()) ? 0 : (*I).second;
+}
+
+void PointerUseIndex::build(ASTContext &Ctx)
+{
+  Events.clear();
+  UseCounts.clear();
+  LiteralCompareUseCounts.clear();
+  AddrTakenVars.clear();
+
+  PointerUseBuilder Builder(this);
+  Builder.TraverseDecl(Ctx.getTranslationUnitDecl());
+  IndexedContext = &Ctx;
+}
@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2014, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef POINTER_USE_INDEX_H
+#define POINTER_USE_INDEX_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace clang {
+  class ASTContext;
+  class BinaryOperator;
+  class VarDecl;
+}
+
+class PointerUseBuilder;
+
+// A single translation-unit sweep over pointer variable usage, shared by
+// the pointer passes (remove-pointer, reduce-pointer-pairs).  Each of
+// them used to run its own RecursiveASTVisitor over the whole TU to
+// collect the same facts: which pointer variables exist, where they are
+// assigned, whether their uses alias (address-taken) or stay inside the
+// tolerated comparison forms.  The pointer passes run back-to-back in
+// the pass groups, and the daemon keeps a parse server alive per source
+// hash, so without the index those identical sweeps repeat for every
+// pass on every intermediate file.  The index performs the sweep once
+// per parsed AST; in the parse-once server modes the parent builds it
+// right after the parse and every forked counter inherits it through
+// copy-on-write.
+//
+// reduce-pointer-level keeps its private collection sweep: its summary
+// additionally spans fields, member expressions and indirection levels,
+// and it needs the traversal anyway to compute them.  Only the
+// variable-level alias facts that the other passes replay are
+// materialized here.
+class PointerUseIndex {
+friend class PointerUseBuilder;
+
+public:
+
+  // A pointer variable declaration (AssignBO == NULL) or an assignment
+  // whose left-hand side names one, in visitation order.  The order is
+  // load-bearing: consuming passes replay the stream with their own
+  // filters so instance numbering stays identical to a private
+  // traversal.
+  struct PointerEvent {
+    const clang::VarDecl *VD;
+
+    const clang::BinaryOperator *AssignBO;
+  };
+
+  typedef llvm::SmallVector<PointerEvent, 32> EventVector;
+
+  // Returns the index for Ctx, building it on first request.  A request
+  // for a different ASTContext discards the cached sweep, following the
+  // RewriteUtils::GetInstance convention.
+  static PointerUseIndex *GetInstance(clang::ASTContext &Ctx);
+
+  static void Finalize(void);
+
+  const EventVector &getPointerEvents(void) const {
+    return Events;
+  }
+
+  // Number of DeclRefExprs naming this pointer variable.
+  // Expects the canonical decl.
+  unsigned getNumUses(const clang::VarDecl *CanonicalVD) const;
+
+  // Number of those uses that are an operand of a comparison against an
+  // integer literal -- the only use remove-pointer tolerates.
+  unsigned getNumLiteralCompareUses(const clang::VarDecl *CanonicalVD) const;
+
+  // True if the variable's address is taken somewhere in the TU - the
+  // basic may-alias fact.  Expects the canonical decl.
+  bool isAddrTaken(const clang::VarDecl *CanonicalVD) const {
+    return AddrTakenVars.count(CanonicalVD);
+  }
+
+private:
+
+  typedef llvm::DenseMap<const clang::VarDecl *, unsigned> UseCountMap;
+
+  typedef llvm::SmallPtrSet<const clang::VarDecl *, 32> VarSet;
+
+  void build(clang::ASTContext &Ctx);
+
+  static PointerUseIndex *Instance;
+
+  const clang::ASTContext *IndexedContext;
+
+  EventVector Events;
+
+  UseCountMap UseCounts;
+
+  UseCountMap LiteralCompareUseCounts;
+
+  VarSet AddrTakenVars;
+
+  PointerUseIndex(void)
+    : IndexedContext(NULL)
+  { }
+
+  ~PointerUseIndex(void) { }
+
+  // Unimplemented
+  PointerUseIndex(const PointerUseIndex &);
+
+  void operator=(const PointerUseIndex &);
+};
+
+#endif
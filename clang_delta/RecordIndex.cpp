@@ -0,0 +1,134 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2026 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "RecordIndex.h"
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+
+using namespace clang;
+
+RecordIndex *RecordIndex::Instance;
+
+// Records every callback a rewrite visitor implementing the four hooks
+// would have received, in the same order, so replaying the stream is
+// equivalent to re-traversing the translation unit.
+class RecordIndexBuilder : public RecursiveASTVisitor<RecordIndexBuilder> {
+public:
+
+  explicit RecordIndexBuilder(RecordIndex::NodeVector &NodesRef)
+    : Nodes(NodesRef)
+  { }
+
+  bool VisitRecordDecl(RecordDecl *RD) {
+    RecordIndex::Node N;
+    N.Kind = RecordIndex::NK_RecordDecl;
+    N.RD = RD;
+    N.VD = NULL;
+    N.ME = NULL;
+    Nodes.push_back(N);
+    return true;
+  }
+
+  bool VisitVarDecl(VarDecl *VD) {
+    RecordIndex::Node N;
+    N.Kind = RecordIndex::NK_VarDecl;
+    N.RD = NULL;
+    N.VD = VD;
+    N.ME = NULL;
+    Nodes.push_back(N);
+    return true;
+  }
+
+  bool VisitRecordTypeLoc(RecordTypeLoc RTLoc) {
+    RecordIndex::Node N;
+    N.Kind = RecordIndex::NK_RecordTypeLoc;
+    N.RD = NULL;
+    N.VD = NULL;
+    N.RTLoc = RTLoc;
+    N.ME = NULL;
+    Nodes.push_back(N);
+    return true;
+  }
+
+  bool VisitMemberExpr(MemberExpr *ME) {
+    RecordIndex::Node N;
+    N.Kind = RecordIndex::NK_MemberExpr;
+    N.RD = NULL;
+    N.VD = NULL;
+    N.ME = ME;
+    Nodes.push_back(N);
+    return true;
+  }
+
+private:
+
+  RecordIndex::NodeVector &Nodes;
+};
+
+RecordIndex *RecordIndex::GetInstance()
+{
+  if (RecordIndex::Instance)
+    return RecordIndex::Instance;
+
+  RecordIndex::Instance = new RecordIndex();
+  assert(RecordIndex::Instance);
+  return RecordIndex::Instance;
+}
+
+void RecordIndex::Finalize()
+{
+  delete RecordIndex::Instance;
+  RecordIndex::Instance = NULL;
+}
+
+void RecordIndex::prepare(const ASTContext *Ctx)
+{
+  if (PreparedFor == Ctx)
+    return;
+  PreparedFor = Ctx;
+  NodesBuiltFor = NULL;
+  Nodes.clear();
+  VarToDeclStmt.clear();
+}
+
+void RecordIndex::recordDeclStmt(DeclStmt *DS)
+{
+  for (DeclStmt::decl_iterator I = DS->decl_begin(),
+       E = DS->decl_end(); I != E; ++I) {
+    if (VarDecl *VD = dyn_cast<VarDecl>(*I))
+      VarToDeclStmt[VD] = DS;
+  }
+}
+
+DeclStmt *RecordIndex::getEnclosingDeclStmt(const VarDecl *VD)
+{
+  llvm::DenseMap<const VarDecl *, DeclStmt *>::iterator I =
+    VarToDeclStmt.find(VD);
+  if (I == VarToDeclStmt.end())
+    return NULL;
+  return (*I).second;
+}
+
+void RecordIndex::ensureBuilt(ASTContext *Ctx)
+{
+  prepare(Ctx);
+  if (NodesBuiltFor == Ctx)
+    return;
+  NodesBuiltFor = Ctx;
+  Nodes.clear();
+
+  RecordIndexBuilder Builder(Nodes);
+  Builder.TraverseDecl(Ctx->getTranslationUnitDecl());
+}
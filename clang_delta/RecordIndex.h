@@ -0,0 +1,115 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2026 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef RECORD_INDEX_H
+#define RECORD_INDEX_H
+
+#include <vector>
+
+#include "clang/AST/TypeLoc.h"
+#include "llvm/ADT/DenseMap.h"
+
+namespace clang {
+  class ASTContext;
+  class DeclStmt;
+  class MemberExpr;
+  class RecordDecl;
+  class VarDecl;
+}
+
+// A per-parse index of the record-related AST nodes the struct passes
+// keep re-enumerating with private full-TU visitors.  It has two parts:
+//
+//  * a VarDecl-to-enclosing-DeclStmt map, populated for free by the
+//    collection visitors that already walk DeclStmts during the parse;
+//
+//  * a stream of the record-related rewrite callbacks (record
+//    declarations, variable declarations, record type references and
+//    member accesses) in traversal order, built lazily with one sweep
+//    and then replayed by any number of rewrite passes, so a rewrite
+//    only walks the nodes it can possibly touch instead of the whole
+//    translation unit.
+//
+// Like SymbolIndex, the index is process-local and keyed by AST nodes,
+// so it is reset whenever a new ASTContext is parsed; sweeps against the
+// same ASTContext (daemon and fork-server children, the instance census)
+// share one build.
+class RecordIndex {
+
+public:
+
+  enum NodeKind {
+    NK_RecordDecl,
+    NK_VarDecl,
+    NK_RecordTypeLoc,
+    NK_MemberExpr
+  };
+
+  // One rewrite-sweep callback in traversal order; only the member
+  // matching Kind is meaningful.
+  struct Node {
+    NodeKind Kind;
+    clang::RecordDecl *RD;
+    clang::VarDecl *VD;
+    clang::TypeLoc RTLoc;
+    clang::MemberExpr *ME;
+  };
+
+  typedef std::vector<Node> NodeVector;
+
+  static RecordIndex *GetInstance();
+
+  static void Finalize();
+
+  // Reset the index when a new ASTContext comes up; call before
+  // recording into or consulting it for that context.
+  void prepare(const clang::ASTContext *Ctx);
+
+  // Record the variables declared by DS; meant to be called from a
+  // collection visitor that walks DeclStmts anyway, so the map costs no
+  // traversal of its own.
+  void recordDeclStmt(clang::DeclStmt *DS);
+
+  clang::DeclStmt *getEnclosingDeclStmt(const clang::VarDecl *VD);
+
+  // Build the node stream with one traversal of the translation unit,
+  // unless it has already been built for this context.
+  void ensureBuilt(clang::ASTContext *Ctx);
+
+  const NodeVector &getNodes() {
+    return Nodes;
+  }
+
+private:
+
+  RecordIndex()
+    : PreparedFor(NULL),
+      NodesBuiltFor(NULL)
+  { }
+
+  ~RecordIndex() { }
+
+  static RecordIndex *Instance;
+
+  const clang::ASTContext *PreparedFor;
+
+  const clang::ASTContext *NodesBuiltFor;
+
+  NodeVector Nodes;
+
+  llvm::DenseMap<const clang::VarDecl *, clang::DeclStmt *> VarToDeclStmt;
+
+  // Unimplemented
+  RecordIndex(const RecordIndex &);
+
+  void operator=(const RecordIndex &);
+};
+
+#endif
@@ -20,6 +20,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "ArrayUseIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -39,29 +40,7 @@ Also, this pass only works with ConstantArrayType and IncompleteArrayType.\n";
 static RegisterTransformation<ReduceArrayDim>
          Trans("reduce-array-dim", DescriptionMsg);
 
-class ReduceArrayDimCollectionVisitor : public 
-  RecursiveASTVisitor<ReduceArrayDimCollectionVisitor> {
-
-public:
-
-  explicit ReduceArrayDimCollectionVisitor(ReduceArrayDim *Instance)
-    : ConsumerInstance(Instance)
-  { }
-
-  bool VisitVarDecl(VarDecl *VD);
-
-private:
-
-  ReduceArrayDim *ConsumerInstance;
-};
-
-bool ReduceArrayDimCollectionVisitor::VisitVarDecl(VarDecl *VD)
-{
-  ConsumerInstance->addOneVar(VD);
-  return true;
-}
-
-class ReduceArrayDimRewriteVisitor : public 
+class ReduceArrayDimRewriteVisitor : public
   RecursiveASTVisitor<ReduceArrayDimRewriteVisitor> {
 
 public:
@@ -97,23 +76,36 @@ bool ReduceArrayDimRewriteVisitor::VisitArraySubscriptExpr(
   return true;
 }
 
-void ReduceArrayDim::Initialize(ASTContext &context) 
+void ReduceArrayDim::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
-  CollectionVisitor = new ReduceArrayDimCollectionVisitor(this);
   RewriteVisitor = new ReduceArrayDimRewriteVisitor(this);
 }
 
-bool ReduceArrayDim::HandleTopLevelDecl(DeclGroupRef D) 
+void ReduceArrayDim::prepareSharedAnalysis(ASTContext &Ctx)
 {
-  for (DeclGroupRef::iterator I = D.begin(), E = D.end(); I != E; ++I) {
-    CollectionVisitor->TraverseDecl(*I);
+  // counter-independent: one shared sweep instead of a private traversal
+  ArrayUseIndex::GetInstance(Ctx);
+}
+
+void ReduceArrayDim::collectArrayVars(ASTContext &Ctx)
+{
+  const ArrayUseIndex::EventVector &Events =
+    ArrayUseIndex::GetInstance(Ctx)->getArrayEvents();
+
+  // Replay the shared sweep; only the declaration sightings matter here,
+  // subscripts are rewritten later by the counter-dependent
+  // RewriteVisitor.
+  for (ArrayUseIndex::EventVector::const_iterator I = Events.begin(),
+       E = Events.end(); I != E; ++I) {
+    if ((*I).VD)
+      addOneVar((*I).VD);
   }
-  return true;
 }
- 
+
 void ReduceArrayDim::HandleTranslationUnit(ASTContext &Ctx)
 {
+  collectArrayVars(Ctx);
   if (QueryInstanceOnly)
     return;
 
@@ -389,7 +381,6 @@ void ReduceArrayDim::handleOneArraySubscriptExpr(
 
 ReduceArrayDim::~ReduceArrayDim(void)
 {
-  delete CollectionVisitor;
   delete RewriteVisitor;
 }
 
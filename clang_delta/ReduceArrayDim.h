@@ -24,18 +24,15 @@ namespace clang {
   class ArrayType;
 }
 
-class ReduceArrayDimCollectionVisitor;
 class ReduceArrayDimRewriteVisitor;
 
 class ReduceArrayDim : public Transformation {
-friend class ReduceArrayDimCollectionVisitor;
 friend class ReduceArrayDimRewriteVisitor;
 
 public:
 
   ReduceArrayDim(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       RewriteVisitor(NULL),
       TheVarDecl(NULL),
       ArraySz(0)
@@ -57,10 +54,12 @@ private:
 
   virtual void Initialize(clang::ASTContext &context);
 
-  virtual bool HandleTopLevelDecl(clang::DeclGroupRef D);
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  void collectArrayVars(clang::ASTContext &Ctx);
+
   void addOneVar(const clang::VarDecl *VD);
 
   void rewriteOneVarDecl(const clang::VarDecl *VD);
@@ -88,8 +87,6 @@ private:
 
   VarDeclSet VisitedVarDecls;
 
-  ReduceArrayDimCollectionVisitor *CollectionVisitor;
-
   ReduceArrayDimRewriteVisitor *RewriteVisitor;
 
   const clang::VarDecl *TheVarDecl;
@@ -20,6 +20,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "ArrayUseIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -35,53 +36,36 @@ This transformation is legitimate for an array if: \n\
 static RegisterTransformation<ReduceArraySize>
          Trans("reduce-array-size", DescriptionMsg);
 
-class ReduceArraySizeCollectionVisitor : public 
-  RecursiveASTVisitor<ReduceArraySizeCollectionVisitor> {
-
-public:
-
-  explicit ReduceArraySizeCollectionVisitor(ReduceArraySize *Instance)
-    : ConsumerInstance(Instance)
-  { }
-
-  bool VisitVarDecl(VarDecl *VD);
-
-  bool VisitArraySubscriptExpr(ArraySubscriptExpr *ASE);
-
-private:
-
-  ReduceArraySize *ConsumerInstance;
-};
-
-bool ReduceArraySizeCollectionVisitor::VisitVarDecl(VarDecl *VD)
+void ReduceArraySize::Initialize(ASTContext &context)
 {
-  ConsumerInstance->handleOneVar(VD);
-  return true;
+  Transformation::Initialize(context);
 }
 
-bool ReduceArraySizeCollectionVisitor::VisitArraySubscriptExpr(
-       ArraySubscriptExpr *ASE)
+void ReduceArraySize::prepareSharedAnalysis(ASTContext &Ctx)
 {
-  ConsumerInstance->handleOneASE(ASE);
-  return true;
+  // counter-independent: one shared sweep instead of a private traversal
+  ArrayUseIndex::GetInstance(Ctx);
 }
 
-void ReduceArraySize::Initialize(ASTContext &context) 
+void ReduceArraySize::collectArrayUses(ASTContext &Ctx)
 {
-  Transformation::Initialize(context);
-  CollectionVisitor = new ReduceArraySizeCollectionVisitor(this);
-}
-
-bool ReduceArraySize::HandleTopLevelDecl(DeclGroupRef D) 
-{
-  for (DeclGroupRef::iterator I = D.begin(), E = D.end(); I != E; ++I) {
-    CollectionVisitor->TraverseDecl(*I);
+  const ArrayUseIndex::EventVector &Events =
+    ArrayUseIndex::GetInstance(Ctx)->getArrayEvents();
+
+  // Replay the shared sweep with this pass's filters; the declaration
+  // reference sightings only matter to remove-array.
+  for (ArrayUseIndex::EventVector::const_iterator I = Events.begin(),
+       E = Events.end(); I != E; ++I) {
+    if ((*I).VD)
+      handleOneVar((*I).VD);
+    else if ((*I).ASE)
+      handleOneASE((*I).ASE);
   }
-  return true;
 }
- 
+
 void ReduceArraySize::HandleTranslationUnit(ASTContext &Ctx)
 {
+  collectArrayUses(Ctx);
   doAnalysis();
   if (QueryInstanceOnly)
     return;
@@ -91,7 +75,6 @@ void ReduceArraySize::HandleTranslationUnit(ASTContext &Ctx)
     return;
   }
 
-  TransAssert(CollectionVisitor && "NULL CollectionVisitor!");
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
   TransAssert(TheVarDecl && "NULL TheVarDecl!");
   TransAssert((TheDimValue >= 0) && "Bad TheDimValue!");
@@ -291,8 +274,6 @@ void ReduceArraySize::handleOneASE(const ArraySubscriptExpr *ASE)
 
 ReduceArraySize::~ReduceArraySize(void)
 {
-  delete CollectionVisitor;
-
   for (VarDeclToDimMap::iterator I = VarDeclToDim.begin(),
        E = VarDeclToDim.end(); I != E; ++I) {
     delete (*I).second;
@@ -25,16 +25,12 @@ namespace clang {
   class Expr;
 }
 
-class ReduceArraySizeCollectionVisitor;
-
 class ReduceArraySize : public Transformation {
-friend class ReduceArraySizeCollectionVisitor;
 
 public:
 
   ReduceArraySize(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       TheVarDecl(NULL),
       TheDimValue(-1),
       TheDimIdx(0)
@@ -54,10 +50,12 @@ private:
   
   virtual void Initialize(clang::ASTContext &context);
 
-  virtual bool HandleTopLevelDecl(clang::DeclGroupRef D);
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  void collectArrayUses(clang::ASTContext &Ctx);
+
   bool isIntegerExpr(const clang::Expr *Exp);
 
   void handleOneVar(const clang::VarDecl *VD);
@@ -80,8 +78,6 @@ private:
   // smaller than the size of an array
   VarDeclToDimMap OrigVarDeclToDim;
 
-  ReduceArraySizeCollectionVisitor *CollectionVisitor;
-
   const clang::VarDecl *TheVarDecl;
 
   int TheDimValue;
@@ -218,6 +218,9 @@ bool ReduceClassTemplateParameterRewriteVisitor::
 bool ReduceClassTemplateParameterASTVisitor::VisitClassTemplateDecl(
        ClassTemplateDecl *D)
 {
+  if (Transformation::isCancelRequested())
+    return false;
+
   if (ConsumerInstance->isInIncludedFile(D))
     return true;
 
@@ -265,14 +268,11 @@ bool ReduceClassTemplateParameterASTVisitor::VisitClassTemplateDecl(
       continue;
     }
 
-    ConsumerInstance->ValidInstanceNum++;
-    if (ConsumerInstance->ValidInstanceNum == 
-        ConsumerInstance->TransformationCounter) {
-      ConsumerInstance->TheClassTemplateDecl = CanonicalD;
-      ConsumerInstance->TheParameterIndex = Index;
-      ConsumerInstance->TheTemplateName = new TemplateName(CanonicalD);
-      ConsumerInstance->setDefaultArgFlag(ND);
-    }
+    // record the removable parameter; HandleTranslationUnit numbers the
+    // entries in this order, so instances match the old uncached walk
+    ReduceClassTemplateParameter::UnusedParameterEntry Entry =
+      { CanonicalD, Index, ND };
+    ConsumerInstance->UnusedParameters.push_back(Entry);
     Index++;
   }
 
@@ -286,6 +286,29 @@ void ReduceClassTemplateParameter::Initialize(ASTContext &context)
   ArgRewriteVisitor = new ReduceClassTemplateParameterRewriteVisitor(this);
 }
 
+void ReduceClassTemplateParameter::prepareSharedAnalysis(ASTContext &Ctx)
+{
+  if (TransformationManager::isCLangOpt() ||
+      TransformationManager::isOpenCLLangOpt())
+    return;
+  // The per-template analysis (the validity checks and the
+  // used-parameter traversal of each definition) is counter-independent
+  // and dominates this pass on template-heavy inputs, which easily
+  // produce hundreds of counters over the same templates.  Run it once
+  // on the freshly parsed AST; every counter then replays the recorded
+  // removable entries instead of re-traversing the translation unit.
+  // A cancelled run may have left a partial record behind; start from
+  // a clean slate so a retry in daemon mode cannot count duplicates.
+  UnusedParameters.clear();
+  VisitedDecls.clear();
+  CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  // Keep the partial entries for this request (a query still reports
+  // them), but leave AnalysisDone unset so the next request recomputes.
+  if (Transformation::isCancelRequested())
+    return;
+  AnalysisDone = true;
+}
+
 void ReduceClassTemplateParameter::HandleTranslationUnit(ASTContext &Ctx)
 {
   if (TransformationManager::isCLangOpt() ||
@@ -293,12 +316,30 @@ void ReduceClassTemplateParameter::HandleTranslationUnit(ASTContext &Ctx)
     ValidInstanceNum = 0;
   }
   else {
-    CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    if (!AnalysisDone)
+      prepareSharedAnalysis(Ctx);
+    for (UnusedParameterVector::iterator I = UnusedParameters.begin(),
+         E = UnusedParameters.end(); I != E; ++I) {
+      ValidInstanceNum++;
+      if (ValidInstanceNum == TransformationCounter) {
+        TheClassTemplateDecl = (*I).CanonicalD;
+        TheParameterIndex = (*I).Index;
+        TheTemplateName = new TemplateName((*I).CanonicalD);
+        setDefaultArgFlag((*I).ParamND);
+      }
+    }
   }
 
   if (QueryInstanceOnly)
     return;
 
+  // a cancelled collection leaves the instance census incomplete, so
+  // do not let the counter check misreport it as exhausted
+  if (Transformation::isCancelRequested()) {
+    TransError = TransDeadlineError;
+    return;
+  }
+
   if (TransformationCounter > ValidInstanceNum) {
     TransError = TransMaxInstanceError;
     return;
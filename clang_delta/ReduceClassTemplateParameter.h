@@ -12,6 +12,7 @@
 #define REDUCE_CLASS_TEMPLATE_PARAMETER_H
 
 #include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
 #include "Transformation.h"
 
 namespace clang {
@@ -40,7 +41,8 @@ public:
       TheClassTemplateDecl(NULL),
       hasDefaultArg(false),
       TheParameterIndex(0),
-      TheTemplateName(NULL)
+      TheTemplateName(NULL),
+      AnalysisDone(false)
   {}
 
   ~ReduceClassTemplateParameter();
@@ -49,10 +51,22 @@ public:
                               const clang::TemplateParameterList *TPList,
                               unsigned Index);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
 private:
-  typedef llvm::SmallPtrSet<const clang::ClassTemplateDecl *, 20> 
+  typedef llvm::SmallPtrSet<const clang::ClassTemplateDecl *, 20>
             ClassTemplateDeclSet;
 
+  // one removable (unused) parameter found by the shared analysis:
+  // the owning template, the parameter's index and the parameter decl
+  struct UnusedParameterEntry {
+    clang::ClassTemplateDecl *CanonicalD;
+    unsigned Index;
+    const clang::NamedDecl *ParamND;
+  };
+
+  typedef llvm::SmallVector<UnusedParameterEntry, 20> UnusedParameterVector;
+
   virtual void Initialize(clang::ASTContext &context);
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
@@ -101,6 +115,10 @@ private:
 
   ClassTemplateDeclSet VisitedDecls;
 
+  // removable parameters in visitation order; filled once per parse
+  // and replayed for every counter
+  UnusedParameterVector UnusedParameters;
+
   ReduceClassTemplateParameterASTVisitor *CollectionVisitor;
 
   ReduceClassTemplateParameterRewriteVisitor *ArgRewriteVisitor;
@@ -113,6 +131,8 @@ private:
 
   clang::TemplateName *TheTemplateName;
 
+  bool AnalysisDone;
+
   // Unimplemented
   ReduceClassTemplateParameter();
 
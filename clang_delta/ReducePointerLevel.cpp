@@ -457,9 +457,20 @@ void ReducePointerLevel::Initialize(ASTContext &context)
   RewriteVisitor = new PointerLevelRewriteVisitor(this);
 }
 
-void ReducePointerLevel::HandleTranslationUnit(ASTContext &Ctx)
+void ReducePointerLevel::prepareSharedAnalysis(ASTContext &Ctx)
 {
+  // The def-use collection (decl lists, per-decl use sets) does not
+  // depend on the counter, so it runs once per parse; every counter
+  // applied to this AST then only pays for candidate selection and
+  // the rewrite traversal.
   CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  AnalysisDone = true;
+}
+
+void ReducePointerLevel::HandleTranslationUnit(ASTContext &Ctx)
+{
+  if (!AnalysisDone)
+    prepareSharedAnalysis(Ctx);
   doAnalysis();
 
   if (QueryInstanceOnly)
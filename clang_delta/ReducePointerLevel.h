@@ -49,11 +49,14 @@ public:
       RewriteVisitor(NULL),
       MaxIndirectLevel(0),
       TheDecl(NULL),
-      TheRecordDecl(NULL)
+      TheRecordDecl(NULL),
+      AnalysisDone(false)
   { }
 
   ~ReducePointerLevel(void);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
 private:
   
   typedef llvm::SmallPtrSet<const clang::DeclaratorDecl *, 20> DeclSet;
@@ -141,6 +144,8 @@ private:
 
   const clang::RecordDecl *TheRecordDecl ;
 
+  bool AnalysisDone;
+
   // Unimplemented
   ReducePointerLevel(void);
 
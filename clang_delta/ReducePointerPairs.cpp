@@ -18,6 +18,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "PointerUseIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -32,25 +33,7 @@ p2 and &p1.\n";
 static RegisterTransformation<ReducePointerPairs>
          Trans("reduce-pointer-pairs", DescriptionMsg);
 
-class ReducePointerPairsCollectionVisitor : public 
-  RecursiveASTVisitor<ReducePointerPairsCollectionVisitor> {
-
-public:
-
-  explicit ReducePointerPairsCollectionVisitor(ReducePointerPairs *Instance)
-    : ConsumerInstance(Instance)
-  { }
-
-  bool VisitVarDecl(VarDecl *VD);
-
-  bool VisitBinaryOperator(BinaryOperator *BO);
-
-private:
-
-  ReducePointerPairs *ConsumerInstance;
-};
-
-class ReducePointerPairsInvalidatingVisitor : public 
+class ReducePointerPairsInvalidatingVisitor : public
   RecursiveASTVisitor<ReducePointerPairsInvalidatingVisitor> {
 
 public:
@@ -78,35 +61,6 @@ private:
   DeclRefExprQueue CurrentPairedDeclRefExprs;
 };
 
-bool ReducePointerPairsCollectionVisitor::VisitVarDecl(VarDecl *VD)
-{
-  if (!ConsumerInstance->isValidVD(VD))
-    return true;
-
-  const Expr *Init = VD->getAnyInitializer();
-  if (!Init)
-    return true;
- 
-  ConsumerInstance->handleOnePair(VD->getCanonicalDecl(), 
-                                  Init->IgnoreParenCasts());
-  return true;
-}
-
-bool ReducePointerPairsCollectionVisitor::VisitBinaryOperator(
-       BinaryOperator *BO)
-{
-  if (BO->getOpcode() != BO_Assign)
-    return true;
-
-  const Expr *Lhs = BO->getLHS()->IgnoreParenCasts();
-  const VarDecl *VD = ConsumerInstance->getVarDeclFromDRE(Lhs);
-  if (!VD || !ConsumerInstance->isValidVD(VD))
-    return true;
- 
-  ConsumerInstance->handleOnePair(VD, BO->getRHS()->IgnoreParenCasts());
-  return true;
-}
-
 bool ReducePointerPairsInvalidatingVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
 {
   const DeclRefExpr *CurrentDeclRefExpr = NULL;
@@ -227,18 +181,22 @@ bool ReducePointerPairsInvalidatingVisitor::VisitBinaryOperator(
   return true;
 }
 
-void ReducePointerPairs::Initialize(ASTContext &context) 
+void ReducePointerPairs::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
-  CollectionVisitor = new ReducePointerPairsCollectionVisitor(this);
   InvalidatingVisitor = new ReducePointerPairsInvalidatingVisitor(this);
 }
 
+void ReducePointerPairs::prepareSharedAnalysis(ASTContext &Ctx)
+{
+  // counter-independent: one shared sweep instead of a private traversal
+  PointerUseIndex::GetInstance(Ctx);
+}
+
 void ReducePointerPairs::HandleTranslationUnit(ASTContext &Ctx)
 {
-  TransAssert(CollectionVisitor && "NULL CollectionVisitor!");
   TransAssert(InvalidatingVisitor && "NULL InvalidatingVisitor!");
-  CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  collectPairs(Ctx);
   InvalidatingVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
   doAnalysis();
 
@@ -261,6 +219,33 @@ void ReducePointerPairs::HandleTranslationUnit(ASTContext &Ctx)
     TransError = TransInternalError;
 }
 
+void ReducePointerPairs::collectPairs(ASTContext &Ctx)
+{
+  // Replay the shared sweep's event stream in visitation order; the
+  // decl/assignment interleaving matches the private traversal this
+  // replaces, so pairing keeps its first-wins behavior.
+  const PointerUseIndex::EventVector &Events =
+    PointerUseIndex::GetInstance(Ctx)->getPointerEvents();
+  for (PointerUseIndex::EventVector::const_iterator I = Events.begin(),
+       E = Events.end(); I != E; ++I) {
+    if (const BinaryOperator *BO = (*I).AssignBO) {
+      const VarDecl *VD = getVarDeclFromDRE(BO->getLHS()->IgnoreParenCasts());
+      if (!VD || !isValidVD(VD))
+        continue;
+      handleOnePair(VD, BO->getRHS()->IgnoreParenCasts());
+    }
+    else {
+      const VarDecl *VD = (*I).VD;
+      if (!isValidVD(VD))
+        continue;
+      const Expr *Init = VD->getAnyInitializer();
+      if (!Init)
+        continue;
+      handleOnePair(VD->getCanonicalDecl(), Init->IgnoreParenCasts());
+    }
+  }
+}
+
 void ReducePointerPairs::doAnalysis(void)
 {
   for (PointerMap::iterator I = ValidPointerPairs.begin(),
@@ -370,7 +355,6 @@ bool ReducePointerPairs::invalidatePairedVarDecl(const VarDecl *VD)
 
 ReducePointerPairs::~ReducePointerPairs(void)
 {
-  delete CollectionVisitor;
   delete InvalidatingVisitor;
 }
 
@@ -20,18 +20,15 @@ namespace clang {
   class VarDecl;
 }
 
-class ReducePointerPairsCollectionVisitor;
 class ReducePointerPairsInvalidatingVisitor;
 
 class ReducePointerPairs : public Transformation {
-friend class ReducePointerPairsCollectionVisitor;
 friend class ReducePointerPairsInvalidatingVisitor;
 
 public:
 
   ReducePointerPairs(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       InvalidatingVisitor(NULL),
       TheVarDecl(NULL),
       ThePairedVarDecl(NULL)
@@ -46,8 +43,12 @@ private:
 
   virtual void Initialize(clang::ASTContext &context);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  void collectPairs(clang::ASTContext &Ctx);
+
   void handleOnePair(const clang::VarDecl *VD, const clang::Expr *E);
 
   bool isValidVD(const clang::VarDecl *VD);
@@ -66,8 +67,6 @@ private:
 
   PointerMap ValidPointerPairs;
 
-  ReducePointerPairsCollectionVisitor *CollectionVisitor;
-
   ReducePointerPairsInvalidatingVisitor *InvalidatingVisitor;
 
   const clang::VarDecl *TheVarDecl;
@@ -18,6 +18,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "ArrayUseIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -68,70 +69,58 @@ bool InvalidArraySubscriptExprVisitor::VisitArraySubscriptExpr(
   return true;
 }
 
-class RemoveArrayCollectionVisitor : public 
-  RecursiveASTVisitor<RemoveArrayCollectionVisitor> {
-
-public:
-
-  explicit RemoveArrayCollectionVisitor(RemoveArray *Instance)
-    : ConsumerInstance(Instance),
-      CurrDeclRefExpr(NULL)
-  { }
-
-  bool VisitVarDecl(VarDecl *VD);
-
-  bool VisitArraySubscriptExpr(ArraySubscriptExpr *ASE);
-
-  bool VisitDeclRefExpr(DeclRefExpr *DRE);
-
-private:
-
-  RemoveArray *ConsumerInstance;
-
-  const DeclRefExpr *CurrDeclRefExpr;
-};
-
-bool RemoveArrayCollectionVisitor::VisitVarDecl(VarDecl *VD)
+void RemoveArray::Initialize(ASTContext &context)
 {
-  ConsumerInstance->handleOneVarDecl(VD);
-  return true;
+  Transformation::Initialize(context);
 }
 
-bool RemoveArrayCollectionVisitor::VisitArraySubscriptExpr(
-       ArraySubscriptExpr *ASE)
+void RemoveArray::prepareSharedAnalysis(ASTContext &Ctx)
 {
-  // we only have one-dimension array, so we are safe here.
-  const Expr *BaseE = ASE->getBase()->IgnoreParenCasts();
-  
-  TransAssert(BaseE && "Empty Base expression!");
-  const DeclRefExpr *DRE = dyn_cast<DeclRefExpr>(BaseE);
-  if (!DRE)
-    return true;
-
-  CurrDeclRefExpr = DRE;
-  ConsumerInstance->addOneArraySubscriptExpr(ASE, DRE);
-  return true;
+  // counter-independent: one shared sweep instead of a private traversal
+  ArrayUseIndex::GetInstance(Ctx);
 }
 
-bool RemoveArrayCollectionVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
+void RemoveArray::collectArrayUses(ASTContext &Ctx)
 {
-  if (CurrDeclRefExpr != DRE) 
-    ConsumerInstance->deleteOneVarDecl(DRE);
+  const ArrayUseIndex::EventVector &Events =
+    ArrayUseIndex::GetInstance(Ctx)->getArrayEvents();
+
+  // Replay the shared sweep with this pass's filters.  A declaration
+  // reference that is the base of the immediately preceding subscript
+  // sighting must not count as an invalidating use, so the replay keeps
+  // the same one-sighting lookbehind the private visitor used.
+  const DeclRefExpr *CurrDeclRefExpr = NULL;
+  for (ArrayUseIndex::EventVector::const_iterator I = Events.begin(),
+       E = Events.end(); I != E; ++I) {
+    if ((*I).VD) {
+      handleOneVarDecl((*I).VD);
+      continue;
+    }
 
-  CurrDeclRefExpr = NULL;
-  return true;
-}
+    if (ArraySubscriptExpr *ASE = (*I).ASE) {
+      // we only have one-dimension array, so we are safe here.
+      const Expr *BaseE = ASE->getBase()->IgnoreParenCasts();
 
-void RemoveArray::Initialize(ASTContext &context) 
-{
-  Transformation::Initialize(context);
-  CollectionVisitor = new RemoveArrayCollectionVisitor(this);
+      TransAssert(BaseE && "Empty Base expression!");
+      const DeclRefExpr *DRE = dyn_cast<DeclRefExpr>(BaseE);
+      if (!DRE)
+        continue;
+
+      CurrDeclRefExpr = DRE;
+      addOneArraySubscriptExpr(ASE, DRE);
+      continue;
+    }
+
+    if (CurrDeclRefExpr != (*I).DRE)
+      deleteOneVarDecl((*I).DRE);
+
+    CurrDeclRefExpr = NULL;
+  }
 }
 
 void RemoveArray::HandleTranslationUnit(ASTContext &Ctx)
 {
-  TransAssert(CollectionVisitor && "NULL CollectionVisitor!");
-  CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  collectArrayUses(Ctx);
   doAnalysis();
 
   if (QueryInstanceOnly)
@@ -289,8 +278,6 @@ void RemoveArray::handleOneVarDecl(const VarDecl *VD)
 
 RemoveArray::~RemoveArray(void)
 {
-  delete CollectionVisitor;
-
   for (VarDeclToArraySubscriptExprMap::iterator I = ValidVarToASEMap.begin(),
        E = ValidVarToASEMap.end(); I != E; ++I) {
     ArraySubscriptExprVector *ASEVec = (*I).second;
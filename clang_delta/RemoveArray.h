@@ -23,18 +23,15 @@ namespace clang {
   class DeclRefExpr;
 }
 
-class RemoveArrayCollectionVisitor;
 class InvalidArraySubscriptExprVisitor;
 
 class RemoveArray : public Transformation {
-friend class RemoveArrayCollectionVisitor;
 friend class InvalidArraySubscriptExprVisitor;
 
 public:
 
   RemoveArray(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       TheArrayVarDecl(NULL),
       TheASEVec(NULL)
   { }
@@ -54,8 +51,12 @@ private:
 
   virtual void Initialize(clang::ASTContext &context);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
+  void collectArrayUses(clang::ASTContext &Ctx);
+
   void doAnalysis(void);
 
   void doRewriting(void);
@@ -73,8 +74,6 @@ private:
                           const clang::ArraySubscriptExpr *ASE);
 
   VarDeclToArraySubscriptExprMap ValidVarToASEMap;
-   
-  RemoveArrayCollectionVisitor *CollectionVisitor;
 
   const clang::VarDecl *TheArrayVarDecl;
 
@@ -16,6 +16,7 @@
 
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
+#include "ClassHierarchyIndex.h"
 #include "CommonRenameClassRewriteVisitor.h"
 
 #include "TransformationManager.h"
@@ -33,32 +34,20 @@ static const char *DescriptionMsg =
 static RegisterTransformation<RemoveBaseClass, RemoveBaseClass::EMode>
          Trans("remove-base-class", DescriptionMsg, RemoveBaseClass::EMode::Remove);
 
-class RemoveBaseClassBaseVisitor : public 
-  RecursiveASTVisitor<RemoveBaseClassBaseVisitor> {
-
-public:
-  explicit RemoveBaseClassBaseVisitor(
-             RemoveBaseClass *Instance)
-    : ConsumerInstance(Instance)
-  { }
-
-  bool VisitCXXRecordDecl(CXXRecordDecl *CXXRD);
-
-private:
-  RemoveBaseClass *ConsumerInstance;
-};
-
-bool RemoveBaseClassBaseVisitor::VisitCXXRecordDecl(
-       CXXRecordDecl *CXXRD)
+void RemoveBaseClass::Initialize(ASTContext &context)
 {
-  ConsumerInstance->handleOneCXXRecordDecl(CXXRD);
-  return true;
+  Transformation::Initialize(context);
 }
 
-void RemoveBaseClass::Initialize(ASTContext &context) 
+void RemoveBaseClass::prepareSharedAnalysis(ASTContext &Ctx)
 {
-  Transformation::Initialize(context);
-  CollectionVisitor = new RemoveBaseClassBaseVisitor(this);
+  if (TransformationManager::isCLangOpt() ||
+      TransformationManager::isOpenCLLangOpt())
+    return;
+  // The hierarchy sweep is counter-independent; building the shared
+  // index here lets every forked counter replay the cached visitation
+  // sequence instead of re-traversing the TU.
+  ClassHierarchyIndex::GetInstance(Ctx);
 }
 
 void RemoveBaseClass::HandleTranslationUnit(ASTContext &Ctx)
@@ -68,7 +57,12 @@ void RemoveBaseClass::HandleTranslationUnit(ASTContext &Ctx)
     ValidInstanceNum = 0;
   }
   else {
-    CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    const ClassHierarchyIndex::RecordVector &Records =
+      ClassHierarchyIndex::GetInstance(Ctx)->getVisitedRecords();
+    for (ClassHierarchyIndex::RecordVector::const_iterator
+         I = Records.begin(), E = Records.end(); I != E; ++I) {
+      handleOneCXXRecordDecl(*I);
+    }
   }
 
   if (QueryInstanceOnly)
@@ -279,5 +273,5 @@ void RemoveBaseClass::removeBaseInitializer(void)
 
 RemoveBaseClass::~RemoveBaseClass(void)
 {
-  delete CollectionVisitor;
+  // the shared hierarchy index is owned by its own singleton
 }
@@ -21,10 +21,7 @@ namespace clang {
   class CXXConstructorDecl;
 }
 
-class RemoveBaseClassBaseVisitor;
-
 class RemoveBaseClass : public Transformation {
-friend class RemoveBaseClassBaseVisitor;
 
 public:
   enum class EMode { Remove, Merge };
@@ -35,6 +32,8 @@ public:
   { }
   ~RemoveBaseClass(void);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
 private:
   typedef llvm::SmallPtrSet<const clang::CXXRecordDecl *, 20> CXXRecordDeclSet;
 
@@ -59,8 +58,6 @@ private:
 
   bool isTheBaseClass(const clang::CXXBaseSpecifier &Specifier);
 
-  RemoveBaseClassBaseVisitor *CollectionVisitor = nullptr;
-
   const clang::CXXRecordDecl *TheBaseClass = nullptr;
 
   const clang::CXXRecordDecl *TheDerivedClass = nullptr;
@@ -14,6 +14,8 @@
 
 #include "RemoveNamespace.h"
 
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
@@ -642,15 +644,117 @@ bool RemoveNamespace::HandleTopLevelDecl(DeclGroupRef D)
   return true;
 }
 
+std::string RemoveNamespace::getNameMapCachePath(void)
+{
+  TransformationManager *Manager = TransformationManager::GetInstance();
+  const std::string &CacheDir = Manager->getPreambleCacheDir();
+  if (CacheDir.empty())
+    return "";
+
+  std::string Hash;
+  if (!TransformationManager::getFileContentHash(Manager->getSrcFileName(),
+                                                 Hash))
+    return "";
+
+  std::stringstream PathSS;
+  PathSS << CacheDir << "/" << Hash << "-" << TransformationCounter
+         << ".rmns";
+  return PathSS.str();
+}
+
+bool RemoveNamespace::tryLoadNameMapCache(void)
+{
+  std::string Path = getNameMapCachePath();
+  if (Path.empty())
+    return false;
+
+  std::ifstream CacheFile(Path.c_str());
+  if (!CacheFile.is_open())
+    return false;
+
+  std::string Line;
+  while (std::getline(CacheFile, Line)) {
+    size_t Tab1 = Line.find('\t');
+    if (Tab1 == std::string::npos)
+      return false;
+    size_t Tab2 = Line.find('\t', Tab1 + 1);
+    if (Tab2 == std::string::npos)
+      return false;
+    CachedNames[Line.substr(0, Tab2)] = Line.substr(Tab2 + 1);
+  }
+  NameMapCacheLoaded = true;
+  return true;
+}
+
+void RemoveNamespace::saveNameMapCache(void)
+{
+  std::string Path = getNameMapCachePath();
+  if (Path.empty())
+    return;
+
+  // write-then-rename, so concurrent clang_delta processes sharing the
+  // cache directory never observe a partial file
+  std::stringstream TmpPathSS;
+  TmpPathSS << Path << ".tmp." << static_cast<const void *>(this);
+  std::string TmpPath = TmpPathSS.str();
+  std::ofstream CacheFile(TmpPath.c_str());
+  if (!CacheFile.is_open())
+    return;
+
+  for (NamedDeclToNameMap::const_iterator I = NamedDeclToNewName.begin(),
+       E = NamedDeclToNewName.end(); I != E; ++I) {
+    CacheFile << "n\t" << (*I).first->getQualifiedNameAsString()
+              << "\t" << (*I).second << "\n";
+  }
+  for (NamedDeclToNameMap::const_iterator I = UsingNamedDeclToNewName.begin(),
+       E = UsingNamedDeclToNewName.end(); I != E; ++I) {
+    CacheFile << "u\t" << (*I).first->getQualifiedNameAsString()
+              << "\t" << (*I).second << "\n";
+  }
+  CacheFile.close();
+  if (CacheFile.fail() || (std::rename(TmpPath.c_str(), Path.c_str()) != 0))
+    std::remove(TmpPath.c_str());
+}
+
+bool RemoveNamespace::lookupCachedName(const NamedDecl *ND, const char *Tag,
+                                       std::string &NewName)
+{
+  std::string Key = Tag;
+  Key += "\t";
+  Key += ND->getQualifiedNameAsString();
+  std::map<std::string, std::string>::const_iterator I =
+    CachedNames.find(Key);
+  if (I == CachedNames.end())
+    return false;
+  NewName = (*I).second;
+  return true;
+}
+
+void RemoveNamespace::replayCachedEnumDecl(const EnumDecl *ED,
+                                           NamedDeclToNameMap &NameMap,
+                                           const char *Tag)
+{
+  for (EnumDecl::enumerator_iterator I = ED->enumerator_begin(),
+       E = ED->enumerator_end(); I != E; ++I) {
+    EnumConstantDecl *ECD = (*I);
+    std::string NewName;
+    if (lookupCachedName(ECD, Tag, NewName))
+      NameMap[ECD] = NewName;
+  }
+}
+
 void RemoveNamespace::HandleTranslationUnit(ASTContext &Ctx)
 {
   if (TransformationManager::isCLangOpt()) {
     ValidInstanceNum = 0;
   }
   else {
+    bool Loaded = tryLoadNameMapCache();
     // Invoke CollectionVisitor here because we need full DeclContext
     // to resolve name conflicts. Full ASTs has been built at this point.
     CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    if (!Loaded && TheNamespaceDecl && !QueryInstanceOnly)
+      saveNameMapCache();
   }
 
   if (QueryInstanceOnly)
@@ -766,6 +870,18 @@ void RemoveNamespace::handleOneUsingShadowDecl(const UsingShadowDecl *UD,
                                                const DeclContext *ParentCtx)
 {
   const NamedDecl *ND = UD->getTargetDecl();
+
+  if (NameMapCacheLoaded) {
+    if (const TemplateDecl *TD = dyn_cast<TemplateDecl>(ND))
+      ND = TD->getTemplatedDecl();
+    std::string CachedNewName;
+    if (lookupCachedName(ND, "u", CachedNewName)) {
+      UsingNamedDeclToNewName[ND] = CachedNewName;
+      UselessUsingDecls.insert(dyn_cast<UsingDecl>(UD->getIntroducer()));
+    }
+    return;
+  }
+
   if (!hasNameConflict(ND, ParentCtx))
     return;
 
@@ -838,6 +954,17 @@ void RemoveNamespace::handleOneUsingDirectiveDecl(const UsingDirectiveDecl *UD,
     if (!isValidNamedDeclKind(NamedD))
       continue;
 
+    if (NameMapCacheLoaded) {
+      if (const TemplateDecl *TD = dyn_cast<TemplateDecl>(NamedD))
+        NamedD = TD->getTemplatedDecl();
+      else if (const EnumDecl *ED = dyn_cast<EnumDecl>(NamedD))
+        replayCachedEnumDecl(ED, UsingNamedDeclToNewName, "u");
+      std::string CachedNewName;
+      if (lookupCachedName(NamedD, "u", CachedNewName))
+        UsingNamedDeclToNewName[NamedD] = CachedNewName;
+      continue;
+    }
+
     std::string NewName = "";
     if ( NestedNameSpecifierLoc QualifierLoc = UD->getQualifierLoc() ) {
       RewriteHelper->getQualifierAsString(QualifierLoc, NewName);
@@ -909,6 +1036,19 @@ void RemoveNamespace::handleOneNamedDecl(const NamedDecl *ND,
     if (!isValidNamedDeclKind(ND))
       return;
 
+    // replay the cached decision instead of redoing the name lookup
+    if (NameMapCacheLoaded) {
+      if (const TemplateDecl *TD = dyn_cast<TemplateDecl>(ND))
+        ND = TD->getTemplatedDecl();
+      else if (const EnumDecl *ED = dyn_cast<EnumDecl>(ND))
+        replayCachedEnumDecl(ED, NamedDeclToNewName, "n");
+
+      std::string CachedNewName;
+      if (lookupCachedName(ND, "n", CachedNewName))
+        NamedDeclToNewName[ND] = CachedNewName;
+      return;
+    }
+
     if (!hasNameConflict(ND, ParentCtx))
       return;
 
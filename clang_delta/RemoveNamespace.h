@@ -11,6 +11,7 @@
 #ifndef REMOVE_NAMESPACE_H
 #define REMOVE_NAMESPACE_H
 
+#include <map>
 #include <string>
 #include "Transformation.h"
 #include "llvm/ADT/SmallPtrSet.h"
@@ -46,7 +47,8 @@ public:
       NamePrefix("Trans_NS_"),
       AnonNamePrefix("Trans_Anon_NS"),
       AnonNamespaceCounter(0),
-      isForUsingNamedDecls(false)
+      isForUsingNamedDecls(false),
+      NameMapCacheLoaded(false)
   { }
 
   ~RemoveNamespace(void);
@@ -127,6 +129,24 @@ private:
 
   bool isSuffix(std::string &Name, std::string &SpecifierName);
 
+  // The conflict-avoiding rename map is expensive to build (one name
+  // lookup per decl in the removed namespace), but fully determined by
+  // the input file and the counter.  When --preamble-cache-dir is set
+  // the decisions are serialized there keyed by input hash and counter,
+  // and later probes replay them by qualified name instead of redoing
+  // the lookups.
+  std::string getNameMapCachePath(void);
+
+  bool tryLoadNameMapCache(void);
+
+  void saveNameMapCache(void);
+
+  bool lookupCachedName(const clang::NamedDecl *ND, const char *Tag,
+                        std::string &NewName);
+
+  void replayCachedEnumDecl(const clang::EnumDecl *ED,
+                            NamedDeclToNameMap &NameMap, const char *Tag);
+
   NamespaceDeclSet VisitedND;
 
   UsingDeclSet UselessUsingDecls;
@@ -142,6 +162,9 @@ private:
   // to their new names after TheNamespaceDecl is removed.
   NamedDeclToNameMap UsingNamedDeclToNewName;
 
+  // cached rename decisions keyed by "<tag>\t<qualified-name>"
+  std::map<std::string, std::string> CachedNames;
+
   RemoveNamespaceASTVisitor *CollectionVisitor;
 
   RemoveNamespaceRewriteVisitor *RewriteVisitor;
@@ -163,6 +186,8 @@ private:
   // * another is for NamedDecls belonging to TheNamespaceDecl
   bool isForUsingNamedDecls;
 
+  bool NameMapCacheLoaded;
+
   // Unimplemented
   RemoveNamespace(void);
 
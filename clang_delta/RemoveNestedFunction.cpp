@@ -16,6 +16,7 @@
 
 #include <sstream>
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallVector.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
@@ -33,7 +34,11 @@ variable with the correct type, assgin the return value \
 of the selected nested function to the created variable, \
 and replace the function invocation with this temporary \
 variable. (Note that this transformation is unsound because \
-it changes the semantics of loop executions in some cases. \n";
+it changes the semantics of loop executions in some cases. \
+Counters after the single-call candidates select batch candidates, \
+each flattening the call at one nesting rank in every statement; \
+calls in different statements never overlap, so the batch needs \
+only one parse where flattening chain by chain needed one each. \n";
 
 
 static RegisterTransformation<RemoveNestedFunction>
@@ -115,6 +120,13 @@ bool RNFStatementVisitor::VisitCallExpr(CallExpr *CallE)
     ConsumerInstance->ValidInstanceNum++;
     ConsumerInstance->ValidCallExprs.push_back(CallE);
 
+    RemoveNestedFunction::NestedCallRecord Rec;
+    Rec.FuncDecl = CurrentFuncDecl;
+    Rec.Stmt = CurrentStmt;
+    Rec.CallE = CallE;
+    Rec.NeedParen = NeedParen;
+    ConsumerInstance->ValidCallRecords.push_back(Rec);
+
     if (ConsumerInstance->ValidInstanceNum ==
         ConsumerInstance->TransformationCounter) {
       ConsumerInstance->TheFuncDecl = CurrentFuncDecl;
@@ -156,6 +168,8 @@ bool RemoveNestedFunction::HandleTopLevelDecl(DeclGroupRef D)
 
 void RemoveNestedFunction::HandleTranslationUnit(ASTContext &Ctx)
 {
+  addBatchCandidates();
+
   if (QueryInstanceOnly)
     return;
 
@@ -166,19 +180,90 @@ void RemoveNestedFunction::HandleTranslationUnit(ASTContext &Ctx)
 
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
 
-  TransAssert(TheFuncDecl && "NULL TheFuncDecl!");
-  TransAssert(TheStmt && "NULL TheStmt!");
-  TransAssert(TheCallExpr && "NULL TheCallExpr");
-
   NameQueryWrap->TraverseDecl(Ctx.getTranslationUnitDecl());
 
-  addNewTmpVariable(Ctx);
+  if (TransformationCounter > NumSingleInstances) {
+    doBatchRewrite(Ctx);
+  }
+  else {
+    TransAssert(TheFuncDecl && "NULL TheFuncDecl!");
+    TransAssert(TheStmt && "NULL TheStmt!");
+    TransAssert(TheCallExpr && "NULL TheCallExpr");
+
+    addNewTmpVariable(Ctx);
+  }
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
     TransError = TransInternalError;
 }
 
+void RemoveNestedFunction::addBatchCandidates(void)
+{
+  NumSingleInstances = ValidInstanceNum;
+
+  // Rank the recorded calls within their enclosing statement: the d-th
+  // call of every statement forms group d.  Chains in different
+  // statements are independent, so one candidate can flatten a whole
+  // group at once; a group of one is already a single-call candidate
+  // and gets no extra number.
+  llvm::DenseMap<Stmt *, unsigned int> StmtRank;
+  for (SmallVector<NestedCallRecord, 10>::iterator
+       I = ValidCallRecords.begin(), E = ValidCallRecords.end();
+       I != E; ++I) {
+    unsigned int D = StmtRank[(*I).Stmt]++;
+    if (GroupSizes.size() <= D)
+      GroupSizes.push_back(0);
+    GroupSizes[D]++;
+  }
+
+  for (SmallVector<unsigned int, 10>::iterator I = GroupSizes.begin(),
+       E = GroupSizes.end(); I != E; ++I) {
+    if (*I > 1)
+      ValidInstanceNum++;
+  }
+}
+
+void RemoveNestedFunction::doBatchRewrite(ASTContext &ASTCtx)
+{
+  int GroupCounter = NumSingleInstances;
+  unsigned int TheRank = 0;
+  bool Found = false;
+  for (unsigned int D = 0; D < GroupSizes.size(); ++D) {
+    if (GroupSizes[D] <= 1)
+      continue;
+    GroupCounter++;
+    if (GroupCounter == TransformationCounter) {
+      TheRank = D;
+      Found = true;
+      break;
+    }
+  }
+  TransAssert(Found && "Invalid batch counter!");
+  (void)Found;
+
+  llvm::DenseMap<Stmt *, unsigned int> StmtRank;
+  for (SmallVector<NestedCallRecord, 10>::iterator
+       I = ValidCallRecords.begin(), E = ValidCallRecords.end();
+       I != E; ++I) {
+    if (StmtRank[(*I).Stmt]++ != TheRank)
+      continue;
+    // Calls of the same rank live in different statements and cannot
+    // overlap, but a shared begin location (CXXOperatorCallExpr) can
+    // still collide with the in-place replacement; skip such a member
+    // so the rest of the batch goes through in one rewrite.
+    if (!RewriteHelper->registerEditRange((*I).CallE->getSourceRange()))
+      continue;
+
+    TheFuncDecl = (*I).FuncDecl;
+    TheStmt = (*I).Stmt;
+    TheCallExpr = (*I).CallE;
+    NeedParen = (*I).NeedParen;
+    addNewTmpVariable(ASTCtx);
+    BatchNameOffset++;
+  }
+}
+
 void RemoveNestedFunction::getVarStrForTemplateSpecialization(
        std::string &VarStr,
        const TemplateSpecializationType *TST)
@@ -261,7 +346,10 @@ void RemoveNestedFunction::getNewTmpVariableStr(ASTContext &ASTCtx,
   std::stringstream SS;
   unsigned int NamePostfix = NameQueryWrap->getMaxNamePostfix();
 
-  SS << RewriteHelper->getTmpVarNamePrefix() << (NamePostfix + 1);
+  // BatchNameOffset keeps the members of one batch candidate from all
+  // claiming the same fresh name.
+  SS << RewriteHelper->getTmpVarNamePrefix()
+     << (NamePostfix + 1 + BatchNameOffset);
   VarStr = SS.str();
   setTmpVarName(VarStr);
 
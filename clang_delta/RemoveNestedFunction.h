@@ -46,7 +46,9 @@ public:
       TheStmt(NULL),
       TheCallExpr(NULL),
       TmpVarName(""),
-      NeedParen(false)
+      NeedParen(false),
+      NumSingleInstances(0),
+      BatchNameOffset(0)
   { }
 
   ~RemoveNestedFunction(void);
@@ -83,10 +85,29 @@ private:
 
   void getNewAutoTmpVariable(std::string &VarStr);
 
+  void addBatchCandidates(void);
+
+  void doBatchRewrite(clang::ASTContext &ASTCtx);
+
+  // everything the rewrite needs about one valid instance, recorded at
+  // collection time so batch candidates can replay any subset
+  struct NestedCallRecord {
+    clang::FunctionDecl *FuncDecl;
+    clang::Stmt *Stmt;
+    clang::CallExpr *CallE;
+    bool NeedParen;
+  };
+
   clang::SmallVector<clang::CallExpr *, 5> CallExprQueue;
 
   clang::SmallVector<clang::CallExpr *, 10> ValidCallExprs;
 
+  clang::SmallVector<NestedCallRecord, 10> ValidCallRecords;
+
+  // GroupSizes[d] counts statements with more than d recorded calls;
+  // group d flattens the d-th recorded call of every such statement
+  clang::SmallVector<unsigned int, 10> GroupSizes;
+
   RNFCollectionVisitor *NestedInvocationVisitor;
 
   RNFStatementVisitor *StmtVisitor;
@@ -103,6 +124,12 @@ private:
 
   bool NeedParen;
 
+  int NumSingleInstances;
+
+  // shifts the generated tmp var name, so the members of one batch
+  // candidate get distinct names
+  unsigned int BatchNameOffset;
+
   // Unimplemented
   RemoveNestedFunction(void);
 
@@ -14,10 +14,10 @@
 
 #include "RemovePointer.h"
 
-#include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "PointerUseIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -31,86 +31,28 @@ the definition of this pointer. \n";
 static RegisterTransformation<RemovePointer>
          Trans("remove-pointer", DescriptionMsg);
 
-class RemovePointerCollectionVisitor : public 
-  RecursiveASTVisitor<RemovePointerCollectionVisitor> {
-
-public:
-
-  explicit RemovePointerCollectionVisitor(RemovePointer *Instance)
-    : ConsumerInstance(Instance),
-      CurrDeclRefExpr(NULL)
-  { }
-
-  bool VisitVarDecl(VarDecl *VD);
-
-  bool VisitDeclRefExpr(DeclRefExpr *DRE);
-
-  bool VisitBinaryOperator(BinaryOperator *BO);
-
-private:
-
-  RemovePointer *ConsumerInstance;
-
-  const DeclRefExpr *CurrDeclRefExpr;
-};
-
-bool RemovePointerCollectionVisitor::VisitVarDecl(VarDecl *VD)
+void RemovePointer::Initialize(ASTContext &context)
 {
-  ConsumerInstance->handleOneVarDecl(VD);
-  return true;
-}
-
-bool RemovePointerCollectionVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
-{
-  if (CurrDeclRefExpr != DRE) 
-    ConsumerInstance->invalidateOneVarDecl(DRE);
-
-  CurrDeclRefExpr = NULL;
-  return true;
-}
-
-bool RemovePointerCollectionVisitor::VisitBinaryOperator(BinaryOperator *BO)
-{
-  if (!BO->isComparisonOp())
-    return true;
-
-  const Expr *E = NULL;
-  if (dyn_cast<IntegerLiteral>(BO->getLHS()->IgnoreParenCasts())) {
-    E = BO->getRHS()->IgnoreParenCasts();
-  }
-  else if (dyn_cast<IntegerLiteral>(BO->getRHS()->IgnoreParenCasts())) {
-    E = BO->getLHS()->IgnoreParenCasts();
-  }
-  
-  if (!E)
-    return true;
-
-  const DeclRefExpr *DRE = dyn_cast<DeclRefExpr>(E);
-  if (!DRE)
-    return true;
-
-  const ValueDecl *OrigDecl = DRE->getDecl();
-  const VarDecl *VD = dyn_cast<VarDecl>(OrigDecl);
-  if (!VD || dyn_cast<ParmVarDecl>(VD))
-    return true;
-  
-  if (ConsumerInstance->AllPointerVarDecls.count(VD) && 
-      !(ConsumerInstance->AllInvalidPointerVarDecls.count(VD)))
-    CurrDeclRefExpr = DRE;
-  return true;
+  Transformation::Initialize(context);
 }
 
-void RemovePointer::Initialize(ASTContext &context) 
+void RemovePointer::prepareSharedAnalysis(ASTContext &Ctx)
 {
-  Transformation::Initialize(context);
-  CollectionVisitor = new RemovePointerCollectionVisitor(this);
+  // counter-independent: one shared sweep instead of a private traversal
+  PointerUseIndex::GetInstance(Ctx);
 }
 
 void RemovePointer::HandleTranslationUnit(ASTContext &Ctx)
 {
-  TransAssert(CollectionVisitor && "NULL CollectionVisitor!");
-  CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
-  doAnalysis();
+  const PointerUseIndex *Idx = PointerUseIndex::GetInstance(Ctx);
+  const PointerUseIndex::EventVector &Events = Idx->getPointerEvents();
+  for (PointerUseIndex::EventVector::const_iterator I = Events.begin(),
+       E = Events.end(); I != E; ++I) {
+    if ((*I).AssignBO)
+      continue;
+    handleOneVarDecl((*I).VD);
+  }
+  doAnalysis(Idx);
 
   if (QueryInstanceOnly)
     return;
@@ -130,12 +72,14 @@ void RemovePointer::HandleTranslationUnit(ASTContext &Ctx)
     TransError = TransInternalError;
 }
 
-void RemovePointer::doAnalysis(void)
+void RemovePointer::doAnalysis(const PointerUseIndex *Idx)
 {
   for (VarDeclSetVector::iterator I = AllPointerVarDecls.begin(),
        E = AllPointerVarDecls.end(); I != E; ++I) {
     const VarDecl *VD = (*I);
-    if (AllInvalidPointerVarDecls.count(VD))
+    // A use that is not a tolerated literal comparison invalidates the
+    // pointer; the index classified every use during its single sweep.
+    if (Idx->getNumUses(VD) != Idx->getNumLiteralCompareUses(VD))
       continue;
 
     ValidInstanceNum++;
@@ -149,44 +93,22 @@ void RemovePointer::doRewriting(void)
   const VarDecl *FirstVD = TheVarDecl->getCanonicalDecl();
   for(VarDecl::redecl_iterator RI = FirstVD->redecls_begin(),
       RE = FirstVD->redecls_end(); RI != RE; ++RI) {
-    RewriteHelper->removeAStarBefore(*RI); 
+    RewriteHelper->removeAStarBefore(*RI);
   }
 }
 
-void RemovePointer::invalidateOneVarDecl(const DeclRefExpr *DRE)
-{
-  const ValueDecl *OrigDecl = DRE->getDecl();
-  const VarDecl *VD = dyn_cast<VarDecl>(OrigDecl);
-  if (!VD || dyn_cast<ParmVarDecl>(VD))
-    return;
-
-  const Type *Ty = VD->getType().getTypePtr();
-  if (!Ty->isPointerType())
-    return;
-  const VarDecl *CanonicalVD = VD->getCanonicalDecl();
-  AllInvalidPointerVarDecls.insert(CanonicalVD);
-}
-
 void RemovePointer::handleOneVarDecl(const VarDecl *VD)
 {
   if (isInIncludedFile(VD))
     return;
 
-  if (dyn_cast<ParmVarDecl>(VD))
-    return;
-
   if (VD->getAnyInitializer())
     return;
 
-  const Type *Ty = VD->getType().getTypePtr();
-  if (!Ty->isPointerType())
-    return;
-
   AllPointerVarDecls.insert(VD->getCanonicalDecl());
 }
 
 RemovePointer::~RemovePointer(void)
 {
-  delete CollectionVisitor;
+  // Nothing to do
 }
-
@@ -11,28 +11,22 @@
 #ifndef REMOVE_POINTER_H
 #define REMOVE_POINTER_H
 
-#include <utility>
 #include "Transformation.h"
 #include "llvm/ADT/SetVector.h"
-#include "llvm/ADT/SmallPtrSet.h"
 
 namespace clang {
   class DeclGroupRef;
   class ASTContext;
   class VarDecl;
-  class DeclRefExpr;
 }
 
-class RemovePointerCollectionVisitor;
+class PointerUseIndex;
 
 class RemovePointer : public Transformation {
-friend class RemovePointerCollectionVisitor;
-
 public:
 
   RemovePointer(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       TheVarDecl(NULL)
   { }
 
@@ -40,27 +34,22 @@ public:
 
 private:
 
-  typedef llvm::SmallPtrSet<const clang::VarDecl *, 10> VarDeclSet;
   typedef llvm::SetVector<const clang::VarDecl *> VarDeclSetVector;
 
   virtual void Initialize(clang::ASTContext &context);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
-  void doAnalysis(void);
+  void doAnalysis(const PointerUseIndex *Idx);
 
   void doRewriting(void);
 
   void handleOneVarDecl(const clang::VarDecl *VD);
 
-  void invalidateOneVarDecl(const clang::DeclRefExpr *DRE);
-
   VarDeclSetVector AllPointerVarDecls;
 
-  VarDeclSet AllInvalidPointerVarDecls;
-
-  RemovePointerCollectionVisitor *CollectionVisitor;
-
   const clang::VarDecl *TheVarDecl;
 
   // Unimplemented
@@ -21,6 +21,7 @@
 #include "clang/Basic/SourceManager.h"
 #include "clang/AST/Attr.h"
 
+#include "SymbolIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -167,6 +168,64 @@ bool ReferencedFunctionDeclVisitor::VisitCXXDependentScopeMemberExpr(
   return true;
 }
 
+// Records the function use-edge graph into the shared SymbolIndex: one
+// edge per written reference, keyed by the innermost enclosing function
+// definition (NULL outside any body, which pins the referenced symbol).
+// The cascade candidates consume the reverse counts; see
+// addCascadeCandidates.
+class CallEdgeVisitor : public RecursiveASTVisitor<CallEdgeVisitor> {
+public:
+  CallEdgeVisitor()
+    : CurrentFD(NULL)
+  { }
+
+  bool TraverseDecl(Decl *D) {
+    FunctionDecl *FD = dyn_cast_or_null<FunctionDecl>(D);
+    if (FD && FD->isThisDeclarationADefinition()) {
+      const FunctionDecl *SavedFD = CurrentFD;
+      CurrentFD = FD->getCanonicalDecl();
+      bool R = RecursiveASTVisitor<CallEdgeVisitor>::TraverseDecl(D);
+      CurrentFD = SavedFD;
+      return R;
+    }
+    return RecursiveASTVisitor<CallEdgeVisitor>::TraverseDecl(D);
+  }
+
+  bool VisitDeclRefExpr(DeclRefExpr *DRE) {
+    if (const FunctionDecl *FD = dyn_cast<FunctionDecl>(DRE->getDecl()))
+      SymbolIndex::GetInstance()->recordUseEdge(CurrentFD,
+                                                FD->getCanonicalDecl());
+    return true;
+  }
+
+  bool VisitMemberExpr(MemberExpr *ME) {
+    if (const FunctionDecl *FD = dyn_cast<FunctionDecl>(ME->getMemberDecl()))
+      SymbolIndex::GetInstance()->recordUseEdge(CurrentFD,
+                                                FD->getCanonicalDecl());
+    return true;
+  }
+
+private:
+  const FunctionDecl *CurrentFD;
+};
+// end of CallEdgeVisitor
+
+// Seeds the SymbolIndex name filter with the identifier of every
+// function declaration in the TU, included files too -- the lookups the
+// filter guards can resolve into headers.  This sweep touches no bodies
+// and must run before the first reference sweep: the filter only gives
+// correct definite-negatives once every declared name is recorded.
+class FunctionNameSweepVisitor : public
+        RecursiveASTVisitor<FunctionNameSweepVisitor> {
+public:
+  bool VisitFunctionDecl(FunctionDecl *FD) {
+    if (const IdentifierInfo *II = FD->getDeclName().getAsIdentifierInfo())
+      SymbolIndex::GetInstance()->recordFunctionName(II);
+    return true;
+  }
+};
+// end of FunctionNameSweepVisitor
+
 } // end of anon namespace
 
 class ExtraReferenceVisitorWrapper : public
@@ -275,13 +334,22 @@ void RemoveUnusedFunction::Initialize(ASTContext &context)
 
 void RemoveUnusedFunction::HandleTranslationUnit(ASTContext &Ctx)
 {
-  VisitorWrapper->TraverseDecl(Ctx.getTranslationUnitDecl());
-  // visit using decls declared outsided function-scope
-  UsingDeclVisitor Visitor(NULL, this);
-  Visitor.TraverseDecl(Ctx.getTranslationUnitDecl());
-  SpecializationVisitor SpecVisitor(this);
-  SpecVisitor.TraverseDecl(Ctx.getTranslationUnitDecl());
-  AnalysisVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  if (AnalyzedContext != &Ctx) {
+    AnalyzedContext = &Ctx;
+    SymbolIndex::GetInstance()->startBuild(&Ctx);
+    FunctionNameSweepVisitor NameSweep;
+    NameSweep.TraverseDecl(Ctx.getTranslationUnitDecl());
+    VisitorWrapper->TraverseDecl(Ctx.getTranslationUnitDecl());
+    // visit using decls declared outsided function-scope
+    UsingDeclVisitor Visitor(NULL, this);
+    Visitor.TraverseDecl(Ctx.getTranslationUnitDecl());
+    SpecializationVisitor SpecVisitor(this);
+    SpecVisitor.TraverseDecl(Ctx.getTranslationUnitDecl());
+    CallEdgeVisitor EdgeVisitor;
+    EdgeVisitor.TraverseDecl(Ctx.getTranslationUnitDecl());
+    AnalysisVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    addCascadeCandidates();
+  }
 
   if (QueryInstanceOnly)
     return;
@@ -320,7 +388,11 @@ void RemoveUnusedFunction::doRewriting()
     // add FD under removal first in order to avoid recursion, e.g.
     // void foo() { using ::foo; }
     RemovedFDs.insert(TheFunctionDecl);
+    for (unsigned I = 0; I < TheCascadeFDs.size(); ++I)
+      RemovedFDs.insert(TheCascadeFDs[I]);
     removeOneFunctionDeclGroup(TheFunctionDecl);
+    for (unsigned I = 0; I < TheCascadeFDs.size(); ++I)
+      removeOneFunctionDeclGroup(TheCascadeFDs[I]);
     return;
   }
 
@@ -503,9 +575,14 @@ void RemoveUnusedFunction::removeOneFunctionDecl(const FunctionDecl *FD)
     }
 
     LocEnd = getFunctionLocEnd(FuncLocStart, LocEnd, FD);
+    SourceRange RemoveRange(FuncLocStart, LocEnd);
+    // registering the range generalizes the FDGroupLocations workaround
+    // above: any redeclaration whose text overlaps an already-removed
+    // range is skipped before the Rewriter is touched
     if (SrcManager->isWrittenInMainFile(FuncLocStart) &&
-        SrcManager->isWrittenInMainFile(LocEnd))
-      TheRewriter.RemoveText(SourceRange(FuncLocStart, LocEnd));
+        SrcManager->isWrittenInMainFile(LocEnd) &&
+        RewriteHelper->registerEditRange(RemoveRange))
+      TheRewriter.RemoveText(RemoveRange);
     return;
   }
 
@@ -516,7 +593,9 @@ void RemoveUnusedFunction::removeOneFunctionDecl(const FunctionDecl *FD)
     if (FuncLocStart.isInvalid())
       return;
     LocEnd = getFunctionLocEnd(FuncLocStart, LocEnd, FD);
-    TheRewriter.RemoveText(SourceRange(FuncLocStart, LocEnd));
+    SourceRange RemoveRange(FuncLocStart, LocEnd);
+    if (RewriteHelper->registerEditRange(RemoveRange))
+      TheRewriter.RemoveText(RemoveRange);
     return;
   }
   // cases like:
@@ -526,7 +605,9 @@ void RemoveUnusedFunction::removeOneFunctionDecl(const FunctionDecl *FD)
     SourceLocation FuncLocStart = getFunctionOuterLocStart(FD);
     if (FuncLocStart.isInvalid())
       return;
-    TheRewriter.RemoveText(SourceRange(FuncLocStart, LocEnd));
+    SourceRange RemoveRange(FuncLocStart, LocEnd);
+    if (RewriteHelper->registerEditRange(RemoveRange))
+      TheRewriter.RemoveText(RemoveRange);
     return;
   }
   // cases like:
@@ -536,7 +617,9 @@ void RemoveUnusedFunction::removeOneFunctionDecl(const FunctionDecl *FD)
   if (LocStart.isMacroID())
     LocStart = SrcManager->getExpansionLoc(LocStart);
   LocStart = getExtensionLocStart(LocStart);
-  TheRewriter.RemoveText(SourceRange(LocStart, LocEnd));
+  SourceRange RemoveRange(LocStart, LocEnd);
+  if (RewriteHelper->registerEditRange(RemoveRange))
+    TheRewriter.RemoveText(RemoveRange);
 }
 
 void RemoveUnusedFunction::removeOneExplicitInstantiation(
@@ -752,9 +835,25 @@ RemoveUnusedFunction::lookupFunctionDeclShallow(const DeclarationName &DName,
   return NULL;
 }
 
+// Definite-negative pre-check for the name lookups: false only when the
+// filter proves no function declaration anywhere in the TU spells this
+// identifier, so the DeclContext walk cannot find one either.  Operator
+// and other special names are not covered and always take the lookup.
+bool RemoveUnusedFunction::nameMayResolveToFunction(
+       const DeclarationName &DName)
+{
+  const IdentifierInfo *II = DName.getAsIdentifierInfo();
+  if (!II)
+    return true;
+  return SymbolIndex::GetInstance()->mayBeFunctionName(II);
+}
+
 const FunctionDecl *RemoveUnusedFunction::getFunctionDeclFromSpecifier(
         const DeclarationName &Name, const NestedNameSpecifier *NNS)
 {
+  if (!nameMayResolveToFunction(Name))
+    return NULL;
+
   std::unordered_set<const DeclContext *> seenDeclarations;
   const FunctionDecl *FD = NULL;
   switch (NNS->getKind()) {
@@ -821,6 +920,8 @@ void RemoveUnusedFunction::handleOneCXXDependentScopeMemberExpr(
   if ((K != DeclarationName::CXXOperatorName) &&
       (K != DeclarationName::Identifier))
     return;
+  if (!nameMayResolveToFunction(DName))
+    return;
   const Expr *Base = E->getBase()->IgnoreParenCasts();
   const FunctionDecl *FD = NULL;
   if (dyn_cast<CXXThisExpr>(Base)) {
@@ -845,6 +946,8 @@ void RemoveUnusedFunction::handleOneUnresolvedLookupExpr(
   if ((K != DeclarationName::CXXOperatorName) &&
       (K != DeclarationName::Identifier))
     return;
+  if (!nameMayResolveToFunction(DName))
+    return;
   const NestedNameSpecifier *NNS = E->getQualifier();
   // we fail only if UE is invoked with some qualifier or
   // instantiation, e.g.:
@@ -1005,20 +1108,108 @@ void RemoveUnusedFunction::handleOneCXXOperatorCallExpr(
 
 void RemoveUnusedFunction::addOneFunctionDecl(const FunctionDecl *CanonicalFD)
 {
+  SymbolIndex::GetInstance()->recordFunctionDef(CanonicalFD);
   ValidInstanceNum++;
-  if (ToCounter > 0) {
-    AllValidFunctionDecls.push_back(CanonicalFD);
-    return;
+  if (needsInstanceRanges()) {
+    // removing this instance touches every redeclaration
+    for (const FunctionDecl *FD : CanonicalFD->redecls())
+      recordInstanceRange(ValidInstanceNum, FD->getSourceRange());
   }
+  // the cascade candidates index this list even outside range mode
+  AllValidFunctionDecls.push_back(CanonicalFD);
+  if (ToCounter > 0)
+    return;
   if (ValidInstanceNum == TransformationCounter) {
     TheFunctionDecl = CanonicalFD;
   }
 }
 
+// Cascade candidates.  Removing an unused function often strands its
+// callees, but the census only discovers them on the next parse, so a
+// chain of N helpers costs N parse-and-test cycles.  The use-edge graph
+// recorded by CallEdgeVisitor makes the chain computable up front: from
+// each per-function instance, follow the removed bodies' edges and
+// collect the functions whose every recorded use disappears with the
+// removal set.  Each non-empty chain becomes one combined instance,
+// appended after all the per-function instances so existing counters
+// keep their meaning.  Range mode indexes the per-function list
+// directly and skips the extras.
+void RemoveUnusedFunction::addCascadeCandidates()
+{
+  if (ToCounter > 0)
+    return;
+
+  SymbolIndex *Index = SymbolIndex::GetInstance();
+  for (unsigned I = 0; I < AllValidFunctionDecls.size(); ++I) {
+    const FunctionDecl *Root = AllValidFunctionDecls[I];
+    llvm::SmallVector<const FunctionDecl *, 8> Cascade;
+    llvm::SmallPtrSet<const FunctionDecl *, 8> InRemovalSet;
+    llvm::DenseMap<const FunctionDecl *, unsigned> DroppedUses;
+
+    InRemovalSet.insert(Root);
+    const FunctionDecl *CurrentFD = Root;
+    unsigned NextIdx = 0;
+    while (true) {
+      if (const SymbolIndex::EdgeVector *Edges =
+          Index->getUseEdges(CurrentFD)) {
+        for (unsigned J = 0; J < Edges->size(); ++J) {
+          const FunctionDecl *Callee = (*Edges)[J];
+          if (InRemovalSet.count(Callee))
+            continue;
+          unsigned &Dropped = DroppedUses[Callee];
+          Dropped++;
+          if (Dropped < Index->getNumEdgeUses(Callee))
+            continue;
+          if (!isCascadeRemovable(Callee))
+            continue;
+          Cascade.push_back(Callee);
+          InRemovalSet.insert(Callee);
+        }
+      }
+      if (NextIdx >= Cascade.size())
+        break;
+      CurrentFD = Cascade[NextIdx++];
+    }
+
+    if (Cascade.empty())
+      continue;
+
+    ValidInstanceNum++;
+    if (needsInstanceRanges()) {
+      for (const FunctionDecl *FD : Root->redecls())
+        recordInstanceRange(ValidInstanceNum, FD->getSourceRange());
+      for (unsigned J = 0; J < Cascade.size(); ++J)
+        for (const FunctionDecl *FD : Cascade[J]->redecls())
+          recordInstanceRange(ValidInstanceNum, FD->getSourceRange());
+    }
+    if (ValidInstanceNum == TransformationCounter) {
+      TheFunctionDecl = Root;
+      TheCascadeFDs = Cascade;
+    }
+  }
+}
+
+bool RemoveUnusedFunction::isCascadeRemovable(const FunctionDecl *FD)
+{
+  // The census skipped FD because something references it; the caller
+  // has already established that every recorded use sits inside the
+  // removal set, so only re-check the guards that are independent of
+  // being referenced.  Templates and specializations keep their
+  // per-kind bookkeeping and stay out of cascades.
+  return !isInIncludedFile(FD) &&
+         !FD->isMain() &&
+         !FD->hasAttr<OpenCLKernelAttr>() &&
+         (FD->getTemplatedKind() == FunctionDecl::TK_NonTemplate) &&
+         !isInlinedSystemFunction(FD) &&
+         hasAtLeastOneValidLocation(FD);
+}
+
 void RemoveUnusedFunction::addOneReferencedFunction(
        const FunctionDecl *FD)
 {
-  ReferencedFDs.insert(FD->getCanonicalDecl());
+  const FunctionDecl *CanonicalFD = FD->getCanonicalDecl();
+  SymbolIndex::GetInstance()->recordFunctionUse(CanonicalFD);
+  ReferencedFDs.insert(CanonicalFD);
 }
 
 const FunctionTemplateDecl *RemoveUnusedFunction::getTopDescribedTemplate(
@@ -12,12 +12,12 @@
 #define REMOVE_UNUSED_FUNCTION_H
 
 #include <string>
-#include <map>
-#include <set>
 #include <unordered_set>
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallSet.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
 #include "Transformation.h"
 #include "clang/Basic/SourceLocation.h"
 
@@ -49,7 +49,8 @@ public:
     : Transformation(TransName, Desc, /*MultipleRewrites*/true),
       AnalysisVisitor(NULL),
       VisitorWrapper(NULL),
-      TheFunctionDecl(NULL)
+      TheFunctionDecl(NULL),
+      AnalyzedContext(NULL)
   { }
 
   ~RemoveUnusedFunction();
@@ -95,10 +96,10 @@ private:
   typedef llvm::SmallPtrSet<const clang::UsingDecl *, 32>
             UsingDeclsSet;
   
-  typedef std::map<std::string, std::string>
+  typedef llvm::StringMap<std::string>
             InlinedSystemFunctionsMap;
 
-  typedef std::set<std::string> SystemFunctionsSet;
+  typedef llvm::StringSet<> SystemFunctionsSet;
 
   typedef llvm::SmallSet<clang::SourceLocation, 5> LocSet;
 
@@ -110,6 +111,10 @@ private:
 
   void doRewriting();
 
+  void addCascadeCandidates();
+
+  bool isCascadeRemovable(const clang::FunctionDecl *FD);
+
   bool hasReferencedSpecialization(const clang::FunctionDecl *FD);
 
   clang::SourceLocation getExtensionLocStart(clang::SourceLocation Loc);
@@ -140,6 +145,8 @@ private:
 
   void addFuncToExplicitSpecs(const clang::FunctionDecl *FD);
 
+  bool nameMayResolveToFunction(const clang::DeclarationName &DName);
+
   const clang::FunctionDecl *lookupFunctionDeclShallow(
           const clang::DeclarationName &DName,
           const clang::DeclContext *Ctx,
@@ -205,6 +212,17 @@ private:
 
   const clang::FunctionDecl *TheFunctionDecl;
 
+  // the rest of the removal set when a cascade instance is selected;
+  // empty for a per-function instance
+  llvm::SmallVector<const clang::FunctionDecl *, 8> TheCascadeFDs;
+
+  // The ASTContext the analysis traversals last ran over.  The analysis
+  // results live in the member sets above and in the SymbolIndex, so a
+  // repeated invocation against the same context (e.g. a server process
+  // applying several counters) can reuse them instead of walking the
+  // whole TU four more times.
+  const clang::ASTContext *AnalyzedContext;
+
   // Unimplemented
   RemoveUnusedFunction();
 
@@ -19,6 +19,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Lex/Lexer.h"
 
+#include "ClassHierarchyIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -33,50 +34,19 @@ static const char *DescriptionMsg =
 static RegisterTransformation<RemoveUnusedOuterClass>
          Trans("remove-unused-outer-class", DescriptionMsg);
 
-class RemoveUnusedOuterClassVisitor : public 
-  RecursiveASTVisitor<RemoveUnusedOuterClassVisitor> {
-
-public:
-  explicit RemoveUnusedOuterClassVisitor(
-             RemoveUnusedOuterClass *Instance)
-    : ConsumerInstance(Instance)
-  { }
-
-  bool VisitCXXRecordDecl(CXXRecordDecl *CXXRD);
-
-  bool VisitRecordTypeLoc(RecordTypeLoc TLoc);
-
-private:
-  RemoveUnusedOuterClass *ConsumerInstance;
-};
-
-bool RemoveUnusedOuterClassVisitor::VisitRecordTypeLoc(RecordTypeLoc TLoc)
-{
-  const CXXRecordDecl *RD = dyn_cast<CXXRecordDecl>(TLoc.getDecl());
-  ConsumerInstance->UsedCXXRDSet.insert(RD->getCanonicalDecl());
-  return true;
-}
-
-bool RemoveUnusedOuterClassVisitor::VisitCXXRecordDecl(
-       CXXRecordDecl *CXXRD)
+void RemoveUnusedOuterClass::Initialize(ASTContext &context)
 {
-  if (ConsumerInstance->isInIncludedFile(CXXRD) ||
-      ConsumerInstance->isSpecialRecordDecl(CXXRD) ||
-      !CXXRD->hasDefinition() ||
-      dyn_cast<ClassTemplateSpecializationDecl>(CXXRD) ||
-      CXXRD->hasUserDeclaredConstructor() ||
-      CXXRD->hasUserDeclaredDestructor() ||
-      CXXRD->getDescribedClassTemplate() || 
-      CXXRD->getNumBases())
-    return true;
-  ConsumerInstance->CXXRDDefSet.insert(CXXRD->getDefinition());
-  return true;
+  Transformation::Initialize(context);
 }
 
-void RemoveUnusedOuterClass::Initialize(ASTContext &context) 
+void RemoveUnusedOuterClass::prepareSharedAnalysis(ASTContext &Ctx)
 {
-  Transformation::Initialize(context);
-  CollectionVisitor = new RemoveUnusedOuterClassVisitor(this);
+  if (TransformationManager::isCLangOpt() ||
+      TransformationManager::isOpenCLLangOpt())
+    return;
+  // The index carries both halves of the old collection visitor: the
+  // visited record sequence and the referenced-class set.
+  ClassHierarchyIndex::GetInstance(Ctx);
 }
 
 void RemoveUnusedOuterClass::HandleTranslationUnit(ASTContext &Ctx)
@@ -86,8 +56,24 @@ void RemoveUnusedOuterClass::HandleTranslationUnit(ASTContext &Ctx)
     ValidInstanceNum = 0;
   }
   else {
-    CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
-    analyzeCXXRDSet();
+    const ClassHierarchyIndex *Index = ClassHierarchyIndex::GetInstance(Ctx);
+    const ClassHierarchyIndex::RecordVector &Records =
+      Index->getVisitedRecords();
+    for (ClassHierarchyIndex::RecordVector::const_iterator
+         I = Records.begin(), E = Records.end(); I != E; ++I) {
+      CXXRecordDecl *CXXRD = (*I);
+      if (isInIncludedFile(CXXRD) ||
+          isSpecialRecordDecl(CXXRD) ||
+          !CXXRD->hasDefinition() ||
+          dyn_cast<ClassTemplateSpecializationDecl>(CXXRD) ||
+          CXXRD->hasUserDeclaredConstructor() ||
+          CXXRD->hasUserDeclaredDestructor() ||
+          CXXRD->getDescribedClassTemplate() ||
+          CXXRD->getNumBases())
+        continue;
+      CXXRDDefSet.insert(CXXRD->getDefinition());
+    }
+    analyzeCXXRDSet(Index);
   }
 
   if (QueryInstanceOnly)
@@ -106,12 +92,12 @@ void RemoveUnusedOuterClass::HandleTranslationUnit(ASTContext &Ctx)
     TransError = TransInternalError;
 }
 
-void RemoveUnusedOuterClass::analyzeCXXRDSet()
+void RemoveUnusedOuterClass::analyzeCXXRDSet(const ClassHierarchyIndex *Index)
 {
-  for (CXXRecordDeclSetVector::iterator I = CXXRDDefSet.begin(), 
+  for (CXXRecordDeclSetVector::iterator I = CXXRDDefSet.begin(),
        E = CXXRDDefSet.end(); I != E; ++I) {
     const CXXRecordDecl *Def = (*I);
-    if (UsedCXXRDSet.count(Def->getCanonicalDecl()))
+    if (Index->isReferenced(Def->getCanonicalDecl()))
       continue;
     ValidInstanceNum++;
     if (ValidInstanceNum == TransformationCounter)
@@ -149,6 +135,6 @@ void RemoveUnusedOuterClass::removeOuterClass()
 
 RemoveUnusedOuterClass::~RemoveUnusedOuterClass(void)
 {
-  delete CollectionVisitor;
+  // the shared hierarchy index outlives individual passes
 }
 
@@ -12,7 +12,6 @@
 #define REMOVE_UNUSED_OUTER_CLASS_H
 
 #include "llvm/ADT/SetVector.h"
-#include "llvm/ADT/SmallPtrSet.h"
 #include "Transformation.h"
 
 namespace clang {
@@ -21,38 +20,33 @@ namespace clang {
   class CXXRecordDecl;
 }
 
-class RemoveUnusedOuterClassVisitor;
+class ClassHierarchyIndex;
 
 class RemoveUnusedOuterClass : public Transformation {
-friend class RemoveUnusedOuterClassVisitor;
 
 public:
   RemoveUnusedOuterClass(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       TheCXXRDDef(NULL)
   { }
 
   ~RemoveUnusedOuterClass(void);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
 private:
-  typedef llvm::SmallPtrSet<const clang::CXXRecordDecl *, 10> CXXRecordDeclSet;
   typedef llvm::SetVector<const clang::CXXRecordDecl *> CXXRecordDeclSetVector;
 
   virtual void Initialize(clang::ASTContext &context);
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
 
-  void analyzeCXXRDSet();
+  void analyzeCXXRDSet(const ClassHierarchyIndex *Index);
 
   void removeOuterClass();
 
-  CXXRecordDeclSet UsedCXXRDSet;
-
   CXXRecordDeclSetVector CXXRDDefSet;
 
-  RemoveUnusedOuterClassVisitor *CollectionVisitor;
-
   const clang::CXXRecordDecl *TheCXXRDDef;
 
   // Unimplemented
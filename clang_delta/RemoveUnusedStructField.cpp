@@ -18,6 +18,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "RecordIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -26,7 +27,9 @@ static const char *DescriptionMsg =
 "Remove unreferenced struct fields. This pass also removes the corresponding \
 intialization expression for a variable declared as the struct under \
 transformation. Currenttly this pass doesn't handle nested struct \
-definition well. \n";
+definition well. Counters after the single-field candidates select batch \
+candidates: one per struct with multiple dead fields, and a final one \
+removing every dead field in the translation unit. \n";
 
 static RegisterTransformation<RemoveUnusedStructField>
          Trans("remove-unused-field", DescriptionMsg);
@@ -77,11 +80,15 @@ bool RemoveUnusedStructFieldVisitor::VisitFieldDecl(FieldDecl *FD)
     return true;
 
   ConsumerInstance->ValidInstanceNum++;
-  if (ConsumerInstance->ValidInstanceNum == 
+  if (ConsumerInstance->ValidInstanceNum ==
       ConsumerInstance->TransformationCounter) {
     ConsumerInstance->setBaseLine(RD, FD);
   }
 
+  if (!ConsumerInstance->RecordToDeadFields.count(RD))
+    ConsumerInstance->DeadRecordKeys.push_back(RD);
+  ConsumerInstance->RecordToDeadFields[RD].push_back(FD);
+
   return true;
 }
 
@@ -132,6 +139,7 @@ void RemoveUnusedStructField::Initialize(ASTContext &context)
 void RemoveUnusedStructField::HandleTranslationUnit(ASTContext &Ctx)
 {
   CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  addBatchCandidates();
 
   if (QueryInstanceOnly)
     return;
@@ -143,11 +151,16 @@ void RemoveUnusedStructField::HandleTranslationUnit(ASTContext &Ctx)
 
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
 
-  TransAssert(TheRecordDecl && "NULL TheRecordDecl!");
-  TransAssert(TheFieldDecl && "NULL TheFunctionDecl!");
-  
-  RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
-  removeFieldDecl();
+  if (TransformationCounter > NumSingleInstances) {
+    doBatchRewrite();
+  }
+  else {
+    TransAssert(TheRecordDecl && "NULL TheRecordDecl!");
+    TransAssert(TheFieldDecl && "NULL TheFunctionDecl!");
+
+    runRewriteSweep();
+    removeFieldDecl();
+  }
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
@@ -175,7 +188,112 @@ void RemoveUnusedStructField::setBaseLine(const RecordDecl *RD,
     NumFields++;
   }
 }
-  
+
+void RemoveUnusedStructField::addBatchCandidates(void)
+{
+  NumSingleInstances = ValidInstanceNum;
+
+  unsigned int TotalDeadFields = 0;
+  for (llvm::SmallVector<const RecordDecl *, 10>::iterator
+       I = DeadRecordKeys.begin(), E = DeadRecordKeys.end(); I != E; ++I) {
+    FieldDeclVector &Fields = RecordToDeadFields[*I];
+    TotalDeadFields += Fields.size();
+    if (Fields.size() > 1)
+      ValidInstanceNum++;
+  }
+
+  // The all-fields candidate is only worth a number when it covers more
+  // than any single per-struct group does.
+  if ((DeadRecordKeys.size() > 1) && (TotalDeadFields > 1))
+    ValidInstanceNum++;
+}
+
+void RemoveUnusedStructField::setBatchFields(void)
+{
+  int GroupCounter = NumSingleInstances;
+  for (llvm::SmallVector<const RecordDecl *, 10>::iterator
+       I = DeadRecordKeys.begin(), E = DeadRecordKeys.end(); I != E; ++I) {
+    FieldDeclVector &Fields = RecordToDeadFields[*I];
+    if (Fields.size() <= 1)
+      continue;
+    GroupCounter++;
+    if (GroupCounter == TransformationCounter) {
+      TheBatchFields = Fields;
+      return;
+    }
+  }
+
+  // The last candidate removes every dead field in the translation unit.
+  for (llvm::SmallVector<const RecordDecl *, 10>::iterator
+       I = DeadRecordKeys.begin(), E = DeadRecordKeys.end(); I != E; ++I) {
+    FieldDeclVector &Fields = RecordToDeadFields[*I];
+    TheBatchFields.append(Fields.begin(), Fields.end());
+  }
+}
+
+void RemoveUnusedStructField::doBatchRewrite(void)
+{
+  setBatchFields();
+  TransAssert(TheBatchFields.size() && "Empty batch field set!");
+
+  for (FieldDeclVector::iterator I = TheBatchFields.begin(),
+       E = TheBatchFields.end(); I != E; ++I) {
+    removeOneBatchField(*I);
+  }
+}
+
+bool RemoveUnusedStructField::removeOneBatchField(const FieldDecl *FD)
+{
+  SourceRange Range = FD->getSourceRange();
+  SourceLocation EndLoc = RewriteHelper->getEndLocationUntil(Range, ';');
+  if (EndLoc.isInvalid())
+    EndLoc = Range.getBegin();
+  // Fields sharing a declarator produce overlapping removal ranges.
+  // Skip the conflicting field so the rest of the batch still goes
+  // through in one rewrite.
+  if (!RewriteHelper->registerEditRange(SourceRange(Range.getBegin(), EndLoc)))
+    return false;
+
+  resetFieldAnalysisState();
+  setBaseLine(FD->getParent(), FD);
+  runRewriteSweep();
+  removeFieldDecl();
+  return true;
+}
+
+void RemoveUnusedStructField::runRewriteSweep(void)
+{
+  // The rewrite only looks at record declarations and variable
+  // declarations, so replay those from the shared per-parse node stream
+  // instead of re-traversing the whole translation unit; the batch
+  // candidates run one sweep per dead field, which used to be one full
+  // traversal each.
+  RecordIndex *RI = RecordIndex::GetInstance();
+  RI->ensureBuilt(Context);
+  const RecordIndex::NodeVector &Nodes = RI->getNodes();
+  for (RecordIndex::NodeVector::const_iterator I = Nodes.begin(),
+       E = Nodes.end(); I != E; ++I) {
+    if ((*I).Kind == RecordIndex::NK_RecordDecl)
+      RewriteVisitor->VisitRecordDecl((*I).RD);
+    else if ((*I).Kind == RecordIndex::NK_VarDecl)
+      RewriteVisitor->VisitVarDecl((*I).VD);
+  }
+}
+
+void RemoveUnusedStructField::resetFieldAnalysisState(void)
+{
+  for (RecordDeclToFieldIdxVectorMap::iterator I = RecordDeclToField.begin(),
+       E = RecordDeclToField.end(); I != E; ++I) {
+    delete (*I).second;
+  }
+  RecordDeclToField.clear();
+  FieldToIdxVector.clear();
+  TheRecordDecl = NULL;
+  TheFieldDecl = NULL;
+  NumFields = 0;
+  IsFirstField = false;
+}
+
 void RemoveUnusedStructField::handleOneRecordDecl(const RecordDecl *RD,
                                                   const RecordDecl *BaseRD,
                                                   const FieldDecl *FD,
@@ -377,13 +495,17 @@ void RemoveUnusedStructField::removeOneInitExpr(const Expr *E)
       RewriteHelper->getEndLocationUntil(ExpRange, '}');
     NewEndLoc = NewEndLoc.getLocWithOffset(-1);
 
-    TheRewriter.RemoveText(SourceRange(StartLoc, NewEndLoc));
+    SourceRange RemoveRange(StartLoc, NewEndLoc);
+    if (RewriteHelper->registerEditRange(RemoveRange))
+      TheRewriter.RemoveText(RemoveRange);
 
     return;
   }
   else if (IsFirstField) {
     EndLoc = RewriteHelper->getEndLocationUntil(ExpRange, ',');
-    TheRewriter.RemoveText(SourceRange(StartLoc, EndLoc));
+    SourceRange RemoveRange(StartLoc, EndLoc);
+    if (RewriteHelper->registerEditRange(RemoveRange))
+      TheRewriter.RemoveText(RemoveRange);
     return;
   }
 
@@ -394,7 +516,12 @@ void RemoveUnusedStructField::removeOneInitExpr(const Expr *E)
     Offset--;
   }
   StartLoc = StartLoc.getLocWithOffset(Offset);
-  TheRewriter.RemoveText(SourceRange(StartLoc, EndLoc));
+  // In batch mode, initializers of adjacent dead fields can share a
+  // separator comma. Skip the overlapping removal and let the field
+  // removal stand; the test case decides whether the result survives.
+  SourceRange RemoveRange(StartLoc, EndLoc);
+  if (RewriteHelper->registerEditRange(RemoveRange))
+    TheRewriter.RemoveText(RemoveRange);
 }
 
 const RecordDecl *RemoveUnusedStructField::getBaseRecordDef(const Type *Ty)
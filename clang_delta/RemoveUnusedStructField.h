@@ -39,7 +39,8 @@ public:
       TheRecordDecl(NULL),
       TheFieldDecl(NULL),
       NumFields(0),
-      IsFirstField(false)
+      IsFirstField(false),
+      NumSingleInstances(0)
   { }
 
   ~RemoveUnusedStructField(void);
@@ -52,6 +53,11 @@ private:
   typedef llvm::DenseMap<const clang::FieldDecl *, IndexVector *>
     FieldDeclToIdxVectorMap;
 
+  typedef llvm::SmallVector<const clang::FieldDecl *, 10> FieldDeclVector;
+
+  typedef llvm::DenseMap<const clang::RecordDecl *, FieldDeclVector>
+    RecordDeclToDeadFieldsMap;
+
   virtual void Initialize(clang::ASTContext &context);
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
@@ -79,6 +85,24 @@ private:
 
   void removeFieldDecl(void);
 
+  // Append the batch candidates: one group candidate per struct with more
+  // than one dead field, then one candidate covering every dead field in
+  // the translation unit. They are numbered after all single-field
+  // candidates, so existing counters are unchanged.
+  void addBatchCandidates(void);
+
+  void setBatchFields(void);
+
+  void doBatchRewrite(void);
+
+  bool removeOneBatchField(const clang::FieldDecl *FD);
+
+  void resetFieldAnalysisState(void);
+
+  // Replay the record/variable declarations from the shared RecordIndex
+  // node stream through RewriteVisitor.
+  void runRewriteSweep(void);
+
   RecordDeclToFieldIdxVectorMap RecordDeclToField;
 
   FieldDeclToIdxVectorMap FieldToIdxVector;
@@ -95,6 +119,14 @@ private:
 
   bool IsFirstField;
 
+  int NumSingleInstances;
+
+  llvm::SmallVector<const clang::RecordDecl *, 10> DeadRecordKeys;
+
+  RecordDeclToDeadFieldsMap RecordToDeadFields;
+
+  FieldDeclVector TheBatchFields;
+
   // Unimplemented
   RemoveUnusedStructField(void);
 
@@ -24,7 +24,11 @@
 using namespace clang;
 
 static const char *DescriptionMsg =
-"Remove unused local/global variable declarations. \n";
+"Remove unused local/global variable declarations. When more than one \
+variable is removable, one extra candidate (numbered after all \
+single-variable candidates) deletes the entire closed set of dead \
+variables in a single rewrite, including variables that are referenced \
+only from the initializers of other dead variables. \n";
 
 static RegisterTransformation<RemoveUnusedVar>
          Trans("remove-unused-var", DescriptionMsg);
@@ -34,11 +38,16 @@ class RemoveUnusedVarAnalysisVisitor : public
 public:
 
   explicit RemoveUnusedVarAnalysisVisitor(RemoveUnusedVar *Instance)
-    : ConsumerInstance(Instance)
+    : ConsumerInstance(Instance),
+      CurrentVar(NULL)
   { }
 
+  bool TraverseVarDecl(VarDecl *VD);
+
   bool VisitVarDecl(VarDecl *VD);
 
+  bool VisitDeclRefExpr(DeclRefExpr *DRE);
+
   bool VisitDeclStmt(DeclStmt *DS);
 
   bool VisitCXXCatchStmt(CXXCatchStmt *DS);
@@ -46,8 +55,22 @@ public:
 private:
 
   RemoveUnusedVar *ConsumerInstance;
+
+  // The variable declaration being traversed, so that references inside
+  // its initializer (or type) can be attributed to it.
+  VarDecl *CurrentVar;
 };
 
+bool RemoveUnusedVarAnalysisVisitor::TraverseVarDecl(VarDecl *VD)
+{
+  VarDecl *SavedVar = CurrentVar;
+  CurrentVar = VD;
+  bool RV = RecursiveASTVisitor<RemoveUnusedVarAnalysisVisitor>::
+              TraverseVarDecl(VD);
+  CurrentVar = SavedVar;
+  return RV;
+}
+
 bool RemoveUnusedVarAnalysisVisitor::VisitVarDecl(VarDecl *VD)
 {
   if (ConsumerInstance->isInIncludedFile(VD))
@@ -69,10 +92,23 @@ bool RemoveUnusedVarAnalysisVisitor::VisitVarDecl(VarDecl *VD)
     ConsumerInstance->AllValidVarDecls.push_back(VD);
     return true;
   }
-  if (ConsumerInstance->ValidInstanceNum == 
+  if (ConsumerInstance->ValidInstanceNum ==
       ConsumerInstance->TransformationCounter) {
     ConsumerInstance->TheVarDecl = VD;
   }
+  // Stop the traversal once the requested variable is found.
+  return ConsumerInstance->needsMoreInstances();
+}
+
+bool RemoveUnusedVarAnalysisVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
+{
+  const VarDecl *RefVD = dyn_cast_or_null<VarDecl>(DRE->getDecl());
+  if (!RefVD)
+    return true;
+
+  const VarDecl *Owner =
+    CurrentVar ? CurrentVar->getCanonicalDecl() : NULL;
+  ConsumerInstance->RefOwners[RefVD->getCanonicalDecl()].push_back(Owner);
   return true;
 }
 
@@ -118,6 +154,12 @@ void RemoveUnusedVar::HandleTranslationUnit(ASTContext &Ctx)
 {
   AnalysisVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
 
+  // When several variables are removable, append one bulk candidate
+  // which removes them all (plus their dead dependencies) at once.
+  NumSingleInstances = ValidInstanceNum;
+  if (NumSingleInstances > 1)
+    ValidInstanceNum++;
+
   if (QueryInstanceOnly)
     return;
 
@@ -125,7 +167,8 @@ void RemoveUnusedVar::HandleTranslationUnit(ASTContext &Ctx)
     TransError = TransMaxInstanceError;
     return;
   }
-  if (ToCounter > ValidInstanceNum) {
+  // Counter ranges only span the single-variable candidates.
+  if (ToCounter > NumSingleInstances) {
     TransError = TransToCounterTooBigError;
     return;
   }
@@ -142,6 +185,10 @@ void RemoveUnusedVar::HandleTranslationUnit(ASTContext &Ctx)
 void RemoveUnusedVar::doRewriting()
 {
   if (ToCounter <= 0) {
+    if (TransformationCounter > NumSingleInstances) {
+      doBulkRewriting();
+      return;
+    }
     TransAssert(TheVarDecl && "NULL TheVarDecl!");
     removeVarDecl(TheVarDecl);
     return;
@@ -160,6 +207,62 @@ void RemoveUnusedVar::doRewriting()
   }
 }
 
+void RemoveUnusedVar::doBulkRewriting()
+{
+  // Seed the doomed set with every single-instance candidate, then grow
+  // it to a fixed point: a variable whose references all sit inside
+  // initializers of doomed variables dies together with them. Such
+  // variables are isReferenced() and hence never become single-instance
+  // candidates, but machine-generated inputs contain long chains of
+  // them.
+  llvm::SmallPtrSet<const VarDecl *, 32> DoomedVars;
+  llvm::SmallVector<const VarDecl *, 32> RemovalOrder;
+  for (llvm::SmallVector<const VarDecl *, 500>::iterator
+       I = AllValidVarDecls.begin(), E = AllValidVarDecls.end();
+       I != E; ++I) {
+    DoomedVars.insert((*I)->getCanonicalDecl());
+    RemovalOrder.push_back(*I);
+  }
+
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (VarToRefOwnersMap::iterator I = RefOwners.begin(),
+         E = RefOwners.end(); I != E; ++I) {
+      const VarDecl *VD = (*I).first;
+      if (DoomedVars.count(VD))
+        continue;
+      // Mirror the single-instance eligibility checks.
+      if (isInIncludedFile(VD) || dyn_cast<ParmVarDecl>(VD) ||
+          VD->isStaticDataMember() || SkippedVars.count(VD))
+        continue;
+      if (VD->getSourceRange().getEnd().isInvalid())
+        continue;
+
+      bool AllRefsDoomed = true;
+      VarVector &Owners = (*I).second;
+      for (VarVector::iterator OI = Owners.begin(), OE = Owners.end();
+           OI != OE; ++OI) {
+        if (!(*OI) || !DoomedVars.count(*OI)) {
+          AllRefsDoomed = false;
+          break;
+        }
+      }
+      if (!AllRefsDoomed)
+        continue;
+
+      DoomedVars.insert(VD);
+      RemovalOrder.push_back(VD);
+      Changed = true;
+    }
+  }
+
+  for (llvm::SmallVector<const VarDecl *, 32>::iterator
+       I = RemovalOrder.begin(), E = RemovalOrder.end(); I != E; ++I) {
+    removeVarDecl(*I);
+  }
+}
+
 void RemoveUnusedVar::removeVarDeclFromLinkageSpecDecl(
        const LinkageSpecDecl *LinkageD, const VarDecl *VD)
 {
@@ -32,6 +32,7 @@ public:
 
   RemoveUnusedVar(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc, /*MultipleRewrites*/true),
+      NumSingleInstances(0),
       AnalysisVisitor(NULL),
       TheVarDecl(NULL)
   { }
@@ -47,15 +48,34 @@ private:
 
   void doRewriting();
 
+  // Remove the closed set of dead variables in one rewrite: every
+  // single-instance candidate, plus every variable whose references
+  // all come from initializers of variables already in the set.
+  void doBulkRewriting();
+
   void removeVarDecl(const clang::VarDecl *VD);
 
   void removeVarDeclFromLinkageSpecDecl(const clang::LinkageSpecDecl *LinkageD,
                                         const clang::VarDecl *VD);
 
+  typedef llvm::SmallVector<const clang::VarDecl *, 4> VarVector;
+
+  typedef llvm::DenseMap<const clang::VarDecl *, VarVector>
+            VarToRefOwnersMap;
+
   llvm::DenseMap<const clang::VarDecl *, clang::DeclGroupRef> VarToDeclGroup;
 
   llvm::SmallPtrSet<const clang::VarDecl *, 10> SkippedVars;
 
+  // Maps a referenced variable to the variable whose initializer (or
+  // type) contains each reference; a NULL entry marks a reference from
+  // outside any variable declaration.
+  VarToRefOwnersMap RefOwners;
+
+  // The number of single-variable candidates; the bulk candidate is
+  // numbered right after them.
+  int NumSingleInstances;
+
   llvm::SmallVector<const clang::VarDecl *, 500> AllValidVarDecls;
 
   RemoveUnusedVarAnalysisVisitor *AnalysisVisitor;
@@ -31,6 +31,13 @@ It renames CXX methods names to m_fn1, m_fn2, ...\n";
 static RegisterTransformation<RenameCXXMethod>
          Trans("rename-cxx-method", DescriptionMsg);
 
+// Hot-path counters (see VisitorStats in Transformation.h).  This pass
+// regularly tops the per-pass timings on big C++ inputs and the
+// counters tell slow visiting apart from slow matching without a
+// profiler.
+static VisitorStats CollectionStats("rcm-collect");
+static VisitorStats RenameStats("rcm-rename");
+
 class RenameCXXMethodCollectionVisitor : public 
   RecursiveASTVisitor<RenameCXXMethodCollectionVisitor> {
 
@@ -112,13 +119,18 @@ bool RenameCXXMethodCollectionVisitor::VisitCXXRecordDecl(CXXRecordDecl *RD)
 
 bool RenameCXXMethodCollectionVisitor::VisitCXXMethodDecl(CXXMethodDecl *MD)
 {
+  if (Transformation::isCancelRequested())
+    return false;
+  CollectionStats.Visits++;
   if (ConsumerInstance->isInIncludedFile(MD))
     return true;
+  CollectionStats.Attempts++;
   const CXXMethodDecl *CanonicalMD = MD->getCanonicalDecl();
-  if(ConsumerInstance->NewMethodNames.find(CanonicalMD) != 
-       ConsumerInstance->NewMethodNames.end())
+  if(ConsumerInstance->NewMethodIds.find(CanonicalMD) !=
+       ConsumerInstance->NewMethodIds.end())
     return true;
-  
+
+  CollectionStats.Matches++;
   ConsumerInstance->handleOneMemberTemplateFunction(CanonicalMD);
   return true;
 }
@@ -189,15 +201,21 @@ bool RenameCXXMethodVisitor::TraverseClassTemplateDecl(ClassTemplateDecl *D)
 
 bool RenameCXXMethodVisitor::VisitCXXMethodDecl(CXXMethodDecl *MD)
 {
+  if (Transformation::isCancelRequested())
+    return false;
+  RenameStats.Visits++;
   if (ConsumerInstance->isSpecialCXXMethod(MD) ||
       ConsumerInstance->isInIncludedFile(MD))
     return true;
 
+  RenameStats.Attempts++;
   const CXXMethodDecl *CanonicalMD = MD->getCanonicalDecl();
-  llvm::DenseMap<const CXXMethodDecl *, std::string>::iterator I = 
-    ConsumerInstance->NewMethodNames.find(CanonicalMD);
-  if (I != ConsumerInstance->NewMethodNames.end()) {
-    ConsumerInstance->RewriteHelper->replaceFunctionDeclName(MD, (*I).second);
+  llvm::DenseMap<const CXXMethodDecl *, int>::iterator I =
+    ConsumerInstance->NewMethodIds.find(CanonicalMD);
+  if (I != ConsumerInstance->NewMethodIds.end()) {
+    RenameStats.Matches++;
+    ConsumerInstance->RewriteHelper->replaceFunctionDeclName(
+      MD, ConsumerInstance->MethodNameTable[(*I).second - 1]);
     return true;
   }
   
@@ -215,10 +233,11 @@ bool RenameCXXMethodVisitor::VisitCXXMethodDecl(CXXMethodDecl *MD)
     ConsumerInstance->VisitedSpecializedMethods.insert(
         MD->getCanonicalDecl());
     CanonicalMD = MemberMD->getCanonicalDecl();
-    I = ConsumerInstance->NewMethodNames.find(CanonicalMD);
-    TransAssert((I != ConsumerInstance->NewMethodNames.end()) &&
+    I = ConsumerInstance->NewMethodIds.find(CanonicalMD);
+    TransAssert((I != ConsumerInstance->NewMethodIds.end()) &&
                 "Cannot find member function!");
-    ConsumerInstance->RewriteHelper->replaceFunctionDeclName(MD, (*I).second);
+    ConsumerInstance->RewriteHelper->replaceFunctionDeclName(
+      MD, ConsumerInstance->MethodNameTable[(*I).second - 1]);
     return true;
   }
 
@@ -233,6 +252,7 @@ bool RenameCXXMethodVisitor::VisitCXXMethodDecl(CXXMethodDecl *MD)
 
 bool RenameCXXMethodVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
 {
+  RenameStats.Visits++;
   const ValueDecl *VD = DRE->getDecl();
   const CXXMethodDecl *MD = dyn_cast<CXXMethodDecl>(VD);
   if (!MD)
@@ -241,9 +261,11 @@ bool RenameCXXMethodVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
   if (!ConsumerInstance->isExplicit(MD))
       return true;
 
+  RenameStats.Attempts++;
   std::string NewName = "";
   if (!ConsumerInstance->getMethodNewName(MD, NewName))
     return true;
+  RenameStats.Matches++;
   TransAssert((NewName != "") && "Bad new name!");
 
   if (DRE->hasQualifier()) {
@@ -261,6 +283,7 @@ bool RenameCXXMethodVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
 
 bool RenameCXXMethodVisitor::VisitMemberExpr(MemberExpr *ME)
 {
+  RenameStats.Visits++;
   const ValueDecl *VD = ME->getMemberDecl();
   const CXXMethodDecl *MD = dyn_cast<CXXMethodDecl>(VD);
   if (!MD)
@@ -268,9 +291,11 @@ bool RenameCXXMethodVisitor::VisitMemberExpr(MemberExpr *ME)
   if (!ConsumerInstance->isExplicit(MD)) {
       return true;
   }
+  RenameStats.Attempts++;
   std::string NewName = "";
   if (!ConsumerInstance->getMethodNewName(MD, NewName))
     return true;
+  RenameStats.Matches++;
   TransAssert((NewName != "") && "Bad new name!");
 
   if (ME->hasQualifier()) {
@@ -324,6 +349,13 @@ void RenameCXXMethod::HandleTranslationUnit(ASTContext &Ctx)
     return;
   }
 
+  // the collection runs per top-level decl; if the deadline already
+  // fired there, do not misreport the truncated census as "no methods"
+  if (Transformation::isCancelRequested()) {
+    TransError = TransDeadlineError;
+    return;
+  }
+
   if (!hasValidMethods()) {
     TransError = TransNoValidFunsError;
     return;
@@ -338,6 +370,11 @@ void RenameCXXMethod::HandleTranslationUnit(ASTContext &Ctx)
 
   RenameVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
 
+  if (Transformation::isCancelRequested()) {
+    TransError = TransDeadlineError;
+    return;
+  }
+
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
     TransError = TransInternalError;
@@ -345,7 +382,7 @@ void RenameCXXMethod::HandleTranslationUnit(ASTContext &Ctx)
 
 bool RenameCXXMethod::hasValidMethods()
 {
-  return ((NewMethodNames.size() != 0) && DoRenaming);
+  return ((NewMethodIds.size() != 0) && DoRenaming);
 }
 
 // note that we don't handle the possible ambiguity here, e.g.
@@ -436,13 +473,15 @@ void RenameCXXMethod::addOneMethodName(const CXXMethodDecl *MD,
                                        unsigned int /*Num*/)
 {
   const CXXMethodDecl *CanonicalMD = MD->getCanonicalDecl();
-  TransAssert((NewMethodNames.find(CanonicalMD) == NewMethodNames.end()) &&
+  TransAssert((NewMethodIds.find(CanonicalMD) == NewMethodIds.end()) &&
               "Duplicate CXXMethodDecl!");
   std::stringstream SS;
   // SS << MethodNamePrefix << Num;
   NumRenamedMethods++;
   SS << MethodNamePrefix << NumRenamedMethods;
-  NewMethodNames[CanonicalMD] = SS.str();
+  // intern the name once; every method sharing this id reuses the entry
+  MethodNameTable.push_back(SS.str());
+  NewMethodIds[CanonicalMD] = NumRenamedMethods;
 
   // Now we check if the old name actually has a valid format, i.e. m_fn([0-9]+)
   // if not, set DoRenaming to be false, then we will need to
@@ -455,21 +494,23 @@ void RenameCXXMethod::addOneInheritedName(const CXXMethodDecl *MD,
                                           const CXXMethodDecl *BaseMD)
 {
   const CXXMethodDecl *CanonicalMD = MD->getCanonicalDecl();
-  CXXMethodDeclToNameMap::iterator I = NewMethodNames.find(CanonicalMD);
+  CXXMethodDeclToIdMap::iterator I = NewMethodIds.find(CanonicalMD);
   (void)I;
-  TransAssert((I == NewMethodNames.end()) && "Duplicate CXXMethodDecl!");
+  TransAssert((I == NewMethodIds.end()) && "Duplicate CXXMethodDecl!");
 
   const CXXMethodDecl *CanonicalBaseMD = BaseMD->getCanonicalDecl();
   // MD may be inherited of a member function of a class template
-  if (const FunctionDecl *FD = 
+  if (const FunctionDecl *FD =
         CanonicalBaseMD->getInstantiatedFromMemberFunction()) {
     CanonicalBaseMD = dyn_cast<CXXMethodDecl>(FD);
     TransAssert(CanonicalBaseMD && "bad conversion from FD to MD!");
   }
-  CXXMethodDeclToNameMap::iterator BaseI = NewMethodNames.find(CanonicalBaseMD);
-  TransAssert((BaseI != NewMethodNames.end()) && 
+  CXXMethodDeclToIdMap::iterator BaseI = NewMethodIds.find(CanonicalBaseMD);
+  TransAssert((BaseI != NewMethodIds.end()) &&
               "Cannot find base CXXMethodDecl!");
-  NewMethodNames[CanonicalMD] = BaseI->second;
+  // sharing the base's id flattens the whole override chain onto one
+  // table entry --- no string is copied per inherited method
+  NewMethodIds[CanonicalMD] = BaseI->second;
 }
 
 void RenameCXXMethod::handleOneCXXRecordDecl(const CXXRecordDecl *RD)
@@ -860,15 +901,15 @@ bool RenameCXXMethod::getMethodNewName(const CXXMethodDecl *MD,
                                        std::string &NewName)
 {
   const CXXMethodDecl *CanonicalMD = MD->getCanonicalDecl();
-  llvm::DenseMap<const CXXMethodDecl *, std::string>::iterator I = 
-    NewMethodNames.find(CanonicalMD);
-  if (I == NewMethodNames.end()) {
+  CXXMethodDeclToIdMap::iterator I =
+    NewMethodIds.find(CanonicalMD);
+  if (I == NewMethodIds.end()) {
     CanonicalMD = getCXXMethodFromMemberFunction(CanonicalMD);
-    I = NewMethodNames.find(CanonicalMD);
-    if (I == NewMethodNames.end())
+    I = NewMethodIds.find(CanonicalMD);
+    if (I == NewMethodIds.end())
       return false;
   }
-  NewName = I->second;
+  NewName = MethodNameTable[I->second - 1];
   return true;
 }
 
@@ -883,12 +924,12 @@ void RenameCXXMethod::rewriteFunctionTemplateExplicitInstantiation(
   const CXXMethodDecl *TmplMD = dyn_cast<CXXMethodDecl>(Pattern);
   TransAssert(TmplMD && "Invalid CXXMethodDecl!");
 
-  CXXMethodDeclToNameMap::iterator I = 
-    NewMethodNames.find(TmplMD->getCanonicalDecl());
-  TransAssert((I != NewMethodNames.end()) && "Cannot find CXXMethodDecl!");
-  std::string Name = I->second;
-  I = NewMethodNames.find(MD);
-  TransAssert((I == NewMethodNames.end()) && "Duplicate find CXXMethodDecl?");
+  CXXMethodDeclToIdMap::iterator I =
+    NewMethodIds.find(TmplMD->getCanonicalDecl());
+  TransAssert((I != NewMethodIds.end()) && "Cannot find CXXMethodDecl!");
+  const std::string &Name = MethodNameTable[I->second - 1];
+  I = NewMethodIds.find(MD);
+  TransAssert((I == NewMethodIds.end()) && "Duplicate find CXXMethodDecl?");
 
   SourceLocation Loc = MD->getPointOfInstantiation();
   TheRewriter.ReplaceText(Loc, MD->getNameAsString().size(), Name);
@@ -12,6 +12,7 @@
 #define RENAME_CXX_METHOD_H
 
 #include <string>
+#include <vector>
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
@@ -66,8 +67,8 @@ public:
 
 private:
 
-  typedef llvm::DenseMap<const clang::CXXMethodDecl *, std::string> 
-    CXXMethodDeclToNameMap;
+  typedef llvm::DenseMap<const clang::CXXMethodDecl *, int>
+    CXXMethodDeclToIdMap;
 
   typedef llvm::DenseMap<const clang::CXXRecordDecl *, unsigned int> 
     CXXRecordDeclToNumMap;
@@ -167,7 +168,13 @@ private:
 
   CXXMethodDeclSet VisitedSpecializedMethods;
 
-  CXXMethodDeclToNameMap NewMethodNames;
+  // Methods are keyed by a small integer id instead of the name string.
+  // Every method on one override chain shares the same id, so chain
+  // membership is an integer comparison and each "m_fn<N>" string is
+  // built exactly once, in MethodNameTable[N - 1].
+  CXXMethodDeclToIdMap NewMethodIds;
+
+  std::vector<std::string> MethodNameTable;
 
   CXXRecordDeclToNumMap NumMemberFunctions;
 
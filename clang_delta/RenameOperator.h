@@ -12,8 +12,9 @@
 #define RENAME_OPERATOR_H
 
 #include <string>
-#include <set>
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/StringSet.h"
 #include "Transformation.h"
 
 namespace clang {
@@ -46,13 +47,13 @@ private:
 
   std::string getNextFuncName();
 
-  std::set<const clang::FunctionDecl*> FunctionSet;
+  llvm::SmallPtrSet<const clang::FunctionDecl*, 32> FunctionSet;
 
   std::vector<const clang::FunctionDecl*> FunctionList;
 
-  std::map<const clang::FunctionDecl*, std::string> RenameFunc;
+  llvm::DenseMap<const clang::FunctionDecl*, std::string> RenameFunc;
 
-  std::set<std::string> UsedNames;
+  llvm::StringSet<> UsedNames;
 
   const std::string FunNamePrefix = "op";
 
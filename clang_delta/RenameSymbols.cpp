@@ -0,0 +1,400 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "RenameSymbols.h"
+
+#include <sstream>
+
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/Basic/SourceManager.h"
+
+#include "TransformationManager.h"
+
+using namespace clang;
+
+static const char *DescriptionMsg =
+"A combined renaming pass. It renames functions to fn1, fn2, ..., \
+parameters to p1, p2, ..., and other variables to a, b, ..., z in a \
+single invocation with a single parse, subsuming rename-fun, \
+rename-param and rename-var for the common case. C++ class methods \
+are left to rename-cxx-method. \n";
+
+static RegisterTransformation<RenameSymbols>
+         Trans("rename-symbols", DescriptionMsg);
+
+class RSCollectionVisitor : public RecursiveASTVisitor<RSCollectionVisitor> {
+public:
+
+  explicit RSCollectionVisitor(RenameSymbols *Instance)
+    : ConsumerInstance(Instance)
+  { }
+
+  bool VisitFunctionDecl(FunctionDecl *FD);
+
+  bool VisitCallExpr(CallExpr *CE);
+
+  bool VisitVarDecl(VarDecl *VD);
+
+private:
+
+  RenameSymbols *ConsumerInstance;
+
+};
+
+class RenameSymbolsVisitor : public RecursiveASTVisitor<RenameSymbolsVisitor> {
+public:
+
+  explicit RenameSymbolsVisitor(RenameSymbols *Instance)
+    : ConsumerInstance(Instance)
+  { }
+
+  bool VisitFunctionDecl(FunctionDecl *FD);
+
+  bool VisitVarDecl(VarDecl *VD);
+
+  bool VisitDeclRefExpr(DeclRefExpr *DRE);
+
+private:
+
+  RenameSymbols *ConsumerInstance;
+
+  // parameters of function redeclarations are distinct decls outside
+  // any redecl chain, so target names are attached here while visiting
+  // each FunctionDecl and looked up when its body's DREs are visited
+  llvm::DenseMap<ParmVarDecl *, std::string> ParamNameMap;
+
+};
+
+bool RSCollectionVisitor::VisitFunctionDecl(FunctionDecl *FD)
+{
+  if (dyn_cast<CXXMethodDecl>(FD) || FD->isOverloadedOperator())
+    return true;
+
+  const FunctionDecl *CanonicalFD = FD->getCanonicalDecl();
+  if (ConsumerInstance->isInIncludedFile(FD) ||
+      ConsumerInstance->isInIncludedFile(CanonicalFD))
+    return true;
+
+  ConsumerInstance->addFun(CanonicalFD);
+  return true;
+}
+
+bool RSCollectionVisitor::VisitCallExpr(CallExpr *CE)
+{
+  if (ConsumerInstance->isInIncludedFile(CE))
+    return true;
+  FunctionDecl *FD = CE->getDirectCallee();
+  if (!FD || dyn_cast<CXXMethodDecl>(FD) || FD->isOverloadedOperator())
+    return true;
+  if (ConsumerInstance->isInIncludedFile(FD))
+    return true;
+
+  const FunctionDecl *CanonicalFD = FD->getCanonicalDecl();
+
+  // This case is handled by VisitFunctionDecl
+  if (CanonicalFD->isDefined())
+    return true;
+
+  // It's possible we don't have function definition
+  ConsumerInstance->addFun(CanonicalFD);
+  return true;
+}
+
+bool RSCollectionVisitor::VisitVarDecl(VarDecl *VD)
+{
+  if (ConsumerInstance->isInIncludedFile(VD))
+    return true;
+
+  // Parameters are named positionally from their function, but their
+  // spelled names still have to be reserved.
+  if (dyn_cast<ParmVarDecl>(VD)) {
+    ConsumerInstance->UsedNames.insert(VD->getNameAsString());
+    return true;
+  }
+
+  ConsumerInstance->addVar(VD->getCanonicalDecl());
+  return true;
+}
+
+bool RenameSymbolsVisitor::VisitFunctionDecl(FunctionDecl *FD)
+{
+  if (ConsumerInstance->isInIncludedFile(FD) ||
+      dyn_cast<CXXMethodDecl>(FD) ||
+      FD->isOverloadedOperator())
+    return true;
+
+  const FunctionDecl *CanonicalFD = FD->getCanonicalDecl();
+
+  llvm::DenseMap<const FunctionDecl *, std::string>::iterator I =
+    ConsumerInstance->FunToNameMap.find(CanonicalFD);
+  if (I != ConsumerInstance->FunToNameMap.end()) {
+    if (!ConsumerInstance->RewriteHelper->
+           replaceFunctionDeclName(FD, (*I).second))
+      return false;
+  }
+
+  std::map<const FunctionDecl *, std::vector<std::string> >::iterator PI =
+    ConsumerInstance->ParamToNameMap.find(CanonicalFD);
+  if (PI == ConsumerInstance->ParamToNameMap.end())
+    return true;
+
+  const std::vector<std::string> &Names = (*PI).second;
+  for (unsigned Idx = 0; Idx < FD->getNumParams(); ++Idx) {
+    if ((Idx >= Names.size()) || Names[Idx].empty())
+      continue;
+    ParmVarDecl *PD = FD->getParamDecl(Idx);
+    ParamNameMap[PD] = Names[Idx];
+    if (PD->getNameAsString() == Names[Idx])
+      continue;
+    if (!ConsumerInstance->RewriteHelper->replaceVarDeclName(PD, Names[Idx]))
+      return false;
+  }
+  return true;
+}
+
+bool RenameSymbolsVisitor::VisitVarDecl(VarDecl *VD)
+{
+  if (dyn_cast<ParmVarDecl>(VD))
+    return true;
+
+  VarDecl *CanonicalVD = VD->getCanonicalDecl();
+  llvm::DenseMap<const VarDecl *, std::string>::iterator I =
+    ConsumerInstance->VarToNameMap.find(CanonicalVD);
+  if (I == ConsumerInstance->VarToNameMap.end())
+    return true;
+
+  return ConsumerInstance->RewriteHelper->replaceVarDeclName(VD, (*I).second);
+}
+
+bool RenameSymbolsVisitor::VisitDeclRefExpr(DeclRefExpr *DRE)
+{
+  if (ConsumerInstance->isInIncludedFile(DRE))
+    return true;
+
+  ValueDecl *OrigDecl = DRE->getDecl();
+
+  if (FunctionDecl *FD = dyn_cast<FunctionDecl>(OrigDecl)) {
+    if (dyn_cast<CXXMethodDecl>(FD) || FD->isOverloadedOperator() ||
+        ConsumerInstance->isInIncludedFile(FD))
+      return true;
+    if (FD->isTemplateInstantiation())
+      FD = FD->getTemplateInstantiationPattern();
+
+    const FunctionDecl *CanonicalFD = FD->getCanonicalDecl();
+    llvm::DenseMap<const FunctionDecl *, std::string>::iterator I =
+      ConsumerInstance->FunToNameMap.find(CanonicalFD);
+    if (I == ConsumerInstance->FunToNameMap.end())
+      return true;
+    ConsumerInstance->TheRewriter.ReplaceText(DRE->getBeginLoc(),
+      FD->getNameAsString().size(), (*I).second);
+    return true;
+  }
+
+  VarDecl *VD = dyn_cast<VarDecl>(OrigDecl);
+  if (!VD)
+    return true;
+
+  // We can visit the same DRE twice from an InitListExpr, i.e.,
+  // through InitListExpr's semantic form and syntactic form.
+  if (ConsumerInstance->VisitedDREs.count(DRE))
+    return true;
+
+  if (ParmVarDecl *PD = dyn_cast<ParmVarDecl>(VD)) {
+    llvm::DenseMap<ParmVarDecl *, std::string>::iterator I =
+      ParamNameMap.find(PD);
+    if ((I == ParamNameMap.end()) || (PD->getNameAsString() == (*I).second))
+      return true;
+    ConsumerInstance->VisitedDREs.insert(DRE);
+    return ConsumerInstance->RewriteHelper->replaceExpr(DRE, (*I).second);
+  }
+
+  VarDecl *CanonicalVD = VD->getCanonicalDecl();
+  llvm::DenseMap<const VarDecl *, std::string>::iterator I =
+    ConsumerInstance->VarToNameMap.find(CanonicalVD);
+  if (I == ConsumerInstance->VarToNameMap.end())
+    return true;
+
+  ConsumerInstance->VisitedDREs.insert(DRE);
+  return ConsumerInstance->RewriteHelper->replaceExpr(DRE, (*I).second);
+}
+
+void RenameSymbols::Initialize(ASTContext &context)
+{
+  Transformation::Initialize(context);
+
+  CollectionVisitor = new RSCollectionVisitor(this);
+  RenameVisitor = new RenameSymbolsVisitor(this);
+  ValidInstanceNum = 1;
+}
+
+bool RenameSymbols::HandleTopLevelDecl(DeclGroupRef D)
+{
+  for (DeclGroupRef::iterator I = D.begin(), E = D.end(); I != E; ++I) {
+    CollectionVisitor->TraverseDecl(*I);
+  }
+  return true;
+}
+
+void RenameSymbols::HandleTranslationUnit(ASTContext &Ctx)
+{
+  unsigned NumRenames = assignNames();
+
+  if (NumRenames == 0)
+    ValidInstanceNum = 0;
+
+  if (QueryInstanceOnly) {
+    return;
+  }
+
+  if (NumRenames == 0) {
+    TransError = TransNoValidVarsError;
+    return;
+  }
+  else if (TransformationCounter > ValidInstanceNum) {
+    TransError = TransMaxInstanceError;
+    return;
+  }
+
+  TransAssert(RenameVisitor && "NULL RenameVisitor!");
+  Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
+
+  RenameVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+
+  if (Ctx.getDiagnostics().hasErrorOccurred() ||
+      Ctx.getDiagnostics().hasFatalErrorOccurred())
+    TransError = TransInternalError;
+}
+
+bool RenameSymbols::isSpecialFun(const std::string &Name)
+{
+  return (Name.compare("main") == 0) || (Name.compare("printf") == 0);
+}
+
+void RenameSymbols::addFun(const FunctionDecl *FD)
+{
+  if (FunToNameMap.find(FD) != FunToNameMap.end())
+    return;
+  // reserve the slot; the real name is picked in assignNames
+  FunToNameMap[FD] = std::string();
+  ValidFuns.push_back(FD);
+  UsedNames.insert(FD->getNameAsString());
+}
+
+void RenameSymbols::addVar(const VarDecl *VD)
+{
+  if (VarToNameMap.find(VD) != VarToNameMap.end())
+    return;
+  VarToNameMap[VD] = std::string();
+  ValidVars.push_back(VD);
+  UsedNames.insert(VD->getNameAsString());
+}
+
+std::string RenameSymbols::pickUnusedName(const std::string &Prefix,
+                                          unsigned &Postfix,
+                                          const std::string &OldName)
+{
+  while (true) {
+    std::stringstream TmpSS;
+    Postfix++;
+    TmpSS << Prefix << Postfix;
+    std::string Name = TmpSS.str();
+    if ((Name == OldName) || !UsedNames.count(Name))
+      return Name;
+  }
+}
+
+unsigned RenameSymbols::assignNames(void)
+{
+  unsigned NumRenames = 0;
+
+  unsigned FunPostfix = 0;
+  for (std::vector<const FunctionDecl *>::iterator I = ValidFuns.begin(),
+       E = ValidFuns.end(); I != E; ++I) {
+    const FunctionDecl *FD = (*I);
+    std::string OldName = FD->getNameAsString();
+
+    // parameters are renamed positionally even for special functions
+    if (FD->getNumParams()) {
+      std::vector<std::string> &Names = ParamToNameMap[FD];
+      unsigned NumParams = FD->getNumParams();
+      for (unsigned Idx = 0; Idx < NumParams; ++Idx) {
+        const ParmVarDecl *PD = FD->getParamDecl(Idx);
+        std::string ParamOldName = PD->getNameAsString();
+        std::stringstream TmpSS;
+        TmpSS << ParamNamePrefix << (Idx + 1);
+        std::string ParamName = TmpSS.str();
+        // never rename an unnamed parameter, and never capture an
+        // existing symbol of the same spelling
+        if (ParamOldName.empty() ||
+            ((ParamName != ParamOldName) && UsedNames.count(ParamName))) {
+          Names.push_back(std::string());
+          continue;
+        }
+        Names.push_back(ParamName);
+        if (ParamName != ParamOldName) {
+          UsedNames.insert(ParamName);
+          NumRenames++;
+        }
+      }
+    }
+
+    if (isSpecialFun(OldName) || FD->hasAttr<OpenCLKernelAttr>()) {
+      FunToNameMap.erase(FD);
+      continue;
+    }
+    std::string Name = pickUnusedName(FunNamePrefix, FunPostfix, OldName);
+    if (Name == OldName) {
+      FunToNameMap.erase(FD);
+      continue;
+    }
+    FunToNameMap[FD] = Name;
+    UsedNames.insert(Name);
+    NumRenames++;
+  }
+
+  char Letter = 'a';
+  unsigned VarPostfix = 0;
+  for (std::vector<const VarDecl *>::iterator I = ValidVars.begin(),
+       E = ValidVars.end(); I != E; ++I) {
+    const VarDecl *VD = (*I);
+    std::string OldName = VD->getNameAsString();
+    std::string Name;
+    while (Letter <= 'z') {
+      std::string Candidate(1, Letter);
+      Letter++;
+      if ((Candidate == OldName) || !UsedNames.count(Candidate)) {
+        Name = Candidate;
+        break;
+      }
+    }
+    if (Name.empty())
+      Name = pickUnusedName(VarNamePrefix, VarPostfix, OldName);
+    if (Name == OldName) {
+      VarToNameMap.erase(VD);
+      continue;
+    }
+    VarToNameMap[VD] = Name;
+    UsedNames.insert(Name);
+    NumRenames++;
+  }
+
+  return NumRenames;
+}
+
+RenameSymbols::~RenameSymbols(void)
+{
+  delete CollectionVisitor;
+  delete RenameVisitor;
+}
@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef RENAME_SYMBOLS_H
+#define RENAME_SYMBOLS_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/DenseMap.h"
+#include "Transformation.h"
+
+namespace clang {
+  class DeclGroupRef;
+  class ASTContext;
+  class FunctionDecl;
+  class VarDecl;
+}
+
+class RSCollectionVisitor;
+class RenameSymbolsVisitor;
+
+class RenameSymbols : public Transformation {
+friend class RSCollectionVisitor;
+friend class RenameSymbolsVisitor;
+
+public:
+
+  RenameSymbols(const char *TransName, const char *Desc)
+    : Transformation(TransName, Desc),
+      CollectionVisitor(NULL),
+      RenameVisitor(NULL),
+      FunNamePrefix("fn"),
+      ParamNamePrefix("p"),
+      VarNamePrefix("t")
+  { }
+
+  ~RenameSymbols(void);
+
+  virtual bool skipCounter(void) {
+    return true;
+  }
+
+private:
+
+  virtual void Initialize(clang::ASTContext &context);
+
+  virtual bool HandleTopLevelDecl(clang::DeclGroupRef D);
+
+  virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
+
+  void addFun(const clang::FunctionDecl *FD);
+
+  void addVar(const clang::VarDecl *VD);
+
+  bool isSpecialFun(const std::string &Name);
+
+  // pick minimal names for every collected symbol; returns the number
+  // of symbols whose name actually changes
+  unsigned assignNames(void);
+
+  std::string pickUnusedName(const std::string &Prefix, unsigned &Postfix,
+                             const std::string &OldName);
+
+  RSCollectionVisitor *CollectionVisitor;
+
+  RenameSymbolsVisitor *RenameVisitor;
+
+  const std::string FunNamePrefix;
+
+  const std::string ParamNamePrefix;
+
+  const std::string VarNamePrefix;
+
+  std::vector<const clang::FunctionDecl *> ValidFuns;
+
+  std::vector<const clang::VarDecl *> ValidVars;
+
+  // every identifier spelled in the TU, so freshly picked names can
+  // never capture an existing symbol
+  std::set<std::string> UsedNames;
+
+  llvm::DenseMap<const clang::FunctionDecl *, std::string> FunToNameMap;
+
+  llvm::DenseMap<const clang::VarDecl *, std::string> VarToNameMap;
+
+  // per canonical function, the target name of each parameter by
+  // position; an empty string leaves the parameter alone
+  std::map<const clang::FunctionDecl *, std::vector<std::string> >
+    ParamToNameMap;
+
+  llvm::SmallPtrSet<clang::DeclRefExpr *, 10> VisitedDREs;
+
+  // Unimplemented
+  RenameSymbols(void);
+
+  RenameSymbols(const RenameSymbols &);
+
+  void operator=(const RenameSymbols &);
+};
+#endif
@@ -28,7 +28,10 @@ using namespace clang;
 static const char *DescriptionMsg =
 "To increase readability, rename global and local variables \
 to a, b, ..., z. The transformation returns with error message \
-if there are more than 26 different variables. \n";
+if there are more than 26 different variables. \
+Counter 1 renames all variables in one shot; counters 2 and up \
+rename only the (counter-1)-th variable, so the driver can fall \
+back to per-variable probing when the bulk candidate fails. \n";
 
 static RegisterTransformation<RenameVar>
          Trans("rename-var", DescriptionMsg);
@@ -144,7 +147,11 @@ void RenameVar::HandleTranslationUnit(ASTContext &Ctx)
   if (NumVars == 0) {
     ValidInstanceNum = 0;
   }
-  else if (NumVars > NumNames) {
+  else {
+    // one bulk candidate plus one per-variable fallback candidate
+    ValidInstanceNum = NumVars + 1;
+  }
+  if (NumVars > NumNames) {
     // TEMP: currently not to rename vars in C++ files if there are
     //       more than 26 global or local vars
     if (TransformationManager::isCXXLangOpt() || allValidNames()) {
@@ -176,6 +183,16 @@ void RenameVar::HandleTranslationUnit(ASTContext &Ctx)
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
 
   collectVars();
+  // A counter above 1 selects a single variable and drops the rest of
+  // the map; the kept name comes from the same deterministic assignment
+  // as the bulk candidate, so accepted per-variable renames converge on
+  // the bulk result.
+  if (TransformationCounter > 1) {
+    VarDecl *KeptVD = ValidVars[TransformationCounter - 2];
+    std::string KeptName = VarToNameMap[KeptVD];
+    VarToNameMap.clear();
+    VarToNameMap[KeptVD] = KeptName;
+  }
   RenameVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
@@ -14,7 +14,9 @@
 
 #include "ReplaceCallExpr.h"
 
+#include <map>
 #include <sstream>
+#include <vector>
 
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
@@ -35,6 +37,9 @@ of the following: \n\
 If a callee has several return statements, all of them \
 will be exercised separately, i.e., the transformation \
 will choose one for each iteration. \
+After all single-site candidates, one extra candidate per \
+callee/return pair with multiple valid call sites replaces \
+every site in a single rewrite. \
 This pass is unsound because the side-effect on globals \
 and parameters caused by callees are not captured. \n";
 
@@ -303,12 +308,16 @@ void ReplaceCallExpr::HandleTranslationUnit(ASTContext &Ctx)
     return;
   }
 
-  TransAssert(TheCallExpr && "NULL TheCallExpr!");
+  TransAssert((TheCallExpr || TheBatchCallExprs.size()) &&
+              "NULL TheCallExpr!");
   TransAssert(TheReturnStmt && "NULL TheReturnStmt");
 
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
 
-  replaceCallExpr();
+  if (TheBatchCallExprs.size())
+    replaceAllCallExprs();
+  else
+    replaceCallExpr();
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
@@ -396,15 +405,30 @@ bool ReplaceCallExpr::hasUnmatchedParmArg(const ParameterPosVector &PosVector,
 
 // A heuristic way to check if replacing CallExpr could cause
 // code bloat.
-bool ReplaceCallExpr::hasBadEffect(const ParameterPosVector &PosVector,
-                                   ReturnStmt *RS, CallExpr *CE)
+// The return-value expression count only depends on the ReturnStmt, so
+// it is computed once per callee rather than once per call site.
+unsigned int ReplaceCallExpr::getRetValNumExprs(ReturnStmt *RS)
 {
-  ExprCountVisitor ECVisitor;
+  llvm::DenseMap<ReturnStmt *, unsigned int>::iterator I =
+    RetValNumExprsCache.find(RS);
+  if (I != RetValNumExprsCache.end())
+    return (*I).second;
 
+  ExprCountVisitor ECVisitor;
   Expr *RVExpr = RS->getRetValue();
   TransAssert(RVExpr && "Bad Return Expr!");
   ECVisitor.TraverseStmt(RVExpr);
-  unsigned int RVNumExprs = ECVisitor.getNumExprs();
+  unsigned int NumExprs = ECVisitor.getNumExprs();
+  RetValNumExprsCache[RS] = NumExprs;
+  return NumExprs;
+}
+
+bool ReplaceCallExpr::hasBadEffect(const ParameterPosVector &PosVector,
+                                   ReturnStmt *RS, CallExpr *CE)
+{
+  ExprCountVisitor ECVisitor;
+
+  unsigned int RVNumExprs = getRetValNumExprs(RS);
   TransAssert(RVNumExprs && "Bad NumExprs!");
 
   // really conservatively set 5 as a threshold value
@@ -435,8 +459,30 @@ bool ReplaceCallExpr::hasBadEffect(const ParameterPosVector &PosVector,
   return (RVNumExprs > (CallExprsNum + 5));
 }
 
+// The parameter positions only depend on the callee and the
+// ReturnStmt, so they are derived once instead of once per call site.
+const ReplaceCallExpr::ParameterPosVector &
+ReplaceCallExpr::getCachedParmPosVector(ReturnStmt *RS, CallExpr *CE)
+{
+  std::pair<FunctionDecl *, ReturnStmt *> Key(CE->getDirectCallee(), RS);
+  std::map<std::pair<FunctionDecl *, ReturnStmt *>,
+           ParameterPosVector>::iterator I = ParmPosCache.find(Key);
+  if (I != ParmPosCache.end())
+    return (*I).second;
+
+  ParameterPosVector &PosVector = ParmPosCache[Key];
+  getParmPosVector(PosVector, RS, CE);
+  return PosVector;
+}
+
 void ReplaceCallExpr::doAnalysis(void)
 {
+  typedef std::pair<FunctionDecl *, ReturnStmt *> GroupKey;
+  // group keys in first-seen order, so batch numbering stays
+  // deterministic across invocations
+  std::vector<GroupKey> GroupKeys;
+  std::map<GroupKey, std::vector<CallExpr *> > Groups;
+
   for (SmallVector<CallExpr *, 10>::iterator CI = AllCallExprs.begin(),
        CE = AllCallExprs.end(); CI != CE; ++CI) {
     FunctionDecl *CalleeDecl = (*CI)->getDirectCallee();
@@ -452,8 +498,8 @@ void ReplaceCallExpr::doAnalysis(void)
     for (ReturnStmtsVector::iterator RI = RVector->begin(),
          RE = RVector->end(); RI != RE; ++RI) {
 
-      ParameterPosVector PosVector;
-      getParmPosVector(PosVector, *RI, *CI);
+      const ParameterPosVector &PosVector =
+        getCachedParmPosVector(*RI, *CI);
 
       if (hasUnmatchedParmArg(PosVector, *CI))
         continue;
@@ -462,11 +508,33 @@ void ReplaceCallExpr::doAnalysis(void)
         continue;
 
       ValidInstanceNum++;
-      if (TransformationCounter != ValidInstanceNum)
-        continue;
+      if (TransformationCounter == ValidInstanceNum) {
+        TheCallExpr = (*CI);
+        TheReturnStmt = (*RI);
+      }
+
+      GroupKey Key(CalleeDecl->getCanonicalDecl(), *RI);
+      std::vector<CallExpr *> &Sites = Groups[Key];
+      if (Sites.empty())
+        GroupKeys.push_back(Key);
+      Sites.push_back(*CI);
+    }
+  }
+
+  // batch candidates: one per callee/return pair with more than one
+  // valid call site, numbered after all single-site candidates
+  for (std::vector<GroupKey>::iterator KI = GroupKeys.begin(),
+       KE = GroupKeys.end(); KI != KE; ++KI) {
+    std::vector<CallExpr *> &Sites = Groups[*KI];
+    if (Sites.size() < 2)
+      continue;
 
-      TheCallExpr = (*CI);
-      TheReturnStmt = (*RI);
+    ValidInstanceNum++;
+    if (TransformationCounter == ValidInstanceNum) {
+      TheCallExpr = NULL;
+      TheBatchCallExprs.clear();
+      TheBatchCallExprs.append(Sites.begin(), Sites.end());
+      TheReturnStmt = (*KI).second;
     }
   }
 }
@@ -491,8 +559,12 @@ void ReplaceCallExpr::getNewParmRefStr(const DeclRefExpr *DE,
     }
 
     const Expr *Arg = TheCallExpr->getArg(Pos)->IgnoreParenImpCasts();
-    RewriteHelper->getExprString(Arg, ParmRefStr);
-    ParmRefStr = "(" + ParmRefStr + ")";
+    // Read the argument text in place -- every parm reference in the
+    // return expression triggers one of these, so skip the temporary
+    // string.  The surrounding parentheses added below also cover a
+    // stripped comma operator.
+    llvm::StringRef ArgRef;
+    RewriteHelper->getExprStringRef(Arg, ArgRef);
 
     const Type *ParmT = PD->getType().getTypePtr();
     const Type *CanParmT = Context->getCanonicalType(ParmT);
@@ -500,8 +572,11 @@ void ReplaceCallExpr::getNewParmRefStr(const DeclRefExpr *DE,
     const Type *CanArgT = Context->getCanonicalType(ArgT);
     if (CanParmT != CanArgT) {
       std::string TypeCastStr = PD->getType().getAsString();
-      ParmRefStr = "(" + TypeCastStr + ")" + ParmRefStr;
+      ParmRefStr += "(" + TypeCastStr + ")";
     }
+    ParmRefStr += "(";
+    ParmRefStr.append(ArgRef.data(), ArgRef.size());
+    ParmRefStr += ")";
     return;
   }
   TransAssert(0 && "Unreachable Code!");
@@ -594,14 +669,38 @@ void ReplaceCallExpr::replaceCallExpr(void)
     }
   }
 
-  std::string RetString;
-  RewriteHelper->getExprString(RetE, RetString);
+  // the serialized return expression is per-callee, not per-site
+  llvm::DenseMap<ReturnStmt *, std::string>::iterator RSI =
+    RetValStrCache.find(TheReturnStmt);
+  if (RSI == RetValStrCache.end()) {
+    std::string Str;
+    RewriteHelper->getExprString(RetE, Str);
+    RSI = RetValStrCache.insert(std::make_pair(TheReturnStmt, Str)).first;
+  }
+  std::string RetString = (*RSI).second;
 
   replaceParmRefs(RetString, RetE, ParmRefToStrMap);
   std::string ParenRetString = "(" + RetString + ")";
   RewriteHelper->replaceExpr(TheCallExpr, ParenRetString);
 }
 
+void ReplaceCallExpr::replaceAllCallExprs(void)
+{
+  // Guard the return expression's own text first: a recursive call
+  // site inside it would invalidate the cached string for the
+  // remaining sites, so such a site fails registration and is skipped.
+  RewriteHelper->registerEditRange(
+    TheReturnStmt->getRetValue()->getSourceRange());
+
+  for (SmallVector<CallExpr *, 10>::iterator I = TheBatchCallExprs.begin(),
+       E = TheBatchCallExprs.end(); I != E; ++I) {
+    if (!RewriteHelper->registerEditRange((*I)->getSourceRange()))
+      continue;
+    TheCallExpr = (*I);
+    replaceCallExpr();
+  }
+}
+
 ReplaceCallExpr::~ReplaceCallExpr(void)
 {
   delete CollectionVisitor;
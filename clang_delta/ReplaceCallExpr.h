@@ -11,6 +11,7 @@
 #ifndef REPLACE_CALL_EXPR_H
 #define REPLACE_CALL_EXPR_H
 
+#include <map>
 #include <string>
 #include <vector>
 #include <utility>
@@ -64,6 +65,8 @@ private:
 
   void replaceCallExpr(void);
 
+  void replaceAllCallExprs(void);
+
   void getNewParmRefStr(const clang::DeclRefExpr *DE, 
                         std::string &ParmRefStr);
 
@@ -83,6 +86,11 @@ private:
   void getParmPosVector(ParameterPosVector &PosVector,
                         clang::ReturnStmt *RS, clang::CallExpr *CE);
 
+  const ParameterPosVector &getCachedParmPosVector(clang::ReturnStmt *RS,
+                                                   clang::CallExpr *CE);
+
+  unsigned int getRetValNumExprs(clang::ReturnStmt *RS);
+
   bool hasBadEffect(const ParameterPosVector &PosVector,
                     clang::ReturnStmt *RS, clang::CallExpr *CE);
 
@@ -97,6 +105,19 @@ private:
 
   llvm::SmallVector<clang::CallExpr *, 10> AllCallExprs;
 
+  // per-callee analysis results, derived once per parse instead of
+  // once per call site
+  std::map<std::pair<clang::FunctionDecl *, clang::ReturnStmt *>,
+           ParameterPosVector> ParmPosCache;
+
+  llvm::DenseMap<clang::ReturnStmt *, unsigned int> RetValNumExprsCache;
+
+  llvm::DenseMap<clang::ReturnStmt *, std::string> RetValStrCache;
+
+  // every valid call site of the selected callee/return pair when a
+  // batch candidate is chosen
+  llvm::SmallVector<clang::CallExpr *, 10> TheBatchCallExprs;
+
   clang::CallExpr *TheCallExpr;
 
   clang::ReturnStmt *TheReturnStmt;
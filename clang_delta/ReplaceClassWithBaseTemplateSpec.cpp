@@ -18,6 +18,7 @@
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
 
+#include "ClassHierarchyIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -32,32 +33,6 @@ static const char *DescriptionMsg =
 static RegisterTransformation<ReplaceClassWithBaseTemplateSpec>
          Trans("replace-class-with-base-template-spec", DescriptionMsg);
 
-class ReplaceClassWithBaseTemplateSpecVisitor : public 
-  RecursiveASTVisitor<ReplaceClassWithBaseTemplateSpecVisitor> {
-
-public:
-  explicit ReplaceClassWithBaseTemplateSpecVisitor(
-             ReplaceClassWithBaseTemplateSpec *Instance)
-    : ConsumerInstance(Instance)
-  { }
-
-  bool VisitCXXRecordDecl(CXXRecordDecl *CXXRD);
-
-private:
-  ReplaceClassWithBaseTemplateSpec *ConsumerInstance;
-};
-
-bool ReplaceClassWithBaseTemplateSpecVisitor::VisitCXXRecordDecl(
-       CXXRecordDecl *CXXRD)
-{
-  if (ConsumerInstance->isInIncludedFile(CXXRD) ||
-      ConsumerInstance->isSpecialRecordDecl(CXXRD) ||
-      !CXXRD->hasDefinition())
-    return true;
-  ConsumerInstance->handleOneCXXRecordDecl(CXXRD->getDefinition());
-  return true;
-}
-
 class ReplaceClassWithBaseTemplateSpecRewriteVisitor : public
   RecursiveASTVisitor<ReplaceClassWithBaseTemplateSpecRewriteVisitor> {
 public:
@@ -88,13 +63,22 @@ bool ReplaceClassWithBaseTemplateSpecRewriteVisitor::VisitRecordTypeLoc(
   return true;
 }
 
-void ReplaceClassWithBaseTemplateSpec::Initialize(ASTContext &context) 
+void ReplaceClassWithBaseTemplateSpec::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
-  CollectionVisitor = new ReplaceClassWithBaseTemplateSpecVisitor(this);
   RewriteVisitor = new ReplaceClassWithBaseTemplateSpecRewriteVisitor(this);
 }
 
+void ReplaceClassWithBaseTemplateSpec::prepareSharedAnalysis(ASTContext &Ctx)
+{
+  if (TransformationManager::isCLangOpt() ||
+      TransformationManager::isOpenCLLangOpt())
+    return;
+  // Build the shared class sweep once on the freshly parsed AST; the
+  // per-counter work below then never touches a RecursiveASTVisitor.
+  ClassHierarchyIndex::GetInstance(Ctx);
+}
+
 void ReplaceClassWithBaseTemplateSpec::HandleTranslationUnit(ASTContext &Ctx)
 {
   if (TransformationManager::isCLangOpt() ||
@@ -102,7 +86,18 @@ void ReplaceClassWithBaseTemplateSpec::HandleTranslationUnit(ASTContext &Ctx)
     ValidInstanceNum = 0;
   }
   else {
-    CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    // Replay the cached visitation sequence with the filters the private
+    // collection visitor used to apply, keeping instance numbers stable.
+    const ClassHierarchyIndex::RecordVector &Records =
+      ClassHierarchyIndex::GetInstance(Ctx)->getVisitedRecords();
+    for (ClassHierarchyIndex::RecordVector::const_iterator
+         I = Records.begin(), E = Records.end(); I != E; ++I) {
+      CXXRecordDecl *CXXRD = (*I);
+      if (isInIncludedFile(CXXRD) || isSpecialRecordDecl(CXXRD) ||
+          !CXXRD->hasDefinition())
+        continue;
+      handleOneCXXRecordDecl(CXXRD->getDefinition());
+    }
   }
 
   if (QueryInstanceOnly)
@@ -165,7 +160,6 @@ void ReplaceClassWithBaseTemplateSpec::removeBaseSpecifier(void)
 
 ReplaceClassWithBaseTemplateSpec::~ReplaceClassWithBaseTemplateSpec(void)
 {
-  delete CollectionVisitor;
   delete RewriteVisitor;
 }
 
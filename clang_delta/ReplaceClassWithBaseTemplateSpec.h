@@ -18,17 +18,14 @@ namespace clang {
   class ASTContext;
 }
 
-class ReplaceClassWithBaseTemplateSpecVisitor;
 class ReplaceClassWithBaseTemplateSpecRewriteVisitor;
 
 class ReplaceClassWithBaseTemplateSpec : public Transformation {
-friend class ReplaceClassWithBaseTemplateSpecVisitor;
 friend class ReplaceClassWithBaseTemplateSpecRewriteVisitor;
 
 public:
   ReplaceClassWithBaseTemplateSpec(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       RewriteVisitor(NULL),
       TheCXXRecord(NULL),
       TheBaseName("")
@@ -36,6 +33,8 @@ public:
 
   ~ReplaceClassWithBaseTemplateSpec(void);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
 private:
   virtual void Initialize(clang::ASTContext &context);
 
@@ -45,8 +44,6 @@ private:
 
   void removeBaseSpecifier(void);
 
-  ReplaceClassWithBaseTemplateSpecVisitor *CollectionVisitor;
-
   ReplaceClassWithBaseTemplateSpecRewriteVisitor *RewriteVisitor;
 
   const clang::CXXRecordDecl *TheCXXRecord;
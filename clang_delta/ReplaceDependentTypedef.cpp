@@ -19,6 +19,11 @@
 #include "clang/Basic/SourceManager.h"
 
 #include "TransformationManager.h"
+#include "TypeDependencyIndex.h"
+
+#include "llvm/ADT/DenseMap.h"
+
+#include <algorithm>
 
 using namespace clang;
 
@@ -82,6 +87,7 @@ void ReplaceDependentTypedef::HandleTranslationUnit(ASTContext &Ctx)
   }
   else {
     CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    addCombinedCandidates(Ctx);
   }
 
   if (QueryInstanceOnly)
@@ -92,8 +98,12 @@ void ReplaceDependentTypedef::HandleTranslationUnit(ASTContext &Ctx)
     return;
   }
 
+  if (ActiveEntries.empty() && (TheEntryIdx >= 0))
+    ActiveEntries.push_back(&TypedefEntries[TheEntryIdx]);
+  TransAssert(!ActiveEntries.empty() && "NULL Active Entries!");
+
   Ctx.getDiagnostics().setSuppressAllDiagnostics(false);
-  rewriteTypedefDecl();
+  rewriteTypedefDecls();
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
@@ -142,28 +152,97 @@ void ReplaceDependentTypedef::handleOneTypedefDecl(const TypedefNameDecl *D)
   bool Typename = false;
   if (!getTypeString(D->getUnderlyingType(), Str, Typename))
     return;
-  std::string TdefTyStr = "";
-  D->getUnderlyingType().getAsStringInternal(
-    TdefTyStr, getPrintingPolicy());
+  // every typedef in the file goes through this comparison, and the
+  // same underlying types recur; the memoized spelling makes repeats a
+  // hash lookup
+  const std::string &TdefTyStr =
+    getCachedTypeString(D->getUnderlyingType());
   if (Str == TdefTyStr)
     return;
 
+  TypedefEntry Entry = { D, Str, Typename };
+  TypedefEntries.push_back(Entry);
+
   ValidInstanceNum++;
-  if (ValidInstanceNum == TransformationCounter) {
-    TheTypedefDecl = D;
-    TheTyName = Str;
-    NeedTypenameKeyword = Typename;
+  if (ValidInstanceNum == TransformationCounter)
+    TheEntryIdx = TypedefEntries.size() - 1;
+}
+
+// Appends one combined instance for every dependency-connected cluster
+// of two or more rewritable typedefs, numbered after all the
+// per-typedef instances so the existing counters keep their meaning.
+// Typedef chains usually stand or fall together: replacing one link
+// while its neighbours still spell the old name tends to fail the
+// interestingness test, and the cluster candidates rewrite the whole
+// chain in one probe.
+void ReplaceDependentTypedef::addCombinedCandidates(ASTContext &Ctx)
+{
+  if (TypedefEntries.size() < 2)
+    return;
+
+  TypeDependencyIndex *Index = TypeDependencyIndex::GetInstance(Ctx);
+
+  llvm::DenseMap<const Decl *, unsigned> EntryIdxMap;
+  for (unsigned I = 0; I < TypedefEntries.size(); ++I)
+    EntryIdxMap[TypedefEntries[I].D->getCanonicalDecl()] = I;
+
+  llvm::SmallVector<bool, 8> Grouped(TypedefEntries.size(), false);
+  for (unsigned I = 0; I < TypedefEntries.size(); ++I) {
+    if (Grouped[I])
+      continue;
+
+    llvm::SmallVector<unsigned, 8> Cluster;
+    Cluster.push_back(I);
+    Grouped[I] = true;
+    unsigned Next = 0;
+    while (Next < Cluster.size()) {
+      const Decl *CanonicalD =
+        TypedefEntries[Cluster[Next]].D->getCanonicalDecl();
+      Next++;
+      // neighbours in either direction: the typedefs this one names and
+      // the typedefs naming it
+      for (int Dir = 0; Dir < 2; ++Dir) {
+        const TypeDependencyIndex::DeclVector *Edges =
+          Dir ? Index->getDependents(CanonicalD)
+              : Index->getReferences(CanonicalD);
+        if (!Edges)
+          continue;
+        for (unsigned J = 0; J < Edges->size(); ++J) {
+          llvm::DenseMap<const Decl *, unsigned>::iterator EI =
+            EntryIdxMap.find((*Edges)[J]);
+          if ((EI == EntryIdxMap.end()) || Grouped[EI->second])
+            continue;
+          Cluster.push_back(EI->second);
+          Grouped[EI->second] = true;
+        }
+      }
+    }
+
+    if (Cluster.size() < 2)
+      continue;
+
+    ValidInstanceNum++;
+    if (ValidInstanceNum != TransformationCounter)
+      continue;
+
+    // rewrite the cluster in collection order
+    std::sort(Cluster.begin(), Cluster.end());
+    for (unsigned J = 0; J < Cluster.size(); ++J)
+      ActiveEntries.push_back(&TypedefEntries[Cluster[J]]);
   }
 }
 
-void ReplaceDependentTypedef::rewriteTypedefDecl()
+void ReplaceDependentTypedef::rewriteTypedefDecls()
 {
-  std::string NewStr = "typedef ";
-  if (NeedTypenameKeyword)
-    NewStr += "typename ";
-  NewStr = NewStr + TheTyName + " " + TheTypedefDecl->getNameAsString();
-  SourceRange Range = TheTypedefDecl->getSourceRange();
-  TheRewriter.ReplaceText(Range, NewStr);
+  for (unsigned I = 0; I < ActiveEntries.size(); ++I) {
+    const TypedefEntry *Entry = ActiveEntries[I];
+    std::string NewStr = "typedef ";
+    if (Entry->NeedTypenameKeyword)
+      NewStr += "typename ";
+    NewStr = NewStr + Entry->TyName + " " + Entry->D->getNameAsString();
+    SourceRange Range = Entry->D->getSourceRange();
+    TheRewriter.ReplaceText(Range, NewStr);
+  }
 }
 
 ReplaceDependentTypedef::~ReplaceDependentTypedef()
@@ -13,6 +13,7 @@
 
 #include <string>
 #include "Transformation.h"
+#include "llvm/ADT/SmallVector.h"
 
 namespace clang {
   class DeclGroupRef;
@@ -36,15 +37,23 @@ public:
   ReplaceDependentTypedef(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
       CollectionVisitor(NULL),
-      TheTyName(""),
-      TheTypedefDecl(NULL),
-      NeedTypenameKeyword(false)
+      TheEntryIdx(-1)
   {}
 
   ~ReplaceDependentTypedef();
 
 private:
 
+  // One rewritable typedef: the declaration plus the replacement
+  // spelling computed during collection.
+  struct TypedefEntry {
+    const clang::TypedefNameDecl *D;
+    std::string TyName;
+    bool NeedTypenameKeyword;
+  };
+
+  typedef llvm::SmallVector<TypedefEntry, 8> TypedefEntryVector;
+
   virtual void Initialize(clang::ASTContext &context);
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
@@ -53,15 +62,21 @@ private:
 
   bool isValidType(const clang::QualType &QT);
 
-  void rewriteTypedefDecl();
+  void addCombinedCandidates(clang::ASTContext &Ctx);
+
+  void rewriteTypedefDecls();
 
   ReplaceDependentTypedefCollectionVisitor *CollectionVisitor;
 
-  std::string TheTyName;
+  TypedefEntryVector TypedefEntries;
 
-  const clang::TypedefNameDecl *TheTypedefDecl;
+  // the entries the selected instance rewrites: one for a per-typedef
+  // instance, a whole dependency-connected cluster for a combined one
+  llvm::SmallVector<const TypedefEntry *, 8> ActiveEntries;
 
-  bool NeedTypenameKeyword;
+  // index into TypedefEntries of the per-typedef instance matching
+  // TransformationCounter, or -1
+  long TheEntryIdx;
 
   // Unimplemented
   ReplaceDependentTypedef();
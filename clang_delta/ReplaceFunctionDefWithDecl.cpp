@@ -38,6 +38,8 @@ public:
     : ConsumerInstance(Instance)
   { }
 
+  bool TraverseDecl(Decl *D);
+
   bool VisitFunctionDecl(FunctionDecl *FD);
 
 private:
@@ -45,6 +47,25 @@ private:
   ReplaceFunctionDefWithDecl *ConsumerInstance;
 };
 
+// Short-circuit on the preserved routine: don't walk its subtree at
+// all instead of visiting every nested declaration just to discard it.
+// The preserved function is usually the giant definition under
+// investigation, i.e. the bulk of the AST.  Note that definitions
+// local to the preserved body (e.g. local class methods) are then
+// never counted as instances, which is what preserving the routine
+// intact means.
+bool ReplaceFunctionDefWithDeclCollectionVisitor::TraverseDecl(Decl *D)
+{
+  if (D) {
+    if (FunctionDecl *FD = dyn_cast<FunctionDecl>(D)) {
+      if (ConsumerInstance->isPreservedRoutine(FD))
+        return true;
+    }
+  }
+  return RecursiveASTVisitor<ReplaceFunctionDefWithDeclCollectionVisitor>
+           ::TraverseDecl(D);
+}
+
 bool ReplaceFunctionDefWithDeclCollectionVisitor::VisitFunctionDecl(
        FunctionDecl *FD)
 {
@@ -314,9 +335,10 @@ void ReplaceFunctionDefWithDecl::doRewriting()
 
 void ReplaceFunctionDefWithDecl::addOneFunctionDef(const FunctionDecl *FD)
 {
-  // If DoPreserveRoutine is set, and our current routine is the one we're
-  // preserving, then skip it
-  if (DoPreserveRoutine && FD->getQualifiedNameAsString() == PreserveRoutine)
+  // The collection visitor already prunes the preserved routine's
+  // subtree, but instantiated definitions can reach here through other
+  // traversal paths, so keep the name check as a backstop.
+  if (isPreservedRoutine(FD))
     return;
 
   ValidInstanceNum++;
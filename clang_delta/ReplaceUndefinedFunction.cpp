@@ -74,7 +74,16 @@ bool ReplaceUndefFuncCollectionVisitor::VisitFunctionDecl(FunctionDecl *FD)
 
 bool ReplaceUndefFuncRewriteVisitor::VisitFunctionDecl(FunctionDecl *FD)
 {
-  if (FD->getCanonicalDecl() != ConsumerInstance->ReplacedFunctionDecl)
+  const FunctionDecl *CanonicalFD = FD->getCanonicalDecl();
+  if (ConsumerInstance->DoAllFunctions) {
+    if (!ConsumerInstance->ReplacementMap.count(CanonicalFD))
+      return true;
+    TransAssert(!FD->hasBody() && "FD cannot have any definition!");
+    ConsumerInstance->RewriteHelper->removeDecl(FD);
+    return true;
+  }
+
+  if (CanonicalFD != ConsumerInstance->ReplacedFunctionDecl)
     return true;
 
   TransAssert(!FD->hasBody() && "FD cannot have any definition!");
@@ -89,6 +98,17 @@ bool ReplaceUndefFuncRewriteVisitor::VisitCallExpr(CallExpr *CE)
   if (!FD || dyn_cast<CXXMethodDecl>(FD))
     return true;
 
+  if (ConsumerInstance->DoAllFunctions) {
+    ReplaceUndefinedFunction::FunctionToFunctionMap::iterator I =
+      ConsumerInstance->ReplacementMap.find(FD->getCanonicalDecl());
+    if (I != ConsumerInstance->ReplacementMap.end()) {
+      ConsumerInstance->TheRewriter.ReplaceText(CE->getBeginLoc(),
+        (*I).first->getNameAsString().size(),
+        (*I).second->getNameAsString());
+    }
+    return true;
+  }
+
   if (FD->getCanonicalDecl() == ConsumerInstance->ReplacedFunctionDecl) {
     ConsumerInstance->TheRewriter.ReplaceText(CE->getBeginLoc(),
       ConsumerInstance->ReplacedFunctionDecl->getNameAsString().size(),
@@ -143,20 +163,37 @@ void ReplaceUndefinedFunction::doAnalysis(void)
       }
     }
   }
+
+  // one more instance, appended after the per-function ones, which folds
+  // every replaceable function onto its bucket representative in a single
+  // rewrite --- linker-error reproducers carry hundreds of undefined
+  // externs and replacing them one parse at a time dominates the pass
+  if (ValidInstanceNum >= 2) {
+    ValidInstanceNum++;
+    if (ValidInstanceNum == TransformationCounter) {
+      DoAllFunctions = true;
+      for (FunctionSetMap::iterator I = ReplaceableFunctions.begin(),
+           E = ReplaceableFunctions.end(); I != E; ++I) {
+        const FunctionDeclSet *FDSet = (*I).second;
+        if (!FDSet)
+          continue;
+        for (FunctionDeclSet::iterator FI = FDSet->begin(),
+             FE = FDSet->end(); FI != FE; ++FI) {
+          ReplacementMap[(*FI)] = (*I).first;
+        }
+      }
+    }
+  }
 }
 
 void ReplaceUndefinedFunction::handleOneFunctionDecl(const FunctionDecl *FD)
 {
-  QualType FDQualTy = FD->getType();
-  for (FunctionSetMap::iterator I = ReplaceableFunctions.begin(),
-       E = ReplaceableFunctions.end(); I != E; ++I) {
-    const FunctionDecl *ReplaceableFD = (*I).first;
+  // hasSameType compares canonical types, and canonical QualTypes are
+  // uniqued, so the opaque pointer is a ready-made signature hash key
+  const void *Sig = Context->getCanonicalType(FD->getType()).getAsOpaquePtr();
+  SignatureToSetMap::iterator I = SignatureIndex.find(Sig);
+  if (I != SignatureIndex.end()) {
     FunctionDeclSet *FDSet = (*I).second;
-    QualType QualTy = ReplaceableFD->getType();
-
-    if (!Context->hasSameType(FDQualTy, QualTy))
-      continue;
-
     TransAssert(FDSet && "NULL FDSet");
     FDSet->insert(FD);
     return;
@@ -164,6 +201,7 @@ void ReplaceUndefinedFunction::handleOneFunctionDecl(const FunctionDecl *FD)
 
   FunctionDeclSet *FDSet = new FunctionDeclSet();
   ReplaceableFunctions[FD] = FDSet;
+  SignatureIndex[Sig] = FDSet;
 }
 
 ReplaceUndefinedFunction::~ReplaceUndefinedFunction(void)
@@ -12,6 +12,7 @@
 #define REPLACE_UNDEFINED_FUNCTION_H
 
 #include <string>
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SetVector.h"
 #include "Transformation.h"
@@ -36,7 +37,8 @@ public:
       CollectionVisitor(NULL),
       RewriteVisitor(NULL),
       ReplacingFunctionDecl(NULL),
-      ReplacedFunctionDecl(NULL)
+      ReplacedFunctionDecl(NULL),
+      DoAllFunctions(false)
   { }
 
   ~ReplaceUndefinedFunction(void);
@@ -49,6 +51,13 @@ private:
   typedef llvm::MapVector<const clang::FunctionDecl *, FunctionDeclSet *>
             FunctionSetMap;
 
+  typedef llvm::DenseMap<const void *, FunctionDeclSet *>
+            SignatureToSetMap;
+
+  typedef llvm::DenseMap<const clang::FunctionDecl *,
+                         const clang::FunctionDecl *>
+            FunctionToFunctionMap;
+
   virtual void Initialize(clang::ASTContext &context);
 
   virtual void HandleTranslationUnit(clang::ASTContext &Ctx);
@@ -59,6 +68,14 @@ private:
 
   FunctionSetMap ReplaceableFunctions;
 
+  // canonical function type -> replacement set; canonical QualTypes are
+  // uniqued by the ASTContext, so one hash lookup stands in for the
+  // pairwise hasSameType probes over all existing buckets
+  SignatureToSetMap SignatureIndex;
+
+  // replaced decl -> replacing decl, filled only for the batch instance
+  FunctionToFunctionMap ReplacementMap;
+
   ReplaceUndefFuncCollectionVisitor *CollectionVisitor;
 
   ReplaceUndefFuncRewriteVisitor *RewriteVisitor;
@@ -67,6 +84,8 @@ private:
   
   const clang::FunctionDecl *ReplacedFunctionDecl;
 
+  bool DoAllFunctions;
+
   // Unimplemented
   ReplaceUndefinedFunction(void);
 
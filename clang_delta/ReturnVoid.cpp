@@ -43,6 +43,8 @@ public:
 
   bool VisitReturnStmt(ReturnStmt *RS);
 
+  bool VisitCallExpr(CallExpr *CE);
+
 private:
 
   ReturnVoid *ConsumerInstance;
@@ -51,6 +53,8 @@ private:
 
   bool rewriteReturnStmt(ReturnStmt *RS);
 
+  bool rewriteCallSite(CallExpr *CE);
+
 };
 
 
@@ -440,6 +444,38 @@ bool RVASTVisitor::VisitReturnStmt(ReturnStmt *RS)
   return true;
 }
 
+bool RVASTVisitor::rewriteCallSite(CallExpr *CE)
+{
+  // After the conversion the callee returns void, so a call site that
+  // consumes the old return value would not type-check any more.
+  // Wrapping the call in a comma expression keeps the call itself and
+  // yields a 0 that converts wherever the old value was used; for a
+  // plain statement call the extra (..., 0) is harmless.
+  llvm::StringRef CallStr;
+  if (!ConsumerInstance->RewriteHelper->getExprStringRef(CE, CallStr))
+    return true;
+
+  std::string NewCallStr = "(";
+  NewCallStr.append(CallStr.data(), CallStr.size());
+  NewCallStr += ", 0)";
+
+  ConsumerInstance->Rewritten = true;
+  return ConsumerInstance->RewriteHelper->replaceExpr(CE, NewCallStr);
+}
+
+bool RVASTVisitor::VisitCallExpr(CallExpr *CE)
+{
+  if (ConsumerInstance->Mode != ReturnVoid::EMode::WithCallSites)
+    return true;
+
+  const FunctionDecl *Callee = CE->getDirectCallee();
+  if (!Callee ||
+      (Callee->getCanonicalDecl() != ConsumerInstance->TheFuncDecl))
+    return true;
+
+  return rewriteCallSite(CE);
+}
+
 ReturnVoid::~ReturnVoid(void)
 {
   delete CollectionVisitor;
@@ -19,6 +19,7 @@
 namespace clang {
   class DeclGroupRef;
   class ASTContext;
+  class CallExpr;
   class FunctionDecl;
   class ReturnStmt;
 }
@@ -33,13 +34,17 @@ friend class RVCollectionVisitor;
 
 public:
 
-  ReturnVoid(const char *TransName, const char *Desc)
+  enum class EMode { ProtoOnly, WithCallSites };
+
+  ReturnVoid(const char *TransName, const char *Desc,
+             EMode Mode = EMode::ProtoOnly)
     : Transformation(TransName, Desc),
       CollectionVisitor(NULL),
       TransformationASTVisitor(NULL),
       TheFuncDecl(NULL),
       FuncDefStartPos(NULL),
-      FuncDefEndPos(NULL)
+      FuncDefEndPos(NULL),
+      Mode(Mode)
   { }
 
   ~ReturnVoid(void);
@@ -77,6 +82,8 @@ private:
 
   const char *FuncDefEndPos;
 
+  EMode Mode;
+
   // Unimplemented
   ReturnVoid(void);
 
@@ -0,0 +1,28 @@
+//===----------------------------------------------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "ReturnVoid.h"
+
+#include "TransformationManager.h"
+
+static const char *DescriptionMsg =
+"Make a function return void and rewrite all its call sites \
+in the same invocation. Each call f(...) becomes (f(...), 0), \
+so a caller that used the old return value still gets a value \
+and the candidate stays self-consistent without follow-up \
+cleanup invocations.\n";
+
+static RegisterTransformation<ReturnVoid, ReturnVoid::EMode>
+         Trans("return-void-with-call-sites", DescriptionMsg,
+               ReturnVoid::EMode::WithCallSites);
+
+
+// Implementation is in ReturnVoid.cpp
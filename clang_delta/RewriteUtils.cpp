@@ -38,6 +38,8 @@ RewriteUtils *RewriteUtils::GetInstance(Rewriter *RW)
   if (RewriteUtils::Instance) {
     RewriteUtils::Instance->TheRewriter = RW;
     RewriteUtils::Instance->SrcManager = &(RW->getSourceMgr());
+    RewriteUtils::Instance->EditRanges.clear();
+    RewriteUtils::Instance->resetDecompCache();
     return RewriteUtils::Instance;
   }
 
@@ -46,9 +48,51 @@ RewriteUtils *RewriteUtils::GetInstance(Rewriter *RW)
 
   RewriteUtils::Instance->TheRewriter = RW;
   RewriteUtils::Instance->SrcManager = &(RW->getSourceMgr());
+  RewriteUtils::Instance->resetDecompCache();
   return RewriteUtils::Instance;
 }
 
+void RewriteUtils::resetDecompCache(void)
+{
+  for (unsigned I = 0; I < DecompCacheSize; ++I) {
+    DecompCache[I].RawLoc = 0;
+    DecompCache[I].BufferStart = NULL;
+  }
+}
+
+llvm::SmallString<256> &RewriteUtils::getScratchBuffer(void)
+{
+  ScratchBuffer.clear();
+  return ScratchBuffer;
+}
+
+bool RewriteUtils::registerEditRange(const SourceRange &Range)
+{
+  SourceLocation Begin = Range.getBegin();
+  if (Begin.isMacroID())
+    Begin = SrcManager->getExpansionLoc(Begin);
+  int RangeSize = TheRewriter->getRangeSize(Range);
+  // an unrewritable range cannot conflict, so let the caller proceed
+  // and fail the way it always has
+  if (Begin.isInvalid() || (RangeSize < 0))
+    return true;
+
+  unsigned BeginOff = SrcManager->getFileOffset(Begin);
+  unsigned EndOff = BeginOff + static_cast<unsigned>(RangeSize);
+
+  std::map<unsigned, unsigned>::iterator Next =
+    EditRanges.lower_bound(BeginOff);
+  if ((Next != EditRanges.end()) && (Next->first < EndOff))
+    return false;
+  if (Next != EditRanges.begin()) {
+    --Next;
+    if (Next->second > BeginOff)
+      return false;
+  }
+  EditRanges[BeginOff] = EndOff;
+  return true;
+}
+
 void RewriteUtils::Finalize(void)
 {
   if (RewriteUtils::Instance) {
@@ -70,17 +114,66 @@ SourceRange RewriteUtils::getRealSourceRange(SourceRange Range) {
   return SourceRange(getRealLocation(StartLoc), getRealLocation(EndLoc));
 }
 
-// copied from Rewriter.cpp
+// copied from Rewriter.cpp, with a direct-mapped cache in front: the
+// decomposition walks SLoc tables that do not change for the lifetime
+// of the binding, so a repeated location is answered without touching
+// the SourceManager.  The cache is only consulted for the bound
+// SourceManager -- a few callers thread their own through the
+// parameter.
 unsigned RewriteUtils::getLocationOffsetAndFileID(SourceLocation Loc,
                                                   FileID &FID,
                                                   SourceManager *SrcManager)
 {
   assert(Loc.isValid() && "Invalid location");
+  if (SrcManager != this->SrcManager) {
+    std::pair<FileID,unsigned> V = SrcManager->getDecomposedLoc(Loc);
+    FID = V.first;
+    return V.second;
+  }
+
+  unsigned Raw = Loc.getRawEncoding();
+  DecompEntry &Entry = DecompCache[Raw % DecompCacheSize];
+  if (Entry.RawLoc == Raw) {
+    FID = Entry.FID;
+    return Entry.Offset;
+  }
+
   std::pair<FileID,unsigned> V = SrcManager->getDecomposedLoc(Loc);
+  Entry.RawLoc = Raw;
+  Entry.FID = V.first;
+  Entry.Offset = V.second;
+  Entry.BufferStart = NULL;
   FID = V.first;
   return V.second;
 }
 
+void RewriteUtils::getRangeOffsets(SourceRange Range,
+                                   unsigned &BeginOff,
+                                   unsigned &EndOff)
+{
+  FileID BeginFID, EndFID;
+  BeginOff = getLocationOffsetAndFileID(Range.getBegin(), BeginFID,
+                                        SrcManager);
+  EndOff = getLocationOffsetAndFileID(Range.getEnd(), EndFID, SrcManager);
+  TransAssert((BeginFID == EndFID) && "Range endpoints cross files!");
+}
+
+const char *RewriteUtils::getCharacterDataCached(SourceLocation Loc)
+{
+  if (Loc.isInvalid() || Loc.isMacroID())
+    return SrcManager->getCharacterData(Loc);
+
+  unsigned Raw = Loc.getRawEncoding();
+  DecompEntry &Entry = DecompCache[Raw % DecompCacheSize];
+  if ((Entry.RawLoc != Raw) || !Entry.BufferStart) {
+    FileID FID;
+    getLocationOffsetAndFileID(Loc, FID, SrcManager);
+    // the decomposition above (re)filled this slot for Loc
+    Entry.BufferStart = SrcManager->getBufferData(FID).data();
+  }
+  return Entry.BufferStart + Entry.Offset;
+}
+
 unsigned RewriteUtils::getOffsetBetweenLocations(SourceLocation StartLoc,
                                             SourceLocation EndLoc,
                                             SourceManager *SrcManager)
@@ -266,7 +359,7 @@ bool RewriteUtils::removeParamFromFuncDecl(const ParmVarDecl *PV,
     RangeSize = PV->getNameAsString().size();
   }
   else if (EndLoc.isInvalid()) {
-    const char *Buf = SrcManager->getCharacterData(StartLoc);
+    const char *Buf = getCharacterDataCached(StartLoc);
     if ((ParamPos == 0) && (NumParams == 1)) {
       RangeSize = getOffsetUntil(Buf, ')');
     }
@@ -290,8 +383,7 @@ bool RewriteUtils::removeParamFromFuncDecl(const ParmVarDecl *PV,
   // The param is the last parameter
   if (ParamPos == static_cast<int>(NumParams - 1)) {
     int Offset = 0;
-    const char *StartBuf = 
-      SrcManager->getCharacterData(StartLoc);
+    const char *StartBuf = getCharacterDataCached(StartLoc);
 
     TransAssert(StartBuf && "Invalid start buffer!");
     while (*StartBuf != ',') {
@@ -313,7 +405,7 @@ bool RewriteUtils::removeParamFromFuncDecl(const ParmVarDecl *PV,
   // getEnd() points to the start of "x"
   // See the comments on getRangeSize in clang/lib/Rewriter/Rewriter.cpp
   int NewRangeSize = 0;
-  const char *StartBuf = SrcManager->getCharacterData(StartLoc);
+  const char *StartBuf = getCharacterDataCached(StartLoc);
 
   while (NewRangeSize < RangeSize) {
     StartBuf++;
@@ -644,8 +736,8 @@ bool RewriteUtils::removeVarFromDeclStmt(DeclStmt *DS,
   return !(TheRewriter->RemoveText(SourceRange(PrevDeclEndLoc, VarEndLoc)));
 }
 
-bool RewriteUtils::getExprString(const Expr *E, 
-                                 std::string &ES)
+bool RewriteUtils::getExprStringRef(const Expr *E,
+                                    llvm::StringRef &ES)
 {
   SourceRange ExprRange = E->getSourceRange();
   SourceLocation StartLoc = ExprRange.getBegin();
@@ -669,22 +761,37 @@ bool RewriteUtils::getExprString(const Expr *E,
 
   const char *StartBuf = SrcManager->getCharacterData(StartLoc);
 
-  ES.assign(StartBuf, RangeSize);
+  ES = llvm::StringRef(StartBuf, RangeSize);
+  return true;
+}
+
+bool RewriteUtils::getExprString(const Expr *E,
+                                 std::string &ES)
+{
+  llvm::StringRef ExprRef;
+  if (!getExprStringRef(E, ExprRef)) {
+    ES = ExprRef.str();
+    return false;
+  }
+
+  ES.assign(ExprRef.data(), ExprRef.size());
 
   const BinaryOperator *BinOp = dyn_cast<BinaryOperator>(E);
 
   // Keep the semantics of Comma operator
-  if (BinOp && (BinOp->getOpcode() == BO_Comma))
-    ES = "(" + ES + ")";
+  if (BinOp && (BinOp->getOpcode() == BO_Comma)) {
+    ES.insert(ES.begin(), '(');
+    ES += ')';
+  }
 
   return true;
 }
 
-bool RewriteUtils::getStmtString(const Stmt *S, 
-                                 std::string &Str)
+bool RewriteUtils::getStmtStringRef(const Stmt *S,
+                                    llvm::StringRef &Str)
 {
   SourceRange StmtRange = S->getSourceRange();
-   
+
   int RangeSize = TheRewriter->getRangeSize(StmtRange);
   if (RangeSize == -1)
     return false;
@@ -692,8 +799,18 @@ bool RewriteUtils::getStmtString(const Stmt *S,
   SourceLocation StartLoc = StmtRange.getBegin();
   const char *StartBuf = SrcManager->getCharacterData(StartLoc);
 
-  Str.assign(StartBuf, RangeSize);
+  Str = llvm::StringRef(StartBuf, RangeSize);
+  return true;
+}
 
+bool RewriteUtils::getStmtString(const Stmt *S,
+                                 std::string &Str)
+{
+  llvm::StringRef StmtRef;
+  if (!getStmtStringRef(S, StmtRef))
+    return false;
+
+  Str.assign(StmtRef.data(), StmtRef.size());
   return true;
 }
 
@@ -804,9 +921,12 @@ bool RewriteUtils::addLocalVarToFunc(const std::string &VarStr,
   else
     IndentStr = getStmtIndentString((*I), SrcManager);
 
-  std::string NewVarStr = "\n" + IndentStr + VarStr;
+  llvm::SmallString<256> &NewVarStr = getScratchBuffer();
+  NewVarStr += '\n';
+  NewVarStr += IndentStr;
+  NewVarStr += VarStr;
   SourceLocation StartLoc = Body->getBeginLoc();
-  return !(TheRewriter->InsertTextAfterToken(StartLoc, NewVarStr));
+  return !(TheRewriter->InsertTextAfterToken(StartLoc, NewVarStr.str()));
 }
 
 const char *RewriteUtils::getTmpVarNamePrefix(void)
@@ -841,22 +961,29 @@ bool RewriteUtils::addNewAssignStmtBefore(Stmt *BeforeStmt,
   std::string ExprStr;
   RewriteUtils::getExprString(RHS, ExprStr);
 
-  std::string AssignStmtStr;
-  
+  llvm::SmallString<256> &AssignStmtStr = getScratchBuffer();
+
   if (NeedParen) {
-    AssignStmtStr = "{\n";
-    AssignStmtStr += IndentStr + "  " + VarName + " = ";
+    AssignStmtStr += "{\n";
+    AssignStmtStr += IndentStr;
+    AssignStmtStr += "  ";
+    AssignStmtStr += VarName;
+    AssignStmtStr += " = ";
     AssignStmtStr += ExprStr;
-    AssignStmtStr += ";\n" + IndentStr + "  ";
+    AssignStmtStr += ";\n";
+    AssignStmtStr += IndentStr;
+    AssignStmtStr += "  ";
   }
   else {
-    AssignStmtStr = VarName + " = ";
+    AssignStmtStr += VarName;
+    AssignStmtStr += " = ";
     AssignStmtStr += ExprStr;
-    AssignStmtStr += ";\n" + IndentStr;
+    AssignStmtStr += ";\n";
+    AssignStmtStr += IndentStr;
   }
-  
-  return !(TheRewriter->InsertText(StmtLocStart, 
-             AssignStmtStr, /*InsertAfter=*/false));
+
+  return !(TheRewriter->InsertText(StmtLocStart,
+             AssignStmtStr.str(), /*InsertAfter=*/false));
 }
 
 void RewriteUtils::indentAfterNewLine(StringRef Str,
@@ -864,11 +991,14 @@ void RewriteUtils::indentAfterNewLine(StringRef Str,
                                       const std::string &IndentStr)
 {
   SmallVector<StringRef, 20> StrVec;
-  Str.split(StrVec, "\n"); 
-  NewStr = "";
-  for(SmallVector<StringRef, 20>::iterator I = StrVec.begin(), 
+  Str.split(StrVec, "\n");
+  NewStr.clear();
+  NewStr.reserve(Str.size() + StrVec.size() * (IndentStr.size() + 1));
+  for(SmallVector<StringRef, 20>::iterator I = StrVec.begin(),
       E = StrVec.end(); I != E; ++I) {
-    NewStr += ((*I).str() + "\n" + IndentStr);
+    NewStr.append((*I).data(), (*I).size());
+    NewStr += '\n';
+    NewStr += IndentStr;
   }
 }
 
@@ -879,8 +1009,11 @@ void RewriteUtils::addOpenParenBeforeStmt(Stmt *S, const std::string &IndentStr)
     RewriteUtils::getEndLocationFromBegin(StmtRange);
   TransAssert(LocEnd.isValid() && "Invalid LocEnd!");
 
-  std::string PostStr = "\n" + IndentStr + "}";
-  TheRewriter->InsertTextAfterToken(LocEnd, PostStr);
+  llvm::SmallString<256> &PostStr = getScratchBuffer();
+  PostStr += '\n';
+  PostStr += IndentStr;
+  PostStr += '}';
+  TheRewriter->InsertTextAfterToken(LocEnd, PostStr.str());
 }
 
 bool RewriteUtils::addStringBeforeStmtInternal(Stmt *S,
@@ -1891,6 +2024,48 @@ bool RewriteUtils::removeTemplateParameter(const clang::TemplateParameterList* T
   }
 }
 
+// Remove the adjacent arguments [FirstIdx, LastIdx] as one edit.  The
+// single-argument version cannot simply be called per index: two
+// neighbouring removals share their separating comma, and removing the
+// overlapping ranges one by one makes the second edit overshoot.
+bool RewriteUtils::removeTemplateArgumentRange(const clang::DeclRefExpr* DRE,
+                                               unsigned FirstIdx,
+                                               unsigned LastIdx)
+{
+  assert(FirstIdx <= LastIdx && LastIdx < DRE->getNumTemplateArgs());
+
+  const TemplateArgumentLoc* Args = DRE->getTemplateArgs();
+  if (FirstIdx == 0 && LastIdx == DRE->getNumTemplateArgs() - 1) {
+    return !TheRewriter->RemoveText({ DRE->getLAngleLoc(), DRE->getRAngleLoc() });
+  } else if (FirstIdx == 0) {
+    return removeTextUntil(SourceRange(Args[FirstIdx].getSourceRange().getBegin(),
+                                       Args[LastIdx].getSourceRange().getEnd()),
+                           ',');
+  } else {
+    return removeTextFromLeftAt(Args[FirstIdx].getSourceRange(), ',',
+                                Args[LastIdx].getSourceRange().getEnd());
+  }
+}
+
+bool RewriteUtils::removeTemplateParameterRange(
+       const clang::TemplateParameterList* TPL,
+       unsigned FirstIdx, unsigned LastIdx)
+{
+  assert(FirstIdx <= LastIdx && LastIdx < TPL->size());
+
+  if (FirstIdx == 0 && LastIdx == TPL->size() - 1) {
+    return !TheRewriter->RemoveText({ TPL->getTemplateLoc(), TPL->getRAngleLoc() });
+  } else if (FirstIdx == 0) {
+    return removeTextUntil(
+             SourceRange(TPL->getParam(FirstIdx)->getSourceRange().getBegin(),
+                         TPL->getParam(LastIdx)->getEndLoc()),
+             ',');
+  } else {
+    return removeTextFromLeftAt(TPL->getParam(FirstIdx)->getSourceRange(), ',',
+                                TPL->getParam(LastIdx)->getEndLoc());
+  }
+}
+
 bool RewriteUtils::removeClassDecls(const CXXRecordDecl *CXXRD)
 {
   if (auto* CTSD = dyn_cast<ClassTemplateSpecializationDecl>(CXXRD)) {
@@ -11,7 +11,9 @@
 #ifndef REWRITE_UTILS_H
 #define REWRITE_UTILS_H
 
+#include <map>
 #include <string>
+#include "llvm/ADT/SmallString.h"
 #include "clang/Basic/SourceLocation.h"
 #include "clang/AST/NestedNameSpecifier.h"
 #include "clang/AST/DeclTemplate.h"
@@ -59,6 +61,31 @@ public:
 
   static void Finalize(void);
 
+  // Scratch buffer for assembling temporary rewrite text.  The buffer is
+  // cleared on each call and its storage is reused across calls, so
+  // transformations that build many short strings per candidate avoid
+  // reallocating for every one.  Callers must be done with the previous
+  // contents before requesting the buffer again.
+  llvm::SmallString<256> &getScratchBuffer(void);
+
+  // Overlapping-edit detection for multi-edit passes.  registerEditRange
+  // records the character range an edit is about to touch and returns
+  // false when it intersects an already-registered range, so a conflict
+  // surfaces in O(log n) before the Rewriter is mutated instead of after
+  // the full rewrite attempt.  The registry is reset whenever the
+  // singleton is re-bound to a Rewriter.
+  bool registerEditRange(const clang::SourceRange &Range);
+
+  // Bulk decomposition of a range's endpoints through the decomposition
+  // cache; both endpoints must land in the same file.
+  void getRangeOffsets(clang::SourceRange Range,
+                       unsigned &BeginOff,
+                       unsigned &EndOff);
+
+  // Cached variant of SourceManager::getCharacterData for file
+  // locations; macro locations fall through to the SourceManager.
+  const char *getCharacterDataCached(clang::SourceLocation Loc);
+
   clang::SourceLocation getEndLocationFromBegin(clang::SourceRange Range);
 
   bool removeParamFromFuncDecl(const clang::ParmVarDecl *PV,
@@ -77,12 +104,25 @@ public:
                                     bool IsFirstDecl,
                                     bool *StmtRemoved);
 
-  bool getExprString(const clang::Expr *E, 
+  bool getExprString(const clang::Expr *E,
                             std::string &ES);
 
-  bool getStmtString(const clang::Stmt *S, 
+  bool getStmtString(const clang::Stmt *S,
                             std::string &Str);
 
+  // Zero-copy variants of getExprString/getStmtString: the returned
+  // StringRef points straight into the SourceManager's buffer, which
+  // stays alive for the whole run, so callers that only measure,
+  // compare or append the text skip the std::string materialization.
+  // Unlike getExprString, getExprStringRef does not parenthesize a
+  // top-level comma operator -- a caller splicing the text into
+  // generated code must add the parentheses itself.
+  bool getExprStringRef(const clang::Expr *E,
+                            llvm::StringRef &ES);
+
+  bool getStmtStringRef(const clang::Stmt *S,
+                            llvm::StringRef &Str);
+
   bool replaceExpr(const clang::Expr *E, 
                           const std::string &ES);
 
@@ -266,6 +306,12 @@ public:
 
   bool removeTemplateParameter(const clang::TemplateParameterList* TPL, unsigned Idx);
 
+  bool removeTemplateArgumentRange(const clang::DeclRefExpr* DRE,
+                                   unsigned FirstIdx, unsigned LastIdx);
+
+  bool removeTemplateParameterRange(const clang::TemplateParameterList* TPL,
+                                    unsigned FirstIdx, unsigned LastIdx);
+
   bool removeClassDecls(const clang::CXXRecordDecl *CXXRD);
 
   bool removeClassTemplateDecls(const clang::ClassTemplateDecl *TmplD);
@@ -294,6 +340,33 @@ private:
 
   clang::SourceManager *SrcManager;
 
+  llvm::SmallString<256> ScratchBuffer;
+
+  // registered edit ranges as disjoint half-open offset intervals,
+  // keyed by begin offset
+  std::map<unsigned, unsigned> EditRanges;
+
+  // Direct-mapped cache of location decompositions, keyed by the raw
+  // location encoding.  Helpers such as removeParamFromFuncDecl
+  // decompose the same or nearby locations several times per candidate,
+  // and decomposition is pure repeated arithmetic over buffers that do
+  // not change while the singleton is bound to one Rewriter.  Raw
+  // encoding 0 never names a valid location, so a zeroed entry is
+  // empty; the cache is reset on every re-bind (once per translation
+  // unit).
+  enum { DecompCacheSize = 64 };
+
+  struct DecompEntry {
+    unsigned RawLoc;
+    unsigned Offset;
+    clang::FileID FID;
+    const char *BufferStart;
+  };
+
+  DecompEntry DecompCache[DecompCacheSize];
+
+  void resetDecompCache(void);
+
   RewriteUtils(void)
   : TheRewriter(NULL),
     SrcManager(NULL)
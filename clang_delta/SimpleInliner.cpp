@@ -14,6 +14,7 @@
 
 #include "SimpleInliner.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "clang/AST/RecursiveASTVisitor.h"
@@ -350,10 +351,29 @@ void SimpleInliner::getValidFunctionDecls(void)
   }
 }
 
+// Expected size win of inlining one call site.  A callee with a single
+// call site gets its whole body removed by later passes once inlined,
+// so bigger bodies rank higher; a multi-call callee only grows the file
+// until every site is gone, so its candidates rank below all
+// single-call ones and smaller bodies come first.
+int SimpleInliner::getCandidateScore(CallExpr *CE)
+{
+  FunctionDecl *CanonicalDecl =
+    CE->getDirectCallee()->getCanonicalDecl();
+  int NumStmts = FunctionDeclNumStmts[CanonicalDecl];
+  if (FunctionDeclNumCalls[CanonicalDecl] == 1)
+    return NumStmts;
+  return -NumStmts;
+}
+
 void SimpleInliner::doAnalysis(void)
 {
   getValidFunctionDecls();
 
+  // The cheap size/call-count pre-filter runs before the per-argument
+  // validity walk, so giant callees are rejected without touching
+  // their call sites.
+  SmallVector<CallExpr *, 10> Candidates;
   for (SmallVector<CallExpr *, 10>::iterator CI = AllCallExprs.begin(),
        CE = AllCallExprs.end(); CI != CE; ++CI) {
 
@@ -369,6 +389,19 @@ void SimpleInliner::doAnalysis(void)
     if (!hasValidArgExprs(*CI))
       continue;
 
+    Candidates.push_back(*CI);
+  }
+
+  // stable sort keeps source order within equal scores, so candidate
+  // numbering stays deterministic across invocations
+  std::stable_sort(Candidates.begin(), Candidates.end(),
+    [this](CallExpr *LHS, CallExpr *RHS) {
+      return getCandidateScore(LHS) > getCandidateScore(RHS);
+    });
+
+  for (SmallVector<CallExpr *, 10>::iterator CI = Candidates.begin(),
+       CE = Candidates.end(); CI != CE; ++CI) {
+    FunctionDecl *CalleeDecl = (*CI)->getDirectCallee();
     ValidInstanceNum++;
     if (TransformationCounter == ValidInstanceNum) {
       // It's possible the direct callee is not a definition
@@ -439,21 +472,28 @@ void SimpleInliner::generateParamStrings(void)
     std::string ParmStr = PD->getNameAsString();
     if (Idx < ArgNum) {
       const Expr *Arg = TheCallExpr->getArg(Idx);
-      std::string ArgStr;
-      RewriteHelper->getExprString(Arg, ArgStr);
+      // An argument can never be a bare comma operator, so reading the
+      // text in place loses nothing over getExprString.
+      llvm::StringRef ArgStr;
+      RewriteHelper->getExprStringRef(Arg, ArgStr);
 
       // create a new tmp for parms with name clash
+      std::string TmpName;
       if (hasNameClash(ParmStr, Arg)) {
-        std::string TmpName = getNewTmpName();
+        TmpName = getNewTmpName();
         std::string NewParmStr = TmpName;
         PD->getType().getAsStringInternal(NewParmStr,
                                           getPrintingPolicy());
-        ParmsWithNameClash.push_back(NewParmStr + " = " + ArgStr + ";\n");
+        NewParmStr += " = ";
+        NewParmStr.append(ArgStr.data(), ArgStr.size());
+        NewParmStr += ";\n";
+        ParmsWithNameClash.push_back(NewParmStr);
         ArgStr = TmpName;
       }
       PD->getType().getAsStringInternal(ParmStr,
                                         getPrintingPolicy());
-      ParmStr += " = " + ArgStr;
+      ParmStr += " = ";
+      ParmStr.append(ArgStr.data(), ArgStr.size());
     }
     else {
       PD->getType().getAsStringInternal(ParmStr,
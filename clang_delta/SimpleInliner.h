@@ -85,6 +85,8 @@ private:
 
   void doAnalysis(void);
 
+  int getCandidateScore(clang::CallExpr *CE);
+
   bool isValidArgExpr(const clang::Expr *E);
 
   bool hasValidArgExprs(const clang::CallExpr *CE);
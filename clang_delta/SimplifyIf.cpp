@@ -84,6 +84,11 @@ bool SimplifyIfCollectionVisitor::VisitFunctionDecl(FunctionDecl *FD)
       !FD->isThisDeclarationADefinition())
     return true;
 
+  // sparse-batch fast path: a definition whose census counters all fall
+  // outside the requested range is credited and skipped wholesale
+  if (ConsumerInstance->canSkipDeclSubtree(FD))
+    return true;
+
   ConsumerInstance->StmtVisitor->TraverseDecl(FD);
   return true;
 }
@@ -100,7 +105,11 @@ bool SimplifyIfStatementVisitor::VisitIfStmt(IfStmt *IS)
   }
 
   ConsumerInstance->ValidInstanceNum++;
-  if (ConsumerInstance->ValidInstanceNum == 
+  // the whole if-statement stands in for the instance's weight and
+  // conflict extent, though the rewrite keeps the branch bodies
+  ConsumerInstance->recordInstanceRange(ConsumerInstance->ValidInstanceNum,
+                                        IS->getSourceRange());
+  if (ConsumerInstance->ValidInstanceNum ==
       ConsumerInstance->TransformationCounter) {
     ConsumerInstance->TheIfStmt = IS;
     ConsumerInstance->NeedParen = NeedParen;
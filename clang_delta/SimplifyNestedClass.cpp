@@ -19,6 +19,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Lex/Lexer.h"
 
+#include "ClassHierarchyIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -36,31 +37,6 @@ the inner class \n\
 static RegisterTransformation<SimplifyNestedClass>
          Trans("simplify-nested-class", DescriptionMsg);
 
-class SimplifyNestedClassVisitor : public 
-  RecursiveASTVisitor<SimplifyNestedClassVisitor> {
-
-public:
-  explicit SimplifyNestedClassVisitor(
-             SimplifyNestedClass *Instance)
-    : ConsumerInstance(Instance)
-  { }
-
-  bool VisitCXXRecordDecl(CXXRecordDecl *CXXRD);
-
-private:
-  SimplifyNestedClass *ConsumerInstance;
-};
-
-bool SimplifyNestedClassVisitor::VisitCXXRecordDecl(
-       CXXRecordDecl *CXXRD)
-{
-  if (ConsumerInstance->isInIncludedFile(CXXRD) ||
-      ConsumerInstance->isSpecialRecordDecl(CXXRD) || !CXXRD->hasDefinition())
-    return true;
-  ConsumerInstance->handleOneCXXRecordDecl(CXXRD->getDefinition());
-  return true;
-}
-
 class SimplifyNestedClassRewriteVisitor : public
   RecursiveASTVisitor<SimplifyNestedClassRewriteVisitor> {
 public:
@@ -96,13 +72,21 @@ bool SimplifyNestedClassRewriteVisitor::VisitRecordTypeLoc(RecordTypeLoc TLoc)
   return true;
 }
 
-void SimplifyNestedClass::Initialize(ASTContext &context) 
+void SimplifyNestedClass::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
-  CollectionVisitor = new SimplifyNestedClassVisitor(this);
   RewriteVisitor = new SimplifyNestedClassRewriteVisitor(this);
 }
 
+void SimplifyNestedClass::prepareSharedAnalysis(ASTContext &Ctx)
+{
+  if (TransformationManager::isCLangOpt() ||
+      TransformationManager::isOpenCLLangOpt())
+    return;
+  // counter-independent: one shared sweep instead of a private traversal
+  ClassHierarchyIndex::GetInstance(Ctx);
+}
+
 void SimplifyNestedClass::HandleTranslationUnit(ASTContext &Ctx)
 {
   if (TransformationManager::isCLangOpt() ||
@@ -110,7 +94,16 @@ void SimplifyNestedClass::HandleTranslationUnit(ASTContext &Ctx)
     ValidInstanceNum = 0;
   }
   else {
-    CollectionVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+    const ClassHierarchyIndex::RecordVector &Records =
+      ClassHierarchyIndex::GetInstance(Ctx)->getVisitedRecords();
+    for (ClassHierarchyIndex::RecordVector::const_iterator
+         I = Records.begin(), E = Records.end(); I != E; ++I) {
+      CXXRecordDecl *CXXRD = (*I);
+      if (isInIncludedFile(CXXRD) || isSpecialRecordDecl(CXXRD) ||
+          !CXXRD->hasDefinition())
+        continue;
+      handleOneCXXRecordDecl(CXXRD->getDefinition());
+    }
   }
 
   if (QueryInstanceOnly)
@@ -177,6 +170,7 @@ void SimplifyNestedClass::handleOneCXXRecordDecl(const CXXRecordDecl *CXXRD)
   if (!InnerDecl)
     return;
   ValidInstanceNum++;
+  recordInstanceRange(ValidInstanceNum, CXXRD->getSourceRange());
   if (ValidInstanceNum == TransformationCounter) {
     TheBaseCXXRD = CXXRD;
     TheInnerDecl = InnerDecl;
@@ -185,7 +179,6 @@ void SimplifyNestedClass::handleOneCXXRecordDecl(const CXXRecordDecl *CXXRD)
 
 SimplifyNestedClass::~SimplifyNestedClass(void)
 {
-  delete CollectionVisitor;
   delete RewriteVisitor;
 }
 
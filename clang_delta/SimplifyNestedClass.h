@@ -20,23 +20,22 @@ namespace clang {
   class Decl;
 }
 
-class SimplifyNestedClassVisitor;
 class SimplifyNestedClassRewriteVisitor;
 
 class SimplifyNestedClass : public Transformation {
-friend class SimplifyNestedClassVisitor;
 friend class SimplifyNestedClassRewriteVisitor;
 
 public:
   SimplifyNestedClass(const char *TransName, const char *Desc)
     : Transformation(TransName, Desc),
-      CollectionVisitor(NULL),
       RewriteVisitor(NULL),
       TheBaseCXXRD(NULL)
   { }
 
   ~SimplifyNestedClass(void);
 
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx);
+
 private:
   virtual void Initialize(clang::ASTContext &context);
 
@@ -46,8 +45,6 @@ private:
 
   void removeOuterClass();
 
-  SimplifyNestedClassVisitor *CollectionVisitor;
-
   SimplifyNestedClassRewriteVisitor *RewriteVisitor;
 
   const clang::CXXRecordDecl *TheBaseCXXRD;
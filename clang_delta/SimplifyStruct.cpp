@@ -20,6 +20,7 @@
 #include "clang/Basic/SourceManager.h"
 #include "clang/AST/RecordLayout.h"
 
+#include "RecordIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -312,7 +313,30 @@ void SimplifyStruct::HandleTranslationUnit(ASTContext &Ctx)
   TransAssert(RewriteVisitor && "NULL RewriteVisitor!");
   TransAssert(TheRecordDecl && "NULL TheRecordDecl!");
   TransAssert(ReplacingRecordDecl && "NULL ReplacingRecordDecl!");
-  RewriteVisitor->TraverseDecl(Ctx.getTranslationUnitDecl());
+  // Replay the record-related callbacks from the shared per-parse node
+  // stream instead of re-traversing the translation unit; the stream
+  // preserves traversal order, so the VisitedLocs bookkeeping behaves
+  // exactly as it did under a full traversal.
+  RecordIndex *RI = RecordIndex::GetInstance();
+  RI->ensureBuilt(&Ctx);
+  const RecordIndex::NodeVector &Nodes = RI->getNodes();
+  for (RecordIndex::NodeVector::const_iterator I = Nodes.begin(),
+       E = Nodes.end(); I != E; ++I) {
+    switch ((*I).Kind) {
+    case RecordIndex::NK_RecordDecl:
+      RewriteVisitor->VisitRecordDecl((*I).RD);
+      break;
+    case RecordIndex::NK_VarDecl:
+      RewriteVisitor->VisitVarDecl((*I).VD);
+      break;
+    case RecordIndex::NK_RecordTypeLoc:
+      RewriteVisitor->VisitRecordTypeLoc((*I).RTLoc.castAs<RecordTypeLoc>());
+      break;
+    case RecordIndex::NK_MemberExpr:
+      RewriteVisitor->VisitMemberExpr((*I).ME);
+      break;
+    }
+  }
 
   if (Ctx.getDiagnostics().hasErrorOccurred() ||
       Ctx.getDiagnostics().hasFatalErrorOccurred())
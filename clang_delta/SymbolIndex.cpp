@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2026 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "SymbolIndex.h"
+
+#include <cstring>
+
+#include "clang/AST/Decl.h"
+#include "clang/Basic/IdentifierTable.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+SymbolIndex *SymbolIndex::Instance;
+
+SymbolIndex *SymbolIndex::GetInstance()
+{
+  if (SymbolIndex::Instance)
+    return SymbolIndex::Instance;
+
+  SymbolIndex::Instance = new SymbolIndex();
+  assert(SymbolIndex::Instance);
+  return SymbolIndex::Instance;
+}
+
+void SymbolIndex::Finalize()
+{
+  delete SymbolIndex::Instance;
+  SymbolIndex::Instance = NULL;
+}
+
+void SymbolIndex::startBuild(const ASTContext *Ctx)
+{
+  if (BuiltFor == Ctx)
+    return;
+  BuiltFor = Ctx;
+  FunctionUses.clear();
+  FunctionDefs.clear();
+  UseEdges.clear();
+  EdgeUseCounts.clear();
+  memset(NameFilter, 0, sizeof(NameFilter));
+}
+
+// Two probes derived from one hash of the identifier bytes; hashing the
+// bytes rather than the (interned) IdentifierInfo pointer keeps the
+// filter meaningful across ASTContexts should a caller ever mix them.
+static inline void nameFilterBits(const IdentifierInfo *II,
+                                  unsigned &Bit1, unsigned &Bit2)
+{
+  llvm::StringRef Name = II->getName();
+  uint64_t H = llvm::hash_value(Name);
+  const unsigned NumBits = (1 << 13) * 64;
+  Bit1 = (unsigned)(H % NumBits);
+  Bit2 = (unsigned)((H >> 32) % NumBits);
+}
+
+void SymbolIndex::recordFunctionName(const IdentifierInfo *II)
+{
+  unsigned Bit1, Bit2;
+  nameFilterBits(II, Bit1, Bit2);
+  NameFilter[Bit1 >> 6] |= (uint64_t)1 << (Bit1 & 63);
+  NameFilter[Bit2 >> 6] |= (uint64_t)1 << (Bit2 & 63);
+}
+
+bool SymbolIndex::mayBeFunctionName(const IdentifierInfo *II)
+{
+  unsigned Bit1, Bit2;
+  nameFilterBits(II, Bit1, Bit2);
+  return (NameFilter[Bit1 >> 6] & ((uint64_t)1 << (Bit1 & 63))) &&
+         (NameFilter[Bit2 >> 6] & ((uint64_t)1 << (Bit2 & 63)));
+}
+
+void SymbolIndex::recordUseEdge(const FunctionDecl *UserFD,
+                                const FunctionDecl *UsedFD)
+{
+  if (UserFD == UsedFD)
+    return;
+  EdgeUseCounts[UsedFD]++;
+  if (UserFD)
+    UseEdges[UserFD].push_back(UsedFD);
+}
+
+const SymbolIndex::EdgeVector *
+SymbolIndex::getUseEdges(const FunctionDecl *UserFD)
+{
+  llvm::DenseMap<const FunctionDecl *, EdgeVector>::iterator I =
+    UseEdges.find(UserFD);
+  if (I == UseEdges.end())
+    return NULL;
+  return &(*I).second;
+}
+
+unsigned SymbolIndex::getNumEdgeUses(const FunctionDecl *UsedFD)
+{
+  llvm::DenseMap<const FunctionDecl *, unsigned>::iterator I =
+    EdgeUseCounts.find(UsedFD);
+  if (I == EdgeUseCounts.end())
+    return 0;
+  return (*I).second;
+}
+
+void SymbolIndex::recordFunctionDef(const FunctionDecl *CanonicalFD)
+{
+  FunctionDefs[CanonicalFD] = 1;
+  // Make sure a defined function shows up in the summary even if it is
+  // never referenced.
+  (void)FunctionUses[CanonicalFD];
+}
+
+void SymbolIndex::recordFunctionUse(const FunctionDecl *CanonicalFD)
+{
+  FunctionUses[CanonicalFD]++;
+}
+
+unsigned SymbolIndex::getNumUses(const FunctionDecl *CanonicalFD)
+{
+  llvm::DenseMap<const FunctionDecl *, unsigned>::iterator I =
+    FunctionUses.find(CanonicalFD);
+  if (I == FunctionUses.end())
+    return 0;
+  return (*I).second;
+}
+
+void SymbolIndex::writeSummary(llvm::raw_ostream &OutStream)
+{
+  for (llvm::DenseMap<const FunctionDecl *, unsigned>::iterator
+         I = FunctionUses.begin(), E = FunctionUses.end(); I != E; ++I) {
+    const FunctionDecl *FD = (*I).first;
+    OutStream << FD->getNameAsString() << " " << (*I).second << "\n";
+  }
+}
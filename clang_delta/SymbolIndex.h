@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2026 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SYMBOL_INDEX_H
+#define SYMBOL_INDEX_H
+
+#include <cstdint>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace llvm {
+  class raw_ostream;
+}
+
+namespace clang {
+  class ASTContext;
+  class FunctionDecl;
+  class IdentifierInfo;
+}
+
+// A per-parse def/use cross-reference over function symbols.  A
+// transformation populates the index during its first analysis sweep of a
+// translation unit; later sweeps against the same ASTContext (daemon and
+// fork-server children, the instance census) can consult the index instead
+// of re-traversing the whole TU.  The index is process-local: it keys
+// entries by AST nodes, so it is rebuilt whenever a new ASTContext is
+// parsed.
+class SymbolIndex {
+
+public:
+
+  static SymbolIndex *GetInstance();
+
+  static void Finalize();
+
+  // Whether the index has been populated for the given ASTContext.
+  bool isBuiltFor(const clang::ASTContext *Ctx) {
+    return BuiltFor && (BuiltFor == Ctx);
+  }
+
+  void startBuild(const clang::ASTContext *Ctx);
+
+  void recordFunctionDef(const clang::FunctionDecl *CanonicalFD);
+
+  void recordFunctionUse(const clang::FunctionDecl *CanonicalFD);
+
+  unsigned getNumUses(const clang::FunctionDecl *CanonicalFD);
+
+  typedef llvm::SmallVector<const clang::FunctionDecl *, 4> EdgeVector;
+
+  // Record that the body of UserFD refers to UsedFD.  A NULL UserFD
+  // stands for a reference outside any function body (a global
+  // initializer, a default argument); such a use has no removable owner
+  // and permanently pins the symbol.  Self-references are dropped --
+  // recursion never keeps a function alive once its other uses go.
+  void recordUseEdge(const clang::FunctionDecl *UserFD,
+                     const clang::FunctionDecl *UsedFD);
+
+  // The functions the body of UserFD refers to, one entry per recorded
+  // reference, or NULL when none were recorded.
+  const EdgeVector *getUseEdges(const clang::FunctionDecl *UserFD);
+
+  // How many recorded references point at UsedFD, pinned ones included.
+  unsigned getNumEdgeUses(const clang::FunctionDecl *UsedFD);
+
+  // Bloom-filter negative cache over declared function identifiers.  The
+  // name lookups asking "could this identifier resolve to a function?"
+  // conclude "no" for most names during the late removal phases, and a
+  // negative used to cost a recursive DeclContext walk; the filter
+  // answers definite-negatives in O(1).  A false positive merely falls
+  // through to today's full lookup, so completeness of recording is the
+  // only correctness requirement: every FunctionDecl identifier in the
+  // TU must be recorded before the first query.
+  void recordFunctionName(const clang::IdentifierInfo *II);
+
+  // False only when the identifier was definitely never recorded as a
+  // function name; true means "maybe", and the caller does the lookup.
+  bool mayBeFunctionName(const clang::IdentifierInfo *II);
+
+  // Dump a "name use-count" summary, e.g. into the reduction temp dir for
+  // offline inspection of what keeps symbols alive.
+  void writeSummary(llvm::raw_ostream &OutStream);
+
+private:
+
+  SymbolIndex()
+    : BuiltFor(NULL),
+      NameFilter()
+  { }
+
+  ~SymbolIndex() { }
+
+  static SymbolIndex *Instance;
+
+  const clang::ASTContext *BuiltFor;
+
+  llvm::DenseMap<const clang::FunctionDecl *, unsigned> FunctionUses;
+
+  llvm::DenseMap<const clang::FunctionDecl *, char> FunctionDefs;
+
+  // user -> the functions its body refers to
+  llvm::DenseMap<const clang::FunctionDecl *, EdgeVector> UseEdges;
+
+  // used -> total recorded references, pinned ones included
+  llvm::DenseMap<const clang::FunctionDecl *, unsigned> EdgeUseCounts;
+
+  // 2^19 bits (64 KB), two hash probes per name; sized so even a TU with
+  // a hundred thousand distinct function names stays under a few percent
+  // false positives
+  enum { NameFilterWords = 1 << 13 };
+
+  uint64_t NameFilter[NameFilterWords];
+
+  // Unimplemented
+  SymbolIndex(const SymbolIndex &);
+
+  void operator=(const SymbolIndex &);
+};
+
+#endif
@@ -14,6 +14,10 @@
 
 #include "TemplateArgToInt.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
 #include "clang/Lex/Lexer.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
@@ -212,8 +216,10 @@ void TemplateArgToInt::HandleTranslationUnit(ASTContext &Ctx)
     ArgCollector->TraverseDecl(Ctx.getTranslationUnitDecl());
   }
 
-  if (QueryInstanceOnly)
+  if (QueryInstanceOnly) {
+    exportTemplateHeat();
     return;
+  }
 
   if (TransformationCounter > ValidInstanceNum) {
     TransError = TransMaxInstanceError;
@@ -260,7 +266,7 @@ void TemplateArgToInt::handleOneTemplateDecl(const TemplateDecl *D)
 }
 
 void TemplateArgToInt::handleOneTemplateArgumentLoc(
-       const TemplateArgumentLoc &ArgLoc)
+       const TemplateDecl *D, const TemplateArgumentLoc &ArgLoc)
 {
   if (ArgLoc.getLocation().isInvalid() ||
       isInIncludedFile(ArgLoc.getLocation()))
@@ -274,10 +280,83 @@ void TemplateArgToInt::handleOneTemplateArgumentLoc(
     return;
 
   ValidInstanceNum++;
+  recordTemplateHeat(D, ArgLoc);
   if (ValidInstanceNum == TransformationCounter)
     TheTypeSourceInfo = ArgLoc.getTypeSourceInfo();
 }
 
+void TemplateArgToInt::recordTemplateHeat(const TemplateDecl *D,
+                                          const TemplateArgumentLoc &ArgLoc)
+{
+  SourceRange Range = ArgLoc.getSourceRange();
+  SourceLocation Begin = SrcManager->getExpansionLoc(Range.getBegin());
+  SourceLocation End = SrcManager->getExpansionLoc(Range.getEnd());
+  unsigned Bytes = 0;
+  if (Begin.isValid() && End.isValid() &&
+      SrcManager->isWrittenInMainFile(Begin) &&
+      SrcManager->isWrittenInMainFile(End)) {
+    unsigned BeginOff = SrcManager->getFileOffset(Begin);
+    unsigned EndOff = SrcManager->getFileOffset(End) +
+      Lexer::MeasureTokenLength(End, *SrcManager, Context->getLangOpts());
+    if (EndOff > BeginOff)
+      Bytes = EndOff - BeginOff;
+  }
+
+  const TemplateDecl *CanonicalD =
+    D ? dyn_cast<TemplateDecl>(D->getCanonicalDecl()) : NULL;
+  TemplateHeat &Heat = HeatMap[CanonicalD];
+  if (!Heat.Instances)
+    Heat.FirstInstance = ValidInstanceNum;
+  Heat.Instances++;
+  Heat.ArgBytes += Bytes;
+}
+
+// Per-template heat export, best first: score is the instantiation count
+// times the bytes the argument text spans, i.e. how much source a
+// whole-template sweep of int conversions would touch.  One readable
+// line per template goes to stderr next to the instance count, and one
+// "tmpl-heat" ledger record per template (score, instances, bytes;
+// error-code field carries the template's first counter) feeds the
+// driver's value-ordered probing -- in template-metaprogramming
+// reductions the top few templates own nearly all the bytes.
+void TemplateArgToInt::exportTemplateHeat()
+{
+  if (HeatMap.empty())
+    return;
+
+  std::vector<std::pair<const TemplateDecl *, TemplateHeat> > Ranked;
+  Ranked.reserve(HeatMap.size());
+  for (TemplateHeatMap::iterator I = HeatMap.begin(), E = HeatMap.end();
+       I != E; ++I)
+    Ranked.push_back(std::make_pair((*I).first, (*I).second));
+
+  std::sort(Ranked.begin(), Ranked.end(),
+            [](const std::pair<const TemplateDecl *, TemplateHeat> &A,
+               const std::pair<const TemplateDecl *, TemplateHeat> &B) {
+    uint64_t ScoreA = (uint64_t)A.second.Instances * A.second.ArgBytes;
+    uint64_t ScoreB = (uint64_t)B.second.Instances * B.second.ArgBytes;
+    if (ScoreA != ScoreB)
+      return ScoreA > ScoreB;
+    // ties resolve by discovery order to keep the ranking deterministic
+    return A.second.FirstInstance < B.second.FirstInstance;
+  });
+
+  const char *LedgerPath = getenv("CVISE_PERF_LEDGER");
+  for (size_t I = 0; I < Ranked.size(); ++I) {
+    const TemplateDecl *D = Ranked[I].first;
+    const TemplateHeat &Heat = Ranked[I].second;
+    std::string Name = D ? D->getNameAsString() : "<unknown>";
+    llvm::errs() << "Template heat: " << Name << " " << Heat.Instances
+                 << " " << Heat.ArgBytes << " " << Heat.FirstInstance
+                 << "\n";
+    if (LedgerPath)
+      TransformationManager::appendPerfLedger(
+        LedgerPath, "tmpl-heat",
+        (uint64_t)Heat.Instances * Heat.ArgBytes,
+        Heat.Instances, Heat.ArgBytes, (uint32_t)Heat.FirstInstance);
+  }
+}
+
 void TemplateArgToInt::handleTemplateArgumentLocs(
        const TemplateDecl *D, const TemplateArgumentLoc *TAL, unsigned NumArgs)
 {
@@ -290,7 +369,7 @@ void TemplateArgToInt::handleTemplateArgumentLocs(
     return;
   for (unsigned I = 0; I < NumArgs; ++I) {
     if (!InvalidIdx->count(I))
-      handleOneTemplateArgumentLoc(TAL[I]);
+      handleOneTemplateArgumentLoc(D, TAL[I]);
   }
 }
 
@@ -309,7 +388,7 @@ void TemplateArgToInt::handleTemplateSpecializationTypeLoc(
     return;
   for (unsigned I = 0; I < TLoc.getNumArgs(); ++I) {
     if (!InvalidIdx->count(I))
-      handleOneTemplateArgumentLoc(TLoc.getArgLoc(I));
+      handleOneTemplateArgumentLoc(TplD, TLoc.getArgLoc(I));
   }
 }
 
@@ -78,11 +78,12 @@ private:
 
   void handleOneTemplateDecl(const clang::TemplateDecl *D);
 
-  void handleTemplateArgumentLocs(const clang::TemplateDecl *D, 
-                                  const clang::TemplateArgumentLoc *TAL, 
+  void handleTemplateArgumentLocs(const clang::TemplateDecl *D,
+                                  const clang::TemplateArgumentLoc *TAL,
                                   unsigned NumArgs);
 
-  void handleOneTemplateArgumentLoc(const clang::TemplateArgumentLoc &ArgLoc);
+  void handleOneTemplateArgumentLoc(const clang::TemplateDecl *D,
+                                    const clang::TemplateArgumentLoc &ArgLoc);
 
   void handleTemplateSpecializationTypeLoc(
          const clang::TemplateSpecializationTypeLoc &TLoc);
@@ -94,6 +95,25 @@ private:
 
   void rewriteTemplateArgument();
 
+  // Per-template usage heat gathered during collection: how many
+  // convertible argument instances a template has, the bytes their
+  // argument text spans, and the first counter belonging to it.
+  struct TemplateHeat {
+    unsigned Instances;
+    unsigned ArgBytes;
+    int FirstInstance;
+  };
+
+  typedef llvm::DenseMap<const clang::TemplateDecl *, TemplateHeat>
+            TemplateHeatMap;
+
+  void recordTemplateHeat(const clang::TemplateDecl *D,
+                          const clang::TemplateArgumentLoc &ArgLoc);
+
+  void exportTemplateHeat();
+
+  TemplateHeatMap HeatMap;
+
   TemplateDeclToParamIdxMap DeclToParamIdx;
 
   ParameterToTemplateDeclMap ParamToTemplateDecl;
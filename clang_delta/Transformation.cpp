@@ -14,20 +14,27 @@
 
 #include "Transformation.h"
 
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <sstream>
 
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/Lex/Lexer.h"
 #include "clang/Basic/SourceManager.h"
+#include "llvm/Support/MD5.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringExtras.h"
 
+#include "TransformationManager.h"
+
 using namespace std;
 using namespace clang;
 
+volatile sig_atomic_t Transformation::CancelFlag = 0;
+
 class TransNameQueryVisitor : public
         RecursiveASTVisitor<TransNameQueryVisitor> {
 
@@ -93,6 +100,40 @@ void Transformation::Initialize(ASTContext &context)
   TheRewriter.setSourceMgr(Context->getSourceManager(),
                            Context->getLangOpts());
   RewriteHelper = RewriteUtils::GetInstance(&TheRewriter);
+
+  // the cached policy and the memoized type spellings belong to the
+  // previous parse
+  delete CachedPrintingPolicy;
+  CachedPrintingPolicy = NULL;
+  TypeStringCache.clear();
+
+  // cache the main file's raw-offset bounds so the inline
+  // isInIncludedFile fast path can skip the getFileID binary search
+  FileID MainFID = SrcManager->getMainFileID();
+  MainFileBeginRaw =
+    SrcManager->getLocForStartOfFile(MainFID).getRawEncoding();
+  MainFileEndRaw =
+    SrcManager->getLocForEndOfFile(MainFID).getRawEncoding();
+}
+
+void Transformation::primeRewriteBuffer()
+{
+  if (!SrcManager)
+    return;
+  // getEditBuffer copies the main buffer into the rewrite rope on first
+  // use; existence of the buffer alone never signals a modification (the
+  // passes track that through their own Rewritten flags), so priming it
+  // early is observable only in speed.
+  TheRewriter.getEditBuffer(SrcManager->getMainFileID());
+}
+
+bool Transformation::exceedsSizeDelta(size_t NewSize)
+{
+  size_t OrigSize = SrcManager->getFileIDSize(SrcManager->getMainFileID());
+  if ((long)NewSize <= (long)OrigSize + MaxSizeDelta)
+    return false;
+  TransError = TransSizeLimitError;
+  return true;
 }
 
 void Transformation::outputTransformedSource(llvm::raw_ostream &OutStream)
@@ -107,8 +148,152 @@ void Transformation::outputTransformedSource(llvm::raw_ostream &OutStream)
 
   // RWBuf is non-empty upon any rewrites
   TransAssert(RWBuf && "Empty RewriteBuffer!");
-  OutStream << std::string(RWBuf->begin(), RWBuf->end());
+  // A candidate that grew past the allowed delta would only survive if
+  // later passes shrink it again; skipping the write also skips the
+  // driver's test run for it.
+  if (CheckSizeDelta && exceedsSizeDelta(RWBuf->size()))
+    return;
+  // Stream the rewrite rope piece by piece: unchanged extents are written
+  // directly from the (memory-mapped) original buffer, so the whole
+  // transformed source is never materialized in a temporary string.
+  RWBuf->write(OutStream);
+  OutStream.flush();
+}
+
+void Transformation::outputTransformedSourceAsDiff(llvm::raw_ostream &OutStream)
+{
+  FileID MainFileID = SrcManager->getMainFileID();
+#if LLVM_VERSION_MAJOR >= 20
+  const llvm::RewriteBuffer
+#else
+  const RewriteBuffer
+#endif
+  *RWBuf = TheRewriter.getRewriteBufferFor(MainFileID);
+  TransAssert(RWBuf && "Empty RewriteBuffer!");
+
+  // The gate judges the candidate the diff reconstructs, not the hunk.
+  if (CheckSizeDelta && exceedsSizeDelta(RWBuf->size()))
+    return;
+
+#if LLVM_VERSION_MAJOR >= 16
+  std::optional<llvm::MemoryBufferRef> MainBuf =
+      SrcManager->getBufferOrNone(MainFileID);
+#else
+  llvm::Optional<llvm::MemoryBufferRef> MainBuf =
+      SrcManager->getBufferOrNone(MainFileID);
+#endif
+  TransAssert(MainBuf && "Empty MainBuf!");
+
+  llvm::StringRef Orig = MainBuf->getBuffer();
+  std::string New(RWBuf->begin(), RWBuf->end());
+
+  // Reduce the change to a single replacement hunk by trimming the common
+  // prefix and suffix.  Transformations make localized edits, so the hunk
+  // is tiny compared to the candidate and the driver can patch its working
+  // copy instead of receiving the whole transformed file.
+  size_t MaxCommon = (Orig.size() < New.size()) ? Orig.size() : New.size();
+  size_t Prefix = 0;
+  while ((Prefix < MaxCommon) && (Orig[Prefix] == New[Prefix]))
+    Prefix++;
+  size_t Suffix = 0;
+  while ((Suffix < MaxCommon - Prefix) &&
+         (Orig[Orig.size() - 1 - Suffix] == New[New.size() - 1 - Suffix]))
+    Suffix++;
+
+  OutStream << "@CVISE-DIFF " << Prefix
+            << " " << (Orig.size() - Prefix - Suffix)
+            << " " << (New.size() - Prefix - Suffix) << "\n";
+  OutStream << llvm::StringRef(New).substr(Prefix,
+                                           New.size() - Prefix - Suffix);
+  OutStream.flush();
+}
+
+// Compute-only probes: judge what the rewrite would produce without
+// constructing the output.  One forward pass over the rewrite rope feeds
+// an incremental MD5 and tracks the longest prefix (and trailing match
+// run) still agreeing with the original buffer, which after the same
+// clamping as the diff path yields the single replacement hunk the
+// candidate would apply.  The pass visits the rope's unchanged extents
+// in place, so neither the transformed source nor any temporary copy of
+// it is ever materialized.  Prints "Edit extent: <offset> <orig-length>
+// <new-length>" on OutStream and returns the content hash the written
+// output would have had ("" when the size-delta gate rejects it).
+std::string Transformation::computeEditSummary(llvm::raw_ostream &OutStream)
+{
+  FileID MainFileID = SrcManager->getMainFileID();
+#if LLVM_VERSION_MAJOR >= 20
+  const llvm::RewriteBuffer
+#else
+  const RewriteBuffer
+#endif
+  *RWBuf = TheRewriter.getRewriteBufferFor(MainFileID);
+  TransAssert(RWBuf && "Empty RewriteBuffer!");
+
+  size_t NewSize = RWBuf->size();
+  // The gate applies here too: a compute-only probe of a growing
+  // candidate should report the rejection the real run would.
+  if (CheckSizeDelta && exceedsSizeDelta(NewSize))
+    return "";
+
+#if LLVM_VERSION_MAJOR >= 16
+  std::optional<llvm::MemoryBufferRef> MainBuf =
+      SrcManager->getBufferOrNone(MainFileID);
+#else
+  llvm::Optional<llvm::MemoryBufferRef> MainBuf =
+      SrcManager->getBufferOrNone(MainFileID);
+#endif
+  TransAssert(MainBuf && "Empty MainBuf!");
+  llvm::StringRef Orig = MainBuf->getBuffer();
+
+  llvm::MD5 Hash;
+  char Chunk[4096];
+  size_t ChunkLen = 0;
+  size_t Prefix = 0;
+  bool InPrefix = true;
+  // A trailing byte of the new content matches the original when it
+  // agrees with the original byte at the same distance from the end;
+  // the length of the match run still open at EOF is the common suffix.
+  long TailShift = (long)Orig.size() - (long)NewSize;
+  size_t SuffixRun = 0;
+  size_t Pos = 0;
+  for (auto I = RWBuf->begin(), E = RWBuf->end(); I != E; ++I, ++Pos) {
+    char C = *I;
+    Chunk[ChunkLen++] = C;
+    if (ChunkLen == sizeof(Chunk)) {
+      Hash.update(llvm::StringRef(Chunk, ChunkLen));
+      ChunkLen = 0;
+    }
+    if (InPrefix) {
+      if ((Pos < Orig.size()) && (Orig[Pos] == C))
+        Prefix++;
+      else
+        InPrefix = false;
+    }
+    long OrigPos = (long)Pos + TailShift;
+    if ((OrigPos >= 0) && (OrigPos < (long)Orig.size()) &&
+        (Orig[(size_t)OrigPos] == C))
+      SuffixRun++;
+    else
+      SuffixRun = 0;
+  }
+  if (ChunkLen)
+    Hash.update(llvm::StringRef(Chunk, ChunkLen));
+
+  size_t MaxCommon = (Orig.size() < NewSize) ? Orig.size() : NewSize;
+  if (Prefix > MaxCommon)
+    Prefix = MaxCommon;
+  size_t Suffix = SuffixRun;
+  if (Suffix > MaxCommon - Prefix)
+    Suffix = MaxCommon - Prefix;
+
+  OutStream << "Edit extent: " << Prefix
+            << " " << (Orig.size() - Prefix - Suffix)
+            << " " << (NewSize - Prefix - Suffix) << "\n";
   OutStream.flush();
+
+  llvm::MD5::MD5Result Result;
+  Hash.final(Result);
+  return llvm::toHex(Result.digest());
 }
 
 void Transformation::outputOriginalSource(llvm::raw_ostream &OutStream)
@@ -122,7 +307,437 @@ void Transformation::outputOriginalSource(llvm::raw_ostream &OutStream)
       SrcManager->getBufferOrNone(MainFileID);
 #endif
   TransAssert(MainBuf && "Empty MainBuf!");
-  OutStream << MainBuf->getBufferStart();
+  // Write the mapped buffer as one extent instead of going through the
+  // C-string path, which both strlen()s the buffer and stops at embedded
+  // NUL bytes.
+  OutStream << MainBuf->getBuffer();
+  OutStream.flush();
+}
+
+void Transformation::recordInstanceRange(int Instance,
+                                         const SourceRange &Range)
+{
+  if (!needsInstanceRanges())
+    return;
+
+  SourceLocation Begin = SrcManager->getExpansionLoc(Range.getBegin());
+  SourceLocation End = SrcManager->getExpansionLoc(Range.getEnd());
+  if (Begin.isInvalid() || End.isInvalid())
+    return;
+  FileID MainFileID = SrcManager->getMainFileID();
+  if ((SrcManager->getFileID(Begin) != MainFileID) ||
+      (SrcManager->getFileID(End) != MainFileID))
+    return;
+
+  unsigned BeginOff = SrcManager->getFileOffset(Begin);
+  unsigned EndOff = SrcManager->getFileOffset(End) +
+    Lexer::MeasureTokenLength(End, *SrcManager, Context->getLangOpts());
+  InstanceRanges.push_back(std::make_tuple(Instance, BeginOff, EndOff));
+
+  // Resolve a requested two-level address while the census happens: the
+  // moment the named instance is recorded, the sentinel counter becomes
+  // its global number, so the collection visitor's own counter checks
+  // (and its early stop) work unchanged from here on.
+  if ((AddressDeclIndex >= 0) && (Instance != AddressedInstance)) {
+    AddressedInstance = Instance;
+    int DeclIdx = getTopLevelDeclIndex(BeginOff);
+    if (DeclIdx < 0)
+      return;
+    int Ordinal = ++AddressLocalSeen[DeclIdx];
+    if ((DeclIdx == AddressDeclIndex) &&
+        (Ordinal == AddressLocalOrdinal) &&
+        (TransformationCounter == ToCounterMax)) {
+      TransformationCounter = Instance;
+    }
+  }
+}
+
+int Transformation::getTopLevelDeclIndex(unsigned Offset)
+{
+  if (!TopLevelDeclOffsetsBuilt) {
+    TopLevelDeclOffsetsBuilt = true;
+    TranslationUnitDecl *TUD = Context->getTranslationUnitDecl();
+    FileID MainFileID = SrcManager->getMainFileID();
+    for (DeclContext::decl_iterator I = TUD->decls_begin(),
+         E = TUD->decls_end(); I != E; ++I) {
+      SourceRange DeclRange = (*I)->getSourceRange();
+      SourceLocation Begin = SrcManager->getExpansionLoc(
+                               DeclRange.getBegin());
+      SourceLocation End = SrcManager->getExpansionLoc(DeclRange.getEnd());
+      if (Begin.isInvalid() || End.isInvalid())
+        continue;
+      if ((SrcManager->getFileID(Begin) != MainFileID) ||
+          (SrcManager->getFileID(End) != MainFileID))
+        continue;
+      TopLevelDeclOffsets.push_back(
+        std::make_pair(SrcManager->getFileOffset(Begin),
+                       SrcManager->getFileOffset(End)));
+    }
+  }
+
+  // Top-level declarations come out in source order, so the table is
+  // sorted by begin offset; find the last one starting at or before the
+  // offset.
+  size_t Lo = 0;
+  size_t Hi = TopLevelDeclOffsets.size();
+  while (Lo < Hi) {
+    size_t Mid = Lo + (Hi - Lo) / 2;
+    if (TopLevelDeclOffsets[Mid].first <= Offset)
+      Lo = Mid + 1;
+    else
+      Hi = Mid;
+  }
+  if (Lo == 0)
+    return -1;
+  if (Offset > TopLevelDeclOffsets[Lo - 1].second)
+    return -1;
+  return static_cast<int>(Lo);
+}
+
+void Transformation::setDeclInstanceCounts(const std::vector<int> &Counts)
+{
+  DeclInstanceCumulative.clear();
+  DeclInstanceCumulative.reserve(Counts.size() + 1);
+  DeclInstanceCumulative.push_back(0);
+  for (size_t I = 0; I < Counts.size(); ++I)
+    DeclInstanceCumulative.push_back(DeclInstanceCumulative.back() +
+                                     Counts[I]);
+}
+
+bool Transformation::getPerDeclInstanceCounts(std::vector<int> &Counts)
+{
+  Counts.clear();
+  int LastInstance = 0;
+  int LastDeclIdx = 0;
+  for (const auto &R : InstanceRanges) {
+    int Inst = std::get<0>(R);
+    // only the first range of a multi-range instance places it
+    if (Inst == LastInstance)
+      continue;
+    // an instance that recorded no range would silently shift every
+    // later credit
+    if (Inst != LastInstance + 1)
+      return false;
+    LastInstance = Inst;
+    int DeclIdx = getTopLevelDeclIndex(std::get<1>(R));
+    // the cumulative intervals only mean anything when collection hands
+    // out counters in top-level source order
+    if ((DeclIdx < 1) || (DeclIdx < LastDeclIdx))
+      return false;
+    LastDeclIdx = DeclIdx;
+    if (Counts.size() < static_cast<size_t>(DeclIdx))
+      Counts.resize(DeclIdx, 0);
+    Counts[DeclIdx - 1]++;
+  }
+  return LastInstance == ValidInstanceNum;
+}
+
+bool Transformation::canSkipDeclSubtree(const clang::Decl *D)
+{
+  // queries, full counts, and every range-recording mode must see all
+  // instances
+  if (DeclInstanceCumulative.empty() || QueryInstanceOnly ||
+      CountFullInstances || (InstanceBudget > 0) || needsInstanceRanges())
+    return false;
+
+  SourceLocation Begin = SrcManager->getExpansionLoc(D->getBeginLoc());
+  if (Begin.isInvalid() ||
+      (SrcManager->getFileID(Begin) != SrcManager->getMainFileID()))
+    return false;
+  unsigned Offset = SrcManager->getFileOffset(Begin);
+  int DeclIdx = getTopLevelDeclIndex(Offset);
+  if (DeclIdx < 1)
+    return false;
+  // only a whole top-level subtree may be skipped: a nested decl shares
+  // its top-level interval and crediting it here would double count the
+  // sibling decls
+  if (TopLevelDeclOffsets[DeclIdx - 1].first != Offset)
+    return false;
+
+  size_t NumCounted = DeclInstanceCumulative.size() - 1;
+  int First, Last;
+  if (static_cast<size_t>(DeclIdx) <= NumCounted) {
+    First = DeclInstanceCumulative[DeclIdx - 1] + 1;
+    Last = DeclInstanceCumulative[DeclIdx];
+  }
+  else {
+    // past the last decl the census saw an instance in
+    First = DeclInstanceCumulative[NumCounted] + 1;
+    Last = First - 1;
+  }
+  int To = (ToCounter > 0) ? ToCounter : TransformationCounter;
+  if ((Last >= TransformationCounter) && (First <= To))
+    return false;
+  // collection must stand exactly where the census said this decl
+  // begins, otherwise the credited counts no longer line up
+  if (ValidInstanceNum != First - 1)
+    return false;
+
+  ValidInstanceNum = Last;
+  return true;
+}
+
+void Transformation::outputInstanceAddresses(llvm::raw_ostream &OutStream)
+{
+  llvm::DenseMap<int, int> LocalSeen;
+  int LastInstance = 0;
+  for (const auto &R : InstanceRanges) {
+    int Inst = std::get<0>(R);
+    // only the first range of a multi-range instance carries its address
+    if (Inst == LastInstance)
+      continue;
+    LastInstance = Inst;
+    int DeclIdx = getTopLevelDeclIndex(std::get<1>(R));
+    if (DeclIdx < 0)
+      continue;
+    OutStream << "Instance address: " << Inst << " " << DeclIdx
+              << " " << ++LocalSeen[DeclIdx] << "\n";
+  }
+  OutStream.flush();
+}
+
+void Transformation::outputInstanceLocations(llvm::raw_ostream &OutStream)
+{
+  for (const auto &R : InstanceRanges) {
+    OutStream << "Instance location: " << std::get<0>(R)
+              << " " << std::get<1>(R)
+              << " " << std::get<2>(R) << "\n";
+  }
+  OutStream.flush();
+}
+
+// Union-find root lookup with path halving over the parent map used by
+// outputConflictComponents; every instance starts as its own parent.
+static int findConflictRoot(llvm::DenseMap<int, int> &Parent, int Inst)
+{
+  while (Parent[Inst] != Inst) {
+    Parent[Inst] = Parent[Parent[Inst]];
+    Inst = Parent[Inst];
+  }
+  return Inst;
+}
+
+void Transformation::outputConflictComponents(llvm::raw_ostream &OutStream)
+{
+  if (InstanceRanges.empty())
+    return;
+
+  std::vector<std::tuple<unsigned, unsigned, int>> Ranges;
+  for (const auto &R : InstanceRanges)
+    Ranges.push_back(std::make_tuple(std::get<1>(R), std::get<2>(R),
+                                     std::get<0>(R)));
+  std::sort(Ranges.begin(), Ranges.end());
+
+  llvm::DenseMap<int, int> Parent;
+  for (const auto &R : Ranges)
+    Parent[std::get<2>(R)] = std::get<2>(R);
+
+  // Sweep in begin-offset order: a range starting before the high-water
+  // mark of the current run overlaps something already in it, which is
+  // exactly an edge of the conflict graph; an instance whose ranges land
+  // in several runs merges them.  This builds the components in
+  // O(n log n) without materializing the (potentially quadratic) edges.
+  int RunRep = std::get<2>(Ranges[0]);
+  unsigned RunEnd = std::get<1>(Ranges[0]);
+  for (size_t I = 1; I < Ranges.size(); ++I) {
+    unsigned BeginOff = std::get<0>(Ranges[I]);
+    unsigned EndOff = std::get<1>(Ranges[I]);
+    int Inst = std::get<2>(Ranges[I]);
+    if (BeginOff < RunEnd) {
+      int RootA = findConflictRoot(Parent, RunRep);
+      int RootB = findConflictRoot(Parent, Inst);
+      Parent[RootA] = RootB;
+      if (EndOff > RunEnd)
+        RunEnd = EndOff;
+    }
+    else {
+      RunRep = Inst;
+      RunEnd = EndOff;
+    }
+  }
+
+  // Number the components by first appearance in counter order so the
+  // assignment is stable across runs of the same input.
+  std::map<int, int> ComponentByInstance;
+  for (const auto &R : Ranges)
+    ComponentByInstance[std::get<2>(R)] = 0;
+  llvm::DenseMap<int, int> ComponentOfRoot;
+  int NextComponent = 0;
+  for (auto &CI : ComponentByInstance) {
+    int Root = findConflictRoot(Parent, CI.first);
+    auto RI = ComponentOfRoot.find(Root);
+    if (RI == ComponentOfRoot.end()) {
+      ComponentOfRoot[Root] = ++NextComponent;
+      CI.second = NextComponent;
+    }
+    else {
+      CI.second = (*RI).second;
+    }
+  }
+
+  for (const auto &CI : ComponentByInstance)
+    OutStream << "Conflict component: " << CI.first << " "
+              << CI.second << "\n";
+  OutStream.flush();
+}
+
+void Transformation::outputInstanceWeights(llvm::raw_ostream &OutStream)
+{
+  // Sum the recorded extents per instance; an instance recorded with
+  // several ranges (e.g. every redeclaration of a function) weighs the
+  // total text its rewrite would touch.
+  std::map<int, unsigned long> BytesByInstance;
+  for (const auto &IR : InstanceRanges) {
+    unsigned BeginOff = std::get<1>(IR);
+    unsigned EndOff = std::get<2>(IR);
+    if (EndOff > BeginOff)
+      BytesByInstance[std::get<0>(IR)] += EndOff - BeginOff;
+  }
+
+  // Heaviest first; equal weights keep discovery order, which is the
+  // order the driver would have probed anyway.
+  std::vector<std::pair<unsigned long, int>> Ranked;
+  Ranked.reserve(BytesByInstance.size());
+  for (const auto &BI : BytesByInstance)
+    Ranked.push_back(std::make_pair(BI.second, -BI.first));
+  std::sort(Ranked.rbegin(), Ranked.rend());
+
+  for (const auto &RI : Ranked)
+    OutStream << "Instance weight: " << -RI.second << " "
+              << RI.first << "\n";
+  OutStream.flush();
+}
+
+unsigned long Transformation::getRecordedRangeBytes()
+{
+  // Ranges may overlap between instances, so this is an estimate, not a
+  // guaranteed yield.
+  unsigned long Total = 0;
+  for (const auto &R : InstanceRanges) {
+    unsigned BeginOff = std::get<1>(R);
+    unsigned EndOff = std::get<2>(R);
+    if (EndOff > BeginOff)
+      Total += EndOff - BeginOff;
+  }
+  return Total;
+}
+
+void Transformation::outputScheduleCandidates(llvm::raw_ostream &OutStream)
+{
+  if ((ScheduleCandidates <= 0) || InstanceRanges.empty())
+    return;
+
+  // Collapse the per-range records into one extent and one yield per
+  // instance; InstanceRanges keeps the ranges of an instance adjacent.
+  std::vector<std::tuple<int, unsigned, unsigned, unsigned long>> Extents;
+  for (const auto &R : InstanceRanges) {
+    int Inst = std::get<0>(R);
+    unsigned BeginOff = std::get<1>(R);
+    unsigned EndOff = std::get<2>(R);
+    unsigned long Bytes = (EndOff > BeginOff) ? (EndOff - BeginOff) : 0;
+    if (!Extents.empty() && (std::get<0>(Extents.back()) == Inst)) {
+      auto &E = Extents.back();
+      if (BeginOff < std::get<1>(E))
+        std::get<1>(E) = BeginOff;
+      if (EndOff > std::get<2>(E))
+        std::get<2>(E) = EndOff;
+      std::get<3>(E) += Bytes;
+    }
+    else {
+      Extents.push_back(std::make_tuple(Inst, BeginOff, EndOff, Bytes));
+    }
+  }
+
+  unsigned long TotalBytes = 0;
+  for (const auto &E : Extents)
+    TotalBytes += std::get<3>(E);
+  unsigned long Target = TotalBytes / ScheduleCandidates;
+  if (Target == 0)
+    Target = 1;
+
+  // Greedy sweep in counter order: grow the current candidate and close
+  // it at the first boundary where the next instance starts past every
+  // byte the candidates so far could touch, once the candidate carries
+  // its share of the total yield.  Collection order is roughly source
+  // order but not guaranteed, so the high-water mark (rather than the
+  // previous extent's end) is what keeps the emitted ranges globally
+  // disjoint.
+  int Emitted = 0;
+  int FromCounter = std::get<0>(Extents[0]);
+  int ToCounter = FromCounter;
+  unsigned MaxEndSeen = std::get<2>(Extents[0]);
+  unsigned long CandidateBytes = std::get<3>(Extents[0]);
+  for (size_t I = 1; I < Extents.size(); ++I) {
+    int Inst = std::get<0>(Extents[I]);
+    unsigned BeginOff = std::get<1>(Extents[I]);
+    unsigned EndOff = std::get<2>(Extents[I]);
+    if ((BeginOff >= MaxEndSeen) && (CandidateBytes >= Target) &&
+        (Emitted + 1 < ScheduleCandidates)) {
+      OutStream << "Schedule candidate: " << FromCounter << " "
+                << ToCounter << " " << CandidateBytes << "\n";
+      Emitted++;
+      FromCounter = Inst;
+      CandidateBytes = 0;
+    }
+    ToCounter = Inst;
+    CandidateBytes += std::get<3>(Extents[I]);
+    if (EndOff > MaxEndSeen)
+      MaxEndSeen = EndOff;
+  }
+  OutStream << "Schedule candidate: " << FromCounter << " "
+            << ToCounter << " " << CandidateBytes << "\n";
+  OutStream.flush();
+}
+
+void Transformation::outputCounterRemap(llvm::raw_ostream &OutStream)
+{
+  FileID MainFileID = SrcManager->getMainFileID();
+  // auto: RewriteBuffer moved from the clang to the llvm namespace in
+  // newer LLVM releases.
+  const auto *RWBuf = TheRewriter.getRewriteBufferFor(MainFileID);
+
+  int LastCounter =
+    (ToCounter > TransformationCounter) ? ToCounter : TransformationCounter;
+
+  // An instance survives only when every recorded range kept its length
+  // under the rewrite's offset mapping; a touched instance needs a fresh
+  // discovery and forfeits its number.
+  std::map<int, bool> Intact;
+  std::map<int, std::pair<unsigned, unsigned> > NewRanges;
+  for (const auto &R : InstanceRanges) {
+    int Inst = std::get<0>(R);
+    unsigned BeginOff = std::get<1>(R);
+    unsigned EndOff = std::get<2>(R);
+    unsigned NewBegin = BeginOff;
+    unsigned NewEnd = EndOff;
+    if (RWBuf) {
+      NewBegin = RWBuf->getMappedOffset(BeginOff);
+      NewEnd = RWBuf->getMappedOffset(EndOff, /*AfterInserts=*/true);
+    }
+    bool Unchanged = (NewEnd >= NewBegin) &&
+                     ((NewEnd - NewBegin) == (EndOff - BeginOff));
+    if (!Intact.count(Inst)) {
+      Intact[Inst] = Unchanged;
+      NewRanges[Inst] = std::make_pair(NewBegin, NewEnd);
+    }
+    else if (!Unchanged) {
+      Intact[Inst] = false;
+    }
+  }
+
+  int NewNum = 0;
+  for (std::map<int, bool>::iterator I = Intact.begin(), E = Intact.end();
+       I != E; ++I) {
+    int Inst = (*I).first;
+    if ((Inst >= TransformationCounter) && (Inst <= LastCounter))
+      continue;
+    if (!(*I).second)
+      continue;
+    NewNum++;
+    OutStream << "Counter remap: " << Inst << " " << NewNum
+              << " " << NewRanges[Inst].first
+              << " " << NewRanges[Inst].second << "\n";
+  }
   OutStream.flush();
 }
 
@@ -160,12 +775,21 @@ void Transformation::getTransErrorMsg(std::string &ErrorMsg)
     ErrorMsg =
       "The to-counter value exceeded the number of transformation instances!";
   }
+  else if (TransError == TransDeadlineError) {
+    ErrorMsg = "The transformation hit its deadline and was cancelled!";
+  }
+  else if (TransError == TransSizeLimitError) {
+    ErrorMsg = "The transformed program exceeds the size-delta budget!";
+  }
   else {
     TransAssert(0 && "Unknown transformation error!");
   }
 }
 
 bool Transformation::checkCounterValidity() {
+  if (ToCounter == ToCounterMax)
+    ToCounter = ValidInstanceNum;
+
   if (TransformationCounter > ValidInstanceNum) {
     if (WarnOnCounterOutOfBounds) {
       TransformationCounter = ValidInstanceNum;
@@ -191,6 +815,14 @@ bool Transformation::checkCounterValidity() {
   return true;
 }
 
+bool Transformation::isPreservedRoutine(const FunctionDecl *FD)
+{
+  if (!DoPreserveRoutine)
+    return false;
+  // the qualified-name string is only computed when the option is on
+  return FD->getQualifiedNameAsString() == PreserveRoutine;
+}
+
 const Expr *
 Transformation::ignoreSubscriptExprParenCasts(const Expr *E)
 {
@@ -950,7 +1582,7 @@ bool Transformation::replaceDependentNameString(const Type *Ty,
   if (Arg.getKind() != TemplateArgument::Type)
     return false;
   QualType ArgQT = Arg.getAsType();
-  ArgQT.getAsStringInternal(Str, getPrintingPolicy());
+  Str = getCachedTypeString(ArgQT);
   Str += "::";
   Str += IdInfo->getName();
   Typename = true;
@@ -971,7 +1603,7 @@ bool Transformation::getTemplateTypeParmString(
   if (Arg.getKind() != TemplateArgument::Type)
     return false;
   QualType ArgQT = Arg.getAsType();
-  ArgQT.getAsStringInternal(Str, getPrintingPolicy());
+  Str = getCachedTypeString(ArgQT);
   return true;
 }
 
@@ -1085,7 +1717,7 @@ bool Transformation::getTypeString(const QualType &QT,
 
   case Type::Record:
   case Type::Builtin: { // fall-through
-    QT.getAsStringInternal(Str, getPrintingPolicy());
+    Str = getCachedTypeString(QT);
     return true;
   }
 
@@ -1111,10 +1743,35 @@ unsigned Transformation::getNumExplicitDecls(const CXXRecordDecl *CXXRD)
   return Num;
 }
 
-bool Transformation::isInIncludedFile(SourceLocation Loc) const
+// out-of-line slow path of isInIncludedFile, reached for macro
+// locations only
+bool Transformation::isInIncludedFileSlow(SourceLocation Loc) const
 {
   Loc = getRealLocation(Loc);
-  return SrcManager->getFileID(Loc) != SrcManager->getMainFileID();
+  if (SrcManager->getFileID(Loc) != SrcManager->getMainFileID())
+    return true;
+  if (CensusWindowSet)
+    return isOutsideCensusWindow(SrcManager->getFileOffset(Loc));
+  return false;
+}
+
+bool Transformation::isOutsideCensusWindow(unsigned Offset) const
+{
+  // Align the window to whole top-level declarations on first use (the
+  // declaration table only exists once the parse is done): an edit
+  // inside a function must recount every instance of that function,
+  // not just the ones past the hunk's first byte.
+  if (!CensusWindowExpanded) {
+    CensusWindowExpanded = true;
+    Transformation *Self = const_cast<Transformation *>(this);
+    int BeginIdx = Self->getTopLevelDeclIndex(CensusWindowBegin);
+    if (BeginIdx > 0)
+      CensusWindowBegin = Self->TopLevelDeclOffsets[BeginIdx - 1].first;
+    int EndIdx = Self->getTopLevelDeclIndex(CensusWindowEnd);
+    if (EndIdx > 0)
+      CensusWindowEnd = Self->TopLevelDeclOffsets[EndIdx - 1].second;
+  }
+  return (Offset < CensusWindowBegin) || (Offset > CensusWindowEnd);
 }
 
 bool Transformation::isInIncludedFile(const Decl *D) const
@@ -1159,8 +1816,54 @@ clang::PrintingPolicy Transformation::getPrintingPolicy() const {
   return Policy;
 }
 
+const clang::PrintingPolicy &Transformation::getCachedPrintingPolicy()
+{
+  if (!CachedPrintingPolicy)
+    CachedPrintingPolicy = new clang::PrintingPolicy(getPrintingPolicy());
+  return *CachedPrintingPolicy;
+}
+
+const std::string &Transformation::getCachedTypeString(clang::QualType QT)
+{
+  // The opaque pointer covers the qualifiers, so "const T" and "T" get
+  // separate entries; no type prints as the empty string, so an empty
+  // slot always means a fresh one.
+  std::string &Str = TypeStringCache[QT.getAsOpaquePtr()];
+  if (Str.empty())
+    QT.getAsStringInternal(Str, getCachedPrintingPolicy());
+  return Str;
+}
+
 Transformation::~Transformation(void)
 {
+  delete CachedPrintingPolicy;
   RewriteUtils::Finalize();
 }
 
+
+// -------------------- visitor hot-path statistics --------------------
+
+static VisitorStats *VisitorStatsHead = NULL;
+
+VisitorStats::VisitorStats(const char *StatsLabel)
+  : Label(StatsLabel),
+    Visits(0),
+    Attempts(0),
+    Matches(0),
+    Next(VisitorStatsHead)
+{
+  VisitorStatsHead = this;
+}
+
+void dumpVisitorStats(const char *LedgerPath)
+{
+  if (!LedgerPath)
+    return;
+  for (VisitorStats *S = VisitorStatsHead; S; S = S->Next) {
+    if (!S->Visits && !S->Attempts && !S->Matches)
+      continue;
+    TransformationManager::appendPerfLedger(LedgerPath, S->Label,
+                                            S->Visits, S->Attempts,
+                                            S->Matches, 0);
+  }
+}
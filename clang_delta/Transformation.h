@@ -12,8 +12,14 @@
 #define TRANSFORMATION_H
 
 #include <string>
+#include <climits>
+#include <csignal>
 #include <cstdlib>
 #include <cassert>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "clang/AST/ASTConsumer.h"
 #include "clang/AST/PrettyPrinter.h"
@@ -37,6 +43,7 @@ namespace clang {
   class NestedNameSpecifier;
   class TemplateSpecializationType;
   class NamedDecl;
+  class FunctionDecl;
   class CXXConstructorDecl;
   class TypeLoc;
   class TemplateArgument;
@@ -55,7 +62,9 @@ typedef enum {
   TransNoValidFunsError,
   TransNoValidParamsError,
   TransNoTextModificationError,
-  TransToCounterTooBigError
+  TransToCounterTooBigError,
+  TransDeadlineError,
+  TransSizeLimitError
 } TransformationError;
 
 namespace clang_delta_common_visitor {
@@ -64,6 +73,12 @@ template<typename T> class CommonRenameClassRewriteVisitor;
 
 }
 
+// Container policy for transformation-local bookkeeping: prefer the LLVM
+// ADTs over std::map/std::set for per-node state - DenseMap/SmallPtrSet
+// for AST-node keys, StringMap/StringSet for name keys, and SetVector
+// where a deterministic iteration order is part of the behavior.  The
+// node-keyed tree containers show up prominently in profiles on large
+// translation units.
 class Transformation : public clang::ASTConsumer {
 
 template<typename T>
@@ -71,6 +86,30 @@ friend class clang_delta_common_visitor::CommonRenameClassRewriteVisitor;
 
 public:
 
+  // Cooperative cancellation token.  The manager arms a deadline before
+  // HandleTranslationUnit and the SIGALRM handler flips the flag; long
+  // visitor loops poll isCancelRequested() and bail out of the
+  // traversal, and the pass then reports TransDeadlineError.  Compared
+  // to the driver's SIGKILL this keeps whatever the run already
+  // computed: a query still reports its partial census, and a daemon
+  // process keeps its parsed AST and caches for the next request.
+  static void requestCancellation() {
+    CancelFlag = 1;
+  }
+
+  static void clearCancellation() {
+    CancelFlag = 0;
+  }
+
+  static bool isCancelRequested() {
+    return CancelFlag != 0;
+  }
+
+  // Sentinel to-counter value meaning "up to the last valid instance";
+  // it is clamped to ValidInstanceNum once the analysis has counted the
+  // instances, so a single invocation can rewrite the whole set.
+  static const int ToCounterMax = INT_MAX;
+
   Transformation(const char *TransName, const char *Desc)
     : Name(TransName),
       TransformationCounter(-1),
@@ -87,13 +126,35 @@ public:
       DoReplacement(false),
       DoPreserveRoutine(false),
       CheckReference(false),
-      WarnOnCounterOutOfBounds(false)
+      CheckSizeDelta(false),
+      MaxSizeDelta(0),
+      WarnOnCounterOutOfBounds(false),
+      CountFullInstances(false),
+      InstanceBudget(0),
+      DumpInstanceLocations(false),
+      DumpConflictComponents(false),
+      DumpInstanceWeights(false),
+      EmitCounterRemap(false),
+      DumpInstanceAddresses(false),
+      ScheduleCandidates(0),
+      AddressDeclIndex(-1),
+      AddressLocalOrdinal(-1),
+      AddressedInstance(0),
+      TopLevelDeclOffsetsBuilt(false),
+      SafeToSkipFunctionBodies(false),
+      MainFileBeginRaw(0),
+      MainFileEndRaw(0),
+      CensusWindowBegin(0),
+      CensusWindowEnd(0),
+      CensusWindowSet(false),
+      CensusWindowExpanded(false),
+      CachedPrintingPolicy(NULL)
   {
     // Nothing to do
   }
 
-  Transformation(const char *TransName, 
-                 const char *Desc, 
+  Transformation(const char *TransName,
+                 const char *Desc,
                  bool MultipleRewritesFlag)
     : Name(TransName),
       TransformationCounter(-1),
@@ -110,7 +171,29 @@ public:
       DoReplacement(false),
       DoPreserveRoutine(false),
       CheckReference(false),
-      WarnOnCounterOutOfBounds(false)
+      CheckSizeDelta(false),
+      MaxSizeDelta(0),
+      WarnOnCounterOutOfBounds(false),
+      CountFullInstances(false),
+      InstanceBudget(0),
+      DumpInstanceLocations(false),
+      DumpConflictComponents(false),
+      DumpInstanceWeights(false),
+      EmitCounterRemap(false),
+      DumpInstanceAddresses(false),
+      ScheduleCandidates(0),
+      AddressDeclIndex(-1),
+      AddressLocalOrdinal(-1),
+      AddressedInstance(0),
+      TopLevelDeclOffsetsBuilt(false),
+      SafeToSkipFunctionBodies(false),
+      MainFileBeginRaw(0),
+      MainFileEndRaw(0),
+      CensusWindowBegin(0),
+      CensusWindowEnd(0),
+      CensusWindowSet(false),
+      CensusWindowExpanded(false),
+      CachedPrintingPolicy(NULL)
   {
     // Nothing to do
   }
@@ -122,6 +205,12 @@ public:
 
   void outputTransformedSource(llvm::raw_ostream &OutStream);
 
+  void outputTransformedSourceAsDiff(llvm::raw_ostream &OutStream);
+
+  // --compute-only: hash and single-hunk extent of the would-be output,
+  // from one pass over the rewrite rope; no output is constructed.
+  std::string computeEditSummary(llvm::raw_ostream &OutStream);
+
   void setTransformationCounter(int Counter) {
     TransformationCounter = Counter;
   }
@@ -142,6 +231,160 @@ public:
     return MultipleRewrites;
   }
 
+  void setCountFullInstances(bool Flag) {
+    CountFullInstances = Flag;
+  }
+
+  void setDumpInstanceLocations(bool Flag) {
+    DumpInstanceLocations = Flag;
+  }
+
+  void setDumpConflictComponents(bool Flag) {
+    DumpConflictComponents = Flag;
+  }
+
+  void setDumpInstanceWeights(bool Flag) {
+    DumpInstanceWeights = Flag;
+  }
+
+  void setEmitCounterRemap(bool Flag) {
+    EmitCounterRemap = Flag;
+  }
+
+  void setDumpInstanceAddresses(bool Flag) {
+    DumpInstanceAddresses = Flag;
+  }
+
+  void setScheduleCandidates(int Num) {
+    ScheduleCandidates = Num;
+  }
+
+  // Two-level counter addressing: name an instance by (top-level-decl
+  // index, local ordinal) instead of a global ordinal, so edits in one
+  // declaration leave addresses in every other declaration valid.  The
+  // address resolves to a global counter while collection records the
+  // instance ranges; until then the counter holds the unresolved
+  // sentinel, so a stale address fails like an out-of-range counter.
+  void setCounterAddress(int DeclIndex, int LocalOrdinal) {
+    AddressDeclIndex = DeclIndex;
+    AddressLocalOrdinal = LocalOrdinal;
+    TransformationCounter = ToCounterMax;
+  }
+
+  // Print one "Instance address: <instance> <decl-index> <local-ordinal>"
+  // line per recorded instance whose first range lies inside a top-level
+  // declaration of the main file; see recordInstanceRange.
+  void outputInstanceAddresses(llvm::raw_ostream &OutStream);
+
+  // Print one "Instance location: <instance> <begin> <end>" line per
+  // recorded source range; see recordInstanceRange.
+  void outputInstanceLocations(llvm::raw_ostream &OutStream);
+
+  // Group the recorded instances into connected components of the
+  // conflict graph (two instances conflict when any of their recorded
+  // ranges overlap) and print one "Conflict component: <instance>
+  // <component>" line per instance.  Instances in different components
+  // cannot invalidate each other, so a driver can bisect every
+  // component in parallel instead of over the global counter range.
+  void outputConflictComponents(llvm::raw_ostream &OutStream);
+
+  // Print one "Instance weight: <instance> <bytes>" line per recorded
+  // instance, heaviest first, where the weight is the byte total of the
+  // instance's recorded ranges.  Instance numbering is untouched; the
+  // line order is a suggested probe order, so a driver can try the
+  // rewrites that would eliminate the most text before the shallow ones
+  // discovered earlier in the traversal.
+  void outputInstanceWeights(llvm::raw_ostream &OutStream);
+
+  // Total bytes spanned by the recorded instance ranges, an upper-bound
+  // estimate of how much this transformation could remove from the file;
+  // 0 for transformations that do not record ranges.
+  unsigned long getRecordedRangeBytes();
+
+  // After a successful rewrite, print one "Counter remap: <old> <new>
+  // <begin> <end>" line per instance whose recorded ranges the rewrite
+  // left untouched, with offsets mapped into the transformed file. New
+  // numbers assume touched instances vanished, so they are advisory: a
+  // driver can continue from them and fall back to re-querying when a
+  // continued counter misses.
+  void outputCounterRemap(llvm::raw_ostream &OutStream);
+
+  // Partition the recorded instances into up to ScheduleCandidates
+  // contiguous counter ranges whose byte extents do not overlap, balanced
+  // by estimated yield, and print one "Schedule candidate: <from-counter>
+  // <to-counter> <bytes>" line per range; each range is directly
+  // applicable with --counter/--to-counter, so a driver can hand every
+  // worker a distinct candidate instead of overlapping halves of the
+  // same window.
+  void outputScheduleCandidates(llvm::raw_ostream &OutStream);
+
+  // Declaration-level transformations that do not look at (or rewrite
+  // inside) function bodies set SafeToSkipFunctionBodies in their
+  // constructor, allowing the manager to parse with clang's
+  // skip-function-bodies mode.
+  bool isSkipFunctionBodiesSafe() {
+    return SafeToSkipFunctionBodies;
+  }
+
+  // Whether instance collection has to keep going.  Collection visitors
+  // can return this from their Visit callbacks to abort the AST traversal
+  // as soon as the requested instance has been located; instance queries
+  // and multi-instance rewrites still need the complete census.
+  bool needsMoreInstances() const {
+    // A sampled query stops at the budget: the caller only wants to know
+    // whether instances are plentiful, not the exact count.
+    if (InstanceBudget > 0)
+      return ValidInstanceNum < InstanceBudget;
+    if (QueryInstanceOnly || CountFullInstances || (ToCounter > 0))
+      return true;
+    return ValidInstanceNum < TransformationCounter;
+  }
+
+  void setInstanceBudget(int Budget) {
+    InstanceBudget = Budget;
+  }
+
+  // Differential census: restrict instance collection to the top-level
+  // declarations intersecting [Begin, End] (byte offsets in the main
+  // file, typically the extent of an accepted edit's hunk).  Combined
+  // with the per-decl counts from a previous census, a query over just
+  // the edited declarations is enough to patch the old census table;
+  // recounting then scales with the edit, not the file.  Query-only:
+  // a rewrite must see every instance so the counter keeps meaning
+  // what it meant when the census named it.
+  void setCensusWindow(unsigned Begin, unsigned End) {
+    CensusWindowBegin = Begin;
+    CensusWindowEnd = End;
+    CensusWindowSet = true;
+  }
+
+  // Sparse-batch subtree skip.  With per-top-level-decl instance counts
+  // from a census over this same parse (setDeclInstanceCounts), a
+  // collection visitor may consult this before descending into a
+  // definition: when the decl's counter interval misses the requested
+  // [counter, to-counter] range entirely, its instances are credited to
+  // ValidInstanceNum and the whole subtree is skipped, so a sparse batch
+  // rewrite scales with the requested instances instead of the TU.
+  // Query and range-recording modes never skip -- they must see every
+  // instance -- and only exact top-level declarations qualify, since a
+  // nested decl shares its top-level interval with its siblings.
+  bool canSkipDeclSubtree(const clang::Decl *D);
+
+  // Arm the skip; Counts[0] belongs to top-level declaration 1.
+  void setDeclInstanceCounts(const std::vector<int> &Counts);
+
+  // Distill the recorded instance ranges into per-top-level-decl counts.
+  // False when any instance recorded no main-file range, instances went
+  // out of source order, or one fell outside every top-level decl: a
+  // table missing instances would corrupt the skip credit.
+  bool getPerDeclInstanceCounts(std::vector<int> &Counts);
+
+  // True when collection stopped at the sampling budget; the reported
+  // instance count is then only a lower bound.
+  bool instanceCountTruncated() const {
+    return (InstanceBudget > 0) && (ValidInstanceNum >= InstanceBudget);
+  }
+
   void setQueryInstanceFlag(bool Flag) {
     QueryInstanceOnly = Flag;
   }
@@ -156,11 +399,27 @@ public:
     DoPreserveRoutine = true;
   }
 
+  // True when --preserve-routine names this function.  Collection
+  // visitors should prune the preserved function's whole subtree at the
+  // traversal level rather than discarding its matches one by one: the
+  // preserved routine is typically the largest definition in the file,
+  // so skipping it wholesale saves most of the traversal.
+  bool isPreservedRoutine(const clang::FunctionDecl *FD);
+
   void setReferenceValue(const std::string &Str) {
     ReferenceValue = Str;
     CheckReference = true;
   }
 
+  // Arm the guaranteed-progress gate: a transformed source larger than
+  // the input plus Delta bytes reports TransSizeLimitError and is never
+  // written, so the driver never tests a doomed-by-policy candidate.  A
+  // negative delta demands strictly smaller output.
+  void setMaxSizeDelta(long Delta) {
+    MaxSizeDelta = Delta;
+    CheckSizeDelta = true;
+  }
+
   bool transSuccess() {
     return (TransError == TransSuccess);
   }
@@ -178,6 +437,10 @@ public:
             (TransError == TransToCounterTooBigError));
   }
 
+  TransformationError getTransError() {
+    return TransError;
+  }
+
   std::string &getDescription() {
     return DescriptionString;
   }
@@ -194,8 +457,30 @@ public:
     return false;
   }
 
+  // Counter-independent analysis that can run once on the parsed AST
+  // and be shared by every counter applied to it.  The manager calls
+  // this right after the single parse in the fork-server, daemon and
+  // counter-list modes, so forked children inherit the results through
+  // copy-on-write instead of recomputing them per probe.
+  virtual void prepareSharedAnalysis(clang::ASTContext &Ctx) { }
+
+  // Force the Rewriter's lazy copy of the main buffer into its rewrite
+  // rope now. The parse-once modes call this in the parent after the
+  // single parse: forked children then share the rope nodes through
+  // copy-on-write and their first edit no longer pays for copying the
+  // whole source, which would otherwise dominate per-counter setup on
+  // very large files.
+  void primeRewriteBuffer();
+
 protected:
 
+  // The guaranteed-progress gate shared by the two output routines;
+  // fires TransSizeLimitError when the transformed source overruns the
+  // input length plus MaxSizeDelta.
+  bool exceedsSizeDelta(size_t NewSize);
+
+  static volatile sig_atomic_t CancelFlag;
+
   typedef llvm::SmallVector<unsigned int, 10> IndexVector;
 
   typedef llvm::SmallVector<const clang::ArrayType *, 10> ArraySubTypeVector;
@@ -313,7 +598,28 @@ protected:
 
   unsigned getNumExplicitDecls(const clang::CXXRecordDecl *CXXRD);
 
-  bool isInIncludedFile(clang::SourceLocation Loc) const;
+  // Hot per-node filter: every collection visitor calls this for every
+  // decl or stmt it sees.  File locations of the main file occupy one
+  // contiguous raw-offset range, so the overwhelmingly common case folds
+  // to two integer compares the compiler can inline into the traversal
+  // loop; only macro locations still pay the SourceManager lookup.
+  bool isInIncludedFile(clang::SourceLocation Loc) const {
+    if (Loc.isFileID()) {
+      unsigned Raw = Loc.getRawEncoding();
+      if ((Raw < MainFileBeginRaw) || (Raw > MainFileEndRaw))
+        return true;
+      // a census window folds into the same skip predicate, so every
+      // collection visitor inherits the windowed recount for free
+      if (CensusWindowSet)
+        return isOutsideCensusWindow(Raw - MainFileBeginRaw);
+      return false;
+    }
+    return isInIncludedFileSlow(Loc);
+  }
+
+  bool isInIncludedFileSlow(clang::SourceLocation Loc) const;
+
+  bool isOutsideCensusWindow(unsigned Offset) const;
 
   bool isInIncludedFile(const clang::SourceRange& Range) const {
     return isInIncludedFile(Range.getBegin()) ||isInIncludedFile(Range.getEnd());
@@ -327,11 +633,46 @@ protected:
 
   clang::PrintingPolicy getPrintingPolicy() const;
 
+  // Shared stringification service.  getPrintingPolicy builds a fresh
+  // policy per call and clang's type printer re-walks the whole type
+  // each time, which is super-linear on deeply nested template
+  // arguments; the cached variants reuse one policy object and memoize
+  // the printed spelling per type, so stringifying the same type again
+  // during collection costs a hash lookup.  Both caches are cleared on
+  // Initialize -- the policy and the type pointers die with the parse.
+  const clang::PrintingPolicy &getCachedPrintingPolicy();
+
+  // The spelling of QT with no declarator name embedded, equivalent to
+  // getAsStringInternal on an empty string.
+  const std::string &getCachedTypeString(clang::QualType QT);
+
   // If the location is a MacroID, get its expansion location.
   // Otherwise, just return the location.
   clang::SourceLocation getRealLocation(const clang::SourceLocation& Loc) const;
   clang::SourceRange getRealLocation(const clang::SourceRange& Range) const;
 
+  // In --dump-instance-locations mode collection visitors call this with
+  // the source range an instance would rewrite; an instance may record
+  // several ranges.  Ranges outside the main file are dropped.  The
+  // address modes piggyback on the same calls: the first recorded range
+  // of each instance fixes its (top-level-decl index, local ordinal)
+  // address.
+  void recordInstanceRange(int Instance, const clang::SourceRange &Range);
+
+  // Map a main-file offset to the 1-based index of the top-level
+  // declaration containing it, or -1 when it lies outside every
+  // top-level declaration; the offset table is built lazily.
+  int getTopLevelDeclIndex(unsigned Offset);
+
+  // Whether any active mode consumes recorded instance ranges; call
+  // sites can use this to skip assembling the ranges in the common case.
+  bool needsInstanceRanges() const {
+    return DumpInstanceLocations || DumpConflictComponents ||
+           DumpInstanceWeights || EmitCounterRemap ||
+           DumpInstanceAddresses || (ScheduleCandidates > 0) ||
+           (AddressDeclIndex >= 0);
+  }
+
   const std::string Name;
 
   int TransformationCounter;
@@ -372,7 +713,80 @@ protected:
 
   std::string ReferenceValue;
 
+  bool CheckSizeDelta;
+
+  long MaxSizeDelta;
+
   bool WarnOnCounterOutOfBounds;
+
+  bool CountFullInstances;
+
+  int InstanceBudget;
+
+  bool DumpInstanceLocations;
+
+  bool DumpConflictComponents;
+
+  bool DumpInstanceWeights;
+
+  bool EmitCounterRemap;
+
+  bool DumpInstanceAddresses;
+
+  int ScheduleCandidates;
+
+  // the requested two-level address; -1 when global counters are in use
+  int AddressDeclIndex;
+
+  int AddressLocalOrdinal;
+
+  // last instance whose address bookkeeping has been done, so the extra
+  // ranges of a multi-range instance do not shift the local ordinals
+  int AddressedInstance;
+
+  // per-top-level-decl count of instances seen so far during collection
+  llvm::DenseMap<int, int> AddressLocalSeen;
+
+  // (begin, end) main-file offsets of the top-level declarations, in
+  // source order; built on demand by getTopLevelDeclIndex
+  std::vector<std::pair<unsigned, unsigned>> TopLevelDeclOffsets;
+
+  // cumulative per-top-level-decl instance counts armed by
+  // setDeclInstanceCounts (element 0 is always 0); empty when the
+  // sparse-batch subtree skip is off
+  std::vector<int> DeclInstanceCumulative;
+
+  bool TopLevelDeclOffsetsBuilt;
+
+  // (instance, begin offset, end offset) triples recorded during
+  // collection; only filled when a mode listed in needsInstanceRanges
+  // asks for them
+  std::vector<std::tuple<int, unsigned, unsigned>> InstanceRanges;
+
+  bool SafeToSkipFunctionBodies;
+
+  // raw-encoding bounds of the main file, cached by Initialize for the
+  // inline isInIncludedFile fast path
+  unsigned MainFileBeginRaw;
+
+  unsigned MainFileEndRaw;
+
+  // census window (byte offsets in the main file); mutable because the
+  // lazy alignment to top-level declaration boundaries happens inside
+  // the const skip predicate
+  mutable unsigned CensusWindowBegin;
+
+  mutable unsigned CensusWindowEnd;
+
+  bool CensusWindowSet;
+
+  mutable bool CensusWindowExpanded;
+
+  // lazily built by getCachedPrintingPolicy, owned here
+  clang::PrintingPolicy *CachedPrintingPolicy;
+
+  // memoized type spellings keyed by the type's opaque pointer
+  llvm::DenseMap<const void *, std::string> TypeStringCache;
 };
 
 class TransNameQueryVisitor;
@@ -407,4 +821,42 @@ private:
   void operator=(const TransNameQueryWrap &);
 };
 
+// Opt-in hot-path counters for RecursiveASTVisitor subclasses.  A
+// visitor opts in by defining one file-level counter set and bumping
+// the fields from its Visit methods:
+//
+//   static VisitorStats RenameStats("rcm-rename");
+//   ...
+//   RenameStats.Visits++;     // node handed to the Visit method at all
+//   RenameStats.Attempts++;   // node that reached the real match test
+//   RenameStats.Matches++;    // node that passed it and got rewritten
+//
+// When CVISE_PERF_LEDGER is set, every non-zero counter set is written
+// to the ledger after a counter application finishes, one record per
+// visitor: the label goes in the phase field (keep it within 15
+// characters), duration_us holds Visits, bytes_in holds Attempts and
+// bytes_out holds Matches.  This answers "is the visitor seeing too
+// many nodes or matching too expensively?" from the artifacts of any
+// production run, without a profiler session.  The increments cost a
+// memory bump on file-scope statics, so instrumented visitors are
+// cheap enough to leave enabled.
+struct VisitorStats {
+  explicit VisitorStats(const char *StatsLabel);
+
+  const char *Label;
+
+  unsigned long long Visits;
+
+  unsigned long long Attempts;
+
+  unsigned long long Matches;
+
+  // registry chain for the dump, newest first
+  VisitorStats *Next;
+};
+
+// Append one ledger record per registered visitor with non-zero
+// counters; a no-op when LedgerPath is NULL.
+void dumpVisitorStats(const char *LedgerPath);
+
 #endif
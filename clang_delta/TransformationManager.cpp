@@ -14,18 +14,47 @@
 
 #include "TransformationManager.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <fstream>
 #include <sstream>
 
+#include <execinfo.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclGroup.h"
 #include "clang/Basic/Builtins.h"
 #include "clang/Basic/Diagnostic.h"
+#include "clang/Basic/DiagnosticOptions.h"
 #include "clang/Basic/FileManager.h"
 #include "clang/Basic/LangOptions.h"
 #include "clang/Basic/LangStandard.h"
 #include "clang/Basic/TargetInfo.h"
+#include "clang/Lex/Lexer.h"
 #include "clang/Lex/Preprocessor.h"
+#include "clang/Lex/PreprocessorOptions.h"
+#include "clang/Frontend/ASTUnit.h"
 #include "clang/Frontend/CompilerInstance.h"
+#include "clang/Frontend/FrontendActions.h"
 #include "clang/Parse/ParseAST.h"
+#include "clang/Serialization/PCHContainerOperations.h"
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/MemoryBuffer.h"
 
 #if LLVM_VERSION_MAJOR >= 20
 #include "llvm/Support/VirtualFileSystem.h"
@@ -38,10 +67,198 @@ using namespace clang;
 
 int TransformationManager::ErrorInvalidCounter = 1;
 
+int TransformationManager::ErrorMemoryBudget = 3;
+
+int TransformationManager::ErrorParseDeadline = 4;
+
+int TransformationManager::ErrorTransformationCrash = 5;
+
+int TransformationManager::ErrorTransDeadline = 6;
+
+int TransformationManager::ErrorSizeLimit = 7;
+
+namespace {
+
+// Lexical pre-screen table: a transformation listed here can only have
+// instances when every one of its patterns occurs somewhere in the raw
+// source bytes, so a probe on a file lacking a pattern can be answered
+// without parsing. Only patterns that any instance must spell out are
+// listed; token pasting could in principle assemble a keyword invisibly,
+// which merely costs a missed candidate, never a wrong rewrite.
+struct PreScreenEntry {
+  const char *TransName;
+  const char *Patterns[3];
+};
+
+static const PreScreenEntry PreScreenTable[] = {
+  { "class-template-to-class", { "template", NULL } },
+  { "instantiate-template-param", { "template", NULL } },
+  { "instantiate-template-type-param-to-int", { "template", NULL } },
+  { "reduce-array-dim", { "[", NULL } },
+  { "reduce-array-size", { "[", NULL } },
+  { "reduce-class-template-param", { "template", NULL } },
+  { "reduce-pointer-level", { "*", NULL } },
+  { "reduce-pointer-pairs", { "*", NULL } },
+  { "remove-addr-taken", { "&", NULL } },
+  { "remove-array", { "[", NULL } },
+  { "remove-enum-member-value", { "enum", "=", NULL } },
+  { "remove-namespace", { "namespace", NULL } },
+  { "remove-pointer", { "*", NULL } },
+  { "remove-trivial-base-template", { "template", NULL } },
+  { "remove-try-catch", { "try", NULL } },
+  { "remove-unused-enum-member", { "enum", NULL } },
+  { "rename-operator", { "operator", NULL } },
+  { "replace-array-access-with-index", { "[", NULL } },
+  { "replace-array-index-var", { "[", NULL } },
+  { "replace-class-with-base-template-spec", { "template", NULL } },
+  { "simplify-if", { "if", NULL } },
+  { "simplify-recursive-template-instantiation", { "template", NULL } },
+  { "template-arg-to-int", { "template", NULL } },
+  { "template-non-type-arg-to-int", { "template", NULL } },
+  { "union-to-struct", { "union", NULL } },
+  { "vector-to-array", { "vector", NULL } },
+};
+
+typedef std::chrono::steady_clock TimeReportClock;
+
+static double secondsSince(const TimeReportClock::time_point &Start)
+{
+  return std::chrono::duration<double>(TimeReportClock::now() - Start)
+           .count();
+}
+
+// A raw_ostream that forwards to an underlying stream while hashing every
+// byte written, so emitting an output content hash never needs a second
+// pass over the buffer.
+class HashingOStream : public llvm::raw_ostream {
+public:
+  explicit HashingOStream(llvm::raw_ostream &OS)
+    : Under(OS),
+      Bytes(0)
+  {
+    SetUnbuffered();
+  }
+
+  std::string digest() {
+    llvm::MD5::MD5Result Result;
+    Md5.final(Result);
+    return llvm::toHex(Result.digest());
+  }
+
+  uint64_t bytesWritten() const {
+    return Bytes;
+  }
+
+private:
+  void write_impl(const char *Ptr, size_t Size) override {
+    Md5.update(llvm::StringRef(Ptr, Size));
+    Bytes += Size;
+    Under.write(Ptr, Size);
+  }
+
+  uint64_t current_pos() const override {
+    return Under.tell();
+  }
+
+  llvm::raw_ostream &Under;
+
+  llvm::MD5 Md5;
+
+  uint64_t Bytes;
+};
+
+// An ASTConsumer that forwards everything but HandleTranslationUnit to the
+// current transformation.  It is installed in fork-server mode so that the
+// expensive ParseAST happens exactly once in the server process, while the
+// per-counter analysis and rewriting are deferred to forked children.
+class ForwardingConsumer : public ASTConsumer {
+public:
+  explicit ForwardingConsumer(ASTConsumer *Impl)
+    : TransImpl(Impl)
+  { }
+
+  void Initialize(ASTContext &Ctx) override {
+    TransImpl->Initialize(Ctx);
+  }
+
+  bool HandleTopLevelDecl(DeclGroupRef D) override {
+    return TransImpl->HandleTopLevelDecl(D);
+  }
+
+  void HandleTranslationUnit(ASTContext &Ctx) override {
+    // Deliberately empty: forked children invoke the transformation's
+    // HandleTranslationUnit on the already-parsed AST.
+  }
+
+private:
+  ASTConsumer *TransImpl;
+};
+
+// Forwards all callbacks to the transformation and records the time spent
+// in HandleTranslationUnit, so --time-report can separate traversal and
+// rewriting from raw parsing.
+class TimingConsumer : public ASTConsumer {
+public:
+  TimingConsumer(ASTConsumer *Impl, double *TransformSeconds)
+    : TransImpl(Impl),
+      TransformSeconds(TransformSeconds)
+  { }
+
+  void Initialize(ASTContext &Ctx) override {
+    TransImpl->Initialize(Ctx);
+  }
+
+  bool HandleTopLevelDecl(DeclGroupRef D) override {
+    return TransImpl->HandleTopLevelDecl(D);
+  }
+
+  void HandleTranslationUnit(ASTContext &Ctx) override {
+    TimeReportClock::time_point Start = TimeReportClock::now();
+    TransImpl->HandleTranslationUnit(Ctx);
+    *TransformSeconds = secondsSince(Start);
+  }
+
+private:
+  ASTConsumer *TransImpl;
+
+  double *TransformSeconds;
+};
+
+// Forwards Initialize and HandleTopLevelDecl to every registered
+// transformation so that a single parse can feed the instance-counting
+// path of all of them (--report-all-instances).
+class BroadcastConsumer : public ASTConsumer {
+public:
+  explicit BroadcastConsumer(const std::vector<ASTConsumer *> &Impls)
+    : TransImpls(Impls)
+  { }
+
+  void Initialize(ASTContext &Ctx) override {
+    for (ASTConsumer *C : TransImpls)
+      C->Initialize(Ctx);
+  }
+
+  bool HandleTopLevelDecl(DeclGroupRef D) override {
+    for (ASTConsumer *C : TransImpls)
+      C->HandleTopLevelDecl(D);
+    return true;
+  }
+
+  void HandleTranslationUnit(ASTContext &Ctx) override {
+    // Deliberately empty: the census runs each transformation's
+    // HandleTranslationUnit in a forked child.
+  }
+
+private:
+  std::vector<ASTConsumer *> TransImpls;
+};
+
+} // end anonymous namespace
+
 TransformationManager* TransformationManager::Instance;
 
-std::map<std::string, Transformation *> *
-TransformationManager::TransformationsMapPtr;
+std::map<std::string, TransformationFactory *> *
+TransformationManager::FactoriesMapPtr;
 
 TransformationManager *TransformationManager::GetInstance()
 {
@@ -51,11 +268,28 @@ TransformationManager *TransformationManager::GetInstance()
   TransformationManager::Instance = new TransformationManager();
   assert(TransformationManager::Instance);
 
-  TransformationManager::Instance->TransformationsMap = 
-    *TransformationManager::TransformationsMapPtr;
   return TransformationManager::Instance;
 }
 
+Transformation *TransformationManager::getTransformation(
+                  const std::string &Name)
+{
+  std::map<std::string, Transformation *>::iterator I =
+    TransformationsMap.find(Name);
+  if (I != TransformationsMap.end())
+    return (*I).second;
+
+  std::map<std::string, TransformationFactory *>::iterator FI =
+    FactoriesMapPtr->find(Name);
+  if (FI == FactoriesMapPtr->end())
+    return NULL;
+
+  Transformation *TransImpl = (*FI).second->create();
+  assert(TransImpl && "Fail to create TransformationClass");
+  TransformationsMap[Name] = TransImpl;
+  return TransImpl;
+}
+
 Preprocessor &TransformationManager::getPreprocessor()
 {
   return GetInstance()->ClangInstance->getPreprocessor();
@@ -88,6 +322,32 @@ bool TransformationManager::isOpenCLLangOpt()
           .OpenCL);
 }
 
+bool TransformationManager::readStdinInput(std::string &ErrorMsg)
+{
+  if (ForkServer || Daemon || hasCounterList()) {
+    ErrorMsg = "Reading the source from stdin cannot be combined with "
+               "modes that read requests from stdin!";
+    return false;
+  }
+
+  char Buf[65536];
+  size_t NumRead;
+  while ((NumRead = fread(Buf, 1, sizeof(Buf), stdin)) > 0)
+    StdinSource.append(Buf, NumRead);
+  if (ferror(stdin)) {
+    ErrorMsg = "Cannot read source from stdin!";
+    return false;
+  }
+
+  ReadFromStdin = true;
+  if (StdinName.empty())
+    StdinName = "stdin.c";
+  // Every consumer of SrcFileName from here on sees the virtual name;
+  // the content itself is served from StdinSource.
+  SrcFileName = StdinName;
+  return true;
+}
+
 bool TransformationManager::initializeCompilerInstance(std::string &ErrorMsg)
 {
   if (ClangInstance) {
@@ -95,14 +355,21 @@ bool TransformationManager::initializeCompilerInstance(std::string &ErrorMsg)
     return false;
   }
 
+  TimeReportClock::time_point InitStart = TimeReportClock::now();
+
   ClangInstance = new CompilerInstance();
   assert(ClangInstance);
   
+  // Intermediate programs are routinely invalid and nobody reads the
+  // formatted diagnostics, so install a counting-only consumer instead
+  // of the default printer: errors are still tallied (which the
+  // --max-parse-errors limit and ExpressionDetector rely on) but never
+  // rendered.
   ClangInstance->createDiagnostics(
 #if LLVM_VERSION_MAJOR >= 20
-    *llvm::vfs::getRealFileSystem()
+    *llvm::vfs::getRealFileSystem(),
 #endif
-  );
+    new IgnoringDiagConsumer());
 
   TargetOptions &TargetOpts = ClangInstance->getTargetOpts();
   if (const char *env = getenv("CVISE_TARGET_TRIPLE")) {
@@ -115,6 +382,10 @@ bool TransformationManager::initializeCompilerInstance(std::string &ErrorMsg)
   InputKind IK = FrontendOptions::getInputKindForExtension(
         StringRef(SrcFileName).rsplit('.').second);
   LangStandard::Kind LSTD = LangStandard::lang_unspecified;
+  // An explicit --std always wins; otherwise a hint recorded by an
+  // earlier successful parse of this source stands in for it.
+  if (!SetCXXStandard && !StdHintFile.empty())
+    applyStdHint();
   if (SetCXXStandard) {
     if (!CXXStandard.compare("c++98"))
       LSTD = LangStandard::Kind::lang_cxx98;
@@ -184,7 +455,15 @@ bool TransformationManager::initializeCompilerInstance(std::string &ErrorMsg)
     return false;
   }
 
-  TargetInfo *Target = 
+  // The selected transformation rarely cares about deep instantiations,
+  // but a template-bomb candidate can keep Sema busy for minutes; the
+  // caller may bound the work.
+  if (TemplateDepth > 0)
+    ClangInstance->getLangOpts().InstantiationDepth = TemplateDepth;
+  if (ConstexprSteps > 0)
+    ClangInstance->getLangOpts().ConstexprStepLimit = ConstexprSteps;
+
+  TargetInfo *Target =
     TargetInfo::CreateTargetInfo(ClangInstance->getDiagnostics(),
                                  ClangInstance->getInvocation().TargetOpts);
   ClangInstance->setTarget(Target);
@@ -204,6 +483,8 @@ bool TransformationManager::initializeCompilerInstance(std::string &ErrorMsg)
     } while(next != npos);
   }
 
+  tryUsePreamblePCH();
+
   ClangInstance->createFileManager();
   ClangInstance->createSourceManager(ClangInstance->getFileManager());
   ClangInstance->createPreprocessor(TU_Complete);
@@ -213,6 +494,15 @@ bool TransformationManager::initializeCompilerInstance(std::string &ErrorMsg)
                            &ClangInstance->getPreprocessor());
   ClangInstance->createASTContext();
 
+  if (!PreamblePCHFile.empty()) {
+    // Attach the cached preamble PCH so the parse only pays for the tail
+    // following the preamble.
+    ClangInstance->createPCHExternalASTSource(
+      PreamblePCHFile, DisableValidationForModuleKind::All,
+      /*AllowPCHWithCompilerErrors=*/true, /*DeserializationListener=*/NULL,
+      /*OwnDeserializationListener=*/false);
+  }
+
   // It's not elegant to initialize these two here... Ideally, we 
   // would put them in doTransformation, but we need these two
   // flags being set before Transformation::Initialize, which
@@ -223,35 +513,197 @@ bool TransformationManager::initializeCompilerInstance(std::string &ErrorMsg)
     CurrentTransformationImpl->setPreserveRoutine(PreserveRoutine);
   if (CheckReference)
     CurrentTransformationImpl->setReferenceValue(ReferenceValue);
+  // Armed here rather than in doTransformation so the parse-once child
+  // paths, which skip doTransformation, get the gate too.
+  if (HasMaxSizeDelta)
+    CurrentTransformationImpl->setMaxSizeDelta(MaxSizeDelta);
 
-  assert(CurrentTransformationImpl && "Bad transformation instance!");
-  ClangInstance->setASTConsumer(
-    std::unique_ptr<ASTConsumer>(CurrentTransformationImpl));
+  if (ReportAllInstances) {
+    // The census parses once and broadcasts to every registered
+    // transformation; no current transformation is selected.  This is
+    // the one mode that needs all of them constructed.
+    std::vector<ASTConsumer *> Impls;
+    for (std::map<std::string, TransformationFactory *>::iterator
+         I = FactoriesMapPtr->begin(), E = FactoriesMapPtr->end();
+         I != E; ++I)
+      Impls.push_back(getTransformation((*I).first));
+    ClangInstance->setASTConsumer(
+      std::unique_ptr<ASTConsumer>(new BroadcastConsumer(Impls)));
+  }
+  else if (usesParseOnceConsumer()) {
+    assert(CurrentTransformationImpl && "Bad transformation instance!");
+    // Keep the transformation itself out of ClangInstance's ownership:
+    // the wrapper suppresses HandleTranslationUnit during the single
+    // server-side parse, and forked children run it on demand.
+    ClangInstance->setASTConsumer(
+      std::unique_ptr<ASTConsumer>(
+        new ForwardingConsumer(CurrentTransformationImpl)));
+  }
+  else if (TimeReport) {
+    assert(CurrentTransformationImpl && "Bad transformation instance!");
+    ClangInstance->setASTConsumer(
+      std::unique_ptr<ASTConsumer>(
+        new TimingConsumer(CurrentTransformationImpl, &TimeTransform)));
+  }
+  else {
+    assert(CurrentTransformationImpl && "Bad transformation instance!");
+    ClangInstance->setASTConsumer(
+      std::unique_ptr<ASTConsumer>(CurrentTransformationImpl));
+  }
   Preprocessor &PP = ClangInstance->getPreprocessor();
   PP.getBuiltinInfo().initializeBuiltins(PP.getIdentifierTable(),
                                          PP.getLangOpts());
 
-  if (!ClangInstance->InitializeSourceManager(FrontendInputFile(SrcFileName, IK))) {
-    ErrorMsg = "Cannot open source file!";
-    return false;
+  std::map<std::string, std::string>::const_iterator VFI =
+    VirtualFiles.find(SrcFileName);
+  if (ReadFromStdin) {
+    // The bytes were slurped by readStdinInput; hand them to clang as an
+    // in-memory buffer so no temporary input file is ever created.
+    StdinBuffer = llvm::MemoryBuffer::getMemBuffer(StdinSource, SrcFileName);
+    if (!ClangInstance->InitializeSourceManager(
+          FrontendInputFile(StdinBuffer->getMemBufferRef(), IK))) {
+      ErrorMsg = "Cannot initialize source from stdin!";
+      return false;
+    }
+  }
+  else if (VFI != VirtualFiles.end()) {
+    // A daemon-mode virtual source: the driver sent the bytes over the
+    // protocol pipe, so parse them the same way as the stdin source.
+    VirtualFileBuffer =
+      llvm::MemoryBuffer::getMemBuffer((*VFI).second, SrcFileName);
+    if (!ClangInstance->InitializeSourceManager(
+          FrontendInputFile(VirtualFileBuffer->getMemBufferRef(), IK))) {
+      ErrorMsg = "Cannot initialize virtual source!";
+      return false;
+    }
+  }
+  else {
+    // With CVISE_PREFAULT_SOURCE set, pull a large on-disk source into
+    // the page cache before the file manager maps it: parsing a cold
+    // multi-hundred-MB preprocessed file otherwise faults it in 4 KB at
+    // a time throughout the lex.  readahead() is synchronous and reads
+    // ahead of the parse in one sweep; small files skip the syscall.
+#ifdef __linux__
+    if (getenv("CVISE_PREFAULT_SOURCE")) {
+      int SrcFd = open(SrcFileName.c_str(), O_RDONLY);
+      if (SrcFd >= 0) {
+        struct stat SrcSt;
+        if (!fstat(SrcFd, &SrcSt) && S_ISREG(SrcSt.st_mode) &&
+            (SrcSt.st_size >= (1 << 20)))
+          readahead(SrcFd, 0, SrcSt.st_size);
+        close(SrcFd);
+      }
+    }
+#endif
+    if (!ClangInstance->InitializeSourceManager(
+          FrontendInputFile(SrcFileName, IK))) {
+      ErrorMsg = "Cannot open source file!";
+      return false;
+    }
   }
 
+  TimeInitialize = secondsSince(InitStart);
   return true;
 }
 
+bool TransformationManager::generatePreamblePCH(llvm::StringRef PreambleText,
+                                                const std::string &PCHFile)
+{
+  CompilerInstance GenInstance;
+  GenInstance.setInvocation(
+    std::make_shared<CompilerInvocation>(ClangInstance->getInvocation()));
+  GenInstance.createDiagnostics(
+#if LLVM_VERSION_MAJOR >= 20
+    *llvm::vfs::getRealFileSystem()
+#endif
+  );
+  GenInstance.getDiagnostics().setSuppressAllDiagnostics(true);
+
+  InputKind IK = FrontendOptions::getInputKindForExtension(
+        StringRef(SrcFileName).rsplit('.').second);
+  FrontendOptions &FEOpts = GenInstance.getFrontendOpts();
+  FEOpts.Inputs.clear();
+  FEOpts.Inputs.push_back(FrontendInputFile(SrcFileName, IK));
+  FEOpts.ProgramAction = frontend::GeneratePCH;
+  FEOpts.OutputFile = PCHFile + ".tmp";
+
+  // Only the preamble bytes of the source are compiled into the PCH.
+  GenInstance.getPreprocessorOpts().addRemappedFile(
+    SrcFileName,
+    llvm::MemoryBuffer::getMemBufferCopy(PreambleText, SrcFileName).release());
+
+  GeneratePCHAction Action;
+  if (!GenInstance.ExecuteAction(Action)) {
+    llvm::sys::fs::remove(FEOpts.OutputFile);
+    return false;
+  }
+
+  // Rename atomically so concurrent clang_delta processes sharing the cache
+  // directory never observe a half-written PCH.
+  return !llvm::sys::fs::rename(FEOpts.OutputFile, PCHFile);
+}
+
+void TransformationManager::tryUsePreamblePCH()
+{
+  if (PreambleCacheDir.empty())
+    return;
+
+  std::unique_ptr<llvm::MemoryBuffer> FileBuf;
+  llvm::StringRef Buffer;
+  if (ReadFromStdin) {
+    Buffer = StdinSource;
+  }
+  else {
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> BufOrErr =
+      llvm::MemoryBuffer::getFile(SrcFileName);
+    if (!BufOrErr)
+      return;
+    FileBuf = std::move(*BufOrErr);
+    Buffer = FileBuf->getBuffer();
+  }
+
+  PreambleBounds Bounds =
+    Lexer::ComputePreamble(Buffer, ClangInstance->getLangOpts());
+  if (!Bounds.Size)
+    return;
+
+  llvm::MD5 Md5;
+  Md5.update(Buffer.substr(0, Bounds.Size));
+  llvm::MD5::MD5Result Result;
+  Md5.final(Result);
+
+  std::string PCHFile = PreambleCacheDir + "/" + llvm::toHex(Result.digest())
+                        + ".pch";
+  if (!llvm::sys::fs::exists(PCHFile) &&
+      !generatePreamblePCH(Buffer.substr(0, Bounds.Size), PCHFile))
+    return;
+
+  // Everything is best-effort up to here; only now commit to the PCH path.
+  PreprocessorOptions &PPOpts = ClangInstance->getPreprocessorOpts();
+  PPOpts.PrecompiledPreambleBytes.first = Bounds.Size;
+  PPOpts.PrecompiledPreambleBytes.second = Bounds.PreambleEndsAtStartOfLine;
+  PPOpts.DisablePCHValidation = true;
+  PreamblePCHFile = PCHFile;
+}
+
 void TransformationManager::Finalize()
 {
   assert(TransformationManager::Instance);
   
+  // Only transformations constructed this run appear in the map; the
+  // factories themselves are static objects and are not freed here.
   std::map<std::string, Transformation *>::iterator I, E;
-  for (I = Instance->TransformationsMap.begin(), 
+  for (I = Instance->TransformationsMap.begin(),
        E = Instance->TransformationsMap.end();
        I != E; ++I) {
-    // CurrentTransformationImpl will be freed by ClangInstance
-    if ((*I).second != Instance->CurrentTransformationImpl)
+    // CurrentTransformationImpl will be freed by ClangInstance, except in
+    // the parse-once and timing modes where ClangInstance only owns a
+    // forwarding wrapper
+    if (((*I).second != Instance->CurrentTransformationImpl) ||
+        Instance->usesParseOnceConsumer() || Instance->TimeReport)
       delete (*I).second;
   }
-  delete Instance->TransformationsMapPtr;
+  delete Instance->FactoriesMapPtr;
   delete Instance->ClangInstance;
   delete Instance;
   Instance = NULL;
@@ -259,6 +711,12 @@ void TransformationManager::Finalize()
 
 llvm::raw_ostream *TransformationManager::getOutStream()
 {
+  if (OutputFd >= 0) {
+    // the descriptor belongs to the driver (e.g. a memfd shared with the
+    // interestingness test); it stays open across our write
+    return new llvm::raw_fd_ostream(OutputFd, /*shouldClose=*/false);
+  }
+
   if (OutputFileName.empty())
     return &(llvm::outs());
 
@@ -269,24 +727,325 @@ llvm::raw_ostream *TransformationManager::getOutStream()
   return Out;
 }
 
+// A candidate is written once, tested once and deleted, yet its pages
+// linger in the page cache and can evict the compiler's own working set
+// when many workers emit large candidates at once.  With
+// CVISE_DROP_OUTPUT_CACHE set, the written bytes are flushed to disk and
+// dropped from the cache right after the write.  The flush matters:
+// POSIX_FADV_DONTNEED silently skips pages that are still dirty.
+static void dropOutputPages(int Fd)
+{
+  struct stat St;
+  if (fstat(Fd, &St) || !S_ISREG(St.st_mode))
+    return;
+  fdatasync(Fd);
+  posix_fadvise(Fd, 0, 0, POSIX_FADV_DONTNEED);
+}
+
 void TransformationManager::closeOutStream(llvm::raw_ostream *OutStream)
 {
-  if (!OutputFileName.empty())
+  if ((OutputFd >= 0) || !OutputFileName.empty())
     delete OutStream;
+  else
+    OutStream->flush();
+
+  if (getenv("CVISE_DROP_OUTPUT_CACHE")) {
+    if (!OutputFileName.empty()) {
+      // the stream owned the descriptor; reopen just to issue the advice
+      int Fd = open(OutputFileName.c_str(), O_RDONLY);
+      if (Fd >= 0) {
+        dropOutputPages(Fd);
+        close(Fd);
+      }
+    }
+    else if (OutputFd < 0) {
+      // the driver usually redirects stdout to the candidate file; a
+      // pipe or terminal is filtered out by the regular-file check
+      dropOutputPages(STDOUT_FILENO);
+    }
+  }
+}
+
+// The budget breach arrives in signal context, so the exit path is kept
+// to an async-signal-safe write plus _exit.
+static void memoryBudgetExceeded(int)
+{
+  const char Msg[] =
+    "Error: memory budget exceeded during transformation\n";
+  ssize_t Written = write(2, Msg, sizeof(Msg) - 1);
+  (void)Written;
+  _exit(TransformationManager::ErrorMemoryBudget);
+}
+
+static void parseDeadlineExpired(int)
+{
+  const char Msg[] =
+    "Error: parse deadline exceeded during transformation\n";
+  ssize_t Written = write(2, Msg, sizeof(Msg) - 1);
+  (void)Written;
+  _exit(TransformationManager::ErrorParseDeadline);
+}
+
+// Folded-stack capture for stuck transformations.  The cooperative
+// deadline fires inside whatever loop the pass is stuck in, so the
+// interrupted stack is exactly the evidence a human would otherwise go
+// collect with a debugger on the farm.  The handler only grabs the raw
+// frames (symbolization allocates and is not signal-safe); once the
+// traversal has unwound, dumpStuckStack folds them into one line next
+// to the perf ledger.
+static void *StuckFrames[64];
+static volatile int NumStuckFrames = 0;
+
+// backtrace lazily loads its unwinder on first use; call it once
+// before arming the deadline so that never happens inside the handler
+static void primeBacktrace(void)
+{
+  void *Scratch[1];
+  (void)backtrace(Scratch, 1);
+}
+
+// Unlike the parse deadline this one is cooperative: visitor loops poll
+// the token and abort the traversal cleanly, so a query still reports
+// its partial census and a daemon keeps its AST and caches alive.
+static void transDeadlineExpired(int)
+{
+  NumStuckFrames = backtrace(StuckFrames, 64);
+  Transformation::requestCancellation();
+}
+
+// Append the frames captured by the deadline handler as one folded
+// line -- "clang_delta;<transformation>;outermost;...;innermost 1" --
+// to "<ledger>.stacks", ready for flamegraph tooling.  The single
+// O_APPEND write keeps lines from concurrent workers whole, matching
+// the ledger's own convention.
+static void dumpStuckStack(const std::string &TransName)
+{
+  int Num = NumStuckFrames;
+  NumStuckFrames = 0;
+  if (Num <= 0)
+    return;
+  const char *Path = getenv("CVISE_PERF_LEDGER");
+  if (!Path)
+    return;
+
+  char **Symbols = backtrace_symbols(StuckFrames, Num);
+  if (!Symbols)
+    return;
+
+  std::string Line = "clang_delta;" + TransName;
+  // backtrace reports the leaf first; folded stacks want root-first
+  for (int I = Num - 1; I >= 0; I--) {
+    std::string Sym = Symbols[I];
+    // keep only the function name out of "binary(name+0xoff) [addr]"
+    std::string::size_type Open = Sym.find('(');
+    std::string::size_type Plus = Sym.find_first_of("+)", Open);
+    if ((Open != std::string::npos) && (Plus != std::string::npos) &&
+        (Plus > Open + 1))
+      Sym = Sym.substr(Open + 1, Plus - Open - 1);
+    Line += ";" + Sym;
+  }
+  free(Symbols);
+  Line += " 1\n";
+
+  std::string StacksPath = std::string(Path) + ".stacks";
+  int Fd = open(StacksPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0666);
+  if (Fd < 0)
+    return;
+  ssize_t W = write(Fd, Line.c_str(), Line.size());
+  (void)W;
+  close(Fd);
+}
+
+// Resident set size of a process in MB from /proc/<pid>/statm; 0 when
+// the file cannot be read.
+static long readResidentMB(pid_t Pid)
+{
+  char Path[64];
+  snprintf(Path, sizeof(Path), "/proc/%ld/statm", (long)Pid);
+  FILE *F = fopen(Path, "r");
+  if (!F)
+    return 0;
+  unsigned long Size = 0, Resident = 0;
+  if (fscanf(F, "%lu %lu", &Size, &Resident) != 2)
+    Resident = 0;
+  fclose(F);
+  return (long)(Resident * (sysconf(_SC_PAGESIZE) / 1024) / 1024);
+}
+
+int TransformationManager::startMemoryWatchdog()
+{
+  if (MaxMemoryMB <= 0)
+    return -1;
+
+  signal(SIGUSR1, memoryBudgetExceeded);
+  pid_t Parent = getpid();
+  pid_t Child = fork();
+  if (Child != 0)
+    return Child;
+
+  // Sample the parent's RSS; a reparented child means the parent is
+  // already gone.
+  for (;;) {
+    if (getppid() != Parent)
+      _exit(0);
+    if (readResidentMB(Parent) > MaxMemoryMB) {
+      kill(Parent, SIGUSR1);
+      _exit(0);
+    }
+    usleep(100000);
+  }
+}
+
+void TransformationManager::stopMemoryWatchdog(int Pid)
+{
+  if (Pid <= 0)
+    return;
+  kill(Pid, SIGKILL);
+  waitpid(Pid, NULL, 0);
+  signal(SIGUSR1, SIG_DFL);
+}
+
+// Append one record to the shared perf ledger named by CVISE_PERF_LEDGER.
+// The 56-byte layout is owned by "cvise_tools stats"; a single O_APPEND
+// write keeps records from concurrent workers whole.
+void TransformationManager::appendPerfLedger(const char *Path,
+                                             const std::string &Phase,
+                                             uint64_t DurationUs,
+                                             uint64_t BytesIn,
+                                             uint64_t BytesOut, uint32_t Err)
+{
+  struct {
+    char tool[8];
+    char phase[16];
+    uint64_t duration_us;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint32_t error_code;
+    uint32_t reserved;
+  } Rec;
+  memset(&Rec, 0, sizeof(Rec));
+  strncpy(Rec.tool, "clang_delta", sizeof(Rec.tool) - 1);
+  strncpy(Rec.phase, Phase.c_str(), sizeof(Rec.phase) - 1);
+  Rec.duration_us = DurationUs;
+  Rec.bytes_in = BytesIn;
+  Rec.bytes_out = BytesOut;
+  Rec.error_code = Err;
+  int Fd = open(Path, O_WRONLY | O_CREAT | O_APPEND, 0666);
+  if (Fd < 0)
+    return;
+  ssize_t W = write(Fd, &Rec, sizeof(Rec));
+  (void)W;
+  close(Fd);
 }
 
 bool TransformationManager::doTransformation(std::string &ErrorMsg, int &ErrorCode)
 {
   ErrorMsg = "";
 
+  const char *PerfLedgerPath = getenv("CVISE_PERF_LEDGER");
+  TimeReportClock::time_point LedgerStart = TimeReportClock::now();
+
+  // Answer repeat probes from the log before paying for a parse; only
+  // failed probes are replayed, a successful one still has to produce
+  // its output.
+  if (!ProbeLogFile.empty() && !QueryInstanceOnly) {
+    // TransInternalError is not replayed: that path still emits the
+    // original source and reports success to the driver.
+    int CachedStatus = 0;
+    if (lookupProbeLog(CachedStatus) && CachedStatus &&
+        (CachedStatus != TransInternalError)) {
+      ErrorMsg = "replayed from probe log: transformation error code ";
+      ErrorMsg += std::to_string(CachedStatus);
+      if ((CachedStatus == TransMaxInstanceError) ||
+          (CachedStatus == TransToCounterTooBigError))
+        ErrorCode = ErrorInvalidCounter;
+      StatusTransError = CachedStatus;
+      return false;
+    }
+  }
+
+  // A transformation whose required keywords never occur in the raw
+  // source cannot have any instances; answer without paying for a parse.
+  if (!sourceHasRequiredPatterns()) {
+    StatusValidInstances = 0;
+    if (QueryInstanceOnly) {
+      StatusTransError = TransSuccess;
+      return true;
+    }
+    ErrorMsg =
+      "The counter value exceeded the number of transformation instances!";
+    ErrorCode = ErrorInvalidCounter;
+    StatusTransError = TransMaxInstanceError;
+    return false;
+  }
+
+  // Past the short-circuits a parse is unavoidable, so set up the
+  // CompilerInstance now (unless a server mode already did): deferring
+  // it keeps the 40+ MB of Clang startup pages out of the fast exits
+  // above.
+  if (!ClangInstance && !initializeCompilerInstance(ErrorMsg))
+    return false;
+
+  // A runaway ParseAST can take the whole worker pool down via the
+  // kernel OOM killer; the watchdog ends just this process with a
+  // distinct error code instead, so the driver can retry the candidate
+  // alone.
+  int WatchdogPid = startMemoryWatchdog();
+
+  // A deadline breach exits with its own code: a SIGKILL from the driver
+  // would be indistinguishable from a crash and waste what the timeout
+  // already learned about the candidate.
+  if (ParseDeadline > 0) {
+    signal(SIGALRM, parseDeadlineExpired);
+    alarm(ParseDeadline);
+  }
+  else if (TransDeadline > 0) {
+    // HandleTranslationUnit runs inside ParseAST here, so the
+    // cooperative deadline covers the whole run; the two deadlines
+    // share SIGALRM and the hard parse deadline takes priority.
+    Transformation::clearCancellation();
+    primeBacktrace();
+    signal(SIGALRM, transDeadlineExpired);
+    alarm(TransDeadline);
+  }
+
   ClangInstance->createSema(TU_Complete, 0);
   DiagnosticsEngine &Diag = ClangInstance->getDiagnostics();
-  Diag.setSuppressAllDiagnostics(true);
+  if (MaxParseErrors > 0) {
+    // Leave the engine counting so the limit can stop a hopeless parse
+    // with a fatal error; the IgnoringDiagConsumer swallows the output.
+    Diag.setErrorLimit(MaxParseErrors);
+  }
+  else {
+    Diag.setSuppressAllDiagnostics(true);
+  }
   Diag.setIgnoreAllWarnings(true);
 
   CurrentTransformationImpl->setWarnOnCounterOutOfBounds(WarnOnCounterOutOfBounds);
   CurrentTransformationImpl->setQueryInstanceFlag(QueryInstanceOnly);
-  CurrentTransformationImpl->setTransformationCounter(TransformationCounter);
+  CurrentTransformationImpl->setDumpInstanceLocations(DumpInstanceLocations);
+  CurrentTransformationImpl->setDumpConflictComponents(DumpConflictComponents);
+  CurrentTransformationImpl->setDumpInstanceWeights(DumpInstanceWeights);
+  CurrentTransformationImpl->setDumpInstanceAddresses(DumpInstanceAddresses);
+  CurrentTransformationImpl->setScheduleCandidates(ScheduleCandidates);
+  CurrentTransformationImpl->setEmitCounterRemap(EmitCounterRemap);
+  // An accurate instance count requires a full collection sweep even if
+  // the requested counter is found early.
+  CurrentTransformationImpl->setCountFullInstances(ReportInstancesCount);
+  // Sampling only makes sense for pure queries; a rewrite needs the
+  // exact instance the counter names.
+  if (QueryInstanceOnly)
+    CurrentTransformationImpl->setInstanceBudget(InstanceBudget);
+  // The census window is query-only for the same reason: a windowed
+  // rewrite would renumber the instances out from under the driver.
+  if (QueryInstanceOnly && CensusWindowProvided)
+    CurrentTransformationImpl->setCensusWindow(CensusWindowBegin,
+                                               CensusWindowEnd);
+  if (AddressDeclIndex > 0)
+    CurrentTransformationImpl->setCounterAddress(AddressDeclIndex,
+                                                 AddressLocalOrdinal);
+  else
+    CurrentTransformationImpl->setTransformationCounter(TransformationCounter);
   CurrentTransformationImpl->setPreprocessor(&ClangInstance->getPreprocessor());
   if (ToCounter > 0) {
     if (CurrentTransformationImpl->isMultipleRewritesEnabled()) {
@@ -300,104 +1059,2258 @@ bool TransformationManager::doTransformation(std::string &ErrorMsg, int &ErrorCo
     }
   }
 
-  ParseAST(ClangInstance->getSema());
+  TimeReportClock::time_point ParseStart = TimeReportClock::now();
+  // Content seen before deserializes from the AST cache instead of
+  // parsing; a miss primes the cache entry and still loads from it, so
+  // one slot of GeneratePCH work serves every later probe of the same
+  // bytes.
+  if (!tryApplyFromASTCache()) {
+    ParseAST(ClangInstance->getSema(), /*PrintStats=*/false,
+             CurrentTransformationImpl->isSkipFunctionBodiesSafe());
+  }
+  // ParseAST invokes HandleTranslationUnit, which the TimingConsumer has
+  // already accounted for separately.
+  TimeParse = secondsSince(ParseStart) - TimeTransform;
 
   ClangInstance->getDiagnosticClient().EndSourceFile();
 
+  StatusTransError = CurrentTransformationImpl->getTransError();
+  StatusValidInstances =
+    CurrentTransformationImpl->getNumTransformationInstances();
+
+  // Parse and traversal are behind us; what follows only writes output.
+  stopMemoryWatchdog(WatchdogPid);
+  if ((ParseDeadline > 0) || (TransDeadline > 0)) {
+    alarm(0);
+    signal(SIGALRM, SIG_DFL);
+  }
+
   if (QueryInstanceOnly) {
+    if (Transformation::isCancelRequested())
+      llvm::errs() << "Warning: deadline hit during instance collection; "
+                   << "the reported instance count is partial\n";
+    if (DumpInstanceLocations)
+      CurrentTransformationImpl->outputInstanceLocations(llvm::outs());
+    if (DumpConflictComponents)
+      CurrentTransformationImpl->outputConflictComponents(llvm::outs());
+    if (DumpInstanceWeights)
+      CurrentTransformationImpl->outputInstanceWeights(llvm::outs());
+    if (DumpInstanceAddresses)
+      CurrentTransformationImpl->outputInstanceAddresses(llvm::outs());
+    if (ScheduleCandidates > 0)
+      CurrentTransformationImpl->outputScheduleCandidates(llvm::outs());
     return true;
   }
 
   llvm::raw_ostream *OutStream = getOutStream();
+  std::unique_ptr<HashingOStream> HashStream;
+  llvm::raw_ostream *EffectiveStream = OutStream;
+  // The ledger reuses the hashing wrapper for its output byte count;
+  // profiling runs can afford the extra MD5 work.
+  if (PrintOutputHash || !ProbeLogFile.empty() || PerfLedgerPath ||
+      (StatusFd >= 0)) {
+    HashStream.reset(new HashingOStream(*OutStream));
+    EffectiveStream = HashStream.get();
+  }
+  // The error limit fires as a fatal "too many errors" diagnostic, which
+  // aborts the parse; whatever the transformation did on the truncated
+  // AST is untrustworthy, so treat the candidate like an internal error
+  // and hand back the original source without paying for the full parse.
+  bool TooManyErrors =
+    (MaxParseErrors > 0) && Diag.hasFatalErrorOccurred();
+
+  if (!TooManyErrors)
+    writeStdHint();
+
+  // Compute-only probes stop short of the output: the edit summary pass
+  // reports the hunk extent and hash the write would have produced, and
+  // the verdict flows through the probe log and the status record like a
+  // real run's, but no output stream is ever opened.
+  if (ComputeOnly) {
+    TimeReportClock::time_point SummaryStart = TimeReportClock::now();
+    bool RV;
+    if (CurrentTransformationImpl->transSuccess() && !TooManyErrors) {
+      StatusOutputHash =
+        CurrentTransformationImpl->computeEditSummary(llvm::errs());
+      if (!CurrentTransformationImpl->transSuccess()) {
+        // the size-delta gate fired inside the summary pass
+        CurrentTransformationImpl->getTransErrorMsg(ErrorMsg);
+        ErrorCode = ErrorSizeLimit;
+        RV = false;
+      }
+      else {
+        RV = true;
+      }
+    }
+    else if (TooManyErrors ||
+             CurrentTransformationImpl->transInternalError()) {
+      // the real run would hand back the original source unchanged
+      llvm::errs() << "Edit extent: 0 0 0\n";
+      RV = true;
+    }
+    else {
+      CurrentTransformationImpl->getTransErrorMsg(ErrorMsg);
+      if (CurrentTransformationImpl->isInvalidCounterError())
+        ErrorCode = ErrorInvalidCounter;
+      else if (CurrentTransformationImpl->getTransError() ==
+               TransDeadlineError) {
+        ErrorCode = ErrorTransDeadline;
+        dumpStuckStack(CurrentTransName);
+      }
+      RV = false;
+    }
+    TimeOutput = secondsSince(SummaryStart);
+    StatusTransError = CurrentTransformationImpl->getTransError();
+    if (!ProbeLogFile.empty())
+      appendProbeLog(StatusTransError,
+                     (RV && !StatusOutputHash.empty()) ? StatusOutputHash
+                                                       : "-");
+    return RV;
+  }
+
+  TimeReportClock::time_point OutputStart = TimeReportClock::now();
   bool RV;
-  if (CurrentTransformationImpl->transSuccess()) {
-    CurrentTransformationImpl->outputTransformedSource(*OutStream);
-    RV = true;
+  if (CurrentTransformationImpl->transSuccess() && !TooManyErrors) {
+    if (EmitDiff)
+      CurrentTransformationImpl->outputTransformedSourceAsDiff(
+        *EffectiveStream);
+    else
+      CurrentTransformationImpl->outputTransformedSource(*EffectiveStream);
+    if (!CurrentTransformationImpl->transSuccess()) {
+      // the size-delta gate fired inside the output routine, before any
+      // byte reached the stream
+      CurrentTransformationImpl->getTransErrorMsg(ErrorMsg);
+      ErrorCode = ErrorSizeLimit;
+      RV = false;
+    }
+    else {
+      // stdout carries the transformed source; the remap table goes to
+      // stderr like the other side-channel reports.
+      if (EmitCounterRemap)
+        CurrentTransformationImpl->outputCounterRemap(llvm::errs());
+      RV = true;
+    }
   }
-  else if (CurrentTransformationImpl->transInternalError()) {
-    CurrentTransformationImpl->outputOriginalSource(*OutStream);
+  else if (TooManyErrors ||
+           CurrentTransformationImpl->transInternalError()) {
+    if (EmitDiff)
+      *EffectiveStream << "@CVISE-DIFF 0 0 0\n";
+    else
+      CurrentTransformationImpl->outputOriginalSource(*EffectiveStream);
     RV = true;
   }
   else {
     CurrentTransformationImpl->getTransErrorMsg(ErrorMsg);
     if (CurrentTransformationImpl->isInvalidCounterError())
       ErrorCode = ErrorInvalidCounter;
+    else if (CurrentTransformationImpl->getTransError() == TransDeadlineError) {
+      ErrorCode = ErrorTransDeadline;
+      dumpStuckStack(CurrentTransName);
+    }
     RV = false;
   }
+  TimeOutput = secondsSince(OutputStart);
+  StatusTransError = CurrentTransformationImpl->getTransError();
+  if (RV && HashStream)
+    StatusOutputHash = HashStream->digest();
+  if (PrintOutputHash && RV)
+    llvm::errs() << "Output hash: " << HashStream->digest() << "\n";
+  if (!ProbeLogFile.empty()) {
+    int Status = CurrentTransformationImpl->getTransError();
+    appendProbeLog(Status, (RV && HashStream) ? HashStream->digest() : "-");
+  }
+  if (PerfLedgerPath) {
+    uint64_t BytesIn = 0;
+    if (llvm::sys::fs::file_size(SrcFileName, BytesIn))
+      BytesIn = 0;
+    uint32_t Err = 0;
+    if (!RV)
+      Err = (ErrorCode == ErrorInvalidCounter) ? ErrorInvalidCounter : 2;
+    appendPerfLedger(PerfLedgerPath, CurrentTransName,
+                     (uint64_t)(secondsSince(LedgerStart) * 1e6),
+                     BytesIn, HashStream ? HashStream->bytesWritten() : 0,
+                     Err);
+    dumpVisitorStats(PerfLedgerPath);
+  }
   closeOutStream(OutStream);
   return RV;
 }
 
-bool TransformationManager::verify(std::string &ErrorMsg, int &ErrorCode)
+// Fixed 68-byte binary status record, written to --status-fd after the
+// invocation has run:
+//   bytes  0.. 7  magic "CVDSTAT1"
+//   bytes  8..11  int32  TransformationError value (-1: never ran)
+//   bytes 12..15  int32  process error code (0 on success)
+//   bytes 16..19  int32  valid instance count (-1: unknown)
+//   bytes 20..35  uint32 initialize/parse/transform/output times, in
+//                 microseconds
+//   bytes 36..67  hex MD5 of the bytes written to stdout, NUL-padded;
+//                 all NUL when nothing was written
+// Integers are host-endian: the reader is always the parent that
+// spawned the writer.  One short read tells a driver the verdict, the
+// census and whether the output is worth touching, without string-
+// matching stderr or stat'ing the output file.
+void TransformationManager::writeStatusRecord(int ExitCode)
 {
-  if (!CurrentTransformationImpl) {
-    ErrorMsg = "Empty transformation instance!";
-    return false;
+  if (StatusFd < 0)
+    return;
+
+  unsigned char Record[68];
+  memset(Record, 0, sizeof(Record));
+  memcpy(Record, "CVDSTAT1", 8);
+
+  int32_t Field = StatusTransError;
+  memcpy(Record + 8, &Field, sizeof(Field));
+  Field = ExitCode;
+  memcpy(Record + 12, &Field, sizeof(Field));
+  Field = StatusValidInstances;
+  memcpy(Record + 16, &Field, sizeof(Field));
+
+  double Times[4] = { TimeInitialize, TimeParse, TimeTransform, TimeOutput };
+  for (int I = 0; I < 4; ++I) {
+    uint32_t Us = (uint32_t)(Times[I] * 1e6);
+    memcpy(Record + 20 + 4 * I, &Us, sizeof(Us));
   }
 
-  if (CurrentTransformationImpl->skipCounter())
-    return true;
+  size_t HashLen = StatusOutputHash.size();
+  if (HashLen > 32)
+    HashLen = 32;
+  memcpy(Record + 36, StatusOutputHash.data(), HashLen);
 
-  if (TransformationCounter <= 0) {
-    ErrorMsg = "Invalid transformation counter!";
-    ErrorCode = ErrorInvalidCounter;
-    return false;
+  size_t Off = 0;
+  while (Off < sizeof(Record)) {
+    ssize_t Put = write(StatusFd, Record + Off, sizeof(Record) - Off);
+    if (Put <= 0)
+      break;     // a closed descriptor is the driver's problem
+    Off += (size_t)Put;
   }
+}
 
-  if ((ToCounter > 0) && (ToCounter < TransformationCounter)) {
-    ErrorMsg = "to-counter value cannot be smaller than counter value!";
-    ErrorCode = ErrorInvalidCounter;
+bool TransformationManager::lookupProbeLog(int &Status)
+{
+  if (ProbeInputHash.empty() &&
+      !getFileContentHash(SrcFileName, ProbeInputHash))
     return false;
-  }
 
-  return true;
+  std::ifstream Log(ProbeLogFile.c_str());
+  if (!Log.is_open())
+    return false;
+
+  // The log is append-only; scan it fully so the latest record for this
+  // probe wins.
+  bool Found = false;
+  std::string Line;
+  while (std::getline(Log, Line)) {
+    std::stringstream TmpSS(Line);
+    std::string Name, InputHash, ResultHash;
+    int Counter, RecordToCounter, RecordStatus;
+    if (!(TmpSS >> Name >> InputHash >> Counter >> RecordToCounter
+                >> RecordStatus >> ResultHash))
+      continue;
+    if ((Name == CurrentTransName) && (InputHash == ProbeInputHash) &&
+        (Counter == TransformationCounter) && (RecordToCounter == ToCounter)) {
+      Status = RecordStatus;
+      Found = true;
+    }
+  }
+  return Found;
 }
 
-void TransformationManager::registerTransformation(
-       const char *TransName, 
-       Transformation *TransImpl)
+int TransformationManager::verifyCounterAgainstProbeLog()
 {
-  if (!TransformationManager::TransformationsMapPtr) {
-    TransformationManager::TransformationsMapPtr = 
-      new std::map<std::string, Transformation *>();
+  if (ProbeLogFile.empty())
+    return 0;
+  if (ProbeInputHash.empty() &&
+      !getFileContentHash(SrcFileName, ProbeInputHash))
+    return 0;
+
+  std::ifstream Log(ProbeLogFile.c_str());
+  if (!Log.is_open())
+    return 0;
+
+  // A max-instance failure at counter C proves the input has fewer than
+  // C instances, so every counter >= C is invalid too; the exact-match
+  // replay in doTransformation only catches repeats of the same
+  // counter.  A success at counter C proves the opposite bound; when a
+  // stale log (e.g. written by a different compiler version) contains
+  // both, believe neither.
+  bool ExactMatch = false;
+  int InvalidBound = 0;
+  int MaxSuccess = 0;
+  std::string Line;
+  while (std::getline(Log, Line)) {
+    std::stringstream TmpSS(Line);
+    std::string Name, InputHash, ResultHash;
+    int Counter, RecordToCounter, RecordStatus;
+    if (!(TmpSS >> Name >> InputHash >> Counter >> RecordToCounter
+                >> RecordStatus >> ResultHash))
+      continue;
+    if ((Name != CurrentTransName) || (InputHash != ProbeInputHash))
+      continue;
+    if ((Counter == TransformationCounter) && (RecordToCounter == ToCounter))
+      ExactMatch = true;
+    if ((RecordStatus == TransMaxInstanceError) &&
+        (!InvalidBound || (Counter < InvalidBound)))
+      InvalidBound = Counter;
+    else if ((RecordStatus == TransToCounterTooBigError) &&
+             (RecordToCounter > 0) &&
+             (!InvalidBound || (RecordToCounter < InvalidBound)))
+      InvalidBound = RecordToCounter;
+    else if (RecordStatus == 0) {
+      int Reached = (RecordToCounter > 0) ? RecordToCounter : Counter;
+      if (Reached > MaxSuccess)
+        MaxSuccess = Reached;
+    }
   }
 
-  assert((TransImpl != NULL) && "NULL Transformation!");
-  assert((TransformationManager::TransformationsMapPtr->find(TransName) == 
-          TransformationManager::TransformationsMapPtr->end()) &&
-         "Duplicated transformation!");
-  (*TransformationManager::TransformationsMapPtr)[TransName] = TransImpl;
+  if (ExactMatch)
+    return 1;
+  if (InvalidBound && (MaxSuccess < InvalidBound) &&
+      ((TransformationCounter >= InvalidBound) ||
+       (ToCounter >= InvalidBound)))
+    return -1;
+  return 0;
 }
 
-void TransformationManager::printTransformations()
+void TransformationManager::appendProbeLog(int Status,
+                                           const std::string &ResultHash)
 {
-  llvm::outs() << "Registered Transformations:\n";
+  if (ProbeInputHash.empty() &&
+      !getFileContentHash(SrcFileName, ProbeInputHash))
+    return;
 
-  std::map<std::string, Transformation *>::iterator I, E;
-  for (I = TransformationsMap.begin(), 
-       E = TransformationsMap.end();
-       I != E; ++I) {
-    llvm::outs() << "  [" << (*I).first << "]: "; 
-    llvm::outs() << (*I).second->getDescription() << "\n";
-  }
+  std::ofstream Log(ProbeLogFile.c_str(), std::ios::app);
+  if (!Log.is_open())
+    return;
+  Log << CurrentTransName << " " << ProbeInputHash << " "
+      << TransformationCounter << " " << ToCounter << " "
+      << Status << " " << ResultHash << "\n";
 }
 
-void TransformationManager::printTransformationNames()
+void TransformationManager::buildProbeSuccessRanking(
+       std::vector<int> &RankedCounters)
 {
-  std::map<std::string, Transformation *>::iterator I, E;
-  for (I = TransformationsMap.begin(), 
-       E = TransformationsMap.end();
-       I != E; ++I) {
-    llvm::outs() << (*I).first << "\n";
+  RankedCounters.clear();
+  if (ProbeLogFile.empty())
+    return;
+
+  std::ifstream Log(ProbeLogFile.c_str());
+  if (!Log.is_open())
+    return;
+
+  // Success counts by instance ordinal for the current transformation,
+  // across every input state in the log.  "Success" here is the only
+  // kind the log can witness: the ordinal produced a transformed output
+  // (status 0) instead of running out of instances or erroring.  Range
+  // records are skipped; the daemon serves single counters.
+  std::map<int, std::pair<unsigned, unsigned> > Counts;
+  std::string Line;
+  while (std::getline(Log, Line)) {
+    std::stringstream TmpSS(Line);
+    std::string Name, InputHash, ResultHash;
+    int Counter, RecordToCounter, RecordStatus;
+    if (!(TmpSS >> Name >> InputHash >> Counter >> RecordToCounter
+                >> RecordStatus >> ResultHash))
+      continue;
+    if ((Name != CurrentTransName) || (RecordToCounter > 0))
+      continue;
+    std::pair<unsigned, unsigned> &C = Counts[Counter];
+    C.second++;
+    if (RecordStatus == 0)
+      C.first++;
+  }
+
+  // Sort by empirical rate, ties broken towards the smaller ordinal
+  // (the order the driver would try anyway).  Ordinals that never
+  // produced output are not worth staging at all.
+  std::vector<std::pair<double, int> > Rates;
+  for (std::map<int, std::pair<unsigned, unsigned> >::iterator
+       I = Counts.begin(), E = Counts.end(); I != E; ++I) {
+    unsigned Successes = (*I).second.first;
+    if (Successes == 0)
+      continue;
+    double Rate = (double)Successes / (*I).second.second;
+    Rates.push_back(std::make_pair(-Rate, (*I).first));
   }
+  std::sort(Rates.begin(), Rates.end());
+  for (std::vector<std::pair<double, int> >::iterator
+       I = Rates.begin(), E = Rates.end(); I != E; ++I)
+    RankedCounters.push_back((*I).second);
 }
 
-void TransformationManager::outputNumTransformationInstances()
+bool TransformationManager::sourceHasRequiredPatterns()
 {
-  int NumInstances = 
+  const PreScreenEntry *Entry = NULL;
+  for (unsigned I = 0;
+       I < sizeof(PreScreenTable) / sizeof(PreScreenTable[0]); ++I) {
+    if (CurrentTransName == PreScreenTable[I].TransName) {
+      Entry = &PreScreenTable[I];
+      break;
+    }
+  }
+  if (!Entry)
+    return true;
+
+  std::unique_ptr<llvm::MemoryBuffer> FileBuf;
+  llvm::StringRef Buffer;
+  if (ReadFromStdin) {
+    Buffer = StdinSource;
+  }
+  else {
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> BufOrErr =
+      llvm::MemoryBuffer::getFile(SrcFileName);
+    // Unreadable files keep the normal path, which reports the real error.
+    if (!BufOrErr)
+      return true;
+    FileBuf = std::move(*BufOrErr);
+    Buffer = FileBuf->getBuffer();
+  }
+  for (const char *const *P = Entry->Patterns; *P; ++P) {
+    if (Buffer.find(*P) == llvm::StringRef::npos)
+      return false;
+  }
+  return true;
+}
+
+bool TransformationManager::tryApplyFromASTCache()
+{
+  if (ASTCacheDir.empty())
+    return false;
+
+  std::string Hash;
+  if (!getFileContentHash(SrcFileName, Hash))
+    return false;
+
+  // The extension is part of the key: identical bytes parse differently
+  // as C and C++. The source copy keeps the original extension so the
+  // generated AST records a language-appropriate input.
+  std::string Ext = StringRef(SrcFileName).rsplit('.').second.str();
+  std::string SrcCopy = ASTCacheDir + "/" + Hash + "." + Ext;
+  std::string ASTFile = SrcCopy + ".ast";
+
+  if (!llvm::sys::fs::exists(ASTFile) &&
+      !generateASTCacheEntry(SrcCopy, ASTFile))
+    return false;
+
+  IntrusiveRefCntPtr<DiagnosticsEngine> Diags(
+    new DiagnosticsEngine(new DiagnosticIDs(), new DiagnosticOptions(),
+                          new IgnoringDiagConsumer()));
+  std::shared_ptr<PCHContainerOperations> PCHOps =
+    std::make_shared<PCHContainerOperations>();
+#if LLVM_VERSION_MAJOR >= 19
+  CachedASTUnit = ASTUnit::LoadFromASTFile(
+    ASTFile, PCHOps->getRawReader(), ASTUnit::LoadEverything, Diags,
+    FileSystemOptions(), ClangInstance->getHeaderSearchOpts());
+#else
+  CachedASTUnit = ASTUnit::LoadFromASTFile(
+    ASTFile, PCHOps->getRawReader(), ASTUnit::LoadEverything, Diags,
+    FileSystemOptions(),
+    std::make_shared<HeaderSearchOptions>(
+      ClangInstance->getHeaderSearchOpts()));
+#endif
+  if (!CachedASTUnit)
+    return false;
+
+  // The file's modification time doubles as the LRU clock.
+  utime(ASTFile.c_str(), NULL);
+
+  ASTContext &Ctx = CachedASTUnit->getASTContext();
+  CurrentTransformationImpl->setPreprocessor(
+    &CachedASTUnit->getPreprocessor());
+
+  // Replay the callbacks a parse would have delivered, in order:
+  // Initialize, one HandleTopLevelDecl per parsed top-level decl, then
+  // HandleTranslationUnit.
+  ASTConsumer &Consumer = *CurrentTransformationImpl;
+  Consumer.Initialize(Ctx);
+  TranslationUnitDecl *TUD = Ctx.getTranslationUnitDecl();
+  for (DeclContext::decl_iterator I = TUD->decls_begin(),
+       E = TUD->decls_end(); I != E; ++I) {
+    if ((*I)->isImplicit())
+      continue;
+    Consumer.HandleTopLevelDecl(DeclGroupRef(*I));
+  }
+  Consumer.HandleTranslationUnit(Ctx);
+  return true;
+}
+
+bool TransformationManager::generateASTCacheEntry(const std::string &SrcCopy,
+                                                  const std::string &ASTFile)
+{
+  // The AST file records and validates the path it was built from, and
+  // reduction temp dirs vanish, so it is built against a stable copy of
+  // the source living beside it in the cache.
+  if (!llvm::sys::fs::exists(SrcCopy)) {
+    std::string TmpSrc = SrcCopy + ".tmp";
+    if (ReadFromStdin) {
+      // There is no on-disk original to copy; write out the stdin bytes.
+      std::error_code EC;
+      llvm::raw_fd_ostream TmpOut(TmpSrc, EC);
+      if (EC)
+        return false;
+      TmpOut << StdinSource;
+      TmpOut.close();
+      if (TmpOut.has_error() || llvm::sys::fs::rename(TmpSrc, SrcCopy)) {
+        llvm::sys::fs::remove(TmpSrc);
+        return false;
+      }
+    }
+    else if (llvm::sys::fs::copy_file(SrcFileName, TmpSrc) ||
+             llvm::sys::fs::rename(TmpSrc, SrcCopy)) {
+      llvm::sys::fs::remove(TmpSrc);
+      return false;
+    }
+  }
+
+  CompilerInstance GenInstance;
+  GenInstance.setInvocation(
+    std::make_shared<CompilerInvocation>(ClangInstance->getInvocation()));
+  GenInstance.createDiagnostics(
+#if LLVM_VERSION_MAJOR >= 20
+    *llvm::vfs::getRealFileSystem()
+#endif
+  );
+  GenInstance.getDiagnostics().setSuppressAllDiagnostics(true);
+
+  InputKind IK = FrontendOptions::getInputKindForExtension(
+        StringRef(SrcFileName).rsplit('.').second);
+  FrontendOptions &FEOpts = GenInstance.getFrontendOpts();
+  FEOpts.Inputs.clear();
+  FEOpts.Inputs.push_back(FrontendInputFile(SrcCopy, IK));
+  FEOpts.ProgramAction = frontend::GeneratePCH;
+  FEOpts.OutputFile = ASTFile + ".tmp";
+  // Intermediate sources routinely fail to compile; a broken candidate
+  // must still cache.
+  FEOpts.AllowPCHWithCompilerErrors = true;
+
+  GeneratePCHAction Action;
+  if (!GenInstance.ExecuteAction(Action)) {
+    llvm::sys::fs::remove(FEOpts.OutputFile);
+    return false;
+  }
+
+  if (llvm::sys::fs::rename(FEOpts.OutputFile, ASTFile))
+    return false;
+
+  pruneASTCache();
+  return true;
+}
+
+void TransformationManager::pruneASTCache()
+{
+  // Bound the cache: keep the most recently used entries and drop the
+  // rest, removing each AST together with its source copy.
+  const size_t MaxEntries = 256;
+
+  std::vector<std::pair<llvm::sys::TimePoint<>, std::string> > Entries;
+  std::error_code EC;
+  for (llvm::sys::fs::directory_iterator I(ASTCacheDir, EC), E;
+       !EC && (I != E); I.increment(EC)) {
+    const std::string &Path = I->path();
+    if ((Path.size() < 4) || Path.compare(Path.size() - 4, 4, ".ast"))
+      continue;
+    llvm::sys::fs::file_status Status;
+    if (llvm::sys::fs::status(Path, Status))
+      continue;
+    Entries.push_back(std::make_pair(Status.getLastModificationTime(),
+                                     Path));
+  }
+  if (Entries.size() <= MaxEntries)
+    return;
+
+  std::sort(Entries.begin(), Entries.end());
+  for (size_t I = 0; I < Entries.size() - MaxEntries; ++I) {
+    const std::string &Path = Entries[I].second;
+    llvm::sys::fs::remove(Path);
+    llvm::sys::fs::remove(Path.substr(0, Path.size() - 4));
+  }
+}
+
+void TransformationManager::printTimeReport()
+{
+  // One machine-readable JSON object on stderr; stdout stays reserved for
+  // the transformed source.
+  llvm::errs() << "{\"init_compiler_instance\": "
+               << llvm::format("%.6f", TimeInitialize)
+               << ", \"parse_ast\": " << llvm::format("%.6f", TimeParse)
+               << ", \"handle_translation_unit\": "
+               << llvm::format("%.6f", TimeTransform)
+               << ", \"output\": " << llvm::format("%.6f", TimeOutput)
+               << "}\n";
+}
+
+int TransformationManager::applyOneCounter(int Counter, int RequestToCounter,
+                                           const std::string &OutName,
+                                           std::string &ErrorMsg)
+{
+  CurrentTransformationImpl->setTransformationCounter(Counter);
+  if (RequestToCounter > 0) {
+    if (!CurrentTransformationImpl->isMultipleRewritesEnabled()) {
+      ErrorMsg = "current transformation[";
+      ErrorMsg += CurrentTransName;
+      ErrorMsg += "] does not support multiple rewrites!";
+      return 2;
+    }
+    CurrentTransformationImpl->setToCounter(RequestToCounter);
+  }
+
+  if (TransDeadline > 0) {
+    Transformation::clearCancellation();
+    primeBacktrace();
+    signal(SIGALRM, transDeadlineExpired);
+    alarm(TransDeadline);
+  }
+
+  CurrentTransformationImpl->HandleTranslationUnit(
+    ClangInstance->getASTContext());
+
+  if (TransDeadline > 0) {
+    alarm(0);
+    signal(SIGALRM, SIG_DFL);
+  }
+
+  OutputFileName = OutName;
+  llvm::raw_ostream *OutStream = getOutStream();
+  int RV;
+  if (CurrentTransformationImpl->transSuccess()) {
+    CurrentTransformationImpl->outputTransformedSource(*OutStream);
+    if (CurrentTransformationImpl->transSuccess()) {
+      RV = 0;
+    }
+    else {
+      // the size-delta gate rejected the candidate before writing
+      CurrentTransformationImpl->getTransErrorMsg(ErrorMsg);
+      RV = ErrorSizeLimit;
+    }
+  }
+  else if (CurrentTransformationImpl->transInternalError()) {
+    CurrentTransformationImpl->outputOriginalSource(*OutStream);
+    RV = 0;
+  }
+  else {
+    CurrentTransformationImpl->getTransErrorMsg(ErrorMsg);
+    if (CurrentTransformationImpl->isInvalidCounterError())
+      RV = ErrorInvalidCounter;
+    else if (CurrentTransformationImpl->getTransError() == TransDeadlineError) {
+      RV = ErrorTransDeadline;
+      dumpStuckStack(CurrentTransName);
+    }
+    else
+      RV = 2;
+  }
+  closeOutStream(OutStream);
+  // The parse-once children leave via _exit(), so no atexit hook would
+  // run there; dump the visitor counters at the end of each counter
+  // application instead.
+  dumpVisitorStats(getenv("CVISE_PERF_LEDGER"));
+  return RV;
+}
+
+void TransformationManager::parseTranslationUnitOnce()
+{
+  ClangInstance->createSema(TU_Complete, 0);
+  DiagnosticsEngine &Diag = ClangInstance->getDiagnostics();
+  Diag.setSuppressAllDiagnostics(true);
+  Diag.setIgnoreAllWarnings(true);
+
+  if (CurrentTransformationImpl) {
+    CurrentTransformationImpl->setWarnOnCounterOutOfBounds(
+      WarnOnCounterOutOfBounds);
+    CurrentTransformationImpl->setPreprocessor(
+      &ClangInstance->getPreprocessor());
+  }
+
+  // The expensive part: parse the translation unit exactly once.  The
+  // forwarding consumer keeps the transformation(s) from running here.
+  ParseAST(ClangInstance->getSema(), /*PrintStats=*/false,
+           CurrentTransformationImpl &&
+           CurrentTransformationImpl->isSkipFunctionBodiesSafe());
+  ClangInstance->getDiagnosticClient().EndSourceFile();
+
+  writeStdHint();
+
+  // Run counter-independent analysis while we still own the single
+  // parse; the forked children reuse it via copy-on-write.  The same
+  // goes for the Rewriter's copy of the source buffer: prime it here so
+  // no child pays for it on its first edit.
+  if (CurrentTransformationImpl) {
+    CurrentTransformationImpl->prepareSharedAnalysis(
+      ClangInstance->getASTContext());
+    CurrentTransformationImpl->primeRewriteBuffer();
+  }
+}
+
+void TransformationManager::armDeclInstanceCounts()
+{
+  int PipeFDs[2];
+  if (pipe(PipeFDs))
+    return;
+
+  pid_t Child = fork();
+  if (Child < 0) {
+    close(PipeFDs[0]);
+    close(PipeFDs[1]);
+    return;
+  }
+  if (Child == 0) {
+    close(PipeFDs[0]);
+    // Count against the shared parse exactly the way a query would;
+    // recording the instance ranges pins each instance to its top-level
+    // declaration.
+    CurrentTransformationImpl->setQueryInstanceFlag(true);
+    CurrentTransformationImpl->setTransformationCounter(1);
+    CurrentTransformationImpl->setDumpInstanceLocations(true);
+    CurrentTransformationImpl->HandleTranslationUnit(
+      ClangInstance->getASTContext());
+    std::vector<int> Counts;
+    if (!CurrentTransformationImpl->getPerDeclInstanceCounts(Counts))
+      _exit(1);
+    std::string Result = std::to_string(Counts.size());
+    for (size_t I = 0; I < Counts.size(); ++I)
+      Result += " " + std::to_string(Counts[I]);
+    Result += "\n";
+    ssize_t Written = write(PipeFDs[1], Result.data(), Result.size());
+    _exit(Written == static_cast<ssize_t>(Result.size()) ? 0 : 1);
+  }
+
+  close(PipeFDs[1]);
+  std::string Result;
+  char Buf[4096];
+  ssize_t NumRead;
+  while ((NumRead = read(PipeFDs[0], Buf, sizeof(Buf))) > 0)
+    Result.append(Buf, NumRead);
+  close(PipeFDs[0]);
+
+  int WStatus = 0;
+  if (waitpid(Child, &WStatus, 0) < 0)
+    return;
+  if (!WIFEXITED(WStatus) || WEXITSTATUS(WStatus))
+    return;     // no table; batch children just traverse fully
+
+  std::stringstream CountSS(Result);
+  size_t NumDecls = 0;
+  if (!(CountSS >> NumDecls))
+    return;
+  std::vector<int> Counts(NumDecls, 0);
+  for (size_t I = 0; I < NumDecls; ++I)
+    if (!(CountSS >> Counts[I]) || (Counts[I] < 0))
+      return;
+  CurrentTransformationImpl->setDeclInstanceCounts(Counts);
+}
+
+bool TransformationManager::applyCounterInForkedChild(int Counter,
+                                                     const std::string &OutName,
+                                                     std::string &ErrorMsg)
+{
+  pid_t Child = fork();
+  if (Child < 0) {
+    ErrorMsg = "fork() failed!";
+    return false;
+  }
+  if (Child == 0) {
+    // In the child: apply the transformation to the already-parsed AST
+    // and write the result; the copy-on-write address space gives us a
+    // pristine Rewriter and transformation state for free.
+    std::string ChildErrorMsg;
+    int Status = applyOneCounter(Counter, -1, OutName, ChildErrorMsg);
+    if (Status && !ChildErrorMsg.empty())
+      std::cerr << "Error: " << ChildErrorMsg << "\n";
+    _exit(Status);
+  }
+
+  int WStatus = 0;
+  if (waitpid(Child, &WStatus, 0) < 0) {
+    ErrorMsg = "waitpid() failed!";
+    return false;
+  }
+  if (WIFEXITED(WStatus)) {
+    if (WEXITSTATUS(WStatus) == 0)
+      std::cout << "OK " << Counter << std::endl;
+    else
+      std::cout << "ERR " << Counter << " "
+                << WEXITSTATUS(WStatus) << std::endl;
+  }
+  else {
+    std::cout << "CRASH " << Counter << " "
+              << WTERMSIG(WStatus) << std::endl;
+  }
+  return true;
+}
+
+int TransformationManager::runComposePlan(
+       const std::string &SrcName, const std::string &OutName,
+       const std::vector<std::pair<std::string, int> > &Steps,
+       bool EmitIntermediates, std::string &ErrorMsg)
+{
+  // Each step runs in its own forked grandchild so it gets pristine
+  // transformation and Rewriter state, exactly like a parse-server
+  // counter; the step writes its result down a pipe and this process
+  // feeds the bytes to the next step as a virtual source.  Nothing
+  // touches the disk until the final candidate.
+  for (size_t I = 0, E = Steps.size(); I != E; ++I) {
+    int StepPipe[2];
+    if (pipe(StepPipe)) {
+      ErrorMsg = "pipe() failed in compose mode!";
+      return 2;
+    }
+
+    pid_t StepChild = fork();
+    if (StepChild < 0) {
+      ErrorMsg = "fork() failed in compose mode!";
+      return 2;
+    }
+    if (StepChild == 0) {
+      close(StepPipe[0]);
+      if (setTransformation(Steps[I].first)) {
+        std::cerr << "Error: unknown transformation["
+                  << Steps[I].first << "] in compose plan\n";
+        _exit(2);
+      }
+      setSrcFileName(SrcName);
+      setOutputFd(StepPipe[1]);
+      std::string StepErrorMsg;
+      if (!initializeCompilerInstance(StepErrorMsg)) {
+        std::cerr << "Error: " << StepErrorMsg << "\n";
+        _exit(2);
+      }
+      parseTranslationUnitOnce();
+      int Status = applyOneCounter(Steps[I].second, -1, "", StepErrorMsg);
+      if (Status && !StepErrorMsg.empty())
+        std::cerr << "Error: " << StepErrorMsg << "\n";
+      close(StepPipe[1]);
+      _exit(Status);
+    }
+
+    close(StepPipe[1]);
+    std::string StepOutput;
+    char ReadBuf[65536];
+    ssize_t NumRead;
+    while ((NumRead = read(StepPipe[0], ReadBuf, sizeof(ReadBuf))) > 0)
+      StepOutput.append(ReadBuf, NumRead);
+    close(StepPipe[0]);
+
+    int WStatus = 0;
+    if (waitpid(StepChild, &WStatus, 0) < 0) {
+      ErrorMsg = "waitpid() failed in compose mode!";
+      return 2;
+    }
+    if (!WIFEXITED(WStatus))
+      return ErrorTransformationCrash;
+    if (WEXITSTATUS(WStatus))
+      return WEXITSTATUS(WStatus);
+
+    // The next step parses this step's output; overriding the virtual
+    // file entry means the inherited copy in the next grandchild already
+    // holds the intermediate bytes, with no protocol round trip.
+    VirtualFiles[SrcName] = StepOutput;
+
+    // A compose-steps plan lands every intermediate on disk as its own
+    // candidate: the driver tests the whole alternation from one request
+    // while the steps themselves never leave memory between parses.
+    if (EmitIntermediates) {
+      std::stringstream StepNameSS;
+      StepNameSS << OutName << "." << (I + 1);
+      std::error_code StepEC;
+      llvm::raw_fd_ostream StepOut(StepNameSS.str(), StepEC,
+                                   llvm::sys::fs::FA_Read |
+                                   llvm::sys::fs::FA_Write);
+      if (StepEC) {
+        ErrorMsg = "cannot open compose step output file!";
+        return 2;
+      }
+      StepOut << StepOutput;
+    }
+  }
+
+  // Only the finished composition reaches the disk -- the
+  // interestingness test needs it there anyway.
+  std::error_code EC;
+  llvm::raw_fd_ostream Out(OutName, EC,
+                           llvm::sys::fs::FA_Read | llvm::sys::fs::FA_Write);
+  if (EC) {
+    ErrorMsg = "cannot open compose output file!";
+    return 2;
+  }
+  Out << VirtualFiles[SrcName];
+  return 0;
+}
+
+bool TransformationManager::setCounterList(const std::string &Str)
+{
+  std::stringstream TmpSS(Str);
+  std::string Item;
+  while (std::getline(TmpSS, Item, ',')) {
+    int First, Last;
+    size_t DashPos = Item.find('-');
+    std::stringstream FirstSS(Item.substr(0, DashPos));
+    if (!(FirstSS >> First) || (First <= 0))
+      return false;
+    if (DashPos == std::string::npos) {
+      Last = First;
+    }
+    else {
+      std::stringstream LastSS(Item.substr(DashPos + 1));
+      if (!(LastSS >> Last) || (Last < First))
+        return false;
+    }
+    for (int Counter = First; Counter <= Last; ++Counter)
+      CounterList.push_back(Counter);
+  }
+  return !CounterList.empty();
+}
+
+bool TransformationManager::setSessionFiles(const std::string &FilesStr)
+{
+  // --session replaces the positional source file; a file given both ways
+  // is a usage error.
+  if (!SrcFileName.empty())
+    return false;
+
+  std::stringstream TmpSS(FilesStr);
+  std::string Item;
+  while (std::getline(TmpSS, Item, ',')) {
+    if (Item.empty())
+      return false;
+    SessionFiles.push_back(Item);
+  }
+  if (SessionFiles.size() < 2) {
+    SessionFiles.clear();
+    return false;
+  }
+
+  // The first file stands in for the single source until a counter has
+  // been mapped to its owning file; verify() and the language detection
+  // in initializeCompilerInstance look at SrcFileName.
+  SrcFileName = SessionFiles[0];
+  return true;
+}
+
+bool TransformationManager::runSession(std::string &ErrorMsg, int &ErrorCode)
+{
+  ErrorMsg = "";
+
+  if (!QueryInstanceOnly && OutputFileName.empty()) {
+    ErrorMsg = "--session requires --output to name the per-file outputs!";
+    return false;
+  }
+
+  // Phase 1: census every file of the session concurrently.  Each file
+  // parses in a forked child with its own CompilerInstance (the parent
+  // never builds one), which reports its instance count back through a
+  // pipe; the address-space isolation doubles as crash containment,
+  // exactly like the instance census.  The per-file counts define the
+  // session-wide numbering: file I owns the counters following the first
+  // I-1 files' instances, in --session order.
+  size_t NumFiles = SessionFiles.size();
+  std::vector<int> Counts(NumFiles, -1);
+  std::vector<int> CountFDs(NumFiles, -1);
+  std::vector<pid_t> CensusChildren(NumFiles, -1);
+
+  for (size_t I = 0; I < NumFiles; ++I) {
+    int PipeFDs[2];
+    if (pipe(PipeFDs) < 0) {
+      ErrorMsg = "pipe() failed in session mode!";
+      return false;
+    }
+    pid_t Child = fork();
+    if (Child < 0) {
+      ErrorMsg = "fork() failed in session mode!";
+      return false;
+    }
+    if (Child == 0) {
+      close(PipeFDs[0]);
+      SrcFileName = SessionFiles[I];
+      ProbeInputHash.clear();
+      QueryInstanceOnly = true;
+      // The session counter is global; the census only counts, so every
+      // child queries from instance one regardless of the request.
+      TransformationCounter = 1;
+      ToCounter = -1;
+      std::string ChildErrorMsg;
+      int ChildErrorCode = -1;
+      if (!doTransformation(ChildErrorMsg, ChildErrorCode)) {
+        if (!ChildErrorMsg.empty())
+          std::cerr << "Error: " << ChildErrorMsg << "\n";
+        _exit(2);
+      }
+      std::string Result =
+        std::to_string(
+          CurrentTransformationImpl->getNumTransformationInstances()) + "\n";
+      ssize_t Written = write(PipeFDs[1], Result.data(), Result.size());
+      _exit(Written == static_cast<ssize_t>(Result.size()) ? 0 : 1);
+    }
+
+    close(PipeFDs[1]);
+    CountFDs[I] = PipeFDs[0];
+    CensusChildren[I] = Child;
+  }
+
+  bool CensusOK = true;
+  for (size_t I = 0; I < NumFiles; ++I) {
+    int WStatus = 0;
+    if (waitpid(CensusChildren[I], &WStatus, 0) < 0) {
+      ErrorMsg = "waitpid() failed in session mode!";
+      return false;
+    }
+    std::string Result;
+    char Buf[64];
+    ssize_t NumRead;
+    while ((NumRead = read(CountFDs[I], Buf, sizeof(Buf))) > 0)
+      Result.append(Buf, NumRead);
+    close(CountFDs[I]);
+
+    if (WIFEXITED(WStatus) && !WEXITSTATUS(WStatus)) {
+      std::stringstream CountSS(Result);
+      if (!(CountSS >> Counts[I]) || (Counts[I] < 0))
+        CensusOK = false;
+    }
+    else {
+      CensusOK = false;
+    }
+  }
+  if (!CensusOK) {
+    ErrorMsg = "session census failed; see the per-file errors above!";
+    return false;
+  }
+
+  int Total = 0;
+  for (size_t I = 0; I < NumFiles; ++I)
+    Total += Counts[I];
+  StatusValidInstances = Total;
+
+  if (QueryInstanceOnly) {
+    // One line per file next to the session-wide total, so the driver can
+    // both size its counter space and attribute counters to files without
+    // a second query.
+    for (size_t I = 0; I < NumFiles; ++I)
+      llvm::outs() << "Session file: " << (I + 1) << " " << SessionFiles[I]
+                   << " " << Counts[I] << "\n";
+    llvm::outs() << "Available transformation instances: " << Total << "\n";
+    llvm::outs().flush();
+    return true;
+  }
+
+  int FromCounter = TransformationCounter;
+  int RequestToCounter = (ToCounter > 0) ? ToCounter : FromCounter;
+  if (RequestToCounter == Transformation::ToCounterMax)
+    RequestToCounter = Total;
+  if ((FromCounter <= 0) || (FromCounter > Total) ||
+      (RequestToCounter > Total)) {
+    ErrorMsg =
+      "The counter value exceeded the number of transformation instances!";
+    ErrorCode = ErrorInvalidCounter;
+    return false;
+  }
+
+  // Phase 2: apply the session range.  The global [counter, to-counter]
+  // interval is split at file boundaries into per-file local intervals;
+  // each touched file rewrites its slice in a forked child and lands in
+  // <output>.<file-index>.  The untouched files need no output -- the
+  // driver keeps their current bytes -- so one request yields one
+  // coordinated candidate spanning however many files the range crosses
+  // (e.g. a definition in a.cc and its extern declaration in b.h).
+  const std::string OutputBase = OutputFileName;
+  std::vector<pid_t> ApplyChildren(NumFiles, -1);
+  int FirstInstance = 1;
+  for (size_t I = 0; I < NumFiles; ++I) {
+    int LastInstance = FirstInstance + Counts[I] - 1;
+    int LocalFrom = std::max(FromCounter, FirstInstance) - FirstInstance + 1;
+    int LocalTo = std::min(RequestToCounter, LastInstance) - FirstInstance + 1;
+    FirstInstance = LastInstance + 1;
+    if (LocalFrom > LocalTo)
+      continue;
+
+    pid_t Child = fork();
+    if (Child < 0) {
+      ErrorMsg = "fork() failed in session mode!";
+      return false;
+    }
+    if (Child == 0) {
+      SrcFileName = SessionFiles[I];
+      ProbeInputHash.clear();
+      TransformationCounter = LocalFrom;
+      ToCounter = (LocalTo > LocalFrom) ? LocalTo : -1;
+      OutputFileName = OutputBase + "." + std::to_string(I + 1);
+      std::string ChildErrorMsg;
+      int ChildErrorCode = -1;
+      if (!doTransformation(ChildErrorMsg, ChildErrorCode)) {
+        if (!ChildErrorMsg.empty())
+          std::cerr << "Error: " << ChildErrorMsg << "\n";
+        _exit(ChildErrorCode > 0 ? ChildErrorCode : 2);
+      }
+      _exit(0);
+    }
+    ApplyChildren[I] = Child;
+  }
+
+  bool RV = true;
+  for (size_t I = 0; I < NumFiles; ++I) {
+    if (ApplyChildren[I] < 0)
+      continue;
+    int WStatus = 0;
+    if (waitpid(ApplyChildren[I], &WStatus, 0) < 0) {
+      ErrorMsg = "waitpid() failed in session mode!";
+      return false;
+    }
+    // The manifest names every file the candidate rewrote; the driver
+    // splices the listed outputs over the listed sources and tests the
+    // whole set as one candidate.
+    if (WIFEXITED(WStatus) && !WEXITSTATUS(WStatus)) {
+      std::cout << "Session output: " << (I + 1) << " " << SessionFiles[I]
+                << " " << OutputBase << "." << (I + 1) << std::endl;
+    }
+    else {
+      std::cout << "Session error: " << (I + 1) << " " << SessionFiles[I]
+                << " " << (WIFEXITED(WStatus) ? WEXITSTATUS(WStatus)
+                                              : ErrorTransformationCrash)
+                << std::endl;
+      if (WIFEXITED(WStatus) && WEXITSTATUS(WStatus))
+        ErrorCode = WEXITSTATUS(WStatus);
+      RV = false;
+    }
+  }
+  if (!RV)
+    ErrorMsg = "session transformation failed; see the manifest above!";
+  return RV;
+}
+
+bool TransformationManager::setCounterOrder(const std::string &Str)
+{
+  if (!Str.compare("reverse")) {
+    ReverseCounterOrder = true;
+    return true;
+  }
+  if (!Str.compare(0, 7, "stride:")) {
+    int Stride;
+    std::stringstream TmpSS(Str.substr(7));
+    if (!(TmpSS >> Stride) || (Stride <= 1))
+      return false;
+    CounterOrderStride = Stride;
+    return true;
+  }
+  return false;
+}
+
+void TransformationManager::reorderCounterList()
+{
+  if (ReverseCounterOrder)
+    std::reverse(CounterList.begin(), CounterList.end());
+
+  if (CounterOrderStride <= 1)
+    return;
+
+  // Visit every Stride-th counter first, then the skipped ones, so the
+  // early variants already sample the whole counter space.
+  std::vector<int> Reordered;
+  Reordered.reserve(CounterList.size());
+  for (int Phase = 0; Phase < CounterOrderStride; ++Phase) {
+    for (size_t I = Phase; I < CounterList.size();
+         I += CounterOrderStride)
+      Reordered.push_back(CounterList[I]);
+  }
+  CounterList.swap(Reordered);
+}
+
+void TransformationManager::applyStdHint()
+{
+  std::ifstream Hint(StdHintFile.c_str());
+  if (!Hint.is_open())
+    return;
+
+  std::string StdTag, Std, LangTag, Lang;
+  if (!(Hint >> StdTag >> Std >> LangTag >> Lang) ||
+      StdTag.compare("std") || LangTag.compare("lang"))
+    return;
+  // "default" records a source that parsed without an explicit standard;
+  // there is nothing to set, but the record still tells the driver to
+  // skip its trial loop.
+  if (!Std.compare("default"))
+    return;
+
+  CXXStandard = Std;
+  SetCXXStandard = true;
+}
+
+void TransformationManager::writeStdHint()
+{
+  if (StdHintFile.empty())
+    return;
+
+  std::string Lang = "other";
+  if (isCXXLangOpt())
+    Lang = "c++";
+  else if (isCLangOpt())
+    Lang = "c";
+  else if (isOpenCLLangOpt())
+    Lang = "opencl";
+
+  std::string Record = "std ";
+  Record += SetCXXStandard ? CXXStandard : std::string("default");
+  Record += " lang ";
+  Record += Lang;
+
+  // The hint is durable: an identical record is left alone so the many
+  // probes of one reduction do not keep rewriting the same bytes.
+  std::ifstream Existing(StdHintFile.c_str());
+  if (Existing.is_open()) {
+    std::string Line;
+    if (std::getline(Existing, Line) && !Line.compare(Record))
+      return;
+  }
+
+  std::ofstream Out(StdHintFile.c_str(), std::ofstream::trunc);
+  if (Out.is_open())
+    Out << Record << "\n";
+}
+
+bool TransformationManager::runBatchCounters(std::string &ErrorMsg,
+                                             int &ErrorCode)
+{
+  ErrorMsg = "";
+
+  if (OutputFileName.empty()) {
+    ErrorMsg = "--counter-list requires --output to name the variants!";
+    return false;
+  }
+
+  parseTranslationUnitOnce();
+
+  // With a sparse list each child otherwise traverses the whole TU to
+  // find its one instance; the per-decl census lets it skip every
+  // definition whose counter interval misses the request.
+  armDeclInstanceCounts();
+
+  reorderCounterList();
+
+  // One output file per requested counter, named <output>.<counter>, with a
+  // per-counter status line on stdout.  All variants reuse the single parsed
+  // AST; the fork per counter gives every variant a fresh Rewriter.
+  const std::string OutputBase = OutputFileName;
+  for (size_t I = 0, E = CounterList.size(); I != E; ++I) {
+    std::stringstream NameSS;
+    NameSS << OutputBase << "." << CounterList[I];
+    if (!applyCounterInForkedChild(CounterList[I], NameSS.str(), ErrorMsg))
+      return false;
+  }
+
+  return true;
+}
+
+bool TransformationManager::runInstanceCensus(std::string &ErrorMsg,
+                                              int &ErrorCode)
+{
+  ErrorMsg = "";
+
+  parseTranslationUnitOnce();
+
+  // Run the counting path of every registered transformation against the
+  // single parsed AST, each in a forked child so a crashing transformation
+  // cannot take the rest of the census down.  The counting traversals are
+  // independent, so up to NumWorkers children run concurrently; each child
+  // reports through its own pipe and the parent prints one "name: count"
+  // line per transformation on stdout, in registration order.
+  Preprocessor &PP = ClangInstance->getPreprocessor();
+
+  std::vector<std::pair<std::string, Transformation *> > Transformations;
+  for (std::map<std::string, TransformationFactory *>::iterator
+       I = FactoriesMapPtr->begin(), E = FactoriesMapPtr->end();
+       I != E; ++I) {
+    Transformations.push_back(
+      std::make_pair((*I).first, getTransformation((*I).first)));
+  }
+
+  long NumWorkers = sysconf(_SC_NPROCESSORS_ONLN);
+  if (NumWorkers < 1)
+    NumWorkers = 1;
+
+  size_t NumTrans = Transformations.size();
+  std::vector<int> ResultFDs(NumTrans, -1);
+  std::vector<bool> ChildOK(NumTrans, false);
+  std::map<pid_t, size_t> RunningChildren;
+  size_t NextToSpawn = 0;
+
+  while ((NextToSpawn < NumTrans) || !RunningChildren.empty()) {
+    while ((NextToSpawn < NumTrans) &&
+           (RunningChildren.size() < static_cast<size_t>(NumWorkers))) {
+      size_t Idx = NextToSpawn++;
+      Transformation *TransImpl = Transformations[Idx].second;
+
+      int PipeFDs[2];
+      if (pipe(PipeFDs) < 0) {
+        ErrorMsg = "pipe() failed in instance census!";
+        return false;
+      }
+
+      pid_t Child = fork();
+      if (Child < 0) {
+        ErrorMsg = "fork() failed in instance census!";
+        return false;
+      }
+      if (Child == 0) {
+        close(PipeFDs[0]);
+        TransImpl->setQueryInstanceFlag(true);
+        TransImpl->setTransformationCounter(1);
+        // Also record instance ranges: their total span estimates the
+        // bytes the transformation could remove, which a scheduler can
+        // weigh against run cost instead of following a fixed pass
+        // order.
+        TransImpl->setDumpInstanceLocations(true);
+        TransImpl->setPreprocessor(&PP);
+        TransImpl->HandleTranslationUnit(ClangInstance->getASTContext());
+        std::string Result = Transformations[Idx].first + ": " +
+          std::to_string(TransImpl->getNumTransformationInstances()) + " " +
+          std::to_string(TransImpl->getRecordedRangeBytes()) + "\n";
+        ssize_t Written = write(PipeFDs[1], Result.data(), Result.size());
+        _exit(Written == static_cast<ssize_t>(Result.size()) ? 0 : 1);
+      }
+
+      close(PipeFDs[1]);
+      ResultFDs[Idx] = PipeFDs[0];
+      RunningChildren[Child] = Idx;
+    }
+
+    int WStatus = 0;
+    pid_t Child = waitpid(-1, &WStatus, 0);
+    if (Child < 0) {
+      ErrorMsg = "waitpid() failed in instance census!";
+      return false;
+    }
+    std::map<pid_t, size_t>::iterator RI = RunningChildren.find(Child);
+    if (RI == RunningChildren.end())
+      continue;
+    ChildOK[(*RI).second] = WIFEXITED(WStatus) && !WEXITSTATUS(WStatus);
+    RunningChildren.erase(RI);
+  }
+
+  for (size_t Idx = 0; Idx < NumTrans; ++Idx) {
+    std::string Result;
+    char Buf[256];
+    ssize_t NumRead;
+    while ((NumRead = read(ResultFDs[Idx], Buf, sizeof(Buf))) > 0)
+      Result.append(Buf, NumRead);
+    close(ResultFDs[Idx]);
+
+    if (ChildOK[Idx] && !Result.empty())
+      llvm::outs() << Result;
+    else
+      llvm::outs() << Transformations[Idx].first << ": ERROR\n";
+  }
+  llvm::outs().flush();
+
+  return true;
+}
+
+bool TransformationManager::runForkServer(std::string &ErrorMsg, int &ErrorCode)
+{
+  ErrorMsg = "";
+
+  parseTranslationUnitOnce();
+
+  // Tell the driver we are ready to accept requests.  The protocol is one
+  // request per line on stdin:
+  //   <counter> [<to-counter>] <output-file>
+  // and one status line per request on stdout: "OK", "ERR <code>" or
+  // "CRASH <signal>".  EOF terminates the server.
+  std::cout << "READY" << std::endl;
+
+  // Speculation state: after serving counter N, a background child
+  // already materializes counter N+1 into a staging file, since the
+  // driver's next request is almost always N+1 when N's output fails the
+  // interestingness test.  If the next request matches we only wait and
+  // rename; otherwise the speculative child is discarded.
+  pid_t SpecChild = -1;
+  int SpecCounter = -1;
+  std::string SpecOutName;
+
+  std::string Line;
+  while (std::getline(std::cin, Line)) {
+    if (Line.empty())
+      continue;
+
+    std::stringstream TmpSS(Line);
+    int Counter = 0;
+    std::string Second, Third;
+    if (!(TmpSS >> Counter) || (Counter <= 0) || !(TmpSS >> Second)) {
+      std::cout << "ERR " << ErrorInvalidCounter << std::endl;
+      continue;
+    }
+    int RequestToCounter = -1;
+    std::string OutName = Second;
+    if (TmpSS >> Third) {
+      std::stringstream ToSS(Second);
+      if (!(ToSS >> RequestToCounter) || (RequestToCounter < Counter)) {
+        std::cout << "ERR " << ErrorInvalidCounter << std::endl;
+        continue;
+      }
+      OutName = Third;
+    }
+
+    int WStatus = 0;
+    bool Served = false;
+    if (SpecChild > 0) {
+      if ((RequestToCounter < 0) && (Counter == SpecCounter)) {
+        // The prediction hit: the requested output is already being
+        // computed (or done).  Wait for it and move it into place.
+        if (waitpid(SpecChild, &WStatus, 0) < 0) {
+          ErrorMsg = "waitpid() failed in fork-server mode!";
+          return false;
+        }
+        if (WIFEXITED(WStatus) && (WEXITSTATUS(WStatus) == 0) &&
+            !llvm::sys::fs::rename(SpecOutName, OutName)) {
+          Served = true;
+        }
+        else if (!WIFEXITED(WStatus) || WEXITSTATUS(WStatus)) {
+          // The speculative child failed the same way a fresh one would;
+          // report its status instead of recomputing the failure.
+          Served = true;
+          llvm::sys::fs::remove(SpecOutName);
+        }
+      }
+      else {
+        kill(SpecChild, SIGKILL);
+        waitpid(SpecChild, NULL, 0);
+        llvm::sys::fs::remove(SpecOutName);
+      }
+      SpecChild = -1;
+    }
+
+    if (!Served) {
+      pid_t Child = fork();
+      if (Child < 0) {
+        ErrorMsg = "fork() failed in fork-server mode!";
+        return false;
+      }
+      if (Child == 0) {
+        // In the child: apply the transformation to the already-parsed AST
+        // and write the result; the copy-on-write address space gives us a
+        // pristine Rewriter and transformation state for free.
+        std::string ChildErrorMsg;
+        int Status = applyOneCounter(Counter, RequestToCounter, OutName,
+                                     ChildErrorMsg);
+        if (Status && !ChildErrorMsg.empty())
+          std::cerr << "Error: " << ChildErrorMsg << "\n";
+        _exit(Status);
+      }
+
+      if (waitpid(Child, &WStatus, 0) < 0) {
+        ErrorMsg = "waitpid() failed in fork-server mode!";
+        return false;
+      }
+    }
+
+    if (WIFEXITED(WStatus)) {
+      if (WEXITSTATUS(WStatus) == 0)
+        std::cout << "OK" << std::endl;
+      else
+        std::cout << "ERR " << WEXITSTATUS(WStatus) << std::endl;
+    }
+    else {
+      std::cout << "CRASH " << WTERMSIG(WStatus) << std::endl;
+    }
+
+    // Kick off the speculative child for the next counter after the reply
+    // is on the wire, so the driver's test run and our transformation
+    // overlap.  Range requests do not take part in the speculation.
+    if (RequestToCounter < 0) {
+      SpecCounter = Counter + 1;
+      SpecOutName = OutName + ".speculative";
+      SpecChild = fork();
+      if (SpecChild == 0) {
+        std::string ChildErrorMsg;
+        _exit(applyOneCounter(SpecCounter, -1, SpecOutName, ChildErrorMsg));
+      }
+      if (SpecChild < 0)
+        SpecChild = -1;
+    }
+  }
+
+  if (SpecChild > 0) {
+    kill(SpecChild, SIGKILL);
+    waitpid(SpecChild, NULL, 0);
+    llvm::sys::fs::remove(SpecOutName);
+  }
+
+  return true;
+}
+
+bool TransformationManager::getFileContentHash(const std::string &FileName,
+                                               std::string &Hash)
+{
+  llvm::MD5 Md5;
+  if (Instance && Instance->ReadFromStdin &&
+      (FileName == Instance->SrcFileName)) {
+    // The source only exists in memory; hash the stdin bytes.
+    Md5.update(Instance->StdinSource);
+  }
+  else if (Instance && Instance->VirtualFiles.count(FileName)) {
+    Md5.update(Instance->VirtualFiles[FileName]);
+  }
+  else {
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> BufOrErr =
+      llvm::MemoryBuffer::getFile(FileName);
+    if (!BufOrErr)
+      return false;
+    Md5.update((*BufOrErr)->getBuffer());
+  }
+  llvm::MD5::MD5Result Result;
+  Md5.final(Result);
+  Hash = llvm::toHex(Result.digest());
+  return true;
+}
+
+// Read exactly Len raw bytes following a protocol line; the payload may
+// contain newlines, so it cannot go through getline.
+static bool readExactBytes(std::istream &In, size_t Len, std::string &Data)
+{
+  Data.resize(Len);
+  if (Len && !In.read(&Data[0], (std::streamsize)Len))
+    return false;
+  return true;
+}
+
+// Always-on daemon latency tracer.  Per-request service times go into a
+// power-of-two-bucketed (HDR-style) histogram -- one increment per
+// request, cheap enough to leave enabled.  A few pathological probes per
+// thousand set the end-to-end reduction time, and they are otherwise
+// indistinguishable from the cheap ones: a request slower than
+// CVISE_SLOW_PROBE_FACTOR (default 8) times the running median is
+// therefore tagged with a "slow-probe" record in the perf ledger
+// (duration, counter in bytes_in, current median in bytes_out), and the
+// whole histogram is printed to stderr when the daemon shuts down.
+struct DaemonLatencyHistogram {
+  uint64_t Counts[64];
+  uint64_t Total;
+  uint64_t MaxUs;
+};
+
+static unsigned daemonLatencyBucket(uint64_t Us)
+{
+  unsigned B = 0;
+  while (((uint64_t)1 << B) < Us && B < 63)
+    B++;
+  return B;
+}
+
+// Upper bound of the bucket holding the requested percentile.
+static uint64_t daemonLatencyPercentile(const DaemonLatencyHistogram &H,
+                                        unsigned Pct)
+{
+  uint64_t Target = (H.Total * Pct + 99) / 100;
+  uint64_t Cum = 0;
+  for (unsigned B = 0; B < 64; B++) {
+    Cum += H.Counts[B];
+    if (Cum >= Target)
+      return (uint64_t)1 << B;
+  }
+  return H.MaxUs;
+}
+
+static void recordDaemonRequest(DaemonLatencyHistogram &H, uint64_t Us,
+                                int Counter, const std::string &TransName,
+                                const char *LedgerPath)
+{
+  static unsigned SlowFactor;
+  if (!SlowFactor) {
+    SlowFactor = 8;
+    if (const char *Env = getenv("CVISE_SLOW_PROBE_FACTOR")) {
+      int Val = atoi(Env);
+      if (Val > 1)
+        SlowFactor = (unsigned)Val;
+    }
+  }
+
+  H.Counts[daemonLatencyBucket(Us)]++;
+  H.Total++;
+  if (Us > H.MaxUs)
+    H.MaxUs = Us;
+
+  // The median needs a few samples before it means anything.
+  if (H.Total < 32)
+    return;
+  uint64_t MedianUs = daemonLatencyPercentile(H, 50);
+  if (Us <= SlowFactor * MedianUs)
+    return;
+  if (LedgerPath)
+    TransformationManager::appendPerfLedger(LedgerPath, "slow-probe", Us,
+                                            (uint64_t)Counter, MedianUs, 0);
+  fprintf(stderr, "slow probe: %s counter %d took %lluus (median %lluus)\n",
+          TransName.c_str(), Counter, (unsigned long long)Us,
+          (unsigned long long)MedianUs);
+}
+
+static void dumpDaemonLatency(const DaemonLatencyHistogram &H)
+{
+  if (!H.Total)
+    return;
+  fprintf(stderr,
+          "daemon latency: %llu requests, p50 <= %lluus, p90 <= %lluus, "
+          "p99 <= %lluus, max %lluus\n",
+          (unsigned long long)H.Total,
+          (unsigned long long)daemonLatencyPercentile(H, 50),
+          (unsigned long long)daemonLatencyPercentile(H, 90),
+          (unsigned long long)daemonLatencyPercentile(H, 99),
+          (unsigned long long)H.MaxUs);
+}
+
+bool TransformationManager::runDaemon(std::string &ErrorMsg, int &ErrorCode)
+{
+  ErrorMsg = "";
+
+  DaemonLatencyHistogram LatencyHist;
+  memset(&LatencyHist, 0, sizeof(LatencyHist));
+  const char *PerfLedgerPath = getenv("CVISE_PERF_LEDGER");
+
+  // Request protocol (one request per line on stdin):
+  //   <counter> <source-file> <output-file>
+  // with one status line per request on stdout.  The driver can also
+  // keep intermediate sources entirely in memory:
+  //   vfile <name> <length>                    (+ <length> raw bytes)
+  //   vpatch <name> <offset> <del-len> <ins-len>  (+ <ins-len> raw bytes)
+  // seed or splice a virtual file; a later request naming it parses the
+  // in-memory bytes, so successive probe/edit cycles cost no input I/O
+  // beyond the protocol pipe itself (candidate outputs still go to
+  // files -- the interestingness test needs them on disk anyway).
+  // Correlated edits that only succeed together (remove a function, its
+  // call site and its declaration) are probed with a compose plan:
+  //   compose <source-file> <output-file> <trans> <counter> [...]
+  // applies each (transformation, counter) step to the previous step's
+  // output, re-parsing intermediates from memory, and writes only the
+  // finished composition to the output file; one interestingness run
+  // then tests what would otherwise be a chain of individually failing
+  // probes.  The reply is OK/ERR/CRASH with "compose" in the counter
+  // position.  The "compose-steps" variant of the same request also
+  // writes each step's result to <output-file>.<step>: passes that
+  // converge cooperatively by alternating rewrites of the same
+  // expressions (replace-array-index-var interleaved with
+  // reduce-array-dim is the canonical pair -- their edits overlap, so
+  // the intermediates cannot compose from one parse) get one testable
+  // candidate per step out of a single request, with the intermediates
+  // never leaving memory between steps.  The daemon keeps a small
+  // pool of "parse server" children, one per source content hash: each
+  // child parses its file once and serves counters by forking
+  // grandchildren, while this pristine parent only forks a new server for
+  // content it has not seen.  Holding several servers at once lets a
+  // driver interleave probes against the current best file and in-flight
+  // speculative candidates without losing a cached AST on every switch;
+  // the least recently used server is retired when the pool is full,
+  // and with CVISE_DAEMON_MEM_BUDGET (MB) also whenever the summed RSS
+  // of the retained ASTs exceeds the budget, so the daemon's footprint
+  // stays bounded on shared workers without a restart timer.
+  // When a probe log is available, servers additionally pre-generate
+  // the historically most successful instance ordinals into staging
+  // files during the driver's test gaps; a later request for a staged
+  // counter is answered by a rename.  When the two best-ranked ordinals
+  // are both strong predictions, a gap is also used to speculatively
+  // compose them -- the second applied to the first's in-memory output,
+  // via the compose-plan machinery -- and a later request for the first
+  // ordinal then announces the finished two-step candidate in an
+  // extended reply
+  //   OK <counter> chained <next-counter> <chained-file>
+  // so a driver that tests and accepts the chained file completes two
+  // steps in one interestingness cycle.
+  // Pooled processes rather than threads: the transformations and
+  // RewriteUtils are process-wide singletons, and fork isolation plus
+  // copy-on-write sharing gives each file its own AST anyway.
+  struct ParseServer {
+    pid_t Pid;
+    FILE *In;
+    FILE *Out;
+    unsigned long LastUse;
+    // Pre-generation state: at most one staging request is in flight per
+    // server (its reply is drained before the next synchronous request),
+    // and finished candidates wait in Staged keyed by counter.
+    bool SpecPending;
+    int SpecCounter;
+    std::string SpecOutName;
+    std::map<int, std::string> Staged;
+    size_t NextRankIdx;
+    // Optimistic chaining: at most one speculative compose child per
+    // server pairs the two best-ranked ordinals; its candidate, once
+    // finished, rides along on the reply to a request for the first of
+    // them.  One attempt per server -- the content behind a server
+    // never changes, so a failed chain would fail again.
+    pid_t ChainPid;
+    int ChainFirst;
+    int ChainSecond;
+    std::string ChainOutName;
+    bool ChainReady;
+    bool ChainTried;
+  };
+  // Retiring a server hands its whole AST back to the kernel in one
+  // process exit: the per-AST memory region the pool manages is the
+  // child's address space, so eviction is wholesale by construction and
+  // no allocator fragmentation outlives the AST it came from.
+  struct ServerPool {
+    static std::map<std::string, ParseServer>::iterator
+    leastRecentlyUsed(std::map<std::string, ParseServer> &Servers)
+    {
+      std::map<std::string, ParseServer>::iterator Oldest = Servers.begin();
+      for (std::map<std::string, ParseServer>::iterator
+           I = Servers.begin(), E = Servers.end(); I != E; ++I) {
+        if ((*I).second.LastUse < (*Oldest).second.LastUse)
+          Oldest = I;
+      }
+      return Oldest;
+    }
+
+    static void retire(std::map<std::string, ParseServer> &Servers,
+                       std::map<std::string, ParseServer>::iterator Victim)
+    {
+      fclose((*Victim).second.In);
+      fclose((*Victim).second.Out);
+      waitpid((*Victim).second.Pid, NULL, 0);
+      if ((*Victim).second.SpecPending)
+        llvm::sys::fs::remove((*Victim).second.SpecOutName);
+      for (std::map<int, std::string>::iterator
+           I = (*Victim).second.Staged.begin(),
+           E = (*Victim).second.Staged.end(); I != E; ++I)
+        llvm::sys::fs::remove((*I).second);
+      if ((*Victim).second.ChainPid > 0)
+        waitpid((*Victim).second.ChainPid, NULL, 0);
+      if ((*Victim).second.ChainPid > 0 || (*Victim).second.ChainReady)
+        llvm::sys::fs::remove((*Victim).second.ChainOutName);
+      Servers.erase(Victim);
+    }
+  };
+  const size_t MaxParseServers = 8;
+  // Resident-set budget across the whole pool, in MB; long-lived
+  // resident compiler services otherwise creep to a multiple of their
+  // working set over hours, and a shared worker cannot absorb that.
+  long MemBudgetMB = 0;
+  if (const char *Env = getenv("CVISE_DAEMON_MEM_BUDGET"))
+    MemBudgetMB = atol(Env);
+  // Cap on finished staged candidates per server; beyond a few, the
+  // predictions are stale before the driver gets to them.
+  const size_t MaxStagedPerServer = 4;
+  std::map<std::string, ParseServer> Servers;
+  unsigned long UseClock = 0;
+
+  // The empirical model from the probe log: instance ordinals ranked by
+  // how often they produced output historically.  While the driver is
+  // off testing a candidate, the server for the same content
+  // pre-generates the best-ranked ordinals into staging files, hiding
+  // generation latency behind interestingness-test latency.
+  std::vector<int> RankedCounters;
+  buildProbeSuccessRanking(RankedCounters);
+
+  std::cout << "READY" << std::endl;
+
+  std::string Line;
+  while (std::getline(std::cin, Line)) {
+    if (Line.empty())
+      continue;
+
+    // Enforce the pool's memory budget before taking on more work:
+    // servers go oldest-first until the summed RSS of the retained ASTs
+    // fits again.  The most recent server is always kept -- losing the
+    // hot AST to the budget would trade RSS for a guaranteed re-parse.
+    if (MemBudgetMB > 0) {
+      while (Servers.size() > 1) {
+        long TotalMB = 0;
+        for (std::map<std::string, ParseServer>::iterator
+             I = Servers.begin(), E = Servers.end(); I != E; ++I)
+          TotalMB += readResidentMB((*I).second.Pid);
+        if (TotalMB <= MemBudgetMB)
+          break;
+        ServerPool::retire(Servers, ServerPool::leastRecentlyUsed(Servers));
+      }
+    }
+
+    if (!Line.compare(0, 6, "vfile ")) {
+      std::stringstream CmdSS(Line);
+      std::string Cmd, Name;
+      size_t Length = 0;
+      std::string Content;
+      if (!(CmdSS >> Cmd) || !(CmdSS >> Name) || !(CmdSS >> Length) ||
+          !readExactBytes(std::cin, Length, Content)) {
+        std::cout << "ERR 0 2" << std::endl;
+        continue;
+      }
+      VirtualFiles[Name] = Content;
+      std::cout << "OK 0" << std::endl;
+      continue;
+    }
+    if (!Line.compare(0, 7, "vpatch ")) {
+      std::stringstream CmdSS(Line);
+      std::string Cmd, Name;
+      size_t Offset = 0, DelLen = 0, InsLen = 0;
+      std::string Insert;
+      if (!(CmdSS >> Cmd) || !(CmdSS >> Name) || !(CmdSS >> Offset) ||
+          !(CmdSS >> DelLen) || !(CmdSS >> InsLen) ||
+          !readExactBytes(std::cin, InsLen, Insert)) {
+        std::cout << "ERR 0 2" << std::endl;
+        continue;
+      }
+      std::map<std::string, std::string>::iterator VFI =
+        VirtualFiles.find(Name);
+      if ((VFI == VirtualFiles.end()) ||
+          (Offset > (*VFI).second.size()) ||
+          (DelLen > (*VFI).second.size() - Offset)) {
+        std::cout << "ERR 0 2" << std::endl;
+        continue;
+      }
+      (*VFI).second.replace(Offset, DelLen, Insert);
+      std::cout << "OK 0" << std::endl;
+      continue;
+    }
+    if (!Line.compare(0, 8, "compose ") ||
+        !Line.compare(0, 14, "compose-steps ")) {
+      // compose-steps differs only in landing every intermediate at
+      // <output-file>.<step>, so an alternating two-pass plan yields a
+      // candidate per step from one request
+      bool EmitIntermediates = !Line.compare(0, 14, "compose-steps ");
+      const char *ReplyTag = EmitIntermediates ? "compose-steps" : "compose";
+      std::stringstream CmdSS(Line);
+      std::string Cmd, SrcName, OutName, StepTrans;
+      int StepCounter = 0;
+      std::vector<std::pair<std::string, int> > Steps;
+      bool Bad = !(CmdSS >> Cmd) || !(CmdSS >> SrcName) || !(CmdSS >> OutName);
+      while (!Bad && (CmdSS >> StepTrans)) {
+        if (!(CmdSS >> StepCounter) || (StepCounter <= 0))
+          Bad = true;
+        else
+          Steps.push_back(std::make_pair(StepTrans, StepCounter));
+      }
+      if (Bad || Steps.empty()) {
+        std::cout << "ERR " << ReplyTag << " 2" << std::endl;
+        continue;
+      }
+
+      TimeReportClock::time_point ComposeStart = TimeReportClock::now();
+
+      // The whole plan runs in a forked child: the pristine parent never
+      // parses, keeps its virtual file contents untouched by the
+      // intermediate buffers, and survives a crash in any step.
+      pid_t ComposePid = fork();
+      if (ComposePid < 0) {
+        ErrorMsg = "fork() failed in daemon mode!";
+        return false;
+      }
+      if (ComposePid == 0) {
+        for (std::map<std::string, ParseServer>::iterator
+             I = Servers.begin(), E = Servers.end(); I != E; ++I) {
+          fclose((*I).second.In);
+          fclose((*I).second.Out);
+        }
+        std::string ChildErrorMsg;
+        int Status = runComposePlan(SrcName, OutName, Steps,
+                                    EmitIntermediates, ChildErrorMsg);
+        if (Status && !ChildErrorMsg.empty())
+          std::cerr << "Error: " << ChildErrorMsg << "\n";
+        _exit(Status);
+      }
+
+      int ComposeStatus = 0;
+      if (waitpid(ComposePid, &ComposeStatus, 0) < 0) {
+        ErrorMsg = "waitpid() failed in daemon mode!";
+        return false;
+      }
+      if (!WIFEXITED(ComposeStatus))
+        std::cout << "CRASH " << ReplyTag << " "
+                  << WTERMSIG(ComposeStatus) << std::endl;
+      else if (WEXITSTATUS(ComposeStatus))
+        std::cout << "ERR " << ReplyTag << " "
+                  << WEXITSTATUS(ComposeStatus) << std::endl;
+      else
+        std::cout << "OK " << ReplyTag << std::endl;
+      recordDaemonRequest(LatencyHist,
+                          (uint64_t)(secondsSince(ComposeStart) * 1.0e6),
+                          Steps[0].second, Steps[0].first, PerfLedgerPath);
+      continue;
+    }
+
+    std::stringstream TmpSS(Line);
+    int Counter = 0;
+    std::string SrcName, OutName;
+    if (!(TmpSS >> Counter) || (Counter <= 0) ||
+        !(TmpSS >> SrcName) || !(TmpSS >> OutName)) {
+      std::cout << "ERR " << Counter << " "
+                << ErrorInvalidCounter << std::endl;
+      continue;
+    }
+
+    // Service time covers everything the driver waits for: hashing,
+    // (re)starting a parse server if needed, and the counter itself.
+    TimeReportClock::time_point RequestStart = TimeReportClock::now();
+
+    std::string Hash;
+    if (!getFileContentHash(SrcName, Hash)) {
+      std::cout << "ERR " << Counter << " 2" << std::endl;
+      continue;
+    }
+
+    std::map<std::string, ParseServer>::iterator SI = Servers.find(Hash);
+    if (SI == Servers.end()) {
+      if (Servers.size() >= MaxParseServers)
+        ServerPool::retire(Servers, ServerPool::leastRecentlyUsed(Servers));
+
+      int RequestPipe[2], ResponsePipe[2];
+      if (pipe(RequestPipe) || pipe(ResponsePipe)) {
+        ErrorMsg = "pipe() failed in daemon mode!";
+        return false;
+      }
+
+      pid_t ServerPid = fork();
+      if (ServerPid < 0) {
+        ErrorMsg = "fork() failed in daemon mode!";
+        return false;
+      }
+      if (ServerPid == 0) {
+        // Parse server child: parse this source state once, then serve
+        // counters from the request pipe until it closes.
+        dup2(RequestPipe[0], STDIN_FILENO);
+        dup2(ResponsePipe[1], STDOUT_FILENO);
+        close(RequestPipe[0]);
+        close(RequestPipe[1]);
+        close(ResponsePipe[0]);
+        close(ResponsePipe[1]);
+
+        // Drop the pipe ends inherited from the other pooled servers, so
+        // retiring one from the parent still closes its last write end.
+        for (std::map<std::string, ParseServer>::iterator
+             I = Servers.begin(), E = Servers.end(); I != E; ++I) {
+          fclose((*I).second.In);
+          fclose((*I).second.Out);
+        }
+
+        setSrcFileName(SrcName);
+        std::string ChildErrorMsg;
+        if (!initializeCompilerInstance(ChildErrorMsg)) {
+          std::cerr << "Error: " << ChildErrorMsg << "\n";
+          _exit(2);
+        }
+        parseTranslationUnitOnce();
+
+        std::string Request;
+        while (std::getline(std::cin, Request)) {
+          std::stringstream RequestSS(Request);
+          int ChildCounter;
+          std::string ChildOutName;
+          if (!(RequestSS >> ChildCounter) || !(RequestSS >> ChildOutName)) {
+            std::cout << "ERR 0 " << ErrorInvalidCounter << std::endl;
+            continue;
+          }
+          if (!applyCounterInForkedChild(ChildCounter, ChildOutName,
+                                         ChildErrorMsg))
+            _exit(2);
+        }
+        _exit(0);
+      }
+
+      close(RequestPipe[0]);
+      close(ResponsePipe[1]);
+      ParseServer NewServer;
+      NewServer.Pid = ServerPid;
+      NewServer.In = fdopen(RequestPipe[1], "w");
+      NewServer.Out = fdopen(ResponsePipe[0], "r");
+      NewServer.LastUse = 0;
+      NewServer.SpecPending = false;
+      NewServer.SpecCounter = -1;
+      NewServer.NextRankIdx = 0;
+      NewServer.ChainPid = 0;
+      NewServer.ChainFirst = -1;
+      NewServer.ChainSecond = -1;
+      NewServer.ChainReady = false;
+      NewServer.ChainTried = false;
+      assert(NewServer.In && NewServer.Out &&
+             "fdopen failed in daemon mode!");
+      SI = Servers.insert(std::make_pair(Hash, NewServer)).first;
+    }
+
+    ParseServer &Server = (*SI).second;
+    Server.LastUse = ++UseClock;
+
+    // The server answers strictly in request order, so a staging reply,
+    // if one is in flight, arrives before the answer to anything new;
+    // drain it first.
+    bool ServerDead = false;
+    if (Server.SpecPending) {
+      char SpecResponse[256];
+      if (fgets(SpecResponse, sizeof(SpecResponse), Server.Out)) {
+        int StagedCounter = 0;
+        if ((sscanf(SpecResponse, "OK %d", &StagedCounter) == 1) &&
+            (StagedCounter == Server.SpecCounter))
+          Server.Staged[Server.SpecCounter] = Server.SpecOutName;
+        else
+          llvm::sys::fs::remove(Server.SpecOutName);
+      }
+      else {
+        ServerDead = true;
+        llvm::sys::fs::remove(Server.SpecOutName);
+      }
+      Server.SpecPending = false;
+    }
+
+    // Reap a finished chain child; it runs detached from the server's
+    // request pipe, so a non-blocking wait here is the only bookkeeping
+    // it needs.  A misfired chain was free to try -- drop it quietly.
+    if (Server.ChainPid > 0) {
+      int ChainStatus = 0;
+      if (waitpid(Server.ChainPid, &ChainStatus, WNOHANG) ==
+          Server.ChainPid) {
+        Server.ChainPid = 0;
+        if (WIFEXITED(ChainStatus) && (WEXITSTATUS(ChainStatus) == 0))
+          Server.ChainReady = true;
+        else
+          llvm::sys::fs::remove(Server.ChainOutName);
+      }
+    }
+
+    // A hit in the staged set answers with a rename, no fork, no
+    // traversal; the prediction paid off.
+    bool Answered = false;
+    std::string Reply;
+    if (!ServerDead) {
+      std::map<int, std::string>::iterator StagedI =
+        Server.Staged.find(Counter);
+      if (StagedI != Server.Staged.end()) {
+        std::string StagedName = (*StagedI).second;
+        Server.Staged.erase(StagedI);
+        if (!llvm::sys::fs::rename(StagedName, OutName)) {
+          Reply = "OK " + std::to_string(Counter);
+          Answered = true;
+        }
+        else {
+          // fall back to a fresh request if the rename failed
+          llvm::sys::fs::remove(StagedName);
+        }
+      }
+    }
+
+    char Response[256];
+    if (!ServerDead && !Answered) {
+      fprintf(Server.In, "%d %s\n", Counter, OutName.c_str());
+      fflush(Server.In);
+      if (!fgets(Response, sizeof(Response), Server.Out))
+        ServerDead = true;
+    }
+
+    if (ServerDead) {
+      // The parse server died; drop it from the pool so the next
+      // request for this content restarts it.  Counters run in forked
+      // grandchildren, so getting here means the crash happened outside
+      // any counter (typically during the parse itself) -- report it
+      // with the distinct crash code rather than a generic failure.
+      fclose(Server.In);
+      fclose(Server.Out);
+      int ServerStatus = 0;
+      waitpid(Server.Pid, &ServerStatus, 0);
+      for (std::map<int, std::string>::iterator
+           I = Server.Staged.begin(), E = Server.Staged.end(); I != E; ++I)
+        llvm::sys::fs::remove((*I).second);
+      if (Server.ChainPid > 0)
+        waitpid(Server.ChainPid, NULL, 0);
+      if (Server.ChainPid > 0 || Server.ChainReady)
+        llvm::sys::fs::remove(Server.ChainOutName);
+      Servers.erase(SI);
+      std::cout << "ERR " << Counter << " "
+                << (WIFSIGNALED(ServerStatus) ? ErrorTransformationCrash : 2)
+                << std::endl;
+      recordDaemonRequest(LatencyHist,
+                          (uint64_t)(secondsSince(RequestStart) * 1.0e6),
+                          Counter, CurrentTransName, PerfLedgerPath);
+      continue;
+    }
+    if (!Answered) {
+      Reply = Response;
+      while (!Reply.empty() && (Reply[Reply.size() - 1] == '\n'))
+        Reply.erase(Reply.size() - 1);
+    }
+    // A finished chained candidate rides along on the (successful)
+    // reply to its first step; the driver gets both files and can test
+    // the two-step composition in the same cycle.
+    if (Server.ChainReady && (Counter == Server.ChainFirst) &&
+        !Reply.compare(0, 3, "OK ")) {
+      Reply += " chained " + std::to_string(Server.ChainSecond) + " " +
+               Server.ChainOutName;
+      Server.ChainReady = false;
+    }
+    std::cout << Reply << std::endl;
+    recordDaemonRequest(LatencyHist,
+                        (uint64_t)(secondsSince(RequestStart) * 1.0e6),
+                        Counter, CurrentTransName, PerfLedgerPath);
+
+    // With the reply on the wire the driver goes off to test; use the
+    // gap to pre-generate the best-ranked ordinal not staged yet.
+    if (!Server.SpecPending && (Server.Staged.size() < MaxStagedPerServer)) {
+      while (Server.NextRankIdx < RankedCounters.size()) {
+        int RankedC = RankedCounters[Server.NextRankIdx++];
+        if (Server.Staged.count(RankedC))
+          continue;
+        Server.SpecCounter = RankedC;
+        Server.SpecOutName = OutName + ".stage-" + std::to_string(RankedC);
+        Server.SpecPending = true;
+        fprintf(Server.In, "%d %s\n", Server.SpecCounter,
+                Server.SpecOutName.c_str());
+        fflush(Server.In);
+        break;
+      }
+    }
+
+    // When the model ranks two ordinals, optimistically compose them as
+    // well: a detached child chains the second onto the first's output
+    // in memory and writes only the finished two-step candidate.  It
+    // runs concurrently with the staging request above -- both hide
+    // behind the driver's interestingness run.
+    if (!Server.ChainTried && (RankedCounters.size() >= 2)) {
+      Server.ChainTried = true;
+      Server.ChainFirst = RankedCounters[0];
+      Server.ChainSecond = RankedCounters[1];
+      Server.ChainOutName = OutName + ".chain";
+      pid_t ChainPid = fork();
+      if (ChainPid < 0) {
+        ErrorMsg = "fork() failed in daemon mode!";
+        return false;
+      }
+      if (ChainPid == 0) {
+        for (std::map<std::string, ParseServer>::iterator
+             I = Servers.begin(), E = Servers.end(); I != E; ++I) {
+          fclose((*I).second.In);
+          fclose((*I).second.Out);
+        }
+        std::vector<std::pair<std::string, int> > Steps;
+        Steps.push_back(std::make_pair(CurrentTransName,
+                                       Server.ChainFirst));
+        Steps.push_back(std::make_pair(CurrentTransName,
+                                       Server.ChainSecond));
+        // A failing speculative chain is not an error anybody waits
+        // for; the exit status is all the parent looks at.
+        std::string ChildErrorMsg;
+        _exit(runComposePlan(SrcName, Server.ChainOutName, Steps,
+                             false, ChildErrorMsg));
+      }
+      Server.ChainPid = ChainPid;
+    }
+  }
+
+  for (std::map<std::string, ParseServer>::iterator I = Servers.begin(),
+       E = Servers.end(); I != E; ++I) {
+    fclose((*I).second.In);
+    fclose((*I).second.Out);
+    waitpid((*I).second.Pid, NULL, 0);
+    if ((*I).second.SpecPending)
+      llvm::sys::fs::remove((*I).second.SpecOutName);
+    for (std::map<int, std::string>::iterator
+         SI2 = (*I).second.Staged.begin(), SE = (*I).second.Staged.end();
+         SI2 != SE; ++SI2)
+      llvm::sys::fs::remove((*SI2).second);
+    if ((*I).second.ChainPid > 0)
+      waitpid((*I).second.ChainPid, NULL, 0);
+    if ((*I).second.ChainPid > 0 || (*I).second.ChainReady)
+      llvm::sys::fs::remove((*I).second.ChainOutName);
+  }
+
+  dumpDaemonLatency(LatencyHist);
+
+  return true;
+}
+
+bool TransformationManager::verify(std::string &ErrorMsg, int &ErrorCode)
+{
+  // The census needs no current transformation or counter.
+  if (ReportAllInstances)
+    return true;
+
+  if (!CurrentTransformationImpl) {
+    ErrorMsg = "Empty transformation instance!";
+    return false;
+  }
+
+  if (CurrentTransformationImpl->skipCounter())
+    return true;
+
+  // In fork-server and daemon modes counters arrive with each request;
+  // with --counter-list they come from the list.
+  if (usesParseOnceConsumer())
+    return true;
+
+  // A two-level address stands in for the counter; it resolves during
+  // collection.
+  if (AddressDeclIndex > 0)
+    return true;
+
+  if (TransformationCounter <= 0) {
+    ErrorMsg = "Invalid transformation counter!";
+    ErrorCode = ErrorInvalidCounter;
+    return false;
+  }
+
+  if ((ToCounter > 0) && (ToCounter < TransformationCounter)) {
+    ErrorMsg = "to-counter value cannot be smaller than counter value!";
+    ErrorCode = ErrorInvalidCounter;
+    return false;
+  }
+
+  // With a probe log, history stands in for re-verifying the counter
+  // against the input: an already-recorded pair skips straight to the
+  // transformation (the replay path answers it), and a counter the log
+  // proves out of range for this input is refused here, before any of
+  // the parse it would otherwise take to rediscover the instance count.
+  if (!QueryInstanceOnly) {
+    int Verdict = verifyCounterAgainstProbeLog();
+    if (Verdict > 0)
+      return true;
+    if (Verdict < 0) {
+      ErrorMsg = "probe log shows the counter value exceeds the number "
+                 "of transformation instances for this input!";
+      ErrorCode = ErrorInvalidCounter;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void TransformationManager::registerTransformation(
+       const char *TransName,
+       TransformationFactory *Factory)
+{
+  if (!TransformationManager::FactoriesMapPtr) {
+    TransformationManager::FactoriesMapPtr =
+      new std::map<std::string, TransformationFactory *>();
+  }
+
+  assert((Factory != NULL) && "NULL TransformationFactory!");
+  assert((TransformationManager::FactoriesMapPtr->find(TransName) ==
+          TransformationManager::FactoriesMapPtr->end()) &&
+         "Duplicated transformation!");
+  (*TransformationManager::FactoriesMapPtr)[TransName] = Factory;
+}
+
+void TransformationManager::printTransformations()
+{
+  llvm::outs() << "Registered Transformations:\n";
+
+  // The factories carry the descriptions, so listing never needs to
+  // construct a transformation.
+  std::map<std::string, TransformationFactory *>::iterator I, E;
+  for (I = FactoriesMapPtr->begin(),
+       E = FactoriesMapPtr->end();
+       I != E; ++I) {
+    llvm::outs() << "  [" << (*I).first << "]: ";
+    llvm::outs() << (*I).second->getDescription() << "\n";
+  }
+}
+
+void TransformationManager::printTransformationNames()
+{
+  std::map<std::string, TransformationFactory *>::iterator I, E;
+  for (I = FactoriesMapPtr->begin(),
+       E = FactoriesMapPtr->end();
+       I != E; ++I) {
+    llvm::outs() << (*I).first << "\n";
+  }
+}
+
+void TransformationManager::outputNumTransformationInstances()
+{
+  int NumInstances =
     CurrentTransformationImpl->getNumTransformationInstances();
-  llvm::outs() << "Available transformation instances: "
-               << NumInstances << "\n";
+  llvm::outs() << "Available transformation instances: " << NumInstances;
+  // A trailing "+" marks a sampled lower bound (--instance-budget).
+  if (CurrentTransformationImpl->instanceCountTruncated())
+    llvm::outs() << "+";
+  llvm::outs() << "\n";
 }
 
 void TransformationManager::outputNumTransformationInstancesToStderr()
@@ -414,19 +3327,57 @@ TransformationManager::TransformationManager()
     ToCounter(-1),
     SrcFileName(""),
     OutputFileName(""),
+    OutputFd(-1),
     CurrentTransName(""),
     ClangInstance(NULL),
     QueryInstanceOnly(false),
+    DumpInstanceLocations(false),
+    DumpConflictComponents(false),
+    DumpInstanceWeights(false),
+    DumpInstanceAddresses(false),
+    ScheduleCandidates(0),
+    AddressDeclIndex(-1),
+    AddressLocalOrdinal(-1),
+    MaxParseErrors(0),
+    MaxMemoryMB(0),
+    InstanceBudget(0),
+    CensusWindowBegin(0),
+    CensusWindowEnd(0),
+    CensusWindowProvided(false),
+    TemplateDepth(0),
+    ConstexprSteps(0),
+    ParseDeadline(0),
+    TransDeadline(0),
     DoReplacement(false),
     Replacement(""),
     DoPreserveRoutine(false),
     PreserveRoutine(""),
     CheckReference(false),
     ReferenceValue(""),
+    HasMaxSizeDelta(false),
+    MaxSizeDelta(0),
+    StatusFd(-1),
+    StatusTransError(-1),
+    StatusValidInstances(-1),
     SetCXXStandard(false),
     CXXStandard(""),
     WarnOnCounterOutOfBounds(false),
-    ReportInstancesCount(false)
+    ReportInstancesCount(false),
+    ForkServer(false),
+    Daemon(false),
+    ReportAllInstances(false),
+    EmitDiff(false),
+    ComputeOnly(false),
+    TimeReport(false),
+    PrintOutputHash(false),
+    EmitCounterRemap(false),
+    ReadFromStdin(false),
+    ReverseCounterOrder(false),
+    CounterOrderStride(0),
+    TimeInitialize(0.0),
+    TimeParse(0.0),
+    TimeTransform(0.0),
+    TimeOutput(0.0)
 {
   // Nothing to do
 }
@@ -11,17 +11,55 @@
 #ifndef TRANSFORMATION_MANAGER_H
 #define TRANSFORMATION_MANAGER_H
 
+#include <cstdint>
 #include <string>
 #include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
 #include <cassert>
 
 #include "llvm/Support/raw_ostream.h"
 
 class Transformation;
 namespace clang {
+  class ASTUnit;
   class CompilerInstance;
   class Preprocessor;
 }
+namespace llvm {
+  class MemoryBuffer;
+}
+
+// What static registration stores per transformation: the name, the
+// description and a way to construct the object later.  Registration
+// used to construct all ~60 transformations before main(); with
+// hundreds of thousands of execs per reduction that start-up work is
+// measurable, and each run only ever needs the one selected
+// transformation (the instance census being the exception, and it
+// simply constructs them all on demand).
+class TransformationFactory {
+
+public:
+  explicit TransformationFactory(const char *Desc)
+    : Description(Desc)
+  { }
+
+  virtual ~TransformationFactory() { }
+
+  virtual Transformation *create() const = 0;
+
+  const char *getDescription() const { return Description; }
+
+private:
+  const char *Description;
+
+  // Unimplemented
+  TransformationFactory(const TransformationFactory &);
+
+  void operator=(const TransformationFactory &);
+};
 
 class TransformationManager {
 
@@ -31,9 +69,9 @@ public:
 
   static void Finalize();
 
-  static void registerTransformation(const char *TransName, 
-                                     Transformation *TransImpl);
-  
+  static void registerTransformation(const char *TransName,
+                                     TransformationFactory *Factory);
+
   static bool isCXXLangOpt();
 
   static bool isCLangOpt();
@@ -42,17 +80,70 @@ public:
 
   static clang::Preprocessor &getPreprocessor();
 
+  static bool getFileContentHash(const std::string &FileName,
+                                 std::string &Hash);
+
+  // Append one 56-byte record to the shared perf ledger; also used by
+  // the visitor hot-path counters in Transformation.cpp.
+  static void appendPerfLedger(const char *Path, const std::string &Phase,
+                               uint64_t DurationUs, uint64_t BytesIn,
+                               uint64_t BytesOut, uint32_t Err);
+
   static int ErrorInvalidCounter;
 
+  // Distinct exit code for a transformation killed by the memory
+  // watchdog, so the driver can retry the candidate alone instead of
+  // losing sibling workers to the kernel OOM killer.
+  static int ErrorMemoryBudget;
+
+  // Distinct exit code for a parse that overran its deadline, so the
+  // driver can deprioritize the candidate instead of treating it like a
+  // crash.
+  static int ErrorParseDeadline;
+
+  // Distinct error code for a transformation killed by a signal inside a
+  // forked child, so a server-mode driver can skip just that counter
+  // while the parent keeps serving from the surviving AST.
+  static int ErrorTransformationCrash;
+
+  // Distinct error code for a transformation that hit its cooperative
+  // deadline, so the driver can tell "too slow" from "broken" and
+  // deprioritize the counter instead of recording a crash.
+  static int ErrorTransDeadline;
+
+  // Distinct error code for a candidate rejected by the size-delta gate
+  // (--max-size-delta), so the driver can count it as policy-skipped
+  // rather than failed and never stats or tests an output file.
+  static int ErrorSizeLimit;
+
   bool doTransformation(std::string &ErrorMsg, int &ErrorCode);
 
+  bool runForkServer(std::string &ErrorMsg, int &ErrorCode);
+
+  bool runBatchCounters(std::string &ErrorMsg, int &ErrorCode);
+
+  bool runDaemon(std::string &ErrorMsg, int &ErrorCode);
+
+  bool runInstanceCensus(std::string &ErrorMsg, int &ErrorCode);
+
+  // Multi-TU session (--session=<file1>,<file2>,...): census every file
+  // and number the instances across them; see runSession.
+  bool setSessionFiles(const std::string &FilesStr);
+
+  bool hasSession() {
+    return SessionFiles.size() > 1;
+  }
+
+  bool runSession(std::string &ErrorMsg, int &ErrorCode);
+
   bool verify(std::string &ErrorMsg, int &ErrorCode);
 
   int setTransformation(const std::string &Trans) {
-    if (TransformationsMap.find(Trans.c_str()) == TransformationsMap.end())
+    Transformation *Impl = getTransformation(Trans);
+    if (!Impl)
       return -1;
     CurrentTransName = Trans;
-    CurrentTransformationImpl = TransformationsMap[Trans.c_str()];
+    CurrentTransformationImpl = Impl;
     return 0;
   }
 
@@ -75,6 +166,21 @@ public:
     OutputFileName = FileName;
   }
 
+  void setStdinName(const std::string &Name) {
+    StdinName = Name;
+  }
+
+  // Slurp the candidate source from stdin, so the driver can pipe
+  // candidates in without materializing them on disk; the virtual file
+  // name supplies the extension used for language detection.
+  bool readStdinInput(std::string &ErrorMsg);
+
+  // write the transformed source to an already-open descriptor, e.g. a
+  // memfd created by the driver; takes precedence over --output
+  void setOutputFd(int Fd) {
+    OutputFd = Fd;
+  }
+
   void setReplacement(const std::string &Str) {
     Replacement = Str;
     DoReplacement = true;
@@ -90,6 +196,13 @@ public:
     CheckReference = true;
   }
 
+  // Guaranteed-progress mode: reject transformed outputs larger than the
+  // input plus Delta bytes with ErrorSizeLimit instead of writing them.
+  void setMaxSizeDelta(long Delta) {
+    MaxSizeDelta = Delta;
+    HasMaxSizeDelta = true;
+  }
+
   void setQueryInstanceFlag(bool Flag) {
     QueryInstanceOnly = Flag;
   }
@@ -103,10 +216,172 @@ public:
     SetCXXStandard = true;
   }
 
+  // Emit the fixed-size binary status record on the given already-open
+  // descriptor; see writeStatusRecord for the layout.
+  void setStatusFd(int Fd) {
+    StatusFd = Fd;
+  }
+
+  // Write one status record (error enum, instance count, output hash,
+  // phase timings) to --status-fd; called from main after
+  // doTransformation, on success and failure alike, so a driver can
+  // read the verdict from one descriptor instead of string-matching
+  // stderr and stat'ing the output file.
+  void writeStatusRecord(int ExitCode);
+
+  // A small file remembering which standard parsed this source cleanly;
+  // read when no --std is given and written after a successful parse, so
+  // the driver's trial loop over candidate standards runs at most once.
+  void setStdHintFile(const std::string &Name) {
+    StdHintFile = Name;
+  }
+
+  void setEmitDiffFlag(bool Flag) {
+    EmitDiff = Flag;
+  }
+
+  // Census-only probes: run the transformation fully but skip the output
+  // write; the edit extent goes to stderr and the would-be output hash
+  // lands in the probe log and the --status-fd record, so a driver can
+  // enumerate candidates (e.g. to build a conflict graph) at zero I/O
+  // cost.
+  void setComputeOnlyFlag(bool Flag) {
+    ComputeOnly = Flag;
+  }
+
+  void setTimeReportFlag(bool Flag) {
+    TimeReport = Flag;
+  }
+
+  void setPrintOutputHashFlag(bool Flag) {
+    PrintOutputHash = Flag;
+  }
+
+  bool getTimeReportFlag() {
+    return TimeReport;
+  }
+
+  void printTimeReport();
+
+  void setPreambleCacheDir(const std::string &Dir) {
+    PreambleCacheDir = Dir;
+  }
+
+  const std::string &getPreambleCacheDir() {
+    return PreambleCacheDir;
+  }
+
+  void setASTCacheDir(const std::string &Dir) {
+    ASTCacheDir = Dir;
+  }
+
+  const std::string &getSrcFileName() {
+    return SrcFileName;
+  }
+
+  void setProbeLogFile(const std::string &FileName) {
+    ProbeLogFile = FileName;
+  }
+
+  // Abort the parse once this many errors have been seen and report the
+  // candidate as an internal error; 0 keeps today's parse-to-the-end
+  // behavior, which invalid-but-reducible inputs rely on.
+  void setMaxParseErrors(int Limit) {
+    MaxParseErrors = Limit;
+  }
+
+  // Abort the transformation with exit code ErrorMemoryBudget once the
+  // process RSS exceeds this many megabytes; 0 disables the watchdog.
+  void setMaxMemoryMB(int MB) {
+    MaxMemoryMB = MB;
+  }
+
+  // Cap Sema's template instantiation depth (like -ftemplate-depth);
+  // 0 keeps clang's default.
+  void setTemplateDepth(int Depth) {
+    TemplateDepth = Depth;
+  }
+
+  // Cap constexpr evaluation steps; 0 keeps clang's default.
+  void setConstexprSteps(int Steps) {
+    ConstexprSteps = Steps;
+  }
+
+  // Abort with exit code ErrorParseDeadline when the parse has not
+  // finished after this many seconds; 0 disables the deadline.
+  void setParseDeadline(int Seconds) {
+    ParseDeadline = Seconds;
+  }
+
+  // Cooperative deadline on the transformation itself: after this many
+  // seconds the cancellation token is set and polling visitor loops
+  // abort cleanly with TransDeadlineError instead of being killed;
+  // 0 disables the deadline.
+  void setTransDeadline(int Seconds) {
+    TransDeadline = Seconds;
+  }
+
+  // Stop instance collection after this many instances during a query
+  // and report a lower bound instead of an exact count; 0 counts fully.
+  void setInstanceBudget(int Budget) {
+    InstanceBudget = Budget;
+  }
+
   void setReportInstancesCount(bool Flag) {
     ReportInstancesCount = Flag;
   }
 
+  // Differential census: only count instances in top-level declarations
+  // intersecting this byte range (normally an accepted edit's hunk).
+  void setCensusWindow(unsigned Begin, unsigned End) {
+    CensusWindowBegin = Begin;
+    CensusWindowEnd = End;
+    CensusWindowProvided = true;
+  }
+
+  // census mode extension: also dump the source ranges each instance
+  // would rewrite, so the driver can batch non-overlapping instances
+  void setDumpInstanceLocations(bool Flag) {
+    DumpInstanceLocations = Flag;
+  }
+
+  // census mode extension: print the connected components of the
+  // instance conflict graph, so the driver can bisect overlapping
+  // instances per component instead of over the global counter range
+  void setDumpConflictComponents(bool Flag) {
+    DumpConflictComponents = Flag;
+  }
+
+  // census mode extension: rank the instances by the byte size of the
+  // text their rewrites would touch, so the driver can probe high-value
+  // instances before shallow ones instead of in discovery order
+  void setDumpInstanceWeights(bool Flag) {
+    DumpInstanceWeights = Flag;
+  }
+
+  // Query-side half of two-level counter addressing: list every instance
+  // as (top-level-decl index, local ordinal) next to its global counter,
+  // so a driver can keep using addresses in declarations its edits never
+  // touched instead of re-enumerating the whole file.
+  void setDumpInstanceAddresses(bool Flag) {
+    DumpInstanceAddresses = Flag;
+  }
+
+  // Census mode extension for worker-count-aware scheduling: partition
+  // the instances into up to this many byte-disjoint contiguous counter
+  // ranges and print one candidate line per range, each applicable as-is
+  // with --counter/--to-counter; 0 disables the dump.
+  void setScheduleCandidates(int Num) {
+    ScheduleCandidates = Num;
+  }
+
+  // Apply the instance named by a two-level address instead of a global
+  // counter; a stale address fails like an out-of-range counter.
+  void setCounterAddress(int DeclIndex, int LocalOrdinal) {
+    AddressDeclIndex = DeclIndex;
+    AddressLocalOrdinal = LocalOrdinal;
+  }
+
   bool getReportInstancesCount() {
     return ReportInstancesCount;
   }
@@ -115,6 +390,42 @@ public:
     WarnOnCounterOutOfBounds = Flag;
   }
 
+  void setEmitCounterRemap(bool Flag) {
+    EmitCounterRemap = Flag;
+  }
+
+  void setForkServerFlag(bool Flag) {
+    ForkServer = Flag;
+  }
+
+  bool getForkServerFlag() {
+    return ForkServer;
+  }
+
+  void setReportAllInstancesFlag(bool Flag) {
+    ReportAllInstances = Flag;
+  }
+
+  bool getReportAllInstancesFlag() {
+    return ReportAllInstances;
+  }
+
+  void setDaemonFlag(bool Flag) {
+    Daemon = Flag;
+  }
+
+  bool getDaemonFlag() {
+    return Daemon;
+  }
+
+  bool setCounterList(const std::string &Str);
+
+  bool hasCounterList() {
+    return !CounterList.empty();
+  }
+
+  bool setCounterOrder(const std::string &Str);
+
   bool initializeCompilerInstance(std::string &ErrorMsg);
 
   void outputNumTransformationInstances();
@@ -135,10 +446,99 @@ private:
 
   void closeOutStream(llvm::raw_ostream *OutStream);
 
+  int applyOneCounter(int Counter, int RequestToCounter,
+                      const std::string &OutName, std::string &ErrorMsg);
+
+  void parseTranslationUnitOnce();
+
+  void tryUsePreamblePCH();
+
+  bool generatePreamblePCH(llvm::StringRef PreambleText,
+                           const std::string &PCHFile);
+
+  // True for the modes that parse once via a forwarding consumer and
+  // apply counters in forked children.
+  bool usesParseOnceConsumer() {
+    return ForkServer || Daemon || hasCounterList();
+  }
+
+  bool applyCounterInForkedChild(int Counter, const std::string &OutName,
+                                 std::string &ErrorMsg);
+
+  // Arm the sparse-batch subtree skip before the counter list is
+  // applied: one counting pass in a forked child distills per-top-level
+  // -decl instance counts, and every later counter child inherits the
+  // table through copy-on-write.  Failure just leaves the skip off.
+  void armDeclInstanceCounts();
+
+  void reorderCounterList();
+
+  void applyStdHint();
+
+  void writeStdHint();
+
+  // Run a daemon compose plan: apply each (transformation, counter) step
+  // to the output of the previous one, holding every intermediate result
+  // in memory, and write only the final candidate to OutName.  With
+  // EmitIntermediates every step's result is additionally written to
+  // OutName.<step>, so cooperating passes that alternate rewrites of the
+  // same expressions (replace-array-index-var with reduce-array-dim)
+  // yield a testable candidate per step from one request.  Runs in a
+  // child forked from the pristine daemon parent; returns the exit
+  // status of the first failing step, or 0.
+  int runComposePlan(const std::string &SrcName, const std::string &OutName,
+                     const std::vector<std::pair<std::string, int> > &Steps,
+                     bool EmitIntermediates, std::string &ErrorMsg);
+
+  bool lookupProbeLog(int &Status);
+
+  void appendProbeLog(int Status, const std::string &ResultHash);
+
+  // Selective re-verification against the probe log: returns 1 when the
+  // exact (transformation, input, counter) pair already has a record --
+  // it was verified moments ago and the replay path will answer it --
+  // and -1 when an earlier record proves the counter exceeds the
+  // instance count of this input, so the request can be refused without
+  // a parse.  0 means the log knows nothing about the pair.
+  int verifyCounterAgainstProbeLog();
+
+  // Rank instance ordinals of the current transformation by how often
+  // the probe log saw them produce output at all, best first.  The
+  // daemon uses the ranking to pre-generate likely candidates while the
+  // driver is busy testing.
+  void buildProbeSuccessRanking(std::vector<int> &RankedCounters);
+
+  // Lexical pre-screen: returns false when the current transformation
+  // requires keywords that never occur in the raw source bytes, proving
+  // it cannot have any instances without a parse.
+  bool sourceHasRequiredPatterns();
+
+  // Fork a child that samples this process's RSS and delivers SIGUSR1
+  // when the budget is exceeded; returns its pid, or -1 when disabled.
+  int startMemoryWatchdog();
+
+  void stopMemoryWatchdog(int Pid);
+
+  // Content-addressed AST cache: when the source bytes have been seen
+  // before, deserialize the cached AST and replay the consumer protocol
+  // on it instead of parsing. Returns true when the transformation ran.
+  bool tryApplyFromASTCache();
+
+  bool generateASTCacheEntry(const std::string &SrcCopy,
+                             const std::string &ASTFile);
+
+  void pruneASTCache();
+
+  // Returns the constructed transformation for Name, building it on
+  // first request; NULL for an unknown name.
+  Transformation *getTransformation(const std::string &Name);
+
   static TransformationManager *Instance;
 
-  static std::map<std::string, Transformation *> *TransformationsMapPtr;
+  static std::map<std::string, TransformationFactory *> *FactoriesMapPtr;
 
+  // Only the transformations actually requested this run; usually one
+  // entry, all of them during the instance census.
   std::map<std::string, Transformation *> TransformationsMap;
 
   Transformation *CurrentTransformationImpl;
@@ -149,14 +549,54 @@ private:
 
   std::string SrcFileName;
 
+  // the files of a multi-TU session, in the order their instances are
+  // numbered; a session exists when there are at least two
+  std::vector<std::string> SessionFiles;
+
   std::string OutputFileName;
 
+  int OutputFd;
+
   std::string CurrentTransName;
 
   clang::CompilerInstance *ClangInstance;
 
   bool QueryInstanceOnly;
 
+  bool DumpInstanceLocations;
+
+  bool DumpConflictComponents;
+
+  bool DumpInstanceWeights;
+
+  bool DumpInstanceAddresses;
+
+  int ScheduleCandidates;
+
+  int AddressDeclIndex;
+
+  int AddressLocalOrdinal;
+
+  int MaxParseErrors;
+
+  int MaxMemoryMB;
+
+  int InstanceBudget;
+
+  unsigned CensusWindowBegin;
+
+  unsigned CensusWindowEnd;
+
+  bool CensusWindowProvided;
+
+  int TemplateDepth;
+
+  int ConstexprSteps;
+
+  int ParseDeadline;
+
+  int TransDeadline;
+
   bool DoReplacement;
 
   std::string Replacement;
@@ -169,6 +609,20 @@ private:
 
   std::string ReferenceValue;
 
+  bool HasMaxSizeDelta;
+
+  long MaxSizeDelta;
+
+  // --status-fd state: the descriptor (-1 when unused) and the fields
+  // gathered along doTransformation for the final record
+  int StatusFd;
+
+  int StatusTransError;
+
+  int StatusValidInstances;
+
+  std::string StatusOutputHash;
+
   bool SetCXXStandard;
 
   std::string CXXStandard;
@@ -177,6 +631,72 @@ private:
 
   bool ReportInstancesCount;
 
+  bool ForkServer;
+
+  bool Daemon;
+
+  bool ReportAllInstances;
+
+  bool EmitDiff;
+
+  bool ComputeOnly;
+
+  bool TimeReport;
+
+  bool PrintOutputHash;
+
+  bool EmitCounterRemap;
+
+  double TimeInitialize;
+
+  double TimeParse;
+
+  double TimeTransform;
+
+  double TimeOutput;
+
+  std::vector<int> CounterList;
+
+  // Batch iteration order for --counter-list.  Removal passes often
+  // succeed more on high counters (later in the file), so a reverse or
+  // strided scan can find a winner, or estimate fertility, sooner.
+  bool ReverseCounterOrder;
+
+  int CounterOrderStride;
+
+  std::string PreambleCacheDir;
+
+  std::string PreamblePCHFile;
+
+  std::string ProbeLogFile;
+
+  std::string ProbeInputHash;
+
+  std::string ASTCacheDir;
+
+  std::string StdHintFile;
+
+  bool ReadFromStdin;
+
+  std::string StdinName;
+
+  // The full stdin bytes; the compiler parses them through an in-memory
+  // buffer, so no temporary input file ever exists.
+  std::string StdinSource;
+
+  std::unique_ptr<llvm::MemoryBuffer> StdinBuffer;
+
+  // Daemon-mode in-memory sources keyed by the name the driver uses in
+  // its requests; they are parsed through a memory buffer like the
+  // stdin source, so intermediate candidates never exist on disk.
+  std::map<std::string, std::string> VirtualFiles;
+
+  std::unique_ptr<llvm::MemoryBuffer> VirtualFileBuffer;
+
+  // Keeps the deserialized AST alive until the transformed source has
+  // been written out; the Rewriter references its SourceManager.
+  std::unique_ptr<clang::ASTUnit> CachedASTUnit;
+
   // Unimplemented
   TransformationManager(const TransformationManager &);
 
@@ -185,17 +705,34 @@ private:
 };
 
 template<typename TransformationClass, typename... Args>
-class RegisterTransformation {
+class RegisterTransformation : public TransformationFactory {
 
 public:
-  RegisterTransformation(const char *TransName, const char *Desc, Args... args) {
-    Transformation *TransImpl = new TransformationClass(TransName, Desc, args...);
-    assert(TransImpl && "Fail to create TransformationClass");
- 
-    TransformationManager::registerTransformation(TransName, TransImpl);
+  RegisterTransformation(const char *TransName, const char *Desc, Args... args)
+    : TransformationFactory(Desc),
+      Name(TransName),
+      StoredArgs(args...) {
+    // Static initialization only records this factory; the
+    // transformation object itself is constructed when (and if) a run
+    // selects it.
+    TransformationManager::registerTransformation(TransName, this);
+  }
+
+  virtual Transformation *create() const {
+    return createImpl(std::index_sequence_for<Args...>());
   }
 
 private:
+  template<std::size_t... I>
+  Transformation *createImpl(std::index_sequence<I...>) const {
+    return new TransformationClass(Name, getDescription(),
+                                   std::get<I>(StoredArgs)...);
+  }
+
+  const char *Name;
+
+  std::tuple<Args...> StoredArgs;
+
   // Unimplemented
   RegisterTransformation(const RegisterTransformation &);
 
@@ -0,0 +1,206 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include "TypeDependencyIndex.h"
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "llvm/ADT/SmallPtrSet.h"
+
+using namespace clang;
+
+TypeDependencyIndex *TypeDependencyIndex::Instance = NULL;
+
+// The named typedef/tag declarations a type mentions, one level of
+// structure at a time.  This is a spelling-level walk: it looks through
+// the sugar the passes rewrite (pointers, references, arrays, function
+// types, template arguments) but does not instantiate anything.
+static void collectNamedDecls(const Type *Ty,
+                              TypeDependencyIndex::DeclVector &Out)
+{
+  if (!Ty)
+    return;
+
+  if (const TypedefType *TdefTy = dyn_cast<TypedefType>(Ty)) {
+    Out.push_back(TdefTy->getDecl()->getCanonicalDecl());
+    return;
+  }
+  if (const TagType *TagTy = dyn_cast<TagType>(Ty)) {
+    Out.push_back(TagTy->getDecl()->getCanonicalDecl());
+    return;
+  }
+  if (const ElaboratedType *ETy = dyn_cast<ElaboratedType>(Ty)) {
+    collectNamedDecls(ETy->getNamedType().getTypePtr(), Out);
+    return;
+  }
+  if (const PointerType *PTy = dyn_cast<PointerType>(Ty)) {
+    collectNamedDecls(PTy->getPointeeType().getTypePtr(), Out);
+    return;
+  }
+  if (const ReferenceType *RTy = dyn_cast<ReferenceType>(Ty)) {
+    collectNamedDecls(RTy->getPointeeType().getTypePtr(), Out);
+    return;
+  }
+  if (const ArrayType *ATy = dyn_cast<ArrayType>(Ty)) {
+    collectNamedDecls(ATy->getElementType().getTypePtr(), Out);
+    return;
+  }
+  if (const FunctionProtoType *FTy = dyn_cast<FunctionProtoType>(Ty)) {
+    collectNamedDecls(FTy->getReturnType().getTypePtr(), Out);
+    for (FunctionProtoType::param_type_iterator I = FTy->param_type_begin(),
+         E = FTy->param_type_end(); I != E; ++I)
+      collectNamedDecls((*I).getTypePtr(), Out);
+    return;
+  }
+  if (const TemplateSpecializationType *TST =
+      dyn_cast<TemplateSpecializationType>(Ty)) {
+#if LLVM_VERSION_MAJOR >= 16
+    ArrayRef<TemplateArgument> Args = TST->template_arguments();
+    for (unsigned I = 0; I < Args.size(); ++I) {
+      const TemplateArgument &Arg = Args[I];
+#else
+    for (unsigned I = 0; I < TST->getNumArgs(); ++I) {
+      const TemplateArgument &Arg = TST->getArg(I);
+#endif
+      if (Arg.getKind() == TemplateArgument::Type)
+        collectNamedDecls(Arg.getAsType().getTypePtr(), Out);
+    }
+    return;
+  }
+}
+
+// The builder intentionally visits with the default RecursiveASTVisitor
+// policy (no template instantiations, no implicit code): the graph
+// describes the written source, which is what the consuming passes
+// rewrite.
+class TypeDependencyBuilder : public RecursiveASTVisitor<TypeDependencyBuilder> {
+public:
+  explicit TypeDependencyBuilder(TypeDependencyIndex *Idx)
+    : Index(Idx)
+  { }
+
+  bool VisitTypedefNameDecl(TypedefNameDecl *D) {
+    addEdges(D->getCanonicalDecl(), D->getUnderlyingType().getTypePtr());
+    return true;
+  }
+
+  bool VisitRecordDecl(RecordDecl *RD) {
+    const RecordDecl *Def = RD->getDefinition();
+    if (!Def || Def != RD)
+      return true;
+
+    const Decl *CanonicalRD = RD->getCanonicalDecl();
+    for (RecordDecl::field_iterator I = Def->field_begin(),
+         E = Def->field_end(); I != E; ++I)
+      addEdges(CanonicalRD, (*I)->getType().getTypePtr());
+
+    if (const CXXRecordDecl *CXXRD = dyn_cast<CXXRecordDecl>(Def)) {
+      for (CXXRecordDecl::base_class_const_iterator I = CXXRD->bases_begin(),
+           E = CXXRD->bases_end(); I != E; ++I)
+        addEdges(CanonicalRD, (*I).getType().getTypePtr());
+    }
+    return true;
+  }
+
+private:
+
+  void addEdges(const Decl *From, const Type *Ty) {
+    TypeDependencyIndex::DeclVector Named;
+    collectNamedDecls(Ty, Named);
+    for (unsigned I = 0; I < Named.size(); ++I) {
+      const Decl *To = Named[I];
+      if (To == From)
+        continue;       // a self-pointing field adds nothing
+      TypeDependencyIndex::DeclVector &Refs = Index->References[From];
+      bool Seen = false;
+      for (unsigned J = 0; J < Refs.size(); ++J) {
+        if (Refs[J] == To) {
+          Seen = true;
+          break;
+        }
+      }
+      if (Seen)
+        continue;
+      Refs.push_back(To);
+      Index->Dependents[To].push_back(From);
+    }
+  }
+
+  TypeDependencyIndex *Index;
+};
+
+TypeDependencyIndex *TypeDependencyIndex::GetInstance(ASTContext &Ctx)
+{
+  if (Instance && (Instance->IndexedContext == &Ctx))
+    return Instance;
+
+  if (!Instance)
+    Instance = new TypeDependencyIndex();
+  Instance->References.clear();
+  Instance->Dependents.clear();
+  Instance->build(Ctx);
+  Instance->IndexedContext = &Ctx;
+  return Instance;
+}
+
+void TypeDependencyIndex::Finalize(void)
+{
+  delete Instance;
+  Instance = NULL;
+}
+
+void TypeDependencyIndex::build(ASTContext &Ctx)
+{
+  TypeDependencyBuilder Builder(this);
+  Builder.TraverseDecl(Ctx.getTranslationUnitDecl());
+}
+
+const TypeDependencyIndex::DeclVector *
+TypeDependencyIndex::getReferences(const Decl *CanonicalD) const
+{
+  EdgeMap::const_iterator I = References.find(CanonicalD);
+  return (I == References.end()) ? NULL : &I->second;
+}
+
+const TypeDependencyIndex::DeclVector *
+TypeDependencyIndex::getDependents(const Decl *CanonicalD) const
+{
+  EdgeMap::const_iterator I = Dependents.find(CanonicalD);
+  return (I == Dependents.end()) ? NULL : &I->second;
+}
+
+void TypeDependencyIndex::getRemovalClosure(const Decl *CanonicalD,
+                                            DeclVector &Closure) const
+{
+  llvm::SmallPtrSet<const Decl *, 16> Visited;
+  Visited.insert(CanonicalD);
+  unsigned Next = 0;
+  const DeclVector *Deps = getDependents(CanonicalD);
+  if (!Deps)
+    return;
+  for (unsigned I = 0; I < Deps->size(); ++I) {
+    if (Visited.insert((*Deps)[I]).second)
+      Closure.push_back((*Deps)[I]);
+  }
+  while (Next < Closure.size()) {
+    const DeclVector *More = getDependents(Closure[Next]);
+    Next++;
+    if (!More)
+      continue;
+    for (unsigned I = 0; I < More->size(); ++I) {
+      if (Visited.insert((*More)[I]).second)
+        Closure.push_back((*More)[I]);
+    }
+  }
+}
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2012, 2013, 2016 The University of Utah
+// All rights reserved.
+//
+// This file is distributed under the University of Illinois Open Source
+// License.  See the file COPYING for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef TYPE_DEPENDENCY_INDEX_H
+#define TYPE_DEPENDENCY_INDEX_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace clang {
+  class ASTContext;
+  class Decl;
+}
+
+class TypeDependencyBuilder;
+
+// A single translation-unit sweep over the type-dependency graph.  The
+// nodes are canonical typedef-name and tag declarations; an edge A -> B
+// records that the definition of A names B (a typedef's underlying
+// type, a record's field types and base classes).  The reverse edges
+// answer the question the typedef/struct passes otherwise discover one
+// failing probe at a time: removing or rewriting X only has a chance
+// when every recorded dependent of X is handled in the same candidate.
+//
+// Like the other shared indexes, the sweep runs once per parsed AST; in
+// the parse-once server modes the parent builds it right after the
+// parse and every forked counter inherits it through copy-on-write.
+class TypeDependencyIndex {
+friend class TypeDependencyBuilder;
+
+public:
+
+  typedef llvm::SmallVector<const clang::Decl *, 8> DeclVector;
+
+  // Returns the index for Ctx, building it on first request.  A request
+  // for a different ASTContext discards the cached sweep, following the
+  // RewriteUtils::GetInstance convention.
+  static TypeDependencyIndex *GetInstance(clang::ASTContext &Ctx);
+
+  static void Finalize(void);
+
+  // The typedef/record declarations the definition of CanonicalD names,
+  // or NULL when the sweep recorded none.
+  const DeclVector *getReferences(const clang::Decl *CanonicalD) const;
+
+  // The declarations whose definitions name CanonicalD directly, or
+  // NULL when it has no recorded dependents.
+  const DeclVector *getDependents(const clang::Decl *CanonicalD) const;
+
+  // The transitive dependents of CanonicalD in deterministic
+  // breadth-first order, CanonicalD itself excluded: a removal
+  // candidate for CanonicalD is closure-complete only if it also covers
+  // every declaration returned here.
+  void getRemovalClosure(const clang::Decl *CanonicalD,
+                         DeclVector &Closure) const;
+
+private:
+
+  typedef llvm::DenseMap<const clang::Decl *, DeclVector> EdgeMap;
+
+  void build(clang::ASTContext &Ctx);
+
+  static TypeDependencyIndex *Instance;
+
+  const clang::ASTContext *IndexedContext;
+
+  // A -> the nodes the definition of A names
+  EdgeMap References;
+
+  // B -> the nodes whose definitions name B
+  EdgeMap Dependents;
+
+  TypeDependencyIndex(void)
+    : IndexedContext(NULL)
+  { }
+
+  ~TypeDependencyIndex(void)
+  { }
+
+  // Unimplemented
+  TypeDependencyIndex(const TypeDependencyIndex &);
+
+  void operator=(const TypeDependencyIndex &);
+};
+
+#endif
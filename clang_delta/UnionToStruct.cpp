@@ -18,6 +18,7 @@
 #include "clang/AST/ASTContext.h"
 #include "clang/Basic/SourceManager.h"
 
+#include "RecordIndex.h"
 #include "TransformationManager.h"
 
 using namespace clang;
@@ -95,17 +96,16 @@ bool UnionToStructCollectionVisitor::VisitRecordDecl(RecordDecl *RD)
 
 bool UnionToStructCollectionVisitor::VisitDeclStmt(DeclStmt *DS)
 {
-  for (DeclStmt::decl_iterator I = DS->decl_begin(),
-       E = DS->decl_end(); I != E; ++I) {
-    if (VarDecl *CurrVD = dyn_cast<VarDecl>(*I))
-      ConsumerInstance->VarToDeclStmt[CurrVD] = DS;
-  }
+  // recorded into the shared per-parse index; AggregateToScalar builds
+  // the same map, so co-resident passes pay for it once
+  RecordIndex::GetInstance()->recordDeclStmt(DS);
   return true;
 }
 
-void UnionToStruct::Initialize(ASTContext &context) 
+void UnionToStruct::Initialize(ASTContext &context)
 {
   Transformation::Initialize(context);
+  RecordIndex::GetInstance()->prepare(&context);
   CollectionVisitor = new UnionToStructCollectionVisitor(this);
 }
 
@@ -269,7 +269,7 @@ bool UnionToStruct::isTheFirstDecl(const VarDecl *VD)
   }
 
   DeclGroupRef DGR;
-  if (const DeclStmt *DS = VarToDeclStmt[VD])
+  if (const DeclStmt *DS = RecordIndex::GetInstance()->getEnclosingDeclStmt(VD))
     DGR = DS->getDeclGroup();
   else
     DGR = VarToDeclGroup[VD];
@@ -47,10 +47,7 @@ private:
   typedef llvm::SmallPtrSet<const clang::DeclaratorDecl *, 10> 
     DeclaratorDeclSet;
 
-  typedef llvm::DenseMap<const clang::VarDecl *, const clang::DeclStmt *> 
-            VarToDeclStmtMap;
-
-  typedef llvm::DenseMap<const clang::VarDecl *, clang::DeclGroupRef> 
+  typedef llvm::DenseMap<const clang::VarDecl *, clang::DeclGroupRef>
             VarToDeclGroupMap;
 
   typedef llvm::MapVector<const clang::RecordDecl *, DeclaratorDeclSet *> 
@@ -88,8 +85,6 @@ private:
 
   bool isTheFirstDecl(const clang::VarDecl *VD);
 
-  VarToDeclStmtMap VarToDeclStmt;
-
   VarToDeclGroupMap VarToDeclGroup;
 
   RecordDeclToDeclaratorDeclMap RecordToDeclarator;
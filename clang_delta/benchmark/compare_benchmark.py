@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Compare two run_benchmark.py result files and flag regressions.
+
+Prints a per-(corpus, transformation) table of wall time and peak RSS
+deltas against the baseline and exits non-zero if any wall time
+regressed by more than the threshold, so it can gate a CI job or a
+perf-sensitive PR.  When both result files carry hardware counters the
+table adds the IPC movement, which tells a locality regression (IPC
+down) apart from plain extra work (IPC flat, wall up).
+"""
+
+import argparse
+import json
+import sys
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('baseline', help='baseline JSON results')
+    parser.add_argument('current', help='current JSON results')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='wall-time regression threshold in percent '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.current) as f:
+        current = json.load(f)
+
+    regressed = False
+    header = f"{'corpus':<12} {'transformation':<28} {'wall':>16} {'rss':>16}"
+    print(header)
+    print('-' * len(header))
+    for corpus in sorted(current):
+        for transformation in sorted(current[corpus]):
+            cur = current[corpus][transformation]
+            base = baseline.get(corpus, {}).get(transformation)
+            if base is None:
+                print(f'{corpus:<12} {transformation:<28} '
+                      f'{"(no baseline)":>16}')
+                continue
+            wall_pct = 100.0 * (cur['wall'] - base['wall']) / base['wall'] \
+                if base['wall'] else 0.0
+            rss_pct = 100.0 * (cur['peak_rss_kb'] - base['peak_rss_kb']) \
+                / base['peak_rss_kb'] if base['peak_rss_kb'] else 0.0
+            mark = ''
+            if wall_pct > args.threshold:
+                regressed = True
+                mark = '  <-- REGRESSION'
+            ipc = ''
+            cur_ipc = cur.get('counters', {}).get('ipc')
+            base_ipc = base.get('counters', {}).get('ipc')
+            if cur_ipc is not None and base_ipc is not None:
+                ipc = f' ipc {base_ipc:.2f}->{cur_ipc:.2f}'
+            print(f'{corpus:<12} {transformation:<28} '
+                  f'{cur["wall"]:>8.3f}s {wall_pct:>+6.1f}% '
+                  f'{cur["peak_rss_kb"]:>8d}kB {rss_pct:>+5.1f}%{ipc}{mark}')
+
+    sys.exit(1 if regressed else 0)
+
+
+if __name__ == '__main__':
+    main()
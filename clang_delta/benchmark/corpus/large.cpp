@@ -0,0 +1,11595 @@
+// Synthetic preprocessed-style corpus file for the clang_delta
+// benchmark target.  Regenerate only when the benchmark baseline
+// is regenerated as well; timings are only comparable on an
+// identical corpus.
+
+namespace ns0 {
+struct C0_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns1 {
+struct C1_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns2 {
+struct C2_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns3 {
+struct C3_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns4 {
+struct C4_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C4_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C4_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C4_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C4_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C4_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns5 {
+struct C5_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C5_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C5_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C5_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C5_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C5_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns6 {
+struct C6_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C6_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C6_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C6_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C6_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C6_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns7 {
+struct C7_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C7_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C7_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C7_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C7_4 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C7_5 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+static int helper_0(int x) { return x * 1 + 0; }
+int compute_0(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_0(obj.sum()) + obj.get_a();
+}
+static int helper_1(int x) { return x * 2 + 1; }
+int compute_1(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_2(int x) { return x * 3 + 2; }
+int compute_2(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_3(int x) { return x * 4 + 3; }
+int compute_3(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_3(obj.sum()) + obj.get_a();
+}
+static int helper_4(int x) { return x * 5 + 4; }
+int compute_4(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_5(int x) { return x * 6 + 5; }
+int compute_5(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_6(int x) { return x * 7 + 6; }
+int compute_6(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_6(obj.sum()) + obj.get_a();
+}
+static int helper_7(int x) { return x * 1 + 7; }
+int compute_7(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_8(int x) { return x * 2 + 8; }
+int compute_8(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_9(int x) { return x * 3 + 9; }
+int compute_9(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_9(obj.sum()) + obj.get_a();
+}
+static int helper_10(int x) { return x * 4 + 10; }
+int compute_10(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_11(int x) { return x * 5 + 11; }
+int compute_11(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_12(int x) { return x * 6 + 12; }
+int compute_12(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_12(obj.sum()) + obj.get_a();
+}
+static int helper_13(int x) { return x * 7 + 0; }
+int compute_13(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_14(int x) { return x * 1 + 1; }
+int compute_14(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_15(int x) { return x * 2 + 2; }
+int compute_15(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_15(obj.sum()) + obj.get_a();
+}
+static int helper_16(int x) { return x * 3 + 3; }
+int compute_16(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_17(int x) { return x * 4 + 4; }
+int compute_17(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_18(int x) { return x * 5 + 5; }
+int compute_18(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_18(obj.sum()) + obj.get_a();
+}
+static int helper_19(int x) { return x * 6 + 6; }
+int compute_19(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_20(int x) { return x * 7 + 7; }
+int compute_20(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_21(int x) { return x * 1 + 8; }
+int compute_21(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_21(obj.sum()) + obj.get_a();
+}
+static int helper_22(int x) { return x * 2 + 9; }
+int compute_22(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_23(int x) { return x * 3 + 10; }
+int compute_23(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_24(int x) { return x * 4 + 11; }
+int compute_24(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_24(obj.sum()) + obj.get_a();
+}
+static int helper_25(int x) { return x * 5 + 12; }
+int compute_25(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_26(int x) { return x * 6 + 0; }
+int compute_26(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_27(int x) { return x * 7 + 1; }
+int compute_27(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_27(obj.sum()) + obj.get_a();
+}
+static int helper_28(int x) { return x * 1 + 2; }
+int compute_28(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_29(int x) { return x * 2 + 3; }
+int compute_29(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_30(int x) { return x * 3 + 4; }
+int compute_30(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_30(obj.sum()) + obj.get_a();
+}
+static int helper_31(int x) { return x * 4 + 5; }
+int compute_31(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_32(int x) { return x * 5 + 6; }
+int compute_32(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_33(int x) { return x * 6 + 7; }
+int compute_33(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_33(obj.sum()) + obj.get_a();
+}
+static int helper_34(int x) { return x * 7 + 8; }
+int compute_34(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_35(int x) { return x * 1 + 9; }
+int compute_35(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_36(int x) { return x * 2 + 10; }
+int compute_36(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_36(obj.sum()) + obj.get_a();
+}
+static int helper_37(int x) { return x * 3 + 11; }
+int compute_37(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_38(int x) { return x * 4 + 12; }
+int compute_38(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_39(int x) { return x * 5 + 0; }
+int compute_39(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_39(obj.sum()) + obj.get_a();
+}
+static int helper_40(int x) { return x * 6 + 1; }
+int compute_40(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_41(int x) { return x * 7 + 2; }
+int compute_41(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_42(int x) { return x * 1 + 3; }
+int compute_42(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_42(obj.sum()) + obj.get_a();
+}
+static int helper_43(int x) { return x * 2 + 4; }
+int compute_43(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_44(int x) { return x * 3 + 5; }
+int compute_44(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_45(int x) { return x * 4 + 6; }
+int compute_45(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_45(obj.sum()) + obj.get_a();
+}
+static int helper_46(int x) { return x * 5 + 7; }
+int compute_46(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_47(int x) { return x * 6 + 8; }
+int compute_47(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_48(int x) { return x * 7 + 9; }
+int compute_48(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_48(obj.sum()) + obj.get_a();
+}
+static int helper_49(int x) { return x * 1 + 10; }
+int compute_49(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_50(int x) { return x * 2 + 11; }
+int compute_50(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_51(int x) { return x * 3 + 12; }
+int compute_51(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_51(obj.sum()) + obj.get_a();
+}
+static int helper_52(int x) { return x * 4 + 0; }
+int compute_52(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_53(int x) { return x * 5 + 1; }
+int compute_53(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_54(int x) { return x * 6 + 2; }
+int compute_54(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_54(obj.sum()) + obj.get_a();
+}
+static int helper_55(int x) { return x * 7 + 3; }
+int compute_55(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_56(int x) { return x * 1 + 4; }
+int compute_56(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_57(int x) { return x * 2 + 5; }
+int compute_57(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_57(obj.sum()) + obj.get_a();
+}
+static int helper_58(int x) { return x * 3 + 6; }
+int compute_58(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_59(int x) { return x * 4 + 7; }
+int compute_59(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_60(int x) { return x * 5 + 8; }
+int compute_60(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_60(obj.sum()) + obj.get_a();
+}
+static int helper_61(int x) { return x * 6 + 9; }
+int compute_61(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_62(int x) { return x * 7 + 10; }
+int compute_62(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_63(int x) { return x * 1 + 11; }
+int compute_63(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_63(obj.sum()) + obj.get_a();
+}
+static int helper_64(int x) { return x * 2 + 12; }
+int compute_64(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_65(int x) { return x * 3 + 0; }
+int compute_65(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_66(int x) { return x * 4 + 1; }
+int compute_66(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_66(obj.sum()) + obj.get_a();
+}
+static int helper_67(int x) { return x * 5 + 2; }
+int compute_67(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_68(int x) { return x * 6 + 3; }
+int compute_68(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_69(int x) { return x * 7 + 4; }
+int compute_69(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_69(obj.sum()) + obj.get_a();
+}
+static int helper_70(int x) { return x * 1 + 5; }
+int compute_70(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_71(int x) { return x * 2 + 6; }
+int compute_71(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_72(int x) { return x * 3 + 7; }
+int compute_72(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_72(obj.sum()) + obj.get_a();
+}
+static int helper_73(int x) { return x * 4 + 8; }
+int compute_73(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_74(int x) { return x * 5 + 9; }
+int compute_74(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_75(int x) { return x * 6 + 10; }
+int compute_75(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_75(obj.sum()) + obj.get_a();
+}
+static int helper_76(int x) { return x * 7 + 11; }
+int compute_76(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_77(int x) { return x * 1 + 12; }
+int compute_77(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_78(int x) { return x * 2 + 0; }
+int compute_78(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_78(obj.sum()) + obj.get_a();
+}
+static int helper_79(int x) { return x * 3 + 1; }
+int compute_79(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_80(int x) { return x * 4 + 2; }
+int compute_80(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_81(int x) { return x * 5 + 3; }
+int compute_81(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_81(obj.sum()) + obj.get_a();
+}
+static int helper_82(int x) { return x * 6 + 4; }
+int compute_82(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_83(int x) { return x * 7 + 5; }
+int compute_83(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_84(int x) { return x * 1 + 6; }
+int compute_84(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_84(obj.sum()) + obj.get_a();
+}
+static int helper_85(int x) { return x * 2 + 7; }
+int compute_85(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_86(int x) { return x * 3 + 8; }
+int compute_86(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_87(int x) { return x * 4 + 9; }
+int compute_87(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_87(obj.sum()) + obj.get_a();
+}
+static int helper_88(int x) { return x * 5 + 10; }
+int compute_88(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_89(int x) { return x * 6 + 11; }
+int compute_89(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_90(int x) { return x * 7 + 12; }
+int compute_90(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_90(obj.sum()) + obj.get_a();
+}
+static int helper_91(int x) { return x * 1 + 0; }
+int compute_91(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_92(int x) { return x * 2 + 1; }
+int compute_92(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_93(int x) { return x * 3 + 2; }
+int compute_93(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_93(obj.sum()) + obj.get_a();
+}
+static int helper_94(int x) { return x * 4 + 3; }
+int compute_94(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_95(int x) { return x * 5 + 4; }
+int compute_95(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_96(int x) { return x * 6 + 5; }
+int compute_96(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_96(obj.sum()) + obj.get_a();
+}
+static int helper_97(int x) { return x * 7 + 6; }
+int compute_97(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_98(int x) { return x * 1 + 7; }
+int compute_98(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_99(int x) { return x * 2 + 8; }
+int compute_99(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_99(obj.sum()) + obj.get_a();
+}
+static int helper_100(int x) { return x * 3 + 9; }
+int compute_100(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_101(int x) { return x * 4 + 10; }
+int compute_101(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_102(int x) { return x * 5 + 11; }
+int compute_102(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_102(obj.sum()) + obj.get_a();
+}
+static int helper_103(int x) { return x * 6 + 12; }
+int compute_103(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_104(int x) { return x * 7 + 0; }
+int compute_104(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_105(int x) { return x * 1 + 1; }
+int compute_105(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_105(obj.sum()) + obj.get_a();
+}
+static int helper_106(int x) { return x * 2 + 2; }
+int compute_106(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_107(int x) { return x * 3 + 3; }
+int compute_107(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_108(int x) { return x * 4 + 4; }
+int compute_108(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_108(obj.sum()) + obj.get_a();
+}
+static int helper_109(int x) { return x * 5 + 5; }
+int compute_109(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_110(int x) { return x * 6 + 6; }
+int compute_110(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_111(int x) { return x * 7 + 7; }
+int compute_111(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_111(obj.sum()) + obj.get_a();
+}
+static int helper_112(int x) { return x * 1 + 8; }
+int compute_112(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_113(int x) { return x * 2 + 9; }
+int compute_113(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_114(int x) { return x * 3 + 10; }
+int compute_114(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_114(obj.sum()) + obj.get_a();
+}
+static int helper_115(int x) { return x * 4 + 11; }
+int compute_115(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_116(int x) { return x * 5 + 12; }
+int compute_116(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_117(int x) { return x * 6 + 0; }
+int compute_117(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_117(obj.sum()) + obj.get_a();
+}
+static int helper_118(int x) { return x * 7 + 1; }
+int compute_118(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_119(int x) { return x * 1 + 2; }
+int compute_119(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_120(int x) { return x * 2 + 3; }
+int compute_120(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_120(obj.sum()) + obj.get_a();
+}
+static int helper_121(int x) { return x * 3 + 4; }
+int compute_121(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_122(int x) { return x * 4 + 5; }
+int compute_122(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_123(int x) { return x * 5 + 6; }
+int compute_123(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_123(obj.sum()) + obj.get_a();
+}
+static int helper_124(int x) { return x * 6 + 7; }
+int compute_124(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_125(int x) { return x * 7 + 8; }
+int compute_125(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_126(int x) { return x * 1 + 9; }
+int compute_126(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_126(obj.sum()) + obj.get_a();
+}
+static int helper_127(int x) { return x * 2 + 10; }
+int compute_127(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_128(int x) { return x * 3 + 11; }
+int compute_128(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_129(int x) { return x * 4 + 12; }
+int compute_129(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_129(obj.sum()) + obj.get_a();
+}
+static int helper_130(int x) { return x * 5 + 0; }
+int compute_130(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_131(int x) { return x * 6 + 1; }
+int compute_131(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_132(int x) { return x * 7 + 2; }
+int compute_132(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_132(obj.sum()) + obj.get_a();
+}
+static int helper_133(int x) { return x * 1 + 3; }
+int compute_133(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_134(int x) { return x * 2 + 4; }
+int compute_134(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_135(int x) { return x * 3 + 5; }
+int compute_135(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_135(obj.sum()) + obj.get_a();
+}
+static int helper_136(int x) { return x * 4 + 6; }
+int compute_136(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_137(int x) { return x * 5 + 7; }
+int compute_137(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_138(int x) { return x * 6 + 8; }
+int compute_138(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_138(obj.sum()) + obj.get_a();
+}
+static int helper_139(int x) { return x * 7 + 9; }
+int compute_139(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_140(int x) { return x * 1 + 10; }
+int compute_140(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_141(int x) { return x * 2 + 11; }
+int compute_141(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_141(obj.sum()) + obj.get_a();
+}
+static int helper_142(int x) { return x * 3 + 12; }
+int compute_142(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_143(int x) { return x * 4 + 0; }
+int compute_143(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_144(int x) { return x * 5 + 1; }
+int compute_144(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_144(obj.sum()) + obj.get_a();
+}
+static int helper_145(int x) { return x * 6 + 2; }
+int compute_145(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_146(int x) { return x * 7 + 3; }
+int compute_146(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_147(int x) { return x * 1 + 4; }
+int compute_147(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_147(obj.sum()) + obj.get_a();
+}
+static int helper_148(int x) { return x * 2 + 5; }
+int compute_148(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_149(int x) { return x * 3 + 6; }
+int compute_149(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_150(int x) { return x * 4 + 7; }
+int compute_150(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_150(obj.sum()) + obj.get_a();
+}
+static int helper_151(int x) { return x * 5 + 8; }
+int compute_151(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_152(int x) { return x * 6 + 9; }
+int compute_152(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_153(int x) { return x * 7 + 10; }
+int compute_153(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_153(obj.sum()) + obj.get_a();
+}
+static int helper_154(int x) { return x * 1 + 11; }
+int compute_154(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_155(int x) { return x * 2 + 12; }
+int compute_155(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_156(int x) { return x * 3 + 0; }
+int compute_156(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_156(obj.sum()) + obj.get_a();
+}
+static int helper_157(int x) { return x * 4 + 1; }
+int compute_157(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_158(int x) { return x * 5 + 2; }
+int compute_158(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_159(int x) { return x * 6 + 3; }
+int compute_159(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_159(obj.sum()) + obj.get_a();
+}
+static int helper_160(int x) { return x * 7 + 4; }
+int compute_160(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_161(int x) { return x * 1 + 5; }
+int compute_161(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_162(int x) { return x * 2 + 6; }
+int compute_162(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_162(obj.sum()) + obj.get_a();
+}
+static int helper_163(int x) { return x * 3 + 7; }
+int compute_163(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_164(int x) { return x * 4 + 8; }
+int compute_164(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_165(int x) { return x * 5 + 9; }
+int compute_165(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_165(obj.sum()) + obj.get_a();
+}
+static int helper_166(int x) { return x * 6 + 10; }
+int compute_166(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_167(int x) { return x * 7 + 11; }
+int compute_167(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_168(int x) { return x * 1 + 12; }
+int compute_168(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_168(obj.sum()) + obj.get_a();
+}
+static int helper_169(int x) { return x * 2 + 0; }
+int compute_169(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_170(int x) { return x * 3 + 1; }
+int compute_170(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_171(int x) { return x * 4 + 2; }
+int compute_171(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_171(obj.sum()) + obj.get_a();
+}
+static int helper_172(int x) { return x * 5 + 3; }
+int compute_172(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_173(int x) { return x * 6 + 4; }
+int compute_173(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_174(int x) { return x * 7 + 5; }
+int compute_174(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_174(obj.sum()) + obj.get_a();
+}
+static int helper_175(int x) { return x * 1 + 6; }
+int compute_175(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_176(int x) { return x * 2 + 7; }
+int compute_176(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_177(int x) { return x * 3 + 8; }
+int compute_177(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_177(obj.sum()) + obj.get_a();
+}
+static int helper_178(int x) { return x * 4 + 9; }
+int compute_178(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_179(int x) { return x * 5 + 10; }
+int compute_179(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_180(int x) { return x * 6 + 11; }
+int compute_180(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_180(obj.sum()) + obj.get_a();
+}
+static int helper_181(int x) { return x * 7 + 12; }
+int compute_181(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_182(int x) { return x * 1 + 0; }
+int compute_182(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_183(int x) { return x * 2 + 1; }
+int compute_183(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_183(obj.sum()) + obj.get_a();
+}
+static int helper_184(int x) { return x * 3 + 2; }
+int compute_184(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_185(int x) { return x * 4 + 3; }
+int compute_185(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_186(int x) { return x * 5 + 4; }
+int compute_186(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_186(obj.sum()) + obj.get_a();
+}
+static int helper_187(int x) { return x * 6 + 5; }
+int compute_187(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_188(int x) { return x * 7 + 6; }
+int compute_188(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_189(int x) { return x * 1 + 7; }
+int compute_189(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_189(obj.sum()) + obj.get_a();
+}
+static int helper_190(int x) { return x * 2 + 8; }
+int compute_190(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_191(int x) { return x * 3 + 9; }
+int compute_191(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_192(int x) { return x * 4 + 10; }
+int compute_192(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_192(obj.sum()) + obj.get_a();
+}
+static int helper_193(int x) { return x * 5 + 11; }
+int compute_193(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_194(int x) { return x * 6 + 12; }
+int compute_194(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_195(int x) { return x * 7 + 0; }
+int compute_195(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_195(obj.sum()) + obj.get_a();
+}
+static int helper_196(int x) { return x * 1 + 1; }
+int compute_196(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_197(int x) { return x * 2 + 2; }
+int compute_197(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_198(int x) { return x * 3 + 3; }
+int compute_198(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_198(obj.sum()) + obj.get_a();
+}
+static int helper_199(int x) { return x * 4 + 4; }
+int compute_199(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_200(int x) { return x * 5 + 5; }
+int compute_200(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_201(int x) { return x * 6 + 6; }
+int compute_201(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_201(obj.sum()) + obj.get_a();
+}
+static int helper_202(int x) { return x * 7 + 7; }
+int compute_202(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_203(int x) { return x * 1 + 8; }
+int compute_203(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_204(int x) { return x * 2 + 9; }
+int compute_204(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_204(obj.sum()) + obj.get_a();
+}
+static int helper_205(int x) { return x * 3 + 10; }
+int compute_205(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_206(int x) { return x * 4 + 11; }
+int compute_206(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_207(int x) { return x * 5 + 12; }
+int compute_207(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_207(obj.sum()) + obj.get_a();
+}
+static int helper_208(int x) { return x * 6 + 0; }
+int compute_208(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_209(int x) { return x * 7 + 1; }
+int compute_209(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_210(int x) { return x * 1 + 2; }
+int compute_210(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_210(obj.sum()) + obj.get_a();
+}
+static int helper_211(int x) { return x * 2 + 3; }
+int compute_211(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_212(int x) { return x * 3 + 4; }
+int compute_212(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_213(int x) { return x * 4 + 5; }
+int compute_213(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_213(obj.sum()) + obj.get_a();
+}
+static int helper_214(int x) { return x * 5 + 6; }
+int compute_214(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_215(int x) { return x * 6 + 7; }
+int compute_215(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_216(int x) { return x * 7 + 8; }
+int compute_216(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_216(obj.sum()) + obj.get_a();
+}
+static int helper_217(int x) { return x * 1 + 9; }
+int compute_217(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_218(int x) { return x * 2 + 10; }
+int compute_218(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_219(int x) { return x * 3 + 11; }
+int compute_219(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_219(obj.sum()) + obj.get_a();
+}
+static int helper_220(int x) { return x * 4 + 12; }
+int compute_220(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_221(int x) { return x * 5 + 0; }
+int compute_221(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_222(int x) { return x * 6 + 1; }
+int compute_222(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_222(obj.sum()) + obj.get_a();
+}
+static int helper_223(int x) { return x * 7 + 2; }
+int compute_223(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_224(int x) { return x * 1 + 3; }
+int compute_224(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_225(int x) { return x * 2 + 4; }
+int compute_225(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_225(obj.sum()) + obj.get_a();
+}
+static int helper_226(int x) { return x * 3 + 5; }
+int compute_226(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_227(int x) { return x * 4 + 6; }
+int compute_227(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_228(int x) { return x * 5 + 7; }
+int compute_228(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_228(obj.sum()) + obj.get_a();
+}
+static int helper_229(int x) { return x * 6 + 8; }
+int compute_229(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_230(int x) { return x * 7 + 9; }
+int compute_230(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_231(int x) { return x * 1 + 10; }
+int compute_231(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_231(obj.sum()) + obj.get_a();
+}
+static int helper_232(int x) { return x * 2 + 11; }
+int compute_232(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_233(int x) { return x * 3 + 12; }
+int compute_233(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_234(int x) { return x * 4 + 0; }
+int compute_234(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_234(obj.sum()) + obj.get_a();
+}
+static int helper_235(int x) { return x * 5 + 1; }
+int compute_235(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_236(int x) { return x * 6 + 2; }
+int compute_236(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_237(int x) { return x * 7 + 3; }
+int compute_237(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_237(obj.sum()) + obj.get_a();
+}
+static int helper_238(int x) { return x * 1 + 4; }
+int compute_238(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_239(int x) { return x * 2 + 5; }
+int compute_239(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_240(int x) { return x * 3 + 6; }
+int compute_240(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_240(obj.sum()) + obj.get_a();
+}
+static int helper_241(int x) { return x * 4 + 7; }
+int compute_241(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_242(int x) { return x * 5 + 8; }
+int compute_242(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_243(int x) { return x * 6 + 9; }
+int compute_243(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_243(obj.sum()) + obj.get_a();
+}
+static int helper_244(int x) { return x * 7 + 10; }
+int compute_244(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_245(int x) { return x * 1 + 11; }
+int compute_245(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_246(int x) { return x * 2 + 12; }
+int compute_246(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_246(obj.sum()) + obj.get_a();
+}
+static int helper_247(int x) { return x * 3 + 0; }
+int compute_247(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_248(int x) { return x * 4 + 1; }
+int compute_248(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_249(int x) { return x * 5 + 2; }
+int compute_249(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_249(obj.sum()) + obj.get_a();
+}
+static int helper_250(int x) { return x * 6 + 3; }
+int compute_250(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_251(int x) { return x * 7 + 4; }
+int compute_251(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_252(int x) { return x * 1 + 5; }
+int compute_252(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_252(obj.sum()) + obj.get_a();
+}
+static int helper_253(int x) { return x * 2 + 6; }
+int compute_253(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_254(int x) { return x * 3 + 7; }
+int compute_254(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_255(int x) { return x * 4 + 8; }
+int compute_255(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_255(obj.sum()) + obj.get_a();
+}
+static int helper_256(int x) { return x * 5 + 9; }
+int compute_256(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_257(int x) { return x * 6 + 10; }
+int compute_257(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_258(int x) { return x * 7 + 11; }
+int compute_258(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_258(obj.sum()) + obj.get_a();
+}
+static int helper_259(int x) { return x * 1 + 12; }
+int compute_259(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_260(int x) { return x * 2 + 0; }
+int compute_260(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_261(int x) { return x * 3 + 1; }
+int compute_261(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_261(obj.sum()) + obj.get_a();
+}
+static int helper_262(int x) { return x * 4 + 2; }
+int compute_262(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_263(int x) { return x * 5 + 3; }
+int compute_263(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_264(int x) { return x * 6 + 4; }
+int compute_264(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_264(obj.sum()) + obj.get_a();
+}
+static int helper_265(int x) { return x * 7 + 5; }
+int compute_265(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_266(int x) { return x * 1 + 6; }
+int compute_266(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_267(int x) { return x * 2 + 7; }
+int compute_267(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_267(obj.sum()) + obj.get_a();
+}
+static int helper_268(int x) { return x * 3 + 8; }
+int compute_268(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_269(int x) { return x * 4 + 9; }
+int compute_269(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_270(int x) { return x * 5 + 10; }
+int compute_270(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_270(obj.sum()) + obj.get_a();
+}
+static int helper_271(int x) { return x * 6 + 11; }
+int compute_271(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_272(int x) { return x * 7 + 12; }
+int compute_272(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_273(int x) { return x * 1 + 0; }
+int compute_273(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_273(obj.sum()) + obj.get_a();
+}
+static int helper_274(int x) { return x * 2 + 1; }
+int compute_274(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_275(int x) { return x * 3 + 2; }
+int compute_275(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_276(int x) { return x * 4 + 3; }
+int compute_276(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_276(obj.sum()) + obj.get_a();
+}
+static int helper_277(int x) { return x * 5 + 4; }
+int compute_277(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_278(int x) { return x * 6 + 5; }
+int compute_278(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_279(int x) { return x * 7 + 6; }
+int compute_279(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_279(obj.sum()) + obj.get_a();
+}
+static int helper_280(int x) { return x * 1 + 7; }
+int compute_280(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_281(int x) { return x * 2 + 8; }
+int compute_281(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_282(int x) { return x * 3 + 9; }
+int compute_282(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_282(obj.sum()) + obj.get_a();
+}
+static int helper_283(int x) { return x * 4 + 10; }
+int compute_283(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_284(int x) { return x * 5 + 11; }
+int compute_284(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_285(int x) { return x * 6 + 12; }
+int compute_285(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_285(obj.sum()) + obj.get_a();
+}
+static int helper_286(int x) { return x * 7 + 0; }
+int compute_286(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_287(int x) { return x * 1 + 1; }
+int compute_287(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_288(int x) { return x * 2 + 2; }
+int compute_288(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_288(obj.sum()) + obj.get_a();
+}
+static int helper_289(int x) { return x * 3 + 3; }
+int compute_289(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_290(int x) { return x * 4 + 4; }
+int compute_290(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_291(int x) { return x * 5 + 5; }
+int compute_291(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_291(obj.sum()) + obj.get_a();
+}
+static int helper_292(int x) { return x * 6 + 6; }
+int compute_292(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_293(int x) { return x * 7 + 7; }
+int compute_293(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_294(int x) { return x * 1 + 8; }
+int compute_294(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_294(obj.sum()) + obj.get_a();
+}
+static int helper_295(int x) { return x * 2 + 9; }
+int compute_295(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_296(int x) { return x * 3 + 10; }
+int compute_296(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_297(int x) { return x * 4 + 11; }
+int compute_297(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_297(obj.sum()) + obj.get_a();
+}
+static int helper_298(int x) { return x * 5 + 12; }
+int compute_298(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_299(int x) { return x * 6 + 0; }
+int compute_299(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_300(int x) { return x * 7 + 1; }
+int compute_300(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_300(obj.sum()) + obj.get_a();
+}
+static int helper_301(int x) { return x * 1 + 2; }
+int compute_301(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_302(int x) { return x * 2 + 3; }
+int compute_302(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_303(int x) { return x * 3 + 4; }
+int compute_303(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_303(obj.sum()) + obj.get_a();
+}
+static int helper_304(int x) { return x * 4 + 5; }
+int compute_304(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_305(int x) { return x * 5 + 6; }
+int compute_305(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_306(int x) { return x * 6 + 7; }
+int compute_306(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_306(obj.sum()) + obj.get_a();
+}
+static int helper_307(int x) { return x * 7 + 8; }
+int compute_307(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_308(int x) { return x * 1 + 9; }
+int compute_308(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_309(int x) { return x * 2 + 10; }
+int compute_309(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_309(obj.sum()) + obj.get_a();
+}
+static int helper_310(int x) { return x * 3 + 11; }
+int compute_310(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_311(int x) { return x * 4 + 12; }
+int compute_311(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_312(int x) { return x * 5 + 0; }
+int compute_312(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_312(obj.sum()) + obj.get_a();
+}
+static int helper_313(int x) { return x * 6 + 1; }
+int compute_313(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_314(int x) { return x * 7 + 2; }
+int compute_314(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_315(int x) { return x * 1 + 3; }
+int compute_315(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_315(obj.sum()) + obj.get_a();
+}
+static int helper_316(int x) { return x * 2 + 4; }
+int compute_316(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_317(int x) { return x * 3 + 5; }
+int compute_317(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_318(int x) { return x * 4 + 6; }
+int compute_318(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_318(obj.sum()) + obj.get_a();
+}
+static int helper_319(int x) { return x * 5 + 7; }
+int compute_319(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_320(int x) { return x * 6 + 8; }
+int compute_320(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_321(int x) { return x * 7 + 9; }
+int compute_321(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_321(obj.sum()) + obj.get_a();
+}
+static int helper_322(int x) { return x * 1 + 10; }
+int compute_322(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_323(int x) { return x * 2 + 11; }
+int compute_323(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_324(int x) { return x * 3 + 12; }
+int compute_324(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_324(obj.sum()) + obj.get_a();
+}
+static int helper_325(int x) { return x * 4 + 0; }
+int compute_325(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_326(int x) { return x * 5 + 1; }
+int compute_326(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_327(int x) { return x * 6 + 2; }
+int compute_327(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_327(obj.sum()) + obj.get_a();
+}
+static int helper_328(int x) { return x * 7 + 3; }
+int compute_328(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_329(int x) { return x * 1 + 4; }
+int compute_329(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_330(int x) { return x * 2 + 5; }
+int compute_330(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_330(obj.sum()) + obj.get_a();
+}
+static int helper_331(int x) { return x * 3 + 6; }
+int compute_331(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_332(int x) { return x * 4 + 7; }
+int compute_332(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_333(int x) { return x * 5 + 8; }
+int compute_333(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_333(obj.sum()) + obj.get_a();
+}
+static int helper_334(int x) { return x * 6 + 9; }
+int compute_334(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_335(int x) { return x * 7 + 10; }
+int compute_335(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_336(int x) { return x * 1 + 11; }
+int compute_336(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_336(obj.sum()) + obj.get_a();
+}
+static int helper_337(int x) { return x * 2 + 12; }
+int compute_337(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_338(int x) { return x * 3 + 0; }
+int compute_338(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_339(int x) { return x * 4 + 1; }
+int compute_339(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_339(obj.sum()) + obj.get_a();
+}
+static int helper_340(int x) { return x * 5 + 2; }
+int compute_340(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_341(int x) { return x * 6 + 3; }
+int compute_341(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_342(int x) { return x * 7 + 4; }
+int compute_342(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_342(obj.sum()) + obj.get_a();
+}
+static int helper_343(int x) { return x * 1 + 5; }
+int compute_343(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_344(int x) { return x * 2 + 6; }
+int compute_344(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_345(int x) { return x * 3 + 7; }
+int compute_345(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_345(obj.sum()) + obj.get_a();
+}
+static int helper_346(int x) { return x * 4 + 8; }
+int compute_346(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_347(int x) { return x * 5 + 9; }
+int compute_347(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_348(int x) { return x * 6 + 10; }
+int compute_348(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_348(obj.sum()) + obj.get_a();
+}
+static int helper_349(int x) { return x * 7 + 11; }
+int compute_349(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_350(int x) { return x * 1 + 12; }
+int compute_350(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_351(int x) { return x * 2 + 0; }
+int compute_351(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_351(obj.sum()) + obj.get_a();
+}
+static int helper_352(int x) { return x * 3 + 1; }
+int compute_352(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_353(int x) { return x * 4 + 2; }
+int compute_353(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_354(int x) { return x * 5 + 3; }
+int compute_354(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_354(obj.sum()) + obj.get_a();
+}
+static int helper_355(int x) { return x * 6 + 4; }
+int compute_355(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_356(int x) { return x * 7 + 5; }
+int compute_356(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_357(int x) { return x * 1 + 6; }
+int compute_357(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_357(obj.sum()) + obj.get_a();
+}
+static int helper_358(int x) { return x * 2 + 7; }
+int compute_358(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_359(int x) { return x * 3 + 8; }
+int compute_359(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_360(int x) { return x * 4 + 9; }
+int compute_360(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_360(obj.sum()) + obj.get_a();
+}
+static int helper_361(int x) { return x * 5 + 10; }
+int compute_361(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_362(int x) { return x * 6 + 11; }
+int compute_362(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_363(int x) { return x * 7 + 12; }
+int compute_363(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_363(obj.sum()) + obj.get_a();
+}
+static int helper_364(int x) { return x * 1 + 0; }
+int compute_364(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_365(int x) { return x * 2 + 1; }
+int compute_365(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_366(int x) { return x * 3 + 2; }
+int compute_366(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_366(obj.sum()) + obj.get_a();
+}
+static int helper_367(int x) { return x * 4 + 3; }
+int compute_367(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_368(int x) { return x * 5 + 4; }
+int compute_368(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_369(int x) { return x * 6 + 5; }
+int compute_369(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_369(obj.sum()) + obj.get_a();
+}
+static int helper_370(int x) { return x * 7 + 6; }
+int compute_370(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_371(int x) { return x * 1 + 7; }
+int compute_371(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_372(int x) { return x * 2 + 8; }
+int compute_372(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_372(obj.sum()) + obj.get_a();
+}
+static int helper_373(int x) { return x * 3 + 9; }
+int compute_373(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_374(int x) { return x * 4 + 10; }
+int compute_374(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_375(int x) { return x * 5 + 11; }
+int compute_375(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_375(obj.sum()) + obj.get_a();
+}
+static int helper_376(int x) { return x * 6 + 12; }
+int compute_376(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_377(int x) { return x * 7 + 0; }
+int compute_377(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_378(int x) { return x * 1 + 1; }
+int compute_378(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_378(obj.sum()) + obj.get_a();
+}
+static int helper_379(int x) { return x * 2 + 2; }
+int compute_379(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_380(int x) { return x * 3 + 3; }
+int compute_380(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_381(int x) { return x * 4 + 4; }
+int compute_381(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_381(obj.sum()) + obj.get_a();
+}
+static int helper_382(int x) { return x * 5 + 5; }
+int compute_382(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_383(int x) { return x * 6 + 6; }
+int compute_383(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_384(int x) { return x * 7 + 7; }
+int compute_384(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_384(obj.sum()) + obj.get_a();
+}
+static int helper_385(int x) { return x * 1 + 8; }
+int compute_385(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_386(int x) { return x * 2 + 9; }
+int compute_386(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_387(int x) { return x * 3 + 10; }
+int compute_387(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_387(obj.sum()) + obj.get_a();
+}
+static int helper_388(int x) { return x * 4 + 11; }
+int compute_388(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_389(int x) { return x * 5 + 12; }
+int compute_389(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_390(int x) { return x * 6 + 0; }
+int compute_390(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_390(obj.sum()) + obj.get_a();
+}
+static int helper_391(int x) { return x * 7 + 1; }
+int compute_391(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_392(int x) { return x * 1 + 2; }
+int compute_392(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_393(int x) { return x * 2 + 3; }
+int compute_393(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_393(obj.sum()) + obj.get_a();
+}
+static int helper_394(int x) { return x * 3 + 4; }
+int compute_394(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_395(int x) { return x * 4 + 5; }
+int compute_395(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_396(int x) { return x * 5 + 6; }
+int compute_396(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_396(obj.sum()) + obj.get_a();
+}
+static int helper_397(int x) { return x * 6 + 7; }
+int compute_397(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_398(int x) { return x * 7 + 8; }
+int compute_398(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_399(int x) { return x * 1 + 9; }
+int compute_399(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_399(obj.sum()) + obj.get_a();
+}
+static int helper_400(int x) { return x * 2 + 10; }
+int compute_400(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_401(int x) { return x * 3 + 11; }
+int compute_401(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_402(int x) { return x * 4 + 12; }
+int compute_402(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_402(obj.sum()) + obj.get_a();
+}
+static int helper_403(int x) { return x * 5 + 0; }
+int compute_403(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_404(int x) { return x * 6 + 1; }
+int compute_404(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_405(int x) { return x * 7 + 2; }
+int compute_405(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_405(obj.sum()) + obj.get_a();
+}
+static int helper_406(int x) { return x * 1 + 3; }
+int compute_406(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_407(int x) { return x * 2 + 4; }
+int compute_407(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_408(int x) { return x * 3 + 5; }
+int compute_408(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_408(obj.sum()) + obj.get_a();
+}
+static int helper_409(int x) { return x * 4 + 6; }
+int compute_409(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_410(int x) { return x * 5 + 7; }
+int compute_410(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_411(int x) { return x * 6 + 8; }
+int compute_411(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_411(obj.sum()) + obj.get_a();
+}
+static int helper_412(int x) { return x * 7 + 9; }
+int compute_412(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_413(int x) { return x * 1 + 10; }
+int compute_413(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_414(int x) { return x * 2 + 11; }
+int compute_414(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_414(obj.sum()) + obj.get_a();
+}
+static int helper_415(int x) { return x * 3 + 12; }
+int compute_415(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_416(int x) { return x * 4 + 0; }
+int compute_416(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_417(int x) { return x * 5 + 1; }
+int compute_417(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_417(obj.sum()) + obj.get_a();
+}
+static int helper_418(int x) { return x * 6 + 2; }
+int compute_418(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_419(int x) { return x * 7 + 3; }
+int compute_419(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_420(int x) { return x * 1 + 4; }
+int compute_420(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_420(obj.sum()) + obj.get_a();
+}
+static int helper_421(int x) { return x * 2 + 5; }
+int compute_421(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_422(int x) { return x * 3 + 6; }
+int compute_422(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_423(int x) { return x * 4 + 7; }
+int compute_423(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_423(obj.sum()) + obj.get_a();
+}
+static int helper_424(int x) { return x * 5 + 8; }
+int compute_424(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_425(int x) { return x * 6 + 9; }
+int compute_425(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_426(int x) { return x * 7 + 10; }
+int compute_426(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_426(obj.sum()) + obj.get_a();
+}
+static int helper_427(int x) { return x * 1 + 11; }
+int compute_427(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_428(int x) { return x * 2 + 12; }
+int compute_428(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_429(int x) { return x * 3 + 0; }
+int compute_429(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_429(obj.sum()) + obj.get_a();
+}
+static int helper_430(int x) { return x * 4 + 1; }
+int compute_430(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_431(int x) { return x * 5 + 2; }
+int compute_431(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_432(int x) { return x * 6 + 3; }
+int compute_432(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_432(obj.sum()) + obj.get_a();
+}
+static int helper_433(int x) { return x * 7 + 4; }
+int compute_433(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_434(int x) { return x * 1 + 5; }
+int compute_434(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_435(int x) { return x * 2 + 6; }
+int compute_435(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_435(obj.sum()) + obj.get_a();
+}
+static int helper_436(int x) { return x * 3 + 7; }
+int compute_436(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_437(int x) { return x * 4 + 8; }
+int compute_437(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_438(int x) { return x * 5 + 9; }
+int compute_438(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_438(obj.sum()) + obj.get_a();
+}
+static int helper_439(int x) { return x * 6 + 10; }
+int compute_439(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_440(int x) { return x * 7 + 11; }
+int compute_440(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_441(int x) { return x * 1 + 12; }
+int compute_441(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_441(obj.sum()) + obj.get_a();
+}
+static int helper_442(int x) { return x * 2 + 0; }
+int compute_442(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_443(int x) { return x * 3 + 1; }
+int compute_443(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_444(int x) { return x * 4 + 2; }
+int compute_444(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_444(obj.sum()) + obj.get_a();
+}
+static int helper_445(int x) { return x * 5 + 3; }
+int compute_445(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_446(int x) { return x * 6 + 4; }
+int compute_446(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_447(int x) { return x * 7 + 5; }
+int compute_447(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_447(obj.sum()) + obj.get_a();
+}
+static int helper_448(int x) { return x * 1 + 6; }
+int compute_448(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_449(int x) { return x * 2 + 7; }
+int compute_449(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_450(int x) { return x * 3 + 8; }
+int compute_450(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_450(obj.sum()) + obj.get_a();
+}
+static int helper_451(int x) { return x * 4 + 9; }
+int compute_451(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_452(int x) { return x * 5 + 10; }
+int compute_452(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_453(int x) { return x * 6 + 11; }
+int compute_453(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_453(obj.sum()) + obj.get_a();
+}
+static int helper_454(int x) { return x * 7 + 12; }
+int compute_454(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_455(int x) { return x * 1 + 0; }
+int compute_455(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_456(int x) { return x * 2 + 1; }
+int compute_456(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_456(obj.sum()) + obj.get_a();
+}
+static int helper_457(int x) { return x * 3 + 2; }
+int compute_457(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_458(int x) { return x * 4 + 3; }
+int compute_458(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_459(int x) { return x * 5 + 4; }
+int compute_459(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_459(obj.sum()) + obj.get_a();
+}
+static int helper_460(int x) { return x * 6 + 5; }
+int compute_460(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_461(int x) { return x * 7 + 6; }
+int compute_461(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_462(int x) { return x * 1 + 7; }
+int compute_462(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_462(obj.sum()) + obj.get_a();
+}
+static int helper_463(int x) { return x * 2 + 8; }
+int compute_463(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_464(int x) { return x * 3 + 9; }
+int compute_464(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_465(int x) { return x * 4 + 10; }
+int compute_465(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_465(obj.sum()) + obj.get_a();
+}
+static int helper_466(int x) { return x * 5 + 11; }
+int compute_466(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_467(int x) { return x * 6 + 12; }
+int compute_467(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_468(int x) { return x * 7 + 0; }
+int compute_468(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_468(obj.sum()) + obj.get_a();
+}
+static int helper_469(int x) { return x * 1 + 1; }
+int compute_469(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_470(int x) { return x * 2 + 2; }
+int compute_470(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_471(int x) { return x * 3 + 3; }
+int compute_471(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_471(obj.sum()) + obj.get_a();
+}
+static int helper_472(int x) { return x * 4 + 4; }
+int compute_472(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_473(int x) { return x * 5 + 5; }
+int compute_473(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_474(int x) { return x * 6 + 6; }
+int compute_474(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_474(obj.sum()) + obj.get_a();
+}
+static int helper_475(int x) { return x * 7 + 7; }
+int compute_475(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_476(int x) { return x * 1 + 8; }
+int compute_476(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_477(int x) { return x * 2 + 9; }
+int compute_477(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_477(obj.sum()) + obj.get_a();
+}
+static int helper_478(int x) { return x * 3 + 10; }
+int compute_478(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_479(int x) { return x * 4 + 11; }
+int compute_479(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_480(int x) { return x * 5 + 12; }
+int compute_480(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_480(obj.sum()) + obj.get_a();
+}
+static int helper_481(int x) { return x * 6 + 0; }
+int compute_481(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_482(int x) { return x * 7 + 1; }
+int compute_482(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_483(int x) { return x * 1 + 2; }
+int compute_483(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_483(obj.sum()) + obj.get_a();
+}
+static int helper_484(int x) { return x * 2 + 3; }
+int compute_484(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_485(int x) { return x * 3 + 4; }
+int compute_485(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_486(int x) { return x * 4 + 5; }
+int compute_486(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_486(obj.sum()) + obj.get_a();
+}
+static int helper_487(int x) { return x * 5 + 6; }
+int compute_487(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_488(int x) { return x * 6 + 7; }
+int compute_488(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_489(int x) { return x * 7 + 8; }
+int compute_489(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_489(obj.sum()) + obj.get_a();
+}
+static int helper_490(int x) { return x * 1 + 9; }
+int compute_490(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_491(int x) { return x * 2 + 10; }
+int compute_491(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_492(int x) { return x * 3 + 11; }
+int compute_492(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_492(obj.sum()) + obj.get_a();
+}
+static int helper_493(int x) { return x * 4 + 12; }
+int compute_493(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_494(int x) { return x * 5 + 0; }
+int compute_494(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_495(int x) { return x * 6 + 1; }
+int compute_495(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_495(obj.sum()) + obj.get_a();
+}
+static int helper_496(int x) { return x * 7 + 2; }
+int compute_496(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_497(int x) { return x * 1 + 3; }
+int compute_497(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_498(int x) { return x * 2 + 4; }
+int compute_498(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_498(obj.sum()) + obj.get_a();
+}
+static int helper_499(int x) { return x * 3 + 5; }
+int compute_499(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_500(int x) { return x * 4 + 6; }
+int compute_500(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_501(int x) { return x * 5 + 7; }
+int compute_501(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_501(obj.sum()) + obj.get_a();
+}
+static int helper_502(int x) { return x * 6 + 8; }
+int compute_502(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_503(int x) { return x * 7 + 9; }
+int compute_503(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_504(int x) { return x * 1 + 10; }
+int compute_504(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_504(obj.sum()) + obj.get_a();
+}
+static int helper_505(int x) { return x * 2 + 11; }
+int compute_505(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_506(int x) { return x * 3 + 12; }
+int compute_506(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_507(int x) { return x * 4 + 0; }
+int compute_507(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_507(obj.sum()) + obj.get_a();
+}
+static int helper_508(int x) { return x * 5 + 1; }
+int compute_508(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_509(int x) { return x * 6 + 2; }
+int compute_509(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_510(int x) { return x * 7 + 3; }
+int compute_510(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_510(obj.sum()) + obj.get_a();
+}
+static int helper_511(int x) { return x * 1 + 4; }
+int compute_511(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_512(int x) { return x * 2 + 5; }
+int compute_512(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_513(int x) { return x * 3 + 6; }
+int compute_513(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_513(obj.sum()) + obj.get_a();
+}
+static int helper_514(int x) { return x * 4 + 7; }
+int compute_514(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_515(int x) { return x * 5 + 8; }
+int compute_515(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_516(int x) { return x * 6 + 9; }
+int compute_516(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_516(obj.sum()) + obj.get_a();
+}
+static int helper_517(int x) { return x * 7 + 10; }
+int compute_517(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_518(int x) { return x * 1 + 11; }
+int compute_518(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_519(int x) { return x * 2 + 12; }
+int compute_519(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_519(obj.sum()) + obj.get_a();
+}
+static int helper_520(int x) { return x * 3 + 0; }
+int compute_520(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_521(int x) { return x * 4 + 1; }
+int compute_521(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_522(int x) { return x * 5 + 2; }
+int compute_522(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_522(obj.sum()) + obj.get_a();
+}
+static int helper_523(int x) { return x * 6 + 3; }
+int compute_523(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_524(int x) { return x * 7 + 4; }
+int compute_524(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_525(int x) { return x * 1 + 5; }
+int compute_525(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_525(obj.sum()) + obj.get_a();
+}
+static int helper_526(int x) { return x * 2 + 6; }
+int compute_526(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_527(int x) { return x * 3 + 7; }
+int compute_527(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_528(int x) { return x * 4 + 8; }
+int compute_528(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_528(obj.sum()) + obj.get_a();
+}
+static int helper_529(int x) { return x * 5 + 9; }
+int compute_529(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_530(int x) { return x * 6 + 10; }
+int compute_530(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_531(int x) { return x * 7 + 11; }
+int compute_531(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_531(obj.sum()) + obj.get_a();
+}
+static int helper_532(int x) { return x * 1 + 12; }
+int compute_532(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_533(int x) { return x * 2 + 0; }
+int compute_533(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_534(int x) { return x * 3 + 1; }
+int compute_534(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_534(obj.sum()) + obj.get_a();
+}
+static int helper_535(int x) { return x * 4 + 2; }
+int compute_535(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_536(int x) { return x * 5 + 3; }
+int compute_536(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_537(int x) { return x * 6 + 4; }
+int compute_537(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_537(obj.sum()) + obj.get_a();
+}
+static int helper_538(int x) { return x * 7 + 5; }
+int compute_538(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_539(int x) { return x * 1 + 6; }
+int compute_539(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_540(int x) { return x * 2 + 7; }
+int compute_540(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_540(obj.sum()) + obj.get_a();
+}
+static int helper_541(int x) { return x * 3 + 8; }
+int compute_541(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_542(int x) { return x * 4 + 9; }
+int compute_542(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_543(int x) { return x * 5 + 10; }
+int compute_543(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_543(obj.sum()) + obj.get_a();
+}
+static int helper_544(int x) { return x * 6 + 11; }
+int compute_544(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_545(int x) { return x * 7 + 12; }
+int compute_545(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_546(int x) { return x * 1 + 0; }
+int compute_546(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_546(obj.sum()) + obj.get_a();
+}
+static int helper_547(int x) { return x * 2 + 1; }
+int compute_547(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_548(int x) { return x * 3 + 2; }
+int compute_548(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_549(int x) { return x * 4 + 3; }
+int compute_549(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_549(obj.sum()) + obj.get_a();
+}
+static int helper_550(int x) { return x * 5 + 4; }
+int compute_550(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_551(int x) { return x * 6 + 5; }
+int compute_551(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_552(int x) { return x * 7 + 6; }
+int compute_552(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_552(obj.sum()) + obj.get_a();
+}
+static int helper_553(int x) { return x * 1 + 7; }
+int compute_553(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_554(int x) { return x * 2 + 8; }
+int compute_554(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_555(int x) { return x * 3 + 9; }
+int compute_555(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_555(obj.sum()) + obj.get_a();
+}
+static int helper_556(int x) { return x * 4 + 10; }
+int compute_556(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_557(int x) { return x * 5 + 11; }
+int compute_557(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_558(int x) { return x * 6 + 12; }
+int compute_558(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_558(obj.sum()) + obj.get_a();
+}
+static int helper_559(int x) { return x * 7 + 0; }
+int compute_559(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_560(int x) { return x * 1 + 1; }
+int compute_560(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_561(int x) { return x * 2 + 2; }
+int compute_561(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_561(obj.sum()) + obj.get_a();
+}
+static int helper_562(int x) { return x * 3 + 3; }
+int compute_562(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_563(int x) { return x * 4 + 4; }
+int compute_563(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_564(int x) { return x * 5 + 5; }
+int compute_564(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_564(obj.sum()) + obj.get_a();
+}
+static int helper_565(int x) { return x * 6 + 6; }
+int compute_565(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_566(int x) { return x * 7 + 7; }
+int compute_566(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_567(int x) { return x * 1 + 8; }
+int compute_567(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_567(obj.sum()) + obj.get_a();
+}
+static int helper_568(int x) { return x * 2 + 9; }
+int compute_568(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_569(int x) { return x * 3 + 10; }
+int compute_569(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_570(int x) { return x * 4 + 11; }
+int compute_570(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_570(obj.sum()) + obj.get_a();
+}
+static int helper_571(int x) { return x * 5 + 12; }
+int compute_571(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_572(int x) { return x * 6 + 0; }
+int compute_572(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_573(int x) { return x * 7 + 1; }
+int compute_573(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_573(obj.sum()) + obj.get_a();
+}
+static int helper_574(int x) { return x * 1 + 2; }
+int compute_574(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_575(int x) { return x * 2 + 3; }
+int compute_575(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_576(int x) { return x * 3 + 4; }
+int compute_576(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_576(obj.sum()) + obj.get_a();
+}
+static int helper_577(int x) { return x * 4 + 5; }
+int compute_577(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_578(int x) { return x * 5 + 6; }
+int compute_578(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_579(int x) { return x * 6 + 7; }
+int compute_579(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_579(obj.sum()) + obj.get_a();
+}
+static int helper_580(int x) { return x * 7 + 8; }
+int compute_580(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_581(int x) { return x * 1 + 9; }
+int compute_581(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_582(int x) { return x * 2 + 10; }
+int compute_582(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_582(obj.sum()) + obj.get_a();
+}
+static int helper_583(int x) { return x * 3 + 11; }
+int compute_583(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_584(int x) { return x * 4 + 12; }
+int compute_584(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_585(int x) { return x * 5 + 0; }
+int compute_585(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_585(obj.sum()) + obj.get_a();
+}
+static int helper_586(int x) { return x * 6 + 1; }
+int compute_586(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_587(int x) { return x * 7 + 2; }
+int compute_587(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_588(int x) { return x * 1 + 3; }
+int compute_588(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_588(obj.sum()) + obj.get_a();
+}
+static int helper_589(int x) { return x * 2 + 4; }
+int compute_589(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_590(int x) { return x * 3 + 5; }
+int compute_590(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_591(int x) { return x * 4 + 6; }
+int compute_591(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_591(obj.sum()) + obj.get_a();
+}
+static int helper_592(int x) { return x * 5 + 7; }
+int compute_592(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_593(int x) { return x * 6 + 8; }
+int compute_593(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_594(int x) { return x * 7 + 9; }
+int compute_594(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_594(obj.sum()) + obj.get_a();
+}
+static int helper_595(int x) { return x * 1 + 10; }
+int compute_595(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_596(int x) { return x * 2 + 11; }
+int compute_596(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_597(int x) { return x * 3 + 12; }
+int compute_597(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_597(obj.sum()) + obj.get_a();
+}
+static int helper_598(int x) { return x * 4 + 0; }
+int compute_598(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_599(int x) { return x * 5 + 1; }
+int compute_599(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_600(int x) { return x * 6 + 2; }
+int compute_600(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_600(obj.sum()) + obj.get_a();
+}
+static int helper_601(int x) { return x * 7 + 3; }
+int compute_601(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_602(int x) { return x * 1 + 4; }
+int compute_602(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_603(int x) { return x * 2 + 5; }
+int compute_603(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_603(obj.sum()) + obj.get_a();
+}
+static int helper_604(int x) { return x * 3 + 6; }
+int compute_604(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_605(int x) { return x * 4 + 7; }
+int compute_605(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_606(int x) { return x * 5 + 8; }
+int compute_606(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_606(obj.sum()) + obj.get_a();
+}
+static int helper_607(int x) { return x * 6 + 9; }
+int compute_607(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_608(int x) { return x * 7 + 10; }
+int compute_608(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_609(int x) { return x * 1 + 11; }
+int compute_609(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_609(obj.sum()) + obj.get_a();
+}
+static int helper_610(int x) { return x * 2 + 12; }
+int compute_610(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_611(int x) { return x * 3 + 0; }
+int compute_611(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_612(int x) { return x * 4 + 1; }
+int compute_612(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_612(obj.sum()) + obj.get_a();
+}
+static int helper_613(int x) { return x * 5 + 2; }
+int compute_613(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_614(int x) { return x * 6 + 3; }
+int compute_614(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_615(int x) { return x * 7 + 4; }
+int compute_615(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_615(obj.sum()) + obj.get_a();
+}
+static int helper_616(int x) { return x * 1 + 5; }
+int compute_616(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_617(int x) { return x * 2 + 6; }
+int compute_617(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_618(int x) { return x * 3 + 7; }
+int compute_618(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_618(obj.sum()) + obj.get_a();
+}
+static int helper_619(int x) { return x * 4 + 8; }
+int compute_619(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_620(int x) { return x * 5 + 9; }
+int compute_620(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_621(int x) { return x * 6 + 10; }
+int compute_621(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_621(obj.sum()) + obj.get_a();
+}
+static int helper_622(int x) { return x * 7 + 11; }
+int compute_622(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_623(int x) { return x * 1 + 12; }
+int compute_623(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_624(int x) { return x * 2 + 0; }
+int compute_624(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_624(obj.sum()) + obj.get_a();
+}
+static int helper_625(int x) { return x * 3 + 1; }
+int compute_625(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_626(int x) { return x * 4 + 2; }
+int compute_626(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_627(int x) { return x * 5 + 3; }
+int compute_627(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_627(obj.sum()) + obj.get_a();
+}
+static int helper_628(int x) { return x * 6 + 4; }
+int compute_628(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_629(int x) { return x * 7 + 5; }
+int compute_629(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_630(int x) { return x * 1 + 6; }
+int compute_630(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_630(obj.sum()) + obj.get_a();
+}
+static int helper_631(int x) { return x * 2 + 7; }
+int compute_631(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_632(int x) { return x * 3 + 8; }
+int compute_632(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_633(int x) { return x * 4 + 9; }
+int compute_633(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_633(obj.sum()) + obj.get_a();
+}
+static int helper_634(int x) { return x * 5 + 10; }
+int compute_634(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_635(int x) { return x * 6 + 11; }
+int compute_635(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_636(int x) { return x * 7 + 12; }
+int compute_636(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_636(obj.sum()) + obj.get_a();
+}
+static int helper_637(int x) { return x * 1 + 0; }
+int compute_637(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_638(int x) { return x * 2 + 1; }
+int compute_638(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_639(int x) { return x * 3 + 2; }
+int compute_639(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_639(obj.sum()) + obj.get_a();
+}
+static int helper_640(int x) { return x * 4 + 3; }
+int compute_640(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_641(int x) { return x * 5 + 4; }
+int compute_641(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_642(int x) { return x * 6 + 5; }
+int compute_642(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_642(obj.sum()) + obj.get_a();
+}
+static int helper_643(int x) { return x * 7 + 6; }
+int compute_643(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_644(int x) { return x * 1 + 7; }
+int compute_644(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_645(int x) { return x * 2 + 8; }
+int compute_645(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_645(obj.sum()) + obj.get_a();
+}
+static int helper_646(int x) { return x * 3 + 9; }
+int compute_646(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_647(int x) { return x * 4 + 10; }
+int compute_647(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_648(int x) { return x * 5 + 11; }
+int compute_648(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_648(obj.sum()) + obj.get_a();
+}
+static int helper_649(int x) { return x * 6 + 12; }
+int compute_649(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_650(int x) { return x * 7 + 0; }
+int compute_650(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_651(int x) { return x * 1 + 1; }
+int compute_651(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_651(obj.sum()) + obj.get_a();
+}
+static int helper_652(int x) { return x * 2 + 2; }
+int compute_652(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_653(int x) { return x * 3 + 3; }
+int compute_653(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_654(int x) { return x * 4 + 4; }
+int compute_654(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_654(obj.sum()) + obj.get_a();
+}
+static int helper_655(int x) { return x * 5 + 5; }
+int compute_655(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_656(int x) { return x * 6 + 6; }
+int compute_656(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_657(int x) { return x * 7 + 7; }
+int compute_657(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_657(obj.sum()) + obj.get_a();
+}
+static int helper_658(int x) { return x * 1 + 8; }
+int compute_658(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_659(int x) { return x * 2 + 9; }
+int compute_659(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_660(int x) { return x * 3 + 10; }
+int compute_660(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_660(obj.sum()) + obj.get_a();
+}
+static int helper_661(int x) { return x * 4 + 11; }
+int compute_661(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_662(int x) { return x * 5 + 12; }
+int compute_662(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_663(int x) { return x * 6 + 0; }
+int compute_663(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_663(obj.sum()) + obj.get_a();
+}
+static int helper_664(int x) { return x * 7 + 1; }
+int compute_664(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_665(int x) { return x * 1 + 2; }
+int compute_665(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_666(int x) { return x * 2 + 3; }
+int compute_666(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_666(obj.sum()) + obj.get_a();
+}
+static int helper_667(int x) { return x * 3 + 4; }
+int compute_667(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_668(int x) { return x * 4 + 5; }
+int compute_668(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_669(int x) { return x * 5 + 6; }
+int compute_669(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_669(obj.sum()) + obj.get_a();
+}
+static int helper_670(int x) { return x * 6 + 7; }
+int compute_670(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_671(int x) { return x * 7 + 8; }
+int compute_671(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_672(int x) { return x * 1 + 9; }
+int compute_672(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_672(obj.sum()) + obj.get_a();
+}
+static int helper_673(int x) { return x * 2 + 10; }
+int compute_673(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_674(int x) { return x * 3 + 11; }
+int compute_674(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_675(int x) { return x * 4 + 12; }
+int compute_675(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_675(obj.sum()) + obj.get_a();
+}
+static int helper_676(int x) { return x * 5 + 0; }
+int compute_676(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_677(int x) { return x * 6 + 1; }
+int compute_677(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_678(int x) { return x * 7 + 2; }
+int compute_678(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_678(obj.sum()) + obj.get_a();
+}
+static int helper_679(int x) { return x * 1 + 3; }
+int compute_679(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_680(int x) { return x * 2 + 4; }
+int compute_680(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_681(int x) { return x * 3 + 5; }
+int compute_681(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_681(obj.sum()) + obj.get_a();
+}
+static int helper_682(int x) { return x * 4 + 6; }
+int compute_682(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_683(int x) { return x * 5 + 7; }
+int compute_683(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_684(int x) { return x * 6 + 8; }
+int compute_684(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_684(obj.sum()) + obj.get_a();
+}
+static int helper_685(int x) { return x * 7 + 9; }
+int compute_685(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_686(int x) { return x * 1 + 10; }
+int compute_686(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_687(int x) { return x * 2 + 11; }
+int compute_687(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_687(obj.sum()) + obj.get_a();
+}
+static int helper_688(int x) { return x * 3 + 12; }
+int compute_688(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_689(int x) { return x * 4 + 0; }
+int compute_689(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_690(int x) { return x * 5 + 1; }
+int compute_690(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_690(obj.sum()) + obj.get_a();
+}
+static int helper_691(int x) { return x * 6 + 2; }
+int compute_691(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_692(int x) { return x * 7 + 3; }
+int compute_692(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_693(int x) { return x * 1 + 4; }
+int compute_693(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_693(obj.sum()) + obj.get_a();
+}
+static int helper_694(int x) { return x * 2 + 5; }
+int compute_694(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_695(int x) { return x * 3 + 6; }
+int compute_695(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_696(int x) { return x * 4 + 7; }
+int compute_696(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_696(obj.sum()) + obj.get_a();
+}
+static int helper_697(int x) { return x * 5 + 8; }
+int compute_697(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_698(int x) { return x * 6 + 9; }
+int compute_698(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_699(int x) { return x * 7 + 10; }
+int compute_699(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_699(obj.sum()) + obj.get_a();
+}
+static int helper_700(int x) { return x * 1 + 11; }
+int compute_700(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_701(int x) { return x * 2 + 12; }
+int compute_701(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_702(int x) { return x * 3 + 0; }
+int compute_702(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_702(obj.sum()) + obj.get_a();
+}
+static int helper_703(int x) { return x * 4 + 1; }
+int compute_703(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_704(int x) { return x * 5 + 2; }
+int compute_704(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_705(int x) { return x * 6 + 3; }
+int compute_705(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_705(obj.sum()) + obj.get_a();
+}
+static int helper_706(int x) { return x * 7 + 4; }
+int compute_706(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_707(int x) { return x * 1 + 5; }
+int compute_707(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_708(int x) { return x * 2 + 6; }
+int compute_708(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_708(obj.sum()) + obj.get_a();
+}
+static int helper_709(int x) { return x * 3 + 7; }
+int compute_709(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_710(int x) { return x * 4 + 8; }
+int compute_710(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_711(int x) { return x * 5 + 9; }
+int compute_711(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_711(obj.sum()) + obj.get_a();
+}
+static int helper_712(int x) { return x * 6 + 10; }
+int compute_712(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_713(int x) { return x * 7 + 11; }
+int compute_713(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_714(int x) { return x * 1 + 12; }
+int compute_714(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_714(obj.sum()) + obj.get_a();
+}
+static int helper_715(int x) { return x * 2 + 0; }
+int compute_715(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_716(int x) { return x * 3 + 1; }
+int compute_716(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_717(int x) { return x * 4 + 2; }
+int compute_717(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_717(obj.sum()) + obj.get_a();
+}
+static int helper_718(int x) { return x * 5 + 3; }
+int compute_718(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_719(int x) { return x * 6 + 4; }
+int compute_719(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_720(int x) { return x * 7 + 5; }
+int compute_720(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_720(obj.sum()) + obj.get_a();
+}
+static int helper_721(int x) { return x * 1 + 6; }
+int compute_721(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_722(int x) { return x * 2 + 7; }
+int compute_722(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_723(int x) { return x * 3 + 8; }
+int compute_723(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_723(obj.sum()) + obj.get_a();
+}
+static int helper_724(int x) { return x * 4 + 9; }
+int compute_724(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_725(int x) { return x * 5 + 10; }
+int compute_725(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_726(int x) { return x * 6 + 11; }
+int compute_726(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_726(obj.sum()) + obj.get_a();
+}
+static int helper_727(int x) { return x * 7 + 12; }
+int compute_727(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_728(int x) { return x * 1 + 0; }
+int compute_728(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_729(int x) { return x * 2 + 1; }
+int compute_729(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_729(obj.sum()) + obj.get_a();
+}
+static int helper_730(int x) { return x * 3 + 2; }
+int compute_730(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_731(int x) { return x * 4 + 3; }
+int compute_731(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_732(int x) { return x * 5 + 4; }
+int compute_732(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_732(obj.sum()) + obj.get_a();
+}
+static int helper_733(int x) { return x * 6 + 5; }
+int compute_733(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_734(int x) { return x * 7 + 6; }
+int compute_734(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_735(int x) { return x * 1 + 7; }
+int compute_735(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_735(obj.sum()) + obj.get_a();
+}
+static int helper_736(int x) { return x * 2 + 8; }
+int compute_736(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_737(int x) { return x * 3 + 9; }
+int compute_737(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_738(int x) { return x * 4 + 10; }
+int compute_738(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_738(obj.sum()) + obj.get_a();
+}
+static int helper_739(int x) { return x * 5 + 11; }
+int compute_739(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_740(int x) { return x * 6 + 12; }
+int compute_740(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_741(int x) { return x * 7 + 0; }
+int compute_741(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_741(obj.sum()) + obj.get_a();
+}
+static int helper_742(int x) { return x * 1 + 1; }
+int compute_742(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_743(int x) { return x * 2 + 2; }
+int compute_743(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_744(int x) { return x * 3 + 3; }
+int compute_744(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_744(obj.sum()) + obj.get_a();
+}
+static int helper_745(int x) { return x * 4 + 4; }
+int compute_745(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_746(int x) { return x * 5 + 5; }
+int compute_746(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_747(int x) { return x * 6 + 6; }
+int compute_747(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_747(obj.sum()) + obj.get_a();
+}
+static int helper_748(int x) { return x * 7 + 7; }
+int compute_748(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_749(int x) { return x * 1 + 8; }
+int compute_749(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_750(int x) { return x * 2 + 9; }
+int compute_750(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_750(obj.sum()) + obj.get_a();
+}
+static int helper_751(int x) { return x * 3 + 10; }
+int compute_751(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_752(int x) { return x * 4 + 11; }
+int compute_752(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_753(int x) { return x * 5 + 12; }
+int compute_753(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_753(obj.sum()) + obj.get_a();
+}
+static int helper_754(int x) { return x * 6 + 0; }
+int compute_754(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_755(int x) { return x * 7 + 1; }
+int compute_755(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_756(int x) { return x * 1 + 2; }
+int compute_756(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_756(obj.sum()) + obj.get_a();
+}
+static int helper_757(int x) { return x * 2 + 3; }
+int compute_757(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_758(int x) { return x * 3 + 4; }
+int compute_758(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_759(int x) { return x * 4 + 5; }
+int compute_759(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_759(obj.sum()) + obj.get_a();
+}
+static int helper_760(int x) { return x * 5 + 6; }
+int compute_760(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_761(int x) { return x * 6 + 7; }
+int compute_761(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_762(int x) { return x * 7 + 8; }
+int compute_762(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_762(obj.sum()) + obj.get_a();
+}
+static int helper_763(int x) { return x * 1 + 9; }
+int compute_763(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_764(int x) { return x * 2 + 10; }
+int compute_764(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_765(int x) { return x * 3 + 11; }
+int compute_765(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_765(obj.sum()) + obj.get_a();
+}
+static int helper_766(int x) { return x * 4 + 12; }
+int compute_766(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_767(int x) { return x * 5 + 0; }
+int compute_767(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_768(int x) { return x * 6 + 1; }
+int compute_768(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_768(obj.sum()) + obj.get_a();
+}
+static int helper_769(int x) { return x * 7 + 2; }
+int compute_769(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_770(int x) { return x * 1 + 3; }
+int compute_770(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_771(int x) { return x * 2 + 4; }
+int compute_771(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_771(obj.sum()) + obj.get_a();
+}
+static int helper_772(int x) { return x * 3 + 5; }
+int compute_772(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_773(int x) { return x * 4 + 6; }
+int compute_773(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_774(int x) { return x * 5 + 7; }
+int compute_774(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_774(obj.sum()) + obj.get_a();
+}
+static int helper_775(int x) { return x * 6 + 8; }
+int compute_775(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_776(int x) { return x * 7 + 9; }
+int compute_776(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_777(int x) { return x * 1 + 10; }
+int compute_777(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_777(obj.sum()) + obj.get_a();
+}
+static int helper_778(int x) { return x * 2 + 11; }
+int compute_778(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_779(int x) { return x * 3 + 12; }
+int compute_779(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_780(int x) { return x * 4 + 0; }
+int compute_780(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_780(obj.sum()) + obj.get_a();
+}
+static int helper_781(int x) { return x * 5 + 1; }
+int compute_781(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_782(int x) { return x * 6 + 2; }
+int compute_782(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_783(int x) { return x * 7 + 3; }
+int compute_783(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_783(obj.sum()) + obj.get_a();
+}
+static int helper_784(int x) { return x * 1 + 4; }
+int compute_784(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_785(int x) { return x * 2 + 5; }
+int compute_785(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_786(int x) { return x * 3 + 6; }
+int compute_786(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_786(obj.sum()) + obj.get_a();
+}
+static int helper_787(int x) { return x * 4 + 7; }
+int compute_787(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_788(int x) { return x * 5 + 8; }
+int compute_788(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_789(int x) { return x * 6 + 9; }
+int compute_789(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_789(obj.sum()) + obj.get_a();
+}
+static int helper_790(int x) { return x * 7 + 10; }
+int compute_790(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_791(int x) { return x * 1 + 11; }
+int compute_791(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_792(int x) { return x * 2 + 12; }
+int compute_792(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_792(obj.sum()) + obj.get_a();
+}
+static int helper_793(int x) { return x * 3 + 0; }
+int compute_793(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_794(int x) { return x * 4 + 1; }
+int compute_794(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_795(int x) { return x * 5 + 2; }
+int compute_795(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_795(obj.sum()) + obj.get_a();
+}
+static int helper_796(int x) { return x * 6 + 3; }
+int compute_796(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_797(int x) { return x * 7 + 4; }
+int compute_797(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_798(int x) { return x * 1 + 5; }
+int compute_798(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_798(obj.sum()) + obj.get_a();
+}
+static int helper_799(int x) { return x * 2 + 6; }
+int compute_799(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_800(int x) { return x * 3 + 7; }
+int compute_800(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_801(int x) { return x * 4 + 8; }
+int compute_801(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_801(obj.sum()) + obj.get_a();
+}
+static int helper_802(int x) { return x * 5 + 9; }
+int compute_802(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_803(int x) { return x * 6 + 10; }
+int compute_803(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_804(int x) { return x * 7 + 11; }
+int compute_804(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_804(obj.sum()) + obj.get_a();
+}
+static int helper_805(int x) { return x * 1 + 12; }
+int compute_805(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_806(int x) { return x * 2 + 0; }
+int compute_806(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_807(int x) { return x * 3 + 1; }
+int compute_807(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_807(obj.sum()) + obj.get_a();
+}
+static int helper_808(int x) { return x * 4 + 2; }
+int compute_808(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_809(int x) { return x * 5 + 3; }
+int compute_809(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_810(int x) { return x * 6 + 4; }
+int compute_810(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_810(obj.sum()) + obj.get_a();
+}
+static int helper_811(int x) { return x * 7 + 5; }
+int compute_811(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_812(int x) { return x * 1 + 6; }
+int compute_812(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_813(int x) { return x * 2 + 7; }
+int compute_813(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_813(obj.sum()) + obj.get_a();
+}
+static int helper_814(int x) { return x * 3 + 8; }
+int compute_814(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_815(int x) { return x * 4 + 9; }
+int compute_815(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_816(int x) { return x * 5 + 10; }
+int compute_816(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_816(obj.sum()) + obj.get_a();
+}
+static int helper_817(int x) { return x * 6 + 11; }
+int compute_817(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_818(int x) { return x * 7 + 12; }
+int compute_818(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_819(int x) { return x * 1 + 0; }
+int compute_819(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_819(obj.sum()) + obj.get_a();
+}
+static int helper_820(int x) { return x * 2 + 1; }
+int compute_820(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_821(int x) { return x * 3 + 2; }
+int compute_821(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_822(int x) { return x * 4 + 3; }
+int compute_822(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_822(obj.sum()) + obj.get_a();
+}
+static int helper_823(int x) { return x * 5 + 4; }
+int compute_823(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_824(int x) { return x * 6 + 5; }
+int compute_824(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_825(int x) { return x * 7 + 6; }
+int compute_825(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_825(obj.sum()) + obj.get_a();
+}
+static int helper_826(int x) { return x * 1 + 7; }
+int compute_826(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_827(int x) { return x * 2 + 8; }
+int compute_827(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_828(int x) { return x * 3 + 9; }
+int compute_828(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_828(obj.sum()) + obj.get_a();
+}
+static int helper_829(int x) { return x * 4 + 10; }
+int compute_829(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_830(int x) { return x * 5 + 11; }
+int compute_830(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_831(int x) { return x * 6 + 12; }
+int compute_831(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_831(obj.sum()) + obj.get_a();
+}
+static int helper_832(int x) { return x * 7 + 0; }
+int compute_832(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_833(int x) { return x * 1 + 1; }
+int compute_833(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_834(int x) { return x * 2 + 2; }
+int compute_834(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_834(obj.sum()) + obj.get_a();
+}
+static int helper_835(int x) { return x * 3 + 3; }
+int compute_835(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_836(int x) { return x * 4 + 4; }
+int compute_836(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_837(int x) { return x * 5 + 5; }
+int compute_837(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_837(obj.sum()) + obj.get_a();
+}
+static int helper_838(int x) { return x * 6 + 6; }
+int compute_838(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_839(int x) { return x * 7 + 7; }
+int compute_839(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_840(int x) { return x * 1 + 8; }
+int compute_840(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_840(obj.sum()) + obj.get_a();
+}
+static int helper_841(int x) { return x * 2 + 9; }
+int compute_841(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_842(int x) { return x * 3 + 10; }
+int compute_842(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_843(int x) { return x * 4 + 11; }
+int compute_843(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_843(obj.sum()) + obj.get_a();
+}
+static int helper_844(int x) { return x * 5 + 12; }
+int compute_844(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_845(int x) { return x * 6 + 0; }
+int compute_845(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_846(int x) { return x * 7 + 1; }
+int compute_846(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_846(obj.sum()) + obj.get_a();
+}
+static int helper_847(int x) { return x * 1 + 2; }
+int compute_847(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_848(int x) { return x * 2 + 3; }
+int compute_848(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_849(int x) { return x * 3 + 4; }
+int compute_849(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_849(obj.sum()) + obj.get_a();
+}
+static int helper_850(int x) { return x * 4 + 5; }
+int compute_850(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_851(int x) { return x * 5 + 6; }
+int compute_851(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_852(int x) { return x * 6 + 7; }
+int compute_852(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_852(obj.sum()) + obj.get_a();
+}
+static int helper_853(int x) { return x * 7 + 8; }
+int compute_853(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_854(int x) { return x * 1 + 9; }
+int compute_854(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_855(int x) { return x * 2 + 10; }
+int compute_855(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_855(obj.sum()) + obj.get_a();
+}
+static int helper_856(int x) { return x * 3 + 11; }
+int compute_856(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_857(int x) { return x * 4 + 12; }
+int compute_857(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_858(int x) { return x * 5 + 0; }
+int compute_858(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_858(obj.sum()) + obj.get_a();
+}
+static int helper_859(int x) { return x * 6 + 1; }
+int compute_859(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_860(int x) { return x * 7 + 2; }
+int compute_860(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_861(int x) { return x * 1 + 3; }
+int compute_861(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_861(obj.sum()) + obj.get_a();
+}
+static int helper_862(int x) { return x * 2 + 4; }
+int compute_862(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_863(int x) { return x * 3 + 5; }
+int compute_863(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_864(int x) { return x * 4 + 6; }
+int compute_864(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_864(obj.sum()) + obj.get_a();
+}
+static int helper_865(int x) { return x * 5 + 7; }
+int compute_865(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_866(int x) { return x * 6 + 8; }
+int compute_866(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_867(int x) { return x * 7 + 9; }
+int compute_867(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_867(obj.sum()) + obj.get_a();
+}
+static int helper_868(int x) { return x * 1 + 10; }
+int compute_868(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_869(int x) { return x * 2 + 11; }
+int compute_869(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_870(int x) { return x * 3 + 12; }
+int compute_870(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_870(obj.sum()) + obj.get_a();
+}
+static int helper_871(int x) { return x * 4 + 0; }
+int compute_871(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_872(int x) { return x * 5 + 1; }
+int compute_872(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_873(int x) { return x * 6 + 2; }
+int compute_873(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_873(obj.sum()) + obj.get_a();
+}
+static int helper_874(int x) { return x * 7 + 3; }
+int compute_874(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_875(int x) { return x * 1 + 4; }
+int compute_875(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_876(int x) { return x * 2 + 5; }
+int compute_876(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_876(obj.sum()) + obj.get_a();
+}
+static int helper_877(int x) { return x * 3 + 6; }
+int compute_877(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_878(int x) { return x * 4 + 7; }
+int compute_878(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_879(int x) { return x * 5 + 8; }
+int compute_879(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_879(obj.sum()) + obj.get_a();
+}
+static int helper_880(int x) { return x * 6 + 9; }
+int compute_880(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_881(int x) { return x * 7 + 10; }
+int compute_881(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_882(int x) { return x * 1 + 11; }
+int compute_882(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_882(obj.sum()) + obj.get_a();
+}
+static int helper_883(int x) { return x * 2 + 12; }
+int compute_883(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_884(int x) { return x * 3 + 0; }
+int compute_884(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_885(int x) { return x * 4 + 1; }
+int compute_885(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_885(obj.sum()) + obj.get_a();
+}
+static int helper_886(int x) { return x * 5 + 2; }
+int compute_886(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_887(int x) { return x * 6 + 3; }
+int compute_887(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_888(int x) { return x * 7 + 4; }
+int compute_888(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_888(obj.sum()) + obj.get_a();
+}
+static int helper_889(int x) { return x * 1 + 5; }
+int compute_889(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_890(int x) { return x * 2 + 6; }
+int compute_890(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_891(int x) { return x * 3 + 7; }
+int compute_891(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_891(obj.sum()) + obj.get_a();
+}
+static int helper_892(int x) { return x * 4 + 8; }
+int compute_892(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_893(int x) { return x * 5 + 9; }
+int compute_893(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_894(int x) { return x * 6 + 10; }
+int compute_894(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_894(obj.sum()) + obj.get_a();
+}
+static int helper_895(int x) { return x * 7 + 11; }
+int compute_895(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_896(int x) { return x * 1 + 12; }
+int compute_896(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_897(int x) { return x * 2 + 0; }
+int compute_897(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_897(obj.sum()) + obj.get_a();
+}
+static int helper_898(int x) { return x * 3 + 1; }
+int compute_898(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_899(int x) { return x * 4 + 2; }
+int compute_899(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_900(int x) { return x * 5 + 3; }
+int compute_900(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_900(obj.sum()) + obj.get_a();
+}
+static int helper_901(int x) { return x * 6 + 4; }
+int compute_901(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_902(int x) { return x * 7 + 5; }
+int compute_902(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_903(int x) { return x * 1 + 6; }
+int compute_903(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_903(obj.sum()) + obj.get_a();
+}
+static int helper_904(int x) { return x * 2 + 7; }
+int compute_904(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_905(int x) { return x * 3 + 8; }
+int compute_905(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_906(int x) { return x * 4 + 9; }
+int compute_906(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_906(obj.sum()) + obj.get_a();
+}
+static int helper_907(int x) { return x * 5 + 10; }
+int compute_907(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_908(int x) { return x * 6 + 11; }
+int compute_908(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_909(int x) { return x * 7 + 12; }
+int compute_909(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_909(obj.sum()) + obj.get_a();
+}
+static int helper_910(int x) { return x * 1 + 0; }
+int compute_910(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_911(int x) { return x * 2 + 1; }
+int compute_911(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_912(int x) { return x * 3 + 2; }
+int compute_912(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_912(obj.sum()) + obj.get_a();
+}
+static int helper_913(int x) { return x * 4 + 3; }
+int compute_913(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_914(int x) { return x * 5 + 4; }
+int compute_914(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_915(int x) { return x * 6 + 5; }
+int compute_915(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_915(obj.sum()) + obj.get_a();
+}
+static int helper_916(int x) { return x * 7 + 6; }
+int compute_916(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_917(int x) { return x * 1 + 7; }
+int compute_917(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_918(int x) { return x * 2 + 8; }
+int compute_918(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_918(obj.sum()) + obj.get_a();
+}
+static int helper_919(int x) { return x * 3 + 9; }
+int compute_919(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_920(int x) { return x * 4 + 10; }
+int compute_920(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_921(int x) { return x * 5 + 11; }
+int compute_921(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_921(obj.sum()) + obj.get_a();
+}
+static int helper_922(int x) { return x * 6 + 12; }
+int compute_922(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_923(int x) { return x * 7 + 0; }
+int compute_923(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_924(int x) { return x * 1 + 1; }
+int compute_924(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_924(obj.sum()) + obj.get_a();
+}
+static int helper_925(int x) { return x * 2 + 2; }
+int compute_925(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_926(int x) { return x * 3 + 3; }
+int compute_926(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_927(int x) { return x * 4 + 4; }
+int compute_927(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_927(obj.sum()) + obj.get_a();
+}
+static int helper_928(int x) { return x * 5 + 5; }
+int compute_928(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_929(int x) { return x * 6 + 6; }
+int compute_929(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_930(int x) { return x * 7 + 7; }
+int compute_930(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_930(obj.sum()) + obj.get_a();
+}
+static int helper_931(int x) { return x * 1 + 8; }
+int compute_931(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_932(int x) { return x * 2 + 9; }
+int compute_932(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_933(int x) { return x * 3 + 10; }
+int compute_933(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_933(obj.sum()) + obj.get_a();
+}
+static int helper_934(int x) { return x * 4 + 11; }
+int compute_934(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_935(int x) { return x * 5 + 12; }
+int compute_935(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_936(int x) { return x * 6 + 0; }
+int compute_936(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_936(obj.sum()) + obj.get_a();
+}
+static int helper_937(int x) { return x * 7 + 1; }
+int compute_937(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_938(int x) { return x * 1 + 2; }
+int compute_938(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_939(int x) { return x * 2 + 3; }
+int compute_939(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_939(obj.sum()) + obj.get_a();
+}
+static int helper_940(int x) { return x * 3 + 4; }
+int compute_940(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_941(int x) { return x * 4 + 5; }
+int compute_941(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_942(int x) { return x * 5 + 6; }
+int compute_942(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_942(obj.sum()) + obj.get_a();
+}
+static int helper_943(int x) { return x * 6 + 7; }
+int compute_943(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_944(int x) { return x * 7 + 8; }
+int compute_944(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_945(int x) { return x * 1 + 9; }
+int compute_945(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_945(obj.sum()) + obj.get_a();
+}
+static int helper_946(int x) { return x * 2 + 10; }
+int compute_946(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_947(int x) { return x * 3 + 11; }
+int compute_947(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_948(int x) { return x * 4 + 12; }
+int compute_948(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_948(obj.sum()) + obj.get_a();
+}
+static int helper_949(int x) { return x * 5 + 0; }
+int compute_949(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_950(int x) { return x * 6 + 1; }
+int compute_950(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_951(int x) { return x * 7 + 2; }
+int compute_951(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_951(obj.sum()) + obj.get_a();
+}
+static int helper_952(int x) { return x * 1 + 3; }
+int compute_952(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_953(int x) { return x * 2 + 4; }
+int compute_953(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_954(int x) { return x * 3 + 5; }
+int compute_954(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_954(obj.sum()) + obj.get_a();
+}
+static int helper_955(int x) { return x * 4 + 6; }
+int compute_955(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_956(int x) { return x * 5 + 7; }
+int compute_956(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_957(int x) { return x * 6 + 8; }
+int compute_957(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_957(obj.sum()) + obj.get_a();
+}
+static int helper_958(int x) { return x * 7 + 9; }
+int compute_958(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_959(int x) { return x * 1 + 10; }
+int compute_959(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_960(int x) { return x * 2 + 11; }
+int compute_960(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_960(obj.sum()) + obj.get_a();
+}
+static int helper_961(int x) { return x * 3 + 12; }
+int compute_961(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_962(int x) { return x * 4 + 0; }
+int compute_962(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_963(int x) { return x * 5 + 1; }
+int compute_963(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_963(obj.sum()) + obj.get_a();
+}
+static int helper_964(int x) { return x * 6 + 2; }
+int compute_964(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_965(int x) { return x * 7 + 3; }
+int compute_965(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_966(int x) { return x * 1 + 4; }
+int compute_966(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_966(obj.sum()) + obj.get_a();
+}
+static int helper_967(int x) { return x * 2 + 5; }
+int compute_967(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_968(int x) { return x * 3 + 6; }
+int compute_968(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_969(int x) { return x * 4 + 7; }
+int compute_969(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_969(obj.sum()) + obj.get_a();
+}
+static int helper_970(int x) { return x * 5 + 8; }
+int compute_970(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_971(int x) { return x * 6 + 9; }
+int compute_971(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_972(int x) { return x * 7 + 10; }
+int compute_972(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_972(obj.sum()) + obj.get_a();
+}
+static int helper_973(int x) { return x * 1 + 11; }
+int compute_973(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_974(int x) { return x * 2 + 12; }
+int compute_974(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_975(int x) { return x * 3 + 0; }
+int compute_975(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_975(obj.sum()) + obj.get_a();
+}
+static int helper_976(int x) { return x * 4 + 1; }
+int compute_976(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_977(int x) { return x * 5 + 2; }
+int compute_977(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_978(int x) { return x * 6 + 3; }
+int compute_978(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_978(obj.sum()) + obj.get_a();
+}
+static int helper_979(int x) { return x * 7 + 4; }
+int compute_979(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_980(int x) { return x * 1 + 5; }
+int compute_980(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_981(int x) { return x * 2 + 6; }
+int compute_981(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_981(obj.sum()) + obj.get_a();
+}
+static int helper_982(int x) { return x * 3 + 7; }
+int compute_982(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_983(int x) { return x * 4 + 8; }
+int compute_983(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_984(int x) { return x * 5 + 9; }
+int compute_984(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_984(obj.sum()) + obj.get_a();
+}
+static int helper_985(int x) { return x * 6 + 10; }
+int compute_985(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_986(int x) { return x * 7 + 11; }
+int compute_986(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_987(int x) { return x * 1 + 12; }
+int compute_987(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_987(obj.sum()) + obj.get_a();
+}
+static int helper_988(int x) { return x * 2 + 0; }
+int compute_988(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_989(int x) { return x * 3 + 1; }
+int compute_989(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_990(int x) { return x * 4 + 2; }
+int compute_990(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_990(obj.sum()) + obj.get_a();
+}
+static int helper_991(int x) { return x * 5 + 3; }
+int compute_991(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_992(int x) { return x * 6 + 4; }
+int compute_992(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_993(int x) { return x * 7 + 5; }
+int compute_993(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_993(obj.sum()) + obj.get_a();
+}
+static int helper_994(int x) { return x * 1 + 6; }
+int compute_994(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_995(int x) { return x * 2 + 7; }
+int compute_995(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_996(int x) { return x * 3 + 8; }
+int compute_996(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_996(obj.sum()) + obj.get_a();
+}
+static int helper_997(int x) { return x * 4 + 9; }
+int compute_997(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_998(int x) { return x * 5 + 10; }
+int compute_998(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_999(int x) { return x * 6 + 11; }
+int compute_999(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_999(obj.sum()) + obj.get_a();
+}
+static int helper_1000(int x) { return x * 7 + 12; }
+int compute_1000(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1001(int x) { return x * 1 + 0; }
+int compute_1001(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1002(int x) { return x * 2 + 1; }
+int compute_1002(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1002(obj.sum()) + obj.get_a();
+}
+static int helper_1003(int x) { return x * 3 + 2; }
+int compute_1003(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1004(int x) { return x * 4 + 3; }
+int compute_1004(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1005(int x) { return x * 5 + 4; }
+int compute_1005(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1005(obj.sum()) + obj.get_a();
+}
+static int helper_1006(int x) { return x * 6 + 5; }
+int compute_1006(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1007(int x) { return x * 7 + 6; }
+int compute_1007(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1008(int x) { return x * 1 + 7; }
+int compute_1008(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1008(obj.sum()) + obj.get_a();
+}
+static int helper_1009(int x) { return x * 2 + 8; }
+int compute_1009(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1010(int x) { return x * 3 + 9; }
+int compute_1010(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1011(int x) { return x * 4 + 10; }
+int compute_1011(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1011(obj.sum()) + obj.get_a();
+}
+static int helper_1012(int x) { return x * 5 + 11; }
+int compute_1012(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1013(int x) { return x * 6 + 12; }
+int compute_1013(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1014(int x) { return x * 7 + 0; }
+int compute_1014(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1014(obj.sum()) + obj.get_a();
+}
+static int helper_1015(int x) { return x * 1 + 1; }
+int compute_1015(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1016(int x) { return x * 2 + 2; }
+int compute_1016(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1017(int x) { return x * 3 + 3; }
+int compute_1017(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1017(obj.sum()) + obj.get_a();
+}
+static int helper_1018(int x) { return x * 4 + 4; }
+int compute_1018(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1019(int x) { return x * 5 + 5; }
+int compute_1019(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1020(int x) { return x * 6 + 6; }
+int compute_1020(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1020(obj.sum()) + obj.get_a();
+}
+static int helper_1021(int x) { return x * 7 + 7; }
+int compute_1021(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1022(int x) { return x * 1 + 8; }
+int compute_1022(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1023(int x) { return x * 2 + 9; }
+int compute_1023(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1023(obj.sum()) + obj.get_a();
+}
+static int helper_1024(int x) { return x * 3 + 10; }
+int compute_1024(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1025(int x) { return x * 4 + 11; }
+int compute_1025(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1026(int x) { return x * 5 + 12; }
+int compute_1026(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1026(obj.sum()) + obj.get_a();
+}
+static int helper_1027(int x) { return x * 6 + 0; }
+int compute_1027(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1028(int x) { return x * 7 + 1; }
+int compute_1028(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1029(int x) { return x * 1 + 2; }
+int compute_1029(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1029(obj.sum()) + obj.get_a();
+}
+static int helper_1030(int x) { return x * 2 + 3; }
+int compute_1030(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1031(int x) { return x * 3 + 4; }
+int compute_1031(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1032(int x) { return x * 4 + 5; }
+int compute_1032(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1032(obj.sum()) + obj.get_a();
+}
+static int helper_1033(int x) { return x * 5 + 6; }
+int compute_1033(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1034(int x) { return x * 6 + 7; }
+int compute_1034(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1035(int x) { return x * 7 + 8; }
+int compute_1035(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1035(obj.sum()) + obj.get_a();
+}
+static int helper_1036(int x) { return x * 1 + 9; }
+int compute_1036(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1037(int x) { return x * 2 + 10; }
+int compute_1037(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1038(int x) { return x * 3 + 11; }
+int compute_1038(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1038(obj.sum()) + obj.get_a();
+}
+static int helper_1039(int x) { return x * 4 + 12; }
+int compute_1039(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1040(int x) { return x * 5 + 0; }
+int compute_1040(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1041(int x) { return x * 6 + 1; }
+int compute_1041(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1041(obj.sum()) + obj.get_a();
+}
+static int helper_1042(int x) { return x * 7 + 2; }
+int compute_1042(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1043(int x) { return x * 1 + 3; }
+int compute_1043(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1044(int x) { return x * 2 + 4; }
+int compute_1044(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1044(obj.sum()) + obj.get_a();
+}
+static int helper_1045(int x) { return x * 3 + 5; }
+int compute_1045(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1046(int x) { return x * 4 + 6; }
+int compute_1046(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1047(int x) { return x * 5 + 7; }
+int compute_1047(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1047(obj.sum()) + obj.get_a();
+}
+static int helper_1048(int x) { return x * 6 + 8; }
+int compute_1048(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1049(int x) { return x * 7 + 9; }
+int compute_1049(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1050(int x) { return x * 1 + 10; }
+int compute_1050(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1050(obj.sum()) + obj.get_a();
+}
+static int helper_1051(int x) { return x * 2 + 11; }
+int compute_1051(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1052(int x) { return x * 3 + 12; }
+int compute_1052(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1053(int x) { return x * 4 + 0; }
+int compute_1053(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1053(obj.sum()) + obj.get_a();
+}
+static int helper_1054(int x) { return x * 5 + 1; }
+int compute_1054(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1055(int x) { return x * 6 + 2; }
+int compute_1055(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1056(int x) { return x * 7 + 3; }
+int compute_1056(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1056(obj.sum()) + obj.get_a();
+}
+static int helper_1057(int x) { return x * 1 + 4; }
+int compute_1057(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1058(int x) { return x * 2 + 5; }
+int compute_1058(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1059(int x) { return x * 3 + 6; }
+int compute_1059(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1059(obj.sum()) + obj.get_a();
+}
+static int helper_1060(int x) { return x * 4 + 7; }
+int compute_1060(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1061(int x) { return x * 5 + 8; }
+int compute_1061(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1062(int x) { return x * 6 + 9; }
+int compute_1062(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1062(obj.sum()) + obj.get_a();
+}
+static int helper_1063(int x) { return x * 7 + 10; }
+int compute_1063(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1064(int x) { return x * 1 + 11; }
+int compute_1064(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1065(int x) { return x * 2 + 12; }
+int compute_1065(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1065(obj.sum()) + obj.get_a();
+}
+static int helper_1066(int x) { return x * 3 + 0; }
+int compute_1066(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1067(int x) { return x * 4 + 1; }
+int compute_1067(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1068(int x) { return x * 5 + 2; }
+int compute_1068(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1068(obj.sum()) + obj.get_a();
+}
+static int helper_1069(int x) { return x * 6 + 3; }
+int compute_1069(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1070(int x) { return x * 7 + 4; }
+int compute_1070(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1071(int x) { return x * 1 + 5; }
+int compute_1071(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1071(obj.sum()) + obj.get_a();
+}
+static int helper_1072(int x) { return x * 2 + 6; }
+int compute_1072(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1073(int x) { return x * 3 + 7; }
+int compute_1073(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1074(int x) { return x * 4 + 8; }
+int compute_1074(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1074(obj.sum()) + obj.get_a();
+}
+static int helper_1075(int x) { return x * 5 + 9; }
+int compute_1075(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1076(int x) { return x * 6 + 10; }
+int compute_1076(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1077(int x) { return x * 7 + 11; }
+int compute_1077(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1077(obj.sum()) + obj.get_a();
+}
+static int helper_1078(int x) { return x * 1 + 12; }
+int compute_1078(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1079(int x) { return x * 2 + 0; }
+int compute_1079(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1080(int x) { return x * 3 + 1; }
+int compute_1080(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1080(obj.sum()) + obj.get_a();
+}
+static int helper_1081(int x) { return x * 4 + 2; }
+int compute_1081(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1082(int x) { return x * 5 + 3; }
+int compute_1082(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1083(int x) { return x * 6 + 4; }
+int compute_1083(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1083(obj.sum()) + obj.get_a();
+}
+static int helper_1084(int x) { return x * 7 + 5; }
+int compute_1084(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1085(int x) { return x * 1 + 6; }
+int compute_1085(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1086(int x) { return x * 2 + 7; }
+int compute_1086(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1086(obj.sum()) + obj.get_a();
+}
+static int helper_1087(int x) { return x * 3 + 8; }
+int compute_1087(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1088(int x) { return x * 4 + 9; }
+int compute_1088(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1089(int x) { return x * 5 + 10; }
+int compute_1089(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1089(obj.sum()) + obj.get_a();
+}
+static int helper_1090(int x) { return x * 6 + 11; }
+int compute_1090(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1091(int x) { return x * 7 + 12; }
+int compute_1091(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1092(int x) { return x * 1 + 0; }
+int compute_1092(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1092(obj.sum()) + obj.get_a();
+}
+static int helper_1093(int x) { return x * 2 + 1; }
+int compute_1093(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1094(int x) { return x * 3 + 2; }
+int compute_1094(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1095(int x) { return x * 4 + 3; }
+int compute_1095(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1095(obj.sum()) + obj.get_a();
+}
+static int helper_1096(int x) { return x * 5 + 4; }
+int compute_1096(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1097(int x) { return x * 6 + 5; }
+int compute_1097(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1098(int x) { return x * 7 + 6; }
+int compute_1098(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1098(obj.sum()) + obj.get_a();
+}
+static int helper_1099(int x) { return x * 1 + 7; }
+int compute_1099(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1100(int x) { return x * 2 + 8; }
+int compute_1100(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1101(int x) { return x * 3 + 9; }
+int compute_1101(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1101(obj.sum()) + obj.get_a();
+}
+static int helper_1102(int x) { return x * 4 + 10; }
+int compute_1102(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1103(int x) { return x * 5 + 11; }
+int compute_1103(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1104(int x) { return x * 6 + 12; }
+int compute_1104(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1104(obj.sum()) + obj.get_a();
+}
+static int helper_1105(int x) { return x * 7 + 0; }
+int compute_1105(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1106(int x) { return x * 1 + 1; }
+int compute_1106(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1107(int x) { return x * 2 + 2; }
+int compute_1107(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1107(obj.sum()) + obj.get_a();
+}
+static int helper_1108(int x) { return x * 3 + 3; }
+int compute_1108(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1109(int x) { return x * 4 + 4; }
+int compute_1109(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1110(int x) { return x * 5 + 5; }
+int compute_1110(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1110(obj.sum()) + obj.get_a();
+}
+static int helper_1111(int x) { return x * 6 + 6; }
+int compute_1111(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1112(int x) { return x * 7 + 7; }
+int compute_1112(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1113(int x) { return x * 1 + 8; }
+int compute_1113(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1113(obj.sum()) + obj.get_a();
+}
+static int helper_1114(int x) { return x * 2 + 9; }
+int compute_1114(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1115(int x) { return x * 3 + 10; }
+int compute_1115(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1116(int x) { return x * 4 + 11; }
+int compute_1116(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1116(obj.sum()) + obj.get_a();
+}
+static int helper_1117(int x) { return x * 5 + 12; }
+int compute_1117(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1118(int x) { return x * 6 + 0; }
+int compute_1118(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1119(int x) { return x * 7 + 1; }
+int compute_1119(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1119(obj.sum()) + obj.get_a();
+}
+static int helper_1120(int x) { return x * 1 + 2; }
+int compute_1120(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1121(int x) { return x * 2 + 3; }
+int compute_1121(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1122(int x) { return x * 3 + 4; }
+int compute_1122(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1122(obj.sum()) + obj.get_a();
+}
+static int helper_1123(int x) { return x * 4 + 5; }
+int compute_1123(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1124(int x) { return x * 5 + 6; }
+int compute_1124(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1125(int x) { return x * 6 + 7; }
+int compute_1125(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1125(obj.sum()) + obj.get_a();
+}
+static int helper_1126(int x) { return x * 7 + 8; }
+int compute_1126(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1127(int x) { return x * 1 + 9; }
+int compute_1127(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1128(int x) { return x * 2 + 10; }
+int compute_1128(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1128(obj.sum()) + obj.get_a();
+}
+static int helper_1129(int x) { return x * 3 + 11; }
+int compute_1129(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1130(int x) { return x * 4 + 12; }
+int compute_1130(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1131(int x) { return x * 5 + 0; }
+int compute_1131(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1131(obj.sum()) + obj.get_a();
+}
+static int helper_1132(int x) { return x * 6 + 1; }
+int compute_1132(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1133(int x) { return x * 7 + 2; }
+int compute_1133(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1134(int x) { return x * 1 + 3; }
+int compute_1134(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1134(obj.sum()) + obj.get_a();
+}
+static int helper_1135(int x) { return x * 2 + 4; }
+int compute_1135(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1136(int x) { return x * 3 + 5; }
+int compute_1136(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1137(int x) { return x * 4 + 6; }
+int compute_1137(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1137(obj.sum()) + obj.get_a();
+}
+static int helper_1138(int x) { return x * 5 + 7; }
+int compute_1138(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1139(int x) { return x * 6 + 8; }
+int compute_1139(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1140(int x) { return x * 7 + 9; }
+int compute_1140(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1140(obj.sum()) + obj.get_a();
+}
+static int helper_1141(int x) { return x * 1 + 10; }
+int compute_1141(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1142(int x) { return x * 2 + 11; }
+int compute_1142(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1143(int x) { return x * 3 + 12; }
+int compute_1143(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1143(obj.sum()) + obj.get_a();
+}
+static int helper_1144(int x) { return x * 4 + 0; }
+int compute_1144(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1145(int x) { return x * 5 + 1; }
+int compute_1145(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1146(int x) { return x * 6 + 2; }
+int compute_1146(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1146(obj.sum()) + obj.get_a();
+}
+static int helper_1147(int x) { return x * 7 + 3; }
+int compute_1147(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1148(int x) { return x * 1 + 4; }
+int compute_1148(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1149(int x) { return x * 2 + 5; }
+int compute_1149(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1149(obj.sum()) + obj.get_a();
+}
+static int helper_1150(int x) { return x * 3 + 6; }
+int compute_1150(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1151(int x) { return x * 4 + 7; }
+int compute_1151(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1152(int x) { return x * 5 + 8; }
+int compute_1152(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1152(obj.sum()) + obj.get_a();
+}
+static int helper_1153(int x) { return x * 6 + 9; }
+int compute_1153(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1154(int x) { return x * 7 + 10; }
+int compute_1154(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1155(int x) { return x * 1 + 11; }
+int compute_1155(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1155(obj.sum()) + obj.get_a();
+}
+static int helper_1156(int x) { return x * 2 + 12; }
+int compute_1156(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1157(int x) { return x * 3 + 0; }
+int compute_1157(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1158(int x) { return x * 4 + 1; }
+int compute_1158(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1158(obj.sum()) + obj.get_a();
+}
+static int helper_1159(int x) { return x * 5 + 2; }
+int compute_1159(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1160(int x) { return x * 6 + 3; }
+int compute_1160(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1161(int x) { return x * 7 + 4; }
+int compute_1161(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1161(obj.sum()) + obj.get_a();
+}
+static int helper_1162(int x) { return x * 1 + 5; }
+int compute_1162(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1163(int x) { return x * 2 + 6; }
+int compute_1163(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1164(int x) { return x * 3 + 7; }
+int compute_1164(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1164(obj.sum()) + obj.get_a();
+}
+static int helper_1165(int x) { return x * 4 + 8; }
+int compute_1165(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1166(int x) { return x * 5 + 9; }
+int compute_1166(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1167(int x) { return x * 6 + 10; }
+int compute_1167(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1167(obj.sum()) + obj.get_a();
+}
+static int helper_1168(int x) { return x * 7 + 11; }
+int compute_1168(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1169(int x) { return x * 1 + 12; }
+int compute_1169(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1170(int x) { return x * 2 + 0; }
+int compute_1170(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1170(obj.sum()) + obj.get_a();
+}
+static int helper_1171(int x) { return x * 3 + 1; }
+int compute_1171(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1172(int x) { return x * 4 + 2; }
+int compute_1172(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1173(int x) { return x * 5 + 3; }
+int compute_1173(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1173(obj.sum()) + obj.get_a();
+}
+static int helper_1174(int x) { return x * 6 + 4; }
+int compute_1174(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1175(int x) { return x * 7 + 5; }
+int compute_1175(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1176(int x) { return x * 1 + 6; }
+int compute_1176(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1176(obj.sum()) + obj.get_a();
+}
+static int helper_1177(int x) { return x * 2 + 7; }
+int compute_1177(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1178(int x) { return x * 3 + 8; }
+int compute_1178(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1179(int x) { return x * 4 + 9; }
+int compute_1179(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1179(obj.sum()) + obj.get_a();
+}
+static int helper_1180(int x) { return x * 5 + 10; }
+int compute_1180(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1181(int x) { return x * 6 + 11; }
+int compute_1181(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1182(int x) { return x * 7 + 12; }
+int compute_1182(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1182(obj.sum()) + obj.get_a();
+}
+static int helper_1183(int x) { return x * 1 + 0; }
+int compute_1183(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1184(int x) { return x * 2 + 1; }
+int compute_1184(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1185(int x) { return x * 3 + 2; }
+int compute_1185(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1185(obj.sum()) + obj.get_a();
+}
+static int helper_1186(int x) { return x * 4 + 3; }
+int compute_1186(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1187(int x) { return x * 5 + 4; }
+int compute_1187(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1188(int x) { return x * 6 + 5; }
+int compute_1188(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1188(obj.sum()) + obj.get_a();
+}
+static int helper_1189(int x) { return x * 7 + 6; }
+int compute_1189(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1190(int x) { return x * 1 + 7; }
+int compute_1190(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1191(int x) { return x * 2 + 8; }
+int compute_1191(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1191(obj.sum()) + obj.get_a();
+}
+static int helper_1192(int x) { return x * 3 + 9; }
+int compute_1192(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1193(int x) { return x * 4 + 10; }
+int compute_1193(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1194(int x) { return x * 5 + 11; }
+int compute_1194(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1194(obj.sum()) + obj.get_a();
+}
+static int helper_1195(int x) { return x * 6 + 12; }
+int compute_1195(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1196(int x) { return x * 7 + 0; }
+int compute_1196(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1197(int x) { return x * 1 + 1; }
+int compute_1197(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1197(obj.sum()) + obj.get_a();
+}
+static int helper_1198(int x) { return x * 2 + 2; }
+int compute_1198(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1199(int x) { return x * 3 + 3; }
+int compute_1199(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1200(int x) { return x * 4 + 4; }
+int compute_1200(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1200(obj.sum()) + obj.get_a();
+}
+static int helper_1201(int x) { return x * 5 + 5; }
+int compute_1201(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1202(int x) { return x * 6 + 6; }
+int compute_1202(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1203(int x) { return x * 7 + 7; }
+int compute_1203(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1203(obj.sum()) + obj.get_a();
+}
+static int helper_1204(int x) { return x * 1 + 8; }
+int compute_1204(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1205(int x) { return x * 2 + 9; }
+int compute_1205(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1206(int x) { return x * 3 + 10; }
+int compute_1206(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1206(obj.sum()) + obj.get_a();
+}
+static int helper_1207(int x) { return x * 4 + 11; }
+int compute_1207(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1208(int x) { return x * 5 + 12; }
+int compute_1208(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1209(int x) { return x * 6 + 0; }
+int compute_1209(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1209(obj.sum()) + obj.get_a();
+}
+static int helper_1210(int x) { return x * 7 + 1; }
+int compute_1210(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1211(int x) { return x * 1 + 2; }
+int compute_1211(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1212(int x) { return x * 2 + 3; }
+int compute_1212(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1212(obj.sum()) + obj.get_a();
+}
+static int helper_1213(int x) { return x * 3 + 4; }
+int compute_1213(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1214(int x) { return x * 4 + 5; }
+int compute_1214(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1215(int x) { return x * 5 + 6; }
+int compute_1215(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1215(obj.sum()) + obj.get_a();
+}
+static int helper_1216(int x) { return x * 6 + 7; }
+int compute_1216(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1217(int x) { return x * 7 + 8; }
+int compute_1217(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1218(int x) { return x * 1 + 9; }
+int compute_1218(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1218(obj.sum()) + obj.get_a();
+}
+static int helper_1219(int x) { return x * 2 + 10; }
+int compute_1219(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1220(int x) { return x * 3 + 11; }
+int compute_1220(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1221(int x) { return x * 4 + 12; }
+int compute_1221(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1221(obj.sum()) + obj.get_a();
+}
+static int helper_1222(int x) { return x * 5 + 0; }
+int compute_1222(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1223(int x) { return x * 6 + 1; }
+int compute_1223(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1224(int x) { return x * 7 + 2; }
+int compute_1224(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1224(obj.sum()) + obj.get_a();
+}
+static int helper_1225(int x) { return x * 1 + 3; }
+int compute_1225(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1226(int x) { return x * 2 + 4; }
+int compute_1226(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1227(int x) { return x * 3 + 5; }
+int compute_1227(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1227(obj.sum()) + obj.get_a();
+}
+static int helper_1228(int x) { return x * 4 + 6; }
+int compute_1228(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1229(int x) { return x * 5 + 7; }
+int compute_1229(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1230(int x) { return x * 6 + 8; }
+int compute_1230(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1230(obj.sum()) + obj.get_a();
+}
+static int helper_1231(int x) { return x * 7 + 9; }
+int compute_1231(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1232(int x) { return x * 1 + 10; }
+int compute_1232(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1233(int x) { return x * 2 + 11; }
+int compute_1233(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1233(obj.sum()) + obj.get_a();
+}
+static int helper_1234(int x) { return x * 3 + 12; }
+int compute_1234(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1235(int x) { return x * 4 + 0; }
+int compute_1235(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1236(int x) { return x * 5 + 1; }
+int compute_1236(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1236(obj.sum()) + obj.get_a();
+}
+static int helper_1237(int x) { return x * 6 + 2; }
+int compute_1237(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1238(int x) { return x * 7 + 3; }
+int compute_1238(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1239(int x) { return x * 1 + 4; }
+int compute_1239(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1239(obj.sum()) + obj.get_a();
+}
+static int helper_1240(int x) { return x * 2 + 5; }
+int compute_1240(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1241(int x) { return x * 3 + 6; }
+int compute_1241(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1242(int x) { return x * 4 + 7; }
+int compute_1242(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1242(obj.sum()) + obj.get_a();
+}
+static int helper_1243(int x) { return x * 5 + 8; }
+int compute_1243(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1244(int x) { return x * 6 + 9; }
+int compute_1244(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1245(int x) { return x * 7 + 10; }
+int compute_1245(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1245(obj.sum()) + obj.get_a();
+}
+static int helper_1246(int x) { return x * 1 + 11; }
+int compute_1246(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1247(int x) { return x * 2 + 12; }
+int compute_1247(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1248(int x) { return x * 3 + 0; }
+int compute_1248(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1248(obj.sum()) + obj.get_a();
+}
+static int helper_1249(int x) { return x * 4 + 1; }
+int compute_1249(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1250(int x) { return x * 5 + 2; }
+int compute_1250(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1251(int x) { return x * 6 + 3; }
+int compute_1251(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1251(obj.sum()) + obj.get_a();
+}
+static int helper_1252(int x) { return x * 7 + 4; }
+int compute_1252(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1253(int x) { return x * 1 + 5; }
+int compute_1253(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1254(int x) { return x * 2 + 6; }
+int compute_1254(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1254(obj.sum()) + obj.get_a();
+}
+static int helper_1255(int x) { return x * 3 + 7; }
+int compute_1255(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1256(int x) { return x * 4 + 8; }
+int compute_1256(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1257(int x) { return x * 5 + 9; }
+int compute_1257(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1257(obj.sum()) + obj.get_a();
+}
+static int helper_1258(int x) { return x * 6 + 10; }
+int compute_1258(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1259(int x) { return x * 7 + 11; }
+int compute_1259(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1260(int x) { return x * 1 + 12; }
+int compute_1260(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1260(obj.sum()) + obj.get_a();
+}
+static int helper_1261(int x) { return x * 2 + 0; }
+int compute_1261(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1262(int x) { return x * 3 + 1; }
+int compute_1262(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1263(int x) { return x * 4 + 2; }
+int compute_1263(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1263(obj.sum()) + obj.get_a();
+}
+static int helper_1264(int x) { return x * 5 + 3; }
+int compute_1264(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1265(int x) { return x * 6 + 4; }
+int compute_1265(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1266(int x) { return x * 7 + 5; }
+int compute_1266(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1266(obj.sum()) + obj.get_a();
+}
+static int helper_1267(int x) { return x * 1 + 6; }
+int compute_1267(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1268(int x) { return x * 2 + 7; }
+int compute_1268(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1269(int x) { return x * 3 + 8; }
+int compute_1269(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1269(obj.sum()) + obj.get_a();
+}
+static int helper_1270(int x) { return x * 4 + 9; }
+int compute_1270(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1271(int x) { return x * 5 + 10; }
+int compute_1271(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1272(int x) { return x * 6 + 11; }
+int compute_1272(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1272(obj.sum()) + obj.get_a();
+}
+static int helper_1273(int x) { return x * 7 + 12; }
+int compute_1273(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1274(int x) { return x * 1 + 0; }
+int compute_1274(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1275(int x) { return x * 2 + 1; }
+int compute_1275(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1275(obj.sum()) + obj.get_a();
+}
+static int helper_1276(int x) { return x * 3 + 2; }
+int compute_1276(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1277(int x) { return x * 4 + 3; }
+int compute_1277(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1278(int x) { return x * 5 + 4; }
+int compute_1278(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1278(obj.sum()) + obj.get_a();
+}
+static int helper_1279(int x) { return x * 6 + 5; }
+int compute_1279(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1280(int x) { return x * 7 + 6; }
+int compute_1280(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1281(int x) { return x * 1 + 7; }
+int compute_1281(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1281(obj.sum()) + obj.get_a();
+}
+static int helper_1282(int x) { return x * 2 + 8; }
+int compute_1282(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1283(int x) { return x * 3 + 9; }
+int compute_1283(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1284(int x) { return x * 4 + 10; }
+int compute_1284(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1284(obj.sum()) + obj.get_a();
+}
+static int helper_1285(int x) { return x * 5 + 11; }
+int compute_1285(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1286(int x) { return x * 6 + 12; }
+int compute_1286(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1287(int x) { return x * 7 + 0; }
+int compute_1287(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1287(obj.sum()) + obj.get_a();
+}
+static int helper_1288(int x) { return x * 1 + 1; }
+int compute_1288(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1289(int x) { return x * 2 + 2; }
+int compute_1289(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1290(int x) { return x * 3 + 3; }
+int compute_1290(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1290(obj.sum()) + obj.get_a();
+}
+static int helper_1291(int x) { return x * 4 + 4; }
+int compute_1291(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1292(int x) { return x * 5 + 5; }
+int compute_1292(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1293(int x) { return x * 6 + 6; }
+int compute_1293(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1293(obj.sum()) + obj.get_a();
+}
+static int helper_1294(int x) { return x * 7 + 7; }
+int compute_1294(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1295(int x) { return x * 1 + 8; }
+int compute_1295(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1296(int x) { return x * 2 + 9; }
+int compute_1296(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1296(obj.sum()) + obj.get_a();
+}
+static int helper_1297(int x) { return x * 3 + 10; }
+int compute_1297(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1298(int x) { return x * 4 + 11; }
+int compute_1298(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1299(int x) { return x * 5 + 12; }
+int compute_1299(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1299(obj.sum()) + obj.get_a();
+}
+static int helper_1300(int x) { return x * 6 + 0; }
+int compute_1300(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1301(int x) { return x * 7 + 1; }
+int compute_1301(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1302(int x) { return x * 1 + 2; }
+int compute_1302(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1302(obj.sum()) + obj.get_a();
+}
+static int helper_1303(int x) { return x * 2 + 3; }
+int compute_1303(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1304(int x) { return x * 3 + 4; }
+int compute_1304(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1305(int x) { return x * 4 + 5; }
+int compute_1305(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1305(obj.sum()) + obj.get_a();
+}
+static int helper_1306(int x) { return x * 5 + 6; }
+int compute_1306(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1307(int x) { return x * 6 + 7; }
+int compute_1307(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1308(int x) { return x * 7 + 8; }
+int compute_1308(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1308(obj.sum()) + obj.get_a();
+}
+static int helper_1309(int x) { return x * 1 + 9; }
+int compute_1309(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1310(int x) { return x * 2 + 10; }
+int compute_1310(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1311(int x) { return x * 3 + 11; }
+int compute_1311(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1311(obj.sum()) + obj.get_a();
+}
+static int helper_1312(int x) { return x * 4 + 12; }
+int compute_1312(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1313(int x) { return x * 5 + 0; }
+int compute_1313(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1314(int x) { return x * 6 + 1; }
+int compute_1314(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1314(obj.sum()) + obj.get_a();
+}
+static int helper_1315(int x) { return x * 7 + 2; }
+int compute_1315(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1316(int x) { return x * 1 + 3; }
+int compute_1316(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1317(int x) { return x * 2 + 4; }
+int compute_1317(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1317(obj.sum()) + obj.get_a();
+}
+static int helper_1318(int x) { return x * 3 + 5; }
+int compute_1318(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1319(int x) { return x * 4 + 6; }
+int compute_1319(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1320(int x) { return x * 5 + 7; }
+int compute_1320(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1320(obj.sum()) + obj.get_a();
+}
+static int helper_1321(int x) { return x * 6 + 8; }
+int compute_1321(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1322(int x) { return x * 7 + 9; }
+int compute_1322(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1323(int x) { return x * 1 + 10; }
+int compute_1323(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1323(obj.sum()) + obj.get_a();
+}
+static int helper_1324(int x) { return x * 2 + 11; }
+int compute_1324(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1325(int x) { return x * 3 + 12; }
+int compute_1325(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1326(int x) { return x * 4 + 0; }
+int compute_1326(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1326(obj.sum()) + obj.get_a();
+}
+static int helper_1327(int x) { return x * 5 + 1; }
+int compute_1327(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1328(int x) { return x * 6 + 2; }
+int compute_1328(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1329(int x) { return x * 7 + 3; }
+int compute_1329(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1329(obj.sum()) + obj.get_a();
+}
+static int helper_1330(int x) { return x * 1 + 4; }
+int compute_1330(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1331(int x) { return x * 2 + 5; }
+int compute_1331(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1332(int x) { return x * 3 + 6; }
+int compute_1332(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1332(obj.sum()) + obj.get_a();
+}
+static int helper_1333(int x) { return x * 4 + 7; }
+int compute_1333(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1334(int x) { return x * 5 + 8; }
+int compute_1334(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1335(int x) { return x * 6 + 9; }
+int compute_1335(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1335(obj.sum()) + obj.get_a();
+}
+static int helper_1336(int x) { return x * 7 + 10; }
+int compute_1336(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1337(int x) { return x * 1 + 11; }
+int compute_1337(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1338(int x) { return x * 2 + 12; }
+int compute_1338(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1338(obj.sum()) + obj.get_a();
+}
+static int helper_1339(int x) { return x * 3 + 0; }
+int compute_1339(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1340(int x) { return x * 4 + 1; }
+int compute_1340(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1341(int x) { return x * 5 + 2; }
+int compute_1341(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1341(obj.sum()) + obj.get_a();
+}
+static int helper_1342(int x) { return x * 6 + 3; }
+int compute_1342(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1343(int x) { return x * 7 + 4; }
+int compute_1343(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1344(int x) { return x * 1 + 5; }
+int compute_1344(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1344(obj.sum()) + obj.get_a();
+}
+static int helper_1345(int x) { return x * 2 + 6; }
+int compute_1345(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1346(int x) { return x * 3 + 7; }
+int compute_1346(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1347(int x) { return x * 4 + 8; }
+int compute_1347(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1347(obj.sum()) + obj.get_a();
+}
+static int helper_1348(int x) { return x * 5 + 9; }
+int compute_1348(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1349(int x) { return x * 6 + 10; }
+int compute_1349(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1350(int x) { return x * 7 + 11; }
+int compute_1350(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1350(obj.sum()) + obj.get_a();
+}
+static int helper_1351(int x) { return x * 1 + 12; }
+int compute_1351(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1352(int x) { return x * 2 + 0; }
+int compute_1352(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1353(int x) { return x * 3 + 1; }
+int compute_1353(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1353(obj.sum()) + obj.get_a();
+}
+static int helper_1354(int x) { return x * 4 + 2; }
+int compute_1354(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1355(int x) { return x * 5 + 3; }
+int compute_1355(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1356(int x) { return x * 6 + 4; }
+int compute_1356(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1356(obj.sum()) + obj.get_a();
+}
+static int helper_1357(int x) { return x * 7 + 5; }
+int compute_1357(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1358(int x) { return x * 1 + 6; }
+int compute_1358(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1359(int x) { return x * 2 + 7; }
+int compute_1359(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1359(obj.sum()) + obj.get_a();
+}
+static int helper_1360(int x) { return x * 3 + 8; }
+int compute_1360(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1361(int x) { return x * 4 + 9; }
+int compute_1361(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1362(int x) { return x * 5 + 10; }
+int compute_1362(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1362(obj.sum()) + obj.get_a();
+}
+static int helper_1363(int x) { return x * 6 + 11; }
+int compute_1363(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1364(int x) { return x * 7 + 12; }
+int compute_1364(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1365(int x) { return x * 1 + 0; }
+int compute_1365(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1365(obj.sum()) + obj.get_a();
+}
+static int helper_1366(int x) { return x * 2 + 1; }
+int compute_1366(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1367(int x) { return x * 3 + 2; }
+int compute_1367(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1368(int x) { return x * 4 + 3; }
+int compute_1368(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1368(obj.sum()) + obj.get_a();
+}
+static int helper_1369(int x) { return x * 5 + 4; }
+int compute_1369(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1370(int x) { return x * 6 + 5; }
+int compute_1370(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1371(int x) { return x * 7 + 6; }
+int compute_1371(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1371(obj.sum()) + obj.get_a();
+}
+static int helper_1372(int x) { return x * 1 + 7; }
+int compute_1372(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1373(int x) { return x * 2 + 8; }
+int compute_1373(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1374(int x) { return x * 3 + 9; }
+int compute_1374(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1374(obj.sum()) + obj.get_a();
+}
+static int helper_1375(int x) { return x * 4 + 10; }
+int compute_1375(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1376(int x) { return x * 5 + 11; }
+int compute_1376(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1377(int x) { return x * 6 + 12; }
+int compute_1377(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1377(obj.sum()) + obj.get_a();
+}
+static int helper_1378(int x) { return x * 7 + 0; }
+int compute_1378(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1379(int x) { return x * 1 + 1; }
+int compute_1379(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1380(int x) { return x * 2 + 2; }
+int compute_1380(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1380(obj.sum()) + obj.get_a();
+}
+static int helper_1381(int x) { return x * 3 + 3; }
+int compute_1381(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1382(int x) { return x * 4 + 4; }
+int compute_1382(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1383(int x) { return x * 5 + 5; }
+int compute_1383(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1383(obj.sum()) + obj.get_a();
+}
+static int helper_1384(int x) { return x * 6 + 6; }
+int compute_1384(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1385(int x) { return x * 7 + 7; }
+int compute_1385(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1386(int x) { return x * 1 + 8; }
+int compute_1386(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1386(obj.sum()) + obj.get_a();
+}
+static int helper_1387(int x) { return x * 2 + 9; }
+int compute_1387(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1388(int x) { return x * 3 + 10; }
+int compute_1388(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1389(int x) { return x * 4 + 11; }
+int compute_1389(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1389(obj.sum()) + obj.get_a();
+}
+static int helper_1390(int x) { return x * 5 + 12; }
+int compute_1390(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1391(int x) { return x * 6 + 0; }
+int compute_1391(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1392(int x) { return x * 7 + 1; }
+int compute_1392(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1392(obj.sum()) + obj.get_a();
+}
+static int helper_1393(int x) { return x * 1 + 2; }
+int compute_1393(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1394(int x) { return x * 2 + 3; }
+int compute_1394(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1395(int x) { return x * 3 + 4; }
+int compute_1395(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1395(obj.sum()) + obj.get_a();
+}
+static int helper_1396(int x) { return x * 4 + 5; }
+int compute_1396(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1397(int x) { return x * 5 + 6; }
+int compute_1397(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1398(int x) { return x * 6 + 7; }
+int compute_1398(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1398(obj.sum()) + obj.get_a();
+}
+static int helper_1399(int x) { return x * 7 + 8; }
+int compute_1399(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1400(int x) { return x * 1 + 9; }
+int compute_1400(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1401(int x) { return x * 2 + 10; }
+int compute_1401(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1401(obj.sum()) + obj.get_a();
+}
+static int helper_1402(int x) { return x * 3 + 11; }
+int compute_1402(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1403(int x) { return x * 4 + 12; }
+int compute_1403(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1404(int x) { return x * 5 + 0; }
+int compute_1404(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1404(obj.sum()) + obj.get_a();
+}
+static int helper_1405(int x) { return x * 6 + 1; }
+int compute_1405(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1406(int x) { return x * 7 + 2; }
+int compute_1406(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1407(int x) { return x * 1 + 3; }
+int compute_1407(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1407(obj.sum()) + obj.get_a();
+}
+static int helper_1408(int x) { return x * 2 + 4; }
+int compute_1408(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1409(int x) { return x * 3 + 5; }
+int compute_1409(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1410(int x) { return x * 4 + 6; }
+int compute_1410(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1410(obj.sum()) + obj.get_a();
+}
+static int helper_1411(int x) { return x * 5 + 7; }
+int compute_1411(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1412(int x) { return x * 6 + 8; }
+int compute_1412(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1413(int x) { return x * 7 + 9; }
+int compute_1413(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1413(obj.sum()) + obj.get_a();
+}
+static int helper_1414(int x) { return x * 1 + 10; }
+int compute_1414(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1415(int x) { return x * 2 + 11; }
+int compute_1415(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1416(int x) { return x * 3 + 12; }
+int compute_1416(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1416(obj.sum()) + obj.get_a();
+}
+static int helper_1417(int x) { return x * 4 + 0; }
+int compute_1417(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1418(int x) { return x * 5 + 1; }
+int compute_1418(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1419(int x) { return x * 6 + 2; }
+int compute_1419(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1419(obj.sum()) + obj.get_a();
+}
+static int helper_1420(int x) { return x * 7 + 3; }
+int compute_1420(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1421(int x) { return x * 1 + 4; }
+int compute_1421(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1422(int x) { return x * 2 + 5; }
+int compute_1422(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1422(obj.sum()) + obj.get_a();
+}
+static int helper_1423(int x) { return x * 3 + 6; }
+int compute_1423(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1424(int x) { return x * 4 + 7; }
+int compute_1424(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1425(int x) { return x * 5 + 8; }
+int compute_1425(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1425(obj.sum()) + obj.get_a();
+}
+static int helper_1426(int x) { return x * 6 + 9; }
+int compute_1426(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1427(int x) { return x * 7 + 10; }
+int compute_1427(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1428(int x) { return x * 1 + 11; }
+int compute_1428(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1428(obj.sum()) + obj.get_a();
+}
+static int helper_1429(int x) { return x * 2 + 12; }
+int compute_1429(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1430(int x) { return x * 3 + 0; }
+int compute_1430(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1431(int x) { return x * 4 + 1; }
+int compute_1431(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1431(obj.sum()) + obj.get_a();
+}
+static int helper_1432(int x) { return x * 5 + 2; }
+int compute_1432(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1433(int x) { return x * 6 + 3; }
+int compute_1433(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1434(int x) { return x * 7 + 4; }
+int compute_1434(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1434(obj.sum()) + obj.get_a();
+}
+static int helper_1435(int x) { return x * 1 + 5; }
+int compute_1435(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1436(int x) { return x * 2 + 6; }
+int compute_1436(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1437(int x) { return x * 3 + 7; }
+int compute_1437(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1437(obj.sum()) + obj.get_a();
+}
+static int helper_1438(int x) { return x * 4 + 8; }
+int compute_1438(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1439(int x) { return x * 5 + 9; }
+int compute_1439(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1440(int x) { return x * 6 + 10; }
+int compute_1440(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1440(obj.sum()) + obj.get_a();
+}
+static int helper_1441(int x) { return x * 7 + 11; }
+int compute_1441(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1442(int x) { return x * 1 + 12; }
+int compute_1442(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1443(int x) { return x * 2 + 0; }
+int compute_1443(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1443(obj.sum()) + obj.get_a();
+}
+static int helper_1444(int x) { return x * 3 + 1; }
+int compute_1444(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1445(int x) { return x * 4 + 2; }
+int compute_1445(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1446(int x) { return x * 5 + 3; }
+int compute_1446(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1446(obj.sum()) + obj.get_a();
+}
+static int helper_1447(int x) { return x * 6 + 4; }
+int compute_1447(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1448(int x) { return x * 7 + 5; }
+int compute_1448(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1449(int x) { return x * 1 + 6; }
+int compute_1449(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1449(obj.sum()) + obj.get_a();
+}
+static int helper_1450(int x) { return x * 2 + 7; }
+int compute_1450(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1451(int x) { return x * 3 + 8; }
+int compute_1451(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1452(int x) { return x * 4 + 9; }
+int compute_1452(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1452(obj.sum()) + obj.get_a();
+}
+static int helper_1453(int x) { return x * 5 + 10; }
+int compute_1453(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1454(int x) { return x * 6 + 11; }
+int compute_1454(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1455(int x) { return x * 7 + 12; }
+int compute_1455(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1455(obj.sum()) + obj.get_a();
+}
+static int helper_1456(int x) { return x * 1 + 0; }
+int compute_1456(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1457(int x) { return x * 2 + 1; }
+int compute_1457(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1458(int x) { return x * 3 + 2; }
+int compute_1458(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1458(obj.sum()) + obj.get_a();
+}
+static int helper_1459(int x) { return x * 4 + 3; }
+int compute_1459(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1460(int x) { return x * 5 + 4; }
+int compute_1460(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1461(int x) { return x * 6 + 5; }
+int compute_1461(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1461(obj.sum()) + obj.get_a();
+}
+static int helper_1462(int x) { return x * 7 + 6; }
+int compute_1462(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1463(int x) { return x * 1 + 7; }
+int compute_1463(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1464(int x) { return x * 2 + 8; }
+int compute_1464(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1464(obj.sum()) + obj.get_a();
+}
+static int helper_1465(int x) { return x * 3 + 9; }
+int compute_1465(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1466(int x) { return x * 4 + 10; }
+int compute_1466(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1467(int x) { return x * 5 + 11; }
+int compute_1467(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1467(obj.sum()) + obj.get_a();
+}
+static int helper_1468(int x) { return x * 6 + 12; }
+int compute_1468(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1469(int x) { return x * 7 + 0; }
+int compute_1469(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1470(int x) { return x * 1 + 1; }
+int compute_1470(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1470(obj.sum()) + obj.get_a();
+}
+static int helper_1471(int x) { return x * 2 + 2; }
+int compute_1471(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1472(int x) { return x * 3 + 3; }
+int compute_1472(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1473(int x) { return x * 4 + 4; }
+int compute_1473(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1473(obj.sum()) + obj.get_a();
+}
+static int helper_1474(int x) { return x * 5 + 5; }
+int compute_1474(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1475(int x) { return x * 6 + 6; }
+int compute_1475(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1476(int x) { return x * 7 + 7; }
+int compute_1476(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1476(obj.sum()) + obj.get_a();
+}
+static int helper_1477(int x) { return x * 1 + 8; }
+int compute_1477(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1478(int x) { return x * 2 + 9; }
+int compute_1478(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1479(int x) { return x * 3 + 10; }
+int compute_1479(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1479(obj.sum()) + obj.get_a();
+}
+static int helper_1480(int x) { return x * 4 + 11; }
+int compute_1480(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1481(int x) { return x * 5 + 12; }
+int compute_1481(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1482(int x) { return x * 6 + 0; }
+int compute_1482(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1482(obj.sum()) + obj.get_a();
+}
+static int helper_1483(int x) { return x * 7 + 1; }
+int compute_1483(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1484(int x) { return x * 1 + 2; }
+int compute_1484(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1485(int x) { return x * 2 + 3; }
+int compute_1485(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1485(obj.sum()) + obj.get_a();
+}
+static int helper_1486(int x) { return x * 3 + 4; }
+int compute_1486(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1487(int x) { return x * 4 + 5; }
+int compute_1487(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1488(int x) { return x * 5 + 6; }
+int compute_1488(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1488(obj.sum()) + obj.get_a();
+}
+static int helper_1489(int x) { return x * 6 + 7; }
+int compute_1489(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1490(int x) { return x * 7 + 8; }
+int compute_1490(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1491(int x) { return x * 1 + 9; }
+int compute_1491(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1491(obj.sum()) + obj.get_a();
+}
+static int helper_1492(int x) { return x * 2 + 10; }
+int compute_1492(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1493(int x) { return x * 3 + 11; }
+int compute_1493(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1494(int x) { return x * 4 + 12; }
+int compute_1494(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1494(obj.sum()) + obj.get_a();
+}
+static int helper_1495(int x) { return x * 5 + 0; }
+int compute_1495(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1496(int x) { return x * 6 + 1; }
+int compute_1496(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1497(int x) { return x * 7 + 2; }
+int compute_1497(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1497(obj.sum()) + obj.get_a();
+}
+static int helper_1498(int x) { return x * 1 + 3; }
+int compute_1498(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1499(int x) { return x * 2 + 4; }
+int compute_1499(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1500(int x) { return x * 3 + 5; }
+int compute_1500(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1500(obj.sum()) + obj.get_a();
+}
+static int helper_1501(int x) { return x * 4 + 6; }
+int compute_1501(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1502(int x) { return x * 5 + 7; }
+int compute_1502(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1503(int x) { return x * 6 + 8; }
+int compute_1503(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1503(obj.sum()) + obj.get_a();
+}
+static int helper_1504(int x) { return x * 7 + 9; }
+int compute_1504(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1505(int x) { return x * 1 + 10; }
+int compute_1505(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1506(int x) { return x * 2 + 11; }
+int compute_1506(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1506(obj.sum()) + obj.get_a();
+}
+static int helper_1507(int x) { return x * 3 + 12; }
+int compute_1507(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1508(int x) { return x * 4 + 0; }
+int compute_1508(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1509(int x) { return x * 5 + 1; }
+int compute_1509(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1509(obj.sum()) + obj.get_a();
+}
+static int helper_1510(int x) { return x * 6 + 2; }
+int compute_1510(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1511(int x) { return x * 7 + 3; }
+int compute_1511(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1512(int x) { return x * 1 + 4; }
+int compute_1512(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1512(obj.sum()) + obj.get_a();
+}
+static int helper_1513(int x) { return x * 2 + 5; }
+int compute_1513(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1514(int x) { return x * 3 + 6; }
+int compute_1514(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1515(int x) { return x * 4 + 7; }
+int compute_1515(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1515(obj.sum()) + obj.get_a();
+}
+static int helper_1516(int x) { return x * 5 + 8; }
+int compute_1516(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1517(int x) { return x * 6 + 9; }
+int compute_1517(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1518(int x) { return x * 7 + 10; }
+int compute_1518(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1518(obj.sum()) + obj.get_a();
+}
+static int helper_1519(int x) { return x * 1 + 11; }
+int compute_1519(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1520(int x) { return x * 2 + 12; }
+int compute_1520(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1521(int x) { return x * 3 + 0; }
+int compute_1521(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1521(obj.sum()) + obj.get_a();
+}
+static int helper_1522(int x) { return x * 4 + 1; }
+int compute_1522(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1523(int x) { return x * 5 + 2; }
+int compute_1523(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1524(int x) { return x * 6 + 3; }
+int compute_1524(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1524(obj.sum()) + obj.get_a();
+}
+static int helper_1525(int x) { return x * 7 + 4; }
+int compute_1525(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1526(int x) { return x * 1 + 5; }
+int compute_1526(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1527(int x) { return x * 2 + 6; }
+int compute_1527(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1527(obj.sum()) + obj.get_a();
+}
+static int helper_1528(int x) { return x * 3 + 7; }
+int compute_1528(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1529(int x) { return x * 4 + 8; }
+int compute_1529(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1530(int x) { return x * 5 + 9; }
+int compute_1530(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1530(obj.sum()) + obj.get_a();
+}
+static int helper_1531(int x) { return x * 6 + 10; }
+int compute_1531(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1532(int x) { return x * 7 + 11; }
+int compute_1532(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1533(int x) { return x * 1 + 12; }
+int compute_1533(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1533(obj.sum()) + obj.get_a();
+}
+static int helper_1534(int x) { return x * 2 + 0; }
+int compute_1534(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1535(int x) { return x * 3 + 1; }
+int compute_1535(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1536(int x) { return x * 4 + 2; }
+int compute_1536(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1536(obj.sum()) + obj.get_a();
+}
+static int helper_1537(int x) { return x * 5 + 3; }
+int compute_1537(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1538(int x) { return x * 6 + 4; }
+int compute_1538(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1539(int x) { return x * 7 + 5; }
+int compute_1539(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1539(obj.sum()) + obj.get_a();
+}
+static int helper_1540(int x) { return x * 1 + 6; }
+int compute_1540(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1541(int x) { return x * 2 + 7; }
+int compute_1541(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1542(int x) { return x * 3 + 8; }
+int compute_1542(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1542(obj.sum()) + obj.get_a();
+}
+static int helper_1543(int x) { return x * 4 + 9; }
+int compute_1543(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1544(int x) { return x * 5 + 10; }
+int compute_1544(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1545(int x) { return x * 6 + 11; }
+int compute_1545(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1545(obj.sum()) + obj.get_a();
+}
+static int helper_1546(int x) { return x * 7 + 12; }
+int compute_1546(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1547(int x) { return x * 1 + 0; }
+int compute_1547(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1548(int x) { return x * 2 + 1; }
+int compute_1548(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1548(obj.sum()) + obj.get_a();
+}
+static int helper_1549(int x) { return x * 3 + 2; }
+int compute_1549(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1550(int x) { return x * 4 + 3; }
+int compute_1550(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1551(int x) { return x * 5 + 4; }
+int compute_1551(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1551(obj.sum()) + obj.get_a();
+}
+static int helper_1552(int x) { return x * 6 + 5; }
+int compute_1552(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1553(int x) { return x * 7 + 6; }
+int compute_1553(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1554(int x) { return x * 1 + 7; }
+int compute_1554(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1554(obj.sum()) + obj.get_a();
+}
+static int helper_1555(int x) { return x * 2 + 8; }
+int compute_1555(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1556(int x) { return x * 3 + 9; }
+int compute_1556(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1557(int x) { return x * 4 + 10; }
+int compute_1557(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1557(obj.sum()) + obj.get_a();
+}
+static int helper_1558(int x) { return x * 5 + 11; }
+int compute_1558(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1559(int x) { return x * 6 + 12; }
+int compute_1559(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1560(int x) { return x * 7 + 0; }
+int compute_1560(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1560(obj.sum()) + obj.get_a();
+}
+static int helper_1561(int x) { return x * 1 + 1; }
+int compute_1561(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1562(int x) { return x * 2 + 2; }
+int compute_1562(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1563(int x) { return x * 3 + 3; }
+int compute_1563(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1563(obj.sum()) + obj.get_a();
+}
+static int helper_1564(int x) { return x * 4 + 4; }
+int compute_1564(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1565(int x) { return x * 5 + 5; }
+int compute_1565(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1566(int x) { return x * 6 + 6; }
+int compute_1566(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1566(obj.sum()) + obj.get_a();
+}
+static int helper_1567(int x) { return x * 7 + 7; }
+int compute_1567(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1568(int x) { return x * 1 + 8; }
+int compute_1568(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1569(int x) { return x * 2 + 9; }
+int compute_1569(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1569(obj.sum()) + obj.get_a();
+}
+static int helper_1570(int x) { return x * 3 + 10; }
+int compute_1570(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1571(int x) { return x * 4 + 11; }
+int compute_1571(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1572(int x) { return x * 5 + 12; }
+int compute_1572(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1572(obj.sum()) + obj.get_a();
+}
+static int helper_1573(int x) { return x * 6 + 0; }
+int compute_1573(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1574(int x) { return x * 7 + 1; }
+int compute_1574(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1575(int x) { return x * 1 + 2; }
+int compute_1575(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1575(obj.sum()) + obj.get_a();
+}
+static int helper_1576(int x) { return x * 2 + 3; }
+int compute_1576(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1577(int x) { return x * 3 + 4; }
+int compute_1577(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1578(int x) { return x * 4 + 5; }
+int compute_1578(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1578(obj.sum()) + obj.get_a();
+}
+static int helper_1579(int x) { return x * 5 + 6; }
+int compute_1579(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1580(int x) { return x * 6 + 7; }
+int compute_1580(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1581(int x) { return x * 7 + 8; }
+int compute_1581(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1581(obj.sum()) + obj.get_a();
+}
+static int helper_1582(int x) { return x * 1 + 9; }
+int compute_1582(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1583(int x) { return x * 2 + 10; }
+int compute_1583(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1584(int x) { return x * 3 + 11; }
+int compute_1584(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1584(obj.sum()) + obj.get_a();
+}
+static int helper_1585(int x) { return x * 4 + 12; }
+int compute_1585(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1586(int x) { return x * 5 + 0; }
+int compute_1586(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1587(int x) { return x * 6 + 1; }
+int compute_1587(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1587(obj.sum()) + obj.get_a();
+}
+static int helper_1588(int x) { return x * 7 + 2; }
+int compute_1588(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1589(int x) { return x * 1 + 3; }
+int compute_1589(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1590(int x) { return x * 2 + 4; }
+int compute_1590(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1590(obj.sum()) + obj.get_a();
+}
+static int helper_1591(int x) { return x * 3 + 5; }
+int compute_1591(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1592(int x) { return x * 4 + 6; }
+int compute_1592(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1593(int x) { return x * 5 + 7; }
+int compute_1593(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1593(obj.sum()) + obj.get_a();
+}
+static int helper_1594(int x) { return x * 6 + 8; }
+int compute_1594(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1595(int x) { return x * 7 + 9; }
+int compute_1595(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1596(int x) { return x * 1 + 10; }
+int compute_1596(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1596(obj.sum()) + obj.get_a();
+}
+static int helper_1597(int x) { return x * 2 + 11; }
+int compute_1597(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1598(int x) { return x * 3 + 12; }
+int compute_1598(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1599(int x) { return x * 4 + 0; }
+int compute_1599(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1599(obj.sum()) + obj.get_a();
+}
+static int helper_1600(int x) { return x * 5 + 1; }
+int compute_1600(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1601(int x) { return x * 6 + 2; }
+int compute_1601(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1602(int x) { return x * 7 + 3; }
+int compute_1602(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1602(obj.sum()) + obj.get_a();
+}
+static int helper_1603(int x) { return x * 1 + 4; }
+int compute_1603(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1604(int x) { return x * 2 + 5; }
+int compute_1604(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1605(int x) { return x * 3 + 6; }
+int compute_1605(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1605(obj.sum()) + obj.get_a();
+}
+static int helper_1606(int x) { return x * 4 + 7; }
+int compute_1606(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1607(int x) { return x * 5 + 8; }
+int compute_1607(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1608(int x) { return x * 6 + 9; }
+int compute_1608(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1608(obj.sum()) + obj.get_a();
+}
+static int helper_1609(int x) { return x * 7 + 10; }
+int compute_1609(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1610(int x) { return x * 1 + 11; }
+int compute_1610(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1611(int x) { return x * 2 + 12; }
+int compute_1611(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1611(obj.sum()) + obj.get_a();
+}
+static int helper_1612(int x) { return x * 3 + 0; }
+int compute_1612(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1613(int x) { return x * 4 + 1; }
+int compute_1613(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1614(int x) { return x * 5 + 2; }
+int compute_1614(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1614(obj.sum()) + obj.get_a();
+}
+static int helper_1615(int x) { return x * 6 + 3; }
+int compute_1615(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1616(int x) { return x * 7 + 4; }
+int compute_1616(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1617(int x) { return x * 1 + 5; }
+int compute_1617(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1617(obj.sum()) + obj.get_a();
+}
+static int helper_1618(int x) { return x * 2 + 6; }
+int compute_1618(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1619(int x) { return x * 3 + 7; }
+int compute_1619(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1620(int x) { return x * 4 + 8; }
+int compute_1620(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1620(obj.sum()) + obj.get_a();
+}
+static int helper_1621(int x) { return x * 5 + 9; }
+int compute_1621(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1622(int x) { return x * 6 + 10; }
+int compute_1622(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1623(int x) { return x * 7 + 11; }
+int compute_1623(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1623(obj.sum()) + obj.get_a();
+}
+static int helper_1624(int x) { return x * 1 + 12; }
+int compute_1624(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1625(int x) { return x * 2 + 0; }
+int compute_1625(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1626(int x) { return x * 3 + 1; }
+int compute_1626(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1626(obj.sum()) + obj.get_a();
+}
+static int helper_1627(int x) { return x * 4 + 2; }
+int compute_1627(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1628(int x) { return x * 5 + 3; }
+int compute_1628(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1629(int x) { return x * 6 + 4; }
+int compute_1629(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1629(obj.sum()) + obj.get_a();
+}
+static int helper_1630(int x) { return x * 7 + 5; }
+int compute_1630(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1631(int x) { return x * 1 + 6; }
+int compute_1631(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1632(int x) { return x * 2 + 7; }
+int compute_1632(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1632(obj.sum()) + obj.get_a();
+}
+static int helper_1633(int x) { return x * 3 + 8; }
+int compute_1633(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1634(int x) { return x * 4 + 9; }
+int compute_1634(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1635(int x) { return x * 5 + 10; }
+int compute_1635(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1635(obj.sum()) + obj.get_a();
+}
+static int helper_1636(int x) { return x * 6 + 11; }
+int compute_1636(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1637(int x) { return x * 7 + 12; }
+int compute_1637(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1638(int x) { return x * 1 + 0; }
+int compute_1638(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1638(obj.sum()) + obj.get_a();
+}
+static int helper_1639(int x) { return x * 2 + 1; }
+int compute_1639(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1640(int x) { return x * 3 + 2; }
+int compute_1640(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1641(int x) { return x * 4 + 3; }
+int compute_1641(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1641(obj.sum()) + obj.get_a();
+}
+static int helper_1642(int x) { return x * 5 + 4; }
+int compute_1642(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1643(int x) { return x * 6 + 5; }
+int compute_1643(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1644(int x) { return x * 7 + 6; }
+int compute_1644(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1644(obj.sum()) + obj.get_a();
+}
+static int helper_1645(int x) { return x * 1 + 7; }
+int compute_1645(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1646(int x) { return x * 2 + 8; }
+int compute_1646(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1647(int x) { return x * 3 + 9; }
+int compute_1647(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1647(obj.sum()) + obj.get_a();
+}
+static int helper_1648(int x) { return x * 4 + 10; }
+int compute_1648(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1649(int x) { return x * 5 + 11; }
+int compute_1649(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1650(int x) { return x * 6 + 12; }
+int compute_1650(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1650(obj.sum()) + obj.get_a();
+}
+static int helper_1651(int x) { return x * 7 + 0; }
+int compute_1651(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1652(int x) { return x * 1 + 1; }
+int compute_1652(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1653(int x) { return x * 2 + 2; }
+int compute_1653(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1653(obj.sum()) + obj.get_a();
+}
+static int helper_1654(int x) { return x * 3 + 3; }
+int compute_1654(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1655(int x) { return x * 4 + 4; }
+int compute_1655(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1656(int x) { return x * 5 + 5; }
+int compute_1656(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1656(obj.sum()) + obj.get_a();
+}
+static int helper_1657(int x) { return x * 6 + 6; }
+int compute_1657(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1658(int x) { return x * 7 + 7; }
+int compute_1658(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1659(int x) { return x * 1 + 8; }
+int compute_1659(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1659(obj.sum()) + obj.get_a();
+}
+static int helper_1660(int x) { return x * 2 + 9; }
+int compute_1660(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1661(int x) { return x * 3 + 10; }
+int compute_1661(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1662(int x) { return x * 4 + 11; }
+int compute_1662(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1662(obj.sum()) + obj.get_a();
+}
+static int helper_1663(int x) { return x * 5 + 12; }
+int compute_1663(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1664(int x) { return x * 6 + 0; }
+int compute_1664(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1665(int x) { return x * 7 + 1; }
+int compute_1665(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1665(obj.sum()) + obj.get_a();
+}
+static int helper_1666(int x) { return x * 1 + 2; }
+int compute_1666(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1667(int x) { return x * 2 + 3; }
+int compute_1667(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1668(int x) { return x * 3 + 4; }
+int compute_1668(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1668(obj.sum()) + obj.get_a();
+}
+static int helper_1669(int x) { return x * 4 + 5; }
+int compute_1669(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1670(int x) { return x * 5 + 6; }
+int compute_1670(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1671(int x) { return x * 6 + 7; }
+int compute_1671(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1671(obj.sum()) + obj.get_a();
+}
+static int helper_1672(int x) { return x * 7 + 8; }
+int compute_1672(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1673(int x) { return x * 1 + 9; }
+int compute_1673(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1674(int x) { return x * 2 + 10; }
+int compute_1674(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1674(obj.sum()) + obj.get_a();
+}
+static int helper_1675(int x) { return x * 3 + 11; }
+int compute_1675(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1676(int x) { return x * 4 + 12; }
+int compute_1676(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1677(int x) { return x * 5 + 0; }
+int compute_1677(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1677(obj.sum()) + obj.get_a();
+}
+static int helper_1678(int x) { return x * 6 + 1; }
+int compute_1678(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1679(int x) { return x * 7 + 2; }
+int compute_1679(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1680(int x) { return x * 1 + 3; }
+int compute_1680(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1680(obj.sum()) + obj.get_a();
+}
+static int helper_1681(int x) { return x * 2 + 4; }
+int compute_1681(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1682(int x) { return x * 3 + 5; }
+int compute_1682(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1683(int x) { return x * 4 + 6; }
+int compute_1683(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1683(obj.sum()) + obj.get_a();
+}
+static int helper_1684(int x) { return x * 5 + 7; }
+int compute_1684(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1685(int x) { return x * 6 + 8; }
+int compute_1685(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1686(int x) { return x * 7 + 9; }
+int compute_1686(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1686(obj.sum()) + obj.get_a();
+}
+static int helper_1687(int x) { return x * 1 + 10; }
+int compute_1687(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1688(int x) { return x * 2 + 11; }
+int compute_1688(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1689(int x) { return x * 3 + 12; }
+int compute_1689(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1689(obj.sum()) + obj.get_a();
+}
+static int helper_1690(int x) { return x * 4 + 0; }
+int compute_1690(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1691(int x) { return x * 5 + 1; }
+int compute_1691(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1692(int x) { return x * 6 + 2; }
+int compute_1692(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1692(obj.sum()) + obj.get_a();
+}
+static int helper_1693(int x) { return x * 7 + 3; }
+int compute_1693(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1694(int x) { return x * 1 + 4; }
+int compute_1694(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1695(int x) { return x * 2 + 5; }
+int compute_1695(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1695(obj.sum()) + obj.get_a();
+}
+static int helper_1696(int x) { return x * 3 + 6; }
+int compute_1696(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1697(int x) { return x * 4 + 7; }
+int compute_1697(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1698(int x) { return x * 5 + 8; }
+int compute_1698(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1698(obj.sum()) + obj.get_a();
+}
+static int helper_1699(int x) { return x * 6 + 9; }
+int compute_1699(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1700(int x) { return x * 7 + 10; }
+int compute_1700(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1701(int x) { return x * 1 + 11; }
+int compute_1701(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1701(obj.sum()) + obj.get_a();
+}
+static int helper_1702(int x) { return x * 2 + 12; }
+int compute_1702(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1703(int x) { return x * 3 + 0; }
+int compute_1703(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1704(int x) { return x * 4 + 1; }
+int compute_1704(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1704(obj.sum()) + obj.get_a();
+}
+static int helper_1705(int x) { return x * 5 + 2; }
+int compute_1705(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1706(int x) { return x * 6 + 3; }
+int compute_1706(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1707(int x) { return x * 7 + 4; }
+int compute_1707(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1707(obj.sum()) + obj.get_a();
+}
+static int helper_1708(int x) { return x * 1 + 5; }
+int compute_1708(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1709(int x) { return x * 2 + 6; }
+int compute_1709(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1710(int x) { return x * 3 + 7; }
+int compute_1710(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1710(obj.sum()) + obj.get_a();
+}
+static int helper_1711(int x) { return x * 4 + 8; }
+int compute_1711(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1712(int x) { return x * 5 + 9; }
+int compute_1712(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1713(int x) { return x * 6 + 10; }
+int compute_1713(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1713(obj.sum()) + obj.get_a();
+}
+static int helper_1714(int x) { return x * 7 + 11; }
+int compute_1714(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1715(int x) { return x * 1 + 12; }
+int compute_1715(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1716(int x) { return x * 2 + 0; }
+int compute_1716(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1716(obj.sum()) + obj.get_a();
+}
+static int helper_1717(int x) { return x * 3 + 1; }
+int compute_1717(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1718(int x) { return x * 4 + 2; }
+int compute_1718(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1719(int x) { return x * 5 + 3; }
+int compute_1719(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1719(obj.sum()) + obj.get_a();
+}
+static int helper_1720(int x) { return x * 6 + 4; }
+int compute_1720(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1721(int x) { return x * 7 + 5; }
+int compute_1721(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1722(int x) { return x * 1 + 6; }
+int compute_1722(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1722(obj.sum()) + obj.get_a();
+}
+static int helper_1723(int x) { return x * 2 + 7; }
+int compute_1723(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1724(int x) { return x * 3 + 8; }
+int compute_1724(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1725(int x) { return x * 4 + 9; }
+int compute_1725(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1725(obj.sum()) + obj.get_a();
+}
+static int helper_1726(int x) { return x * 5 + 10; }
+int compute_1726(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1727(int x) { return x * 6 + 11; }
+int compute_1727(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1728(int x) { return x * 7 + 12; }
+int compute_1728(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1728(obj.sum()) + obj.get_a();
+}
+static int helper_1729(int x) { return x * 1 + 0; }
+int compute_1729(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1730(int x) { return x * 2 + 1; }
+int compute_1730(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1731(int x) { return x * 3 + 2; }
+int compute_1731(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1731(obj.sum()) + obj.get_a();
+}
+static int helper_1732(int x) { return x * 4 + 3; }
+int compute_1732(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1733(int x) { return x * 5 + 4; }
+int compute_1733(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1734(int x) { return x * 6 + 5; }
+int compute_1734(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1734(obj.sum()) + obj.get_a();
+}
+static int helper_1735(int x) { return x * 7 + 6; }
+int compute_1735(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1736(int x) { return x * 1 + 7; }
+int compute_1736(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1737(int x) { return x * 2 + 8; }
+int compute_1737(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1737(obj.sum()) + obj.get_a();
+}
+static int helper_1738(int x) { return x * 3 + 9; }
+int compute_1738(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1739(int x) { return x * 4 + 10; }
+int compute_1739(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1740(int x) { return x * 5 + 11; }
+int compute_1740(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1740(obj.sum()) + obj.get_a();
+}
+static int helper_1741(int x) { return x * 6 + 12; }
+int compute_1741(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1742(int x) { return x * 7 + 0; }
+int compute_1742(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1743(int x) { return x * 1 + 1; }
+int compute_1743(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1743(obj.sum()) + obj.get_a();
+}
+static int helper_1744(int x) { return x * 2 + 2; }
+int compute_1744(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1745(int x) { return x * 3 + 3; }
+int compute_1745(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1746(int x) { return x * 4 + 4; }
+int compute_1746(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1746(obj.sum()) + obj.get_a();
+}
+static int helper_1747(int x) { return x * 5 + 5; }
+int compute_1747(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1748(int x) { return x * 6 + 6; }
+int compute_1748(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1749(int x) { return x * 7 + 7; }
+int compute_1749(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1749(obj.sum()) + obj.get_a();
+}
+static int helper_1750(int x) { return x * 1 + 8; }
+int compute_1750(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1751(int x) { return x * 2 + 9; }
+int compute_1751(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1752(int x) { return x * 3 + 10; }
+int compute_1752(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1752(obj.sum()) + obj.get_a();
+}
+static int helper_1753(int x) { return x * 4 + 11; }
+int compute_1753(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1754(int x) { return x * 5 + 12; }
+int compute_1754(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1755(int x) { return x * 6 + 0; }
+int compute_1755(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1755(obj.sum()) + obj.get_a();
+}
+static int helper_1756(int x) { return x * 7 + 1; }
+int compute_1756(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1757(int x) { return x * 1 + 2; }
+int compute_1757(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1758(int x) { return x * 2 + 3; }
+int compute_1758(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1758(obj.sum()) + obj.get_a();
+}
+static int helper_1759(int x) { return x * 3 + 4; }
+int compute_1759(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1760(int x) { return x * 4 + 5; }
+int compute_1760(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1761(int x) { return x * 5 + 6; }
+int compute_1761(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1761(obj.sum()) + obj.get_a();
+}
+static int helper_1762(int x) { return x * 6 + 7; }
+int compute_1762(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1763(int x) { return x * 7 + 8; }
+int compute_1763(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1764(int x) { return x * 1 + 9; }
+int compute_1764(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1764(obj.sum()) + obj.get_a();
+}
+static int helper_1765(int x) { return x * 2 + 10; }
+int compute_1765(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1766(int x) { return x * 3 + 11; }
+int compute_1766(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1767(int x) { return x * 4 + 12; }
+int compute_1767(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1767(obj.sum()) + obj.get_a();
+}
+static int helper_1768(int x) { return x * 5 + 0; }
+int compute_1768(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1769(int x) { return x * 6 + 1; }
+int compute_1769(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1770(int x) { return x * 7 + 2; }
+int compute_1770(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1770(obj.sum()) + obj.get_a();
+}
+static int helper_1771(int x) { return x * 1 + 3; }
+int compute_1771(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1772(int x) { return x * 2 + 4; }
+int compute_1772(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1773(int x) { return x * 3 + 5; }
+int compute_1773(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1773(obj.sum()) + obj.get_a();
+}
+static int helper_1774(int x) { return x * 4 + 6; }
+int compute_1774(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1775(int x) { return x * 5 + 7; }
+int compute_1775(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1776(int x) { return x * 6 + 8; }
+int compute_1776(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1776(obj.sum()) + obj.get_a();
+}
+static int helper_1777(int x) { return x * 7 + 9; }
+int compute_1777(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1778(int x) { return x * 1 + 10; }
+int compute_1778(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1779(int x) { return x * 2 + 11; }
+int compute_1779(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1779(obj.sum()) + obj.get_a();
+}
+static int helper_1780(int x) { return x * 3 + 12; }
+int compute_1780(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1781(int x) { return x * 4 + 0; }
+int compute_1781(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1782(int x) { return x * 5 + 1; }
+int compute_1782(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1782(obj.sum()) + obj.get_a();
+}
+static int helper_1783(int x) { return x * 6 + 2; }
+int compute_1783(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1784(int x) { return x * 7 + 3; }
+int compute_1784(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1785(int x) { return x * 1 + 4; }
+int compute_1785(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1785(obj.sum()) + obj.get_a();
+}
+static int helper_1786(int x) { return x * 2 + 5; }
+int compute_1786(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1787(int x) { return x * 3 + 6; }
+int compute_1787(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1788(int x) { return x * 4 + 7; }
+int compute_1788(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1788(obj.sum()) + obj.get_a();
+}
+static int helper_1789(int x) { return x * 5 + 8; }
+int compute_1789(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1790(int x) { return x * 6 + 9; }
+int compute_1790(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1791(int x) { return x * 7 + 10; }
+int compute_1791(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1791(obj.sum()) + obj.get_a();
+}
+static int helper_1792(int x) { return x * 1 + 11; }
+int compute_1792(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1793(int x) { return x * 2 + 12; }
+int compute_1793(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1794(int x) { return x * 3 + 0; }
+int compute_1794(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1794(obj.sum()) + obj.get_a();
+}
+static int helper_1795(int x) { return x * 4 + 1; }
+int compute_1795(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1796(int x) { return x * 5 + 2; }
+int compute_1796(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1797(int x) { return x * 6 + 3; }
+int compute_1797(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1797(obj.sum()) + obj.get_a();
+}
+static int helper_1798(int x) { return x * 7 + 4; }
+int compute_1798(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1799(int x) { return x * 1 + 5; }
+int compute_1799(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1800(int x) { return x * 2 + 6; }
+int compute_1800(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1800(obj.sum()) + obj.get_a();
+}
+static int helper_1801(int x) { return x * 3 + 7; }
+int compute_1801(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1802(int x) { return x * 4 + 8; }
+int compute_1802(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1803(int x) { return x * 5 + 9; }
+int compute_1803(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1803(obj.sum()) + obj.get_a();
+}
+static int helper_1804(int x) { return x * 6 + 10; }
+int compute_1804(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1805(int x) { return x * 7 + 11; }
+int compute_1805(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1806(int x) { return x * 1 + 12; }
+int compute_1806(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1806(obj.sum()) + obj.get_a();
+}
+static int helper_1807(int x) { return x * 2 + 0; }
+int compute_1807(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1808(int x) { return x * 3 + 1; }
+int compute_1808(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1809(int x) { return x * 4 + 2; }
+int compute_1809(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1809(obj.sum()) + obj.get_a();
+}
+static int helper_1810(int x) { return x * 5 + 3; }
+int compute_1810(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1811(int x) { return x * 6 + 4; }
+int compute_1811(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1812(int x) { return x * 7 + 5; }
+int compute_1812(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1812(obj.sum()) + obj.get_a();
+}
+static int helper_1813(int x) { return x * 1 + 6; }
+int compute_1813(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1814(int x) { return x * 2 + 7; }
+int compute_1814(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1815(int x) { return x * 3 + 8; }
+int compute_1815(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1815(obj.sum()) + obj.get_a();
+}
+static int helper_1816(int x) { return x * 4 + 9; }
+int compute_1816(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1817(int x) { return x * 5 + 10; }
+int compute_1817(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1818(int x) { return x * 6 + 11; }
+int compute_1818(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1818(obj.sum()) + obj.get_a();
+}
+static int helper_1819(int x) { return x * 7 + 12; }
+int compute_1819(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1820(int x) { return x * 1 + 0; }
+int compute_1820(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1821(int x) { return x * 2 + 1; }
+int compute_1821(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1821(obj.sum()) + obj.get_a();
+}
+static int helper_1822(int x) { return x * 3 + 2; }
+int compute_1822(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1823(int x) { return x * 4 + 3; }
+int compute_1823(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1824(int x) { return x * 5 + 4; }
+int compute_1824(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1824(obj.sum()) + obj.get_a();
+}
+static int helper_1825(int x) { return x * 6 + 5; }
+int compute_1825(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1826(int x) { return x * 7 + 6; }
+int compute_1826(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1827(int x) { return x * 1 + 7; }
+int compute_1827(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1827(obj.sum()) + obj.get_a();
+}
+static int helper_1828(int x) { return x * 2 + 8; }
+int compute_1828(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1829(int x) { return x * 3 + 9; }
+int compute_1829(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1830(int x) { return x * 4 + 10; }
+int compute_1830(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1830(obj.sum()) + obj.get_a();
+}
+static int helper_1831(int x) { return x * 5 + 11; }
+int compute_1831(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1832(int x) { return x * 6 + 12; }
+int compute_1832(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1833(int x) { return x * 7 + 0; }
+int compute_1833(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1833(obj.sum()) + obj.get_a();
+}
+static int helper_1834(int x) { return x * 1 + 1; }
+int compute_1834(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1835(int x) { return x * 2 + 2; }
+int compute_1835(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1836(int x) { return x * 3 + 3; }
+int compute_1836(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1836(obj.sum()) + obj.get_a();
+}
+static int helper_1837(int x) { return x * 4 + 4; }
+int compute_1837(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1838(int x) { return x * 5 + 5; }
+int compute_1838(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1839(int x) { return x * 6 + 6; }
+int compute_1839(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1839(obj.sum()) + obj.get_a();
+}
+static int helper_1840(int x) { return x * 7 + 7; }
+int compute_1840(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1841(int x) { return x * 1 + 8; }
+int compute_1841(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1842(int x) { return x * 2 + 9; }
+int compute_1842(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1842(obj.sum()) + obj.get_a();
+}
+static int helper_1843(int x) { return x * 3 + 10; }
+int compute_1843(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1844(int x) { return x * 4 + 11; }
+int compute_1844(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1845(int x) { return x * 5 + 12; }
+int compute_1845(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1845(obj.sum()) + obj.get_a();
+}
+static int helper_1846(int x) { return x * 6 + 0; }
+int compute_1846(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1847(int x) { return x * 7 + 1; }
+int compute_1847(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1848(int x) { return x * 1 + 2; }
+int compute_1848(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1848(obj.sum()) + obj.get_a();
+}
+static int helper_1849(int x) { return x * 2 + 3; }
+int compute_1849(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1850(int x) { return x * 3 + 4; }
+int compute_1850(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1851(int x) { return x * 4 + 5; }
+int compute_1851(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1851(obj.sum()) + obj.get_a();
+}
+static int helper_1852(int x) { return x * 5 + 6; }
+int compute_1852(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1853(int x) { return x * 6 + 7; }
+int compute_1853(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1854(int x) { return x * 7 + 8; }
+int compute_1854(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1854(obj.sum()) + obj.get_a();
+}
+static int helper_1855(int x) { return x * 1 + 9; }
+int compute_1855(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1856(int x) { return x * 2 + 10; }
+int compute_1856(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1857(int x) { return x * 3 + 11; }
+int compute_1857(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1857(obj.sum()) + obj.get_a();
+}
+static int helper_1858(int x) { return x * 4 + 12; }
+int compute_1858(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1859(int x) { return x * 5 + 0; }
+int compute_1859(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1860(int x) { return x * 6 + 1; }
+int compute_1860(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1860(obj.sum()) + obj.get_a();
+}
+static int helper_1861(int x) { return x * 7 + 2; }
+int compute_1861(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1862(int x) { return x * 1 + 3; }
+int compute_1862(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1863(int x) { return x * 2 + 4; }
+int compute_1863(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1863(obj.sum()) + obj.get_a();
+}
+static int helper_1864(int x) { return x * 3 + 5; }
+int compute_1864(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1865(int x) { return x * 4 + 6; }
+int compute_1865(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1866(int x) { return x * 5 + 7; }
+int compute_1866(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1866(obj.sum()) + obj.get_a();
+}
+static int helper_1867(int x) { return x * 6 + 8; }
+int compute_1867(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1868(int x) { return x * 7 + 9; }
+int compute_1868(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1869(int x) { return x * 1 + 10; }
+int compute_1869(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1869(obj.sum()) + obj.get_a();
+}
+static int helper_1870(int x) { return x * 2 + 11; }
+int compute_1870(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1871(int x) { return x * 3 + 12; }
+int compute_1871(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1872(int x) { return x * 4 + 0; }
+int compute_1872(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1872(obj.sum()) + obj.get_a();
+}
+static int helper_1873(int x) { return x * 5 + 1; }
+int compute_1873(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1874(int x) { return x * 6 + 2; }
+int compute_1874(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1875(int x) { return x * 7 + 3; }
+int compute_1875(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1875(obj.sum()) + obj.get_a();
+}
+static int helper_1876(int x) { return x * 1 + 4; }
+int compute_1876(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1877(int x) { return x * 2 + 5; }
+int compute_1877(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1878(int x) { return x * 3 + 6; }
+int compute_1878(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1878(obj.sum()) + obj.get_a();
+}
+static int helper_1879(int x) { return x * 4 + 7; }
+int compute_1879(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1880(int x) { return x * 5 + 8; }
+int compute_1880(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1881(int x) { return x * 6 + 9; }
+int compute_1881(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1881(obj.sum()) + obj.get_a();
+}
+static int helper_1882(int x) { return x * 7 + 10; }
+int compute_1882(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1883(int x) { return x * 1 + 11; }
+int compute_1883(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1884(int x) { return x * 2 + 12; }
+int compute_1884(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1884(obj.sum()) + obj.get_a();
+}
+static int helper_1885(int x) { return x * 3 + 0; }
+int compute_1885(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1886(int x) { return x * 4 + 1; }
+int compute_1886(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1887(int x) { return x * 5 + 2; }
+int compute_1887(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1887(obj.sum()) + obj.get_a();
+}
+static int helper_1888(int x) { return x * 6 + 3; }
+int compute_1888(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1889(int x) { return x * 7 + 4; }
+int compute_1889(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1890(int x) { return x * 1 + 5; }
+int compute_1890(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1890(obj.sum()) + obj.get_a();
+}
+static int helper_1891(int x) { return x * 2 + 6; }
+int compute_1891(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1892(int x) { return x * 3 + 7; }
+int compute_1892(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1893(int x) { return x * 4 + 8; }
+int compute_1893(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1893(obj.sum()) + obj.get_a();
+}
+static int helper_1894(int x) { return x * 5 + 9; }
+int compute_1894(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1895(int x) { return x * 6 + 10; }
+int compute_1895(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1896(int x) { return x * 7 + 11; }
+int compute_1896(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1896(obj.sum()) + obj.get_a();
+}
+static int helper_1897(int x) { return x * 1 + 12; }
+int compute_1897(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1898(int x) { return x * 2 + 0; }
+int compute_1898(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1899(int x) { return x * 3 + 1; }
+int compute_1899(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1899(obj.sum()) + obj.get_a();
+}
+static int helper_1900(int x) { return x * 4 + 2; }
+int compute_1900(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1901(int x) { return x * 5 + 3; }
+int compute_1901(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1902(int x) { return x * 6 + 4; }
+int compute_1902(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1902(obj.sum()) + obj.get_a();
+}
+static int helper_1903(int x) { return x * 7 + 5; }
+int compute_1903(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1904(int x) { return x * 1 + 6; }
+int compute_1904(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1905(int x) { return x * 2 + 7; }
+int compute_1905(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1905(obj.sum()) + obj.get_a();
+}
+static int helper_1906(int x) { return x * 3 + 8; }
+int compute_1906(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1907(int x) { return x * 4 + 9; }
+int compute_1907(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1908(int x) { return x * 5 + 10; }
+int compute_1908(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1908(obj.sum()) + obj.get_a();
+}
+static int helper_1909(int x) { return x * 6 + 11; }
+int compute_1909(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1910(int x) { return x * 7 + 12; }
+int compute_1910(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1911(int x) { return x * 1 + 0; }
+int compute_1911(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1911(obj.sum()) + obj.get_a();
+}
+static int helper_1912(int x) { return x * 2 + 1; }
+int compute_1912(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1913(int x) { return x * 3 + 2; }
+int compute_1913(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1914(int x) { return x * 4 + 3; }
+int compute_1914(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1914(obj.sum()) + obj.get_a();
+}
+static int helper_1915(int x) { return x * 5 + 4; }
+int compute_1915(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1916(int x) { return x * 6 + 5; }
+int compute_1916(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1917(int x) { return x * 7 + 6; }
+int compute_1917(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1917(obj.sum()) + obj.get_a();
+}
+static int helper_1918(int x) { return x * 1 + 7; }
+int compute_1918(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1919(int x) { return x * 2 + 8; }
+int compute_1919(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1920(int x) { return x * 3 + 9; }
+int compute_1920(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1920(obj.sum()) + obj.get_a();
+}
+static int helper_1921(int x) { return x * 4 + 10; }
+int compute_1921(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1922(int x) { return x * 5 + 11; }
+int compute_1922(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1923(int x) { return x * 6 + 12; }
+int compute_1923(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1923(obj.sum()) + obj.get_a();
+}
+static int helper_1924(int x) { return x * 7 + 0; }
+int compute_1924(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1925(int x) { return x * 1 + 1; }
+int compute_1925(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1926(int x) { return x * 2 + 2; }
+int compute_1926(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1926(obj.sum()) + obj.get_a();
+}
+static int helper_1927(int x) { return x * 3 + 3; }
+int compute_1927(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1928(int x) { return x * 4 + 4; }
+int compute_1928(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1929(int x) { return x * 5 + 5; }
+int compute_1929(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1929(obj.sum()) + obj.get_a();
+}
+static int helper_1930(int x) { return x * 6 + 6; }
+int compute_1930(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1931(int x) { return x * 7 + 7; }
+int compute_1931(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1932(int x) { return x * 1 + 8; }
+int compute_1932(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1932(obj.sum()) + obj.get_a();
+}
+static int helper_1933(int x) { return x * 2 + 9; }
+int compute_1933(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1934(int x) { return x * 3 + 10; }
+int compute_1934(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1935(int x) { return x * 4 + 11; }
+int compute_1935(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1935(obj.sum()) + obj.get_a();
+}
+static int helper_1936(int x) { return x * 5 + 12; }
+int compute_1936(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1937(int x) { return x * 6 + 0; }
+int compute_1937(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1938(int x) { return x * 7 + 1; }
+int compute_1938(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1938(obj.sum()) + obj.get_a();
+}
+static int helper_1939(int x) { return x * 1 + 2; }
+int compute_1939(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1940(int x) { return x * 2 + 3; }
+int compute_1940(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1941(int x) { return x * 3 + 4; }
+int compute_1941(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1941(obj.sum()) + obj.get_a();
+}
+static int helper_1942(int x) { return x * 4 + 5; }
+int compute_1942(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1943(int x) { return x * 5 + 6; }
+int compute_1943(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1944(int x) { return x * 6 + 7; }
+int compute_1944(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1944(obj.sum()) + obj.get_a();
+}
+static int helper_1945(int x) { return x * 7 + 8; }
+int compute_1945(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1946(int x) { return x * 1 + 9; }
+int compute_1946(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1947(int x) { return x * 2 + 10; }
+int compute_1947(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1947(obj.sum()) + obj.get_a();
+}
+static int helper_1948(int x) { return x * 3 + 11; }
+int compute_1948(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1949(int x) { return x * 4 + 12; }
+int compute_1949(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1950(int x) { return x * 5 + 0; }
+int compute_1950(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1950(obj.sum()) + obj.get_a();
+}
+static int helper_1951(int x) { return x * 6 + 1; }
+int compute_1951(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1952(int x) { return x * 7 + 2; }
+int compute_1952(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1953(int x) { return x * 1 + 3; }
+int compute_1953(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1953(obj.sum()) + obj.get_a();
+}
+static int helper_1954(int x) { return x * 2 + 4; }
+int compute_1954(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1955(int x) { return x * 3 + 5; }
+int compute_1955(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1956(int x) { return x * 4 + 6; }
+int compute_1956(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1956(obj.sum()) + obj.get_a();
+}
+static int helper_1957(int x) { return x * 5 + 7; }
+int compute_1957(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1958(int x) { return x * 6 + 8; }
+int compute_1958(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1959(int x) { return x * 7 + 9; }
+int compute_1959(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1959(obj.sum()) + obj.get_a();
+}
+static int helper_1960(int x) { return x * 1 + 10; }
+int compute_1960(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1961(int x) { return x * 2 + 11; }
+int compute_1961(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1962(int x) { return x * 3 + 12; }
+int compute_1962(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1962(obj.sum()) + obj.get_a();
+}
+static int helper_1963(int x) { return x * 4 + 0; }
+int compute_1963(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1964(int x) { return x * 5 + 1; }
+int compute_1964(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1965(int x) { return x * 6 + 2; }
+int compute_1965(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1965(obj.sum()) + obj.get_a();
+}
+static int helper_1966(int x) { return x * 7 + 3; }
+int compute_1966(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1967(int x) { return x * 1 + 4; }
+int compute_1967(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1968(int x) { return x * 2 + 5; }
+int compute_1968(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1968(obj.sum()) + obj.get_a();
+}
+static int helper_1969(int x) { return x * 3 + 6; }
+int compute_1969(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1970(int x) { return x * 4 + 7; }
+int compute_1970(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1971(int x) { return x * 5 + 8; }
+int compute_1971(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1971(obj.sum()) + obj.get_a();
+}
+static int helper_1972(int x) { return x * 6 + 9; }
+int compute_1972(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1973(int x) { return x * 7 + 10; }
+int compute_1973(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1974(int x) { return x * 1 + 11; }
+int compute_1974(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1974(obj.sum()) + obj.get_a();
+}
+static int helper_1975(int x) { return x * 2 + 12; }
+int compute_1975(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1976(int x) { return x * 3 + 0; }
+int compute_1976(int a, int b) {
+  ns0::C0_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1977(int x) { return x * 4 + 1; }
+int compute_1977(int a, int b) {
+  ns1::C1_3 obj = { a, b };
+  return helper_1977(obj.sum()) + obj.get_a();
+}
+static int helper_1978(int x) { return x * 5 + 2; }
+int compute_1978(int a, int b) {
+  ns2::C2_4 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1979(int x) { return x * 6 + 3; }
+int compute_1979(int a, int b) {
+  ns3::C3_5 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1980(int x) { return x * 7 + 4; }
+int compute_1980(int a, int b) {
+  ns4::C4_0 obj = { a, b };
+  return helper_1980(obj.sum()) + obj.get_a();
+}
+static int helper_1981(int x) { return x * 1 + 5; }
+int compute_1981(int a, int b) {
+  ns5::C5_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1982(int x) { return x * 2 + 6; }
+int compute_1982(int a, int b) {
+  ns6::C6_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1983(int x) { return x * 3 + 7; }
+int compute_1983(int a, int b) {
+  ns7::C7_3 obj = { a, b };
+  return helper_1983(obj.sum()) + obj.get_a();
+}
+static int helper_1984(int x) { return x * 4 + 8; }
+int compute_1984(int a, int b) {
+  ns0::C0_4 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1985(int x) { return x * 5 + 9; }
+int compute_1985(int a, int b) {
+  ns1::C1_5 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1986(int x) { return x * 6 + 10; }
+int compute_1986(int a, int b) {
+  ns2::C2_0 obj = { a, b };
+  return helper_1986(obj.sum()) + obj.get_a();
+}
+static int helper_1987(int x) { return x * 7 + 11; }
+int compute_1987(int a, int b) {
+  ns3::C3_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1988(int x) { return x * 1 + 12; }
+int compute_1988(int a, int b) {
+  ns4::C4_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1989(int x) { return x * 2 + 0; }
+int compute_1989(int a, int b) {
+  ns5::C5_3 obj = { a, b };
+  return helper_1989(obj.sum()) + obj.get_a();
+}
+static int helper_1990(int x) { return x * 3 + 1; }
+int compute_1990(int a, int b) {
+  ns6::C6_4 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_1991(int x) { return x * 4 + 2; }
+int compute_1991(int a, int b) {
+  ns7::C7_5 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1992(int x) { return x * 5 + 3; }
+int compute_1992(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_1992(obj.sum()) + obj.get_a();
+}
+static int helper_1993(int x) { return x * 6 + 4; }
+int compute_1993(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_1994(int x) { return x * 7 + 5; }
+int compute_1994(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_1995(int x) { return x * 1 + 6; }
+int compute_1995(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_1995(obj.sum()) + obj.get_a();
+}
+static int helper_1996(int x) { return x * 2 + 7; }
+int compute_1996(int a, int b) {
+  ns4::C4_4 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_1997(int x) { return x * 3 + 8; }
+int compute_1997(int a, int b) {
+  ns5::C5_5 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_1998(int x) { return x * 4 + 9; }
+int compute_1998(int a, int b) {
+  ns6::C6_0 obj = { a, b };
+  return helper_1998(obj.sum()) + obj.get_a();
+}
+static int helper_1999(int x) { return x * 5 + 10; }
+int compute_1999(int a, int b) {
+  ns7::C7_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+int main() { return compute_0(1, 2); }
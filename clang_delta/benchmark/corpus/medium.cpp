@@ -0,0 +1,2360 @@
+// Synthetic preprocessed-style corpus file for the clang_delta
+// benchmark target.  Regenerate only when the benchmark baseline
+// is regenerated as well; timings are only comparable on an
+// identical corpus.
+
+namespace ns0 {
+struct C0_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns1 {
+struct C1_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns2 {
+struct C2_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C2_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns3 {
+struct C3_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_2 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C3_3 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+static int helper_0(int x) { return x * 1 + 0; }
+int compute_0(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_0(obj.sum()) + obj.get_a();
+}
+static int helper_1(int x) { return x * 2 + 1; }
+int compute_1(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_2(int x) { return x * 3 + 2; }
+int compute_2(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_3(int x) { return x * 4 + 3; }
+int compute_3(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_3(obj.sum()) + obj.get_a();
+}
+static int helper_4(int x) { return x * 5 + 4; }
+int compute_4(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_5(int x) { return x * 6 + 5; }
+int compute_5(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_6(int x) { return x * 7 + 6; }
+int compute_6(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_6(obj.sum()) + obj.get_a();
+}
+static int helper_7(int x) { return x * 1 + 7; }
+int compute_7(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_8(int x) { return x * 2 + 8; }
+int compute_8(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_9(int x) { return x * 3 + 9; }
+int compute_9(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_9(obj.sum()) + obj.get_a();
+}
+static int helper_10(int x) { return x * 4 + 10; }
+int compute_10(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_11(int x) { return x * 5 + 11; }
+int compute_11(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_12(int x) { return x * 6 + 12; }
+int compute_12(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_12(obj.sum()) + obj.get_a();
+}
+static int helper_13(int x) { return x * 7 + 0; }
+int compute_13(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_14(int x) { return x * 1 + 1; }
+int compute_14(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_15(int x) { return x * 2 + 2; }
+int compute_15(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_15(obj.sum()) + obj.get_a();
+}
+static int helper_16(int x) { return x * 3 + 3; }
+int compute_16(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_17(int x) { return x * 4 + 4; }
+int compute_17(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_18(int x) { return x * 5 + 5; }
+int compute_18(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_18(obj.sum()) + obj.get_a();
+}
+static int helper_19(int x) { return x * 6 + 6; }
+int compute_19(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_20(int x) { return x * 7 + 7; }
+int compute_20(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_21(int x) { return x * 1 + 8; }
+int compute_21(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_21(obj.sum()) + obj.get_a();
+}
+static int helper_22(int x) { return x * 2 + 9; }
+int compute_22(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_23(int x) { return x * 3 + 10; }
+int compute_23(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_24(int x) { return x * 4 + 11; }
+int compute_24(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_24(obj.sum()) + obj.get_a();
+}
+static int helper_25(int x) { return x * 5 + 12; }
+int compute_25(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_26(int x) { return x * 6 + 0; }
+int compute_26(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_27(int x) { return x * 7 + 1; }
+int compute_27(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_27(obj.sum()) + obj.get_a();
+}
+static int helper_28(int x) { return x * 1 + 2; }
+int compute_28(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_29(int x) { return x * 2 + 3; }
+int compute_29(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_30(int x) { return x * 3 + 4; }
+int compute_30(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_30(obj.sum()) + obj.get_a();
+}
+static int helper_31(int x) { return x * 4 + 5; }
+int compute_31(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_32(int x) { return x * 5 + 6; }
+int compute_32(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_33(int x) { return x * 6 + 7; }
+int compute_33(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_33(obj.sum()) + obj.get_a();
+}
+static int helper_34(int x) { return x * 7 + 8; }
+int compute_34(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_35(int x) { return x * 1 + 9; }
+int compute_35(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_36(int x) { return x * 2 + 10; }
+int compute_36(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_36(obj.sum()) + obj.get_a();
+}
+static int helper_37(int x) { return x * 3 + 11; }
+int compute_37(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_38(int x) { return x * 4 + 12; }
+int compute_38(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_39(int x) { return x * 5 + 0; }
+int compute_39(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_39(obj.sum()) + obj.get_a();
+}
+static int helper_40(int x) { return x * 6 + 1; }
+int compute_40(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_41(int x) { return x * 7 + 2; }
+int compute_41(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_42(int x) { return x * 1 + 3; }
+int compute_42(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_42(obj.sum()) + obj.get_a();
+}
+static int helper_43(int x) { return x * 2 + 4; }
+int compute_43(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_44(int x) { return x * 3 + 5; }
+int compute_44(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_45(int x) { return x * 4 + 6; }
+int compute_45(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_45(obj.sum()) + obj.get_a();
+}
+static int helper_46(int x) { return x * 5 + 7; }
+int compute_46(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_47(int x) { return x * 6 + 8; }
+int compute_47(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_48(int x) { return x * 7 + 9; }
+int compute_48(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_48(obj.sum()) + obj.get_a();
+}
+static int helper_49(int x) { return x * 1 + 10; }
+int compute_49(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_50(int x) { return x * 2 + 11; }
+int compute_50(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_51(int x) { return x * 3 + 12; }
+int compute_51(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_51(obj.sum()) + obj.get_a();
+}
+static int helper_52(int x) { return x * 4 + 0; }
+int compute_52(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_53(int x) { return x * 5 + 1; }
+int compute_53(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_54(int x) { return x * 6 + 2; }
+int compute_54(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_54(obj.sum()) + obj.get_a();
+}
+static int helper_55(int x) { return x * 7 + 3; }
+int compute_55(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_56(int x) { return x * 1 + 4; }
+int compute_56(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_57(int x) { return x * 2 + 5; }
+int compute_57(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_57(obj.sum()) + obj.get_a();
+}
+static int helper_58(int x) { return x * 3 + 6; }
+int compute_58(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_59(int x) { return x * 4 + 7; }
+int compute_59(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_60(int x) { return x * 5 + 8; }
+int compute_60(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_60(obj.sum()) + obj.get_a();
+}
+static int helper_61(int x) { return x * 6 + 9; }
+int compute_61(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_62(int x) { return x * 7 + 10; }
+int compute_62(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_63(int x) { return x * 1 + 11; }
+int compute_63(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_63(obj.sum()) + obj.get_a();
+}
+static int helper_64(int x) { return x * 2 + 12; }
+int compute_64(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_65(int x) { return x * 3 + 0; }
+int compute_65(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_66(int x) { return x * 4 + 1; }
+int compute_66(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_66(obj.sum()) + obj.get_a();
+}
+static int helper_67(int x) { return x * 5 + 2; }
+int compute_67(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_68(int x) { return x * 6 + 3; }
+int compute_68(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_69(int x) { return x * 7 + 4; }
+int compute_69(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_69(obj.sum()) + obj.get_a();
+}
+static int helper_70(int x) { return x * 1 + 5; }
+int compute_70(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_71(int x) { return x * 2 + 6; }
+int compute_71(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_72(int x) { return x * 3 + 7; }
+int compute_72(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_72(obj.sum()) + obj.get_a();
+}
+static int helper_73(int x) { return x * 4 + 8; }
+int compute_73(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_74(int x) { return x * 5 + 9; }
+int compute_74(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_75(int x) { return x * 6 + 10; }
+int compute_75(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_75(obj.sum()) + obj.get_a();
+}
+static int helper_76(int x) { return x * 7 + 11; }
+int compute_76(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_77(int x) { return x * 1 + 12; }
+int compute_77(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_78(int x) { return x * 2 + 0; }
+int compute_78(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_78(obj.sum()) + obj.get_a();
+}
+static int helper_79(int x) { return x * 3 + 1; }
+int compute_79(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_80(int x) { return x * 4 + 2; }
+int compute_80(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_81(int x) { return x * 5 + 3; }
+int compute_81(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_81(obj.sum()) + obj.get_a();
+}
+static int helper_82(int x) { return x * 6 + 4; }
+int compute_82(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_83(int x) { return x * 7 + 5; }
+int compute_83(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_84(int x) { return x * 1 + 6; }
+int compute_84(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_84(obj.sum()) + obj.get_a();
+}
+static int helper_85(int x) { return x * 2 + 7; }
+int compute_85(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_86(int x) { return x * 3 + 8; }
+int compute_86(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_87(int x) { return x * 4 + 9; }
+int compute_87(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_87(obj.sum()) + obj.get_a();
+}
+static int helper_88(int x) { return x * 5 + 10; }
+int compute_88(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_89(int x) { return x * 6 + 11; }
+int compute_89(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_90(int x) { return x * 7 + 12; }
+int compute_90(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_90(obj.sum()) + obj.get_a();
+}
+static int helper_91(int x) { return x * 1 + 0; }
+int compute_91(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_92(int x) { return x * 2 + 1; }
+int compute_92(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_93(int x) { return x * 3 + 2; }
+int compute_93(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_93(obj.sum()) + obj.get_a();
+}
+static int helper_94(int x) { return x * 4 + 3; }
+int compute_94(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_95(int x) { return x * 5 + 4; }
+int compute_95(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_96(int x) { return x * 6 + 5; }
+int compute_96(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_96(obj.sum()) + obj.get_a();
+}
+static int helper_97(int x) { return x * 7 + 6; }
+int compute_97(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_98(int x) { return x * 1 + 7; }
+int compute_98(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_99(int x) { return x * 2 + 8; }
+int compute_99(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_99(obj.sum()) + obj.get_a();
+}
+static int helper_100(int x) { return x * 3 + 9; }
+int compute_100(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_101(int x) { return x * 4 + 10; }
+int compute_101(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_102(int x) { return x * 5 + 11; }
+int compute_102(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_102(obj.sum()) + obj.get_a();
+}
+static int helper_103(int x) { return x * 6 + 12; }
+int compute_103(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_104(int x) { return x * 7 + 0; }
+int compute_104(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_105(int x) { return x * 1 + 1; }
+int compute_105(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_105(obj.sum()) + obj.get_a();
+}
+static int helper_106(int x) { return x * 2 + 2; }
+int compute_106(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_107(int x) { return x * 3 + 3; }
+int compute_107(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_108(int x) { return x * 4 + 4; }
+int compute_108(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_108(obj.sum()) + obj.get_a();
+}
+static int helper_109(int x) { return x * 5 + 5; }
+int compute_109(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_110(int x) { return x * 6 + 6; }
+int compute_110(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_111(int x) { return x * 7 + 7; }
+int compute_111(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_111(obj.sum()) + obj.get_a();
+}
+static int helper_112(int x) { return x * 1 + 8; }
+int compute_112(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_113(int x) { return x * 2 + 9; }
+int compute_113(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_114(int x) { return x * 3 + 10; }
+int compute_114(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_114(obj.sum()) + obj.get_a();
+}
+static int helper_115(int x) { return x * 4 + 11; }
+int compute_115(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_116(int x) { return x * 5 + 12; }
+int compute_116(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_117(int x) { return x * 6 + 0; }
+int compute_117(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_117(obj.sum()) + obj.get_a();
+}
+static int helper_118(int x) { return x * 7 + 1; }
+int compute_118(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_119(int x) { return x * 1 + 2; }
+int compute_119(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_120(int x) { return x * 2 + 3; }
+int compute_120(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_120(obj.sum()) + obj.get_a();
+}
+static int helper_121(int x) { return x * 3 + 4; }
+int compute_121(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_122(int x) { return x * 4 + 5; }
+int compute_122(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_123(int x) { return x * 5 + 6; }
+int compute_123(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_123(obj.sum()) + obj.get_a();
+}
+static int helper_124(int x) { return x * 6 + 7; }
+int compute_124(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_125(int x) { return x * 7 + 8; }
+int compute_125(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_126(int x) { return x * 1 + 9; }
+int compute_126(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_126(obj.sum()) + obj.get_a();
+}
+static int helper_127(int x) { return x * 2 + 10; }
+int compute_127(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_128(int x) { return x * 3 + 11; }
+int compute_128(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_129(int x) { return x * 4 + 12; }
+int compute_129(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_129(obj.sum()) + obj.get_a();
+}
+static int helper_130(int x) { return x * 5 + 0; }
+int compute_130(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_131(int x) { return x * 6 + 1; }
+int compute_131(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_132(int x) { return x * 7 + 2; }
+int compute_132(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_132(obj.sum()) + obj.get_a();
+}
+static int helper_133(int x) { return x * 1 + 3; }
+int compute_133(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_134(int x) { return x * 2 + 4; }
+int compute_134(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_135(int x) { return x * 3 + 5; }
+int compute_135(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_135(obj.sum()) + obj.get_a();
+}
+static int helper_136(int x) { return x * 4 + 6; }
+int compute_136(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_137(int x) { return x * 5 + 7; }
+int compute_137(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_138(int x) { return x * 6 + 8; }
+int compute_138(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_138(obj.sum()) + obj.get_a();
+}
+static int helper_139(int x) { return x * 7 + 9; }
+int compute_139(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_140(int x) { return x * 1 + 10; }
+int compute_140(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_141(int x) { return x * 2 + 11; }
+int compute_141(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_141(obj.sum()) + obj.get_a();
+}
+static int helper_142(int x) { return x * 3 + 12; }
+int compute_142(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_143(int x) { return x * 4 + 0; }
+int compute_143(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_144(int x) { return x * 5 + 1; }
+int compute_144(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_144(obj.sum()) + obj.get_a();
+}
+static int helper_145(int x) { return x * 6 + 2; }
+int compute_145(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_146(int x) { return x * 7 + 3; }
+int compute_146(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_147(int x) { return x * 1 + 4; }
+int compute_147(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_147(obj.sum()) + obj.get_a();
+}
+static int helper_148(int x) { return x * 2 + 5; }
+int compute_148(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_149(int x) { return x * 3 + 6; }
+int compute_149(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_150(int x) { return x * 4 + 7; }
+int compute_150(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_150(obj.sum()) + obj.get_a();
+}
+static int helper_151(int x) { return x * 5 + 8; }
+int compute_151(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_152(int x) { return x * 6 + 9; }
+int compute_152(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_153(int x) { return x * 7 + 10; }
+int compute_153(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_153(obj.sum()) + obj.get_a();
+}
+static int helper_154(int x) { return x * 1 + 11; }
+int compute_154(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_155(int x) { return x * 2 + 12; }
+int compute_155(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_156(int x) { return x * 3 + 0; }
+int compute_156(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_156(obj.sum()) + obj.get_a();
+}
+static int helper_157(int x) { return x * 4 + 1; }
+int compute_157(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_158(int x) { return x * 5 + 2; }
+int compute_158(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_159(int x) { return x * 6 + 3; }
+int compute_159(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_159(obj.sum()) + obj.get_a();
+}
+static int helper_160(int x) { return x * 7 + 4; }
+int compute_160(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_161(int x) { return x * 1 + 5; }
+int compute_161(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_162(int x) { return x * 2 + 6; }
+int compute_162(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_162(obj.sum()) + obj.get_a();
+}
+static int helper_163(int x) { return x * 3 + 7; }
+int compute_163(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_164(int x) { return x * 4 + 8; }
+int compute_164(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_165(int x) { return x * 5 + 9; }
+int compute_165(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_165(obj.sum()) + obj.get_a();
+}
+static int helper_166(int x) { return x * 6 + 10; }
+int compute_166(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_167(int x) { return x * 7 + 11; }
+int compute_167(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_168(int x) { return x * 1 + 12; }
+int compute_168(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_168(obj.sum()) + obj.get_a();
+}
+static int helper_169(int x) { return x * 2 + 0; }
+int compute_169(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_170(int x) { return x * 3 + 1; }
+int compute_170(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_171(int x) { return x * 4 + 2; }
+int compute_171(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_171(obj.sum()) + obj.get_a();
+}
+static int helper_172(int x) { return x * 5 + 3; }
+int compute_172(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_173(int x) { return x * 6 + 4; }
+int compute_173(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_174(int x) { return x * 7 + 5; }
+int compute_174(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_174(obj.sum()) + obj.get_a();
+}
+static int helper_175(int x) { return x * 1 + 6; }
+int compute_175(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_176(int x) { return x * 2 + 7; }
+int compute_176(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_177(int x) { return x * 3 + 8; }
+int compute_177(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_177(obj.sum()) + obj.get_a();
+}
+static int helper_178(int x) { return x * 4 + 9; }
+int compute_178(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_179(int x) { return x * 5 + 10; }
+int compute_179(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_180(int x) { return x * 6 + 11; }
+int compute_180(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_180(obj.sum()) + obj.get_a();
+}
+static int helper_181(int x) { return x * 7 + 12; }
+int compute_181(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_182(int x) { return x * 1 + 0; }
+int compute_182(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_183(int x) { return x * 2 + 1; }
+int compute_183(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_183(obj.sum()) + obj.get_a();
+}
+static int helper_184(int x) { return x * 3 + 2; }
+int compute_184(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_185(int x) { return x * 4 + 3; }
+int compute_185(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_186(int x) { return x * 5 + 4; }
+int compute_186(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_186(obj.sum()) + obj.get_a();
+}
+static int helper_187(int x) { return x * 6 + 5; }
+int compute_187(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_188(int x) { return x * 7 + 6; }
+int compute_188(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_189(int x) { return x * 1 + 7; }
+int compute_189(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_189(obj.sum()) + obj.get_a();
+}
+static int helper_190(int x) { return x * 2 + 8; }
+int compute_190(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_191(int x) { return x * 3 + 9; }
+int compute_191(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_192(int x) { return x * 4 + 10; }
+int compute_192(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_192(obj.sum()) + obj.get_a();
+}
+static int helper_193(int x) { return x * 5 + 11; }
+int compute_193(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_194(int x) { return x * 6 + 12; }
+int compute_194(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_195(int x) { return x * 7 + 0; }
+int compute_195(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_195(obj.sum()) + obj.get_a();
+}
+static int helper_196(int x) { return x * 1 + 1; }
+int compute_196(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_197(int x) { return x * 2 + 2; }
+int compute_197(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_198(int x) { return x * 3 + 3; }
+int compute_198(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_198(obj.sum()) + obj.get_a();
+}
+static int helper_199(int x) { return x * 4 + 4; }
+int compute_199(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_200(int x) { return x * 5 + 5; }
+int compute_200(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_201(int x) { return x * 6 + 6; }
+int compute_201(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_201(obj.sum()) + obj.get_a();
+}
+static int helper_202(int x) { return x * 7 + 7; }
+int compute_202(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_203(int x) { return x * 1 + 8; }
+int compute_203(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_204(int x) { return x * 2 + 9; }
+int compute_204(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_204(obj.sum()) + obj.get_a();
+}
+static int helper_205(int x) { return x * 3 + 10; }
+int compute_205(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_206(int x) { return x * 4 + 11; }
+int compute_206(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_207(int x) { return x * 5 + 12; }
+int compute_207(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_207(obj.sum()) + obj.get_a();
+}
+static int helper_208(int x) { return x * 6 + 0; }
+int compute_208(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_209(int x) { return x * 7 + 1; }
+int compute_209(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_210(int x) { return x * 1 + 2; }
+int compute_210(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_210(obj.sum()) + obj.get_a();
+}
+static int helper_211(int x) { return x * 2 + 3; }
+int compute_211(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_212(int x) { return x * 3 + 4; }
+int compute_212(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_213(int x) { return x * 4 + 5; }
+int compute_213(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_213(obj.sum()) + obj.get_a();
+}
+static int helper_214(int x) { return x * 5 + 6; }
+int compute_214(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_215(int x) { return x * 6 + 7; }
+int compute_215(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_216(int x) { return x * 7 + 8; }
+int compute_216(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_216(obj.sum()) + obj.get_a();
+}
+static int helper_217(int x) { return x * 1 + 9; }
+int compute_217(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_218(int x) { return x * 2 + 10; }
+int compute_218(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_219(int x) { return x * 3 + 11; }
+int compute_219(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_219(obj.sum()) + obj.get_a();
+}
+static int helper_220(int x) { return x * 4 + 12; }
+int compute_220(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_221(int x) { return x * 5 + 0; }
+int compute_221(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_222(int x) { return x * 6 + 1; }
+int compute_222(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_222(obj.sum()) + obj.get_a();
+}
+static int helper_223(int x) { return x * 7 + 2; }
+int compute_223(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_224(int x) { return x * 1 + 3; }
+int compute_224(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_225(int x) { return x * 2 + 4; }
+int compute_225(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_225(obj.sum()) + obj.get_a();
+}
+static int helper_226(int x) { return x * 3 + 5; }
+int compute_226(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_227(int x) { return x * 4 + 6; }
+int compute_227(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_228(int x) { return x * 5 + 7; }
+int compute_228(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_228(obj.sum()) + obj.get_a();
+}
+static int helper_229(int x) { return x * 6 + 8; }
+int compute_229(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_230(int x) { return x * 7 + 9; }
+int compute_230(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_231(int x) { return x * 1 + 10; }
+int compute_231(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_231(obj.sum()) + obj.get_a();
+}
+static int helper_232(int x) { return x * 2 + 11; }
+int compute_232(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_233(int x) { return x * 3 + 12; }
+int compute_233(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_234(int x) { return x * 4 + 0; }
+int compute_234(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_234(obj.sum()) + obj.get_a();
+}
+static int helper_235(int x) { return x * 5 + 1; }
+int compute_235(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_236(int x) { return x * 6 + 2; }
+int compute_236(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_237(int x) { return x * 7 + 3; }
+int compute_237(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_237(obj.sum()) + obj.get_a();
+}
+static int helper_238(int x) { return x * 1 + 4; }
+int compute_238(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_239(int x) { return x * 2 + 5; }
+int compute_239(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_240(int x) { return x * 3 + 6; }
+int compute_240(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_240(obj.sum()) + obj.get_a();
+}
+static int helper_241(int x) { return x * 4 + 7; }
+int compute_241(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_242(int x) { return x * 5 + 8; }
+int compute_242(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_243(int x) { return x * 6 + 9; }
+int compute_243(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_243(obj.sum()) + obj.get_a();
+}
+static int helper_244(int x) { return x * 7 + 10; }
+int compute_244(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_245(int x) { return x * 1 + 11; }
+int compute_245(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_246(int x) { return x * 2 + 12; }
+int compute_246(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_246(obj.sum()) + obj.get_a();
+}
+static int helper_247(int x) { return x * 3 + 0; }
+int compute_247(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_248(int x) { return x * 4 + 1; }
+int compute_248(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_249(int x) { return x * 5 + 2; }
+int compute_249(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_249(obj.sum()) + obj.get_a();
+}
+static int helper_250(int x) { return x * 6 + 3; }
+int compute_250(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_251(int x) { return x * 7 + 4; }
+int compute_251(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_252(int x) { return x * 1 + 5; }
+int compute_252(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_252(obj.sum()) + obj.get_a();
+}
+static int helper_253(int x) { return x * 2 + 6; }
+int compute_253(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_254(int x) { return x * 3 + 7; }
+int compute_254(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_255(int x) { return x * 4 + 8; }
+int compute_255(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_255(obj.sum()) + obj.get_a();
+}
+static int helper_256(int x) { return x * 5 + 9; }
+int compute_256(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_257(int x) { return x * 6 + 10; }
+int compute_257(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_258(int x) { return x * 7 + 11; }
+int compute_258(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_258(obj.sum()) + obj.get_a();
+}
+static int helper_259(int x) { return x * 1 + 12; }
+int compute_259(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_260(int x) { return x * 2 + 0; }
+int compute_260(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_261(int x) { return x * 3 + 1; }
+int compute_261(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_261(obj.sum()) + obj.get_a();
+}
+static int helper_262(int x) { return x * 4 + 2; }
+int compute_262(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_263(int x) { return x * 5 + 3; }
+int compute_263(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_264(int x) { return x * 6 + 4; }
+int compute_264(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_264(obj.sum()) + obj.get_a();
+}
+static int helper_265(int x) { return x * 7 + 5; }
+int compute_265(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_266(int x) { return x * 1 + 6; }
+int compute_266(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_267(int x) { return x * 2 + 7; }
+int compute_267(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_267(obj.sum()) + obj.get_a();
+}
+static int helper_268(int x) { return x * 3 + 8; }
+int compute_268(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_269(int x) { return x * 4 + 9; }
+int compute_269(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_270(int x) { return x * 5 + 10; }
+int compute_270(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_270(obj.sum()) + obj.get_a();
+}
+static int helper_271(int x) { return x * 6 + 11; }
+int compute_271(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_272(int x) { return x * 7 + 12; }
+int compute_272(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_273(int x) { return x * 1 + 0; }
+int compute_273(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_273(obj.sum()) + obj.get_a();
+}
+static int helper_274(int x) { return x * 2 + 1; }
+int compute_274(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_275(int x) { return x * 3 + 2; }
+int compute_275(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_276(int x) { return x * 4 + 3; }
+int compute_276(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_276(obj.sum()) + obj.get_a();
+}
+static int helper_277(int x) { return x * 5 + 4; }
+int compute_277(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_278(int x) { return x * 6 + 5; }
+int compute_278(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_279(int x) { return x * 7 + 6; }
+int compute_279(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_279(obj.sum()) + obj.get_a();
+}
+static int helper_280(int x) { return x * 1 + 7; }
+int compute_280(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_281(int x) { return x * 2 + 8; }
+int compute_281(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_282(int x) { return x * 3 + 9; }
+int compute_282(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_282(obj.sum()) + obj.get_a();
+}
+static int helper_283(int x) { return x * 4 + 10; }
+int compute_283(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_284(int x) { return x * 5 + 11; }
+int compute_284(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_285(int x) { return x * 6 + 12; }
+int compute_285(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_285(obj.sum()) + obj.get_a();
+}
+static int helper_286(int x) { return x * 7 + 0; }
+int compute_286(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_287(int x) { return x * 1 + 1; }
+int compute_287(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_288(int x) { return x * 2 + 2; }
+int compute_288(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_288(obj.sum()) + obj.get_a();
+}
+static int helper_289(int x) { return x * 3 + 3; }
+int compute_289(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_290(int x) { return x * 4 + 4; }
+int compute_290(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_291(int x) { return x * 5 + 5; }
+int compute_291(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_291(obj.sum()) + obj.get_a();
+}
+static int helper_292(int x) { return x * 6 + 6; }
+int compute_292(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_293(int x) { return x * 7 + 7; }
+int compute_293(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_294(int x) { return x * 1 + 8; }
+int compute_294(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_294(obj.sum()) + obj.get_a();
+}
+static int helper_295(int x) { return x * 2 + 9; }
+int compute_295(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_296(int x) { return x * 3 + 10; }
+int compute_296(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_297(int x) { return x * 4 + 11; }
+int compute_297(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_297(obj.sum()) + obj.get_a();
+}
+static int helper_298(int x) { return x * 5 + 12; }
+int compute_298(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_299(int x) { return x * 6 + 0; }
+int compute_299(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_300(int x) { return x * 7 + 1; }
+int compute_300(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_300(obj.sum()) + obj.get_a();
+}
+static int helper_301(int x) { return x * 1 + 2; }
+int compute_301(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_302(int x) { return x * 2 + 3; }
+int compute_302(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_303(int x) { return x * 3 + 4; }
+int compute_303(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_303(obj.sum()) + obj.get_a();
+}
+static int helper_304(int x) { return x * 4 + 5; }
+int compute_304(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_305(int x) { return x * 5 + 6; }
+int compute_305(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_306(int x) { return x * 6 + 7; }
+int compute_306(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_306(obj.sum()) + obj.get_a();
+}
+static int helper_307(int x) { return x * 7 + 8; }
+int compute_307(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_308(int x) { return x * 1 + 9; }
+int compute_308(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_309(int x) { return x * 2 + 10; }
+int compute_309(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_309(obj.sum()) + obj.get_a();
+}
+static int helper_310(int x) { return x * 3 + 11; }
+int compute_310(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_311(int x) { return x * 4 + 12; }
+int compute_311(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_312(int x) { return x * 5 + 0; }
+int compute_312(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_312(obj.sum()) + obj.get_a();
+}
+static int helper_313(int x) { return x * 6 + 1; }
+int compute_313(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_314(int x) { return x * 7 + 2; }
+int compute_314(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_315(int x) { return x * 1 + 3; }
+int compute_315(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_315(obj.sum()) + obj.get_a();
+}
+static int helper_316(int x) { return x * 2 + 4; }
+int compute_316(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_317(int x) { return x * 3 + 5; }
+int compute_317(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_318(int x) { return x * 4 + 6; }
+int compute_318(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_318(obj.sum()) + obj.get_a();
+}
+static int helper_319(int x) { return x * 5 + 7; }
+int compute_319(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_320(int x) { return x * 6 + 8; }
+int compute_320(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_321(int x) { return x * 7 + 9; }
+int compute_321(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_321(obj.sum()) + obj.get_a();
+}
+static int helper_322(int x) { return x * 1 + 10; }
+int compute_322(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_323(int x) { return x * 2 + 11; }
+int compute_323(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_324(int x) { return x * 3 + 12; }
+int compute_324(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_324(obj.sum()) + obj.get_a();
+}
+static int helper_325(int x) { return x * 4 + 0; }
+int compute_325(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_326(int x) { return x * 5 + 1; }
+int compute_326(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_327(int x) { return x * 6 + 2; }
+int compute_327(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_327(obj.sum()) + obj.get_a();
+}
+static int helper_328(int x) { return x * 7 + 3; }
+int compute_328(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_329(int x) { return x * 1 + 4; }
+int compute_329(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_330(int x) { return x * 2 + 5; }
+int compute_330(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_330(obj.sum()) + obj.get_a();
+}
+static int helper_331(int x) { return x * 3 + 6; }
+int compute_331(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_332(int x) { return x * 4 + 7; }
+int compute_332(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_333(int x) { return x * 5 + 8; }
+int compute_333(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_333(obj.sum()) + obj.get_a();
+}
+static int helper_334(int x) { return x * 6 + 9; }
+int compute_334(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_335(int x) { return x * 7 + 10; }
+int compute_335(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_336(int x) { return x * 1 + 11; }
+int compute_336(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_336(obj.sum()) + obj.get_a();
+}
+static int helper_337(int x) { return x * 2 + 12; }
+int compute_337(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_338(int x) { return x * 3 + 0; }
+int compute_338(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_339(int x) { return x * 4 + 1; }
+int compute_339(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_339(obj.sum()) + obj.get_a();
+}
+static int helper_340(int x) { return x * 5 + 2; }
+int compute_340(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_341(int x) { return x * 6 + 3; }
+int compute_341(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_342(int x) { return x * 7 + 4; }
+int compute_342(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_342(obj.sum()) + obj.get_a();
+}
+static int helper_343(int x) { return x * 1 + 5; }
+int compute_343(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_344(int x) { return x * 2 + 6; }
+int compute_344(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_345(int x) { return x * 3 + 7; }
+int compute_345(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_345(obj.sum()) + obj.get_a();
+}
+static int helper_346(int x) { return x * 4 + 8; }
+int compute_346(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_347(int x) { return x * 5 + 9; }
+int compute_347(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_348(int x) { return x * 6 + 10; }
+int compute_348(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_348(obj.sum()) + obj.get_a();
+}
+static int helper_349(int x) { return x * 7 + 11; }
+int compute_349(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_350(int x) { return x * 1 + 12; }
+int compute_350(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_351(int x) { return x * 2 + 0; }
+int compute_351(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_351(obj.sum()) + obj.get_a();
+}
+static int helper_352(int x) { return x * 3 + 1; }
+int compute_352(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_353(int x) { return x * 4 + 2; }
+int compute_353(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_354(int x) { return x * 5 + 3; }
+int compute_354(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_354(obj.sum()) + obj.get_a();
+}
+static int helper_355(int x) { return x * 6 + 4; }
+int compute_355(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_356(int x) { return x * 7 + 5; }
+int compute_356(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_357(int x) { return x * 1 + 6; }
+int compute_357(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_357(obj.sum()) + obj.get_a();
+}
+static int helper_358(int x) { return x * 2 + 7; }
+int compute_358(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_359(int x) { return x * 3 + 8; }
+int compute_359(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_360(int x) { return x * 4 + 9; }
+int compute_360(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_360(obj.sum()) + obj.get_a();
+}
+static int helper_361(int x) { return x * 5 + 10; }
+int compute_361(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_362(int x) { return x * 6 + 11; }
+int compute_362(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_363(int x) { return x * 7 + 12; }
+int compute_363(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_363(obj.sum()) + obj.get_a();
+}
+static int helper_364(int x) { return x * 1 + 0; }
+int compute_364(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_365(int x) { return x * 2 + 1; }
+int compute_365(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_366(int x) { return x * 3 + 2; }
+int compute_366(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_366(obj.sum()) + obj.get_a();
+}
+static int helper_367(int x) { return x * 4 + 3; }
+int compute_367(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_368(int x) { return x * 5 + 4; }
+int compute_368(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_369(int x) { return x * 6 + 5; }
+int compute_369(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_369(obj.sum()) + obj.get_a();
+}
+static int helper_370(int x) { return x * 7 + 6; }
+int compute_370(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_371(int x) { return x * 1 + 7; }
+int compute_371(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_372(int x) { return x * 2 + 8; }
+int compute_372(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_372(obj.sum()) + obj.get_a();
+}
+static int helper_373(int x) { return x * 3 + 9; }
+int compute_373(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_374(int x) { return x * 4 + 10; }
+int compute_374(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_375(int x) { return x * 5 + 11; }
+int compute_375(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_375(obj.sum()) + obj.get_a();
+}
+static int helper_376(int x) { return x * 6 + 12; }
+int compute_376(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_377(int x) { return x * 7 + 0; }
+int compute_377(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_378(int x) { return x * 1 + 1; }
+int compute_378(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_378(obj.sum()) + obj.get_a();
+}
+static int helper_379(int x) { return x * 2 + 2; }
+int compute_379(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_380(int x) { return x * 3 + 3; }
+int compute_380(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_381(int x) { return x * 4 + 4; }
+int compute_381(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_381(obj.sum()) + obj.get_a();
+}
+static int helper_382(int x) { return x * 5 + 5; }
+int compute_382(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_383(int x) { return x * 6 + 6; }
+int compute_383(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_384(int x) { return x * 7 + 7; }
+int compute_384(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_384(obj.sum()) + obj.get_a();
+}
+static int helper_385(int x) { return x * 1 + 8; }
+int compute_385(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_386(int x) { return x * 2 + 9; }
+int compute_386(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_387(int x) { return x * 3 + 10; }
+int compute_387(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_387(obj.sum()) + obj.get_a();
+}
+static int helper_388(int x) { return x * 4 + 11; }
+int compute_388(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_389(int x) { return x * 5 + 12; }
+int compute_389(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_390(int x) { return x * 6 + 0; }
+int compute_390(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  return helper_390(obj.sum()) + obj.get_a();
+}
+static int helper_391(int x) { return x * 7 + 1; }
+int compute_391(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_392(int x) { return x * 1 + 2; }
+int compute_392(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_393(int x) { return x * 2 + 3; }
+int compute_393(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_393(obj.sum()) + obj.get_a();
+}
+static int helper_394(int x) { return x * 3 + 4; }
+int compute_394(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_395(int x) { return x * 4 + 5; }
+int compute_395(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_396(int x) { return x * 5 + 6; }
+int compute_396(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_396(obj.sum()) + obj.get_a();
+}
+static int helper_397(int x) { return x * 6 + 7; }
+int compute_397(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_398(int x) { return x * 7 + 8; }
+int compute_398(int a, int b) {
+  ns2::C2_2 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_399(int x) { return x * 1 + 9; }
+int compute_399(int a, int b) {
+  ns3::C3_3 obj = { a, b };
+  return helper_399(obj.sum()) + obj.get_a();
+}
+int main() { return compute_0(1, 2); }
@@ -0,0 +1,256 @@
+// Synthetic preprocessed-style corpus file for the clang_delta
+// benchmark target.  Regenerate only when the benchmark baseline
+// is regenerated as well; timings are only comparable on an
+// identical corpus.
+
+namespace ns0 {
+struct C0_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C0_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+namespace ns1 {
+struct C1_0 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+struct C1_1 {
+  int field_a; int field_b;
+  int get_a() const { return field_a; }
+  int sum() const { return field_a + field_b; }
+};
+}
+static int helper_0(int x) { return x * 1 + 0; }
+int compute_0(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_0(obj.sum()) + obj.get_a();
+}
+static int helper_1(int x) { return x * 2 + 1; }
+int compute_1(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_2(int x) { return x * 3 + 2; }
+int compute_2(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_3(int x) { return x * 4 + 3; }
+int compute_3(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_3(obj.sum()) + obj.get_a();
+}
+static int helper_4(int x) { return x * 5 + 4; }
+int compute_4(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_5(int x) { return x * 6 + 5; }
+int compute_5(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_6(int x) { return x * 7 + 6; }
+int compute_6(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_6(obj.sum()) + obj.get_a();
+}
+static int helper_7(int x) { return x * 1 + 7; }
+int compute_7(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_8(int x) { return x * 2 + 8; }
+int compute_8(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_9(int x) { return x * 3 + 9; }
+int compute_9(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_9(obj.sum()) + obj.get_a();
+}
+static int helper_10(int x) { return x * 4 + 10; }
+int compute_10(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_11(int x) { return x * 5 + 11; }
+int compute_11(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_12(int x) { return x * 6 + 12; }
+int compute_12(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_12(obj.sum()) + obj.get_a();
+}
+static int helper_13(int x) { return x * 7 + 0; }
+int compute_13(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_14(int x) { return x * 1 + 1; }
+int compute_14(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_15(int x) { return x * 2 + 2; }
+int compute_15(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_15(obj.sum()) + obj.get_a();
+}
+static int helper_16(int x) { return x * 3 + 3; }
+int compute_16(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_17(int x) { return x * 4 + 4; }
+int compute_17(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_18(int x) { return x * 5 + 5; }
+int compute_18(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_18(obj.sum()) + obj.get_a();
+}
+static int helper_19(int x) { return x * 6 + 6; }
+int compute_19(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_20(int x) { return x * 7 + 7; }
+int compute_20(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_21(int x) { return x * 1 + 8; }
+int compute_21(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_21(obj.sum()) + obj.get_a();
+}
+static int helper_22(int x) { return x * 2 + 9; }
+int compute_22(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_23(int x) { return x * 3 + 10; }
+int compute_23(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_24(int x) { return x * 4 + 11; }
+int compute_24(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_24(obj.sum()) + obj.get_a();
+}
+static int helper_25(int x) { return x * 5 + 12; }
+int compute_25(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_26(int x) { return x * 6 + 0; }
+int compute_26(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_27(int x) { return x * 7 + 1; }
+int compute_27(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_27(obj.sum()) + obj.get_a();
+}
+static int helper_28(int x) { return x * 1 + 2; }
+int compute_28(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_29(int x) { return x * 2 + 3; }
+int compute_29(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_30(int x) { return x * 3 + 4; }
+int compute_30(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_30(obj.sum()) + obj.get_a();
+}
+static int helper_31(int x) { return x * 4 + 5; }
+int compute_31(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 2;
+  return t - obj.field_b;
+}
+static int helper_32(int x) { return x * 5 + 6; }
+int compute_32(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_33(int x) { return x * 6 + 7; }
+int compute_33(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_33(obj.sum()) + obj.get_a();
+}
+static int helper_34(int x) { return x * 7 + 8; }
+int compute_34(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 5;
+  return t - obj.field_b;
+}
+static int helper_35(int x) { return x * 1 + 9; }
+int compute_35(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 1;
+  return t - obj.field_b;
+}
+static int helper_36(int x) { return x * 2 + 10; }
+int compute_36(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  return helper_36(obj.sum()) + obj.get_a();
+}
+static int helper_37(int x) { return x * 3 + 11; }
+int compute_37(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  int t = a + b * 3;
+  return t - obj.field_b;
+}
+static int helper_38(int x) { return x * 4 + 12; }
+int compute_38(int a, int b) {
+  ns0::C0_0 obj = { a, b };
+  int t = a + b * 4;
+  return t - obj.field_b;
+}
+static int helper_39(int x) { return x * 5 + 0; }
+int compute_39(int a, int b) {
+  ns1::C1_1 obj = { a, b };
+  return helper_39(obj.sum()) + obj.get_a();
+}
+int main() { return compute_0(1, 2); }
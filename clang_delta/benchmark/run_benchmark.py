@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Run a fixed set of clang_delta transformations against the reference
+corpus and write per-phase times, peak RSS and hardware counters as JSON.
+
+Each (corpus file, transformation) pair is run once with --counter=1 and
+--time-report; the per-phase times come from clang_delta's own time
+report on stderr and the peak RSS from the child's rusage.  When the
+kernel allows it, perf_event_open counters (cycles, instructions, LLC
+misses, dTLB misses) are attached to the child before it execs, so the
+report can distinguish "slower because of more work" (instructions up at
+flat IPC) from "slower because of worse locality" (IPC down, misses up).
+Compare two result files with compare_benchmark.py.
+"""
+
+import argparse
+import ctypes
+import json
+import os
+import platform
+import signal
+import struct
+import sys
+import time
+
+TRANSFORMATIONS = [
+    'remove-unused-function',
+    'rename-fun',
+    'rename-var',
+    'remove-namespace',
+    'simple-inliner',
+]
+
+# (result key, perf_event_attr type, config).  The cache configs encode
+# cache id | (read op << 8) | (miss result << 16).
+PERF_EVENTS = [
+    ('cycles', 0, 0),            # PERF_TYPE_HARDWARE / CPU_CYCLES
+    ('instructions', 0, 1),      # PERF_TYPE_HARDWARE / INSTRUCTIONS
+    ('llc_misses', 3, 0x10002),  # PERF_TYPE_HW_CACHE / LL read misses
+    ('dtlb_misses', 3, 0x10003), # PERF_TYPE_HW_CACHE / dTLB read misses
+]
+
+_PERF_SYSCALL = {'x86_64': 298, 'aarch64': 241}.get(platform.machine())
+
+
+def open_counters(pid):
+    """Open the hardware counters on a stopped child, or return None when
+    the architecture, the kernel (perf_event_paranoid) or the hardware
+    does not cooperate; the harness then degrades to wall time and RSS."""
+    if _PERF_SYSCALL is None:
+        return None
+    libc = ctypes.CDLL(None, use_errno=True)
+    fds = []
+    for _, event_type, config in PERF_EVENTS:
+        # Minimal perf_event_attr: type, size, config, then the flags
+        # word (inherit | exclude_kernel | exclude_hv); the zero-padded
+        # tail leaves every later field at its default.
+        attr = struct.pack('IIQQQQQ', event_type, 128, config,
+                           0, 0, 0, 2 | 32 | 64)
+        buf = ctypes.create_string_buffer(attr, 128)
+        fd = libc.syscall(_PERF_SYSCALL, buf, pid, -1, -1, 0)
+        if fd < 0:
+            for open_fd in fds:
+                os.close(open_fd)
+            return None
+        fds.append(fd)
+    return fds
+
+
+def read_counters(fds):
+    counters = {}
+    for (name, _, _), fd in zip(PERF_EVENTS, fds):
+        counters[name] = struct.unpack('q', os.read(fd, 8))[0]
+        os.close(fd)
+    if counters['cycles'] > 0:
+        counters['ipc'] = round(
+            counters['instructions'] / counters['cycles'], 3)
+    return counters
+
+
+def run_one(clang_delta, transformation, corpus_file):
+    cmd = [
+        clang_delta,
+        f'--transformation={transformation}',
+        '--counter=1',
+        '--time-report',
+        corpus_file,
+    ]
+    stderr_read, stderr_write = os.pipe()
+    pid = os.fork()
+    if pid == 0:
+        os.close(stderr_read)
+        devnull = os.open(os.devnull, os.O_WRONLY)
+        os.dup2(devnull, 1)
+        os.dup2(stderr_write, 2)
+        # Stop before exec so the parent can attach the counters first;
+        # that way even loader startup is counted.
+        os.kill(os.getpid(), signal.SIGSTOP)
+        try:
+            os.execv(cmd[0], cmd)
+        finally:
+            os._exit(127)
+    os.close(stderr_write)
+
+    os.waitpid(pid, os.WUNTRACED)
+    fds = open_counters(pid)
+    start = time.monotonic()
+    os.kill(pid, signal.SIGCONT)
+
+    chunks = []
+    while True:
+        chunk = os.read(stderr_read, 65536)
+        if not chunk:
+            break
+        chunks.append(chunk)
+    os.close(stderr_read)
+    _, status, rusage = os.wait4(pid, 0)
+    wall = time.monotonic() - start
+
+    result = {
+        'wall': round(wall, 6),
+        'exit_status': status,
+        # ru_maxrss is in kilobytes on Linux.
+        'peak_rss_kb': rusage.ru_maxrss,
+    }
+    if fds:
+        result['counters'] = read_counters(fds)
+    for line in b''.join(chunks).decode('utf-8', 'replace').splitlines():
+        line = line.strip()
+        if line.startswith('{') and line.endswith('}'):
+            try:
+                result['phases'] = json.loads(line)
+                break
+            except ValueError:
+                pass
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--clang-delta', required=True,
+                        help='path to the clang_delta binary')
+    parser.add_argument('--corpus-dir', required=True,
+                        help='directory with the corpus files')
+    parser.add_argument('--output', required=True,
+                        help='where to write the JSON results')
+    args = parser.parse_args()
+
+    corpus_files = sorted(
+        f for f in os.listdir(args.corpus_dir)
+        if f.endswith(('.c', '.cpp')))
+    if not corpus_files:
+        sys.exit(f'no corpus files found in {args.corpus_dir}')
+
+    results = {}
+    for corpus in corpus_files:
+        corpus_path = os.path.join(args.corpus_dir, corpus)
+        results[corpus] = {}
+        for transformation in TRANSFORMATIONS:
+            print(f'{corpus} / {transformation} ... ', end='', flush=True)
+            result = run_one(args.clang_delta, transformation, corpus_path)
+            results[corpus][transformation] = result
+            line = f"{result['wall']:.3f}s, {result['peak_rss_kb']} kB"
+            counters = result.get('counters')
+            if counters and 'ipc' in counters:
+                line += (f", IPC {counters['ipc']:.2f}, "
+                         f"{counters['llc_misses']} LLC misses")
+            print(line)
+
+    with open(args.output, 'w') as f:
+        json.dump(results, f, indent=2)
+        f.write('\n')
+    print(f'results written to {args.output}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,11 @@
+enum E { A = 1, B = 2, C };
+
+class S {
+public:
+  S();
+  int x;
+};
+
+S::S() : x(2) {}
+
+int foo() { return A + B; }
@@ -0,0 +1,3 @@
+enum day { MON = 1, TUE = 2, WED };
+
+int pick(void) { return MON + TUE; }
@@ -0,0 +1,6 @@
+int p1;
+int ext(void);
+
+int compute(int value, int other) {
+  return ext() + p1 + value + other;
+}
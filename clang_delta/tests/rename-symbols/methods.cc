@@ -0,0 +1,10 @@
+class Widget {
+public:
+  int area(int width) { return width * size; }
+  int size;
+};
+
+int scale(int factor) {
+  Widget w;
+  return w.area(factor);
+}
@@ -0,0 +1,6 @@
+int printf(const char *, ...);
+
+int main(int argc, char **argv) {
+  printf("%d", argc);
+  return 0;
+}
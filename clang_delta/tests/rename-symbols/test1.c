@@ -0,0 +1,13 @@
+int counter;
+
+int add(int value, int extra);
+
+int add(int first, int second) {
+  int sum = first + second + counter;
+  return sum;
+}
+
+int main(void) {
+  counter = add(1, 2);
+  return counter;
+}
@@ -0,0 +1,8 @@
+int foo(int x) {
+  return x + 1;
+}
+
+int main(void) {
+  int r = foo(2);
+  return r;
+}
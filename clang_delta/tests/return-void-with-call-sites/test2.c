@@ -0,0 +1,12 @@
+int counter;
+
+int bump(int n) {
+  if (n > 1)
+    return bump(n - 1);
+  counter = counter + 1;
+  return counter;
+}
+
+void run(void) {
+  bump(3);
+}
@@ -891,6 +891,36 @@ class TestClangDelta(unittest.TestCase):
             'Error: No modification to the transformed program!',
         )
 
+    def test_rename_symbols_test1(self):
+        # functions, positionally renamed parameters across redeclarations
+        # and variables, all in one instance
+        self.check_query_instances(
+            'rename-symbols/test1.c',
+            '--query-instances=rename-symbols',
+            'Available transformation instances: 1',
+        )
+        self.check_clang_delta('rename-symbols/test1.c', '--transformation=rename-symbols --counter=1')
+
+    def test_rename_symbols_capture(self):
+        # existing p1/fn-spelled symbols must not be captured; the
+        # declaration-only callee is still found and renamed
+        self.check_clang_delta('rename-symbols/capture.c', '--transformation=rename-symbols --counter=1')
+
+    def test_rename_symbols_special(self):
+        # main and printf keep their names, their parameters still rename
+        self.check_clang_delta('rename-symbols/special.c', '--transformation=rename-symbols --counter=1')
+
+    def test_rename_symbols_methods(self):
+        # C++ methods are left to rename-cxx-method
+        self.check_clang_delta('rename-symbols/methods.cc', '--transformation=rename-symbols --counter=1')
+
+    def test_rename_symbols_noop(self):
+        self.check_query_instances(
+            'rename-symbols/noop.c',
+            '--query-instances=rename-symbols',
+            'Available transformation instances: 0',
+        )
+
     def test_rename_var_rename_var(self):
         self.check_clang_delta('rename-var/rename-var.c', '--transformation=rename-var --counter=1')
 
@@ -978,6 +1008,18 @@ class TestClangDelta(unittest.TestCase):
     def test_return_void_test9(self):
         self.check_clang_delta('return-void/test9.c', '--transformation=return-void --counter=1')
 
+    def test_return_void_with_call_sites_test1(self):
+        self.check_clang_delta(
+            'return-void-with-call-sites/test1.c',
+            '--transformation=return-void-with-call-sites --counter=1',
+        )
+
+    def test_return_void_with_call_sites_test2(self):
+        self.check_clang_delta(
+            'return-void-with-call-sites/test2.c',
+            '--transformation=return-void-with-call-sites --counter=1',
+        )
+
     def test_simplify_callexpr_macro(self):
         self.check_clang_delta(
             'simplify-callexpr/macro.c',
@@ -1101,6 +1143,74 @@ class TestClangDelta(unittest.TestCase):
     def test_merge_base_class_test3(self):
         self.check_clang_delta('merge-base-class/test3.cc', '--transformation=merge-base-class --counter=1')
 
+    def test_micro_pass_fusion_query_instances(self):
+        # one instance per non-empty category plus one combined
+        self.check_query_instances(
+            'micro-pass-fusion/test1.cc',
+            '--query-instances=micro-pass-fusion',
+            'Available transformation instances: 5',
+        )
+
+    def test_micro_pass_fusion_ctor_initializers(self):
+        self.check_clang_delta(
+            'micro-pass-fusion/test1.cc',
+            '--transformation=micro-pass-fusion --counter=1',
+            output_file='micro-pass-fusion/test1.cc.ctor-initializers.output',
+        )
+
+    def test_micro_pass_fusion_enum_member_values(self):
+        self.check_clang_delta(
+            'micro-pass-fusion/test1.cc',
+            '--transformation=micro-pass-fusion --counter=2',
+            output_file='micro-pass-fusion/test1.cc.enum-member-values.output',
+        )
+
+    def test_micro_pass_fusion_unused_enum_members(self):
+        self.check_clang_delta(
+            'micro-pass-fusion/test1.cc',
+            '--transformation=micro-pass-fusion --counter=3',
+            output_file='micro-pass-fusion/test1.cc.unused-enum-members.output',
+        )
+
+    def test_micro_pass_fusion_class_to_struct(self):
+        self.check_clang_delta(
+            'micro-pass-fusion/test1.cc',
+            '--transformation=micro-pass-fusion --counter=4',
+            output_file='micro-pass-fusion/test1.cc.class-to-struct.output',
+        )
+
+    def test_micro_pass_fusion_combined(self):
+        self.check_clang_delta(
+            'micro-pass-fusion/test1.cc',
+            '--transformation=micro-pass-fusion --counter=5',
+            output_file='micro-pass-fusion/test1.cc.combined.output',
+        )
+
+    def test_micro_pass_fusion_single_category(self):
+        # a single non-empty category earns no combined instance
+        self.check_query_instances(
+            'micro-pass-fusion/test2.cc',
+            '--query-instances=micro-pass-fusion',
+            'Available transformation instances: 1',
+        )
+        self.check_clang_delta(
+            'micro-pass-fusion/test2.cc',
+            '--transformation=micro-pass-fusion --counter=1',
+            output_file='micro-pass-fusion/test2.output',
+        )
+
+    def test_micro_pass_fusion_enums_only(self):
+        self.check_query_instances(
+            'micro-pass-fusion/test3.c',
+            '--query-instances=micro-pass-fusion',
+            'Available transformation instances: 3',
+        )
+        self.check_clang_delta(
+            'micro-pass-fusion/test3.c',
+            '--transformation=micro-pass-fusion --counter=3',
+            output_file='micro-pass-fusion/test3.output',
+        )
+
     def test_remove_base_class_test1(self):
         self.check_clang_delta(
             'remove-base-class/test1.cc',
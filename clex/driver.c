@@ -14,11 +14,36 @@
 #undef NDEBUG
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _MSC_VER
+#  include <fcntl.h>
+#  include <pthread.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <sys/time.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#  define CLEX_TLS __thread
+#else
+// single-threaded on MSVC; the batch modes fall back to a plain loop
+#  define CLEX_TLS
+#endif
+
 #include "defs.h"
+#include "uringw.h"
+
+// provided by the flex-generated scanner
+struct yy_buffer_state;
+extern struct yy_buffer_state *yy_scan_buffer(char *base, size_t size);
+
+static uint64_t hash_bytes(const char *buf, size_t len);
+#ifndef _MSC_VER
+static void detach_token_shm(void);
+#endif
 
 #ifdef _MSC_VER
 // MSVC lacks this compiler builtin
@@ -28,35 +53,99 @@ __declspec(noreturn) void __builtin_unreachable()
 }
 #endif
 
-struct tok_t {
-  char *str;
-  enum tok_kind kind;
-  int id;
-};
-
-static struct tok_t *tok_list;
+/*
+ * The token table is a pair of parallel arrays -- a 32-bit arena offset
+ * and an 8-bit kind per token -- rather than an array of structs with a
+ * pointer, an enum and an int (24 bytes each on LP64).  The candidate
+ * modes are linear scans over this table and are bound by memory
+ * bandwidth, so five bytes per token instead of 24 is a direct win, and
+ * huge inputs stop costing gigabytes of table.  The per-token rename
+ * ids live in their own array that only the rename mode allocates.
+ */
+static uint32_t *tok_off;
+static uint8_t *tok_kinds;
+static int *tok_ids;
 static int toks;
 static int max_toks;
-static const int initial_length = 1;
+
+/*
+ * Token text lives in one append-only arena instead of a strdup per
+ * token.  Every token is a substring of the input and gets one
+ * terminating NUL, so twice the input size bounds the arena; it is
+ * allocated up-front and never grows, which keeps the str pointers
+ * stable and replaces millions of small mallocs with one big one.
+ */
+static char *tok_arena;
+static size_t arena_used;
+static size_t arena_cap;
+
+static char *tok_str(int i) {
+  return tok_arena + tok_off[i];
+}
+
+static enum tok_kind tok_kind(int i) {
+  // kinds are stored relative to the enum base: tok_kind values start
+  // at 999 and would not survive the truncation to one byte as-is
+  return (enum tok_kind)(tok_kinds[i] + TOK_KEYWORD);
+}
+
+static void init_tok_storage(size_t input_size) {
+  arena_cap = 2 * input_size + 16;
+  // the offsets are 32-bit
+  assert(arena_cap <= UINT32_MAX);
+  tok_arena = (char *)malloc(arena_cap);
+  assert(tok_arena);
+  // most tokens are longer than one character; grow later if not
+  max_toks = (int)(input_size / 2 + 16);
+  tok_off = (uint32_t *)malloc(max_toks * sizeof(uint32_t));
+  tok_kinds = (uint8_t *)malloc(max_toks * sizeof(uint8_t));
+  assert(tok_off && tok_kinds);
+}
 
 static int add_tok(char *str, enum tok_kind kind) {
   assert(str);
   if (toks >= max_toks) {
     max_toks *= 2;
-    tok_list =
-        (struct tok_t *)realloc(tok_list, max_toks * sizeof(struct tok_t));
-    assert(tok_list);
-  }
-  tok_list[toks].str = strdup(str);
-  assert(tok_list[toks].str);
-  tok_list[toks].kind = kind;
-  tok_list[toks].id = -1;
+    tok_off = (uint32_t *)realloc(tok_off, max_toks * sizeof(uint32_t));
+    tok_kinds = (uint8_t *)realloc(tok_kinds, max_toks * sizeof(uint8_t));
+    assert(tok_off && tok_kinds);
+  }
+  size_t len = strlen(str) + 1;
+  assert(arena_used + len <= arena_cap);
+  memcpy(tok_arena + arena_used, str, len);
+  tok_off[toks] = (uint32_t)arena_used;
+  tok_kinds[toks] = (uint8_t)(kind - TOK_KEYWORD);
+  arena_used += len;
   toks++;
   return toks - 1;
 }
 
+/*
+ * Lex-time whitespace compaction.  The scanners emit whitespace one
+ * character at a time, so an indentation run or a blank-line block
+ * becomes hundreds of one-byte tokens; every candidate walk then pays
+ * per token and materialization gathers one iovec extent per byte.
+ * Appending a same-kind whitespace lexeme to the previous token's
+ * extent instead keeps each run as a single token.  Candidate output
+ * stays byte-identical: every mode either copies these tokens verbatim
+ * or skips them by kind, never by count.  Kinds are never mixed, so a
+ * newline run still reads as TOK_NEWLINE (replace_macro scans for it).
+ */
+static void extend_last_tok(const char *str) {
+  // the last-added token always owns the arena tail, so overwriting its
+  // NUL splices the new bytes onto its extent
+  size_t len = strlen(str) + 1;
+  assert(arena_used + len - 1 <= arena_cap);
+  memcpy(tok_arena + arena_used - 1, str, len);
+  arena_used += len - 1;
+}
+
 void process_token(enum tok_kind kind) {
-  add_tok(yytext, kind);
+  if ((kind == TOK_WS || kind == TOK_NEWLINE) &&
+      (toks > 0) && (tok_kind(toks - 1) == kind))
+    extend_last_tok(yytext);
+  else
+    add_tok(yytext, kind);
   count++;
 }
 
@@ -65,19 +154,59 @@ enum mode_t {
   MODE_PRINT,
   MODE_DELETE_STRING,
   MODE_RM_TOKS,
+  MODE_RM_TOKS_ALL,
   MODE_RM_TOK_PATTERN,
   MODE_SHORTEN_STRING,
+  MODE_SHORTEN_STRING_ALL,
   MODE_X_STRING,
+  MODE_X_STRING_ALL,
   MODE_DEFINE,
+  MODE_HASH_NORMALIZED,
+  MODE_RM_TOKS_HIER,
   MODE_NONE,
 };
 
-static void print_toks(void) {
+/*
+ * Candidate output.  In one-shot mode tokens go straight to stdout; in
+ * server mode they are collected into a growable buffer so each reply
+ * can be length-prefixed.  The mode functions return OK or STOP instead
+ * of exiting, and they never modify the token table, so the one built by
+ * one yylex() run can serve any number of requests.  The stream state is
+ * thread-local so the batch string modes can assemble independent
+ * candidates on worker threads over the shared read-only token list.
+ */
+static CLEX_TLS char *out_buf;
+static CLEX_TLS size_t out_len;
+static CLEX_TLS size_t out_cap;
+static CLEX_TLS int out_buffered;
+
+static void out_write(const char *s, size_t len) {
+  if (!out_buffered) {
+    fwrite(s, 1, len, stdout);
+    return;
+  }
+  if (out_len + len > out_cap) {
+    if (out_cap == 0)
+      out_cap = 4096;
+    while (out_len + len > out_cap)
+      out_cap *= 2;
+    out_buf = (char *)realloc(out_buf, out_cap);
+    assert(out_buf);
+  }
+  memcpy(out_buf + out_len, s, len);
+  out_len += len;
+}
+
+static void out_str(const char *s) {
+  out_write(s, strlen(s));
+}
+
+static int print_toks(void) {
   int i;
   for (i = 0; i < toks; i++) {
-    printf("%s", tok_list[i].str);
+    out_str(tok_str(i));
   }
-  exit(OK);
+  return OK;
 }
 
 static int next_char(char *c) {
@@ -108,20 +237,74 @@ static void next_name(char *name) {
   }
 }
 
+/*
+ * Open-addressed hash table over token strings with linear probing; the
+ * capacity is a power of two sized from the token count.  It backs both
+ * the unused-name search (membership over every token) and the
+ * identifier index in index_toks(), replacing the per-candidate and
+ * per-identifier scans of the whole token list.
+ */
+struct str_table {
+  const char **keys;
+  int *vals;
+  size_t cap;
+};
+
+static uint64_t hash_str(const char *s) {
+  return hash_bytes(s, strlen(s));
+}
+
+static struct str_table *table_create(size_t expected) {
+  struct str_table *t = (struct str_table *)malloc(sizeof(*t));
+  assert(t);
+  t->cap = 16;
+  while (t->cap < 2 * expected)
+    t->cap *= 2;
+  t->keys = (const char **)calloc(t->cap, sizeof(const char *));
+  t->vals = (int *)malloc(t->cap * sizeof(int));
+  assert(t->keys && t->vals);
+  return t;
+}
+
+// returns the value slot for key, inserting it with value -1 if new
+static int *table_lookup_or_insert(struct str_table *t, const char *key) {
+  size_t mask = t->cap - 1;
+  size_t slot = (size_t)hash_str(key) & mask;
+  while (t->keys[slot]) {
+    if (strcmp(t->keys[slot], key) == 0)
+      return &t->vals[slot];
+    slot = (slot + 1) & mask;
+  }
+  t->keys[slot] = key;
+  t->vals[slot] = -1;
+  return &t->vals[slot];
+}
+
+static int table_contains(struct str_table *t, const char *key) {
+  size_t mask = t->cap - 1;
+  size_t slot = (size_t)hash_str(key) & mask;
+  while (t->keys[slot]) {
+    if (strcmp(t->keys[slot], key) == 0)
+      return 1;
+    slot = (slot + 1) & mask;
+  }
+  return 0;
+}
+
 static void find_unused_name(char *name) {
-  strcpy(name, "a");
-  int clash;
-  do {
-    clash = 0;
+  // built once; tokens are never added after lexing (commit splices can
+  // only remove entries, which cannot make an unused name collide)
+  static struct str_table *all_toks;
+  if (!all_toks) {
+    all_toks = table_create((size_t)toks);
     int i;
-    for (i = 0; i < toks; i++) {
-      if (strcmp(tok_list[i].str, name) == 0) {
-	next_name(name);
-	clash = 1;
-	break;
-      }
-    }
-  } while (clash);
+    for (i = 0; i < toks; i++)
+      *table_lookup_or_insert(all_toks, tok_str(i)) = 1;
+  }
+
+  strcpy(name, "a");
+  while (table_contains(all_toks, name))
+    next_name(name);
 }
 
 static int should_be_renamed(char *name, char *newname) {
@@ -135,31 +318,79 @@ static int should_be_renamed(char *name, char *newname) {
   return strcmp(newname, name) < 0;
 }
 
+/*
+ * Identifier footprint ranking.  The rename index used to enumerate
+ * identifiers in first-occurrence order, so the driver spent its early
+ * probes on whatever happened to appear first.  Renaming a long
+ * generated name that occurs thousands of times shrinks the file far
+ * more per accepted step than renaming a short one, so the index is
+ * sorted by total byte footprint (occurrences times length) instead;
+ * probing in index order then converges in fewer cycles.  Ties fall
+ * back to first-occurrence order to keep the ranking deterministic.
+ */
+struct ident_rank {
+  char *str;
+  long footprint;
+  int first_id;
+};
+
+static int ident_rank_cmp(const void *a, const void *b) {
+  const struct ident_rank *ra = (const struct ident_rank *)a;
+  const struct ident_rank *rb = (const struct ident_rank *)b;
+  if (ra->footprint != rb->footprint)
+    return (ra->footprint < rb->footprint) ? 1 : -1;
+  return (ra->first_id > rb->first_id) - (ra->first_id < rb->first_id);
+}
+
 static void index_toks(char ***index_ptr, int *index_size_ptr, char *newname) {
-  char **index = 0;
   int index_size = 0;
+  int index_cap = 0;
+  struct ident_rank *ranks = 0;
+  struct str_table *idents = table_create((size_t)toks);
   int i;
   for (i = 0; i < toks; i++) {
-    if (tok_list[i].kind != TOK_IDENT)
+    if (tok_kind(i) != TOK_IDENT)
       continue;
-    if (!should_be_renamed(tok_list[i].str, newname))
+    if (!should_be_renamed(tok_str(i), newname))
       continue;
-    int matched = 0;
-    int j;
-    for (j = 0; j < index_size; j++) {
-      if (strcmp(index[j], tok_list[i].str) == 0) {
-	matched = 1;
-	tok_list[i].id = j;
-	break;
+    int *id = table_lookup_or_insert(idents, tok_str(i));
+    if (*id < 0) {
+      *id = index_size;
+      if (index_size >= index_cap) {
+        index_cap = index_cap ? 2 * index_cap : 64;
+        ranks = realloc(ranks, index_cap * sizeof(struct ident_rank));
+        assert(ranks);
       }
-    }
-    if (!matched) {
-      tok_list[i].id = index_size;
-      index = realloc(index, (1 + index_size) * sizeof(char *));
-      index[index_size] = tok_list[i].str;
+      ranks[index_size].str = tok_str(i);
+      ranks[index_size].footprint = 0;
+      ranks[index_size].first_id = index_size;
       index_size++;
     }
+    ranks[*id].footprint += (long)strlen(tok_str(i));
+    tok_ids[i] = *id;
+  }
+  free(idents->keys);
+  free(idents->vals);
+  free(idents);
+
+  qsort(ranks, (size_t)index_size, sizeof(struct ident_rank),
+        ident_rank_cmp);
+
+  // remap the per-token ids from first-occurrence order to rank order
+  char **index = (char **)malloc((size_t)(index_size ? index_size : 1) *
+                                 sizeof(char *));
+  int *rank_of = (int *)malloc((size_t)(index_size ? index_size : 1) *
+                               sizeof(int));
+  assert(index && rank_of);
+  for (i = 0; i < index_size; i++) {
+    index[i] = ranks[i].str;
+    rank_of[ranks[i].first_id] = i;
   }
+  for (i = 0; i < toks; i++)
+    if (tok_ids[i] >= 0)
+      tok_ids[i] = rank_of[tok_ids[i]];
+  free(rank_of);
+  free(ranks);
   *index_ptr = index;
   *index_size_ptr = index_size;
 }
@@ -167,15 +398,26 @@ static void index_toks(char ***index_ptr, int *index_size_ptr, char *newname) {
 static void print_renamed(int tok_index, char *newname) {
   int i;
   for (i = 0; i < toks; i++) {
-    if (tok_list[i].id == tok_index)
-      printf("%s", newname);
+    if (tok_ids[i] == tok_index)
+      out_str(newname);
     else
-      printf("%s", tok_list[i].str);
+      out_str(tok_str(i));
   }
 }
 
-static void rename_toks(int tok_index) {
+static void reset_tok_ids(void) {
+  int i;
+  if (!tok_ids) {
+    tok_ids = (int *)malloc(max_toks * sizeof(int));
+    assert(tok_ids);
+  }
+  for (i = 0; i < toks; i++)
+    tok_ids[i] = -1;
+}
+
+static int rename_toks(int tok_index) {
   char newname[255];
+  reset_tok_ids();
   find_unused_name(newname);
   assert(tok_index >= 0);
   char **index;
@@ -184,107 +426,141 @@ static void rename_toks(int tok_index) {
   //fprintf(stderr, "tok_index = %d, index size = %d\n", tok_index, index_size);
   if (tok_index >= index_size) {
     //fprintf(stderr, "rename_toks stop\n");
-    exit(STOP);
+    free(index);
+    return STOP;
   } else {
     //fprintf(stderr, "rename_toks with index %d, source '%s', target '%s'\n",
     // tok_index, index[tok_index], newname);
     print_renamed(tok_index, newname);
-    exit(OK);
-  }
-}
-
-static void string_rm_chars(char *s, int i) {
-  unsigned int j;
-  for (j = 0; j < (strlen(s) - i + 1); j++) {
-    s[j] = s[j + i];
+    free(index);
+    return OK;
   }
 }
 
-static void shorten_string(int idx) {
+static int shorten_string(int idx) {
   int i;
   int matched = 0;
   for (i = 0; i < toks; i++) {
-    if (!matched && tok_list[i].kind == TOK_STRING) {
-      char *s = tok_list[i].str;
+    if (!matched && tok_kind(i) == TOK_STRING) {
+      char *s = tok_str(i);
       int len = strlen(s) - 2;
       if (idx >= len) {
         idx -= len;
       } else {
-        string_rm_chars(s + idx + 1, 1);
+        // emit the token with the character at idx+1 dropped instead of
+        // removing it from the stored token
+        out_write(s, idx + 1);
+        out_str(s + idx + 2);
         matched = 1;
+        continue;
       }
     }
-    printf("%s", tok_list[i].str);
-  }
-  if (matched) {
-    exit(OK);
-  } else {
-    exit(STOP);
+    out_str(tok_str(i));
   }
+  return matched ? OK : STOP;
 }
 
-static void x_string(int idx) {
+static int x_string(int idx) {
   int i;
   int matched = 0;
   int which = 0;
   for (i = 0; i < toks; i++) {
-    if (!matched && tok_list[i].kind == TOK_STRING) {
-      char *s = tok_list[i].str;
+    if (!matched && tok_kind(i) == TOK_STRING) {
+      char *s = tok_str(i);
       unsigned int j;
       for (j = 0; j < strlen(s); j++) {
         if (s[j] != 'x') {
           if (which == idx) {
-            s[j] = 'x';
+            // emit the token with s[j] replaced instead of overwriting
+            // the stored token
+            out_write(s, j);
+            out_str("x");
+            out_str(s + j + 1);
             matched = 1;
+            break;
           }
           which++;
         }
       }
+      if (matched)
+        continue;
     }
-    printf("%s", tok_list[i].str);
-  }
-  if (matched) {
-    exit(OK);
-  } else {
-    exit(STOP);
+    out_str(tok_str(i));
   }
+  return matched ? OK : STOP;
 }
 
-static void delete_string(int idx) {
+static int delete_string(int idx) {
   int i;
   int matched = 0;
   int which = 0;
   for (i = 0; i < toks; i++) {
     int printed = 0;
-    if (tok_list[i].kind == TOK_STRING &&
-        strcmp(tok_list[i].str, "\"\"") != 0) {
+    if (tok_kind(i) == TOK_STRING &&
+        strcmp(tok_str(i), "\"\"") != 0) {
       if (which == idx) {
-        printf("\"\"");
+        out_str("\"\"");
         printed = 1;
         matched = 1;
       }
       which++;
     }
     if (!printed)
-      printf("%s", tok_list[i].str);
-  }
-  if (matched) {
-    exit(OK);
-  } else {
-    exit(STOP);
+      out_str(tok_str(i));
   }
+  return matched ? OK : STOP;
 }
 
 static int n_toks;
 
-static void rm_toks(int idx) {
+/*
+ * Acceptance-density feedback.  Accepted removals cluster heavily (dead
+ * tables, unused blocks), so the server keeps two coarse histograms over
+ * the token list -- rm-toks windows probed and rm-toks windows committed
+ * -- bucketed by the window's fractional position among the
+ * non-whitespace tokens.  The "density" request replies with one
+ * "<bucket> <probes> <accepts>" line per non-empty bucket; the driver
+ * can aim subsequent windows at fertile regions and skip barren ones.
+ * Positions are measured against the token list current at event time,
+ * so the map stays approximate across commits, which is all the
+ * steering needs.
+ */
+#define DENSITY_BUCKETS 256
+static unsigned long density_probes[DENSITY_BUCKETS];
+static unsigned long density_accepts[DENSITY_BUCKETS];
+static int nonws_total_cache = -1;
+
+static int nonws_total(void) {
+  if (nonws_total_cache < 0) {
+    int i;
+    int total = 0;
+    for (i = 0; i < toks; i++)
+      if (tok_kind(i) != TOK_WS && tok_kind(i) != TOK_NEWLINE)
+        total++;
+    nonws_total_cache = total;
+  }
+  return nonws_total_cache;
+}
+
+static void density_record(unsigned long *counters, int idx) {
+  int total = nonws_total();
+  if (total <= 0)
+    return;
+  if (idx < 0)
+    idx = 0;
+  if (idx >= total)
+    idx = total - 1;
+  counters[(int)((long long)idx * DENSITY_BUCKETS / total)]++;
+}
+
+static int rm_toks(int idx) {
   int i;
   int matched = 0;
   int which = 0;
   int started = 0;
   for (i = 0; i < toks; i++) {
-    if (tok_list[i].kind != TOK_WS &&
-        tok_list[i].kind != TOK_NEWLINE) {
+    if (tok_kind(i) != TOK_WS &&
+        tok_kind(i) != TOK_NEWLINE) {
       if (which == idx) {
         started = 1;
         matched = 1;
@@ -292,15 +568,488 @@ static void rm_toks(int idx) {
       which++;
     }
     if (!started || (which > (idx + n_toks)))
-      printf("%s", tok_list[i].str);
+      out_str(tok_str(i));
   }
-  if (matched) {
-    exit(OK);
-  } else {
-    exit(STOP);
+  return matched ? OK : STOP;
+}
+
+/*
+ * Emit every sliding-window removal candidate from the one token list as
+ * a stream of "<length>\n" headers followed by exactly <length> bytes of
+ * candidate each, ending at EOF.  One invocation replaces one process,
+ * one lex and one emission per window position.
+ */
+static int rm_toks_all(void) {
+  int idx;
+  int any = 0;
+  for (idx = 0;; idx++) {
+    out_len = 0;
+    if (rm_toks(idx) != OK)
+      break;
+    printf("%lu\n", (unsigned long)out_len);
+    fwrite(out_buf, 1, out_len, stdout);
+    any = 1;
+  }
+  out_len = 0;
+  return any ? OK : STOP;
+}
+
+/*
+ * Hierarchical rm-toks.  "rm-toks-hier-<max>" folds the per-size
+ * rm-toks phases into one coarse-to-fine candidate sequence: windows of
+ * <max> non-whitespace tokens first, then <max>/2 and so on down to
+ * single tokens.  Coarse windows start every half window (a full-step
+ * grid would never straddle its own boundaries); the final size-1 level
+ * steps by one token, so nothing the per-size phases could remove is
+ * out of reach.  Accepted windows are spliced out of the resident token
+ * table by the commit request, so every finer level enumerates only the
+ * tokens that survived the coarser ones -- removal state needs no side
+ * structure, the shrinking table is the state.
+ */
+static int hier_geometry(int idx, int *size_out, int *pos_out) {
+  int total = nonws_total();
+  int w;
+  for (w = n_toks; w > 0; w /= 2) {
+    if (w > total)
+      continue;
+    int step = (w > 1) ? w / 2 : 1;
+    int count = (total - w) / step + 1;
+    if (idx < count) {
+      *size_out = w;
+      *pos_out = idx * step;
+      return 1;
+    }
+    idx -= count;
+  }
+  return 0;
+}
+
+static int rm_toks_hier(int idx) {
+  int w, pos, status;
+  int saved = n_toks;
+  if (!hier_geometry(idx, &w, &pos))
+    return STOP;
+  n_toks = w;
+  status = rm_toks(pos);
+  n_toks = saved;
+  return status;
+}
+
+/*
+ * Batch string modes.  Every shorten-string / x-string candidate tweaks
+ * one character of one string literal, so the candidates are independent
+ * and can be assembled in parallel from the shared read-only token list.
+ * The candidate indices are partitioned into contiguous blocks across
+ * worker threads, each thread building its candidates in its own
+ * thread-local output buffer, and the main thread then emits them in
+ * index order with the same "<length>\n" framing as rm-toks-all.
+ */
+
+struct string_cand {
+  char *buf;
+  size_t len;
+};
+
+static int count_string_candidates(enum mode_t mode) {
+  int total = 0;
+  int i;
+  for (i = 0; i < toks; i++) {
+    if (tok_kind(i) != TOK_STRING)
+      continue;
+    char *s = tok_str(i);
+    if (mode == MODE_SHORTEN_STRING_ALL) {
+      total += (int)strlen(s) - 2;
+    } else {
+      unsigned int j;
+      for (j = 0; j < strlen(s); j++)
+        if (s[j] != 'x')
+          total++;
+    }
+  }
+  return total;
+}
+
+struct string_worker_arg {
+  enum mode_t mode;
+  int begin;
+  int end;
+  struct string_cand *cands;
+};
+
+static void *string_worker(void *p) {
+  struct string_worker_arg *arg = (struct string_worker_arg *)p;
+  int idx;
+  out_buffered = 1;
+  for (idx = arg->begin; idx < arg->end; idx++) {
+    out_len = 0;
+    int status = (arg->mode == MODE_SHORTEN_STRING_ALL) ? shorten_string(idx)
+                                                        : x_string(idx);
+    assert(status == OK);
+    // hand the buffer over to the candidate slot and start a fresh one
+    arg->cands[idx].buf = out_buf;
+    arg->cands[idx].len = out_len;
+    out_buf = NULL;
+    out_len = 0;
+    out_cap = 0;
+  }
+  return NULL;
+}
+
+static int string_all(enum mode_t mode) {
+  int total = count_string_candidates(mode);
+  if (total == 0)
+    return STOP;
+  struct string_cand *cands =
+      (struct string_cand *)calloc(total, sizeof(struct string_cand));
+  assert(cands);
+
+  int nthreads = 1;
+#ifndef _MSC_VER
+  long nproc = sysconf(_SC_NPROCESSORS_ONLN);
+  if (nproc > 1)
+    nthreads = (nproc < total) ? (int)nproc : total;
+#endif
+
+  if (nthreads <= 1) {
+    struct string_worker_arg arg = { mode, 0, total, cands };
+    string_worker(&arg);
+  }
+#ifndef _MSC_VER
+  else {
+    pthread_t *threads = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    struct string_worker_arg *args = (struct string_worker_arg *)malloc(
+        nthreads * sizeof(struct string_worker_arg));
+    assert(threads && args);
+    int t;
+    for (t = 0; t < nthreads; t++) {
+      args[t].mode = mode;
+      args[t].begin = total * t / nthreads;
+      args[t].end = total * (t + 1) / nthreads;
+      args[t].cands = cands;
+      int ret = pthread_create(&threads[t], NULL, string_worker, &args[t]);
+      assert(ret == 0);
+    }
+    for (t = 0; t < nthreads; t++)
+      pthread_join(threads[t], NULL);
+    free(threads);
+    free(args);
+  }
+#endif
+
+  int idx;
+  for (idx = 0; idx < total; idx++) {
+    printf("%lu\n", (unsigned long)cands[idx].len);
+    fwrite(cands[idx].buf, 1, cands[idx].len, stdout);
+    free(cands[idx].buf);
+  }
+  free(cands);
+  out_len = 0;
+  return OK;
+}
+
+/*
+ * Candidate views.  An rm-toks candidate is the token list with one
+ * contiguous run of tokens skipped, so it can be described as a single
+ * skip interval over the shared immutable token arena instead of an
+ * assembled byte stream.  "views rm-toks-<n>" builds the interval for
+ * every window position in one pass over the token list, and
+ * "materialize <id> <path>" writes one candidate straight from the
+ * arena with writev.  Enumerating 10,000 candidates thus allocates one
+ * small table, and only candidates actually scheduled for testing ever
+ * touch the disk.
+ */
+
+#ifndef _MSC_VER
+
+struct tok_view {
+  int skip_begin;
+  int skip_end;
+};
+
+static struct tok_view *views;
+static int n_views;
+
+static int build_rm_toks_views(void) {
+  free(views);
+  views = NULL;
+  n_views = 0;
+
+  // positions of the non-whitespace tokens, with one past-the-end entry
+  // so a window reaching the end skips through any trailing whitespace
+  int *nws = (int *)malloc(((size_t)toks + 1) * sizeof(int));
+  assert(nws);
+  int total = 0;
+  int i;
+  for (i = 0; i < toks; i++)
+    if (tok_kind(i) != TOK_WS && tok_kind(i) != TOK_NEWLINE)
+      nws[total++] = i;
+  nws[total] = toks;
+  if (total == 0) {
+    free(nws);
+    return 0;
+  }
+
+  views = (struct tok_view *)malloc((size_t)total * sizeof(struct tok_view));
+  assert(views);
+  // mirror rm_toks: the skip run starts at the idx-th non-whitespace
+  // token and ends right before the (idx + n_toks)-th one
+  for (i = 0; i < total; i++) {
+    views[i].skip_begin = nws[i];
+    views[i].skip_end = (i + n_toks <= total) ? nws[i + n_toks] : toks;
+  }
+  n_views = total;
+  free(nws);
+  return total;
+}
+
+static int flush_iov(int fd, struct iovec *iov, int n) {
+  int off = 0;
+  while (off < n) {
+    ssize_t w = writev(fd, iov + off, n - off);
+    if (w < 0)
+      return 0;
+    // writev may stop mid-vector; advance past the written entries
+    while (off < n && (size_t)w >= iov[off].iov_len) {
+      w -= (ssize_t)iov[off].iov_len;
+      off++;
+    }
+    if (off < n && w > 0) {
+      iov[off].iov_base = (char *)iov[off].iov_base + w;
+      iov[off].iov_len -= (size_t)w;
+    }
+  }
+  return 1;
+}
+
+static int materialize_view(int id, const char *path) {
+  if (id < 0 || id >= n_views)
+    return STOP;
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0)
+    return STOP;
+
+  // each kept token is one gathered extent; the arena interleaves NUL
+  // terminators, so whole spans cannot be written in one piece
+  static struct iovec iov[1024];
+  int n = 0;
+  int ok = 1;
+  int i = 0;
+  while (i < toks) {
+    if (i == views[id].skip_begin) {
+      i = views[id].skip_end;
+      continue;
+    }
+    iov[n].iov_base = tok_str(i);
+    iov[n].iov_len = strlen(tok_str(i));
+    if (++n == 1024) {
+      ok = flush_iov(fd, iov, n);
+      if (!ok)
+        break;
+      n = 0;
+    }
+    i++;
+  }
+  if (ok && n > 0)
+    ok = flush_iov(fd, iov, n);
+  if (close(fd) != 0)
+    ok = 0;
+  return ok ? OK : STOP;
+}
+
+/*
+ * Incremental token-list update.  A successful rm-toks candidate differs
+ * from the resident token list only by one contiguous run of dropped
+ * tokens, so when the driver accepts one it can tell the server to
+ * splice that run out of the token table ("commit rm-toks-<n> <idx>")
+ * instead
+ * of restarting the server against the edited file.  The splice is one
+ * memmove over the token entry array -- the arena keeps the dead token
+ * text, which is fine because the arena never shrinks anyway -- so an
+ * accepted edit costs O(tokens) pointer moves rather than a full re-lex.
+ * Any cached candidate views are invalidated since token indices shift.
+ */
+static int commit_rm_toks(int idx) {
+  int i;
+  int which = 0;
+  int begin = -1;
+  int end = toks;
+  for (i = 0; i < toks; i++) {
+    if (tok_kind(i) != TOK_WS && tok_kind(i) != TOK_NEWLINE) {
+      if (which == idx && begin < 0)
+        begin = i;
+      if (which == idx + n_toks) {
+        end = i;
+        break;
+      }
+      which++;
+    }
+  }
+  if (begin < 0)
+    return STOP;
+
+  // record the acceptance against the pre-splice geometry
+  density_record(density_accepts, idx);
+  nonws_total_cache = -1;
+
+  // a server sharing the token tables must not splice the shared pages
+  detach_token_shm();
+  // tok_ids may go stale here; the rename mode refills it before use
+  memmove(tok_off + begin, tok_off + end,
+          (size_t)(toks - end) * sizeof(uint32_t));
+  memmove(tok_kinds + begin, tok_kinds + end,
+          (size_t)(toks - end) * sizeof(uint8_t));
+  toks -= end - begin;
+
+  free(views);
+  views = NULL;
+  n_views = 0;
+  return OK;
+}
+
+// commit for the hierarchical mode: map the candidate index back to its
+// (size, position) pair and splice that window
+static int commit_rm_toks_hier(int idx) {
+  int w, pos, status;
+  int saved = n_toks;
+  if (!hier_geometry(idx, &w, &pos))
+    return STOP;
+  n_toks = w;
+  status = commit_rm_toks(pos);
+  n_toks = saved;
+  return status;
+}
+
+/*
+ * Batched materialization.  "materialize-batch <count>" is followed by
+ * <count> request lines "<id> <path>".  The candidates are assembled
+ * into private buffers and their file writes are queued on an io_uring
+ * and submitted together, so a batch of tiny late-stage candidates
+ * costs one submit-and-wait instead of an open/writev/close syscall
+ * round per file; without a usable ring (old kernel, seccomp) every
+ * entry just takes the materialize_view path.  The reply payload
+ * carries one "<id> <status>" line per candidate, and the reply status
+ * is OK only when every candidate landed.
+ */
+#define MAT_BATCH_CHUNK 64
+
+static struct uringw *mat_ring;
+static int mat_ring_tried;
+
+// one candidate as a single contiguous buffer; the view's gathered
+// token extents would exceed the kernel's per-writev vector limit
+static char *build_view_buf(int id, size_t *lenp) {
+  size_t total = 0;
+  size_t off = 0;
+  char *buf;
+  int i;
+
+  if (id < 0 || id >= n_views)
+    return NULL;
+  i = 0;
+  while (i < toks) {
+    if (i == views[id].skip_begin) {
+      i = views[id].skip_end;
+      continue;
+    }
+    total += strlen(tok_str(i));
+    i++;
+  }
+  buf = (char *)malloc(total ? total : 1);
+  if (!buf)
+    return NULL;
+  i = 0;
+  while (i < toks) {
+    if (i == views[id].skip_begin) {
+      i = views[id].skip_end;
+      continue;
+    }
+    size_t len = strlen(tok_str(i));
+    memcpy(buf + off, tok_str(i), len);
+    off += len;
+    i++;
   }
+  *lenp = total;
+  return buf;
 }
 
+static void serve_materialize_batch(int count) {
+  int all_ok = 1;
+  int done = 0;
+  int truncated = 0;
+
+  if (!mat_ring_tried) {
+    mat_ring = uringw_open(MAT_BATCH_CHUNK);
+    mat_ring_tried = 1;
+  }
+
+  out_len = 0;
+  while (done < count && !truncated) {
+    int ids[MAT_BATCH_CHUNK];
+    int st[MAT_BATCH_CHUNK];
+    int slot_of[MAT_BATCH_CHUNK];
+    char *bufs[MAT_BATCH_CHUNK];
+    unsigned char okv[MAT_BATCH_CHUNK];
+    int chunk = count - done;
+    int n, k;
+
+    if (chunk > MAT_BATCH_CHUNK)
+      chunk = MAT_BATCH_CHUNK;
+    if (mat_ring && (unsigned)chunk > uringw_capacity(mat_ring))
+      chunk = (int)uringw_capacity(mat_ring);
+
+    for (n = 0; n < chunk; n++) {
+      char req[1024];
+      char path[768];
+      size_t len;
+      int id;
+      ids[n] = -1;
+      st[n] = STOP;
+      slot_of[n] = -1;
+      bufs[n] = NULL;
+      if (!fgets(req, sizeof(req), stdin)) {
+        truncated = 1;
+        break;
+      }
+      if (sscanf(req, "%d %767s", &id, path) != 2)
+        continue;
+      ids[n] = id;
+      if (!mat_ring) {
+        st[n] = materialize_view(id, path);
+        continue;
+      }
+      bufs[n] = build_view_buf(id, &len);
+      if (bufs[n]) {
+        struct uringw_span span;
+        span.base = bufs[n];
+        span.len = len;
+        slot_of[n] = uringw_put(mat_ring, path, &span, 1);
+      }
+    }
+    if (mat_ring && uringw_pending(mat_ring) > 0)
+      uringw_flush(mat_ring, okv);
+    for (k = 0; k < n; k++) {
+      char tmp[32];
+      if (mat_ring && slot_of[k] >= 0 && okv[slot_of[k]])
+        st[k] = OK;
+      if (st[k] != OK)
+        all_ok = 0;
+      sprintf(tmp, "%d %d\n", ids[k], st[k]);
+      out_str(tmp);
+      free(bufs[k]);
+    }
+    done += n;
+  }
+  if (done < count)
+    all_ok = 0;
+
+  printf("%d %lu\n", all_ok ? OK : STOP, (unsigned long)out_len);
+  fwrite(out_buf, 1, out_len, stdout);
+  out_len = 0;
+  fflush(stdout);
+}
+
+#endif // !_MSC_VER
+
 static void print_pattern(unsigned char c) {
   int z;
   for (z = 0; z < 8; z++) {
@@ -310,7 +1059,7 @@ static void print_pattern(unsigned char c) {
   printf("\n");
 }
 
-static void rm_tok_pattern(int idx) {
+static int rm_tok_pattern(int idx) {
   int i;
   int n_patterns = 1 << (n_toks - 1);
 
@@ -343,8 +1092,8 @@ static void rm_tok_pattern(int idx) {
   int matched = 0;
   int deleted = 0;
   for (i = 0; i < toks; i++) {
-    if (tok_list[i].kind != TOK_WS &&
-        tok_list[i].kind != TOK_NEWLINE) {
+    if (tok_kind(i) != TOK_WS &&
+        tok_kind(i) != TOK_NEWLINE) {
       if (which == idx) {
         matched = 1;
         started = 1;
@@ -354,8 +1103,8 @@ static void rm_tok_pattern(int idx) {
       which++;
     }
     int print = 0;
-    if (tok_list[i].kind == TOK_WS ||
-        tok_list[i].kind == TOK_NEWLINE) {
+    if (tok_kind(i) == TOK_WS ||
+        tok_kind(i) == TOK_NEWLINE) {
       print = 1;
     } else {
       if (!started) {
@@ -363,7 +1112,7 @@ static void rm_tok_pattern(int idx) {
       } else {
         if (pat & 1) {
           deleted = 1;
-          // printf ("[%s]", tok_list[i].str);
+          // printf ("[%s]", tok_str(i));
         } else {
           print = 1;
         }
@@ -371,13 +1120,9 @@ static void rm_tok_pattern(int idx) {
       }
     }
     if (print)
-      printf("%s", tok_list[i].str);
-  }
-  if (matched && deleted) {
-    exit(OK);
-  } else {
-    exit(STOP);
+      out_str(tok_str(i));
   }
+  return (matched && deleted) ? OK : STOP;
 }
 
 // handle simple #defines
@@ -387,137 +1132,849 @@ static void rm_tok_pattern(int idx) {
 // a separate tool that resembles unifdef
 void replace_macro(int i) {
   int initial = i;
-  char *macro = tok_list[i].str;
+  char *macro = tok_str(i);
   // printf("replacing macro '%s'\n", macro);
   i++;
-  while (tok_list[i].kind == TOK_WS)
+  while (tok_kind(i) == TOK_WS)
     i++;
   int end = i;
-  while (tok_list[end].kind != TOK_NEWLINE)
+  while (tok_kind(end) != TOK_NEWLINE)
     end++;
   int x;
   for (x = 0; x < toks; ++x) {
+    // first-byte prefilter: almost no tokens share the macro's leading
+    // character, so the strcmp rarely runs
     if (x != initial &&
-        strcmp(tok_list[x].str, macro) == 0) {
+        tok_str(x)[0] == macro[0] &&
+        strcmp(tok_str(x), macro) == 0) {
       int y;
       for (y = i; y < end; ++y)
-        printf("%s", tok_list[y].str);
+        out_str(tok_str(y));
     } else {
-      printf("%s", tok_list[x].str);
+      out_str(tok_str(x));
     }
   }
 }
 
-void define(int tok_index) {
+int define(int tok_index) {
+  /*
+   * One pass over the token list builds per-string occurrence counts,
+   * turning the used-elsewhere check into a hash lookup instead of a
+   * fresh O(tokens) scan for every #define.  Macro-heavy vendor headers
+   * have thousands of defines, and the old quadratic loop was the whole
+   * profile of this mode there.
+   */
+  struct str_table *counts = table_create((size_t)toks);
   int i;
+  for (i = 0; i < toks; ++i) {
+    int *c = table_lookup_or_insert(counts, tok_str(i));
+    if (*c < 0)
+      *c = 0;
+    (*c)++;
+  }
+
   int found = 0;
+  int result = STOP;
   for (i = 0; i < toks; ++i) {
-    if (strcmp(tok_list[i].str, "#") == 0) {
+    if (strcmp(tok_str(i), "#") == 0) {
       i++;
-      while (tok_list[i].kind == TOK_WS)
+      while (tok_kind(i) == TOK_WS)
         i++;
-      if (strcmp(tok_list[i].str, "define") != 0)
+      if (strcmp(tok_str(i), "define") != 0)
         continue;
       i++;
-      while (tok_list[i].kind == TOK_WS)
+      while (tok_kind(i) == TOK_WS)
         i++;
-      int j;
-      int used = 0;
-      for (j = 0; j < toks; ++j)
-        if (j != i &&
-            strcmp(tok_list[j].str, tok_list[i].str) == 0)
-          used = 1;
-      if (!used)
+      // the definition site itself accounts for one occurrence
+      if (*table_lookup_or_insert(counts, tok_str(i)) < 2)
         continue;
       if (found == tok_index) {
         replace_macro(i);
-        exit(OK);
+        result = OK;
+        break;
       }
       found++;
     }
   }
-  exit(STOP);
+  free(counts->keys);
+  free(counts->vals);
+  free(counts);
+  return result;
 }
 
-int main(int argc, char *argv[]) {
-  if (argc != 4) {
-    printf("USAGE: %s command index file\n", argv[0]);
-    exit(STOP);
+/*
+ * Normalized structural hash.  Hash the token stream with whitespace
+ * dropped and every identifier replaced by its first-occurrence
+ * ordinal, so two candidates that differ only in identifier names and
+ * formatting hash the same.  The rename family mass-produces such
+ * isomorphic candidates; an interestingness test costs seconds, this
+ * costs one pass over the token list, so the driver can hash a
+ * candidate and skip it when an isomorphic one already failed.  The
+ * 16-hex-digit hash is the whole output; the index argument is unused.
+ */
+static int hash_normalized(void) {
+  struct str_table *idents = table_create((size_t)toks);
+  // FNV-1a, same basis and prime as hash_bytes
+  uint64_t h = 1469598103934665603ull;
+  int next_id = 0;
+  int i;
+  for (i = 0; i < toks; i++) {
+    enum tok_kind kind = tok_kind(i);
+    if (kind == TOK_WS || kind == TOK_NEWLINE)
+      continue;
+    h ^= (uint64_t)kind;
+    h *= 1099511628211ull;
+    if (kind == TOK_IDENT) {
+      int *id = table_lookup_or_insert(idents, tok_str(i));
+      if (*id < 0)
+        *id = next_id++;
+      h ^= (uint64_t)*id;
+      h *= 1099511628211ull;
+    } else {
+      const char *s;
+      for (s = tok_str(i); *s; s++) {
+        h ^= (unsigned char)*s;
+        h *= 1099511628211ull;
+      }
+    }
   }
+  free(idents->keys);
+  free(idents->vals);
+  free(idents);
 
-  char *cmd = argv[1];
-  enum mode_t mode = MODE_NONE;
+  char buf[32];
+  sprintf(buf, "%016llx\n", (unsigned long long)h);
+  out_str(buf);
+  return OK;
+}
+
+/*
+ * Binary token-stream sidecar.  --save-tokens persists the token arena
+ * and the per-token offset/kind arrays next to the input after lexing;
+ * --load-tokens restores them with a few bulk reads and skips flex
+ * entirely when the recorded input hash and size still match.  The cache
+ * is written to a temporary file and renamed into place so a killed
+ * instance never leaves a torn sidecar.
+ */
+
+static uint64_t hash_bytes(const char *buf, size_t len) {
+  // FNV-1a
+  uint64_t h = 1469598103934665603ull;
+  size_t i;
+  for (i = 0; i < len; i++) {
+    h ^= (unsigned char)buf[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+struct token_cache_header {
+  char magic[8];
+  uint64_t input_hash;
+  uint64_t input_size;
+  uint32_t n_toks;
+  uint32_t unused;
+  uint64_t arena_bytes;
+};
+
+static const char token_cache_magic[8] = "CLEXTOK1";
+
+static int load_tokens(const char *cache_path, const char *input_buf,
+                       size_t input_size) {
+  FILE *f = fopen(cache_path, "rb");
+  if (!f)
+    return 0;
+
+  struct token_cache_header hdr;
+  if (fread(&hdr, sizeof(hdr), 1, f) != 1 ||
+      memcmp(hdr.magic, token_cache_magic, sizeof(hdr.magic)) != 0 ||
+      hdr.input_size != input_size ||
+      hdr.input_hash != hash_bytes(input_buf, input_size) ||
+      hdr.arena_bytes > arena_cap) {
+    fclose(f);
+    return 0;
+  }
+
+  uint32_t n = hdr.n_toks;
+  if ((int)n > max_toks) {
+    max_toks = n;
+    tok_off = (uint32_t *)realloc(tok_off, max_toks * sizeof(uint32_t));
+    tok_kinds = (uint8_t *)realloc(tok_kinds, max_toks * sizeof(uint8_t));
+    assert(tok_off && tok_kinds);
+  }
+  // the sidecar keeps a 32-bit kind column so existing caches stay valid
+  uint32_t *kinds = (uint32_t *)malloc((size_t)n * sizeof(uint32_t));
+  assert(kinds);
+  if (fread(tok_off, sizeof(uint32_t), n, f) != n ||
+      fread(kinds, sizeof(uint32_t), n, f) != n ||
+      fread(tok_arena, 1, hdr.arena_bytes, f) != hdr.arena_bytes) {
+    free(kinds);
+    fclose(f);
+    return 0;
+  }
+  fclose(f);
+
+  uint32_t i;
+  for (i = 0; i < n; i++) {
+    if (tok_off[i] >= hdr.arena_bytes ||
+        kinds[i] < TOK_KEYWORD || kinds[i] > TOK_UNKNOWN) {
+      free(kinds);
+      return 0;
+    }
+    tok_kinds[i] = (uint8_t)(kinds[i] - TOK_KEYWORD);
+  }
+  toks = (int)n;
+  arena_used = hdr.arena_bytes;
+  free(kinds);
+  return 1;
+}
+
+static void save_tokens(const char *cache_path, const char *input_buf,
+                        size_t input_size) {
+  size_t path_len = strlen(cache_path);
+  char *tmp_path = (char *)malloc(path_len + 5);
+  assert(tmp_path);
+  sprintf(tmp_path, "%s.tmp", cache_path);
+
+  FILE *f = fopen(tmp_path, "wb");
+  if (!f) {
+    free(tmp_path);
+    return;
+  }
+
+  struct token_cache_header hdr;
+  memcpy(hdr.magic, token_cache_magic, sizeof(hdr.magic));
+  hdr.input_hash = hash_bytes(input_buf, input_size);
+  hdr.input_size = input_size;
+  hdr.n_toks = (uint32_t)toks;
+  hdr.unused = 0;
+  hdr.arena_bytes = arena_used;
+
+  int ok = (fwrite(&hdr, sizeof(hdr), 1, f) == 1);
+  if (ok && toks > 0)
+    ok = (fwrite(tok_off, sizeof(uint32_t), toks, f) == (size_t)toks);
+  int i;
+  for (i = 0; ok && i < toks; i++) {
+    uint32_t kind = (uint32_t)tok_kind(i);
+    ok = (fwrite(&kind, sizeof(kind), 1, f) == 1);
+  }
+  if (ok)
+    ok = (fwrite(tok_arena, 1, arena_used, f) == arena_used);
+  fclose(f);
+
+  if (ok)
+    rename(tmp_path, cache_path);
+  else
+    remove(tmp_path);
+  free(tmp_path);
+}
+
+#ifndef _MSC_VER
+/*
+ * Shared token arena.  With one resident server per Python worker every
+ * worker lexes the identical base file and keeps a private copy of the
+ * token tables.  With CVISE_TOKEN_SHM set, the first server to finish
+ * lexing publishes the entry arrays and the arena into a POSIX shared
+ * memory segment named by the input's content hash and the generation
+ * counter the driver advances in CVISE_TOKEN_GENERATION whenever the
+ * base file moves forward; every later server for the same content
+ * attaches read-only instead of re-lexing.  That is one lex per phase
+ * instead of one per worker, and since all attachers map the same
+ * pages, the table RSS is paid once rather than per worker.
+ *
+ * Publication is create-exclusive with the header magic stored last, so
+ * an attacher either sees a complete segment or lexes privately; nobody
+ * ever waits for a half-filled segment.  The creator unlinks the
+ * segment when its stdin closes -- the driver restarts the servers
+ * whenever the base file advances, which is exactly when the old
+ * generation goes stale.
+ */
+struct tok_shm_header {
+  uint32_t magic;       // stored last; still zero while the creator fills
+  uint32_t version;
+  uint64_t generation;
+  uint64_t input_size;
+  uint64_t n_toks;
+  uint64_t arena_bytes;
+};
+
+#define TOK_SHM_MAGIC 0x4b4f5443u /* "CTOK" */
+#define TOK_SHM_VERSION 1
+
+// distinguishes the clex and strlex token streams; set from argv[0]
+static const char *tok_shm_tool = "clex";
+static char tok_shm_name[96];
+static int tok_shm_created;
+static int tok_shm_attached;
+
+static uint64_t tok_shm_generation(void) {
+  const char *g = getenv("CVISE_TOKEN_GENERATION");
+  return g ? strtoull(g, NULL, 10) : 0;
+}
+
+static void tok_shm_format_name(const char *input_buf, size_t input_size) {
+  sprintf(tok_shm_name, "/cvise-%.15s-%016llx-g%llu", tok_shm_tool,
+          (unsigned long long)hash_bytes(input_buf, input_size),
+          (unsigned long long)tok_shm_generation());
+}
+
+static size_t tok_shm_total(uint64_t n, uint64_t arena_bytes) {
+  return sizeof(struct tok_shm_header) +
+         (size_t)n * (sizeof(uint32_t) + sizeof(uint8_t)) +
+         (size_t)arena_bytes;
+}
+
+static int attach_token_shm(const char *input_buf, size_t input_size) {
+  if (!getenv("CVISE_TOKEN_SHM"))
+    return 0;
+  tok_shm_format_name(input_buf, input_size);
+  int fd = shm_open(tok_shm_name, O_RDONLY, 0);
+  if (fd < 0)
+    return 0;
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      (size_t)st.st_size < sizeof(struct tok_shm_header)) {
+    close(fd);
+    return 0;
+  }
+  size_t map_size = (size_t)st.st_size;
+  char *map = (char *)mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    return 0;
+  const struct tok_shm_header *hdr = (const struct tok_shm_header *)map;
+  if (__atomic_load_n(&hdr->magic, __ATOMIC_ACQUIRE) != TOK_SHM_MAGIC ||
+      hdr->version != TOK_SHM_VERSION ||
+      hdr->generation != tok_shm_generation() ||
+      hdr->input_size != input_size ||
+      hdr->n_toks > (uint64_t)INT32_MAX ||
+      map_size < tok_shm_total(hdr->n_toks, hdr->arena_bytes)) {
+    munmap(map, map_size);
+    return 0;
+  }
+  // replace the freshly allocated empty tables; from here the entry
+  // arrays and the arena are read-only pages shared with every other
+  // attached server
+  free(tok_off);
+  free(tok_kinds);
+  free(tok_arena);
+  tok_off = (uint32_t *)(map + sizeof(struct tok_shm_header));
+  tok_kinds = (uint8_t *)(tok_off + hdr->n_toks);
+  tok_arena = (char *)(tok_kinds + hdr->n_toks);
+  toks = (int)hdr->n_toks;
+  max_toks = toks;
+  arena_used = (size_t)hdr->arena_bytes;
+  arena_cap = arena_used;
+  tok_shm_attached = 1;
+  return 1;
+}
+
+static void publish_token_shm(const char *input_buf, size_t input_size) {
+  if (!getenv("CVISE_TOKEN_SHM"))
+    return;
+  tok_shm_format_name(input_buf, input_size);
+  int fd = shm_open(tok_shm_name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0)
+    return; // another worker published (or is publishing) this content
+  size_t total = tok_shm_total((uint64_t)toks, (uint64_t)arena_used);
+  if (ftruncate(fd, (off_t)total) != 0) {
+    close(fd);
+    shm_unlink(tok_shm_name);
+    return;
+  }
+  char *map =
+      (char *)mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    shm_unlink(tok_shm_name);
+    return;
+  }
+  struct tok_shm_header *hdr = (struct tok_shm_header *)map;
+  uint32_t *off_dst = (uint32_t *)(map + sizeof(struct tok_shm_header));
+  uint8_t *kind_dst = (uint8_t *)(off_dst + toks);
+  char *arena_dst = (char *)(kind_dst + toks);
+  memcpy(off_dst, tok_off, (size_t)toks * sizeof(uint32_t));
+  memcpy(kind_dst, tok_kinds, (size_t)toks * sizeof(uint8_t));
+  memcpy(arena_dst, tok_arena, arena_used);
+  hdr->version = TOK_SHM_VERSION;
+  hdr->generation = tok_shm_generation();
+  hdr->input_size = input_size;
+  hdr->n_toks = (uint64_t)toks;
+  hdr->arena_bytes = (uint64_t)arena_used;
+  // flipping the magic makes the segment valid for attachers
+  __atomic_store_n(&hdr->magic, TOK_SHM_MAGIC, __ATOMIC_RELEASE);
+  munmap(map, total);
+  tok_shm_created = 1;
+}
+
+// A commit splice rewrites the entry arrays in place, so a server
+// attached to the shared segment first takes private copies of them.
+// The arena is never touched after lexing and stays shared; the other
+// attached servers keep serving the unedited generation.
+static void detach_token_shm(void) {
+  if (!tok_shm_attached)
+    return;
+  uint32_t *off_copy = (uint32_t *)malloc((size_t)toks * sizeof(uint32_t));
+  uint8_t *kind_copy = (uint8_t *)malloc((size_t)toks * sizeof(uint8_t));
+  assert(off_copy && kind_copy);
+  memcpy(off_copy, tok_off, (size_t)toks * sizeof(uint32_t));
+  memcpy(kind_copy, tok_kinds, (size_t)toks * sizeof(uint8_t));
+  tok_off = off_copy;
+  tok_kinds = kind_copy;
+  tok_shm_attached = 0;
+}
+#endif // !_MSC_VER
+
+/*
+ * Load the input for yy_scan_buffer, which wants the content followed by
+ * two writable NUL bytes.  When the last page of a private writable
+ * mapping has room for those bytes the file is mmap'ed and flex scans
+ * the page cache directly; otherwise (empty file, size a multiple of the
+ * page size, or no mmap on this platform) the file is read into one
+ * malloc'ed buffer.
+ */
+/*
+ * With CVISE_PREFAULT_SOURCE set, inputs past a megabyte are faulted in
+ * up front (MAP_POPULATE) and marked huge-page friendly: a cold
+ * multi-hundred-MB preprocessed file otherwise arrives 4 KB fault by
+ * 4 KB fault while flex lexes it, with the TLB misses to match.  Tiny
+ * probe inputs skip the extra syscall work.
+ */
+#ifndef _MSC_VER
+static int prefault_wanted(size_t size) {
+  return (size >= (1u << 20)) && getenv("CVISE_PREFAULT_SOURCE");
+}
+#endif
+
+static char *load_input(const char *path, size_t *size_out) {
+#ifndef _MSC_VER
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return NULL;
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    return NULL;
+  }
+  size_t size = (size_t)st.st_size;
+  long page = sysconf(_SC_PAGESIZE);
+  if ((size > 0) && ((size % page) != 0) &&
+      ((size % page) <= (size_t)(page - 2))) {
+    int mmap_flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (prefault_wanted(size))
+      mmap_flags |= MAP_POPULATE;
+#endif
+    char *buf = (char *)mmap(NULL, size + 2, PROT_READ | PROT_WRITE,
+                             mmap_flags, fd, 0);
+    if (buf != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+      if (prefault_wanted(size))
+        madvise(buf, size, MADV_HUGEPAGE);
+#endif
+      close(fd);
+      buf[size] = 0;
+      buf[size + 1] = 0;
+      *size_out = size;
+      return buf;
+    }
+  }
+  close(fd);
+#endif
+  FILE *in = fopen(path, "rb");
+  if (!in)
+    return NULL;
+  fseek(in, 0, SEEK_END);
+  long file_size = ftell(in);
+  if (file_size < 0) {
+    fclose(in);
+    return NULL;
+  }
+  fseek(in, 0, SEEK_SET);
+  char *buf = (char *)malloc((size_t)file_size + 2);
+  assert(buf);
+  size_t nread = fread(buf, 1, (size_t)file_size, in);
+  fclose(in);
+  if (nread != (size_t)file_size) {
+    free(buf);
+    return NULL;
+  }
+  buf[file_size] = 0;
+  buf[file_size + 1] = 0;
+  *size_out = (size_t)file_size;
+  return buf;
+}
+
+static enum mode_t parse_mode(const char *cmd) {
   if (strcmp(cmd, "rename-toks") == 0) {
-    mode = MODE_RENAME;
+    return MODE_RENAME;
   } else if (strcmp(cmd, "print") == 0) {
-    mode = MODE_PRINT;
+    return MODE_PRINT;
   } else if (strcmp(cmd, "delete-string") == 0) {
-    mode = MODE_DELETE_STRING;
+    return MODE_DELETE_STRING;
   } else if (strcmp(cmd, "shorten-string") == 0) {
-    mode = MODE_SHORTEN_STRING;
+    return MODE_SHORTEN_STRING;
+  } else if (strcmp(cmd, "shorten-string-all") == 0) {
+    return MODE_SHORTEN_STRING_ALL;
   } else if (strcmp(cmd, "x-string") == 0) {
-    mode = MODE_X_STRING;
+    return MODE_X_STRING;
+  } else if (strcmp(cmd, "x-string-all") == 0) {
+    return MODE_X_STRING_ALL;
+  } else if (strncmp(cmd, "rm-toks-hier-", 13) == 0) {
+    int res = sscanf(&cmd[13], "%d", &n_toks);
+    if (res != 1 || n_toks <= 1 || n_toks > 1000)
+      return MODE_NONE;
+    return MODE_RM_TOKS_HIER;
+  } else if (strncmp(cmd, "rm-toks-all-", 12) == 0) {
+    int res = sscanf(&cmd[12], "%d", &n_toks);
+    if (res != 1 || n_toks <= 0 || n_toks > 1000)
+      return MODE_NONE;
+    return MODE_RM_TOKS_ALL;
   } else if (strncmp(cmd, "rm-toks-", 8) == 0) {
-    mode = MODE_RM_TOKS;
     int res = sscanf(&cmd[8], "%d", &n_toks);
-    assert(res == 1);
-    assert(n_toks > 0 && n_toks <= 1000);
+    if (res != 1 || n_toks <= 0 || n_toks > 1000)
+      return MODE_NONE;
+    return MODE_RM_TOKS;
   } else if (strncmp(cmd, "rm-tok-pattern-", 15) == 0) {
-    mode = MODE_RM_TOK_PATTERN;
     int res = sscanf(&cmd[15], "%d", &n_toks);
-    assert(res == 1);
-    assert(n_toks > 1 && n_toks <= 8);
+    if (res != 1 || n_toks <= 1 || n_toks > 8)
+      return MODE_NONE;
+    return MODE_RM_TOK_PATTERN;
   } else if (strcmp(cmd, "define") == 0) {
-    mode = MODE_DEFINE;
-  } else {
-    printf("error: unknown mode '%s'\n", cmd);
-    assert(0);
-  }
-
-  int tok_index;
-  int ret = sscanf(argv[2], "%d", &tok_index);
-  assert(ret == 1);
-  // printf ("file = '%s'\n", argv[3]);
-  FILE *in = fopen(argv[3], "r");
-  if (!in) {
-    fprintf(stderr, "Cannot open file: %s\n", argv[3]);
-    exit(STOP);
+    return MODE_DEFINE;
+  } else if (strcmp(cmd, "hash-normalized") == 0) {
+    return MODE_HASH_NORMALIZED;
   }
-  yyin = in;
-
-  max_toks = initial_length;
-  tok_list = (struct tok_t *)malloc(max_toks * sizeof(struct tok_t));
-  assert(tok_list);
-
-  yylex();
+  return MODE_NONE;
+}
 
-  // these calls all exit() at the end
+static int run_mode(enum mode_t mode, int tok_index) {
   switch (mode) {
   case MODE_PRINT:
-    print_toks();
-    __builtin_unreachable();
+    return print_toks();
   case MODE_RENAME:
-    rename_toks(tok_index);
-    __builtin_unreachable();
+    return rename_toks(tok_index);
   case MODE_DELETE_STRING:
-    delete_string(tok_index);
-    __builtin_unreachable();
+    return delete_string(tok_index);
   case MODE_SHORTEN_STRING:
-    shorten_string(tok_index);
-    __builtin_unreachable();
+    return shorten_string(tok_index);
+  case MODE_SHORTEN_STRING_ALL:
+  case MODE_X_STRING_ALL:
+    return string_all(mode);
   case MODE_X_STRING:
-    x_string(tok_index);
-    __builtin_unreachable();
+    return x_string(tok_index);
   case MODE_RM_TOKS:
-    rm_toks(tok_index);
-    __builtin_unreachable();
+    return rm_toks(tok_index);
+  case MODE_RM_TOKS_HIER:
+    return rm_toks_hier(tok_index);
+  case MODE_RM_TOKS_ALL:
+    return rm_toks_all();
   case MODE_RM_TOK_PATTERN:
-    rm_tok_pattern(tok_index);
-    __builtin_unreachable();
+    return rm_tok_pattern(tok_index);
   case MODE_DEFINE:
-    define(tok_index);
-    __builtin_unreachable();
+    return define(tok_index);
+  case MODE_HASH_NORMALIZED:
+    return hash_normalized();
   default:
     __builtin_unreachable();
   }
 }
+
+/*
+ * Server mode: lex the input once and then serve "<command> <index>"
+ * request lines from stdin.  Each reply is a header line "<status>
+ * <length>" followed by exactly <length> bytes of candidate output,
+ * where <status> is the exit code the one-shot mode would have used.
+ * EOF on stdin ends the server.  This amortizes process startup and
+ * lexing over all probes of one unchanged input file.
+ *
+ * Two additional requests expose rm-toks candidates as views:
+ * "views rm-toks-<n>" replies with the candidate count as its payload,
+ * and "materialize <id> <path>" writes candidate <id> to <path> with an
+ * empty reply payload.  "materialize-batch <count>" takes <count>
+ * follow-up lines "<id> <path>" and writes them all before one reply,
+ * batching the file writes over io_uring where available; its payload
+ * reports one "<id> <status>" line per candidate.
+ *
+ * "commit rm-toks-<n> <idx>" applies an accepted rm-toks candidate to
+ * the resident token list in place, so the server keeps serving the
+ * edited file without a re-lex; "commit rm-toks-hier-<max> <idx>" does
+ * the same for the hierarchical mode, which is how its coarse-level
+ * removals become invisible to the finer levels.  Commands other than
+ * these answer STOP and the driver falls back to restarting the server.
+ *
+ * "density" replies with the acceptance-density map accumulated from
+ * the rm-toks probes and commits served so far; see the comment at
+ * DENSITY_BUCKETS.
+ */
+static void serve(void) {
+  char line[1024];
+  out_buffered = 1;
+  while (fgets(line, sizeof(line), stdin)) {
+    char cmd[256];
+    int tok_index;
+#ifndef _MSC_VER
+    if (strncmp(line, "views ", 6) == 0) {
+      char sub[256];
+      int count = 0;
+      if (sscanf(line + 6, "%255s", sub) == 1 &&
+          parse_mode(sub) == MODE_RM_TOKS)
+        count = build_rm_toks_views();
+      char payload[32];
+      int plen = sprintf(payload, "%d\n", count);
+      printf("%d %d\n", count ? OK : STOP, plen);
+      fwrite(payload, 1, (size_t)plen, stdout);
+      fflush(stdout);
+      continue;
+    }
+    if (strncmp(line, "materialize-batch ", 18) == 0) {
+      int count;
+      if (sscanf(line + 18, "%d", &count) == 1 && count > 0) {
+        serve_materialize_batch(count);
+      }
+      else {
+        printf("%d 0\n", STOP);
+        fflush(stdout);
+      }
+      continue;
+    }
+    if (strncmp(line, "materialize ", 12) == 0) {
+      int id;
+      char path[768];
+      int status = STOP;
+      if (sscanf(line + 12, "%d %767s", &id, path) == 2)
+        status = materialize_view(id, path);
+      printf("%d 0\n", status);
+      fflush(stdout);
+      continue;
+    }
+    if (strncmp(line, "commit ", 7) == 0) {
+      char sub[256];
+      int idx;
+      int status = STOP;
+      if (sscanf(line + 7, "%255s %d", sub, &idx) == 2) {
+        enum mode_t sub_mode = parse_mode(sub);
+        if (sub_mode == MODE_RM_TOKS)
+          status = commit_rm_toks(idx);
+        else if (sub_mode == MODE_RM_TOKS_HIER)
+          status = commit_rm_toks_hier(idx);
+      }
+      printf("%d 0\n", status);
+      fflush(stdout);
+      continue;
+    }
+#endif
+    if (strcmp(line, "density\n") == 0 || strcmp(line, "density") == 0) {
+      out_len = 0;
+      int b;
+      for (b = 0; b < DENSITY_BUCKETS; b++) {
+        if (density_probes[b] == 0 && density_accepts[b] == 0)
+          continue;
+        char tmp[80];
+        sprintf(tmp, "%d %lu %lu\n", b, density_probes[b],
+                density_accepts[b]);
+        out_str(tmp);
+      }
+      printf("%d %lu\n", OK, (unsigned long)out_len);
+      fwrite(out_buf, 1, out_len, stdout);
+      out_len = 0;
+      fflush(stdout);
+      continue;
+    }
+    if (sscanf(line, "%255s %d", cmd, &tok_index) != 2) {
+      printf("%d 0\n", STOP);
+      fflush(stdout);
+      continue;
+    }
+    enum mode_t mode = parse_mode(cmd);
+    // the batch modes write their own multi-candidate stream and would
+    // break the per-request framing
+    if (mode == MODE_NONE || mode == MODE_RM_TOKS_ALL ||
+        mode == MODE_SHORTEN_STRING_ALL || mode == MODE_X_STRING_ALL) {
+      printf("%d 0\n", STOP);
+      fflush(stdout);
+      continue;
+    }
+    if (mode == MODE_RM_TOKS)
+      density_record(density_probes, tok_index);
+    else if (mode == MODE_RM_TOKS_HIER) {
+      int hier_size, hier_pos;
+      if (hier_geometry(tok_index, &hier_size, &hier_pos))
+        density_record(density_probes, hier_pos);
+    }
+    out_len = 0;
+    int status = run_mode(mode, tok_index);
+    printf("%d %lu\n", status, (unsigned long)(status == OK ? out_len : 0));
+    if (status == OK)
+      fwrite(out_buf, 1, out_len, stdout);
+    fflush(stdout);
+  }
+#ifndef _MSC_VER
+  // stdin closed: the driver is retiring this generation of servers, so
+  // the creator retires the segment with it (attached mappings survive
+  // until their owners exit)
+  if (tok_shm_created)
+    shm_unlink(tok_shm_name);
+#endif
+}
+
+#ifndef _MSC_VER
+// Optional perf ledger (CVISE_PERF_LEDGER): one fixed-size record per
+// invocation, appended atomically.  The layout is defined and decoded by
+// "cvise_tools stats".
+static void ledger_append(const char *tool, const char *phase,
+                          uint64_t duration_us, uint64_t bytes_in,
+                          uint64_t bytes_out, uint32_t error_code) {
+  const char *path = getenv("CVISE_PERF_LEDGER");
+  if (!path)
+    return;
+  struct {
+    char tool[8];
+    char phase[16];
+    uint64_t duration_us;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint32_t error_code;
+    uint32_t reserved;
+  } rec;
+  memset(&rec, 0, sizeof(rec));
+  strncpy(rec.tool, tool, sizeof(rec.tool) - 1);
+  strncpy(rec.phase, phase, sizeof(rec.phase) - 1);
+  rec.duration_us = duration_us;
+  rec.bytes_in = bytes_in;
+  rec.bytes_out = bytes_out;
+  rec.error_code = error_code;
+  int fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0666);
+  if (fd < 0)
+    return;
+  ssize_t w = write(fd, &rec, sizeof(rec));
+  (void)w;
+  close(fd);
+}
+
+static uint64_t now_us(void) {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// With CVISE_DROP_OUTPUT_CACHE set, evict the candidate we just wrote
+// from the page cache; it is read once by the interestingness test and
+// then deleted, so keeping its pages resident only displaces hotter
+// data.  Only applies when stdout was redirected to a regular file, and
+// needs the fdatasync first because DONTNEED leaves dirty pages alone.
+static void drop_stdout_cache(void) {
+  struct stat st;
+  if (!getenv("CVISE_DROP_OUTPUT_CACHE"))
+    return;
+  if (fstat(STDOUT_FILENO, &st) != 0 || !S_ISREG(st.st_mode))
+    return;
+  fdatasync(STDOUT_FILENO);
+  posix_fadvise(STDOUT_FILENO, 0, 0, POSIX_FADV_DONTNEED);
+}
+#endif
+
+int main(int argc, char *argv[]) {
+#ifndef _MSC_VER
+  uint64_t start_us = now_us();
+#endif
+  if (argc < 4 || argc > 6) {
+    printf("USAGE: %s command index file [--load-tokens] [--save-tokens]\n",
+           argv[0]);
+    exit(STOP);
+  }
+
+  int load_cache = 0;
+  int save_cache = 0;
+  int i;
+  for (i = 4; i < argc; i++) {
+    if (strcmp(argv[i], "--load-tokens") == 0) {
+      load_cache = 1;
+    } else if (strcmp(argv[i], "--save-tokens") == 0) {
+      save_cache = 1;
+    } else {
+      printf("error: unknown option '%s'\n", argv[i]);
+      exit(STOP);
+    }
+  }
+
+  char *cmd = argv[1];
+  int server_mode = (strcmp(cmd, "server") == 0);
+  enum mode_t mode = MODE_NONE;
+  if (!server_mode) {
+    mode = parse_mode(cmd);
+    if (mode == MODE_NONE) {
+      printf("error: unknown mode '%s'\n", cmd);
+      assert(0);
+    }
+  }
+
+  int tok_index;
+  int ret = sscanf(argv[2], "%d", &tok_index);
+  assert(ret == 1);
+  // printf ("file = '%s'\n", argv[3]);
+  size_t input_size;
+  char *input_buf = load_input(argv[3], &input_size);
+  if (!input_buf) {
+    fprintf(stderr, "Cannot open file: %s\n", argv[3]);
+    exit(STOP);
+  }
+
+  init_tok_storage(input_size);
+
+  char *cache_path = NULL;
+  if (load_cache || save_cache) {
+    cache_path = (char *)malloc(strlen(argv[3]) + 5);
+    assert(cache_path);
+    sprintf(cache_path, "%s.tok", argv[3]);
+  }
+
+  int have_tokens = 0;
+#ifndef _MSC_VER
+  {
+    // distinguishes the clex and strlex builds sharing this driver
+    const char *tool = strrchr(argv[0], '/');
+    tok_shm_tool = tool ? tool + 1 : argv[0];
+  }
+  // one-shot runs are too short-lived to amortize publishing a segment
+  if (server_mode && attach_token_shm(input_buf, input_size))
+    have_tokens = 1;
+#endif
+  if (!have_tokens && load_cache &&
+      load_tokens(cache_path, input_buf, input_size))
+    have_tokens = 1;
+  if (!have_tokens) {
+    yy_scan_buffer(input_buf, input_size + 2);
+    yylex();
+    if (save_cache)
+      save_tokens(cache_path, input_buf, input_size);
+  }
+#ifndef _MSC_VER
+  if (server_mode && !tok_shm_attached)
+    publish_token_shm(input_buf, input_size);
+#endif
+
+  if (server_mode) {
+    serve();
+    exit(OK);
+  }
+
+  // Collect the candidate in memory and hand it to stdio in one piece;
+  // emitting token-by-token was syscall-bound on large outputs.
+  out_buffered = 1;
+  int status = run_mode(mode, tok_index);
+  if (out_len)
+    fwrite(out_buf, 1, out_len, stdout);
+#ifndef _MSC_VER
+  fflush(stdout);
+  drop_stdout_cache();
+  {
+    // tool name distinguishes the clex and strlex builds of this driver
+    const char *tool = strrchr(argv[0], '/');
+    tool = tool ? tool + 1 : argv[0];
+    ledger_append(tool, cmd, now_us() - start_us, input_size,
+                  status == OK ? out_len : 0, status == OK ? 0 : status);
+  }
+#endif
+  exit(status);
+}
@@ -0,0 +1,189 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/*
+ * nestedmatcher: build the complete matched-pair table for balanced
+ * delimiters in one scan over the raw bytes.
+ *
+ * usage: nestedmatcher [file]
+ *
+ * Reads <file> (stdin when omitted) and writes a binary table to stdout:
+ *
+ *   magic    "CVNM1\n"
+ *   4 records, one per delimiter class in the order () {} [] <>:
+ *     u8  open char
+ *     u8  close char
+ *     u64 number of pairs, little endian
+ *     pairs: u64 open offset, u64 close offset (little endian),
+ *            sorted by open offset
+ *
+ * Each class is matched independently of the others, exactly like the
+ * Python BalancedPattern in cvise/utils/nestedmatcher.py: every byte
+ * counts, including delimiters inside strings and comments, and
+ * unbalanced delimiters are dropped.  The Python matcher rescans the
+ * file per candidate; this table answers every balanced-extent query
+ * for the file from one pass.
+ */
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_CLASSES 4
+
+static const char open_chars[NUM_CLASSES] = { '(', '{', '[', '<' };
+static const char close_chars[NUM_CLASSES] = { ')', '}', ']', '>' };
+
+typedef struct {
+  size_t open_off;
+  size_t close_off;
+} pair;
+
+typedef struct {
+  size_t *data;
+  size_t count;
+  size_t cap;
+} offset_stack;
+
+typedef struct {
+  pair *data;
+  size_t count;
+  size_t cap;
+} pair_list;
+
+static void die(const char *msg)
+{
+  fprintf(stderr, "nestedmatcher: %s\n", msg);
+  exit(1);
+}
+
+static void *grow(void *data, size_t *cap, size_t elem_size)
+{
+  size_t new_cap = *cap ? (*cap * 2) : 64;
+  void *p = realloc(data, new_cap * elem_size);
+  if (!p)
+    die("out of memory");
+  *cap = new_cap;
+  return p;
+}
+
+static char *read_all(FILE *f, size_t *len)
+{
+  size_t cap = 1 << 20;
+  size_t used = 0;
+  char *buf = malloc(cap);
+  if (!buf)
+    die("out of memory");
+  for (;;) {
+    size_t n = fread(buf + used, 1, cap - used, f);
+    used += n;
+    if (used < cap)
+      break;
+    buf = realloc(buf, cap * 2);
+    if (!buf)
+      die("out of memory");
+    cap *= 2;
+  }
+  if (ferror(f))
+    die("read error");
+  *len = used;
+  return buf;
+}
+
+static int cmp_pair(const void *a, const void *b)
+{
+  const pair *pa = (const pair *)a;
+  const pair *pb = (const pair *)b;
+  if (pa->open_off < pb->open_off)
+    return -1;
+  if (pa->open_off > pb->open_off)
+    return 1;
+  return 0;
+}
+
+static void put_u64(unsigned long long v)
+{
+  unsigned char bytes[8];
+  int i;
+  for (i = 0; i < 8; i++) {
+    bytes[i] = (unsigned char)(v & 0xff);
+    v >>= 8;
+  }
+  fwrite(bytes, 1, 8, stdout);
+}
+
+int main(int argc, char *argv[])
+{
+  FILE *in = stdin;
+  size_t len;
+  char *buf;
+  /* byte -> (class index + 1), negated for closers; 0 means no delimiter */
+  signed char classify[256];
+  offset_stack stacks[NUM_CLASSES];
+  pair_list pairs[NUM_CLASSES];
+  size_t pos;
+  int c;
+
+  if (argc > 1) {
+    in = fopen(argv[1], "rb");
+    if (!in)
+      die("cannot open input file");
+  }
+
+  buf = read_all(in, &len);
+  if (in != stdin)
+    fclose(in);
+
+  memset(classify, 0, sizeof(classify));
+  memset(stacks, 0, sizeof(stacks));
+  memset(pairs, 0, sizeof(pairs));
+  for (c = 0; c < NUM_CLASSES; c++) {
+    classify[(unsigned char)open_chars[c]] = (signed char)(c + 1);
+    classify[(unsigned char)close_chars[c]] = (signed char)(-(c + 1));
+  }
+
+  for (pos = 0; pos < len; pos++) {
+    int cls = classify[(unsigned char)buf[pos]];
+    if (cls > 0) {
+      offset_stack *st = &stacks[cls - 1];
+      if (st->count == st->cap)
+        st->data = grow(st->data, &st->cap, sizeof(size_t));
+      st->data[st->count++] = pos;
+    }
+    else if (cls < 0) {
+      offset_stack *st = &stacks[-cls - 1];
+      pair_list *pl = &pairs[-cls - 1];
+      if (st->count == 0)
+        continue;
+      if (pl->count == pl->cap)
+        pl->data = grow(pl->data, &pl->cap, sizeof(pair));
+      pl->data[pl->count].open_off = st->data[--st->count];
+      pl->data[pl->count].close_off = pos;
+      pl->count++;
+    }
+  }
+
+  fwrite("CVNM1\n", 1, 6, stdout);
+  for (c = 0; c < NUM_CLASSES; c++) {
+    size_t i;
+    qsort(pairs[c].data, pairs[c].count, sizeof(pair), cmp_pair);
+    fputc(open_chars[c], stdout);
+    fputc(close_chars[c], stdout);
+    put_u64((unsigned long long)pairs[c].count);
+    for (i = 0; i < pairs[c].count; i++) {
+      put_u64((unsigned long long)pairs[c].data[i].open_off);
+      put_u64((unsigned long long)pairs[c].data[i].close_off);
+    }
+  }
+
+  if (fflush(stdout) != 0)
+    die("write error");
+  free(buf);
+  return 0;
+}
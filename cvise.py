@@ -61,6 +61,7 @@ def find_external_programs():
         'clang_delta': 'clang_delta',
         'clex': 'clex',
         'topformflat': 'delta',
+        'ppdirindex': 'tools',
         'unifdef': None,
         'gcov-dump': None,
     }
@@ -246,6 +247,11 @@ if __name__ == '__main__':
         help='Remove all instances of the specified passes from the schedule (comma-separated)',
     )
     parser.add_argument('--start-with-pass', help='Start with the specified pass')
+    parser.add_argument(
+        '--snapshot',
+        metavar='FILE',
+        help='Save reduction progress into FILE after each pass and, when FILE exists and still matches the test cases and pass schedule, resume from it instead of starting over',
+    )
     parser.add_argument(
         '--no-timing',
         action='store_true',
@@ -473,6 +479,7 @@ if __name__ == '__main__':
     reducer = CVise(test_manager, args.skip_interestingness_test_check)
 
     reducer.tidy = args.tidy
+    reducer.snapshot_path = args.snapshot
 
     # Track runtime
     time_start = time.monotonic()
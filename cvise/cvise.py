@@ -21,6 +21,7 @@ from cvise.passes.peep import PeepPass
 from cvise.passes.special import SpecialPass
 from cvise.passes.ternary import TernaryPass
 from cvise.passes.unifdef import UnIfDefPass
+from cvise.utils import snapshot
 from cvise.utils.error import CViseError, PassOptionError
 
 
@@ -61,6 +62,8 @@ class CVise:
         self.test_manager = test_manager
         self.skip_interestingness_test_check = skip_interestingness_test_check
         self.tidy = False
+        self.snapshot_path = None
+        self._main_pass_names = []
 
     @classmethod
     def load_pass_group_file(cls, path):
@@ -158,16 +161,30 @@ class CVise:
         if not self.tidy:
             self.test_manager.backup_test_cases()
 
-        if not skip_initial:
+        self._main_pass_names = [str(p) for p in pass_group['main']]
+        resume = None
+        if self.snapshot_path:
+            resume = snapshot.read(self.snapshot_path, self.test_manager.test_cases, self._main_pass_names)
+            if resume:
+                logging.info(f'Resuming from snapshot {self.snapshot_path}')
+                self.test_manager.cache = resume['pass_cache']
+
+        if not skip_initial and not (resume and resume['initial_done']):
             logging.info('INITIAL PASSES')
             self._run_additional_passes(pass_group['first'])
+            self._write_snapshot(next_main_pass=0)
 
         logging.info('MAIN PASSES')
-        self._run_main_passes(pass_group['main'])
+        self._run_main_passes(pass_group['main'], resume['next_main_pass'] if resume else 0)
 
+        # Cleanup passes are cheap enough to re-run in full, so the
+        # snapshot does not track positions inside them.
         logging.info('CLEANUP PASSES')
         self._run_additional_passes(pass_group['last'])
 
+        if self.snapshot_path:
+            snapshot.remove(self.snapshot_path)
+
         logging.info('===================== done ====================')
         return True
 
@@ -185,12 +202,29 @@ class CVise:
             else:
                 self.test_manager.run_pass(p)
 
-    def _run_main_passes(self, passes):
+    def _write_snapshot(self, next_main_pass):
+        if not self.snapshot_path:
+            return
+        snapshot.write(
+            self.snapshot_path,
+            {
+                'initial_done': True,
+                'next_main_pass': next_main_pass,
+                'main_pass_names': self._main_pass_names,
+                'test_case_hashes': snapshot.hash_test_cases(self.test_manager.test_cases),
+                'pass_cache': self.test_manager.cache,
+            },
+        )
+
+    def _run_main_passes(self, passes, start_index=0):
         while True:
             total_file_size = self.test_manager.total_file_size
 
             met_stopping_threshold = False
-            for p in passes:
+            for pass_index, p in enumerate(passes):
+                # a resumed run re-enters the schedule where it left off
+                if pass_index < start_index:
+                    continue
                 # Exit early if we're already reduced enough
                 improvement = (
                     self.test_manager.orig_total_file_size - total_file_size
@@ -205,6 +239,10 @@ class CVise:
                     logging.error(f'Skipping pass {p}')
                 else:
                     self.test_manager.run_pass(p)
+                # wrap at the end of a sweep so a resumed run re-enters
+                # the schedule at the top instead of skipping a sweep
+                self._write_snapshot(next_main_pass=(pass_index + 1) % len(passes))
+            start_index = 0
 
             logging.info(f'Termination check: size was {total_file_size}; now {self.test_manager.total_file_size}')
 
@@ -2,6 +2,7 @@ import copy
 from enum import auto, Enum, unique
 import logging
 import shutil
+import struct
 import subprocess
 
 
@@ -14,6 +15,16 @@ class PassResult(Enum):
 
 
 class BinaryState:
+    # Binary sidecar format shared with the native line engine
+    # (delta/linesplice.cpp, "stsave"/"stload"): an 8-byte magic, then
+    # the byte size of the file the state was saved against, the
+    # instance count, the current chunk (granularity) and the next index
+    # as little-endian u64.  A state only means anything for the exact
+    # contents it describes, so loading validates the recorded size and
+    # returns None on any mismatch instead of resuming a stale cursor.
+    STATE_MAGIC = b'CVLSTAT1'
+    STATE_STRUCT = struct.Struct('<8sQQQQ')
+
     def __init__(self):
         pass
 
@@ -61,6 +72,32 @@ class BinaryState:
         else:
             return self
 
+    def save(self, path, file_size):
+        data = self.STATE_STRUCT.pack(self.STATE_MAGIC, file_size, self.instances, self.chunk, self.index)
+        with open(path, 'wb') as f:
+            f.write(data)
+
+    @classmethod
+    def load(cls, path, file_size):
+        try:
+            with open(path, 'rb') as f:
+                data = f.read(cls.STATE_STRUCT.size)
+        except OSError:
+            return None
+        if len(data) != cls.STATE_STRUCT.size:
+            return None
+        magic, size, instances, chunk, index = cls.STATE_STRUCT.unpack(data)
+        if magic != cls.STATE_MAGIC or size != file_size:
+            return None
+        if not instances or not 1 <= chunk <= instances or index >= instances:
+            return None
+        self = cls()
+        self.instances = instances
+        self.chunk = chunk
+        self.index = index
+        logging.debug(f'resumed {self} from {path}')
+        return self
+
 
 class AbstractPass:
     @unique
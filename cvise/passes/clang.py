@@ -7,6 +7,8 @@ from cvise.utils.misc import CloseableTemporaryFile
 
 
 class ClangPass(AbstractPass):
+    DIFF_HEADER = '@CVISE-DIFF '
+
     def check_prerequisites(self):
         return self.check_external_program('clang_delta')
 
@@ -19,13 +21,24 @@ class ClangPass(AbstractPass):
     def advance_on_success(self, test_case, state):
         return state
 
+    def apply_diff(self, test_case, stdout):
+        # "@CVISE-DIFF <offset> <length> <replacement-length>" followed by
+        # the replacement bytes; all counts are byte-based.
+        header, _, rest = stdout.partition('\n')
+        offset, length, repl_len = (int(v) for v in header.split()[1:])
+        replacement = rest.encode('utf8')[:repl_len]
+        with open(test_case, 'rb') as in_file:
+            data = in_file.read()
+        return data[:offset] + replacement + data[offset + length :]
+
     def transform(self, test_case, state, process_event_notifier):
         tmp = os.path.dirname(test_case)
-        with CloseableTemporaryFile(mode='w', dir=tmp) as tmp_file:
+        with CloseableTemporaryFile(mode='wb', dir=tmp) as tmp_file:
             args = [
                 self.external_programs['clang_delta'],
                 f'--transformation={self.arg}',
                 f'--counter={state}',
+                '--emit-diff',
             ]
             if self.user_clang_delta_std:
                 args.append(f'--std={self.user_clang_delta_std}')
@@ -35,7 +48,10 @@ class ClangPass(AbstractPass):
 
             stdout, _, returncode = process_event_notifier.run_process(cmd)
             if returncode == 0:
-                tmp_file.write(stdout)
+                if stdout.startswith(self.DIFF_HEADER):
+                    tmp_file.write(self.apply_diff(test_case, stdout))
+                else:
+                    tmp_file.write(stdout.encode('utf8'))
                 tmp_file.close()
                 shutil.copy(tmp_file.name, test_case)
                 return (PassResult.OK, state)
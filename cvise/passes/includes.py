@@ -1,6 +1,7 @@
 import os
 import re
 import shutil
+import subprocess
 import tempfile
 
 from cvise.passes.abstract import AbstractPass, PassResult
@@ -19,7 +20,51 @@ class IncludesPass(AbstractPass):
     def advance_on_success(self, test_case, state):
         return state
 
+    def find_include(self, test_case, state):
+        """Locate the state-th include with the native directive scanner.
+
+        Returns the (offset, length) byte span of the directive, () when
+        there are fewer includes than state, or None when the scanner is
+        unavailable and the caller should fall back to the line loop.
+        """
+        prog = self.external_programs.get('ppdirindex')
+        if not prog or not shutil.which(prog):
+            return None
+
+        try:
+            proc = subprocess.run([prog, 'index', test_case], text=True, capture_output=True)
+        except (subprocess.SubprocessError, OSError):
+            return None
+        if proc.returncode != 0:
+            return None
+
+        includes = 0
+        for line in proc.stdout.splitlines():
+            fields = line.split()
+            if len(fields) < 4 or fields[0] != 'include':
+                continue
+            includes += 1
+            if includes == state:
+                return (int(fields[2]), int(fields[3]))
+        return ()
+
     def transform(self, test_case, state, process_event_notifier):
+        span = self.find_include(test_case, state)
+        if span == ():
+            return (PassResult.STOP, state)
+        if span is not None:
+            # one native scan and a byte splice instead of a Python
+            # regex pass over every line per candidate
+            offset, length = span
+            with open(test_case, 'rb') as in_file:
+                data = in_file.read()
+            tmp = os.path.dirname(test_case)
+            with tempfile.NamedTemporaryFile(mode='wb', delete=False, dir=tmp) as tmp_file:
+                tmp_file.write(data[:offset])
+                tmp_file.write(data[offset + length :])
+            shutil.move(tmp_file.name, test_case)
+            return (PassResult.OK, state)
+
         tmp = os.path.dirname(test_case)
         with tempfile.NamedTemporaryFile(mode='w+', delete=False, dir=tmp) as tmp_file:
             with open(test_case) as in_file:
@@ -52,6 +52,20 @@ class LinesPass(AbstractPass):
             lines = in_file.readlines()
             return len(lines)
 
+    @staticmethod
+    def __state_path(test_case):
+        return f'{test_case}.lst'
+
+    def __save_state(self, test_case, state):
+        path = self.__state_path(test_case)
+        if state is None:
+            try:
+                os.unlink(path)
+            except OSError:
+                pass
+        else:
+            state.save(path, os.path.getsize(test_case))
+
     def new(self, test_case, check_sanity=None):
         self.bailout = False
         # None means no topformflat
@@ -60,14 +74,28 @@ class LinesPass(AbstractPass):
             if self.bailout:
                 logging.warning('Skipping pass as sanity check fails for topformflat output')
                 return None
+        # resume from a state sidecar left by an earlier run, if it still
+        # matches the formatted file; otherwise count the lines afresh
+        state = BinaryState.load(self.__state_path(test_case), os.path.getsize(test_case))
+        if state is not None:
+            return state
         instances = self.__count_instances(test_case)
         return BinaryState.create(instances)
 
     def advance(self, test_case, state):
-        return state.advance()
+        state = state.advance()
+        self.__save_state(test_case, state)
+        return state
 
     def advance_on_success(self, test_case, state):
-        return state.advance_on_success(self.__count_instances(test_case))
+        # transform already counted the surviving lines, so don't
+        # re-read the whole file just to learn the new instance total
+        instances = getattr(state, 'instances_after', None)
+        if instances is None:
+            instances = self.__count_instances(test_case)
+        # no sidecar update here: test_case is the environment's copy of
+        # the file, and the next advance() persists against the real one
+        return state.advance_on_success(instances)
 
     def transform(self, test_case, state, process_event_notifier):
         with open(test_case) as in_file:
@@ -76,6 +104,7 @@ class LinesPass(AbstractPass):
         old_len = len(data)
         data = data[0 : state.index] + data[state.end() :]
         assert len(data) < old_len
+        state.instances_after = len(data)
 
         tmp = os.path.dirname(test_case)
         with tempfile.NamedTemporaryFile(mode='w+', delete=False, dir=tmp) as tmp_file:
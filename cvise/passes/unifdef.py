@@ -21,8 +21,15 @@ class UnIfDefPass(AbstractPass):
         return state
 
     def transform(self, test_case, state, process_event_notifier):
-        try:
+        # the native directive scanner lists the tested macros without
+        # spending another unifdef invocation per candidate
+        ppdirindex = self.external_programs.get('ppdirindex')
+        if ppdirindex and shutil.which(ppdirindex):
+            cmd = [ppdirindex, 'symbols', test_case]
+        else:
             cmd = [self.external_programs['unifdef'], '-s', test_case]
+
+        try:
             proc = subprocess.run(cmd, text=True, capture_output=True)
         except subprocess.SubprocessError:
             return (PassResult.ERROR, state)
@@ -0,0 +1,66 @@
+import os
+import tempfile
+import unittest
+
+from cvise.utils import snapshot
+
+
+class SnapshotTest(unittest.TestCase):
+    def setUp(self):
+        self.folder = tempfile.TemporaryDirectory(prefix='cvise-snapshot-test-')
+        self.test_case = os.path.join(self.folder.name, 'input.c')
+        with open(self.test_case, 'w') as f:
+            f.write('int main(void) { return 0; }\n')
+        self.snapshot_path = os.path.join(self.folder.name, 'snapshot')
+        self.pass_names = ['LinesPass::0', 'ClangPass::remove-unused-function']
+
+    def tearDown(self):
+        self.folder.cleanup()
+
+    def write_snapshot(self, next_main_pass=1):
+        snapshot.write(
+            self.snapshot_path,
+            {
+                'initial_done': True,
+                'next_main_pass': next_main_pass,
+                'main_pass_names': self.pass_names,
+                'test_case_hashes': snapshot.hash_test_cases([self.test_case]),
+                'pass_cache': {},
+            },
+        )
+
+    def test_round_trip(self):
+        self.write_snapshot(next_main_pass=1)
+        payload = snapshot.read(self.snapshot_path, [self.test_case], self.pass_names)
+        self.assertIsNotNone(payload)
+        self.assertEqual(payload['next_main_pass'], 1)
+        self.assertTrue(payload['initial_done'])
+
+    def test_missing_file(self):
+        self.assertIsNone(snapshot.read(self.snapshot_path, [self.test_case], self.pass_names))
+
+    def test_corrupt_file(self):
+        with open(self.snapshot_path, 'wb') as f:
+            f.write(b'not a snapshot')
+        self.assertIsNone(snapshot.read(self.snapshot_path, [self.test_case], self.pass_names))
+
+    def test_changed_test_case(self):
+        self.write_snapshot()
+        with open(self.test_case, 'w') as f:
+            f.write('int main(void) { return 1; }\n')
+        self.assertIsNone(snapshot.read(self.snapshot_path, [self.test_case], self.pass_names))
+
+    def test_changed_schedule(self):
+        self.write_snapshot()
+        self.assertIsNone(snapshot.read(self.snapshot_path, [self.test_case], ['LinesPass::0']))
+
+    def test_remove(self):
+        self.write_snapshot()
+        snapshot.remove(self.snapshot_path)
+        self.assertFalse(os.path.exists(self.snapshot_path))
+        # removing a missing snapshot is not an error
+        snapshot.remove(self.snapshot_path)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,7 +1,55 @@
 import os
+import shutil
+import sys
 import tempfile
 from contextlib import contextmanager
 
+try:
+    import fcntl
+except ImportError:
+    fcntl = None
+
+# linux/fs.h: _IOW(0x94, 9, int), identical on every supported architecture
+FICLONE = 0x40049409
+
+
+def clone_file(src, dst):
+    """Copy src to dst, sharing extents with src when the filesystem can.
+
+    On Linux the FICLONE ioctl turns the copy into a metadata-only
+    reflink on btrfs/XFS, which makes materializing a candidate in its
+    test folder O(1) instead of O(file size).  The clone is
+    copy-on-write, so writers through the new name can never touch the
+    source.  On other platforms, across filesystems, or on filesystems
+    without reflink support this degrades to a plain copy.
+
+    Like shutil.copy2, dst may be a directory and the metadata is
+    preserved; returns the destination path.
+    """
+    if os.path.isdir(dst):
+        dst = os.path.join(dst, os.path.basename(src))
+
+    if fcntl is not None and sys.platform.startswith('linux'):
+        try:
+            with open(src, 'rb') as fsrc, open(dst, 'wb') as fdst:
+                try:
+                    fcntl.ioctl(fdst.fileno(), FICLONE, fsrc.fileno())
+                except OSError:
+                    # no reflink support: copy through the descriptors we
+                    # already hold, so an existing dst keeps its inode and
+                    # recycled candidate folders never churn create/unlink
+                    shutil.copyfileobj(fsrc, fdst)
+            shutil.copystat(src, dst)
+            return dst
+        except OSError:
+            # never leave a truncated destination behind for the copy
+            try:
+                os.unlink(dst)
+            except OSError:
+                pass
+
+    return shutil.copy2(src, dst)
+
 
 def is_readable_file(filename):
     try:
@@ -0,0 +1,81 @@
+"""Thin wrapper around the native pipectl pipeline controller.
+
+pipectl runs two-stage jobs (generate a candidate, then test it) with a
+generator pool and a tester pool that stay busy at the same time, plus a
+bounded per-pass queue between them that makes a backlogged pass yield
+its generator slots to other passes.  The wrapper only speaks the line
+protocol; scheduling and process management stay in the native tool.
+"""
+
+import select
+import subprocess
+
+
+class PipelineEvent:
+    def __init__(self, kind, pass_name, job_id, status):
+        self.kind = kind  # 'done' or 'genfail'
+        self.pass_name = pass_name
+        self.job_id = job_id
+        self.status = status
+
+
+class PipelineController:
+    def __init__(self, binary, generators, testers, queue_bound=4):
+        self.proc = subprocess.Popen(
+            [str(binary), str(generators), str(testers), str(queue_bound)],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            text=True,
+            bufsize=1,
+        )
+
+    def _send(self, line):
+        self.proc.stdin.write(line + '\n')
+        self.proc.stdin.flush()
+
+    def submit(self, pass_name, job_id, gen_cmd, test_cmd):
+        """Queue one job; commands are shell command lines and must not
+        contain newlines.  The test command only runs if the generation
+        command exits 0."""
+        assert '\n' not in gen_cmd and '\n' not in test_cmd
+        self._send(f'job {pass_name} {job_id} :: {gen_cmd} :: {test_cmd}')
+
+    def flush(self, pass_name):
+        """Drop the pass's jobs that have not started yet; stages already
+        running still report when they finish."""
+        self._send(f'flush {pass_name}')
+
+    def poll_events(self, timeout=0.0):
+        """Return pipeline events that arrived within the timeout."""
+        events = []
+        while True:
+            ready, _, _ = select.select([self.proc.stdout], [], [], timeout)
+            if not ready:
+                return events
+            line = self.proc.stdout.readline()
+            if not line:
+                return events
+            event = self._parse(line.split())
+            if event is not None:
+                events.append(event)
+            timeout = 0.0
+
+    @staticmethod
+    def _parse(fields):
+        if len(fields) == 4 and fields[0] == 'DONE':
+            return PipelineEvent('done', fields[1], fields[2], int(fields[3]))
+        if len(fields) == 4 and fields[0] == 'GENFAIL':
+            return PipelineEvent('genfail', fields[1], fields[2], int(fields[3]))
+        return None
+
+    def close(self):
+        """Stop intake, collect the events from the drained backlog and
+        reap the controller."""
+        self.proc.stdin.close()
+        events = []
+        for line in self.proc.stdout:
+            event = self._parse(line.split())
+            if event is not None:
+                events.append(event)
+        self.proc.wait()
+        return events
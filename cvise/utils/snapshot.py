@@ -0,0 +1,83 @@
+"""Persist reduction progress so an interrupted run can resume warm.
+
+A snapshot captures the schedule position (which categories are done and
+which main pass runs next) together with the pass result cache, keyed to
+content hashes of the current test cases.  It is rewritten after every
+completed pass, so a preempted job loses at most one pass worth of work
+instead of re-running the whole schedule against the saved best files.
+
+The file is written via a temporary file in the same directory followed
+by os.replace, so readers never observe a half-written snapshot.
+"""
+
+import hashlib
+import logging
+import os
+import pickle
+import tempfile
+
+SNAPSHOT_VERSION = 1
+
+
+def hash_test_cases(test_cases):
+    """Map each test case path (as str) to the SHA-256 of its content."""
+    hashes = {}
+    for test_case in test_cases:
+        with open(test_case, 'rb') as f:
+            hashes[str(test_case)] = hashlib.sha256(f.read()).hexdigest()
+    return hashes
+
+
+def write(path, payload):
+    payload = dict(payload)
+    payload['version'] = SNAPSHOT_VERSION
+    snapshot_dir = os.path.dirname(os.path.abspath(path))
+    fd, tmp_path = tempfile.mkstemp(prefix='.cvise-snapshot-', dir=snapshot_dir)
+    try:
+        with os.fdopen(fd, 'wb') as f:
+            pickle.dump(payload, f)
+        os.replace(tmp_path, path)
+    except OSError as e:
+        logging.warning(f'Cannot write snapshot {path}: {e}')
+        try:
+            os.unlink(tmp_path)
+        except OSError:
+            pass
+
+
+def read(path, test_cases, main_pass_names):
+    """Load a snapshot and check it still describes this reduction.
+
+    Returns the payload dict, or None when the file is missing, damaged,
+    from a different C-Vise version, for a different pass schedule or for
+    test cases whose content has changed since the snapshot was taken.
+    """
+    try:
+        with open(path, 'rb') as f:
+            payload = pickle.load(f)
+    except FileNotFoundError:
+        return None
+    except (OSError, pickle.UnpicklingError, EOFError, AttributeError) as e:
+        logging.warning(f'Ignoring unreadable snapshot {path}: {e}')
+        return None
+
+    if payload.get('version') != SNAPSHOT_VERSION:
+        logging.warning(f'Ignoring snapshot {path} with unsupported version')
+        return None
+
+    if payload.get('main_pass_names') != main_pass_names:
+        logging.warning(f'Ignoring snapshot {path}: pass schedule has changed')
+        return None
+
+    if payload.get('test_case_hashes') != hash_test_cases(test_cases):
+        logging.warning(f'Ignoring snapshot {path}: test cases have changed')
+        return None
+
+    return payload
+
+
+def remove(path):
+    try:
+        os.unlink(path)
+    except OSError:
+        pass
@@ -1,6 +1,7 @@
 from concurrent.futures import FIRST_COMPLETED, wait
 import difflib
 import filecmp
+import hashlib
 import logging
 import math
 from multiprocessing import Manager
@@ -22,7 +23,7 @@ from cvise.utils.error import InvalidInterestingnessTestError
 from cvise.utils.error import InvalidTestCaseError
 from cvise.utils.error import PassBugError
 from cvise.utils.error import ZeroSizeError
-from cvise.utils.misc import is_readable_file
+from cvise.utils.misc import clone_file, is_readable_file
 from cvise.utils.readkey import KeyLogger
 import pebble
 import psutil
@@ -40,6 +41,114 @@ def rmfolder(name):
         pass
 
 
+class FolderPool:
+    """Pool of pre-warmed candidate test directories.
+
+    Creating and tearing down a directory tree per candidate is serial work
+    on the main process that a 100k-candidate reduction repeats 100k times.
+    The pool builds the static skeleton (the parent directories of every
+    test case) once per slot and recycles slots between candidates, so
+    per-candidate setup shrinks to cloning the candidate file into place.
+
+    Slots also recycle their files: a released slot keeps its test case
+    copies, and a per-slot manifest records the content hash each copy
+    holds.  materialize() then skips files the slot already has the right
+    bytes for (in a multi-file reduction every file but the one being
+    reduced) and rewrites the rest over the existing inode, so steady-state
+    candidate setup performs no create or unlink at all.
+    """
+
+    def __init__(self, root, skeleton_dirs, size):
+        self.root = Path(root)
+        self.skeleton_dirs = set(skeleton_dirs)
+        self.free = []
+        self.serial = 0
+        # per-slot manifest: relative path -> hash of the file's contents
+        self.manifests = {}
+        # hashes of source test cases, keyed by path and stat fingerprint
+        # so a source replaced by an accepted candidate is re-hashed
+        self.source_hashes = {}
+        for _ in range(size):
+            self.free.append(self._new_slot())
+
+    def _new_slot(self):
+        self.serial += 1
+        folder = self.root / f'slot-{self.serial}'
+        folder.mkdir()
+        for d in self.skeleton_dirs:
+            (folder / d).mkdir(parents=True, exist_ok=True)
+        return folder
+
+    def acquire(self):
+        if self.free:
+            folder = self.free.pop()
+        else:
+            folder = self._new_slot()
+        # rename the slot so a stale path held by an already-released future
+        # can never alias the environment of the next candidate
+        self.serial += 1
+        fresh = self.root / f'env-{self.serial}'
+        os.rename(folder, fresh)
+        self.manifests[fresh] = self.manifests.pop(folder, {})
+        return fresh
+
+    @staticmethod
+    def _hash_file(path):
+        h = hashlib.md5()
+        with open(path, 'rb') as f:
+            for chunk in iter(lambda: f.read(1 << 20), b''):
+                h.update(chunk)
+        return h.hexdigest()
+
+    def _source_hash(self, test_case):
+        st = test_case.stat()
+        key = (str(test_case), st.st_ino, st.st_size, st.st_mtime_ns)
+        if key not in self.source_hashes:
+            self.source_hashes[key] = self._hash_file(test_case)
+        return self.source_hashes[key]
+
+    def materialize(self, folder, test_cases):
+        """Bring the test case copies in folder up to date with the sources.
+
+        A copy whose manifest hash already matches the source is left
+        untouched; anything else is cloned over the file the slot kept, so
+        the inode is reused instead of re-created.
+        """
+        manifest = self.manifests.setdefault(folder, {})
+        for test_case in test_cases:
+            want = self._source_hash(test_case)
+            if manifest.get(str(test_case)) == want:
+                continue
+            (folder / test_case.parent).mkdir(parents=True, exist_ok=True)
+            clone_file(test_case, folder / test_case)
+            manifest[str(test_case)] = want
+
+    def release(self, folder):
+        folder = Path(folder)
+        # a timed-out environment may have been moved away by save_extra_dir
+        if not folder.exists():
+            self.manifests.pop(folder, None)
+            return
+        manifest = self.manifests.setdefault(folder, {})
+        for dirpath, _dirnames, filenames in os.walk(folder):
+            for name in filenames:
+                path = os.path.join(dirpath, name)
+                rel = os.path.relpath(path, folder)
+                if rel in manifest:
+                    # keep the file so its inode can be rewritten in place,
+                    # and re-hash it so the manifest keeps describing what
+                    # the slot actually holds (the transform rewrote one of
+                    # the copies)
+                    manifest[rel] = self._hash_file(path)
+                else:
+                    os.unlink(path)
+        # files moved away individually (e.g. by save_extra_dir for an
+        # --also-interesting candidate) must not stay in the manifest
+        for rel in [rel for rel in manifest if not (folder / rel).is_file()]:
+            del manifest[rel]
+        self.free.append(folder)
+
+
 class TestEnvironment:
     def __init__(
         self,
@@ -51,6 +160,7 @@ class TestEnvironment:
         all_test_cases,
         transform,
         pid_queue=None,
+        folder_pool=None,
     ):
         self.state = state
         self.folder = folder
@@ -66,10 +176,16 @@ class TestEnvironment:
         self.base_size = test_case.stat().st_size
         self.all_test_cases = all_test_cases
 
-        # Copy files to the created folder
-        for test_case in all_test_cases:
-            (self.folder / test_case.parent).mkdir(parents=True, exist_ok=True)
-            shutil.copy2(test_case, self.folder / test_case.parent)
+        # Copy files to the created folder; on reflink filesystems this
+        # is metadata-only, so candidate setup does not scale with the
+        # test case size.  A pooled folder goes through the pool's manifest
+        # instead, which skips copies the recycled slot already holds.
+        if folder_pool is not None:
+            folder_pool.materialize(self.folder, all_test_cases)
+        else:
+            for test_case in all_test_cases:
+                (self.folder / test_case.parent).mkdir(parents=True, exist_ok=True)
+                clone_file(test_case, self.folder / test_case.parent)
 
     @property
     def size_improvement(self):
@@ -195,9 +311,26 @@ class TestManager:
             == 0
         )
 
+        # decision journal: with CVISE_DECISION_JOURNAL naming a directory,
+        # every accept/reject verdict is appended to <dir>/decisions.log and
+        # every accepted state is snapshotted into a chunkstore under the
+        # same directory, so "cvise_tools replay" can re-materialize any
+        # intermediate state without re-running the reduction
+        self.decision_journal_dir = os.environ.get('CVISE_DECISION_JOURNAL')
+        self.decision_seq = 0
+        self.chunkstore_program = None
+        if self.decision_journal_dir:
+            os.makedirs(os.path.join(self.decision_journal_dir, 'manifests'), exist_ok=True)
+            self.chunkstore_program = shutil.which('chunkstore')
+            if not self.chunkstore_program:
+                logging.debug('chunkstore not found; decision journal will not snapshot accepted states')
+
     def create_root(self):
         pass_name = str(self.current_pass).replace('::', '-')
         self.root = tempfile.mkdtemp(prefix=f'{self.TEMP_PREFIX}{pass_name}-')
+        self.folder_pool = FolderPool(
+            self.root, (test_case.parent for test_case in self.test_cases), self.parallel_tests
+        )
         logging.debug(f'Creating pass root folder: {self.root}')
 
     def remove_root(self):
@@ -336,8 +469,10 @@ class TestManager:
 
     def release_folder(self, future):
         name = self.temporary_folders.pop(future)
+        # with --save-temps the folder is kept and the pool just grows a
+        # fresh slot on the next acquire
         if not self.save_temps:
-            rmfolder(name)
+            self.folder_pool.release(name)
 
     def release_folders(self):
         for future in self.futures:
@@ -419,6 +554,7 @@ class TestManager:
                             new_futures.add(future)
                 else:
                     self.pass_statistic.add_failure(self.current_pass)
+                    self.journal_decision('reject', test_env.state)
                     if test_env.result == PassResult.OK:
                         assert test_env.exitcode
                         if self.also_interesting is not None and test_env.exitcode == self.also_interesting:
@@ -474,7 +610,7 @@ class TestManager:
                     self.terminate_all(pool)
                     return success
 
-                folder = Path(tempfile.mkdtemp(prefix=self.TEMP_PREFIX, dir=self.root))
+                folder = self.folder_pool.acquire()
                 test_env = TestEnvironment(
                     self.state,
                     order,
@@ -484,6 +620,7 @@ class TestManager:
                     self.test_cases,
                     self.current_pass.transform,
                     self.pid_queue,
+                    self.folder_pool,
                 )
                 future = pool.schedule(test_env.run, timeout=self.timeout)
                 self.temporary_folders[future] = folder
@@ -602,6 +739,38 @@ class TestManager:
             self.remove_root()
             sys.exit(1)
 
+    @staticmethod
+    def hash_test_case(path):
+        with open(path, 'rb') as f:
+            return hashlib.sha256(f.read()).hexdigest()
+
+    def journal_decision(self, verdict, state, hash_before=None, hash_after=None):
+        if not self.decision_journal_dir:
+            return
+        self.decision_seq += 1
+        if verdict == 'accept' and self.chunkstore_program:
+            subprocess.run(
+                [
+                    self.chunkstore_program,
+                    'save',
+                    os.path.join(self.decision_journal_dir, 'store'),
+                    str(self.current_test_case),
+                    os.path.join(self.decision_journal_dir, 'manifests', str(self.decision_seq)),
+                ],
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+            )
+        fields = [
+            str(self.decision_seq),
+            verdict,
+            hash_before or '-',
+            hash_after or '-',
+            repr(self.current_pass),
+            str(state),
+        ]
+        with open(os.path.join(self.decision_journal_dir, 'decisions.log'), 'a') as journal:
+            journal.write('\t'.join(fields) + '\n')
+
     def process_result(self, test_env):
         if self.print_diff:
             diff_str = self.diff_files(self.current_test_case, test_env.test_case_path)
@@ -609,6 +778,8 @@ class TestManager:
                 diff_str = subprocess.check_output('colordiff', shell=True, encoding='utf8', input=diff_str)
             logging.info(diff_str)
 
+        hash_before = self.hash_test_case(self.current_test_case) if self.decision_journal_dir else None
+
         try:
             shutil.copy(test_env.test_case_path, self.current_test_case)
         except FileNotFoundError:
@@ -616,6 +787,11 @@ class TestManager:
                 f"Can't find {self.current_test_case} -- did your interestingness test move it?"
             ) from None
 
+        if self.decision_journal_dir:
+            self.journal_decision(
+                'accept', test_env.state, hash_before, self.hash_test_case(self.current_test_case)
+            )
+
         self.state = self.current_pass.advance_on_success(test_env.test_case_path, test_env.state)
         self.pass_statistic.add_success(self.current_pass)
 
@@ -0,0 +1,710 @@
+/* linesplice.cpp; see License.txt for copyright and terms of use
+ *
+ * line-removal engine for the early, huge-file stage of reduction.
+ *
+ * The flattened test case is mapped read-only once and a line-extent
+ * table is built (or loaded from a topformflat --index=FILE table), and
+ * the tool then serves requests over stdin:
+ *
+ *   count                 reply "OK <number of lines>"
+ *   rm <i> <j> <path>     write the file without lines i..j (0-based,
+ *                         inclusive) to <path>, reply "OK <bytes>"
+ *   rmf <manifest> <path> same, but removing every range listed in the
+ *                         manifest file ("<i> <j>" per line, any order,
+ *                         overlaps allowed), reply "OK <bytes>"
+ *   rmb <count>           followed by <count> lines "<i> <j> <path>":
+ *                         write all of those candidates before replying
+ *                         "OK <written> <failed>"; the file writes are
+ *                         batched over io_uring where available, so a
+ *                         burst of small late-stage candidates costs
+ *                         one submit instead of a syscall round each
+ *   seg <path>            write one "<first> <last>" line range per
+ *                         top-level segment (a flattened definition plus
+ *                         its body lines) to <path>, reply "OK <count>"
+ *   dup <path>            write one "<first> <last>" removable range per
+ *                         duplicate-run fold candidate (the repeats
+ *                         after the first instance of a consecutively
+ *                         repeated line block), largest saving first,
+ *                         reply "OK <count>"
+ *   chk <i> <j>           reply "OK 1" when removing lines i..j keeps
+ *                         the brace nesting balanced, "OK 0" otherwise
+ *   chkf <manifest>       same for the union of a manifest's ranges
+ *   stsave <chunk> <index> <path>
+ *                         persist a binary line-state record for the
+ *                         resident file (the CVLSTAT1 sidecar format
+ *                         also read and written by the Python driver's
+ *                         BinaryState), reply "OK"
+ *   stload <path>         validate such a record against the resident
+ *                         file; reply "OK <instances> <chunk> <index>",
+ *                         or "ERR stale state" when it was saved
+ *                         against different contents
+ *
+ * seg and chk need the nesting column of a topformflat --index table,
+ * so they answer "ERR no index" when the engine scanned the line
+ * extents itself.  Together they support partitioned reduction of huge
+ * inputs: the driver hands each worker one segment from seg, the worker
+ * probes line removals inside its segment gated only by the O(1) chk
+ * balance check, and the expensive global interestingness test runs
+ * just on merged checkpoints (an rmf manifest combining the per-segment
+ * survivors) instead of per probe.
+ *
+ * Each reply is one line on stdout; malformed or out-of-range requests
+ * get "ERR <reason>".  EOF on stdin ends the server.  Materializing a
+ * candidate is a handful of splices of the mapping, so the per-candidate
+ * cost is memcpy speed instead of a full text re-split in the driver.
+ *
+ * The engine is deliberately out-of-core for inputs larger than RAM:
+ * the source is mapped read-only, so the resident set is whatever
+ * window of pages the kernel chooses to keep, and on Linux the kept
+ * ranges are spliced to the output with copy_file_range, moving the
+ * bytes kernel-side without ever faulting the mapping in.  A manifest
+ * names a candidate by its removed extents alone, so the driver never
+ * needs the text in memory either. */
+
+#ifndef _MSC_VER
+#  ifndef _GNU_SOURCE
+#    define _GNU_SOURCE
+#  endif
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _MSC_VER
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include "uringw.h"
+
+struct LineExtent {
+  uint64_t start;
+  uint64_t len;
+};
+
+// matches the table written by topformflat --index=FILE
+struct IndexRecord {
+  uint64_t start;
+  uint64_t len;
+  uint32_t nesting;
+  uint32_t reserved;
+};
+
+static const char *data;
+static size_t dataSize;
+static std::vector<LineExtent> lines;
+// per line, the brace nesting depth after its last byte; filled only
+// when the extents come from an index table
+static std::vector<uint32_t> nestingEnd;
+static int dataFd = -1;   // kept open while mmap'd, for splicing
+
+static const char *loadFile(const char *path, size_t *sizeOut)
+{
+#ifndef _MSC_VER
+  int fd = open(path, O_RDONLY);
+  if (fd >= 0) {
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      // With CVISE_PREFAULT_SOURCE set, fault big files in up front and
+      // mark them huge-page friendly instead of taking a 4 KB fault per
+      // page while scanning; small inputs skip the extra syscall work.
+      bool prefault = static_cast<size_t>(st.st_size) >= (1u << 20) &&
+                      getenv("CVISE_PREFAULT_SOURCE");
+      int mmapFlags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+      if (prefault)
+        mmapFlags |= MAP_POPULATE;
+#endif
+      void *buf = mmap(NULL, st.st_size, PROT_READ, mmapFlags, fd, 0);
+      if (buf != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+        if (prefault)
+          madvise(buf, st.st_size, MADV_HUGEPAGE);
+#endif
+        dataFd = fd;
+        *sizeOut = st.st_size;
+        return static_cast<const char *>(buf);
+      }
+    }
+    close(fd);
+  }
+#endif
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  if (size < 0) {
+    fclose(f);
+    return NULL;
+  }
+  fseek(f, 0, SEEK_SET);
+  char *buf = static_cast<char *>(malloc(size ? size : 1));
+  if (!buf || fread(buf, 1, size, f) != static_cast<size_t>(size)) {
+    fclose(f);
+    return NULL;
+  }
+  fclose(f);
+  *sizeOut = size;
+  return buf;
+}
+
+static bool loadIndex(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  char magic[8];
+  uint64_t count;
+  if (fread(magic, 1, 8, f) != 8 ||
+      memcmp(magic, "TFFLIDX1", 8) != 0 ||
+      fread(&count, sizeof(count), 1, f) != 1) {
+    fclose(f);
+    return false;
+  }
+  std::vector<IndexRecord> records(count);
+  if (count &&
+      fread(&records[0], sizeof(IndexRecord), count, f) != count) {
+    fclose(f);
+    return false;
+  }
+  fclose(f);
+  uint64_t expected = 0;
+  lines.reserve(count);
+  for (uint64_t i = 0; i < count; i++) {
+    // a stale index is worse than no index
+    if (records[i].start != expected ||
+        records[i].start + records[i].len > dataSize) {
+      lines.clear();
+      nestingEnd.clear();
+      return false;
+    }
+    LineExtent extent = { records[i].start, records[i].len };
+    lines.push_back(extent);
+    nestingEnd.push_back(records[i].nesting);
+    expected = records[i].start + records[i].len;
+  }
+  if (expected != dataSize) {
+    lines.clear();
+    nestingEnd.clear();
+    return false;
+  }
+  return true;
+}
+
+static void scanLines(void)
+{
+  size_t start = 0;
+  while (start < dataSize) {
+    const char *nl = static_cast<const char *>(
+        memchr(data + start, '\n', dataSize - start));
+    size_t end = nl ? (nl - data) + 1 : dataSize;
+    LineExtent extent = { start, end - start };
+    lines.push_back(extent);
+    start = end;
+  }
+}
+
+static bool writeRange(FILE *f, size_t start, size_t len)
+{
+#if defined(__linux__) && !defined(_MSC_VER)
+  // splice big ranges kernel-side from the source file; the mapping is
+  // never faulted in, so candidates from a larger-than-RAM input stay
+  // cheap (small ranges are not worth the fflush round trip)
+  if (dataFd >= 0 && len >= (size_t)(1 << 16) && fflush(f) == 0) {
+    int outFd = fileno(f);
+    off_t off = static_cast<off_t>(start);
+    while (len > 0) {
+      ssize_t put = copy_file_range(dataFd, &off, outFd, NULL, len, 0);
+      if (put <= 0)
+        break;          // fall through to the copying path for the rest
+      start += static_cast<size_t>(put);
+      len -= static_cast<size_t>(put);
+    }
+  }
+#endif
+  return len == 0 || fwrite(data + start, 1, len, f) == len;
+}
+
+struct CutRange {
+  size_t i;
+  size_t j;   // inclusive, like the rm request
+};
+
+static bool cutRangeLess(const CutRange &a, const CutRange &b)
+{
+  return a.i < b.i;
+}
+
+// write the file without the listed line ranges; ranges may overlap and
+// arrive in any order
+static bool removeExtents(std::vector<CutRange> &cuts, const char *path,
+                          uint64_t *bytesOut)
+{
+  std::sort(cuts.begin(), cuts.end(), cutRangeLess);
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return false;
+  bool ok = true;
+  size_t pos = 0;          // next input byte not yet written or cut
+  uint64_t outBytes = 0;
+  for (size_t c = 0; c < cuts.size(); c++) {
+    size_t cutStart = lines[cuts[c].i].start;
+    size_t cutEnd = lines[cuts[c].j].start + lines[cuts[c].j].len;
+    if (cutStart > pos) {
+      ok = ok && writeRange(f, pos, cutStart - pos);
+      outBytes += cutStart - pos;
+    }
+    if (cutEnd > pos)
+      pos = cutEnd;
+  }
+  if (pos < dataSize) {
+    ok = ok && writeRange(f, pos, dataSize - pos);
+    outBytes += dataSize - pos;
+  }
+  if (fclose(f) != 0)
+    ok = false;
+  if (!ok) {
+    remove(path);
+    return false;
+  }
+  *bytesOut = outBytes;
+  return true;
+}
+
+static bool removeLines(size_t i, size_t j, const char *path,
+                        uint64_t *bytesOut)
+{
+  CutRange cut = { i, j };
+  std::vector<CutRange> cuts(1, cut);
+  return removeExtents(cuts, path, bytesOut);
+}
+
+// manifest file: one "<i> <j>" removed range per line
+static bool loadManifest(const char *path, std::vector<CutRange> *cuts)
+{
+  FILE *f = fopen(path, "r");
+  if (!f)
+    return false;
+  unsigned long i, j;
+  int got;
+  while ((got = fscanf(f, "%lu %lu", &i, &j)) == 2) {
+    if (i > j || j >= lines.size()) {
+      fclose(f);
+      return false;
+    }
+    CutRange cut = { i, j };
+    cuts->push_back(cut);
+  }
+  fclose(f);
+  return got == EOF;
+}
+
+// Top-level segments: a segment is a maximal run of lines ending at the
+// first line whose nesting returns to zero, i.e. one flattened
+// top-level definition together with its body lines.
+static bool writeSegments(const char *path, unsigned long *countOut)
+{
+  FILE *f = fopen(path, "w");
+  if (!f)
+    return false;
+  bool ok = true;
+  unsigned long count = 0;
+  size_t first = 0;
+  for (size_t i = 0; i < lines.size(); i++) {
+    if (nestingEnd[i] != 0)
+      continue;
+    if (fprintf(f, "%lu %lu\n", (unsigned long)first, (unsigned long)i) < 0)
+      ok = false;
+    count++;
+    first = i + 1;
+  }
+  if (first < lines.size()) {
+    // trailing lines that never close back to the top level (an
+    // unterminated definition); keep them addressable as a segment
+    if (fprintf(f, "%lu %lu\n", (unsigned long)first,
+                (unsigned long)(lines.size() - 1)) < 0)
+      ok = false;
+    count++;
+  }
+  if (fclose(f) != 0)
+    ok = false;
+  if (!ok) {
+    remove(path);
+    return false;
+  }
+  *countOut = count;
+  return true;
+}
+
+// 64-bit FNV-1a over a line's bytes; hashes only nominate an earlier
+// identical line, equality is always confirmed with memcmp
+static uint64_t hashLine(size_t i)
+{
+  uint64_t h = 1469598103934665603ull;
+  const char *p = data + lines[i].start;
+  for (size_t k = 0; k < lines[i].len; k++) {
+    h ^= static_cast<unsigned char>(p[k]);
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+static bool lineEq(size_t a, size_t b)
+{
+  return lines[a].len == lines[b].len &&
+         memcmp(data + lines[a].start, data + lines[b].start,
+                lines[a].len) == 0;
+}
+
+struct FoldRun {
+  size_t first;     // first removed line
+  size_t last;      // last removed line, inclusive
+  uint64_t bytes;   // bytes the fold removes
+};
+
+static bool foldBytesGreater(const FoldRun &a, const FoldRun &b)
+{
+  return a.bytes > b.bytes;
+}
+
+// Duplicate-run folding.  Preprocessed reproducers carry huge tandem
+// repeats (macro expansions, generated tables): a block of L lines
+// immediately followed by itself k-1 more times.  Generic line
+// bisection needs O(log n) tests per block to stumble into that
+// structure; one scan hands it over up front.  The hash table nominates
+// the previous identical line, giving a candidate period L, the run of
+// positions x with line x == line x+L is grown in both directions
+// (memcmp does the byte verification at full register width), and a run
+// of k >= 2 full repeats emits the candidate that removes repeats 2..k
+// while keeping the first block and any partial tail.
+static bool writeFoldCandidates(const char *path, unsigned long *countOut)
+{
+  size_t n = lines.size();
+  std::vector<uint64_t> hashes(n);
+  for (size_t i = 0; i < n; i++)
+    hashes[i] = hashLine(i);
+
+  std::vector<FoldRun> folds;
+  std::unordered_map<uint64_t, size_t> lastPos;
+  // per period, the last position known to sit inside an already-grown
+  // run, so a block of thousands of repeats is walked once instead of
+  // once per member line
+  std::map<size_t, size_t> covered;
+  for (size_t i = 0; i < n; i++) {
+    std::unordered_map<uint64_t, size_t>::iterator it =
+      lastPos.find(hashes[i]);
+    size_t prev = (it != lastPos.end()) ? it->second : i;
+    lastPos[hashes[i]] = i;
+    if (prev == i || !lineEq(prev, i))
+      continue;                // first sighting or a hash collision
+    size_t L = i - prev;
+    std::map<size_t, size_t>::iterator cv = covered.find(L);
+    if (cv != covered.end() && prev <= cv->second)
+      continue;
+    // maximal interval of positions matching their L-shifted line
+    size_t lo = prev;
+    while (lo > 0 && lineEq(lo - 1, lo - 1 + L))
+      lo--;
+    size_t hi = prev;
+    while (hi + L + 2 <= n && lineEq(hi + 1, hi + L + 1))
+      hi++;
+    covered[L] = hi;
+    size_t repeats = (hi + L - lo + 1) / L;
+    if (repeats < 2)
+      continue;
+    FoldRun run;
+    run.first = lo + L;
+    run.last = lo + repeats * L - 1;
+    run.bytes = lines[run.last].start + lines[run.last].len -
+                lines[run.first].start;
+    folds.push_back(run);
+  }
+
+  // each output line is directly usable as an rm request; biggest
+  // saving first so the driver can probe greedily
+  std::sort(folds.begin(), folds.end(), foldBytesGreater);
+  FILE *f = fopen(path, "w");
+  if (!f)
+    return false;
+  bool ok = true;
+  for (size_t c = 0; c < folds.size(); c++)
+    if (fprintf(f, "%lu %lu\n", (unsigned long)folds[c].first,
+                (unsigned long)folds[c].last) < 0)
+      ok = false;
+  if (fclose(f) != 0)
+    ok = false;
+  if (!ok) {
+    remove(path);
+    return false;
+  }
+  *countOut = (unsigned long)folds.size();
+  return true;
+}
+
+// Cheap local validity: removing lines i..j keeps the brace nesting
+// balanced iff the depth entering line i equals the depth leaving line
+// j.  Segment workers gate their probes on this O(1) check and leave
+// the global interestingness test to merged checkpoints.
+static bool cutBalanced(size_t i, size_t j)
+{
+  uint32_t before = (i == 0) ? 0 : nestingEnd[i - 1];
+  return before == nestingEnd[j];
+}
+
+static bool manifestBalanced(std::vector<CutRange> &cuts)
+{
+  std::sort(cuts.begin(), cuts.end(), cutRangeLess);
+  // judge the union: two individually balanced cuts can overlap or abut
+  // into an unbalanced splice, so merge before checking
+  size_t c = 0;
+  while (c < cuts.size()) {
+    size_t i = cuts[c].i;
+    size_t j = cuts[c].j;
+    while (c + 1 < cuts.size() && cuts[c + 1].i <= j + 1) {
+      if (cuts[c + 1].j > j)
+        j = cuts[c + 1].j;
+      c++;
+    }
+    if (!cutBalanced(i, j))
+      return false;
+    c++;
+  }
+  return true;
+}
+
+// Binary line-state sidecar, shared with the Python driver (BinaryState
+// in cvise/passes/abstract.py): an 8-byte magic, then the byte size of
+// the file the state was saved against, the line count, the chunk
+// (granularity) and the next index, all little-endian u64.  A record
+// only means anything for the exact contents it describes, so loading
+// validates the recorded size and line count before handing the cursor
+// back.
+struct LineState {
+  char magic[8];
+  uint64_t fileSize;
+  uint64_t instances;
+  uint64_t chunk;
+  uint64_t index;
+};
+
+static const char lineStateMagic[8] =
+  { 'C', 'V', 'L', 'S', 'T', 'A', 'T', '1' };
+
+static bool saveLineState(uint64_t chunk, uint64_t index, const char *path)
+{
+  LineState st;
+  memcpy(st.magic, lineStateMagic, sizeof(st.magic));
+  st.fileSize = dataSize;
+  st.instances = lines.size();
+  st.chunk = chunk;
+  st.index = index;
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return false;
+  bool ok = fwrite(&st, sizeof(st), 1, f) == 1;
+  if (fclose(f) != 0)
+    ok = false;
+  if (!ok)
+    remove(path);
+  return ok;
+}
+
+static bool loadLineState(const char *path, LineState *st)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  bool ok = fread(st, sizeof(*st), 1, f) == 1;
+  fclose(f);
+  return ok &&
+         memcmp(st->magic, lineStateMagic, sizeof(st->magic)) == 0 &&
+         st->fileSize == dataSize &&
+         st->instances == lines.size() &&
+         st->chunk >= 1 && st->chunk <= st->instances &&
+         st->index < st->instances;
+}
+
+// Batched removal.  A single-range candidate is the mapping minus one
+// line run, i.e. at most two kept extents, so a whole batch can be
+// queued as zero-copy gathered writes on one io_uring and submitted
+// together.  The gathered write faults the kept pages in, so this is
+// the small-candidate path; huge candidates keep going through rm and
+// its copy_file_range splicing.  Without a usable ring every entry
+// falls back to the regular removeLines path.
+static struct uringw *batchRing;
+static bool batchRingTried;
+
+static void serveRemoveBatch(unsigned long count)
+{
+  unsigned long failed = 0;
+  unsigned long done;
+
+  if (!batchRingTried) {
+    batchRing = uringw_open(64);
+    batchRingTried = true;
+  }
+
+  for (done = 0; done < count; done++) {
+    char req[4096];
+    char path[4000];
+    unsigned long i, j;
+    if (!fgets(req, sizeof(req), stdin)) {
+      failed += count - done;
+      break;
+    }
+    if (sscanf(req, "%lu %lu %3999s", &i, &j, path) != 3 ||
+        i > j || j >= lines.size()) {
+      failed++;
+      continue;
+    }
+    if (!batchRing) {
+      uint64_t bytes;
+      if (!removeLines(i, j, path, &bytes))
+        failed++;
+      continue;
+    }
+    size_t cutStart = lines[i].start;
+    size_t cutEnd = lines[j].start + lines[j].len;
+    struct uringw_span spans[2];
+    unsigned n = 0;
+    if (cutStart > 0) {
+      spans[n].base = data;
+      spans[n].len = cutStart;
+      n++;
+    }
+    if (cutEnd < dataSize) {
+      spans[n].base = data + cutEnd;
+      spans[n].len = dataSize - cutEnd;
+      n++;
+    }
+    if (n == 0) {
+      // everything removed; still create the empty candidate
+      spans[0].base = data;
+      spans[0].len = 0;
+      n = 1;
+    }
+    if (uringw_pending(batchRing) == uringw_capacity(batchRing))
+      failed += (unsigned long)uringw_flush(batchRing, NULL);
+    if (uringw_put(batchRing, path, spans, n) < 0)
+      failed++;
+  }
+  if (batchRing)
+    failed += (unsigned long)uringw_flush(batchRing, NULL);
+  printf("OK %lu %lu\n", count - (failed < count ? failed : count), failed);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "usage: %s <flattened-file> [<line-index>] "
+            "<requests >replies\n", argv[0]);
+    return 1;
+  }
+
+  data = loadFile(argv[1], &dataSize);
+  if (!data) {
+    fprintf(stderr, "cannot read file: %s\n", argv[1]);
+    return 1;
+  }
+  if (argc < 3 || !loadIndex(argv[2]))
+    scanLines();
+
+  char line[4096];
+  while (fgets(line, sizeof(line), stdin)) {
+    char path[4000];
+    char mpath[4000];
+    unsigned long i, j;
+    if (strncmp(line, "count", 5) == 0) {
+      printf("OK %lu\n", (unsigned long)lines.size());
+    }
+    else if (sscanf(line, "rmf %3999s %3999s", mpath, path) == 2) {
+      std::vector<CutRange> cuts;
+      uint64_t bytes;
+      if (!loadManifest(mpath, &cuts))
+        printf("ERR bad manifest\n");
+      else if (removeExtents(cuts, path, &bytes))
+        printf("OK %llu\n", (unsigned long long)bytes);
+      else
+        printf("ERR cannot write candidate\n");
+    }
+    else if (sscanf(line, "rmb %lu", &i) == 1) {
+      serveRemoveBatch(i);
+    }
+    else if (sscanf(line, "seg %3999s", path) == 1) {
+      unsigned long count;
+      if (nestingEnd.empty())
+        printf("ERR no index\n");
+      else if (writeSegments(path, &count))
+        printf("OK %lu\n", count);
+      else
+        printf("ERR cannot write segments\n");
+    }
+    else if (sscanf(line, "dup %3999s", path) == 1) {
+      unsigned long count;
+      if (writeFoldCandidates(path, &count))
+        printf("OK %lu\n", count);
+      else
+        printf("ERR cannot write candidates\n");
+    }
+    else if (sscanf(line, "chkf %3999s", mpath) == 1) {
+      std::vector<CutRange> cuts;
+      if (nestingEnd.empty())
+        printf("ERR no index\n");
+      else if (!loadManifest(mpath, &cuts))
+        printf("ERR bad manifest\n");
+      else
+        printf("OK %d\n", manifestBalanced(cuts) ? 1 : 0);
+    }
+    else if (sscanf(line, "chk %lu %lu", &i, &j) == 2) {
+      if (nestingEnd.empty())
+        printf("ERR no index\n");
+      else if (i > j || j >= lines.size())
+        printf("ERR bad line range\n");
+      else
+        printf("OK %d\n", cutBalanced(i, j) ? 1 : 0);
+    }
+    else if (sscanf(line, "stsave %lu %lu %3999s", &i, &j, path) == 3) {
+      if (i < 1 || i > lines.size() || j >= lines.size())
+        printf("ERR bad state\n");
+      else if (saveLineState(i, j, path))
+        printf("OK\n");
+      else
+        printf("ERR cannot write state\n");
+    }
+    else if (sscanf(line, "stload %3999s", path) == 1) {
+      LineState st;
+      if (loadLineState(path, &st))
+        printf("OK %llu %llu %llu\n", (unsigned long long)st.instances,
+               (unsigned long long)st.chunk, (unsigned long long)st.index);
+      else
+        printf("ERR stale state\n");
+    }
+    else if (sscanf(line, "rm %lu %lu %3999s", &i, &j, path) == 3) {
+      if (i > j || j >= lines.size()) {
+        printf("ERR bad line range\n");
+      }
+      else {
+        uint64_t bytes;
+        if (removeLines(i, j, path, &bytes))
+          printf("OK %llu\n", (unsigned long long)bytes);
+        else
+          printf("ERR cannot write candidate\n");
+      }
+    }
+    else {
+      printf("ERR bad request\n");
+    }
+    fflush(stdout);
+  }
+  return 0;
+}
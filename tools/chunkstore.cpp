@@ -0,0 +1,390 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/*
+ * chunkstore: content-defined-chunking dedup store for intermediate files.
+ *
+ *   chunkstore save <store-dir> <file> <manifest>
+ *   chunkstore restore <store-dir> <manifest> <file>
+ *
+ * A reduction writes thousands of intermediate files that are nearly
+ * identical to each other.  "save" splits a file into variable-sized
+ * chunks at content-defined boundaries (a Gear rolling hash, ~8 KiB
+ * average), stores each chunk under its content hash in
+ * <store-dir>/objects/ -- once, no matter how many versions contain
+ * it -- and writes a small text manifest listing the chunks in order.
+ * "restore" rebuilds any saved version by concatenating the chunks its
+ * manifest names.  Because an edit only perturbs the chunks it touches,
+ * a history of candidates costs little more than one copy of the file
+ * plus the diffs, and snapshot/resume is a manifest copy.
+ *
+ * Chunks and manifests land via a temporary plus rename, so concurrent
+ * workers can share one store; two writers racing on the same chunk
+ * both produce identical bytes.  Chunk identity is the FNV-1a hash of
+ * the content together with the chunk length, which also names the
+ * object file.
+ *
+ * When built against libzstd, objects are stored zstd-compressed
+ * (CVISE_STORE_COMPRESS=0 opts out).  The format is self-describing --
+ * an object whose stored size differs from the length in its name is a
+ * zstd frame -- so compressed and raw objects mix freely in one store
+ * and stores written by either build restore under the other (a
+ * zstd-less build only refuses compressed objects).
+ */
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#ifndef _MSC_VER
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#ifdef HAVE_ZSTD
+#  include <zstd.h>
+#endif
+
+// chunking parameters: cut where the rolling hash has MaskBits low zero
+// bits, giving ~8 KiB chunks, clamped so neither degenerate runs nor
+// boundary-free data produce extreme sizes
+static const size_t MinChunk = 2048;
+static const size_t MaxChunk = 65536;
+static const uint64_t BoundaryMask = (1 << 13) - 1;
+
+// Gear table: one pseudo-random word per byte value, generated from a
+// fixed seed (splitmix64) so chunk boundaries are stable across runs
+// and machines -- a store written yesterday still dedups against today.
+static uint64_t GearTable[256];
+
+static void initGearTable(void)
+{
+  uint64_t State = 0x9492fd4b5d2e68cbull;
+  for (int I = 0; I < 256; I++) {
+    State += 0x9e3779b97f4a7c15ull;
+    uint64_t Z = State;
+    Z = (Z ^ (Z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    Z = (Z ^ (Z >> 27)) * 0x94d049bb133111ebull;
+    GearTable[I] = Z ^ (Z >> 31);
+  }
+}
+
+// length of the next chunk starting at Data[0]
+static size_t nextChunkLen(const unsigned char *Data, size_t Len)
+{
+  if (Len <= MinChunk)
+    return Len;
+  size_t Limit = Len < MaxChunk ? Len : MaxChunk;
+  uint64_t H = 0;
+  for (size_t I = MinChunk; I < Limit; I++) {
+    H = (H << 1) + GearTable[Data[I]];
+    if ((H & BoundaryMask) == 0)
+      return I + 1;
+  }
+  return Limit;
+}
+
+// same FNV-1a as the other helpers
+static uint64_t hashBytes(const unsigned char *Data, size_t Len)
+{
+  uint64_t H = 1469598103934665603ull;
+  for (size_t I = 0; I < Len; I++) {
+    H ^= Data[I];
+    H *= 1099511628211ull;
+  }
+  return H;
+}
+
+// object name: content hash plus length, which is also the dedup key
+static std::string chunkName(const unsigned char *Data, size_t Len)
+{
+  char Buf[64];
+  snprintf(Buf, sizeof(Buf), "%016llx-%lu",
+           (unsigned long long)hashBytes(Data, Len), (unsigned long)Len);
+  return Buf;
+}
+
+static std::string objectPath(const std::string &StoreDir,
+                              const std::string &Name)
+{
+  // fan out on the leading hash byte to keep directories small
+  return StoreDir + "/objects/" + Name.substr(0, 2) + "/" + Name;
+}
+
+static bool readWholeFile(const std::string &Path,
+                          std::vector<unsigned char> &Data)
+{
+  FILE *F = fopen(Path.c_str(), "rb");
+  if (!F)
+    return false;
+  unsigned char Buf[1 << 16];
+  size_t Got;
+  while ((Got = fread(Buf, 1, sizeof(Buf), F)) > 0)
+    Data.insert(Data.end(), Buf, Buf + Got);
+  bool OK = !ferror(F);
+  fclose(F);
+  return OK;
+}
+
+// write via a temporary plus rename, so readers and racing writers only
+// ever see whole files
+static bool writeFileAtomic(const std::string &Path,
+                            const unsigned char *Data, size_t Len)
+{
+  std::string TmpPath = Path + ".tmp." + std::to_string((long)getpid());
+  FILE *F = fopen(TmpPath.c_str(), "wb");
+  if (!F)
+    return false;
+  bool OK = (Len == 0) || (fwrite(Data, 1, Len, F) == Len);
+  if (fclose(F) != 0)
+    OK = false;
+  if (!OK || rename(TmpPath.c_str(), Path.c_str()) != 0) {
+    unlink(TmpPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+static bool ensureDir(const std::string &Path)
+{
+  return (mkdir(Path.c_str(), 0777) == 0) || (errno == EEXIST);
+}
+
+// Write one object, zstd-compressed when that is available, enabled and
+// actually smaller.  A compressed object is recognized on read purely
+// by its stored size differing from the uncompressed length in its
+// name, so no wrapper format is needed.
+static bool writeObject(const std::string &Path, const unsigned char *Data,
+                        size_t Len)
+{
+#ifdef HAVE_ZSTD
+  static int Compress = -1;
+  if (Compress < 0) {
+    const char *Env = getenv("CVISE_STORE_COMPRESS");
+    Compress = !(Env && strcmp(Env, "0") == 0);
+  }
+  if (Compress && Len > 0) {
+    // low level: the point is trading idle CPU for scratch-volume I/O,
+    // not squeezing the last percent
+    std::vector<unsigned char> Out(ZSTD_compressBound(Len));
+    size_t Got = ZSTD_compress(&Out[0], Out.size(), Data, Len, 3);
+    if (!ZSTD_isError(Got) && Got < Len)
+      return writeFileAtomic(Path, &Out[0], Got);
+  }
+#endif
+  return writeFileAtomic(Path, Data, Len);
+}
+
+// read one object back to its uncompressed Len bytes
+static bool readObject(const std::string &Path, size_t Len,
+                       std::vector<unsigned char> &Data)
+{
+  std::vector<unsigned char> Raw;
+  if (!readWholeFile(Path, Raw))
+    return false;
+  if (Raw.size() == Len) {
+    Data.swap(Raw);
+    return true;
+  }
+#ifdef HAVE_ZSTD
+  Data.resize(Len);
+  size_t Got = ZSTD_decompress(Len ? &Data[0] : NULL, Len,
+                               Raw.empty() ? NULL : &Raw[0], Raw.size());
+  return !ZSTD_isError(Got) && Got == Len;
+#else
+  fprintf(stderr, "compressed object %s, but built without zstd\n",
+          Path.c_str());
+  return false;
+#endif
+}
+
+// one fixed-size record in the shared perf ledger named by
+// CVISE_PERF_LEDGER; the layout is owned by "cvise_tools stats"
+static void ledgerAppend(const char *Phase, uint64_t DurationUs,
+                         uint64_t BytesIn, uint64_t BytesOut, uint32_t Err)
+{
+  const char *Path = getenv("CVISE_PERF_LEDGER");
+  if (!Path)
+    return;
+  struct {
+    char tool[8];
+    char phase[16];
+    uint64_t duration_us;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint32_t error_code;
+    uint32_t reserved;
+  } Rec;
+  memset(&Rec, 0, sizeof(Rec));
+  memcpy(Rec.tool, "chunkst", sizeof("chunkst") - 1);
+  strncpy(Rec.phase, Phase, sizeof(Rec.phase) - 1);
+  Rec.duration_us = DurationUs;
+  Rec.bytes_in = BytesIn;
+  Rec.bytes_out = BytesOut;
+  Rec.error_code = Err;
+  int Fd = open(Path, O_WRONLY | O_CREAT | O_APPEND, 0666);
+  if (Fd < 0)
+    return;
+  ssize_t W = write(Fd, &Rec, sizeof(Rec));
+  (void)W;
+  close(Fd);
+}
+
+static uint64_t nowUs(void)
+{
+  struct timeval Tv;
+  gettimeofday(&Tv, NULL);
+  return (uint64_t)Tv.tv_sec * 1000000 + Tv.tv_usec;
+}
+
+// bytes_out in the ledger is the new object bytes actually written, so
+// "saved/sec" in the stats table reflects the dedup hit rate
+static int doSave(const std::string &StoreDir, const std::string &InPath,
+                  const std::string &ManifestPath)
+{
+  std::vector<unsigned char> Data;
+  if (!readWholeFile(InPath, Data)) {
+    fprintf(stderr, "cannot read %s\n", InPath.c_str());
+    return 1;
+  }
+
+  if (!ensureDir(StoreDir) || !ensureDir(StoreDir + "/objects")) {
+    fprintf(stderr, "cannot create store at %s\n", StoreDir.c_str());
+    return 1;
+  }
+
+  uint64_t Start = nowUs();
+  uint64_t NewBytes = 0;
+  std::string Manifest = "chunkstore 1 " + std::to_string(Data.size()) + "\n";
+
+  size_t Off = 0;
+  while (Off < Data.size()) {
+    size_t Len = nextChunkLen(&Data[Off], Data.size() - Off);
+    std::string Name = chunkName(&Data[Off], Len);
+    std::string Path = objectPath(StoreDir, Name);
+
+    // the name already carries content hash and length, so an existing
+    // object is the same chunk; write only what the store has never seen
+    struct stat St;
+    if (stat(Path.c_str(), &St) != 0) {
+      if (!ensureDir(StoreDir + "/objects/" + Name.substr(0, 2)) ||
+          !writeObject(Path, &Data[Off], Len)) {
+        fprintf(stderr, "cannot store chunk %s\n", Name.c_str());
+        return 1;
+      }
+      NewBytes += Len;
+    }
+    Manifest += Name;
+    Manifest += "\n";
+    Off += Len;
+  }
+
+  if (!writeFileAtomic(ManifestPath,
+                       (const unsigned char *)Manifest.data(),
+                       Manifest.size())) {
+    fprintf(stderr, "cannot write manifest %s\n", ManifestPath.c_str());
+    return 1;
+  }
+
+  ledgerAppend("save", nowUs() - Start, Data.size(), NewBytes, 0);
+  return 0;
+}
+
+static int doRestore(const std::string &StoreDir,
+                     const std::string &ManifestPath,
+                     const std::string &OutPath)
+{
+  FILE *F = fopen(ManifestPath.c_str(), "r");
+  if (!F) {
+    fprintf(stderr, "cannot read manifest %s\n", ManifestPath.c_str());
+    return 1;
+  }
+
+  uint64_t Start = nowUs();
+  char Line[128];
+  unsigned long ExpectedSize = 0;
+  if (!fgets(Line, sizeof(Line), F) ||
+      sscanf(Line, "chunkstore 1 %lu", &ExpectedSize) != 1) {
+    fprintf(stderr, "bad manifest %s\n", ManifestPath.c_str());
+    fclose(F);
+    return 1;
+  }
+
+  std::vector<unsigned char> Data;
+  Data.reserve(ExpectedSize);
+  while (fgets(Line, sizeof(Line), F)) {
+    Line[strcspn(Line, "\n")] = 0;
+    if (!Line[0])
+      continue;
+    const char *Dash = strrchr(Line, '-');
+    if (!Dash) {
+      fprintf(stderr, "bad chunk name %s\n", Line);
+      fclose(F);
+      return 1;
+    }
+    size_t ChunkLen = (size_t)strtoul(Dash + 1, NULL, 10);
+    std::vector<unsigned char> Chunk;
+    if (!readObject(objectPath(StoreDir, Line), ChunkLen, Chunk)) {
+      fprintf(stderr, "missing or corrupt chunk %s\n", Line);
+      fclose(F);
+      return 1;
+    }
+    Data.insert(Data.end(), Chunk.begin(), Chunk.end());
+  }
+  fclose(F);
+
+  if (Data.size() != ExpectedSize) {
+    fprintf(stderr, "manifest %s expects %lu bytes, chunks give %lu\n",
+            ManifestPath.c_str(), ExpectedSize, (unsigned long)Data.size());
+    return 1;
+  }
+
+  if (!writeFileAtomic(OutPath, Data.empty() ? NULL : &Data[0],
+                       Data.size())) {
+    fprintf(stderr, "cannot write %s\n", OutPath.c_str());
+    return 1;
+  }
+
+  ledgerAppend("restore", nowUs() - Start, 0, Data.size(), 0);
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  initGearTable();
+
+  if (argc == 5 && strcmp(argv[1], "save") == 0)
+    return doSave(argv[2], argv[3], argv[4]);
+  if (argc == 5 && strcmp(argv[1], "restore") == 0)
+    return doRestore(argv[2], argv[3], argv[4]);
+
+  fprintf(stderr,
+          "usage: %s save <store-dir> <file> <manifest>\n"
+          "       %s restore <store-dir> <manifest> <file>\n",
+          argv[0], argv[0]);
+  return 1;
+}
+
+#else // _MSC_VER
+
+#include <cstdio>
+
+int main()
+{
+  fprintf(stderr, "chunkstore is not supported on this platform\n");
+  return 1;
+}
+
+#endif
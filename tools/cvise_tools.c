@@ -0,0 +1,1666 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/*
+ * cvise_tools: multi-call front end for the helper binaries.
+ *
+ *   cvise_tools <tool> [args...]   dispatch to the sibling binary
+ *                                  (clex, strlex, topformflat, linesplice,
+ *                                  squeezeblank, chunkstore, ppdirindex),
+ *                                  also reachable busybox-style by
+ *                                  symlinking a tool name to cvise_tools
+ *   cvise_tools --serve            persistent helper multiplexing all of
+ *                                  them over one stdin/stdout protocol
+ *
+ * The serve protocol takes one request per line:
+ *
+ *   open <tool> <file>            start a persistent server child
+ *                                 (clex/strlex server mode, linesplice)
+ *                                 for <file>; reply "OK <handle>"
+ *   req <handle> <request...>     forward the request line to the child
+ *                                 and relay its reply (framed
+ *                                 "<status> <length>" plus payload for
+ *                                 clex/strlex, a single line for
+ *                                 linesplice)
+ *   close <handle>                stop the child; reply "OK"
+ *   run <infile> <tool> [args...] one-shot run with stdin from <infile>
+ *                                 ("-" for /dev/null); reply
+ *                                 "<exit status> <length>" plus output
+ *
+ * Malformed requests get "ERR <reason>"; EOF ends the server.  The
+ * Python driver keeps exactly one cvise_tools --serve child per worker,
+ * so the per-candidate fork/exec/dynamic-link cost of the short-lived
+ * helpers is paid once per file instead of once per probe.
+ *
+ * "cvise_tools agent <store-dir>" is the execution half of a distributed
+ * reduction: one agent runs per remote node (the driver starts it over
+ * ssh, which supplies transport and authentication -- the agent itself
+ * never opens a socket) and serves one request per line on stdin:
+ *
+ *   have <hash>                   "OK 0" or "OK 1": whether the blob is
+ *                                 already in this node's store, so the
+ *                                 driver only ships missing content
+ *   put <hash> <length>           followed by <length> raw bytes; store
+ *                                 them content-addressed; reply "OK"
+ *   get <hash>                    reply "OK <length>" plus the bytes
+ *   probe <hash> <tool> [args...] run a helper tool with the blob on
+ *                                 stdin ("{}" arguments are replaced by
+ *                                 the blob's store path); reply
+ *                                 "<exit> <out-hash> <length>" plus the
+ *                                 captured output, which is stored too
+ *   test <hash> <name> :: <cmd>   materialize the blob as <name> in a
+ *                                 fresh directory and run <cmd> there
+ *                                 with /bin/sh; reply "<exit>"
+ *
+ * Blobs are keyed by their FNV-1a hash and probe/test replies are
+ * memoized under the hash of the request line, so repeated probes of
+ * identical content -- stragglers, duplicated scheduling, retried
+ * nodes -- answer straight from the store without running anything.
+ *
+ * "cvise_tools checkpoint" is a write-behind service for accepted
+ * results: the driver otherwise copies every accepted candidate over
+ * the current best file and the user's output path synchronously, and
+ * during the productive early phase of a big reduction those copies
+ * gate the probe loop.  One request per line on stdin:
+ *
+ *   save <src> <dest>             reply "OK" at once and copy <src> to
+ *                                 <dest> in the background (write to a
+ *                                 temporary, fsync, rename, fsync the
+ *                                 directory -- a crash never leaves a
+ *                                 torn checkpoint); "DONE <dest> <code>"
+ *                                 follows when the copy is durable
+ *   sync                          reply "SYNCED" once every accepted
+ *                                 save has completed
+ *
+ * Saves are double-buffered per destination: while one write is in
+ * flight, the newest queued source replaces any older queued one, so a
+ * burst of acceptances costs at most two copies per destination and the
+ * file on disk is always some complete accepted state.  EOF drains the
+ * queue before exit.
+ *
+ * "cvise_tools init <file> <tmp-dir> [<workers>]" is the cold-start
+ * warmup.  On a fresh node the first minutes of a reduction go into
+ * building, lazily and on the critical path, state that every later
+ * probe needs; all of it is independent work, so init does it up front
+ * in parallel:
+ *
+ *   - faults the test case into the page cache
+ *   - lexes it once and saves the <file>.tok token sidecar
+ *     (clex --save-tokens)
+ *   - flattens it once and saves the <file>.tffidx line-index table
+ *     for the line passes (topformflat --index)
+ *   - parses it once into <tmp-dir>/ast-cache, priming the entry that
+ *     clang_delta probes of the unchanged input deserialize
+ *     (clang_delta --ast-cache)
+ *   - lays out <tmp-dir>: the ast-cache and per-worker subdirectories
+ *     are created before any worker races to, and the replies report
+ *     whether the directory is on tmpfs and supports O_TMPFILE so the
+ *     driver can pick its temp-file strategy once
+ *
+ * Replies are "tmpfs 0|1", "o_tmpfile 0|1", "workers <n>" for the
+ * layout, then one "OK <task>" or "ERR <task>" per warmup task; the
+ * exit status is the number of failures.  <workers> defaults to the
+ * number of online CPUs.
+ *
+ * "cvise_tools replay <journal-dir> <seq>|last <out-file>" re-creates an
+ * accepted intermediate state from a decision journal.  With
+ * CVISE_DECISION_JOURNAL naming a directory, the driver appends one
+ * record per accept/reject verdict to <journal-dir>/decisions.log
+ * (sequence, verdict, content hashes, pass, state) and snapshots every
+ * accepted state into a chunkstore under the same directory.  Replay
+ * looks the requested sequence number up, refuses anything but an
+ * accepted record, and restores its snapshot -- no interestingness
+ * runs, no parses -- so bisecting a scheduling decision takes seconds
+ * where a live re-reduction takes hours.
+ *
+ * "cvise_tools stats <ledger>" aggregates a performance ledger into a
+ * per-(tool, phase) cost/benefit table.  The ledger is the file named by
+ * the CVISE_PERF_LEDGER environment variable; when it is set, clang_delta,
+ * clex/strlex and topformflat append one fixed 56-byte record per
+ * invocation (a single O_APPEND write, so concurrent workers never tear
+ * a record):
+ *
+ *   char     tool[8];        NUL-padded tool name
+ *   char     phase[16];      NUL-padded transformation/mode name
+ *   uint64_t duration_us;    wall time
+ *   uint64_t bytes_in;       input size (0 = unknown)
+ *   uint64_t bytes_out;      output size (0 = unknown)
+ *   uint32_t error_code;     process exit code
+ *   uint32_t reserved;
+ *
+ * "cvise_tools estimate <ledger>" projects the cost of phases before
+ * they run: it reads "<tool> <phase> <instances>" requests from stdin
+ * (the instance count comes from the driver's census) and scales the
+ * ledger's per-run averages into predicted wasted probes, generation
+ * seconds and bytes removed per phase, so a scheduler under a CI
+ * deadline can spend its remaining budget on the highest-yield phases.
+ *
+ * "cvise_tools synthesize-group <ledger> <group.json>" closes the loop
+ * from measurement back into scheduling: it scores every entry of the
+ * given pass-group file against the ledger (bytes saved per second of
+ * generation time, the same ratio stats prints) and writes the group to
+ * stdout with its "main" section reordered best-first.  Ledgers from
+ * many reductions can simply be concatenated -- the records are
+ * self-contained -- so the input can be a whole fleet's history.  The
+ * "first" and "last" sections are structural (cheap big-win openers,
+ * final cleanup) and pass through untouched, entry objects are echoed
+ * verbatim so flags like "c" and "max-transforms" survive, and entries
+ * with no history keep their hand-written relative order after the
+ * measured ones: no data means unknown, not worthless.
+ */
+
+#if HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _MSC_VER
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#  include <sys/vfs.h>
+#endif
+
+static const char *const known_tools[] = {
+  "clex", "strlex", "topformflat", "linesplice", "squeezeblank",
+  "chunkstore", "ppdirindex", NULL
+};
+
+// tools that can hold one input file open and serve requests over stdin
+static const char *const server_tools[] = {
+  "clex", "strlex", "linesplice", NULL
+};
+
+static char exe_dir[PATH_MAX];
+
+static int is_in(const char *const list[], const char *name)
+{
+  int i;
+  for (i = 0; list[i]; i++)
+    if (strcmp(list[i], name) == 0)
+      return 1;
+  return 0;
+}
+
+static void find_exe_dir(const char *argv0)
+{
+  ssize_t n = readlink("/proc/self/exe", exe_dir, sizeof(exe_dir) - 1);
+  if (n < 0) {
+    n = (ssize_t)strlen(argv0);
+    if (n >= (ssize_t)sizeof(exe_dir))
+      n = sizeof(exe_dir) - 1;
+    memcpy(exe_dir, argv0, n);
+  }
+  exe_dir[n] = 0;
+  char *slash = strrchr(exe_dir, '/');
+  if (slash)
+    *slash = 0;
+  else
+    strcpy(exe_dir, ".");
+}
+
+// sibling binary next to cvise_tools, falling back to PATH lookup; a
+// sibling path too long for the buffer falls back as well
+static void tool_path(char *buf, size_t cap, const char *tool)
+{
+  int n = snprintf(buf, cap, "%s/%s", exe_dir, tool);
+  if (n < 0 || (size_t)n >= cap || access(buf, X_OK) != 0) {
+    n = snprintf(buf, cap, "%s", tool);
+    if (n < 0 || (size_t)n >= cap)
+      buf[0] = 0;
+  }
+}
+
+struct server_handle {
+  pid_t pid;
+  FILE *to;
+  FILE *from;
+  int framed;   // framed "<status> <length>" replies (clex/strlex)
+};
+
+#define MAX_HANDLES 64
+static struct server_handle handles[MAX_HANDLES];
+
+static int do_open(const char *tool, const char *file)
+{
+  int h;
+  for (h = 0; h < MAX_HANDLES; h++)
+    if (handles[h].pid == 0)
+      break;
+  if (h == MAX_HANDLES)
+    return -1;
+
+  int to_child[2];
+  int from_child[2];
+  if (pipe(to_child) < 0)
+    return -1;
+  if (pipe(from_child) < 0) {
+    close(to_child[0]);
+    close(to_child[1]);
+    return -1;
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    close(to_child[0]);
+    close(to_child[1]);
+    close(from_child[0]);
+    close(from_child[1]);
+    return -1;
+  }
+  if (pid == 0) {
+    dup2(to_child[0], 0);
+    dup2(from_child[1], 1);
+    close(to_child[0]);
+    close(to_child[1]);
+    close(from_child[0]);
+    close(from_child[1]);
+    char path[PATH_MAX];
+    tool_path(path, sizeof(path), tool);
+    if (strcmp(tool, "linesplice") == 0)
+      execlp(path, tool, file, (char *)NULL);
+    else
+      execlp(path, tool, "server", "0", file, (char *)NULL);
+    _exit(127);
+  }
+  close(to_child[0]);
+  close(from_child[1]);
+  // keep our pipe ends out of later children, or a closed handle never
+  // delivers EOF to its child
+  fcntl(to_child[1], F_SETFD, FD_CLOEXEC);
+  fcntl(from_child[0], F_SETFD, FD_CLOEXEC);
+  handles[h].pid = pid;
+  handles[h].to = fdopen(to_child[1], "w");
+  handles[h].from = fdopen(from_child[0], "r");
+  handles[h].framed = (strcmp(tool, "linesplice") != 0);
+  if (!handles[h].to || !handles[h].from) {
+    kill(pid, SIGKILL);
+    waitpid(pid, NULL, 0);
+    if (handles[h].to)
+      fclose(handles[h].to);
+    if (handles[h].from)
+      fclose(handles[h].from);
+    memset(&handles[h], 0, sizeof(handles[h]));
+    return -1;
+  }
+  return h;
+}
+
+static void do_close(int h)
+{
+  fclose(handles[h].to);
+  fclose(handles[h].from);
+  waitpid(handles[h].pid, NULL, 0);
+  memset(&handles[h], 0, sizeof(handles[h]));
+}
+
+// forward one request line and relay the child's reply verbatim
+static int relay_request(int h, const char *request)
+{
+  struct server_handle *s = &handles[h];
+  if (fprintf(s->to, "%s\n", request) < 0 || fflush(s->to) != 0)
+    return -1;
+
+  char header[1024];
+  if (!fgets(header, sizeof(header), s->from))
+    return -1;
+  fputs(header, stdout);
+  if (!s->framed)
+    return 0;
+
+  int status;
+  unsigned long len;
+  if (sscanf(header, "%d %lu", &status, &len) != 2)
+    return -1;
+  char buf[65536];
+  while (len > 0) {
+    size_t want = len < sizeof(buf) ? len : sizeof(buf);
+    size_t got = fread(buf, 1, want, s->from);
+    if (got == 0)
+      return -1;
+    fwrite(buf, 1, got, stdout);
+    len -= got;
+  }
+  return 0;
+}
+
+static void do_run(const char *infile, char **argv)
+{
+  int out[2];
+  if (pipe(out) < 0) {
+    printf("ERR cannot run\n");
+    return;
+  }
+  pid_t pid = fork();
+  if (pid < 0) {
+    close(out[0]);
+    close(out[1]);
+    printf("ERR cannot run\n");
+    return;
+  }
+  if (pid == 0) {
+    const char *in = strcmp(infile, "-") == 0 ? "/dev/null" : infile;
+    int fd = open(in, O_RDONLY);
+    if (fd < 0)
+      _exit(127);
+    dup2(fd, 0);
+    close(fd);
+    dup2(out[1], 1);
+    close(out[0]);
+    close(out[1]);
+    char path[PATH_MAX];
+    tool_path(path, sizeof(path), argv[0]);
+    execvp(path, argv);
+    _exit(127);
+  }
+  close(out[1]);
+
+  size_t cap = 65536;
+  size_t len = 0;
+  char *buf = malloc(cap);
+  if (!buf)
+    abort();
+  for (;;) {
+    if (len == cap) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+      if (!buf)
+        abort();
+    }
+    ssize_t got = read(out[0], buf + len, cap - len);
+    if (got <= 0)
+      break;
+    len += got;
+  }
+  close(out[0]);
+  int status;
+  waitpid(pid, &status, 0);
+  int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+  printf("%d %lu\n", code, (unsigned long)len);
+  fwrite(buf, 1, len, stdout);
+  free(buf);
+}
+
+struct perf_rec {
+  char tool[8];
+  char phase[16];
+  uint64_t duration_us;
+  uint64_t bytes_in;
+  uint64_t bytes_out;
+  uint32_t error_code;
+  uint32_t reserved;
+};
+
+struct perf_agg {
+  char tool[8];
+  char phase[16];
+  unsigned long runs;
+  unsigned long errors;
+  uint64_t duration_us;
+  uint64_t bytes_in;
+  uint64_t bytes_saved;
+};
+
+#define MAX_AGGS 512
+
+// read the ledger into one aggregate slot per (tool, phase); returns
+// (size_t)-1 when the ledger cannot be opened
+static size_t load_aggs(const char *path, struct perf_agg *aggs, size_t cap)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return (size_t)-1;
+  size_t n_aggs = 0;
+  struct perf_rec rec;
+  while (fread(&rec, sizeof(rec), 1, f) == 1) {
+    // NUL-terminate defensively; the writers pad with NULs
+    rec.tool[sizeof(rec.tool) - 1] = 0;
+    rec.phase[sizeof(rec.phase) - 1] = 0;
+    size_t i;
+    for (i = 0; i < n_aggs; i++)
+      if (strcmp(aggs[i].tool, rec.tool) == 0 &&
+          strcmp(aggs[i].phase, rec.phase) == 0)
+        break;
+    if (i == n_aggs) {
+      if (n_aggs == cap)
+        continue;
+      memset(&aggs[i], 0, sizeof(aggs[i]));
+      memcpy(aggs[i].tool, rec.tool, sizeof(rec.tool));
+      memcpy(aggs[i].phase, rec.phase, sizeof(rec.phase));
+      n_aggs++;
+    }
+    aggs[i].runs++;
+    aggs[i].duration_us += rec.duration_us;
+    aggs[i].bytes_in += rec.bytes_in;
+    if (rec.error_code != 0)
+      aggs[i].errors++;
+    else if (rec.bytes_out > 0 && rec.bytes_out < rec.bytes_in)
+      aggs[i].bytes_saved += rec.bytes_in - rec.bytes_out;
+  }
+  fclose(f);
+  return n_aggs;
+}
+
+// aggregate the ledger into one row per (tool, phase): how much time the
+// phase cost and how many bytes its successful runs actually removed, so
+// pass scheduling can be tuned against measured yield instead of guesses
+static int do_stats(const char *path)
+{
+  static struct perf_agg aggs[MAX_AGGS];
+  size_t n_aggs = load_aggs(path, aggs, MAX_AGGS);
+  if (n_aggs == (size_t)-1) {
+    fprintf(stderr, "cannot open ledger: %s\n", path);
+    return 1;
+  }
+
+  printf("%-8s %-16s %8s %6s %10s %14s %12s\n",
+         "tool", "phase", "runs", "errs", "seconds", "bytes_saved",
+         "saved/sec");
+  size_t i;
+  for (i = 0; i < n_aggs; i++) {
+    double secs = aggs[i].duration_us / 1e6;
+    printf("%-8s %-16s %8lu %6lu %10.2f %14llu %12.0f\n",
+           aggs[i].tool, aggs[i].phase, aggs[i].runs, aggs[i].errors, secs,
+           (unsigned long long)aggs[i].bytes_saved,
+           secs > 0.0 ? aggs[i].bytes_saved / secs : 0.0);
+  }
+  return 0;
+}
+
+// project a phase's cost before it runs: given its upcoming instance
+// count, scale the ledger's per-run averages.  One request per stdin
+// line ("<tool> <phase> <instances>", the count coming from the driver's
+// census); the reply row carries the predicted wasted probes
+// (instances x historical failure rate), the predicted generation time
+// and the predicted bytes removed, so a scheduler under a deadline can
+// spend what budget remains on the highest-yield phases.  Phases with
+// no history predict zeros with "none" in the history column; the
+// scheduler should treat them as unknowns, not as free
+static int do_estimate(const char *path)
+{
+  static struct perf_agg aggs[MAX_AGGS];
+  size_t n_aggs = load_aggs(path, aggs, MAX_AGGS);
+  if (n_aggs == (size_t)-1) {
+    fprintf(stderr, "cannot open ledger: %s\n", path);
+    return 1;
+  }
+
+  printf("%-8s %-16s %10s %8s %10s %11s %12s\n",
+         "tool", "phase", "instances", "history", "est_failed",
+         "est_seconds", "est_bytes");
+  char tool[64], phase[64];
+  unsigned long instances;
+  while (scanf("%63s %63s %lu", tool, phase, &instances) == 3) {
+    size_t i;
+    for (i = 0; i < n_aggs; i++)
+      if (strcmp(aggs[i].tool, tool) == 0 &&
+          strcmp(aggs[i].phase, phase) == 0)
+        break;
+    if (i == n_aggs || aggs[i].runs == 0) {
+      printf("%-8s %-16s %10lu %8s %10u %11.2f %12u\n",
+             tool, phase, instances, "none", 0u, 0.0, 0u);
+      continue;
+    }
+    double fail_rate = (double)aggs[i].errors / aggs[i].runs;
+    double avg_secs = aggs[i].duration_us / 1e6 / aggs[i].runs;
+    double avg_saved = (double)aggs[i].bytes_saved / aggs[i].runs;
+    printf("%-8s %-16s %10lu %8lu %10.0f %11.2f %12.0f\n",
+           tool, phase, instances, aggs[i].runs,
+           instances * fail_rate, instances * avg_secs,
+           instances * avg_saved);
+  }
+  return 0;
+}
+
+static char *agent_load_blob(const char *path, size_t *len_out);
+
+// pull the string value of "key" out of a one-entry JSON object;
+// returns 0 when the key is absent or not a string
+static int group_entry_string(const char *obj, const char *key,
+                              char *out, size_t cap)
+{
+  char quoted[80];
+  snprintf(quoted, sizeof(quoted), "\"%s\"", key);
+  const char *p = strstr(obj, quoted);
+  if (!p)
+    return 0;
+  p = strchr(p + strlen(quoted), ':');
+  if (!p)
+    return 0;
+  p++;
+  while (*p == ' ' || *p == '\t')
+    p++;
+  if (*p != '"')
+    return 0;
+  p++;
+  size_t n = 0;
+  while (p[n] && p[n] != '"' && n + 1 < cap)
+    n++;
+  if (p[n] != '"')
+    return 0;
+  memcpy(out, p, n);
+  out[n] = 0;
+  return 1;
+}
+
+// a pass-group entry's measured yield: bytes saved per second of
+// generation time, from the ledger rows the entry's pass maps to;
+// negative when the ledger holds no history for it
+static double group_entry_score(const struct perf_agg *aggs, size_t n_aggs,
+                                const char *obj)
+{
+  char pass[64], arg[64];
+  const char *tool = NULL;
+  if (!group_entry_string(obj, "pass", pass, sizeof(pass)))
+    return -1.0;
+  if (!group_entry_string(obj, "arg", arg, sizeof(arg)))
+    arg[0] = 0;
+  if (strcmp(pass, "clang") == 0 || strcmp(pass, "clangbinarysearch") == 0)
+    tool = "clang_delta";
+  else if (strcmp(pass, "clex") == 0 || strcmp(pass, "strlex") == 0)
+    tool = pass;
+  if (!tool || !arg[0])
+    return -1.0;
+  // ledger fields are NUL-padded at 7/15 characters; compare truncated
+  size_t i;
+  for (i = 0; i < n_aggs; i++)
+    if (strncmp(aggs[i].tool, tool, sizeof(aggs[i].tool) - 1) == 0 &&
+        strncmp(aggs[i].phase, arg, sizeof(aggs[i].phase) - 1) == 0)
+      break;
+  if (i == n_aggs || aggs[i].runs == 0 || aggs[i].duration_us == 0)
+    return -1.0;
+  return aggs[i].bytes_saved / (aggs[i].duration_us / 1e6);
+}
+
+struct group_entry {
+  const char *start;    /* entry object in the loaded group file */
+  size_t len;
+  double score;
+  size_t order;         /* hand-written position, the tie-breaker */
+};
+
+static int group_entry_cmp(const void *va, const void *vb)
+{
+  const struct group_entry *a = va, *b = vb;
+  if (a->score > b->score)
+    return -1;
+  if (a->score < b->score)
+    return 1;
+  // keep equal (and unmeasured) entries in their hand-written order;
+  // qsort alone is not stable
+  return (a->order < b->order) ? -1 : 1;
+}
+
+// locate the [...] array of the named section; returns pointers past
+// the '[' and at the matching ']'
+static int group_find_array(const char *buf, const char *name,
+                            const char **beg, const char **end)
+{
+  char quoted[32];
+  snprintf(quoted, sizeof(quoted), "\"%s\"", name);
+  const char *p = strstr(buf, quoted);
+  if (!p || !(p = strchr(p, '[')))
+    return 0;
+  *beg = ++p;
+  int depth = 1;
+  for (; *p; p++) {
+    if (*p == '[')
+      depth++;
+    else if (*p == ']' && --depth == 0) {
+      *end = p;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+#define MAX_GROUP_ENTRIES 512
+
+// slice an array body into its {...} entry objects
+static size_t group_split_entries(const char *beg, const char *end,
+                                  struct group_entry *entries, size_t cap)
+{
+  size_t n = 0;
+  const char *p = beg;
+  while (p < end && n < cap) {
+    while (p < end && *p != '{')
+      p++;
+    if (p == end)
+      break;
+    const char *obj = p;
+    int depth = 0;
+    do {
+      if (*p == '{')
+        depth++;
+      else if (*p == '}')
+        depth--;
+      p++;
+    } while (p < end && depth > 0);
+    if (depth != 0)
+      break;
+    entries[n].start = obj;
+    entries[n].len = (size_t)(p - obj);
+    entries[n].order = n;
+    entries[n].score = 0.0;
+    n++;
+  }
+  return n;
+}
+
+static void group_emit_array(const char *name,
+                             const struct group_entry *entries, size_t n,
+                             int last_section)
+{
+  printf("%s\"%s\": [\n", name[0] == 'f' ? "{" : " ", name);
+  size_t i;
+  for (i = 0; i < n; i++)
+    printf("    %.*s%s\n", (int)entries[i].len, entries[i].start,
+           (i + 1 < n) ? "," : "");
+  printf(" ]%s\n", last_section ? "" : ",");
+}
+
+static int do_synthesize_group(const char *ledger, const char *group)
+{
+  static struct perf_agg aggs[MAX_AGGS];
+  size_t n_aggs = load_aggs(ledger, aggs, MAX_AGGS);
+  if (n_aggs == (size_t)-1) {
+    fprintf(stderr, "cannot open ledger: %s\n", ledger);
+    return 1;
+  }
+
+  size_t len;
+  char *buf = agent_load_blob(group, &len);
+  if (!buf) {
+    fprintf(stderr, "cannot read pass group: %s\n", group);
+    return 1;
+  }
+  buf[len] = 0;
+
+  static const char *const sections[] = { "first", "main", "last" };
+  static struct group_entry entries[3][MAX_GROUP_ENTRIES];
+  size_t counts[3];
+  int s;
+  for (s = 0; s < 3; s++) {
+    const char *beg, *end;
+    if (!group_find_array(buf, sections[s], &beg, &end)) {
+      fprintf(stderr, "pass group has no \"%s\" section: %s\n",
+              sections[s], group);
+      free(buf);
+      return 1;
+    }
+    counts[s] = group_split_entries(beg, end, entries[s],
+                                    MAX_GROUP_ENTRIES);
+  }
+
+  // only "main" is reordered; "first" and "last" are structural
+  size_t i;
+  for (i = 0; i < counts[1]; i++) {
+    char obj[512];
+    snprintf(obj, sizeof(obj), "%.*s", (int)entries[1][i].len,
+             entries[1][i].start);
+    entries[1][i].score = group_entry_score(aggs, n_aggs, obj);
+  }
+  qsort(entries[1], counts[1], sizeof(entries[1][0]), group_entry_cmp);
+
+  for (s = 0; s < 3; s++)
+    group_emit_array(sections[s], entries[s], counts[s], s == 2);
+  printf("}\n");
+  free(buf);
+  return 0;
+}
+
+static uint64_t agent_hash(const char *buf, size_t len)
+{
+  // FNV-1a, the same function the other tools key caches with
+  uint64_t h = 1469598103934665603ull;
+  size_t i;
+  for (i = 0; i < len; i++) {
+    h ^= (unsigned char)buf[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+// leaves headroom for the store-relative suffixes appended below
+static char agent_store[PATH_MAX - 512];
+
+// Non-zero on a malformed hash or an over-long path; the hash token
+// comes straight off the request line, so anything but a fixed-width
+// hex digest is rejected before it can name a file.
+static int agent_obj_path(char *buf, size_t cap, const char *hash)
+{
+  size_t len = strspn(hash, "0123456789abcdef");
+  if (len != 16 || hash[len] != 0)
+    return -1;
+  int n = snprintf(buf, cap, "%s/objects/%.16s", agent_store, hash);
+  return (n < 0 || (size_t)n >= cap) ? -1 : 0;
+}
+
+static void agent_result_path(char *buf, size_t cap, const char *line)
+{
+  snprintf(buf, cap, "%s/results/%016llx", agent_store,
+           (unsigned long long)agent_hash(line, strlen(line)));
+}
+
+// write a blob atomically: a killed agent never leaves a torn object
+// that a later "have" would wrongly report as synced
+static int agent_store_blob(const char *path, const char *buf, size_t len)
+{
+  char tmp[PATH_MAX];
+  snprintf(tmp, sizeof(tmp), "%s.tmp.%d", path, (int)getpid());
+  FILE *f = fopen(tmp, "wb");
+  if (!f)
+    return -1;
+  int ok = (len == 0 || fwrite(buf, 1, len, f) == len);
+  if (fclose(f) != 0)
+    ok = 0;
+  if (!ok || rename(tmp, path) != 0) {
+    remove(tmp);
+    return -1;
+  }
+  return 0;
+}
+
+static char *agent_load_blob(const char *path, size_t *len_out)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  if (size < 0) {
+    fclose(f);
+    return NULL;
+  }
+  fseek(f, 0, SEEK_SET);
+  char *buf = malloc((size_t)size + 1);
+  if (!buf)
+    abort();
+  if (fread(buf, 1, (size_t)size, f) != (size_t)size) {
+    fclose(f);
+    free(buf);
+    return NULL;
+  }
+  fclose(f);
+  *len_out = (size_t)size;
+  return buf;
+}
+
+// replay a memoized reply verbatim; returns 0 when there is none
+static int agent_replay(const char *line)
+{
+  char path[PATH_MAX];
+  agent_result_path(path, sizeof(path), line);
+  size_t len;
+  char *buf = agent_load_blob(path, &len);
+  if (!buf)
+    return 0;
+  fwrite(buf, 1, len, stdout);
+  free(buf);
+  return 1;
+}
+
+static void agent_memoize(const char *line, const char *reply, size_t len)
+{
+  char path[PATH_MAX];
+  agent_result_path(path, sizeof(path), line);
+  agent_store_blob(path, reply, len);
+}
+
+static void agent_put(const char *hash, unsigned long length)
+{
+  char *buf = malloc(length ? length : 1);
+  if (!buf)
+    abort();
+  if (fread(buf, 1, length, stdin) != length) {
+    free(buf);
+    printf("ERR short put payload\n");
+    return;
+  }
+  char computed[32];
+  snprintf(computed, sizeof(computed), "%016llx",
+           (unsigned long long)agent_hash(buf, length));
+  if (strcmp(computed, hash) != 0) {
+    free(buf);
+    printf("ERR content hash mismatch\n");
+    return;
+  }
+  char path[PATH_MAX];
+  if (agent_obj_path(path, sizeof(path), hash) != 0) {
+    free(buf);
+    printf("ERR bad hash\n");
+    return;
+  }
+  if (agent_store_blob(path, buf, length) != 0)
+    printf("ERR cannot store blob\n");
+  else
+    printf("OK\n");
+  free(buf);
+}
+
+// run one helper tool against a stored blob, capture its output, store
+// the output as a blob of its own and emit the framed reply
+static void agent_probe(const char *line, const char *hash, char **argv)
+{
+  char in_path[PATH_MAX];
+  if (agent_obj_path(in_path, sizeof(in_path), hash) != 0 ||
+      access(in_path, R_OK) != 0) {
+    printf("ERR unknown blob\n");
+    return;
+  }
+  // "{}" arguments name the input blob, for tools that take the file as
+  // an operand rather than on stdin (clex, topformflat)
+  int i;
+  for (i = 0; argv[i]; i++)
+    if (strcmp(argv[i], "{}") == 0)
+      argv[i] = in_path;
+
+  int out[2];
+  if (pipe(out) < 0) {
+    printf("ERR cannot run\n");
+    return;
+  }
+  pid_t pid = fork();
+  if (pid < 0) {
+    close(out[0]);
+    close(out[1]);
+    printf("ERR cannot run\n");
+    return;
+  }
+  if (pid == 0) {
+    int fd = open(in_path, O_RDONLY);
+    if (fd < 0)
+      _exit(127);
+    dup2(fd, 0);
+    close(fd);
+    dup2(out[1], 1);
+    close(out[0]);
+    close(out[1]);
+    char path[PATH_MAX];
+    tool_path(path, sizeof(path), argv[0]);
+    execvp(path, argv);
+    _exit(127);
+  }
+  close(out[1]);
+
+  size_t cap = 65536;
+  size_t len = 0;
+  char *buf = malloc(cap);
+  if (!buf)
+    abort();
+  for (;;) {
+    if (len == cap) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+      if (!buf)
+        abort();
+    }
+    ssize_t got = read(out[0], buf + len, cap - len);
+    if (got <= 0)
+      break;
+    len += got;
+  }
+  close(out[0]);
+  int status;
+  waitpid(pid, &status, 0);
+  int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+
+  char out_hash[32];
+  snprintf(out_hash, sizeof(out_hash), "%016llx",
+           (unsigned long long)agent_hash(buf, len));
+  char out_path[PATH_MAX];
+  if (agent_obj_path(out_path, sizeof(out_path), out_hash) == 0)
+    agent_store_blob(out_path, buf, len);
+
+  char header[128];
+  int hlen = snprintf(header, sizeof(header), "%d %s %lu\n", code, out_hash,
+                      (unsigned long)len);
+  // memoize header and payload as one reply so a duplicate probe is a
+  // single sendfile-sized read
+  char *reply = malloc((size_t)hlen + len);
+  if (!reply)
+    abort();
+  memcpy(reply, header, (size_t)hlen);
+  memcpy(reply + hlen, buf, len);
+  agent_memoize(line, reply, (size_t)hlen + len);
+  fwrite(reply, 1, (size_t)hlen + len, stdout);
+  free(reply);
+  free(buf);
+}
+
+// run the user's interestingness command against a materialized
+// candidate in a scratch directory of its own
+static void agent_test(const char *line, const char *hash, const char *name,
+                       const char *cmd)
+{
+  char in_path[PATH_MAX];
+  size_t len;
+  char *buf = NULL;
+  if (agent_obj_path(in_path, sizeof(in_path), hash) == 0)
+    buf = agent_load_blob(in_path, &len);
+  if (!buf) {
+    printf("ERR unknown blob\n");
+    return;
+  }
+
+  char dir[PATH_MAX - 300];
+  snprintf(dir, sizeof(dir), "%s/test.XXXXXX", agent_store);
+  if (!mkdtemp(dir)) {
+    free(buf);
+    printf("ERR cannot create test dir\n");
+    return;
+  }
+  char cand[PATH_MAX];
+  snprintf(cand, sizeof(cand), "%s/%s", dir, name);
+  int stored = agent_store_blob(cand, buf, len);
+  free(buf);
+  if (stored != 0) {
+    rmdir(dir);
+    printf("ERR cannot materialize candidate\n");
+    return;
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    remove(cand);
+    rmdir(dir);
+    printf("ERR cannot run\n");
+    return;
+  }
+  if (pid == 0) {
+    if (chdir(dir) != 0)
+      _exit(127);
+    execl("/bin/sh", "sh", "-c", cmd, (char *)NULL);
+    _exit(127);
+  }
+  int status;
+  waitpid(pid, &status, 0);
+  int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+
+  // best-effort scratch cleanup; tests that left subdirectories behind
+  // keep their directory rather than costing a recursive walk here
+  DIR *d = opendir(dir);
+  if (d) {
+    struct dirent *ent;
+    while ((ent = readdir(d))) {
+      char victim[PATH_MAX];
+      snprintf(victim, sizeof(victim), "%s/%s", dir, ent->d_name);
+      remove(victim);
+    }
+    closedir(d);
+  }
+  rmdir(dir);
+
+  char reply[32];
+  int rlen = snprintf(reply, sizeof(reply), "%d\n", code);
+  agent_memoize(line, reply, (size_t)rlen);
+  fwrite(reply, 1, (size_t)rlen, stdout);
+}
+
+static int agent(const char *store)
+{
+  snprintf(agent_store, sizeof(agent_store), "%s", store);
+  char sub[PATH_MAX];
+  if (mkdir(agent_store, 0777) != 0 && errno != EEXIST) {
+    fprintf(stderr, "cannot create store: %s\n", agent_store);
+    return 1;
+  }
+  snprintf(sub, sizeof(sub), "%s/objects", agent_store);
+  if (mkdir(sub, 0777) != 0 && errno != EEXIST) {
+    fprintf(stderr, "cannot create store: %s\n", sub);
+    return 1;
+  }
+  snprintf(sub, sizeof(sub), "%s/results", agent_store);
+  if (mkdir(sub, 0777) != 0 && errno != EEXIST) {
+    fprintf(stderr, "cannot create store: %s\n", sub);
+    return 1;
+  }
+
+  char line[8192];
+  while (fgets(line, sizeof(line), stdin)) {
+    line[strcspn(line, "\n")] = 0;
+
+    if (strncmp(line, "have ", 5) == 0) {
+      char path[PATH_MAX];
+      printf("OK %d\n", agent_obj_path(path, sizeof(path), line + 5) == 0 &&
+                        access(path, R_OK) == 0);
+    }
+    else if (strncmp(line, "put ", 4) == 0) {
+      char hash[64];
+      unsigned long length;
+      if (sscanf(line + 4, "%63s %lu", hash, &length) != 2)
+        printf("ERR bad put request\n");
+      else
+        agent_put(hash, length);
+    }
+    else if (strncmp(line, "get ", 4) == 0) {
+      char path[PATH_MAX];
+      size_t len;
+      char *buf = NULL;
+      if (agent_obj_path(path, sizeof(path), line + 4) == 0)
+        buf = agent_load_blob(path, &len);
+      if (!buf) {
+        printf("ERR unknown blob\n");
+      } else {
+        printf("OK %lu\n", (unsigned long)len);
+        fwrite(buf, 1, len, stdout);
+        free(buf);
+      }
+    }
+    else if (strncmp(line, "probe ", 6) == 0) {
+      if (agent_replay(line)) {
+        fflush(stdout);
+        continue;
+      }
+      // the request line doubles as the memoization key, so keep an
+      // unmangled copy: strtok_r writes NULs into its argument
+      char scratch[8192];
+      snprintf(scratch, sizeof(scratch), "%s", line + 6);
+      char *argv[64];
+      int argc = 0;
+      char *save = NULL;
+      char *hash = strtok_r(scratch, " ", &save);
+      char *tok = hash;
+      while (tok && argc < 63) {
+        tok = strtok_r(NULL, " ", &save);
+        if (tok)
+          argv[argc++] = tok;
+      }
+      argv[argc] = NULL;
+      if (!hash || argc < 1 || !is_in(known_tools, argv[0]))
+        printf("ERR bad probe request\n");
+      else
+        agent_probe(line, hash, argv);
+    }
+    else if (strncmp(line, "test ", 5) == 0) {
+      if (agent_replay(line)) {
+        fflush(stdout);
+        continue;
+      }
+      char hash[64];
+      char name[256];
+      int consumed = 0;
+      if (sscanf(line + 5, "%63s %255s :: %n", hash, name, &consumed) != 2 ||
+          consumed == 0 || strchr(name, '/'))
+        printf("ERR bad test request\n");
+      else
+        agent_test(line, hash, name, line + 5 + consumed);
+    }
+    else {
+      printf("ERR bad request\n");
+    }
+    fflush(stdout);
+  }
+  return 0;
+}
+
+static void serve(void)
+{
+  char line[8192];
+  while (fgets(line, sizeof(line), stdin)) {
+    line[strcspn(line, "\n")] = 0;
+
+    if (strncmp(line, "open ", 5) == 0) {
+      char tool[64];
+      char file[4096];
+      if (sscanf(line + 5, "%63s %4095s", tool, file) != 2 ||
+          !is_in(server_tools, tool)) {
+        printf("ERR bad open request\n");
+      } else {
+        int h = do_open(tool, file);
+        if (h < 0)
+          printf("ERR cannot start %s\n", tool);
+        else
+          printf("OK %d\n", h);
+      }
+    }
+    else if (strncmp(line, "req ", 4) == 0) {
+      int h;
+      int consumed;
+      if (sscanf(line + 4, "%d %n", &h, &consumed) != 1 ||
+          h < 0 || h >= MAX_HANDLES || handles[h].pid == 0) {
+        printf("ERR bad handle\n");
+      } else if (relay_request(h, line + 4 + consumed) != 0) {
+        // the child is gone or out of sync; drop it
+        do_close(h);
+        printf("ERR server request failed\n");
+      }
+    }
+    else if (strncmp(line, "close ", 6) == 0) {
+      int h;
+      if (sscanf(line + 6, "%d", &h) != 1 ||
+          h < 0 || h >= MAX_HANDLES || handles[h].pid == 0) {
+        printf("ERR bad handle\n");
+      } else {
+        do_close(h);
+        printf("OK\n");
+      }
+    }
+    else if (strncmp(line, "run ", 4) == 0) {
+      char *argv[64];
+      int argc = 0;
+      char *save = NULL;
+      char *tok = strtok_r(line + 4, " ", &save);
+      char *infile = tok;
+      while (tok && argc < 63) {
+        tok = strtok_r(NULL, " ", &save);
+        if (tok)
+          argv[argc++] = tok;
+      }
+      argv[argc] = NULL;
+      if (!infile || argc < 1 || !is_in(known_tools, argv[0]))
+        printf("ERR bad run request\n");
+      else
+        do_run(infile, argv);
+    }
+    else {
+      printf("ERR bad request\n");
+    }
+    fflush(stdout);
+  }
+
+  int h;
+  for (h = 0; h < MAX_HANDLES; h++)
+    if (handles[h].pid != 0)
+      do_close(h);
+}
+
+#define MAX_CKPT 64
+
+// One destination the service is checkpointing to: the writer child in
+// flight (0 = idle) and the newest source queued behind it.  A slot is
+// free when it is idle with nothing queued.
+struct ckpt_slot {
+  char dest[PATH_MAX - 64];
+  char pending_src[PATH_MAX - 64];
+  pid_t pid;
+};
+
+static struct ckpt_slot ckpt_slots[MAX_CKPT];
+
+// The writer child's whole job: copy src over dest so that dest always
+// holds either its old content or the complete new one, durably.
+static int ckpt_copy(const char *src, const char *dest)
+{
+  int in = open(src, O_RDONLY);
+  if (in < 0)
+    return 1;
+  char tmp[PATH_MAX];
+  snprintf(tmp, sizeof(tmp), "%s.ckpt.%d", dest, (int)getpid());
+  int out = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (out < 0) {
+    close(in);
+    return 1;
+  }
+  char buf[65536];
+  ssize_t got;
+  while ((got = read(in, buf, sizeof(buf))) > 0) {
+    ssize_t off = 0;
+    while (off < got) {
+      ssize_t put = write(out, buf + off, got - off);
+      if (put < 0) {
+        close(in);
+        close(out);
+        remove(tmp);
+        return 1;
+      }
+      off += put;
+    }
+  }
+  close(in);
+  // the fsync is the point of being off the critical path: the driver
+  // already moved on while we wait for the disk
+  int bad = (got < 0) || fsync(out);
+  close(out);
+  if (bad || rename(tmp, dest)) {
+    remove(tmp);
+    return 1;
+  }
+  // make the rename itself durable too
+  char dir[PATH_MAX];
+  snprintf(dir, sizeof(dir), "%s", dest);
+  char *slash = strrchr(dir, '/');
+  if (slash)
+    *slash = 0;
+  else
+    snprintf(dir, sizeof(dir), ".");
+  int dirfd = open(dir, O_RDONLY);
+  if (dirfd >= 0) {
+    fsync(dirfd);
+    close(dirfd);
+  }
+  return 0;
+}
+
+static void ckpt_start(struct ckpt_slot *s, const char *src)
+{
+  pid_t pid = fork();
+  if (pid == 0)
+    _exit(ckpt_copy(src, s->dest));
+  if (pid < 0) {
+    printf("DONE %s 1\n", s->dest);
+    s->dest[0] = 0;
+    return;
+  }
+  s->pid = pid;
+}
+
+static void checkpoint(void)
+{
+  static char in_buf[65536];
+  size_t in_len = 0;
+  int input_open = 1;
+  int sync_wanted = 0;
+  int i;
+
+  for (;;) {
+    int busy = 0;
+    for (i = 0; i < MAX_CKPT; i++)
+      if (ckpt_slots[i].pid != 0)
+        busy++;
+    if (!input_open && !busy)
+      break;
+    // one SYNCED per sync request, so a driver may count replies
+    while (sync_wanted && !busy) {
+      printf("SYNCED\n");
+      fflush(stdout);
+      sync_wanted--;
+    }
+
+    struct pollfd pfd;
+    pfd.fd = 0;
+    pfd.events = POLLIN;
+    // the timeout bounds completion-reporting latency; a finishing
+    // writer child does not interrupt poll on its own
+    poll(&pfd, input_open ? 1 : 0, 50);
+
+    if (input_open && (pfd.revents & (POLLIN | POLLHUP))) {
+      ssize_t got = read(0, in_buf + in_len, sizeof(in_buf) - 1 - in_len);
+      if (got <= 0)
+        input_open = 0;
+      else
+        in_len += got;
+      in_buf[in_len] = 0;
+    }
+
+    char *nl;
+    while ((nl = strchr(in_buf, '\n')) != NULL) {
+      *nl = 0;
+      char src[PATH_MAX - 64], dest[PATH_MAX - 64];
+      if (sscanf(in_buf, "save %4031s %4031s", src, dest) == 2) {
+        struct ckpt_slot *slot = NULL;
+        for (i = 0; i < MAX_CKPT; i++)
+          if (ckpt_slots[i].dest[0] &&
+              strcmp(ckpt_slots[i].dest, dest) == 0) {
+            slot = &ckpt_slots[i];
+            break;
+          }
+        if (!slot)
+          for (i = 0; i < MAX_CKPT; i++)
+            if (!ckpt_slots[i].dest[0]) {
+              slot = &ckpt_slots[i];
+              snprintf(slot->dest, sizeof(slot->dest), "%s", dest);
+              break;
+            }
+        if (!slot) {
+          printf("ERR checkpoint table full\n");
+        }
+        else if (slot->pid != 0) {
+          // double buffer: the newest accepted state supersedes
+          // whatever was queued behind the write in flight
+          snprintf(slot->pending_src, sizeof(slot->pending_src),
+                   "%s", src);
+          printf("OK\n");
+        }
+        else {
+          ckpt_start(slot, src);
+          printf("OK\n");
+        }
+      }
+      else if (strcmp(in_buf, "sync") == 0) {
+        sync_wanted++;
+      }
+      else if (in_buf[0]) {
+        printf("ERR bad request\n");
+      }
+      fflush(stdout);
+      in_len -= (nl + 1) - in_buf;
+      memmove(in_buf, nl + 1, in_len + 1);
+    }
+
+    // reap finished writers; a queued source starts its write now
+    for (;;) {
+      int status = 0;
+      pid_t pid = waitpid(-1, &status, WNOHANG);
+      if (pid <= 0)
+        break;
+      for (i = 0; i < MAX_CKPT; i++) {
+        struct ckpt_slot *s = &ckpt_slots[i];
+        if (s->pid != pid)
+          continue;
+        s->pid = 0;
+        printf("DONE %s %d\n", s->dest,
+               WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+        fflush(stdout);
+        if (s->pending_src[0]) {
+          char src[PATH_MAX - 64];
+          snprintf(src, sizeof(src), "%s", s->pending_src);
+          s->pending_src[0] = 0;
+          ckpt_start(s, src);
+        }
+        else {
+          s->dest[0] = 0;
+        }
+        break;
+      }
+    }
+  }
+
+  while (sync_wanted--) {
+    printf("SYNCED\n");
+    fflush(stdout);
+  }
+}
+
+/*
+ * Cold-start warmup.  Each task runs in a forked child whose stdout and
+ * stderr go to /dev/null; the exit code is the whole report.
+ */
+
+static void init_prefault(const char *file, const char *tmp_dir)
+{
+  (void)tmp_dir;
+  int fd = open(file, O_RDONLY);
+  if (fd < 0)
+    _exit(1);
+#ifdef POSIX_FADV_WILLNEED
+  posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+  // actually touch the pages; WILLNEED alone only queues readahead
+  char buf[65536];
+  ssize_t got;
+  while ((got = read(fd, buf, sizeof(buf))) > 0)
+    ;
+  close(fd);
+  _exit(got < 0);
+}
+
+static void init_tokens(const char *file, const char *tmp_dir)
+{
+  (void)tmp_dir;
+  char path[PATH_MAX];
+  tool_path(path, sizeof(path), "clex");
+  // hash-normalized is the cheapest mode that still lexes everything
+  execlp(path, "clex", "hash-normalized", "0", file, "--save-tokens",
+         (char *)NULL);
+  _exit(127);
+}
+
+static void init_index(const char *file, const char *tmp_dir)
+{
+  (void)tmp_dir;
+  int fd = open(file, O_RDONLY);
+  if (fd < 0)
+    _exit(1);
+  dup2(fd, 0);
+  close(fd);
+  char index_arg[PATH_MAX + 16];
+  snprintf(index_arg, sizeof(index_arg), "--index=%s.tffidx", file);
+  char path[PATH_MAX];
+  tool_path(path, sizeof(path), "topformflat");
+  execlp(path, "topformflat", "0", index_arg, (char *)NULL);
+  _exit(127);
+}
+
+static void init_ast(const char *file, const char *tmp_dir)
+{
+  char cache[PATH_MAX];
+  snprintf(cache, sizeof(cache), "--ast-cache=%s/ast-cache", tmp_dir);
+  char path[PATH_MAX];
+  tool_path(path, sizeof(path), "clang_delta");
+  // a cache miss under --ast-cache primes the entry; any query will do
+  execlp(path, "clang_delta", "--query-instances=remove-unused-function",
+         cache, file, (char *)NULL);
+  _exit(127);
+}
+
+struct init_task {
+  const char *name;
+  void (*fn)(const char *, const char *);
+  int ok_code;        // the tool's own success status
+  pid_t pid;
+};
+
+static struct init_task init_tasks[] = {
+  { "prefault", init_prefault, 0, 0 },
+  { "tokens", init_tokens, 51, 0 },   // clex exits OK (51) on success
+  { "index", init_index, 0, 0 },
+  { "ast", init_ast, 0, 0 },
+};
+
+static pid_t init_spawn(struct init_task *task, const char *file,
+                        const char *tmp_dir)
+{
+  pid_t pid = fork();
+  if (pid == 0) {
+    int null = open("/dev/null", O_RDWR);
+    if (null >= 0) {
+      dup2(null, 1);
+      dup2(null, 2);
+      close(null);
+    }
+    task->fn(file, tmp_dir);
+    _exit(127);
+  }
+  return pid;
+}
+
+static int init_layout(const char *tmp_dir, int workers)
+{
+  int failed = 0;
+  char sub[PATH_MAX];
+  if (mkdir(tmp_dir, 0777) != 0 && errno != EEXIST)
+    failed++;
+  snprintf(sub, sizeof(sub), "%s/ast-cache", tmp_dir);
+  if (mkdir(sub, 0777) != 0 && errno != EEXIST)
+    failed++;
+  int w;
+  for (w = 0; w < workers; w++) {
+    snprintf(sub, sizeof(sub), "%s/worker-%d", tmp_dir, w);
+    if (mkdir(sub, 0777) != 0 && errno != EEXIST)
+      failed++;
+  }
+
+  int on_tmpfs = 0;
+#ifdef __linux__
+  struct statfs sfs;
+  if (statfs(tmp_dir, &sfs) == 0)
+    on_tmpfs = (sfs.f_type == 0x01021994);   // TMPFS_MAGIC
+#endif
+  printf("tmpfs %d\n", on_tmpfs);
+
+  int tmpfile_ok = 0;
+#ifdef O_TMPFILE
+  int fd = open(tmp_dir, O_TMPFILE | O_WRONLY, 0600);
+  if (fd >= 0) {
+    tmpfile_ok = 1;
+    close(fd);
+  }
+#endif
+  printf("o_tmpfile %d\n", tmpfile_ok);
+  printf("workers %d\n", workers);
+  fflush(stdout);
+  return failed;
+}
+
+static int init_warmup(const char *file, const char *tmp_dir, int workers)
+{
+  size_t n_tasks = sizeof(init_tasks) / sizeof(init_tasks[0]);
+  size_t t;
+  int failed = 0;
+
+  if (workers <= 0) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    workers = n > 0 ? (int)n : 1;
+  }
+
+  // the ast-cache directory must exist before clang_delta starts
+  failed += init_layout(tmp_dir, workers);
+
+  for (t = 0; t < n_tasks; t++)
+    init_tasks[t].pid = init_spawn(&init_tasks[t], file, tmp_dir);
+
+  for (t = 0; t < n_tasks; t++) {
+    struct init_task *task = &init_tasks[t];
+    int status = 0;
+    if (task->pid <= 0 || waitpid(task->pid, &status, 0) < 0 ||
+        !WIFEXITED(status) || WEXITSTATUS(status) != task->ok_code) {
+      printf("ERR %s\n", task->name);
+      failed++;
+    }
+    else {
+      printf("OK %s\n", task->name);
+    }
+  }
+  return failed;
+}
+
+// restore an accepted journal state via the sibling chunkstore; the
+// journal is authoritative about which sequence numbers were accepts
+static int do_replay(const char *dir, const char *seq, const char *out)
+{
+  char log_path[PATH_MAX];
+  snprintf(log_path, sizeof(log_path), "%s/decisions.log", dir);
+  FILE *f = fopen(log_path, "r");
+  if (!f) {
+    fprintf(stderr, "cannot open journal: %s\n", log_path);
+    return 1;
+  }
+
+  int want_last = strcmp(seq, "last") == 0;
+  char line[4096];
+  char found_seq[64];
+  char found_desc[4096];
+  int have = 0;
+  while (fgets(line, sizeof(line), f)) {
+    char *fields[6];
+    int n = 0;
+    char *p = strtok(line, "\t\n");
+    while (p && n < 6) {
+      fields[n++] = p;
+      p = strtok(NULL, "\t\n");
+    }
+    if (n < 6 || strcmp(fields[1], "accept") != 0)
+      continue;
+    if (want_last || strcmp(fields[0], seq) == 0) {
+      snprintf(found_seq, sizeof(found_seq), "%s", fields[0]);
+      snprintf(found_desc, sizeof(found_desc), "%s %s", fields[4], fields[5]);
+      have = 1;
+      if (!want_last)
+        break;
+    }
+  }
+  fclose(f);
+  if (!have) {
+    fprintf(stderr, "no accepted record '%s' in %s\n", seq, log_path);
+    return 1;
+  }
+  fprintf(stderr, "replaying %s: %s\n", found_seq, found_desc);
+
+  char store[PATH_MAX], manifest[PATH_MAX], path[PATH_MAX];
+  snprintf(store, sizeof(store), "%s/store", dir);
+  snprintf(manifest, sizeof(manifest), "%s/manifests/%s", dir, found_seq);
+  tool_path(path, sizeof(path), "chunkstore");
+  execlp(path, "chunkstore", "restore", store, manifest, out, (char *)NULL);
+  fprintf(stderr, "cannot exec chunkstore\n");
+  return 127;
+}
+
+int main(int argc, char *argv[])
+{
+  find_exe_dir(argv[0]);
+
+  // busybox-style: a symlinked tool name dispatches directly
+  const char *base = strrchr(argv[0], '/');
+  base = base ? base + 1 : argv[0];
+  if (is_in(known_tools, base)) {
+    char path[PATH_MAX];
+    tool_path(path, sizeof(path), base);
+    execvp(path, argv);
+    fprintf(stderr, "cannot exec %s\n", base);
+    return 127;
+  }
+
+  if (argc >= 2 && strcmp(argv[1], "--serve") == 0) {
+    serve();
+    return 0;
+  }
+
+  if (argc >= 4 && strcmp(argv[1], "init") == 0)
+    return init_warmup(argv[2], argv[3], argc >= 5 ? atoi(argv[4]) : 0);
+
+  if (argc >= 5 && strcmp(argv[1], "replay") == 0)
+    return do_replay(argv[2], argv[3], argv[4]);
+
+  if (argc >= 3 && strcmp(argv[1], "stats") == 0)
+    return do_stats(argv[2]);
+
+  if (argc >= 3 && strcmp(argv[1], "estimate") == 0)
+    return do_estimate(argv[2]);
+
+  if (argc >= 4 && strcmp(argv[1], "synthesize-group") == 0)
+    return do_synthesize_group(argv[2], argv[3]);
+
+  if (argc >= 3 && strcmp(argv[1], "agent") == 0)
+    return agent(argv[2]);
+
+  if (argc >= 2 && strcmp(argv[1], "checkpoint") == 0) {
+    checkpoint();
+    return 0;
+  }
+
+  if (argc >= 2 && is_in(known_tools, argv[1])) {
+    char path[PATH_MAX];
+    tool_path(path, sizeof(path), argv[1]);
+    execvp(path, argv + 1);
+    fprintf(stderr, "cannot exec %s\n", argv[1]);
+    return 127;
+  }
+
+  fprintf(stderr, "usage: %s <tool> [args...] | %s --serve | %s stats <ledger>"
+          " | %s estimate <ledger>"
+          " | %s synthesize-group <ledger> <group.json>"
+          " | %s agent <store-dir> | %s checkpoint"
+          " | %s init <file> <tmp-dir> [<workers>]"
+          " | %s replay <journal-dir> <seq>|last <out-file>\n"
+          "tools: clex, strlex, topformflat, linesplice, squeezeblank, "
+          "chunkstore, ppdirindex\n",
+          argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0],
+          argv[0], argv[0]);
+  return 1;
+}
+
+#else // _MSC_VER
+
+int main(void)
+{
+  fprintf(stderr, "cvise_tools is not supported on this platform\n");
+  return 1;
+}
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/*
+ * fdbind: bind an inherited file descriptor to a filesystem path.
+ *
+ *   fdbind <fd> <path>
+ *
+ * The driver hands candidates around as open descriptors (a memfd
+ * filled by clang_delta --output-fd, or an O_TMPFILE) and fdbind makes
+ * such a segment visible at a path inside the interestingness test's
+ * sandbox.  An O_TMPFILE descriptor on the target filesystem is linked
+ * into place directly with linkat(AT_EMPTY_PATH), costing no data copy;
+ * anything else (memfd, cross-filesystem) is copied once into an
+ * O_TMPFILE next to the target and linked, falling back to a visible
+ * temporary plus rename where O_TMPFILE is unsupported.  Either way the
+ * file appears at <path> atomically.
+ */
+
+#ifndef _MSC_VER
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// link an O_TMPFILE-style descriptor to the path, replacing any
+// existing file
+static bool linkFdToPath(int Fd, const std::string &Path)
+{
+  std::string ProcPath = "/proc/self/fd/" + std::to_string(Fd);
+  if (linkat(AT_FDCWD, ProcPath.c_str(), AT_FDCWD, Path.c_str(),
+             AT_SYMLINK_FOLLOW) == 0)
+    return true;
+  if (errno != EEXIST)
+    return false;
+  if (unlink(Path.c_str()) != 0)
+    return false;
+  return linkat(AT_FDCWD, ProcPath.c_str(), AT_FDCWD, Path.c_str(),
+                AT_SYMLINK_FOLLOW) == 0;
+}
+
+static bool copyAll(int FromFd, int ToFd)
+{
+  if (lseek(FromFd, 0, SEEK_SET) < 0)
+    return false;
+  char Buf[1 << 16];
+  for (;;) {
+    ssize_t Got = read(FromFd, Buf, sizeof(Buf));
+    if (Got < 0)
+      return false;
+    if (Got == 0)
+      return true;
+    char *P = Buf;
+    while (Got > 0) {
+      ssize_t Put = write(ToFd, P, Got);
+      if (Put <= 0)
+        return false;
+      P += Put;
+      Got -= Put;
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s <fd> <path>\n", argv[0]);
+    return 1;
+  }
+
+  char *End = NULL;
+  long Fd = strtol(argv[1], &End, 10);
+  if (!End || *End || (Fd < 0)) {
+    fprintf(stderr, "invalid fd: %s\n", argv[1]);
+    return 1;
+  }
+  std::string Path(argv[2]);
+
+  // the cheap path: the descriptor is an unnamed file on the target
+  // filesystem and can be linked into place without copying
+  if (linkFdToPath(Fd, Path))
+    return 0;
+
+  std::string Dir(".");
+  size_t Slash = Path.rfind('/');
+  if (Slash != std::string::npos)
+    Dir = Path.substr(0, Slash + 1);
+
+#ifdef O_TMPFILE
+  int TmpFd = open(Dir.c_str(), O_TMPFILE | O_WRONLY, 0644);
+  if (TmpFd >= 0) {
+    bool OK = copyAll(Fd, TmpFd) && linkFdToPath(TmpFd, Path);
+    close(TmpFd);
+    if (OK)
+      return 0;
+  }
+#endif
+
+  // visible temporary plus rename; still atomic at the target path
+  std::string TmpPath = Path + ".fdbind.tmp";
+  int TmpFd2 = open(TmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (TmpFd2 < 0) {
+    fprintf(stderr, "cannot create %s: %s\n", TmpPath.c_str(),
+            strerror(errno));
+    return 1;
+  }
+  bool OK = copyAll(Fd, TmpFd2);
+  if (close(TmpFd2) != 0)
+    OK = false;
+  if (!OK || rename(TmpPath.c_str(), Path.c_str()) != 0) {
+    unlink(TmpPath.c_str());
+    fprintf(stderr, "cannot bind fd %ld to %s\n", Fd, Path.c_str());
+    return 1;
+  }
+  return 0;
+}
+
+#else // _MSC_VER
+
+#include <cstdio>
+
+int main()
+{
+  fprintf(stderr, "fdbind is not supported on this platform\n");
+  return 1;
+}
+
+#endif
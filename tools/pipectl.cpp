@@ -0,0 +1,805 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/*
+ * pipectl: interleaved generate/test pipeline controller.
+ *
+ *   pipectl [--numa] <generator-slots> <tester-slots> [<per-pass-queue-bound>]
+ *
+ * The driver's workers normally alternate between generating a
+ * candidate and testing it, so one of the two process pools is always
+ * idle.  pipectl keeps both busy: the driver submits two-stage jobs and
+ * the controller runs the generation stage in one slot pool and, on
+ * success, the test stage in the other, with a bounded per-pass queue
+ * between them.  The bound doubles as the work-stealing rule - once a
+ * pass has <bound> candidates waiting for a tester, its generation
+ * jobs stop being scheduled and slots drain the other passes' backlogs
+ * instead, so pass B generates while pass A's candidates are tested.
+ *
+ * Requests, one per line on stdin:
+ *
+ *   job <pass> <id> :: <gen-command> :: <test-command>
+ *                       queue a two-stage job; both commands run via
+ *                       "sh -c" and the test stage only runs when the
+ *                       generation stage exits 0.  A test command of
+ *                       literally "@spec" runs the pass's registered
+ *                       test spec natively instead (see below)
+ *   spec <pass> <exit|any> <stdout|stderr|any> <substr|regex>
+ *        :: <pattern> :: <command>
+ *                       register a declarative test for the pass: run
+ *                       <command> (no shell; split on whitespace, "{}"
+ *                       in a token expands to the job id) with both
+ *                       output streams captured, and report the
+ *                       candidate interesting (DONE status 0) when the
+ *                       exit code matches and the pattern occurs in the
+ *                       selected stream, else DONE 1.  Most
+ *                       interestingness scripts are exactly "grep for
+ *                       the ICE string in the compiler output"; running
+ *                       that check in-process drops a shell plus a
+ *                       Python interpreter per candidate, which at
+ *                       100k+ candidates per reduction is hours
+ *   flush <pass>        drop this pass's jobs that have not started a
+ *                       stage yet (the pass advanced); running stages
+ *                       finish and report normally
+ *   stats               reply "STATS <queued-gen> <queued-test> <running>"
+ *
+ * Events, one per line on stdout:
+ *
+ *   GENFAIL <pass> <id> <status>   generation stage failed
+ *   DONE <pass> <id> <status>      test stage finished
+ *   ERR <reason>                   malformed request
+ *
+ * EOF on stdin stops intake; the controller drains everything already
+ * accepted, reports it, and exits 0.
+ *
+ * The loop is fully event-driven: a SIGCHLD signalfd sits in the poll
+ * set next to stdin and the captured test streams, so the controller
+ * wakes the instant a stage exits and its DONE/GENFAIL record reaches
+ * the driver in the same pass.  The driver in turn blocks on this one
+ * descriptor for all outstanding completions instead of sleeping and
+ * re-polling; at high worker counts the old fixed wake-up tick was pure
+ * added latency on every candidate.
+ *
+ * With --numa the slot pools are split across the NUMA nodes listed in
+ * /sys/devices/system/node, each node getting a share proportional to
+ * its CPU count, and every stage is pinned to its node's CPUs with a
+ * node-bound memory policy before exec.  On multi-socket hosts a forked
+ * compiler otherwise allocates its AST on whichever node the scheduler
+ * happened to place it and then pays cross-node traffic for the rest of
+ * its life; pinning at spawn time keeps each worker's pages local.  The
+ * policy is inherited across exec, so long-lived daemons started from a
+ * pinned stage stay node-local too.  On a single-node host the flag is
+ * accepted and does nothing.
+ */
+
+#ifndef _MSC_VER
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <cerrno>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <regex.h>
+#include <sched.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+
+struct Job {
+  std::string pass;
+  std::string id;
+  std::string genCmd;
+  std::string testCmd;
+};
+
+struct RunningStage {
+  pid_t pid;
+  Job job;
+  int stage;        /* 0 = generation, 1 = test */
+  int node;         /* NUMA node the stage is pinned to, -1 = unpinned */
+  bool nativeTest;  /* test stage run from a registered spec */
+  int outFd;        /* captured stdout/stderr of a native test, -1 when */
+  int errFd;        /* not capturing (or already at EOF) */
+  std::string outBuf;
+  std::string errBuf;
+};
+
+/* A declarative test stage: run the command without a shell, then
+ * decide interestingness natively from its exit code and output. */
+struct TestSpec {
+  bool anyExit;
+  int exitCode;
+  int stream;       /* 0 = stdout, 1 = stderr, 2 = both */
+  bool isRegex;
+  std::string pattern;
+  std::string cmd;
+  regex_t re;
+  bool reCompiled;
+};
+
+/* One slot-pool shard per NUMA node: the node's CPUs, its share of each
+ * stage pool, and how many stages it is currently running. */
+struct NumaNode {
+  int id;
+  cpu_set_t cpus;
+  int cpuCount;
+  int slotCap[2];
+  int slotUsed[2];
+};
+
+static std::deque<Job> genQueue;
+static std::deque<Job> testQueue;
+static std::vector<RunningStage> running;
+/* candidates of a pass that are queued for or undergoing a test; the
+ * per-pass bound applies to this count */
+static std::map<std::string, int> inFlightTests;
+static std::map<std::string, TestSpec> testSpecs;
+
+static int generatorSlots;
+static int testerSlots;
+static int queueBound = 4;
+static std::vector<NumaNode> numaNodes;
+/* SIGCHLD delivery channel for the poll loop; -1 falls back to a timed
+ * poll on kernels without signalfd */
+static int sigChldFd = -1;
+static sigset_t sigChldMask;
+
+static int runningStages(int stage)
+{
+  int n = 0;
+  for (size_t i = 0; i < running.size(); i++)
+    if (running[i].stage == stage)
+      n++;
+  return n;
+}
+
+/* Parse a sysfs cpulist like "0-15,64-79" into a cpu set. */
+static int parseCpuList(const char *list, cpu_set_t *set)
+{
+  int count = 0;
+  CPU_ZERO(set);
+  const char *p = list;
+  while (*p) {
+    char *end;
+    long first = strtol(p, &end, 10);
+    if (end == p)
+      break;
+    long last = first;
+    if (*end == '-') {
+      p = end + 1;
+      last = strtol(p, &end, 10);
+    }
+    for (long cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+      CPU_SET((int)cpu, set);
+      count++;
+    }
+    p = (*end == ',') ? end + 1 : end;
+  }
+  return count;
+}
+
+/* Discover the NUMA topology from sysfs and split both slot pools
+ * across the nodes, each node's share proportional to its CPU count
+ * (remainders go to the largest nodes first, and every node with CPUs
+ * gets at least one slot of each kind so no node's memory sits idle). */
+static void initNumaPools(void)
+{
+  DIR *dir = opendir("/sys/devices/system/node");
+  if (dir) {
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+      int id;
+      if (sscanf(ent->d_name, "node%d", &id) != 1)
+        continue;
+      char path[256];
+      snprintf(path, sizeof(path),
+               "/sys/devices/system/node/node%d/cpulist", id);
+      FILE *f = fopen(path, "r");
+      if (!f)
+        continue;
+      char list[4096];
+      if (fgets(list, sizeof(list), f)) {
+        NumaNode node;
+        node.id = id;
+        node.cpuCount = parseCpuList(list, &node.cpus);
+        node.slotCap[0] = node.slotCap[1] = 0;
+        node.slotUsed[0] = node.slotUsed[1] = 0;
+        if (node.cpuCount > 0)
+          numaNodes.push_back(node);
+      }
+      fclose(f);
+    }
+    closedir(dir);
+  }
+  /* a single node (or no sysfs) degenerates to the unpinned layout */
+  if (numaNodes.size() < 2) {
+    numaNodes.clear();
+    return;
+  }
+
+  int totalCpus = 0;
+  for (size_t i = 0; i < numaNodes.size(); i++)
+    totalCpus += numaNodes[i].cpuCount;
+  for (int stage = 0; stage < 2; stage++) {
+    int pool = stage ? testerSlots : generatorSlots;
+    int assigned = 0;
+    for (size_t i = 0; i < numaNodes.size(); i++) {
+      int share = pool * numaNodes[i].cpuCount / totalCpus;
+      if (share < 1)
+        share = 1;
+      numaNodes[i].slotCap[stage] = share;
+      assigned += share;
+    }
+    /* hand out any remainder one slot at a time, biggest node first */
+    while (assigned < pool) {
+      size_t best = 0;
+      for (size_t i = 1; i < numaNodes.size(); i++)
+        if (numaNodes[i].cpuCount > numaNodes[best].cpuCount)
+          best = i;
+      numaNodes[best].slotCap[stage]++;
+      assigned++;
+    }
+  }
+}
+
+/* The node with the most free capacity for this stage, or -1 when the
+ * per-node pools are all full (or placement is off). */
+static int pickNumaNode(int stage)
+{
+  int best = -1, bestFree = 0;
+  for (size_t i = 0; i < numaNodes.size(); i++) {
+    int free_ = numaNodes[i].slotCap[stage] - numaNodes[i].slotUsed[stage];
+    if (free_ > bestFree) {
+      bestFree = free_;
+      best = (int)i;
+    }
+  }
+  return best;
+}
+
+static pid_t spawnShell(const std::string &cmd, int node)
+{
+  pid_t pid = fork();
+  if (pid != 0)
+    return pid;
+  /* the blocked-SIGCHLD mask is ours, not the stage's */
+  if (sigChldFd >= 0)
+    sigprocmask(SIG_UNBLOCK, &sigChldMask, NULL);
+  if (node >= 0) {
+    NumaNode &n = numaNodes[node];
+    sched_setaffinity(0, sizeof(n.cpus), &n.cpus);
+#ifdef __NR_set_mempolicy
+    /* MPOL_BIND, spelled out to avoid a libnuma build dependency; the
+     * policy survives exec, so the stage's compiler allocates its AST
+     * on the node it runs on.  Affinity alone already gives first-touch
+     * locality, so a failure here is not worth aborting the stage. */
+    unsigned long nodeMask = 1UL << n.id;
+    syscall(__NR_set_mempolicy, 2 /* MPOL_BIND */, &nodeMask,
+            sizeof(nodeMask) * 8);
+#endif
+  }
+  execl("/bin/sh", "sh", "-c", cmd.c_str(), (char *)NULL);
+  _exit(127);
+}
+
+/* Split a spec command on whitespace; "{}" inside a token expands to
+ * the job id (the driver names candidate files by id). */
+static void buildSpecArgv(const std::string &cmd, const std::string &id,
+                          std::vector<std::string> &args)
+{
+  size_t i = 0;
+  while (i < cmd.size()) {
+    while (i < cmd.size() && (cmd[i] == ' ' || cmd[i] == '\t'))
+      i++;
+    size_t j = i;
+    while (j < cmd.size() && cmd[j] != ' ' && cmd[j] != '\t')
+      j++;
+    if (j > i) {
+      std::string tok = cmd.substr(i, j - i);
+      size_t pos;
+      while ((pos = tok.find("{}")) != std::string::npos)
+        tok.replace(pos, 2, id);
+      args.push_back(tok);
+    }
+    i = j;
+  }
+}
+
+/* Run the pass's registered spec command with both output streams
+ * captured.  posix_spawn instead of fork keeps the per-candidate cost
+ * at a vfork-grade clone; the pinning (affinity only - a memory policy
+ * cannot be set on another task) happens from the parent afterwards. */
+static pid_t spawnNativeTest(const Job &job, RunningStage &r, int node)
+{
+  std::vector<std::string> args;
+  buildSpecArgv(testSpecs[job.pass].cmd, job.id, args);
+  if (args.empty())
+    return -1;
+
+  int outPipe[2], errPipe[2];
+  if (pipe(outPipe) < 0)
+    return -1;
+  if (pipe(errPipe) < 0) {
+    close(outPipe[0]);
+    close(outPipe[1]);
+    return -1;
+  }
+
+  posix_spawn_file_actions_t fa;
+  posix_spawn_file_actions_init(&fa);
+  posix_spawn_file_actions_adddup2(&fa, outPipe[1], 1);
+  posix_spawn_file_actions_adddup2(&fa, errPipe[1], 2);
+  posix_spawn_file_actions_addclose(&fa, outPipe[0]);
+  posix_spawn_file_actions_addclose(&fa, errPipe[0]);
+
+  std::vector<char *> argv;
+  for (size_t i = 0; i < args.size(); i++)
+    argv.push_back(const_cast<char *>(args[i].c_str()));
+  argv.push_back(NULL);
+
+  /* do not leak the controller's blocked SIGCHLD into the test */
+  posix_spawnattr_t attr;
+  posix_spawnattr_init(&attr);
+  sigset_t childMask;
+  sigemptyset(&childMask);
+  posix_spawnattr_setsigmask(&attr, &childMask);
+  posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK);
+
+  pid_t pid;
+  int rc = posix_spawnp(&pid, argv[0], &fa, &attr, &argv[0], environ);
+  posix_spawnattr_destroy(&attr);
+  posix_spawn_file_actions_destroy(&fa);
+  close(outPipe[1]);
+  close(errPipe[1]);
+  if (rc != 0) {
+    close(outPipe[0]);
+    close(errPipe[0]);
+    return -1;
+  }
+
+  fcntl(outPipe[0], F_SETFL, O_NONBLOCK);
+  fcntl(errPipe[0], F_SETFL, O_NONBLOCK);
+  if (node >= 0)
+    sched_setaffinity(pid, sizeof(numaNodes[node].cpus),
+                      &numaNodes[node].cpus);
+  r.outFd = outPipe[0];
+  r.errFd = errPipe[0];
+  return pid;
+}
+
+/* Vectored read into two scratch halves: one syscall moves up to 8 kB,
+ * halving wakeups on chatty compilers.  Returns false at EOF.  The kept
+ * bytes are capped at 1 MB per stream - the patterns these specs match
+ * (ICE strings) appear early, and a runaway compiler must not take the
+ * controller's memory with it; the pipe is still drained so the child
+ * never blocks on a full pipe. */
+static bool drainNativeFd(int fd, std::string &buf)
+{
+  char a[4096], b[4096];
+  struct iovec iov[2];
+  iov[0].iov_base = a;
+  iov[0].iov_len = sizeof(a);
+  iov[1].iov_base = b;
+  iov[1].iov_len = sizeof(b);
+  for (;;) {
+    ssize_t got = readv(fd, iov, 2);
+    if (got < 0)
+      return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+    if (got == 0)
+      return false;
+    if (buf.size() < (1u << 20)) {
+      size_t fromA = ((size_t)got < sizeof(a)) ? (size_t)got : sizeof(a);
+      buf.append(a, fromA);
+      if ((size_t)got > sizeof(a))
+        buf.append(b, (size_t)got - sizeof(a));
+    }
+    if ((size_t)got < sizeof(a) + sizeof(b))
+      return true;
+  }
+}
+
+/* 0 when the spec holds (exit code matches and the pattern occurs in
+ * the selected stream), 1 otherwise. */
+static int evalNativeTest(const RunningStage &r, int code)
+{
+  const TestSpec &spec = testSpecs[r.job.pass];
+  if (!spec.anyExit && code != spec.exitCode)
+    return 1;
+
+  const std::string *bufs[2];
+  int nbufs = 0;
+  if (spec.stream != 1)
+    bufs[nbufs++] = &r.outBuf;
+  if (spec.stream != 0)
+    bufs[nbufs++] = &r.errBuf;
+  for (int i = 0; i < nbufs; i++) {
+    if (spec.isRegex) {
+      if (regexec(&spec.re, bufs[i]->c_str(), 0, NULL, 0) == 0)
+        return 0;
+    }
+    else if (bufs[i]->find(spec.pattern) != std::string::npos) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Start whatever the free slots and the queue bound allow.  Generation
+ * picks the first queued job whose pass is still under the bound, which
+ * is what lets a backlogged pass yield its slots to the others. */
+static void schedule(void)
+{
+  while (runningStages(1) < testerSlots && !testQueue.empty()) {
+    int node = -1;
+    if (!numaNodes.empty() && (node = pickNumaNode(1)) < 0)
+      break;
+    RunningStage r;
+    r.job = testQueue.front();
+    testQueue.pop_front();
+    r.stage = 1;
+    r.node = node;
+    r.nativeTest = false;
+    r.outFd = r.errFd = -1;
+    if (r.job.testCmd == "@spec") {
+      if (!testSpecs.count(r.job.pass)) {
+        printf("ERR no spec for pass %s\n", r.job.pass.c_str());
+        printf("DONE %s %s 127\n", r.job.pass.c_str(), r.job.id.c_str());
+        inFlightTests[r.job.pass]--;
+        continue;
+      }
+      r.nativeTest = true;
+      r.pid = spawnNativeTest(r.job, r, node);
+    }
+    else {
+      r.pid = spawnShell(r.job.testCmd, node);
+    }
+    if (r.pid < 0) {
+      printf("DONE %s %s 127\n", r.job.pass.c_str(), r.job.id.c_str());
+      inFlightTests[r.job.pass]--;
+      continue;
+    }
+    if (node >= 0)
+      numaNodes[node].slotUsed[1]++;
+    running.push_back(r);
+  }
+
+  while (runningStages(0) < generatorSlots) {
+    int node = -1;
+    if (!numaNodes.empty() && (node = pickNumaNode(0)) < 0)
+      return;
+    std::deque<Job>::iterator I = genQueue.begin();
+    for (; I != genQueue.end(); ++I)
+      if (inFlightTests[(*I).pass] < queueBound)
+        break;
+    if (I == genQueue.end())
+      return;
+    RunningStage r;
+    r.job = *I;
+    genQueue.erase(I);
+    r.stage = 0;
+    r.node = node;
+    r.nativeTest = false;
+    r.outFd = r.errFd = -1;
+    /* reserve the test-queue place now, so a burst of finishing
+     * generators cannot overshoot the bound */
+    inFlightTests[r.job.pass]++;
+    r.pid = spawnShell(r.job.genCmd, node);
+    if (r.pid < 0) {
+      printf("GENFAIL %s %s 127\n", r.job.pass.c_str(), r.job.id.c_str());
+      inFlightTests[r.job.pass]--;
+      continue;
+    }
+    if (node >= 0)
+      numaNodes[node].slotUsed[0]++;
+    running.push_back(r);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  bool numaPlacement = false;
+  if (argc > 1 && strcmp(argv[1], "--numa") == 0) {
+    numaPlacement = true;
+    argv++;
+    argc--;
+  }
+  if (argc < 3 || argc > 4) {
+    fprintf(stderr,
+            "usage: %s [--numa] <generator-slots> <tester-slots> "
+            "[<queue-bound>]\n",
+            argv[0]);
+    return 1;
+  }
+  generatorSlots = atoi(argv[1]);
+  testerSlots = atoi(argv[2]);
+  if (argc == 4)
+    queueBound = atoi(argv[3]);
+  if (generatorSlots < 1 || testerSlots < 1 || queueBound < 1) {
+    fprintf(stderr, "slot and bound counts must be positive\n");
+    return 1;
+  }
+  if (numaPlacement)
+    initNumaPools();
+
+  signal(SIGPIPE, SIG_IGN);
+
+  /* route SIGCHLD through a descriptor: the signal must be blocked
+   * before the first fork so an exit between spawn and poll is held
+   * pending and surfaces as readability instead of being lost */
+  sigemptyset(&sigChldMask);
+  sigaddset(&sigChldMask, SIGCHLD);
+  if (sigprocmask(SIG_BLOCK, &sigChldMask, NULL) == 0) {
+    sigChldFd = signalfd(-1, &sigChldMask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (sigChldFd < 0)
+      sigprocmask(SIG_UNBLOCK, &sigChldMask, NULL);
+  }
+
+  std::string inBuf;
+  bool inputOpen = true;
+  char chunk[4096];
+
+  while (inputOpen || !running.empty() || !genQueue.empty() ||
+         !testQueue.empty()) {
+    schedule();
+
+    std::vector<struct pollfd> pfds;
+    if (inputOpen) {
+      struct pollfd p;
+      p.fd = 0;
+      p.events = POLLIN;
+      p.revents = 0;
+      pfds.push_back(p);
+    }
+    /* captured streams of native tests join the poll set, so a chatty
+     * child never blocks on a full pipe between reap sweeps */
+    for (size_t i = 0; i < running.size(); i++) {
+      for (int s = 0; s < 2; s++) {
+        int fd = s ? running[i].errFd : running[i].outFd;
+        if (fd < 0)
+          continue;
+        struct pollfd p;
+        p.fd = fd;
+        p.events = POLLIN;
+        p.revents = 0;
+        pfds.push_back(p);
+      }
+    }
+    if (sigChldFd >= 0) {
+      struct pollfd p;
+      p.fd = sigChldFd;
+      p.events = POLLIN;
+      p.revents = 0;
+      pfds.push_back(p);
+    }
+    /* with the signalfd in the set every event interrupts poll, so the
+     * wait can be indefinite; without it, fall back to a short tick so
+     * child exits are still noticed promptly */
+    poll(pfds.empty() ? NULL : &pfds[0], pfds.size(),
+         sigChldFd >= 0 ? -1 : 50);
+
+    if (sigChldFd >= 0) {
+      /* swallow the queued notifications; the reap sweep below collects
+       * every exited child regardless of how many signals coalesced */
+      struct signalfd_siginfo si;
+      while (read(sigChldFd, &si, sizeof(si)) > 0)
+        ;
+    }
+
+    if (inputOpen && (pfds[0].revents & (POLLIN | POLLHUP))) {
+      ssize_t got = read(0, chunk, sizeof(chunk));
+      if (got <= 0) {
+        inputOpen = false;
+      }
+      else {
+        inBuf.append(chunk, got);
+      }
+    }
+
+    for (size_t i = 0; i < running.size(); i++) {
+      if (running[i].outFd >= 0 &&
+          !drainNativeFd(running[i].outFd, running[i].outBuf)) {
+        close(running[i].outFd);
+        running[i].outFd = -1;
+      }
+      if (running[i].errFd >= 0 &&
+          !drainNativeFd(running[i].errFd, running[i].errBuf)) {
+        close(running[i].errFd);
+        running[i].errFd = -1;
+      }
+    }
+
+    size_t nl;
+    while ((nl = inBuf.find('\n')) != std::string::npos) {
+      std::string line = inBuf.substr(0, nl);
+      inBuf.erase(0, nl + 1);
+
+      if (line.compare(0, 4, "job ") == 0) {
+        size_t sep1 = line.find(" :: ");
+        size_t sep2 = (sep1 == std::string::npos)
+                        ? std::string::npos : line.find(" :: ", sep1 + 4);
+        char pass[256], id[256];
+        if (sep2 == std::string::npos ||
+            sscanf(line.c_str(), "job %255s %255s", pass, id) != 2) {
+          printf("ERR bad job request\n");
+          continue;
+        }
+        Job job;
+        job.pass = pass;
+        job.id = id;
+        job.genCmd = line.substr(sep1 + 4, sep2 - sep1 - 4);
+        job.testCmd = line.substr(sep2 + 4);
+        if (job.genCmd.empty() || job.testCmd.empty()) {
+          printf("ERR bad job request\n");
+          continue;
+        }
+        genQueue.push_back(job);
+      }
+      else if (line.compare(0, 5, "spec ") == 0) {
+        size_t sep1 = line.find(" :: ");
+        size_t sep2 = (sep1 == std::string::npos)
+                        ? std::string::npos : line.find(" :: ", sep1 + 4);
+        char pass[256], exitSpec[16], streamSpec[16], kindSpec[16];
+        if (sep2 == std::string::npos ||
+            sscanf(line.c_str(), "spec %255s %15s %15s %15s",
+                   pass, exitSpec, streamSpec, kindSpec) != 4) {
+          printf("ERR bad spec request\n");
+          continue;
+        }
+        TestSpec spec;
+        spec.anyExit = strcmp(exitSpec, "any") == 0;
+        spec.exitCode = spec.anyExit ? 0 : atoi(exitSpec);
+        if (strcmp(streamSpec, "stdout") == 0)
+          spec.stream = 0;
+        else if (strcmp(streamSpec, "stderr") == 0)
+          spec.stream = 1;
+        else if (strcmp(streamSpec, "any") == 0)
+          spec.stream = 2;
+        else {
+          printf("ERR bad spec stream\n");
+          continue;
+        }
+        if (strcmp(kindSpec, "substr") && strcmp(kindSpec, "regex")) {
+          printf("ERR bad spec match kind\n");
+          continue;
+        }
+        spec.isRegex = strcmp(kindSpec, "regex") == 0;
+        spec.pattern = line.substr(sep1 + 4, sep2 - sep1 - 4);
+        spec.cmd = line.substr(sep2 + 4);
+        spec.reCompiled = false;
+        if (spec.pattern.empty() || spec.cmd.empty()) {
+          printf("ERR bad spec request\n");
+          continue;
+        }
+        /* compile into the stored slot; the regex_t must not be a
+         * shallow copy of a local that goes out of scope */
+        TestSpec &slot = testSpecs[pass];
+        if (slot.reCompiled)
+          regfree(&slot.re);
+        slot = spec;
+        if (slot.isRegex) {
+          /* REG_NEWLINE gives grep's line-oriented anchors, which is
+           * what these specs replace */
+          if (regcomp(&slot.re, slot.pattern.c_str(),
+                      REG_EXTENDED | REG_NOSUB | REG_NEWLINE) != 0) {
+            printf("ERR bad spec regex\n");
+            testSpecs.erase(pass);
+            continue;
+          }
+          slot.reCompiled = true;
+        }
+      }
+      else if (line.compare(0, 6, "flush ") == 0) {
+        std::string pass = line.substr(6);
+        std::deque<Job>::iterator I = genQueue.begin();
+        while (I != genQueue.end()) {
+          if ((*I).pass == pass)
+            I = genQueue.erase(I);
+          else
+            ++I;
+        }
+        I = testQueue.begin();
+        while (I != testQueue.end()) {
+          if ((*I).pass == pass) {
+            inFlightTests[pass]--;
+            I = testQueue.erase(I);
+          }
+          else
+            ++I;
+        }
+      }
+      else if (line == "stats") {
+        printf("STATS %lu %lu %lu\n", (unsigned long)genQueue.size(),
+               (unsigned long)testQueue.size(),
+               (unsigned long)running.size());
+      }
+      else if (!line.empty()) {
+        printf("ERR bad request\n");
+      }
+      fflush(stdout);
+    }
+
+    /* reap and report finished stages */
+    for (;;) {
+      int status = 0;
+      pid_t pid = waitpid(-1, &status, WNOHANG);
+      if (pid <= 0)
+        break;
+      int code = WIFEXITED(status) ? WEXITSTATUS(status)
+                                   : 128 + WTERMSIG(status);
+      for (size_t i = 0; i < running.size(); i++) {
+        if (running[i].pid != pid)
+          continue;
+        Job job = running[i].job;
+        int stage = running[i].stage;
+        if (running[i].node >= 0)
+          numaNodes[running[i].node].slotUsed[stage]--;
+        if (running[i].nativeTest) {
+          /* pick up output still in the pipes, then judge the spec;
+           * a backgrounded grandchild holding the write end open must
+           * not stall the verdict, so this is a single final drain */
+          if (running[i].outFd >= 0) {
+            drainNativeFd(running[i].outFd, running[i].outBuf);
+            close(running[i].outFd);
+          }
+          if (running[i].errFd >= 0) {
+            drainNativeFd(running[i].errFd, running[i].errBuf);
+            close(running[i].errFd);
+          }
+          code = evalNativeTest(running[i], code);
+        }
+        running.erase(running.begin() + i);
+        if (stage == 0) {
+          if (code == 0) {
+            testQueue.push_back(job);
+          }
+          else {
+            printf("GENFAIL %s %s %d\n", job.pass.c_str(),
+                   job.id.c_str(), code);
+            inFlightTests[job.pass]--;
+          }
+        }
+        else {
+          printf("DONE %s %s %d\n", job.pass.c_str(), job.id.c_str(),
+                 code);
+          inFlightTests[job.pass]--;
+        }
+        break;
+      }
+      fflush(stdout);
+    }
+  }
+
+  return 0;
+}
+
+#else  /* _MSC_VER */
+
+#include <cstdio>
+
+int main(void)
+{
+  fprintf(stderr, "pipectl is not supported on this platform\n");
+  return 1;
+}
+
+#endif
@@ -0,0 +1,275 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/*
+ * ppdirindex: native preprocessor-directive scanner backing the
+ * includes and unifdef passes.
+ *
+ *   ppdirindex index [file]     one record per directive:
+ *                               "<kind> <line> <offset> <length> <depth>"
+ *   ppdirindex symbols [file]   the macro names tested by conditional
+ *                               directives, unique and sorted, one per
+ *                               line (what `unifdef -s` reports)
+ *
+ * Reads <file> (or stdin when omitted or "-").  <kind> is the directive
+ * name (include, if, ifdef, ifndef, elif, else, endif, define, undef,
+ * pragma, error, ...); <line> is 1-based, <offset>/<length> delimit the
+ * whole directive in bytes including continuation lines and the
+ * trailing newline, so removing a directive is the splice
+ * [offset, offset + length).  <depth> is the conditional nesting level
+ * the directive belongs to (an #if at the top level and its matching
+ * #endif both report 0).
+ *
+ * Directives hide inside block comments and string literals, so the
+ * scan keeps a small lexical state across lines; that is also why every
+ * consumer used to pay its own full re-scan of the same never-changing
+ * header region per candidate.  One pass over the bytes here replaces a
+ * Python regex loop (includes pass) or an unifdef invocation (symbol
+ * listing) per probe.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void die(const char *msg)
+{
+  fprintf(stderr, "ppdirindex: %s\n", msg);
+  exit(2);
+}
+
+/* read the whole stream into a malloc'd buffer */
+static char *read_all(FILE *f, size_t *len)
+{
+  size_t cap = 1 << 20;
+  size_t used = 0;
+  char *buf = malloc(cap);
+  if (!buf)
+    die("out of memory");
+  for (;;) {
+    size_t got = fread(buf + used, 1, cap - used, f);
+    used += got;
+    if (got == 0)
+      break;
+    if (used == cap) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+      if (!buf)
+        die("out of memory");
+    }
+  }
+  if (ferror(f))
+    die("read error");
+  *len = used;
+  return buf;
+}
+
+/* lexical state carried across lines; only BLOCK matters at a line
+ * start (strings and line comments cannot span a newline, and an
+ * unterminated one is closed by it) */
+enum lexstate { NORMAL, BLOCK };
+
+/* advance the state machine over one line's bytes */
+static enum lexstate scan_bytes(const char *p, size_t len, enum lexstate st)
+{
+  size_t i = 0;
+  int quote = 0;              /* '"' or '\'' while inside a literal */
+  while (i < len) {
+    char c = p[i];
+    if (st == BLOCK) {
+      if (c == '*' && i + 1 < len && p[i + 1] == '/') {
+        st = NORMAL;
+        i++;
+      }
+    }
+    else if (quote) {
+      if (c == '\\')
+        i++;
+      else if (c == quote)
+        quote = 0;
+    }
+    else if (c == '"' || c == '\'') {
+      quote = c;
+    }
+    else if (c == '/' && i + 1 < len && p[i + 1] == '/') {
+      break;                  /* rest of the line is comment */
+    }
+    else if (c == '/' && i + 1 < len && p[i + 1] == '*') {
+      st = BLOCK;
+      i++;
+    }
+    i++;
+  }
+  return st;
+}
+
+/* symbol table for the symbols mode; conditional expressions test a
+ * handful of macros, so linear dedup is fine */
+static char **symbols = NULL;
+static size_t num_symbols = 0;
+static size_t cap_symbols = 0;
+
+static void add_symbol(const char *s, size_t len)
+{
+  size_t i;
+  for (i = 0; i < num_symbols; i++) {
+    if (strlen(symbols[i]) == len && memcmp(symbols[i], s, len) == 0)
+      return;
+  }
+  if (num_symbols == cap_symbols) {
+    cap_symbols = cap_symbols ? 2 * cap_symbols : 64;
+    symbols = realloc(symbols, cap_symbols * sizeof(char *));
+    if (!symbols)
+      die("out of memory");
+  }
+  symbols[num_symbols] = malloc(len + 1);
+  if (!symbols[num_symbols])
+    die("out of memory");
+  memcpy(symbols[num_symbols], s, len);
+  symbols[num_symbols][len] = '\0';
+  num_symbols++;
+}
+
+static int symbol_cmp(const void *a, const void *b)
+{
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/* collect the identifiers of a conditional expression, skipping the
+ * "defined" operator and anything that starts with a digit */
+static void collect_symbols(const char *p, size_t len, int first_only)
+{
+  size_t i = 0;
+  while (i < len) {
+    if (p[i] == '/' && i + 1 < len && (p[i + 1] == '/' || p[i + 1] == '*'))
+      break;                  /* a trailing comment is not an operand */
+    if (isalpha((unsigned char)p[i]) || p[i] == '_') {
+      size_t start = i;
+      while (i < len && (isalnum((unsigned char)p[i]) || p[i] == '_'))
+        i++;
+      if (i - start != 7 || memcmp(p + start, "defined", 7) != 0) {
+        add_symbol(p + start, i - start);
+        if (first_only)
+          return;
+      }
+    }
+    else {
+      i++;
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2 || argc > 3 ||
+      (strcmp(argv[1], "index") != 0 && strcmp(argv[1], "symbols") != 0)) {
+    fprintf(stderr, "usage: %s <index|symbols> [file]\n", argv[0]);
+    return 2;
+  }
+  int symbols_mode = (strcmp(argv[1], "symbols") == 0);
+
+  FILE *in = stdin;
+  if (argc == 3 && strcmp(argv[2], "-") != 0) {
+    in = fopen(argv[2], "rb");
+    if (!in)
+      die("cannot open input");
+  }
+  size_t len;
+  char *buf = read_all(in, &len);
+  if (in != stdin)
+    fclose(in);
+
+  enum lexstate st = NORMAL;
+  int depth = 0;
+  unsigned long lineno = 0;
+  size_t pos = 0;
+  while (pos < len) {
+    const char *nl = memchr(buf + pos, '\n', len - pos);
+    size_t line_end = nl ? (size_t)(nl - buf) + 1 : len;
+    lineno++;
+
+    size_t i = pos;
+    while (i < line_end && (buf[i] == ' ' || buf[i] == '\t'))
+      i++;
+    if (st != NORMAL || i >= line_end || buf[i] != '#') {
+      st = scan_bytes(buf + pos, line_end - pos, st);
+      pos = line_end;
+      continue;
+    }
+
+    /* directive: name after '#' and optional whitespace */
+    i++;
+    while (i < line_end && (buf[i] == ' ' || buf[i] == '\t'))
+      i++;
+    size_t name_start = i;
+    while (i < line_end &&
+           (isalnum((unsigned char)buf[i]) || buf[i] == '_'))
+      i++;
+    size_t name_len = i - name_start;
+
+    /* extend over continuation lines; the state machine still has to
+     * see every consumed byte (a #define can open a block comment) */
+    size_t dir_start = pos;
+    unsigned long first_line = lineno;
+    for (;;) {
+      size_t last = line_end;
+      while (last > pos && (buf[last - 1] == '\n' || buf[last - 1] == '\r'))
+        last--;
+      if (last == pos || buf[last - 1] != '\\' || line_end >= len)
+        break;
+      pos = line_end;
+      nl = memchr(buf + pos, '\n', len - pos);
+      line_end = nl ? (size_t)(nl - buf) + 1 : len;
+      lineno++;
+    }
+    st = scan_bytes(buf + dir_start, line_end - dir_start, st);
+
+    char kind[32];
+    if (name_len == 0 || name_len >= sizeof(kind))
+      strcpy(kind, "other");
+    else {
+      memcpy(kind, buf + name_start, name_len);
+      kind[name_len] = '\0';
+    }
+
+    int is_if = (strcmp(kind, "if") == 0 || strcmp(kind, "ifdef") == 0 ||
+                 strcmp(kind, "ifndef") == 0);
+    int is_end = (strcmp(kind, "endif") == 0);
+    int is_mid = (strcmp(kind, "elif") == 0 || strcmp(kind, "else") == 0);
+
+    if (is_end && depth > 0)
+      depth--;
+    int report = depth;
+    if (is_mid && report > 0)
+      report--;
+
+    if (symbols_mode) {
+      if (is_if || strcmp(kind, "elif") == 0)
+        collect_symbols(buf + name_start + name_len,
+                        line_end - name_start - name_len,
+                        strcmp(kind, "if") != 0 &&
+                        strcmp(kind, "elif") != 0);
+    }
+    else {
+      printf("%s %lu %lu %lu %d\n", kind, first_line,
+             (unsigned long)dir_start,
+             (unsigned long)(line_end - dir_start), report);
+    }
+
+    if (is_if)
+      depth++;
+    pos = line_end;
+  }
+
+  if (symbols_mode) {
+    qsort(symbols, num_symbols, sizeof(char *), symbol_cmp);
+    size_t i;
+    for (i = 0; i < num_symbols; i++)
+      printf("%s\n", symbols[i]);
+  }
+  free(buf);
+  return 0;
+}
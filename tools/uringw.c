@@ -0,0 +1,314 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/* see uringw.h for the interface contract */
+
+#include "uringw.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    define URINGW_HAVE_IO_URING 1
+#  endif
+#endif
+
+#ifdef URINGW_HAVE_IO_URING
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+struct uringw_slot {
+  int fd;
+  size_t total;
+  struct iovec iov[URINGW_MAX_SPANS];
+  unsigned n_iov;
+};
+
+struct uringw {
+  int ring_fd;
+  unsigned entries;
+  unsigned pending;
+  /* submission ring */
+  void *sq_ring;
+  size_t sq_ring_sz;
+  unsigned *sq_tail;
+  unsigned *sq_mask;
+  unsigned *sq_array;
+  struct io_uring_sqe *sqes;
+  size_t sqes_sz;
+  /* completion ring */
+  void *cq_ring;
+  size_t cq_ring_sz;
+  unsigned *cq_head;
+  unsigned *cq_tail;
+  unsigned *cq_mask;
+  struct io_uring_cqe *cqes;
+  struct uringw_slot *slots;
+};
+
+struct uringw *uringw_open(unsigned entries)
+{
+  struct io_uring_params p;
+  struct uringw *w;
+  char *sq, *cq;
+
+  memset(&p, 0, sizeof(p));
+  int fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+  if (fd < 0)
+    return NULL;        /* old kernel or a seccomp filter; not an error */
+
+  w = calloc(1, sizeof(*w));
+  if (!w) {
+    close(fd);
+    return NULL;
+  }
+  w->ring_fd = fd;
+  w->entries = p.sq_entries;
+  w->sq_ring_sz = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  w->cq_ring_sz = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  w->sqes_sz = p.sq_entries * sizeof(struct io_uring_sqe);
+  w->sq_ring = mmap(NULL, w->sq_ring_sz, PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, IORING_OFF_SQ_RING);
+  w->cq_ring = mmap(NULL, w->cq_ring_sz, PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, IORING_OFF_CQ_RING);
+  w->sqes = mmap(NULL, w->sqes_sz, PROT_READ | PROT_WRITE,
+                 MAP_SHARED, fd, IORING_OFF_SQES);
+  w->slots = calloc(p.sq_entries, sizeof(struct uringw_slot));
+  if (w->sq_ring == MAP_FAILED || w->cq_ring == MAP_FAILED ||
+      w->sqes == MAP_FAILED || !w->slots) {
+    if (w->sq_ring != MAP_FAILED)
+      munmap(w->sq_ring, w->sq_ring_sz);
+    if (w->cq_ring != MAP_FAILED)
+      munmap(w->cq_ring, w->cq_ring_sz);
+    if (w->sqes != MAP_FAILED)
+      munmap(w->sqes, w->sqes_sz);
+    free(w->slots);
+    close(fd);
+    free(w);
+    return NULL;
+  }
+  sq = w->sq_ring;
+  cq = w->cq_ring;
+  w->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+  w->sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+  w->sq_array = (unsigned *)(sq + p.sq_off.array);
+  w->cq_head = (unsigned *)(cq + p.cq_off.head);
+  w->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+  w->cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+  w->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+  return w;
+}
+
+int uringw_put(struct uringw *w, const char *path,
+               const struct uringw_span *spans, unsigned n)
+{
+  struct uringw_slot *s;
+  struct io_uring_sqe *sqe;
+  unsigned slot, idx, i;
+  int fd;
+
+  if (!w || n == 0 || n > URINGW_MAX_SPANS || w->pending >= w->entries)
+    return -1;
+  fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0)
+    return -1;
+
+  slot = w->pending;
+  s = &w->slots[slot];
+  s->fd = fd;
+  s->total = 0;
+  s->n_iov = n;
+  for (i = 0; i < n; i++) {
+    s->iov[i].iov_base = (void *)spans[i].base;
+    s->iov[i].iov_len = spans[i].len;
+    s->total += spans[i].len;
+  }
+
+  /* the tail is only published at flush time; until then the new
+   * entries sit in the ring slots past it */
+  idx = (*w->sq_tail + slot) & *w->sq_mask;
+  sqe = &w->sqes[idx];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = IORING_OP_WRITEV;
+  sqe->fd = fd;
+  sqe->addr = (uint64_t)(uintptr_t)s->iov;
+  sqe->len = n;
+  sqe->user_data = slot;
+  w->sq_array[idx] = idx;
+  w->pending++;
+  return (int)slot;
+}
+
+unsigned uringw_pending(const struct uringw *w)
+{
+  return w ? w->pending : 0;
+}
+
+unsigned uringw_capacity(const struct uringw *w)
+{
+  return w ? w->entries : 0;
+}
+
+/* synchronous salvage of one failed entry: an O_TRUNC-style rewrite is
+ * idempotent, so it is safe even when the async write partly ran */
+static int rewrite_sync(struct uringw_slot *s)
+{
+  struct iovec iov[URINGW_MAX_SPANS];
+  unsigned off = 0, n = s->n_iov;
+
+  if (ftruncate(s->fd, 0) != 0 || lseek(s->fd, 0, SEEK_SET) != 0)
+    return 0;
+  memcpy(iov, s->iov, n * sizeof(struct iovec));
+  while (off < n) {
+    ssize_t put = writev(s->fd, iov + off, n - off);
+    if (put < 0)
+      return 0;
+    while (off < n && (size_t)put >= iov[off].iov_len) {
+      put -= (ssize_t)iov[off].iov_len;
+      off++;
+    }
+    if (off < n && put > 0) {
+      iov[off].iov_base = (char *)iov[off].iov_base + put;
+      iov[off].iov_len -= (size_t)put;
+    }
+  }
+  return 1;
+}
+
+int uringw_flush(struct uringw *w, unsigned char *ok)
+{
+  unsigned head, tail, done = 0, fails = 0, slot;
+  int hard_error = 0;
+
+  if (!w || w->pending == 0)
+    return 0;
+  if (ok)
+    memset(ok, 1, w->pending);
+
+  __atomic_store_n(w->sq_tail, *w->sq_tail + w->pending, __ATOMIC_RELEASE);
+  for (;;) {
+    /* the kernel submits at most what is actually in the ring, so
+     * retrying with the same count after EINTR cannot double-submit */
+    long r = syscall(__NR_io_uring_enter, w->ring_fd, w->pending,
+                     w->pending, IORING_ENTER_GETEVENTS, NULL, 0);
+    if (r >= 0)
+      break;
+    if (errno != EINTR) {
+      hard_error = 1;
+      break;
+    }
+  }
+
+  /* reap whatever completed; under a hard error every entry is
+   * rewritten synchronously below, which is idempotent */
+  head = *w->cq_head;
+  tail = __atomic_load_n(w->cq_tail, __ATOMIC_ACQUIRE);
+  while (head != tail && done < w->pending) {
+    const struct io_uring_cqe *cqe = &w->cqes[head & *w->cq_mask];
+    slot = (unsigned)cqe->user_data;
+    if (slot < w->pending &&
+        (cqe->res < 0 || (size_t)cqe->res != w->slots[slot].total)) {
+      if (!rewrite_sync(&w->slots[slot])) {
+        fails++;
+        if (ok)
+          ok[slot] = 0;
+      }
+    }
+    head++;
+    done++;
+    if (head == tail)
+      tail = __atomic_load_n(w->cq_tail, __ATOMIC_ACQUIRE);
+  }
+  __atomic_store_n(w->cq_head, head, __ATOMIC_RELEASE);
+
+  if (hard_error) {
+    for (slot = 0; slot < w->pending; slot++) {
+      if (ok && !ok[slot])
+        continue;
+      if (!rewrite_sync(&w->slots[slot])) {
+        fails++;
+        if (ok)
+          ok[slot] = 0;
+      }
+    }
+  }
+
+  for (slot = 0; slot < w->pending; slot++) {
+    if (close(w->slots[slot].fd) != 0) {
+      if (!ok || ok[slot]) {
+        fails++;
+        if (ok)
+          ok[slot] = 0;
+      }
+    }
+  }
+  w->pending = 0;
+  return (int)fails;
+}
+
+void uringw_close(struct uringw *w)
+{
+  if (!w)
+    return;
+  uringw_flush(w, NULL);
+  munmap(w->sq_ring, w->sq_ring_sz);
+  munmap(w->cq_ring, w->cq_ring_sz);
+  munmap(w->sqes, w->sqes_sz);
+  free(w->slots);
+  close(w->ring_fd);
+  free(w);
+}
+
+#else /* !URINGW_HAVE_IO_URING */
+
+struct uringw *uringw_open(unsigned entries)
+{
+  (void)entries;
+  return NULL;
+}
+
+int uringw_put(struct uringw *w, const char *path,
+               const struct uringw_span *spans, unsigned n)
+{
+  (void)w;
+  (void)path;
+  (void)spans;
+  (void)n;
+  return -1;
+}
+
+unsigned uringw_pending(const struct uringw *w)
+{
+  (void)w;
+  return 0;
+}
+
+unsigned uringw_capacity(const struct uringw *w)
+{
+  (void)w;
+  return 0;
+}
+
+int uringw_flush(struct uringw *w, unsigned char *ok)
+{
+  (void)w;
+  (void)ok;
+  return 0;
+}
+
+void uringw_close(struct uringw *w)
+{
+  (void)w;
+}
+
+#endif
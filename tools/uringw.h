@@ -0,0 +1,67 @@
+/*
+ * This file is distributed under the University of Illinois Open Source
+ * License.  See the file COPYING for details.
+ */
+
+/*
+ * uringw: batched small-file writer over io_uring.
+ *
+ * Late-stage reduction materializes tens of tiny candidate files per
+ * second per worker, and the open/write/close sequence per file is then
+ * mostly syscall overhead.  This helper queues whole-file writes and
+ * submits a batch with a single io_uring_enter, so the write syscalls
+ * for a batch collapse into one.
+ *
+ * uringw_open() returns NULL when io_uring is unavailable (non-Linux
+ * build, old kernel, seccomp); callers keep their plain write path as
+ * the fallback.  A queued file's spans must stay valid until the next
+ * uringw_flush(), which waits for the whole batch, salvages any failed
+ * entry with a synchronous rewrite, closes the descriptors and reports
+ * the number of files that could not be written at all.
+ */
+
+#ifndef URINGW_H
+#define URINGW_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* one gathered extent of a queued file */
+struct uringw_span {
+  const void *base;
+  size_t len;
+};
+
+#define URINGW_MAX_SPANS 8
+
+struct uringw;
+
+/* returns NULL when io_uring cannot be used; entries is the most that
+ * can be queued between flushes (rounded up by the kernel) */
+struct uringw *uringw_open(unsigned entries);
+
+/* queue path to be created/truncated and written from the spans;
+ * returns the queue slot (for the flush status array) or -1 when the
+ * file cannot be opened, the span count is over URINGW_MAX_SPANS, or
+ * the queue is full and needs a flush first */
+int uringw_put(struct uringw *w, const char *path,
+               const struct uringw_span *spans, unsigned n);
+
+unsigned uringw_pending(const struct uringw *w);
+
+unsigned uringw_capacity(const struct uringw *w);
+
+/* submit and wait for everything queued; when ok is non-NULL it
+ * receives one 1/0 entry per queue slot; returns the failure count */
+int uringw_flush(struct uringw *w, unsigned char *ok);
+
+void uringw_close(struct uringw *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif